@@ -83,6 +83,15 @@ union cptable
     struct dbcs_table dbcs;
 };
 
+/* Unicode character properties, except the folding offsets that only FoldString needs */
+struct wine_char_info
+{
+    unsigned short        type;       /* C1_* and C2_* flags, see get_char_typeW */
+    WCHAR                 lower;      /* offset to the lowercase char */
+    WCHAR                 upper;      /* offset to the uppercase char */
+    unsigned int          collation;  /* collation element, see sortkey.c */
+};
+
 extern const union cptable *wine_cp_get_table( unsigned int codepage );
 extern const union cptable *wine_cp_enum_table( unsigned int index );
 
@@ -99,11 +108,16 @@ extern int wine_utf8_wcstombs( int flags, const WCHAR *src, int srclen, char *ds
 
 extern int wine_compare_string( int flags, const WCHAR *str1, int len1, const WCHAR *str2, int len2 );
 extern int wine_get_sortkey( int flags, const WCHAR *src, int srclen, char *dst, int dstlen );
+extern int wine_get_sortkeys( int flags, const WCHAR * const *strs, const int *lens, unsigned int count,
+                              char *dst, int dstlen, unsigned int *offsets );
+extern int wine_sort_sortkeys( const char *keys, const unsigned int *offsets, unsigned int count,
+                               unsigned int *order );
 extern int wine_fold_string( int flags, const WCHAR *src, int srclen , WCHAR *dst, int dstlen );
 
 extern int strcmpiW( const WCHAR *str1, const WCHAR *str2 );
 extern int strncmpiW( const WCHAR *str1, const WCHAR *str2, int n );
 extern int memicmpW( const WCHAR *str1, const WCHAR *str2, int n );
+extern unsigned int wine_ascii_icmp_prefix( const WCHAR *str1, const WCHAR *str2, unsigned int len );
 extern WCHAR *strstrW( const WCHAR *str, const WCHAR *sub );
 extern long int strtolW( const WCHAR *nptr, WCHAR **endptr, int base );
 extern unsigned long int strtoulW( const WCHAR *nptr, WCHAR **endptr, int base );
@@ -117,24 +131,30 @@ WINE_UNICODE_INLINE int wine_is_dbcs_leadbyte( const union cptable *table, unsig
     return (table->info.char_size == 2) && (table->dbcs.cp2uni_leadbytes[ch]);
 }
 
+/* the properties of a character in one record, the first 256 records */
+/* are the Latin-1 range and can be indexed directly by the character */
+WINE_UNICODE_INLINE const struct wine_char_info *get_char_infoW( WCHAR ch )
+{
+    extern WINE_UNICODE_API const unsigned char wine_char_info_index[];
+    extern WINE_UNICODE_API const struct wine_char_info wine_char_info_table[];
+    return &wine_char_info_table[(wine_char_info_index[ch >> 8] << 8) + (ch & 0xff)];
+}
+
 WINE_UNICODE_INLINE WCHAR tolowerW( WCHAR ch )
 {
-    extern WINE_UNICODE_API const WCHAR wine_casemap_lower[];
-    return ch + wine_casemap_lower[wine_casemap_lower[ch >> 8] + (ch & 0xff)];
+    return ch + get_char_infoW( ch )->lower;
 }
 
 WINE_UNICODE_INLINE WCHAR toupperW( WCHAR ch )
 {
-    extern WINE_UNICODE_API const WCHAR wine_casemap_upper[];
-    return ch + wine_casemap_upper[wine_casemap_upper[ch >> 8] + (ch & 0xff)];
+    return ch + get_char_infoW( ch )->upper;
 }
 
 /* the character type contains the C1_* flags in the low 12 bits */
 /* and the C2_* type in the high 4 bits */
 WINE_UNICODE_INLINE unsigned short get_char_typeW( WCHAR ch )
 {
-    extern WINE_UNICODE_API const unsigned short wine_wctype_table[];
-    return wine_wctype_table[wine_wctype_table[ch >> 8] + (ch & 0xff)];
+    return get_char_infoW( ch )->type;
 }
 
 WINE_UNICODE_INLINE int iscntrlW( WCHAR wc )
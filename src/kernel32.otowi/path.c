@@ -27,6 +27,22 @@
 #include <errno.h>
 #include <stdio.h>
 #include <stdarg.h>
+#ifdef HAVE_SYS_IOCTL_H
+# include <sys/ioctl.h>
+#endif
+#ifdef HAVE_SYS_STAT_H
+# include <sys/stat.h>
+#endif
+#ifdef HAVE_SYS_SYSCALL_H
+# include <sys/syscall.h>
+#endif
+#ifdef HAVE_UNISTD_H
+# include <unistd.h>
+#endif
+#ifdef __linux__
+# include <sys/sendfile.h>
+# include <linux/fs.h>
+#endif
 
 #include "winerror.h"
 #include "ntstatus.h"
@@ -1151,6 +1167,134 @@ BOOL WINAPI CopyFileA( LPCSTR source, LPCSTR dest, BOOL fail_if_exists)
 }
 
 
+/* state of a CopyFileEx operation, for progress notifications */
+struct copy_progress
+{
+    LPPROGRESS_ROUTINE routine;
+    LPVOID             param;
+    LPBOOL             cancel_ptr;
+    HANDLE             source;
+    HANDLE             dest;
+    LARGE_INTEGER      total;
+    LARGE_INTEGER      transferred;
+    BOOL               delete_dest;
+};
+
+#define COPY_CHUNK_SIZE (8 * 1024 * 1024)  /* amount of data copied between progress notifications */
+
+/***********************************************************************
+ *           copy_file_progress
+ *
+ * Check for cancellation and notify the progress routine.
+ * Returns FALSE if the copy has to be aborted.
+ */
+static BOOL copy_file_progress( struct copy_progress *cp, DWORD reason )
+{
+    if (cp->cancel_ptr && *cp->cancel_ptr)
+    {
+        cp->delete_dest = TRUE;
+        SetLastError( ERROR_REQUEST_ABORTED );
+        return FALSE;
+    }
+    if (!cp->routine) return TRUE;
+
+    switch (cp->routine( cp->total, cp->transferred, cp->total, cp->transferred, 1, reason,
+                         cp->source, cp->dest, cp->param ))
+    {
+    case PROGRESS_CONTINUE:
+        return TRUE;
+    case PROGRESS_QUIET:
+        cp->routine = NULL;
+        return TRUE;
+    case PROGRESS_CANCEL:
+        cp->delete_dest = TRUE;
+        /* fall through */
+    case PROGRESS_STOP:
+        SetLastError( ERROR_REQUEST_ABORTED );
+        return FALSE;
+    default:
+        FIXME( "unhandled progress routine result\n" );
+        return TRUE;
+    }
+}
+
+/***********************************************************************
+ *           copy_file_data_unix
+ *
+ * Copy the file data without bouncing it through user space: reflink the
+ * whole file if the filesystem supports it, otherwise copy it in chunks
+ * with copy_file_range or sendfile. Both descriptors are used from their
+ * current offsets, so a partial copy can be finished by the caller.
+ * Returns FALSE if the caller has to fall back to a read/write loop,
+ * otherwise the copy result is stored in ret.
+ */
+static BOOL copy_file_data_unix( int src, int dst, struct copy_progress *cp, BOOL *ret )
+{
+#ifdef __linux__
+    enum { COPY_RANGE, COPY_SENDFILE } method = COPY_RANGE;
+    ssize_t res;
+
+    *ret = FALSE;
+
+#ifdef FICLONE
+    if (!cp->transferred.QuadPart && !ioctl( dst, FICLONE, src ))
+    {
+        TRACE( "cloned %s bytes\n", wine_dbgstr_longlong( cp->total.QuadPart ));
+        cp->transferred = cp->total;
+        *ret = copy_file_progress( cp, CALLBACK_CHUNK_FINISHED );
+        return TRUE;
+    }
+#endif
+
+    for (;;)
+    {
+#ifdef __NR_copy_file_range
+        if (method == COPY_RANGE)
+            res = syscall( __NR_copy_file_range, src, NULL, dst, NULL, COPY_CHUNK_SIZE, 0 );
+        else
+#endif
+            res = sendfile( dst, src, NULL, COPY_CHUNK_SIZE );
+
+        if (res == -1)
+        {
+            if (errno == EINTR) continue;
+            if (errno == EXDEV || errno == ENOSYS || errno == EINVAL || errno == EOPNOTSUPP)
+            {
+                /* not supported for these files, try the next method */
+                if (method == COPY_RANGE)
+                {
+                    method = COPY_SENDFILE;
+                    continue;
+                }
+                return FALSE;
+            }
+            FILE_SetDosError();
+            return TRUE;
+        }
+        if (!res)
+        {
+            /* copy_file_range returns 0 on procfs, sysfs and some FUSE files, so only
+             * trust it once some data was copied and the expected size is reached */
+            if (method == COPY_RANGE && (!cp->transferred.QuadPart ||
+                                         cp->transferred.QuadPart < cp->total.QuadPart))
+            {
+                method = COPY_SENDFILE;
+                continue;
+            }
+            if (!cp->transferred.QuadPart) return FALSE;
+            break;  /* end of file */
+        }
+
+        cp->transferred.QuadPart += res;
+        if (!copy_file_progress( cp, CALLBACK_CHUNK_FINISHED )) return TRUE;
+    }
+    *ret = TRUE;
+    return TRUE;
+#else
+    return FALSE;
+#endif
+}
+
 /**************************************************************************
  *           CopyFileExW   (KERNEL32.@)
  */
@@ -1161,20 +1305,18 @@ BOOL WINAPI CopyFileExW(LPCWSTR source, LPCWSTR dest,
     static const int buffer_size = 65536;
     HANDLE h1, h2;
     BY_HANDLE_FILE_INFORMATION info;
+    struct copy_progress cp;
     DWORD count;
     BOOL ret = FALSE;
-    char *buffer;
+    char *buffer = NULL;
+    ULONGLONG reported;
+    int fd1, fd2;
 
     if (!source || !dest)
     {
         SetLastError(ERROR_INVALID_PARAMETER);
         return FALSE;
     }
-    if (!(buffer = HeapAlloc( GetProcessHeap(), 0, buffer_size )))
-    {
-        SetLastError(ERROR_NOT_ENOUGH_MEMORY);
-        return FALSE;
-    }
 
     TRACE("%s -> %s, %x\n", debugstr_w(source), debugstr_w(dest), flags);
 
@@ -1183,14 +1325,12 @@ BOOL WINAPI CopyFileExW(LPCWSTR source, LPCWSTR dest,
                      NULL, OPEN_EXISTING, 0, 0)) == INVALID_HANDLE_VALUE)
     {
         WARN("Unable to open source %s\n", debugstr_w(source));
-        HeapFree( GetProcessHeap(), 0, buffer );
         return FALSE;
     }
 
     if (!GetFileInformationByHandle( h1, &info ))
     {
         WARN("GetFileInformationByHandle returned error for %s\n", debugstr_w(source));
-        HeapFree( GetProcessHeap(), 0, buffer );
         CloseHandle( h1 );
         return FALSE;
     }
@@ -1207,7 +1347,6 @@ BOOL WINAPI CopyFileExW(LPCWSTR source, LPCWSTR dest,
         }
         if (same_file)
         {
-            HeapFree( GetProcessHeap(), 0, buffer );
             CloseHandle( h1 );
             SetLastError( ERROR_SHARING_VIOLATION );
             return FALSE;
@@ -1219,11 +1358,43 @@ BOOL WINAPI CopyFileExW(LPCWSTR source, LPCWSTR dest,
                              info.dwFileAttributes, h1 )) == INVALID_HANDLE_VALUE)
     {
         WARN("Unable to open dest %s\n", debugstr_w(dest));
-        HeapFree( GetProcessHeap(), 0, buffer );
         CloseHandle( h1 );
         return FALSE;
     }
 
+    cp.routine     = progress;
+    cp.param       = param;
+    cp.cancel_ptr  = cancel_ptr;
+    cp.source      = h1;
+    cp.dest        = h2;
+    cp.total.u.LowPart  = info.nFileSizeLow;
+    cp.total.u.HighPart = info.nFileSizeHigh;
+    cp.transferred.QuadPart = 0;
+    cp.delete_dest = FALSE;
+
+    if (!copy_file_progress( &cp, CALLBACK_STREAM_SWITCH )) goto done;
+
+    if (wine_server_handle_to_fd( h1, FILE_READ_DATA, &fd1, NULL ) == STATUS_SUCCESS)
+    {
+        BOOL handled = FALSE;
+
+        if (wine_server_handle_to_fd( h2, FILE_WRITE_DATA, &fd2, NULL ) == STATUS_SUCCESS)
+        {
+            handled = copy_file_data_unix( fd1, fd2, &cp, &ret );
+            wine_server_release_fd( h2, fd2 );
+        }
+        wine_server_release_fd( h1, fd1 );
+        if (handled) goto done;
+    }
+
+    /* fall back to copying through a user space buffer */
+    if (!(buffer = HeapAlloc( GetProcessHeap(), 0, buffer_size )))
+    {
+        SetLastError(ERROR_NOT_ENOUGH_MEMORY);
+        goto done;
+    }
+
+    reported = cp.transferred.QuadPart;
     while (ReadFile( h1, buffer, buffer_size, &count, NULL ) && count)
     {
         char *p = buffer;
@@ -1233,8 +1404,15 @@ BOOL WINAPI CopyFileExW(LPCWSTR source, LPCWSTR dest,
             if (!WriteFile( h2, p, count, &res, NULL ) || !res) goto done;
             p += res;
             count -= res;
+            cp.transferred.QuadPart += res;
+        }
+        if (cp.transferred.QuadPart - reported >= COPY_CHUNK_SIZE)
+        {
+            reported = cp.transferred.QuadPart;
+            if (!copy_file_progress( &cp, CALLBACK_CHUNK_FINISHED )) goto done;
         }
     }
+    if (cp.transferred.QuadPart != reported && !copy_file_progress( &cp, CALLBACK_CHUNK_FINISHED )) goto done;
     ret =  TRUE;
 done:
     /* Maintain the timestamp of source file to destination file */
@@ -1242,6 +1420,7 @@ done:
     HeapFree( GetProcessHeap(), 0, buffer );
     CloseHandle( h1 );
     CloseHandle( h2 );
+    if (cp.delete_dest) DeleteFileW( dest );
     return ret;
 }
 
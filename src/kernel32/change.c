@@ -0,0 +1,106 @@
+/*
+ * Win32 kernel directory change notification functions
+ *
+ * Copyright 1998 Ulrich Weigand
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301, USA
+ */
+
+#include "config.h"
+#include "wine/port.h"
+
+#include <stdarg.h>
+#include <string.h>
+
+#include "ntstatus.h"
+#define WIN32_NO_STATUS
+#define NONAMELESSUNION
+#include "windef.h"
+#include "winbase.h"
+#include "winternl.h"
+#include "wine/debug.h"
+
+WINE_DEFAULT_DEBUG_CHANNEL(file);
+
+static void CALLBACK invoke_completion( void *context, IO_STATUS_BLOCK *io, ULONG reserved )
+{
+    LPOVERLAPPED_COMPLETION_ROUTINE completion = context;
+    completion( io->u.Status, io->Information, (LPOVERLAPPED)io );
+}
+
+/****************************************************************************
+ *		ReadDirectoryChangesW (KERNEL32.@)
+ *
+ * NOTES
+ *
+ *  Changes are tracked from the first call on a handle until it is closed.
+ *  The OVERLAPPED structure is written to with the status of the request,
+ *  which is returned by GetOverlappedResult.
+ */
+BOOL WINAPI ReadDirectoryChangesW( HANDLE handle, LPVOID buffer, DWORD len, BOOL subtree,
+                                   DWORD filter, LPDWORD returned, LPOVERLAPPED overlapped,
+                                   LPOVERLAPPED_COMPLETION_ROUTINE completion )
+{
+    OVERLAPPED ov, *pov;
+    IO_STATUS_BLOCK *ios;
+    NTSTATUS status;
+    LPVOID cvalue = NULL;
+
+    TRACE("%p %p %08x %d %08x %p %p %p\n", handle, buffer, len, subtree, filter,
+           returned, overlapped, completion );
+
+    if (!overlapped)
+    {
+        memset( &ov, 0, sizeof ov );
+        if ((status = NtCreateEvent( &ov.hEvent, EVENT_ALL_ACCESS, NULL, NotificationEvent, FALSE )))
+        {
+            SetLastError( RtlNtStatusToDosError(status) );
+            return FALSE;
+        }
+        pov = &ov;
+    }
+    else
+    {
+        pov = overlapped;
+        if (completion) cvalue = completion;
+    }
+
+    ios = (PIO_STATUS_BLOCK) pov;
+    ios->u.Status = STATUS_PENDING;
+
+    status = NtNotifyChangeDirectoryFile( handle, completion && overlapped ? NULL : pov->hEvent,
+                                          completion && overlapped ? invoke_completion : NULL,
+                                          cvalue, ios, buffer, len, filter, subtree );
+
+    if (!overlapped)
+    {
+        if (status == STATUS_PENDING)
+        {
+            /* not alertable, the request still uses ov until it completes */
+            WaitForSingleObject( ov.hEvent, INFINITE );
+            status = ios->u.Status;
+        }
+        if (returned) *returned = ios->Information;
+        NtClose( ov.hEvent );
+    }
+    else if (status == STATUS_PENDING) return TRUE;
+
+    if (status != STATUS_SUCCESS)
+    {
+        SetLastError( RtlNtStatusToDosError(status) );
+        return FALSE;
+    }
+    return TRUE;
+}
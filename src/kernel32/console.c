@@ -2390,8 +2390,9 @@ BOOL WINAPI WriteConsoleW(HANDLE hConsoleOutput, LPCVOID lpBuffer, DWORD nNumber
 
     if ((fd = get_console_bare_fd(hConsoleOutput)) != -1)
     {
-        char*           ptr;
-        unsigned        len;
+        char            buffer[1024];
+        char*           ptr = buffer;
+        INT             len = 0;
         HANDLE          hFile;
         NTSTATUS        status;
         IO_STATUS_BLOCK iosb;
@@ -2400,11 +2401,11 @@ BOOL WINAPI WriteConsoleW(HANDLE hConsoleOutput, LPCVOID lpBuffer, DWORD nNumber
         /* FIXME: mode ENABLED_OUTPUT is not processed (or actually we rely on underlying Unix/TTY fd
          * to do the job
          */
-        len = WideCharToMultiByte(CP_UNIXCP, 0, lpBuffer, nNumberOfCharsToWrite, NULL, 0, NULL, NULL);
-        if ((ptr = HeapAlloc(GetProcessHeap(), 0, len)) == NULL)
+        if (nNumberOfCharsToWrite &&
+            !(ptr = LOCALE_WideCharToMultiByte(CP_UNIXCP, 0, lpBuffer, nNumberOfCharsToWrite,
+                                               buffer, sizeof(buffer), &len)))
             return FALSE;
 
-        WideCharToMultiByte(CP_UNIXCP, 0, lpBuffer, nNumberOfCharsToWrite, ptr, len, NULL, NULL);
         hFile = wine_server_ptr_handle(console_handle_unmap(hConsoleOutput));
         status = NtWriteFile(hFile, NULL, NULL, NULL, &iosb, ptr, len, 0, NULL);
         if (status == STATUS_PENDING)
@@ -2420,7 +2421,7 @@ BOOL WINAPI WriteConsoleW(HANDLE hConsoleOutput, LPCVOID lpBuffer, DWORD nNumber
             else
                 FIXME("Conversion not supported yet\n");
         }
-        HeapFree(GetProcessHeap(), 0, ptr);
+        if (ptr != buffer) HeapFree(GetProcessHeap(), 0, ptr);
         if (status != STATUS_SUCCESS)
         {
             SetLastError(RtlNtStatusToDosError(status));
@@ -2505,20 +2506,19 @@ BOOL WINAPI WriteConsoleA(HANDLE hConsoleOutput, LPCVOID lpBuffer, DWORD nNumber
 			  LPDWORD lpNumberOfCharsWritten, LPVOID lpReserved)
 {
     BOOL	ret;
-    LPWSTR	xstring;
-    DWORD 	n;
-
-    n = MultiByteToWideChar(GetConsoleOutputCP(), 0, lpBuffer, nNumberOfCharsToWrite, NULL, 0);
+    WCHAR	buffer[256];
+    LPWSTR	xstring = buffer;
+    INT 	n = 0;
 
     if (lpNumberOfCharsWritten) *lpNumberOfCharsWritten = 0;
-    xstring = HeapAlloc(GetProcessHeap(), 0, n * sizeof(WCHAR));
-    if (!xstring) return FALSE;
-
-    MultiByteToWideChar(GetConsoleOutputCP(), 0, lpBuffer, nNumberOfCharsToWrite, xstring, n);
+    if (nNumberOfCharsToWrite &&
+        !(xstring = LOCALE_MultiByteToWideChar(GetConsoleOutputCP(), 0, lpBuffer, nNumberOfCharsToWrite,
+                                               buffer, sizeof(buffer)/sizeof(WCHAR), &n)))
+        return FALSE;
 
     ret = WriteConsoleW(hConsoleOutput, xstring, n, lpNumberOfCharsWritten, 0);
 
-    HeapFree(GetProcessHeap(), 0, xstring);
+    if (xstring != buffer) HeapFree(GetProcessHeap(), 0, xstring);
 
     return ret;
 }
@@ -115,12 +115,24 @@ static HANDLE create_file_OF( LPCSTR path, INT mode )
 }
 
 
+/***********************************************************************
+ *              get_find_info_class
+ *
+ * Get the directory information class for a FindFirstFileEx info level.
+ * The basic level doesn't return short names, so don't make ntdll generate them.
+ */
+static inline FILE_INFORMATION_CLASS get_find_info_class( FINDEX_INFO_LEVELS level )
+{
+    return level == FindExInfoBasic ? FileFullDirectoryInformation : FileBothDirectoryInformation;
+}
+
+
 /***********************************************************************
  *              check_dir_symlink
  *
  * Check if a dir symlink should be returned by FindNextFile.
  */
-static BOOL check_dir_symlink( FIND_FIRST_INFO *info, const FILE_BOTH_DIR_INFORMATION *file_info )
+static BOOL check_dir_symlink( FIND_FIRST_INFO *info, const WCHAR *file_name, ULONG file_name_len )
 {
     UNICODE_STRING str;
     ANSI_STRING unix_name;
@@ -128,13 +140,13 @@ static BOOL check_dir_symlink( FIND_FIRST_INFO *info, const FILE_BOTH_DIR_INFORM
     BOOL ret = TRUE;
     DWORD len;
 
-    str.MaximumLength = info->path.Length + sizeof(WCHAR) + file_info->FileNameLength;
+    str.MaximumLength = info->path.Length + sizeof(WCHAR) + file_name_len;
     if (!(str.Buffer = HeapAlloc( GetProcessHeap(), 0, str.MaximumLength ))) return TRUE;
     memcpy( str.Buffer, info->path.Buffer, info->path.Length );
     len = info->path.Length / sizeof(WCHAR);
     if (!len || str.Buffer[len-1] != '\\') str.Buffer[len++] = '\\';
-    memcpy( str.Buffer + len, file_info->FileName, file_info->FileNameLength );
-    str.Length = len * sizeof(WCHAR) + file_info->FileNameLength;
+    memcpy( str.Buffer + len, file_name, file_name_len );
+    str.Length = len * sizeof(WCHAR) + file_name_len;
 
     unix_name.Buffer = NULL;
     if (!wine_nt_to_unix_file_name( &str, &unix_name, OPEN_EXISTING, FALSE ) &&
@@ -2084,7 +2096,7 @@ HANDLE WINAPI FindFirstFileExW( LPCWSTR filename, FINDEX_INFO_LEVELS level,
 
         RtlInitUnicodeString( &mask_str, mask );
         status = NtQueryDirectoryFile( info->handle, 0, NULL, NULL, &io, info->data, info->data_size,
-                                       FileBothDirectoryInformation, FALSE, &mask_str, TRUE );
+                                       get_find_info_class( level ), FALSE, &mask_str, TRUE );
         if (status)
         {
             FindClose( info );
@@ -2130,6 +2142,7 @@ BOOL WINAPI FindNextFileW( HANDLE handle, WIN32_FIND_DATAW *data )
 {
     FIND_FIRST_INFO *info;
     FILE_BOTH_DIR_INFORMATION *dir_info;
+    const WCHAR *file_name;
     BOOL ret = FALSE;
     NTSTATUS status;
 
@@ -2158,7 +2171,7 @@ BOOL WINAPI FindNextFileW( HANDLE handle, WIN32_FIND_DATAW *data )
 
             if (info->data_size)
                 status = NtQueryDirectoryFile( info->handle, 0, NULL, NULL, &io, info->data, info->data_size,
-                                               FileBothDirectoryInformation, FALSE, NULL, FALSE );
+                                               get_find_info_class( info->level ), FALSE, NULL, FALSE );
             else
                 status = STATUS_NO_MORE_FILES;
 
@@ -2176,7 +2189,10 @@ BOOL WINAPI FindNextFileW( HANDLE handle, WIN32_FIND_DATAW *data )
             info->data_pos = 0;
         }
 
+        /* FILE_FULL_DIR_INFORMATION shares the layout up to EaSize, but has no short name */
         dir_info = (FILE_BOTH_DIR_INFORMATION *)(info->data + info->data_pos);
+        if (info->level != FindExInfoBasic) file_name = dir_info->FileName;
+        else file_name = ((FILE_FULL_DIR_INFORMATION *)dir_info)->FileName;
 
         if (dir_info->NextEntryOffset) info->data_pos += dir_info->NextEntryOffset;
         else info->data_pos = info->data_len;
@@ -2184,9 +2200,9 @@ BOOL WINAPI FindNextFileW( HANDLE handle, WIN32_FIND_DATAW *data )
         /* don't return '.' and '..' in the root of the drive */
         if (info->is_root)
         {
-            if (dir_info->FileNameLength == sizeof(WCHAR) && dir_info->FileName[0] == '.') continue;
+            if (dir_info->FileNameLength == sizeof(WCHAR) && file_name[0] == '.') continue;
             if (dir_info->FileNameLength == 2 * sizeof(WCHAR) &&
-                dir_info->FileName[0] == '.' && dir_info->FileName[1] == '.') continue;
+                file_name[0] == '.' && file_name[1] == '.') continue;
         }
 
         /* check for dir symlink */
@@ -2194,7 +2210,7 @@ BOOL WINAPI FindNextFileW( HANDLE handle, WIN32_FIND_DATAW *data )
             (dir_info->FileAttributes & FILE_ATTRIBUTE_REPARSE_POINT) &&
             info->wildcard)
         {
-            if (!check_dir_symlink( info, dir_info )) continue;
+            if (!check_dir_symlink( info, file_name, dir_info->FileNameLength )) continue;
         }
 
         data->dwFileAttributes = dir_info->FileAttributes;
@@ -2206,7 +2222,7 @@ BOOL WINAPI FindNextFileW( HANDLE handle, WIN32_FIND_DATAW *data )
         data->dwReserved0      = 0;
         data->dwReserved1      = 0;
 
-        memcpy( data->cFileName, dir_info->FileName, dir_info->FileNameLength );
+        memcpy( data->cFileName, file_name, dir_info->FileNameLength );
         data->cFileName[dir_info->FileNameLength/sizeof(WCHAR)] = 0;
 
         if (info->level != FindExInfoBasic)
@@ -104,8 +104,12 @@ extern void ENV_CopyStartupInformation(void) DECLSPEC_HIDDEN;
 extern void COMPUTERNAME_Init(void) DECLSPEC_HIDDEN;
 
 /* locale.c */
-extern void LOCALE_Init(void) DECLSPEC_HIDDEN;
+extern BOOL LOCALE_Init(void) DECLSPEC_HIDDEN;
 extern void LOCALE_InitRegistry(void) DECLSPEC_HIDDEN;
+extern WCHAR *LOCALE_MultiByteToWideChar( UINT page, DWORD flags, LPCSTR src, INT srclen,
+                                          WCHAR *buffer, INT size, INT *len ) DECLSPEC_HIDDEN;
+extern char *LOCALE_WideCharToMultiByte( UINT page, DWORD flags, LPCWSTR src, INT srclen,
+                                         char *buffer, INT size, INT *len ) DECLSPEC_HIDDEN;
 
 /* time.c */
 extern void TIMEZONE_InitRegistry(void) DECLSPEC_HIDDEN;
@@ -25,6 +25,7 @@
 #include "wine/port.h"
 
 #include <assert.h>
+#include <limits.h>
 #include <locale.h>
 #include <string.h>
 #include <stdarg.h>
@@ -2415,6 +2416,125 @@ INT WINAPI WideCharToMultiByte( UINT page, DWORD flags, LPCWSTR src, INT srclen,
 }
 
 
+/***********************************************************************
+ *           get_max_mb_len
+ *
+ * Upper bound of the size of srclen chars converted to a code page,
+ * or -1 if it doesn't fit in an INT.
+ */
+static INT get_max_mb_len( UINT page, INT srclen )
+{
+    const union cptable *table;
+    INT mult;
+
+    switch(page)
+    {
+    case CP_SYMBOL:
+        mult = 1;
+        break;
+    case CP_UTF7:
+        mult = 5;  /* a lone char takes a whole "+xxx-" sequence */
+        break;
+    case CP_UNIXCP:
+        if (unix_cptable)
+        {
+            mult = unix_cptable->info.char_size;
+            break;
+        }
+        /* fall through */
+    case CP_UTF8:
+        mult = 3;
+        break;
+    default:
+        mult = (table = get_codepage_table( page )) ? table->info.char_size : 1;
+        break;
+    }
+    return srclen <= INT_MAX / mult ? srclen * mult : -1;
+}
+
+
+/***********************************************************************
+ *           LOCALE_MultiByteToWideChar
+ *
+ * Same as MultiByteToWideChar, but without a separate pass to compute the
+ * length. The result goes to buffer if it is sure to fit in size chars,
+ * else to a heap block that the caller frees with HeapFree.
+ *
+ * RETURNS
+ *   Success: The converted string, with its length in len.
+ *   Failure: NULL. Use GetLastError() to determine the cause.
+ */
+WCHAR *LOCALE_MultiByteToWideChar( UINT page, DWORD flags, LPCSTR src, INT srclen,
+                                   WCHAR *buffer, INT size, INT *len )
+{
+    WCHAR *dst = buffer;
+    INT max;
+
+    if (src && srclen < 0) srclen = strlen(src) + 1;
+
+    /* a byte gives at most one char, unless it gets decomposed */
+    max = srclen;
+#ifdef __APPLE__
+    if (page == CP_UNIXCP && !unix_cptable) flags |= MB_COMPOSITE;
+#endif
+    if ((flags & MB_COMPOSITE) || max <= 0)
+    {
+        if (!(max = MultiByteToWideChar( page, flags, src, srclen, NULL, 0 ))) return NULL;
+    }
+
+    if (max > size && !(dst = HeapAlloc( GetProcessHeap(), 0, max * sizeof(WCHAR) )))
+    {
+        SetLastError( ERROR_NOT_ENOUGH_MEMORY );
+        return NULL;
+    }
+    if (!(*len = MultiByteToWideChar( page, flags, src, srclen, dst, max )))
+    {
+        if (dst != buffer) HeapFree( GetProcessHeap(), 0, dst );
+        return NULL;
+    }
+    return dst;
+}
+
+
+/***********************************************************************
+ *           LOCALE_WideCharToMultiByte
+ *
+ * Same as WideCharToMultiByte without default char, but without a separate
+ * pass to compute the length. The result goes to buffer if it is sure to
+ * fit in size bytes, else to a heap block that the caller frees with
+ * HeapFree.
+ *
+ * RETURNS
+ *   Success: The converted string, with its length in len.
+ *   Failure: NULL. Use GetLastError() to determine the cause.
+ */
+char *LOCALE_WideCharToMultiByte( UINT page, DWORD flags, LPCWSTR src, INT srclen,
+                                  char *buffer, INT size, INT *len )
+{
+    char *dst = buffer;
+    INT max;
+
+    if (src && srclen < 0) srclen = strlenW(src) + 1;
+
+    if ((max = get_max_mb_len( page, srclen )) <= 0)
+    {
+        if (!(max = WideCharToMultiByte( page, flags, src, srclen, NULL, 0, NULL, NULL ))) return NULL;
+    }
+
+    if (max > size && !(dst = HeapAlloc( GetProcessHeap(), 0, max )))
+    {
+        SetLastError( ERROR_NOT_ENOUGH_MEMORY );
+        return NULL;
+    }
+    if (!(*len = WideCharToMultiByte( page, flags, src, srclen, dst, max, NULL, NULL )))
+    {
+        if (dst != buffer) HeapFree( GetProcessHeap(), 0, dst );
+        return NULL;
+    }
+    return dst;
+}
+
+
 /***********************************************************************
  *           GetThreadLocale    (KERNEL32.@)
  *
@@ -3377,7 +3497,7 @@ INT WINAPI LCMapStringW(LCID lcid, DWORD flags, LPCWSTR src, INT srclen,
 INT WINAPI LCMapStringA(LCID lcid, DWORD flags, LPCSTR src, INT srclen,
                         LPSTR dst, INT dstlen)
 {
-    WCHAR *bufW = NtCurrentTeb()->StaticUnicodeBuffer;
+    WCHAR bufW[260];
     LPWSTR srcW, dstW;
     INT ret = 0, srclenW, dstlenW;
     UINT locale_cp = CP_ACP;
@@ -3390,20 +3510,8 @@ INT WINAPI LCMapStringA(LCID lcid, DWORD flags, LPCSTR src, INT srclen,
 
     if (!(flags & LOCALE_USE_CP_ACP)) locale_cp = get_lcid_codepage( lcid );
 
-    srclenW = MultiByteToWideChar(locale_cp, 0, src, srclen, bufW, 260);
-    if (srclenW)
-        srcW = bufW;
-    else
-    {
-        srclenW = MultiByteToWideChar(locale_cp, 0, src, srclen, NULL, 0);
-        srcW = HeapAlloc(GetProcessHeap(), 0, srclenW * sizeof(WCHAR));
-        if (!srcW)
-        {
-            SetLastError(ERROR_NOT_ENOUGH_MEMORY);
-            return 0;
-        }
-        MultiByteToWideChar(locale_cp, 0, src, srclen, srcW, srclenW);
-    }
+    if (!(srcW = LOCALE_MultiByteToWideChar(locale_cp, 0, src, srclen, bufW, sizeof(bufW)/sizeof(WCHAR), &srclenW)))
+        return 0;
 
     if (flags & LCMAP_SORTKEY)
     {
@@ -3563,11 +3671,8 @@ INT WINAPI CompareStringW(LCID lcid, DWORD flags,
     return CompareStringEx(NULL, flags, str1, len1, str2, len2, NULL, NULL, 0);
 }
 
-/******************************************************************************
- *           CompareStringEx    (KERNEL32.@)
- */
-INT WINAPI CompareStringEx(LPCWSTR locale, DWORD flags, LPCWSTR str1, INT len1,
-                           LPCWSTR str2, INT len2, LPNLSVERSIONINFO version, LPVOID reserved, LPARAM lParam)
+/* compare two strings of known length, either of which may be NULL if empty */
+static INT compare_string(DWORD flags, LPCWSTR str1, INT len1, LPCWSTR str2, INT len2)
 {
     DWORD supported_flags = NORM_IGNORECASE|NORM_IGNORENONSPACE|NORM_IGNORESYMBOLS|SORT_STRINGSORT
                            |NORM_IGNOREKANATYPE|NORM_IGNOREWIDTH|LOCALE_USE_CP_ACP;
@@ -3576,16 +3681,6 @@ INT WINAPI CompareStringEx(LPCWSTR locale, DWORD flags, LPCWSTR str1, INT len1,
     INT ret;
     static int once;
 
-    if (version) FIXME("unexpected version parameter\n");
-    if (reserved) FIXME("unexpected reserved value\n");
-    if (lParam) FIXME("unexpected lParam\n");
-
-    if (!str1 || !str2)
-    {
-        SetLastError(ERROR_INVALID_PARAMETER);
-        return 0;
-    }
-
     if (flags & ~(supported_flags|semistub_flags))
     {
         SetLastError(ERROR_INVALID_FLAGS);
@@ -3598,9 +3693,6 @@ INT WINAPI CompareStringEx(LPCWSTR locale, DWORD flags, LPCWSTR str1, INT len1,
             FIXME("semi-stub behavior for flag(s) 0x%x\n", flags & semistub_flags);
     }
 
-    if (len1 < 0) len1 = strlenW(str1);
-    if (len2 < 0) len2 = strlenW(str2);
-
     ret = wine_compare_string(flags, str1, len1, str2, len2);
 
     if (ret) /* need to translate result */
@@ -3608,6 +3700,28 @@ INT WINAPI CompareStringEx(LPCWSTR locale, DWORD flags, LPCWSTR str1, INT len1,
     return CSTR_EQUAL;
 }
 
+/******************************************************************************
+ *           CompareStringEx    (KERNEL32.@)
+ */
+INT WINAPI CompareStringEx(LPCWSTR locale, DWORD flags, LPCWSTR str1, INT len1,
+                           LPCWSTR str2, INT len2, LPNLSVERSIONINFO version, LPVOID reserved, LPARAM lParam)
+{
+    if (version) FIXME("unexpected version parameter\n");
+    if (reserved) FIXME("unexpected reserved value\n");
+    if (lParam) FIXME("unexpected lParam\n");
+
+    if (!str1 || !str2)
+    {
+        SetLastError(ERROR_INVALID_PARAMETER);
+        return 0;
+    }
+
+    if (len1 < 0) len1 = strlenW(str1);
+    if (len2 < 0) len2 = strlenW(str2);
+
+    return compare_string(flags, str1, len1, str2, len2);
+}
+
 /******************************************************************************
  *           CompareStringA    (KERNEL32.@)
  *
@@ -3629,8 +3743,7 @@ INT WINAPI CompareStringEx(LPCWSTR locale, DWORD flags, LPCWSTR str1, INT len1,
 INT WINAPI CompareStringA(LCID lcid, DWORD flags,
                           LPCSTR str1, INT len1, LPCSTR str2, INT len2)
 {
-    WCHAR *buf1W = NtCurrentTeb()->StaticUnicodeBuffer;
-    WCHAR *buf2W = buf1W + 130;
+    WCHAR buf1W[130], buf2W[130];
     LPWSTR str1W, str2W;
     INT len1W = 0, len2W = 0, ret;
     UINT locale_cp = CP_ACP;
@@ -3645,54 +3758,17 @@ INT WINAPI CompareStringA(LCID lcid, DWORD flags,
 
     if (!(flags & LOCALE_USE_CP_ACP)) locale_cp = get_lcid_codepage( lcid );
 
-    if (len1)
-    {
-        if (len1 <= 130) len1W = MultiByteToWideChar(locale_cp, 0, str1, len1, buf1W, 130);
-        if (len1W)
-            str1W = buf1W;
-        else
-        {
-            len1W = MultiByteToWideChar(locale_cp, 0, str1, len1, NULL, 0);
-            str1W = HeapAlloc(GetProcessHeap(), 0, len1W * sizeof(WCHAR));
-            if (!str1W)
-            {
-                SetLastError(ERROR_NOT_ENOUGH_MEMORY);
-                return 0;
-            }
-            MultiByteToWideChar(locale_cp, 0, str1, len1, str1W, len1W);
-        }
-    }
-    else
-    {
-        len1W = 0;
-        str1W = buf1W;
-    }
-
-    if (len2)
-    {
-        if (len2 <= 130) len2W = MultiByteToWideChar(locale_cp, 0, str2, len2, buf2W, 130);
-        if (len2W)
-            str2W = buf2W;
-        else
-        {
-            len2W = MultiByteToWideChar(locale_cp, 0, str2, len2, NULL, 0);
-            str2W = HeapAlloc(GetProcessHeap(), 0, len2W * sizeof(WCHAR));
-            if (!str2W)
-            {
-                if (str1W != buf1W) HeapFree(GetProcessHeap(), 0, str1W);
-                SetLastError(ERROR_NOT_ENOUGH_MEMORY);
-                return 0;
-            }
-            MultiByteToWideChar(locale_cp, 0, str2, len2, str2W, len2W);
-        }
-    }
-    else
+    /* empty strings stay NULL, there is nothing to convert */
+    str1W = str2W = NULL;
+    if (len1 && !(str1W = LOCALE_MultiByteToWideChar(locale_cp, 0, str1, len1, buf1W, sizeof(buf1W)/sizeof(WCHAR), &len1W)))
+        return 0;
+    if (len2 && !(str2W = LOCALE_MultiByteToWideChar(locale_cp, 0, str2, len2, buf2W, sizeof(buf2W)/sizeof(WCHAR), &len2W)))
     {
-        len2W = 0;
-        str2W = buf2W;
+        if (str1W != buf1W) HeapFree(GetProcessHeap(), 0, str1W);
+        return 0;
     }
 
-    ret = CompareStringEx(NULL, flags, str1W, len1W, str2W, len2W, NULL, NULL, 0);
+    ret = compare_string(flags, str1W, len1W, str2W, len2W);
 
     if (str1W != buf1W) HeapFree(GetProcessHeap(), 0, str1W);
     if (str2W != buf2W) HeapFree(GetProcessHeap(), 0, str2W);
@@ -3819,8 +3895,10 @@ int WINAPI lstrcmpiW(LPCWSTR str1, LPCWSTR str2)
 // modified
 /******************************************************************************
  *		LOCALE_Init
+ *
+ * Fails if the code page tables can't be loaded.
  */
-void LOCALE_Init(void)
+BOOL LOCALE_Init(void)
 {
     extern void CDECL __wine_init_codepages( const union cptable *ansi_cp, const union cptable *oem_cp,
                                              const union cptable *unix_cp );
@@ -3865,6 +3943,12 @@ void LOCALE_Init(void)
         if (!(unix_cptable = wine_cp_get_table( unix_cp )))
             unix_cptable  = wine_cp_get_table( 28591 );
     }
+    /* the tables may live in a file that is missing */
+    if (!ansi_cptable || !oem_cptable || !mac_cptable || (unix_cp != CP_UTF8 && !unix_cptable))
+    {
+        ERR( "code page tables not available\n" );
+        return FALSE;
+    }
 
     __wine_init_codepages( ansi_cptable, oem_cptable, unix_cptable );
 
@@ -3873,6 +3957,7 @@ void LOCALE_Init(void)
            mac_cptable->info.codepage, unix_cp );
 
     //setlocale(LC_NUMERIC, "C");  /* FIXME: oleaut32 depends on this */
+    return TRUE;
 }
 
 
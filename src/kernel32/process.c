@@ -1205,7 +1205,7 @@ void CDECL __wine_kernel_init(void)
     kernel32_handle = GetModuleHandleW(kernel32W);
     IsWow64Process( GetCurrentProcess(), &is_wow64 );
 
-    LOCALE_Init();
+    if (!LOCALE_Init()) exit(1);
 
     if (!params->Environment)
     {
@@ -82,7 +82,10 @@ static HANDLE get_BaseNamedObjects_handle(void)
     }
     return handle;
 }
+#endif
 
+/* names are passed to ntdll as they are, it resolves the session and global
+ * namespaces itself since there is no object directory to open here */
 static void get_create_object_attributes( OBJECT_ATTRIBUTES *attr, UNICODE_STRING *nameW,
                                           SECURITY_ATTRIBUTES *sa, const WCHAR *name )
 {
@@ -96,7 +99,6 @@ static void get_create_object_attributes( OBJECT_ATTRIBUTES *attr, UNICODE_STRIN
     {
         RtlInitUnicodeString( nameW, name );
         attr->ObjectName = nameW;
-        attr->RootDirectory = get_BaseNamedObjects_handle();
     }
 }
 
@@ -109,11 +111,9 @@ static BOOL get_open_object_attributes( OBJECT_ATTRIBUTES *attr, UNICODE_STRING
         return FALSE;
     }
     RtlInitUnicodeString( nameW, name );
-    InitializeObjectAttributes( attr, nameW, inherit ? OBJ_INHERIT : 0,
-                                get_BaseNamedObjects_handle(), NULL );
+    InitializeObjectAttributes( attr, nameW, inherit ? OBJ_INHERIT : 0, 0, NULL );
     return TRUE;
 }
-#endif
 
 /* helper for kernel32->ntdll timeout format conversion */
 static inline PLARGE_INTEGER get_nt_timeout( PLARGE_INTEGER pTime, DWORD timeout )
@@ -311,6 +311,8 @@ BOOL WINAPI UnregisterWaitEx( HANDLE WaitHandle, HANDLE CompletionEvent )
     return !status;
 }
 
+#endif
+
 /***********************************************************************
  *           SignalObjectAndWait  (KERNEL32.@)
  *
@@ -336,6 +338,7 @@ DWORD WINAPI SignalObjectAndWait( HANDLE hObjectToSignal, HANDLE hObjectToWaitOn
     return status;
 }
 
+#if 0
 /***********************************************************************
  *           InitializeCriticalSection   (KERNEL32.@)
  *
@@ -446,6 +449,8 @@ void WINAPI UninitializeCriticalSection( CRITICAL_SECTION *crit )
 }
 
 
+#endif
+
 /***********************************************************************
  *           CreateEventA    (KERNEL32.@)
  */
@@ -840,6 +845,7 @@ BOOL WINAPI DECLSPEC_HOTPATCH ReleaseSemaphore( HANDLE handle, LONG count, LONG
     return !status;
 }
 
+#if 0
 
 /*
  * Jobs
@@ -982,6 +988,8 @@ BOOL WINAPI IsProcessInJob( HANDLE process, HANDLE job, PBOOL result )
 }
 
 
+#endif
+
 /*
  * Timers
  */
@@ -1112,13 +1120,27 @@ BOOL WINAPI SetWaitableTimer( HANDLE handle, const LARGE_INTEGER *when, LONG per
 BOOL WINAPI SetWaitableTimerEx( HANDLE handle, const LARGE_INTEGER *when, LONG period,
                               PTIMERAPCROUTINE callback, LPVOID arg, REASON_CONTEXT *context, ULONG tolerabledelay )
 {
-    static int once;
-    if (!once++)
+    TIMER_SET_COALESCABLE_TIMER_INFO info;
+    NTSTATUS status;
+
+    TRACE("(%p, %p, %d, %p, %p, %p, %d)\n",
+          handle, when, period, callback, arg, context, tolerabledelay);
+
+    info.DueTime         = *when;
+    info.TimerApcRoutine = (PTIMER_APC_ROUTINE)callback;
+    info.TimerContext    = arg;
+    info.WakeContext     = context;
+    info.Period          = period;
+    info.TolerableDelay  = tolerabledelay;
+    info.PreviousState   = NULL;
+
+    status = NtSetTimerEx( handle, TimerSetCoalescableTimer, &info, sizeof(info) );
+    if (status != STATUS_SUCCESS)
     {
-        FIXME("(%p, %p, %d, %p, %p, %p, %d) semi-stub\n",
-              handle, when, period, callback, arg, context, tolerabledelay);
+        SetLastError( RtlNtStatusToDosError(status) );
+        return FALSE;
     }
-    return SetWaitableTimer(handle, when, period, callback, arg, FALSE);
+    return TRUE;
 }
 
 /***********************************************************************
@@ -1138,6 +1160,7 @@ BOOL WINAPI CancelWaitableTimer( HANDLE handle )
 }
 
 
+#if 0
 /***********************************************************************
  *           CreateTimerQueue  (KERNEL32.@)
  */
@@ -2602,3 +2625,37 @@ BOOL WINAPI SleepConditionVariableSRW( RTL_CONDITION_VARIABLE *variable, RTL_SRW
 }
 
 #endif
+
+/***********************************************************************
+ *           WaitOnAddress   (KERNEL32.@)
+ */
+BOOL WINAPI WaitOnAddress( volatile void *addr, void *cmp, SIZE_T size, DWORD timeout )
+{
+    NTSTATUS status;
+    LARGE_INTEGER time;
+
+    status = RtlWaitOnAddress( (const void *)addr, cmp, size, get_nt_timeout( &time, timeout ) );
+
+    if (status != STATUS_SUCCESS)
+    {
+        SetLastError( RtlNtStatusToDosError(status) );
+        return FALSE;
+    }
+    return TRUE;
+}
+
+/***********************************************************************
+ *           WakeByAddressAll   (KERNEL32.@)
+ */
+void WINAPI WakeByAddressAll( void *addr )
+{
+    RtlWakeAddressAll( addr );
+}
+
+/***********************************************************************
+ *           WakeByAddressSingle   (KERNEL32.@)
+ */
+void WINAPI WakeByAddressSingle( void *addr )
+{
+    RtlWakeAddressSingle( addr );
+}
@@ -548,6 +548,7 @@ BOOL WINAPI GetThreadSelectorEntry( HANDLE hthread, DWORD sel, LPLDT_ENTRY ldten
     return TRUE;
 }
 
+#endif
 
 /* callback for QueueUserAPC */
 static void CALLBACK call_user_apc( ULONG_PTR arg1, ULONG_PTR arg2, ULONG_PTR arg3 )
@@ -567,6 +568,8 @@ DWORD WINAPI QueueUserAPC( PAPCFUNC func, HANDLE hthread, ULONG_PTR data )
     return !status;
 }
 
+#if 0
+
 /***********************************************************************
  *              QueueUserWorkItem  (KERNEL32.@)
  */
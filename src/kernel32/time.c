@@ -0,0 +1,175 @@
+/*
+ * Win32 kernel time functions
+ *
+ * Copyright 1995 Martin von Loewis and Cameron Heide
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301, USA
+ */
+
+#include "config.h"
+#include "wine/port.h"
+
+#include <stdarg.h>
+#include <time.h>
+
+#define NONAMELESSUNION
+#include "ntstatus.h"
+#define WIN32_NO_STATUS
+#include "windef.h"
+#include "winbase.h"
+#include "winternl.h"
+#include "ddk/wdm.h"
+#include "wine/debug.h"
+
+WINE_DEFAULT_DEBUG_CHANNEL(time);
+
+/* mapped by ntdll, which is built into the same library; NULL if the fixed address was taken */
+extern struct _KUSER_SHARED_DATA *user_shared_data DECLSPEC_HIDDEN;
+
+
+/*********************************************************************
+ *           GetSystemTimeAsFileTime   (KERNEL32.@)
+ *
+ *  Get the current time in utc format.
+ *
+ *  RETURNS
+ *   Nothing.
+ */
+VOID WINAPI GetSystemTimeAsFileTime(
+    LPFILETIME time) /* [out] Destination for the current utc time */
+{
+    LARGE_INTEGER t;
+    NtQuerySystemTime( &t );
+    time->dwLowDateTime = t.u.LowPart;
+    time->dwHighDateTime = t.u.HighPart;
+}
+
+
+/*********************************************************************
+ *           GetSystemTimePreciseAsFileTime   (KERNEL32.@)
+ *
+ *  Get the current time in utc format, with <1 us precision.
+ *
+ *  RETURNS
+ *   Nothing.
+ */
+VOID WINAPI GetSystemTimePreciseAsFileTime(
+    LPFILETIME time) /* [out] Destination for the current utc time */
+{
+    LARGE_INTEGER t;
+    t.QuadPart = RtlGetSystemTimePrecise();
+    time->dwLowDateTime = t.u.LowPart;
+    time->dwHighDateTime = t.u.HighPart;
+}
+
+
+/***********************************************************************
+ *           GetTickCount64       (KERNEL32.@)
+ *
+ * Read from the shared user data, which ntdll keeps current. Without it,
+ * the tick count only has to be as precise as the scheduler tick, so it
+ * uses the coarse clock, which doesn't even need to read the TSC.
+ */
+ULONGLONG WINAPI DECLSPEC_HOTPATCH GetTickCount64(void)
+{
+    LARGE_INTEGER counter, frequency;
+    ULONG high, low;
+#if defined(HAVE_CLOCK_GETTIME) && defined(CLOCK_MONOTONIC_COARSE)
+    struct timespec ts;
+#endif
+
+    if (!user_shared_data)
+    {
+#if defined(HAVE_CLOCK_GETTIME) && defined(CLOCK_MONOTONIC_COARSE)
+        if (!clock_gettime( CLOCK_MONOTONIC_COARSE, &ts ))
+            return ts.tv_sec * (ULONGLONG)1000 + ts.tv_nsec / 1000000;
+#endif
+        NtQueryPerformanceCounter( &counter, &frequency );
+        /* counter * 1000 overflows after about a month at a GHz TSC frequency */
+        return counter.QuadPart / frequency.QuadPart * 1000 +
+               counter.QuadPart % frequency.QuadPart * 1000 / frequency.QuadPart;
+    }
+
+    do
+    {
+        high = user_shared_data->u.TickCount.High1Time;
+        low = user_shared_data->u.TickCount.LowPart;
+    }
+    while (high != user_shared_data->u.TickCount.High2Time);
+    /* note: we ignore TickCountMultiplier */
+    return (ULONGLONG)high << 32 | low;
+}
+
+
+/***********************************************************************
+ *           GetTickCount       (KERNEL32.@)
+ *
+ * Get the number of milliseconds the system has been running.
+ *
+ * PARAMS
+ *  None.
+ *
+ * RETURNS
+ *  The current tick count.
+ *
+ * NOTES
+ *  The value returned will wrap around every 2^32 milliseconds.
+ */
+DWORD WINAPI DECLSPEC_HOTPATCH GetTickCount(void)
+{
+    return GetTickCount64();
+}
+
+
+/****************************************************************************
+ *		QueryPerformanceCounter (KERNEL32.@)
+ *
+ * Get the current value of the performance counter.
+ *
+ * PARAMS
+ *  counter [O] Destination for the current counter reading
+ *
+ * RETURNS
+ *  Success: TRUE. counter contains the current reading
+ *  Failure: FALSE.
+ *
+ * SEE ALSO
+ *  See QueryPerformanceFrequency.
+ */
+BOOL WINAPI QueryPerformanceCounter(PLARGE_INTEGER counter)
+{
+    return RtlQueryPerformanceCounter( counter );
+}
+
+
+/****************************************************************************
+ *		QueryPerformanceFrequency (KERNEL32.@)
+ *
+ * Get the resolution of the performance counter.
+ *
+ * PARAMS
+ *  frequency [O] Destination for the counter resolution
+ *
+ * RETURNS
+ *  Success. TRUE. Frequency contains the resolution of the counter.
+ *  Failure: FALSE.
+ *
+ * SEE ALSO
+ *  See QueryPerformanceCounter.
+ */
+BOOL WINAPI QueryPerformanceFrequency(PLARGE_INTEGER frequency)
+{
+    return RtlQueryPerformanceFrequency( frequency );
+}
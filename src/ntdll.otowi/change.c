@@ -0,0 +1,740 @@
+/*
+ * Directory change notification
+ *
+ * Replacement for the server side change tracking (server/change.c),
+ * built on a single inotify instance shared by all directory handles.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301, USA
+ */
+
+#include "config.h"
+#include "wine/port.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <pthread.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#ifdef HAVE_DIRENT_H
+# include <dirent.h>
+#endif
+#ifdef HAVE_SYS_STAT_H
+# include <sys/stat.h>
+#endif
+#ifdef HAVE_SYS_INOTIFY_H
+# include <sys/inotify.h>
+#endif
+#ifdef HAVE_UNISTD_H
+# include <unistd.h>
+#endif
+
+#include "ntstatus.h"
+#define WIN32_NO_STATUS
+#define NONAMELESSUNION
+#include "windef.h"
+#include "winnt.h"
+#include "winternl.h"
+#include "wine/list.h"
+#include "wine/debug.h"
+#include "ntdll_misc.h"
+
+WINE_DEFAULT_DEBUG_CHANNEL(file);
+
+#ifdef HAVE_SYS_INOTIFY_H
+
+#define CHANGE_RING_SIZE  256  /* max queued changes per directory handle */
+#define CHANGE_HASH_SIZE  64   /* buckets of the watch descriptor hash */
+
+/* a queued change, waiting to be read by the client */
+struct change_record
+{
+    ULONG  action;   /* FILE_ACTION_* */
+    char  *name;     /* Unix path relative to the watched directory */
+};
+
+/* a read request waiting for changes */
+struct change_request
+{
+    void              *buffer;    /* client buffer for FILE_NOTIFY_INFORMATION records */
+    ULONG              size;      /* size of the client buffer */
+    IO_STATUS_BLOCK   *iosb;      /* status block to fill on completion */
+    change_callback_t  callback;  /* completion callback */
+    void              *user;      /* callback argument */
+    struct list        entry;     /* entry in the list of requests to complete */
+};
+
+/* change tracking state of a directory handle */
+struct change_watch
+{
+    struct list            entry;    /* entry in the watches list */
+    HANDLE                 handle;   /* directory handle */
+    char                  *root;     /* Unix path of the directory */
+    ULONG                  filter;   /* FILE_NOTIFY_CHANGE_* filter */
+    BOOLEAN                subtree;  /* also watch subdirectories */
+    struct list            dirs;     /* watched directories */
+    struct change_record   ring[CHANGE_RING_SIZE];  /* queued changes */
+    unsigned int           head;     /* index of the oldest queued change */
+    unsigned int           count;    /* number of queued changes */
+    BOOL                   overflow; /* changes were lost, the client has to rescan */
+    struct change_request *request;  /* pending read request */
+};
+
+/* a directory watched through inotify on behalf of a change watch */
+struct change_dir
+{
+    struct list          entry;     /* entry in the watch dirs list */
+    struct list          wd_entry;  /* entry in the watch descriptor hash */
+    struct change_watch *watch;     /* watch this directory belongs to */
+    int                  wd;        /* inotify watch descriptor */
+    char                 path[1];   /* path relative to the watch root, empty for the root itself */
+};
+
+/* the notification thread has no TEB, so this can't be a critical section */
+static pthread_mutex_t change_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+static int inotify_fd = -1;
+static struct list watches = LIST_INIT( watches );
+static struct list wd_hash[CHANGE_HASH_SIZE];
+
+static void *change_thread( void *arg );
+
+/* FILE_NOTIFY_CHANGE_* filter bits matching an inotify event */
+static ULONG filter_from_event( const struct inotify_event *ie )
+{
+    ULONG filter = 0;
+
+    if (ie->mask & (IN_MOVED_FROM | IN_MOVED_TO | IN_DELETE | IN_CREATE))
+        filter |= FILE_NOTIFY_CHANGE_FILE_NAME | FILE_NOTIFY_CHANGE_DIR_NAME;
+    if (ie->mask & IN_MODIFY)
+        filter |= FILE_NOTIFY_CHANGE_SIZE | FILE_NOTIFY_CHANGE_LAST_WRITE;
+    if (ie->mask & IN_ATTRIB)
+        filter |= FILE_NOTIFY_CHANGE_ATTRIBUTES | FILE_NOTIFY_CHANGE_SECURITY;
+    if (ie->mask & IN_ACCESS)
+        filter |= FILE_NOTIFY_CHANGE_LAST_ACCESS;
+    if (ie->mask & IN_CREATE)
+        filter |= FILE_NOTIFY_CHANGE_CREATION;
+
+    if (ie->mask & IN_ISDIR) filter &= ~FILE_NOTIFY_CHANGE_FILE_NAME;
+    else filter &= ~FILE_NOTIFY_CHANGE_DIR_NAME;
+    return filter;
+}
+
+/* inotify mask needed to track the changes of a filter */
+static unsigned int filter_to_mask( ULONG filter, BOOLEAN subtree )
+{
+    unsigned int mask = IN_ONLYDIR | IN_MASK_ADD;
+
+    if (filter & (FILE_NOTIFY_CHANGE_FILE_NAME | FILE_NOTIFY_CHANGE_DIR_NAME | FILE_NOTIFY_CHANGE_CREATION))
+        mask |= IN_MOVED_FROM | IN_MOVED_TO | IN_DELETE | IN_CREATE;
+    if (filter & (FILE_NOTIFY_CHANGE_SIZE | FILE_NOTIFY_CHANGE_LAST_WRITE))
+        mask |= IN_MODIFY;
+    if (filter & (FILE_NOTIFY_CHANGE_ATTRIBUTES | FILE_NOTIFY_CHANGE_SECURITY))
+        mask |= IN_ATTRIB;
+    if (filter & FILE_NOTIFY_CHANGE_LAST_ACCESS)
+        mask |= IN_ACCESS;
+    /* subdirectories have to be followed to keep the watch tree up to date */
+    if (subtree) mask |= IN_MOVED_FROM | IN_MOVED_TO | IN_CREATE;
+    return mask;
+}
+
+static inline struct list *get_wd_bucket( int wd )
+{
+    return &wd_hash[(unsigned int)wd % CHANGE_HASH_SIZE];
+}
+
+/* create the shared inotify instance and its thread; change_mutex must be held */
+static BOOL init_inotify(void)
+{
+    pthread_attr_t attr;
+    pthread_t thread;
+    unsigned int i;
+    int ret;
+
+    if (inotify_fd != -1) return TRUE;
+
+    if ((inotify_fd = inotify_init1( IN_CLOEXEC )) == -1)
+    {
+        WARN( "inotify not available: %s\n", strerror(errno) );
+        return FALSE;
+    }
+    for (i = 0; i < CHANGE_HASH_SIZE; i++) list_init( &wd_hash[i] );
+
+    pthread_attr_init( &attr );
+    pthread_attr_setdetachstate( &attr, PTHREAD_CREATE_DETACHED );
+    ret = pthread_create( &thread, &attr, change_thread, NULL );
+    pthread_attr_destroy( &attr );
+    if (ret)
+    {
+        close( inotify_fd );
+        inotify_fd = -1;
+        return FALSE;
+    }
+    return TRUE;
+}
+
+/* build a path relative to the watch root */
+static char *make_relative_path( const char *dir, const char *name )
+{
+    size_t dir_len = strlen( dir ), name_len = strlen( name );
+    char *path;
+
+    if (!(path = RtlAllocateHeap( GetProcessHeap(), 0, dir_len + name_len + 2 ))) return NULL;
+    memcpy( path, dir, dir_len );
+    if (dir_len) path[dir_len++] = '/';
+    memcpy( path + dir_len, name, name_len + 1 );
+    return path;
+}
+
+/* start watching a directory of the watch tree */
+static struct change_dir *add_change_dir( struct change_watch *watch, const char *path )
+{
+    struct change_dir *dir;
+    char *unix_name;
+    int wd;
+
+    if (!(unix_name = make_relative_path( watch->root, path ))) return NULL;
+    wd = inotify_add_watch( inotify_fd, unix_name, filter_to_mask( watch->filter, watch->subtree ));
+    RtlFreeHeap( GetProcessHeap(), 0, unix_name );
+    if (wd == -1)
+    {
+        TRACE( "failed to watch %s/%s: %s\n", watch->root, path, strerror(errno) );
+        return NULL;
+    }
+
+    if (!(dir = RtlAllocateHeap( GetProcessHeap(), 0, offsetof( struct change_dir, path[strlen( path ) + 1] ))))
+        return NULL;
+    dir->watch = watch;
+    dir->wd    = wd;
+    strcpy( dir->path, path );
+    list_add_tail( &watch->dirs, &dir->entry );
+    list_add_tail( get_wd_bucket( wd ), &dir->wd_entry );
+    return dir;
+}
+
+/* stop watching a directory, removing the inotify watch when nobody uses it anymore */
+static void remove_change_dir( struct change_dir *dir, BOOL kernel_removed )
+{
+    struct list *bucket = get_wd_bucket( dir->wd );
+    struct change_dir *other;
+    int wd = dir->wd;
+
+    list_remove( &dir->entry );
+    list_remove( &dir->wd_entry );
+    RtlFreeHeap( GetProcessHeap(), 0, dir );
+
+    if (kernel_removed) return;
+    LIST_FOR_EACH_ENTRY( other, bucket, struct change_dir, wd_entry )
+        if (other->wd == wd) return;
+    inotify_rm_watch( inotify_fd, wd );
+}
+
+/* recursively watch the subdirectories of a watched directory */
+static void add_change_subdirs( struct change_watch *watch, const char *path )
+{
+    struct dirent *de;
+    struct stat st;
+    char *unix_name, *subdir;
+    DIR *dir;
+
+    if (!(unix_name = make_relative_path( watch->root, path ))) return;
+    dir = opendir( unix_name );
+    RtlFreeHeap( GetProcessHeap(), 0, unix_name );
+    if (!dir) return;
+
+    while ((de = readdir( dir )))
+    {
+        if (!strcmp( de->d_name, "." ) || !strcmp( de->d_name, ".." )) continue;
+#ifdef DT_DIR
+        if (de->d_type != DT_DIR && de->d_type != DT_UNKNOWN) continue;
+#endif
+        if (fstatat( dirfd( dir ), de->d_name, &st, AT_SYMLINK_NOFOLLOW ) == -1 || !S_ISDIR( st.st_mode ))
+            continue;
+        if (!(subdir = make_relative_path( path, de->d_name ))) break;
+        if (add_change_dir( watch, subdir )) add_change_subdirs( watch, subdir );
+        RtlFreeHeap( GetProcessHeap(), 0, subdir );
+    }
+    closedir( dir );
+}
+
+/* stop watching a subdirectory and everything below it */
+static void remove_change_subdirs( struct change_watch *watch, const char *path )
+{
+    struct change_dir *dir, *next;
+    size_t len = strlen( path );
+
+    LIST_FOR_EACH_ENTRY_SAFE( dir, next, &watch->dirs, struct change_dir, entry )
+    {
+        if (strncmp( dir->path, path, len ) || (dir->path[len] && dir->path[len] != '/')) continue;
+        /* removing a dir may only free the entry itself, so the next pointer stays valid */
+        remove_change_dir( dir, FALSE );
+    }
+}
+
+static void free_change_records( struct change_watch *watch )
+{
+    while (watch->count)
+    {
+        RtlFreeHeap( GetProcessHeap(), 0, watch->ring[watch->head].name );
+        watch->head = (watch->head + 1) % CHANGE_RING_SIZE;
+        watch->count--;
+    }
+    watch->head = 0;
+}
+
+/* queue a change record, coalescing it with an identical pending modification */
+static void queue_change( struct change_watch *watch, ULONG action, const char *dir, const char *name )
+{
+    struct change_record *record;
+    unsigned int i;
+    char *path;
+
+    if (watch->overflow) return;
+    if (!(path = make_relative_path( dir, name )))
+    {
+        watch->overflow = TRUE;
+        return;
+    }
+
+    /* a file modified several times before the client reads the changes is only reported once,
+     * as long as no other change for that file has been queued in between */
+    for (i = watch->count; i > 0; i--)
+    {
+        record = &watch->ring[(watch->head + i - 1) % CHANGE_RING_SIZE];
+        if (strcmp( record->name, path )) continue;
+        if (record->action == FILE_ACTION_MODIFIED && action == FILE_ACTION_MODIFIED)
+        {
+            RtlFreeHeap( GetProcessHeap(), 0, path );
+            return;
+        }
+        break;
+    }
+
+    if (watch->count == CHANGE_RING_SIZE)
+    {
+        TRACE( "change queue overflow for %p\n", watch->handle );
+        RtlFreeHeap( GetProcessHeap(), 0, path );
+        free_change_records( watch );
+        watch->overflow = TRUE;
+        return;
+    }
+
+    record = &watch->ring[(watch->head + watch->count) % CHANGE_RING_SIZE];
+    record->action = action;
+    record->name   = path;
+    watch->count++;
+}
+
+/* store the queued changes into the client buffer as FILE_NOTIFY_INFORMATION records */
+static NTSTATUS fill_change_buffer( struct change_watch *watch, void *buffer, ULONG size, ULONG *ret_size )
+{
+    FILE_NOTIFY_INFORMATION *info, *last = NULL;
+    ULONG pos = 0, end = 0;
+    int i, len, avail;
+
+    *ret_size = 0;
+    if (watch->overflow || !buffer)
+    {
+        free_change_records( watch );
+        watch->overflow = FALSE;
+        return STATUS_NOTIFY_ENUM_DIR;
+    }
+
+    while (watch->count)
+    {
+        struct change_record *record = &watch->ring[watch->head];
+
+        if (pos + offsetof( FILE_NOTIFY_INFORMATION, FileName[1] ) > size) break;
+        info = (FILE_NOTIFY_INFORMATION *)((char *)buffer + pos);
+        avail = (size - pos - offsetof( FILE_NOTIFY_INFORMATION, FileName )) / sizeof(WCHAR);
+        len = ntdll_umbstowcs( 0, record->name, strlen( record->name ), info->FileName, avail );
+        if (len <= 0) break;
+
+        /* convert to an NT style path */
+        for (i = 0; i < len; i++) if (info->FileName[i] == '/') info->FileName[i] = '\\';
+        info->Action          = record->action;
+        info->FileNameLength  = len * sizeof(WCHAR);
+        info->NextEntryOffset = 0;
+        if (last) last->NextEntryOffset = (char *)info - (char *)last;
+        last = info;
+
+        end = pos + offsetof( FILE_NOTIFY_INFORMATION, FileName[len] );
+        pos = (end + 3) & ~3;
+
+        RtlFreeHeap( GetProcessHeap(), 0, record->name );
+        watch->head = (watch->head + 1) % CHANGE_RING_SIZE;
+        watch->count--;
+    }
+
+    if (!last)
+    {
+        /* not even a single record fits, the client has to rescan */
+        free_change_records( watch );
+        return STATUS_NOTIFY_ENUM_DIR;
+    }
+    *ret_size = end;
+    return STATUS_SUCCESS;
+}
+
+/* complete the pending request of a watch if changes are available; change_mutex must be held */
+static struct change_request *complete_change_request( struct change_watch *watch )
+{
+    struct change_request *request = watch->request;
+    ULONG size;
+
+    if (!request || (!watch->count && !watch->overflow)) return NULL;
+
+    watch->request = NULL;
+    request->iosb->u.Status = fill_change_buffer( watch, request->buffer, request->size, &size );
+    request->iosb->Information = size;
+    return request;
+}
+
+/* notify the owners of completed requests; must be called without holding change_mutex */
+static void notify_change_requests( struct list *completed )
+{
+    struct change_request *request, *next;
+
+    LIST_FOR_EACH_ENTRY_SAFE( request, next, completed, struct change_request, entry )
+    {
+        list_remove( &request->entry );
+        request->callback( request->user, request->iosb );
+        RtlFreeHeap( GetProcessHeap(), 0, request );
+    }
+}
+
+static void queue_completed_request( struct change_request *request, struct list *completed )
+{
+    if (request) list_add_tail( completed, &request->entry );
+}
+
+/* action reported for an inotify event, renames are paired by cookie with the adjacent event */
+static ULONG get_change_action( const struct inotify_event *ie, const struct inotify_event *prev,
+                                const struct inotify_event *next )
+{
+    if (ie->mask & IN_CREATE) return FILE_ACTION_ADDED;
+    if (ie->mask & IN_DELETE) return FILE_ACTION_REMOVED;
+    if (ie->mask & IN_MOVED_FROM)
+    {
+        if (next && (next->mask & IN_MOVED_TO) && next->cookie == ie->cookie)
+            return FILE_ACTION_RENAMED_OLD_NAME;
+        return FILE_ACTION_REMOVED;  /* moved out of the watched directory */
+    }
+    if (ie->mask & IN_MOVED_TO)
+    {
+        if (prev && (prev->mask & IN_MOVED_FROM) && prev->cookie == ie->cookie)
+            return FILE_ACTION_RENAMED_NEW_NAME;
+        return FILE_ACTION_ADDED;  /* moved in from an unwatched place */
+    }
+    return FILE_ACTION_MODIFIED;
+}
+
+/* dispatch an inotify event to all the watches of its directory; change_mutex must be held */
+static void dispatch_change_event( const struct inotify_event *ie, ULONG action )
+{
+    struct list *bucket = get_wd_bucket( ie->wd );
+    struct change_dir *dir, **dirs;
+    unsigned int i, count = 0;
+
+    LIST_FOR_EACH_ENTRY( dir, bucket, struct change_dir, wd_entry )
+        if (dir->wd == ie->wd) count++;
+    if (!count) return;
+
+    /* dispatching may add and remove directories, so work on a snapshot */
+    if (!(dirs = RtlAllocateHeap( GetProcessHeap(), 0, count * sizeof(*dirs) ))) return;
+    count = 0;
+    LIST_FOR_EACH_ENTRY( dir, bucket, struct change_dir, wd_entry )
+        if (dir->wd == ie->wd) dirs[count++] = dir;
+
+    for (i = 0; i < count; i++)
+    {
+        struct change_watch *watch;
+
+        dir = dirs[i];
+        watch = dir->watch;
+
+        if (ie->mask & IN_IGNORED)
+        {
+            remove_change_dir( dir, TRUE );
+            continue;
+        }
+        if (!ie->len) continue;  /* event on the directory itself */
+        if (dir->path[0] && !watch->subtree) continue;
+
+        if (filter_from_event( ie ) & watch->filter)
+            queue_change( watch, action, dir->path, ie->name );
+
+        if (watch->subtree && (ie->mask & IN_ISDIR) &&
+            (ie->mask & (IN_CREATE | IN_MOVED_TO | IN_DELETE | IN_MOVED_FROM)))
+        {
+            char *path = make_relative_path( dir->path, ie->name );
+
+            if (!path) continue;
+            if (ie->mask & (IN_CREATE | IN_MOVED_TO))
+            {
+                if (add_change_dir( watch, path )) add_change_subdirs( watch, path );
+            }
+            else remove_change_subdirs( watch, path );
+            RtlFreeHeap( GetProcessHeap(), 0, path );
+        }
+    }
+    RtlFreeHeap( GetProcessHeap(), 0, dirs );
+}
+
+/* process a batch of inotify events and complete the requests that have changes available */
+static void process_change_events( const char *buffer, int size )
+{
+    const struct inotify_event *ie, *prev = NULL, *next;
+    struct change_watch *watch;
+    struct list completed = LIST_INIT( completed );
+    int pos = 0, next_pos;
+
+    pthread_mutex_lock( &change_mutex );
+    while (pos < size)
+    {
+        ie = (const struct inotify_event *)(buffer + pos);
+        next_pos = pos + sizeof(*ie) + ie->len;
+        next = next_pos < size ? (const struct inotify_event *)(buffer + next_pos) : NULL;
+
+        if (ie->mask & IN_Q_OVERFLOW)
+        {
+            WARN( "inotify queue overflow\n" );
+            LIST_FOR_EACH_ENTRY( watch, &watches, struct change_watch, entry )
+            {
+                free_change_records( watch );
+                watch->overflow = TRUE;
+            }
+        }
+        else dispatch_change_event( ie, get_change_action( ie, prev, next ));
+
+        prev = ie;
+        pos = next_pos;
+    }
+
+    LIST_FOR_EACH_ENTRY( watch, &watches, struct change_watch, entry )
+        queue_completed_request( complete_change_request( watch ), &completed );
+    pthread_mutex_unlock( &change_mutex );
+
+    notify_change_requests( &completed );
+}
+
+/* thread reading the shared inotify instance */
+static void *change_thread( void *arg )
+{
+    char buffer[64 * (sizeof(struct inotify_event) + NAME_MAX + 1)];
+    int size;
+
+    for (;;)
+    {
+        if ((size = read( inotify_fd, buffer, sizeof(buffer) )) == -1)
+        {
+            if (errno == EINTR) continue;
+            ERR( "failed to read inotify events: %s\n", strerror(errno) );
+            break;
+        }
+        process_change_events( buffer, size );
+    }
+    return NULL;
+}
+
+static struct change_watch *find_change_watch( HANDLE handle )
+{
+    struct change_watch *watch;
+
+    LIST_FOR_EACH_ENTRY( watch, &watches, struct change_watch, entry )
+        if (watch->handle == handle) return watch;
+    return NULL;
+}
+
+/* create the change tracking state of a directory handle; change_mutex must be held */
+static NTSTATUS create_change_watch( HANDLE handle, int fd, ULONG filter, BOOLEAN subtree,
+                                     struct change_watch **ret )
+{
+    struct change_watch *watch;
+    char proc_name[32], *root;
+    ssize_t len;
+
+    sprintf( proc_name, "/proc/self/fd/%d", fd );
+    if (!(root = RtlAllocateHeap( GetProcessHeap(), 0, PATH_MAX ))) return STATUS_NO_MEMORY;
+    if ((len = readlink( proc_name, root, PATH_MAX - 1 )) == -1)
+    {
+        RtlFreeHeap( GetProcessHeap(), 0, root );
+        return FILE_GetNtStatus();
+    }
+    root[len] = 0;
+
+    if (!(watch = RtlAllocateHeap( GetProcessHeap(), HEAP_ZERO_MEMORY, sizeof(*watch) )))
+    {
+        RtlFreeHeap( GetProcessHeap(), 0, root );
+        return STATUS_NO_MEMORY;
+    }
+    watch->handle  = handle;
+    watch->root    = root;
+    watch->filter  = filter;
+    watch->subtree = subtree;
+    list_init( &watch->dirs );
+
+    if (!add_change_dir( watch, "" ))
+    {
+        NTSTATUS status = FILE_GetNtStatus();
+        RtlFreeHeap( GetProcessHeap(), 0, root );
+        RtlFreeHeap( GetProcessHeap(), 0, watch );
+        return status;
+    }
+    if (subtree) add_change_subdirs( watch, "" );
+
+    list_add_tail( &watches, &watch->entry );
+    *ret = watch;
+    return STATUS_SUCCESS;
+}
+
+/* update the filter of an existing watch; change_mutex must be held */
+static void update_change_watch( struct change_watch *watch, ULONG filter, BOOLEAN subtree )
+{
+    struct change_dir *dir;
+    BOOLEAN add_subdirs = subtree && !watch->subtree;
+    char *unix_name;
+
+    if (filter == watch->filter && subtree == watch->subtree) return;
+
+    watch->filter  = filter;
+    watch->subtree = subtree;
+    /* masks are only ever extended, events outside of the filter are dropped on dispatch */
+    LIST_FOR_EACH_ENTRY( dir, &watch->dirs, struct change_dir, entry )
+    {
+        if (!(unix_name = make_relative_path( watch->root, dir->path ))) continue;
+        inotify_add_watch( inotify_fd, unix_name, filter_to_mask( filter, subtree ));
+        RtlFreeHeap( GetProcessHeap(), 0, unix_name );
+    }
+    if (add_subdirs) add_change_subdirs( watch, "" );
+}
+
+
+/***********************************************************************
+ *           change_read_directory
+ *
+ * Wait for changes in the directory opened as handle/fd and store them
+ * in buffer as FILE_NOTIFY_INFORMATION records.
+ *
+ * Changes are tracked from the first call on a handle until it is closed,
+ * and queued between calls. If changes are already queued, the request
+ * completes immediately. Otherwise the request returns STATUS_PENDING and
+ * the callback is invoked from the notification thread when changes arrive.
+ * The callback is also invoked for requests that complete immediately.
+ */
+NTSTATUS change_read_directory( HANDLE handle, int fd, ULONG filter, BOOLEAN subtree,
+                                void *buffer, ULONG size, IO_STATUS_BLOCK *iosb,
+                                change_callback_t callback, void *user )
+{
+    struct change_watch *watch;
+    struct change_request *request;
+    struct list completed = LIST_INIT( completed );
+    NTSTATUS status = STATUS_SUCCESS;
+
+    TRACE( "%p filter %08x subtree %d buffer %p size %u\n", handle, filter, subtree, buffer, size );
+
+    if (!(request = RtlAllocateHeap( GetProcessHeap(), 0, sizeof(*request) ))) return STATUS_NO_MEMORY;
+
+    request->buffer   = buffer;
+    request->size     = size;
+    request->iosb     = iosb;
+    request->callback = callback;
+    request->user     = user;
+
+    pthread_mutex_lock( &change_mutex );
+
+    if (!init_inotify()) status = STATUS_NOT_SUPPORTED;
+    else if ((watch = find_change_watch( handle ))) update_change_watch( watch, filter, subtree );
+    else status = create_change_watch( handle, fd, filter, subtree, &watch );
+
+    if (!status && watch->request) status = STATUS_INVALID_PARAMETER;  /* only one request at a time */
+
+    if (status)
+    {
+        pthread_mutex_unlock( &change_mutex );
+        RtlFreeHeap( GetProcessHeap(), 0, request );
+        return status;
+    }
+
+    iosb->u.Status = STATUS_PENDING;
+    iosb->Information = 0;
+    watch->request = request;
+    if (complete_change_request( watch )) queue_completed_request( request, &completed );
+    else status = STATUS_PENDING;
+    pthread_mutex_unlock( &change_mutex );
+
+    if (!list_empty( &completed ))
+    {
+        status = iosb->u.Status;
+        notify_change_requests( &completed );
+    }
+    return status;
+}
+
+
+/***********************************************************************
+ *           change_close_directory
+ *
+ * Stop tracking changes for a directory handle that is being closed.
+ * A pending request is completed with STATUS_NOTIFY_CLEANUP.
+ */
+void change_close_directory( HANDLE handle )
+{
+    struct change_watch *watch;
+    struct change_request *request;
+    struct change_dir *dir, *next;
+    struct list completed = LIST_INIT( completed );
+
+    if (inotify_fd == -1) return;
+
+    pthread_mutex_lock( &change_mutex );
+    if ((watch = find_change_watch( handle )))
+    {
+        list_remove( &watch->entry );
+        if ((request = watch->request))
+        {
+            request->iosb->u.Status = STATUS_NOTIFY_CLEANUP;
+            request->iosb->Information = 0;
+            queue_completed_request( request, &completed );
+        }
+        LIST_FOR_EACH_ENTRY_SAFE( dir, next, &watch->dirs, struct change_dir, entry )
+            remove_change_dir( dir, FALSE );
+        free_change_records( watch );
+        RtlFreeHeap( GetProcessHeap(), 0, watch->root );
+        RtlFreeHeap( GetProcessHeap(), 0, watch );
+    }
+    pthread_mutex_unlock( &change_mutex );
+
+    notify_change_requests( &completed );
+}
+
+#else  /* HAVE_SYS_INOTIFY_H */
+
+NTSTATUS change_read_directory( HANDLE handle, int fd, ULONG filter, BOOLEAN subtree,
+                                void *buffer, ULONG size, IO_STATUS_BLOCK *iosb,
+                                change_callback_t callback, void *user )
+{
+    FIXME( "directory change notification not supported on this platform\n" );
+    return STATUS_NOT_SUPPORTED;
+}
+
+void change_close_directory( HANDLE handle )
+{
+}
+
+#endif  /* HAVE_SYS_INOTIFY_H */
@@ -137,21 +137,16 @@ NTSTATUS CDECL wine_nt_to_unix_file_name( const UNICODE_STRING *nameW, ANSI_STRI
     const WCHAR *name, *p;
     //struct stat st;
     char *unix_name;
-    int pos, ret, name_len, unix_len, prefix_len, used_default;
+    int name_len, unix_len, used_default;
 
     name     = nameW->Buffer;
     name_len = nameW->Length / sizeof(WCHAR);
 
     if (!name_len || !IS_SEPARATOR(name[0])) return STATUS_OBJECT_PATH_SYNTAX_BAD;
 
-    unix_len = ntdll_wcstoumbs( 0, name, name_len, NULL, 0, NULL, NULL );
-    if (!(unix_name = RtlAllocateHeap( GetProcessHeap(), 0, unix_len )))
+    if (!(unix_name = ntdll_wcstoumbs_alloc( 0, name, name_len, NULL, 0, &unix_len, &used_default )))
         return STATUS_NO_MEMORY;
-    pos = strlen(unix_name);
-
-    ret = ntdll_wcstoumbs( 0, name, name_len, unix_name, unix_len,
-                           NULL, &used_default );
-    if (!ret || used_default)
+    if (!unix_len || used_default)
     {
         RtlFreeHeap( GetProcessHeap(), 0, unix_name );
         return STATUS_OBJECT_NAME_INVALID;
@@ -161,8 +156,8 @@ NTSTATUS CDECL wine_nt_to_unix_file_name( const UNICODE_STRING *nameW, ANSI_STRI
     {
         TRACE( "%s -> %s\n", debugstr_us(nameW), debugstr_a(unix_name) );
         unix_name_ret->Buffer = unix_name;
-        unix_name_ret->Length = strlen(unix_name);
-        unix_name_ret->MaximumLength = unix_len;
+        unix_name_ret->Length = unix_len;
+        unix_name_ret->MaximumLength = unix_len + 1;
     }
 /*    else
     {
@@ -214,7 +209,7 @@ void otowi_init()
 	}
 
 	// TODO: do as __wine_kernel_init
-	LOCALE_Init();
+	if (!LOCALE_Init()) exit(1);
 
 
 	// TODO: do as kernel32/process_attach
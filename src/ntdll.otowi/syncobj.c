@@ -0,0 +1,2610 @@
+/*
+ * Synchronization objects in shared memory
+ *
+ * Events, mutexes, semaphores and timers are a few words in a small
+ * shared mapping and are driven with futexes on those words, without any
+ * server round trip. Named objects are files in /dev/shm that other processes open by
+ * name; unnamed ones are anonymous memory files. As for files, the handle
+ * of an object is the fd of its backing file.
+ *
+ * Mutexes follow the kernel's robust futex protocol: the futex word holds
+ * the unix thread id of the owner, and an owned mutex is linked into the
+ * robust list of its owner thread. When a thread dies while owning a
+ * mutex, the kernel marks the mutex as abandoned and wakes a waiter, which
+ * then gets STATUS_ABANDONED, even if the owner was in another process.
+ *
+ * Waits that mix objects with other handles (pipes, sockets, consoles) are
+ * a single poll. For those, an object gets an eventfd in each process that
+ * polls it, which the signaling side of the same process writes to, and a
+ * watcher thread writes to when it is signaled from somewhere else.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301, USA
+ */
+
+#include "config.h"
+#include "wine/port.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <pthread.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/types.h>
+#include <sys/file.h>
+#ifdef HAVE_SYS_MMAN_H
+# include <sys/mman.h>
+#endif
+#ifdef HAVE_SYS_PRCTL_H
+# include <sys/prctl.h>
+#endif
+#ifdef HAVE_POLL_H
+# include <poll.h>
+#endif
+#ifdef HAVE_SYS_STAT_H
+# include <sys/stat.h>
+#endif
+#ifdef HAVE_SYS_SYSCALL_H
+# include <sys/syscall.h>
+#endif
+#ifdef HAVE_SCHED_H
+# include <sched.h>
+#endif
+#include <time.h>
+#ifdef HAVE_UNISTD_H
+# include <unistd.h>
+#endif
+
+#include "ntstatus.h"
+#define WIN32_NO_STATUS
+#include "windef.h"
+#include "winnt.h"
+#include "winternl.h"
+#include "wine/unicode.h"
+#include "wine/debug.h"
+#include "ntdll_misc.h"
+
+WINE_DEFAULT_DEBUG_CHANNEL(sync);
+
+#define SYNC_OBJECT_SIZE    4096  /* size of the backing file of an object */
+
+#define TICKSPERSEC         10000000
+#define TICKS_1601_TO_1970  ((ULONGLONG)116444736 * 1000000000)
+
+enum sync_object_type
+{
+    SYNC_OBJECT_NONE,       /* object still being created */
+    SYNC_OBJECT_EVENT,
+    SYNC_OBJECT_MUTEX,
+    SYNC_OBJECT_SEMAPHORE,
+    SYNC_OBJECT_TIMER
+};
+
+/* shared part of an object, the same in all the processes using it
+ *
+ * state is the futex word:
+ *   event     - bit 0 is the signaled state, the other bits count the
+ *               times the event was set or pulsed
+ *   mutex     - owner thread id, FUTEX_WAITERS and FUTEX_OWNER_DIED
+ *   semaphore - current count
+ *   timer     - same as an event, set when the timer expires
+ */
+struct sync_object
+{
+    int           state;       /* futex word, see above */
+    unsigned int  type;        /* enum sync_object_type, set last on creation */
+    char          robust[64];  /* room for the robust list entry of a mutex */
+    int           waiters;     /* number of threads waiting on the object */
+    int           max;         /* maximum count of a semaphore */
+    int           manual;      /* manual reset event */
+    int           count;       /* recursion count of a mutex */
+    int           timer_lock;    /* spinlock protecting the timer schedule */
+    int           timer_seq;     /* changed every time the timer is set or cancelled */
+    int           timer_active;  /* timer set and not expired yet */
+    int           timer_clock;   /* clock of timer_due */
+    LONGLONG      timer_due;     /* next expiration, in ns */
+    LONGLONG      timer_period;  /* period in ns, 0 for a one shot timer */
+    LONGLONG      timer_slack;   /* tolerable delay in ns */
+};
+
+/* mapping of an object in this process, shared by all its handles */
+struct sync_mapping
+{
+    struct sync_mapping *next;    /* next in the list of mappings */
+    struct sync_object  *obj;     /* the object itself */
+    dev_t                dev;     /* backing file of the object */
+    ino_t                ino;
+    int                  refs;    /* number of handles */
+    int                  poll_fd; /* eventfd for waits mixed with other handles, -1 if none yet */
+    int                  pollers; /* number of such waits in progress in this process */
+    int                  watched;     /* the watcher thread sleeps on the futex for the pollers */
+    int                  watch_state; /* futex value the watcher last told the pollers about */
+    int                  timer_fd;    /* timerfd of a timer in this process, -1 if none yet */
+    int                  timer_clock; /* clock of timer_fd */
+    int                  timer_seq;   /* timer_seq the timerfd was armed for */
+    int                  timer_apc;   /* an APC routine is set for the timer in this process */
+    int                  global;  /* named object in the global namespace */
+    char                 path[1]; /* unix name of a named object, empty for unnamed ones */
+};
+
+static struct sync_mapping *sync_mappings;
+static pthread_mutex_t sync_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_once_t sync_fork_once = PTHREAD_ONCE_INIT;
+static int sync_pollers;  /* number of mixed waits in progress in this process */
+
+static const char sync_dir[] = "/dev/shm";
+
+static inline BOOL is_error( NTSTATUS status )
+{
+    return ((ULONG)status >> 30) == 3;
+}
+
+
+/***********************************************************************
+ *           Futexes
+ */
+
+#ifdef __linux__
+
+#define FUTEX_WAKE_              1
+#define FUTEX_WAIT_BITSET_       9
+#define FUTEX_CLOCK_REALTIME_    256
+#define FUTEX_BITSET_MATCH_ANY_  0xffffffff
+#define FUTEX_WAITERS_           0x80000000
+#define FUTEX_OWNER_DIED_        0x40000000
+#define FUTEX_TID_MASK_          0x3fffffff
+#define FUTEX2_SIZE_U32_         0x02
+
+#ifndef __NR_futex_waitv
+#define __NR_futex_waitv 449
+#endif
+
+struct futex_waitv_
+{
+    ULONGLONG    val;
+    ULONGLONG    uaddr;
+    unsigned int flags;
+    unsigned int reserved;
+};
+
+struct robust_list_
+{
+    struct robust_list_ *next;
+};
+
+struct robust_list_head_
+{
+    struct robust_list_  list;
+    long                 futex_offset;
+    struct robust_list_ *list_op_pending;
+};
+
+/* the object futexes are shared between processes, so no FUTEX_PRIVATE_FLAG here */
+static inline int futex_wait_until( int *addr, int val, const struct timespec *deadline, clockid_t clock )
+{
+    int op = FUTEX_WAIT_BITSET_;
+
+    if (deadline && clock == CLOCK_REALTIME) op |= FUTEX_CLOCK_REALTIME_;
+    return syscall( __NR_futex, addr, op, val, deadline, NULL, FUTEX_BITSET_MATCH_ANY_ );
+}
+
+static inline int futex_wake( int *addr, int count )
+{
+    return syscall( __NR_futex, addr, FUTEX_WAKE_, count, NULL, NULL, 0 );
+}
+
+static inline int futex_waitv( struct futex_waitv_ *waiters, unsigned int count,
+                               const struct timespec *deadline, clockid_t clock )
+{
+    return syscall( __NR_futex_waitv, waiters, count, 0, deadline, clock );
+}
+
+static inline int get_unix_tid(void)
+{
+    return syscall( SYS_gettid );
+}
+
+static inline int create_eventfd(void)
+{
+    /* EFD_SEMAPHORE | EFD_NONBLOCK | EFD_CLOEXEC */
+    return syscall( __NR_eventfd2, 0, 1 | O_NONBLOCK | O_CLOEXEC );
+}
+
+static inline int create_timerfd( clockid_t clock )
+{
+    /* TFD_NONBLOCK | TFD_CLOEXEC */
+    return syscall( __NR_timerfd_create, clock, O_NONBLOCK | O_CLOEXEC );
+}
+
+static inline int set_timerfd( int fd, const struct itimerspec *spec )
+{
+    /* TFD_TIMER_ABSTIME */
+    return syscall( __NR_timerfd_settime, fd, 1, spec, NULL );
+}
+
+static inline void set_timer_slack( ULONG_PTR slack )
+{
+    prctl( 29 /* PR_SET_TIMERSLACK */, slack, 0, 0, 0 );
+}
+
+static inline ULONG_PTR get_timer_slack(void)
+{
+    return prctl( 30 /* PR_GET_TIMERSLACK */, 0, 0, 0, 0 );
+}
+
+#else  /* __linux__ */
+
+#define FUTEX_WAITERS_           0x80000000
+#define FUTEX_OWNER_DIED_        0x40000000
+#define FUTEX_TID_MASK_          0x3fffffff
+
+struct futex_waitv_
+{
+    ULONGLONG    val;
+    ULONGLONG    uaddr;
+    unsigned int flags;
+    unsigned int reserved;
+};
+
+struct robust_list_ { struct robust_list_ *next; };
+struct robust_list_head_ { struct robust_list_ list; long futex_offset; struct robust_list_ *list_op_pending; };
+
+/* without futexes, waits just poll */
+static inline int futex_wait_until( int *addr, int val, const struct timespec *deadline, clockid_t clock )
+{
+    sched_yield();
+    return 0;
+}
+
+static inline int futex_wake( int *addr, int count ) { return 0; }
+
+static inline int futex_waitv( struct futex_waitv_ *waiters, unsigned int count,
+                               const struct timespec *deadline, clockid_t clock )
+{
+    errno = ENOSYS;
+    return -1;
+}
+
+static inline int get_unix_tid(void)
+{
+    static int next_tid;
+    return interlocked_xchg_add( &next_tid, 1 ) + 1;
+}
+
+/* mixed waits then recheck the objects periodically */
+static inline int create_eventfd(void)
+{
+    return -1;
+}
+
+/* and timers are only checked against the clock */
+static inline int create_timerfd( clockid_t clock )
+{
+    return -1;
+}
+
+static inline int set_timerfd( int fd, const struct itimerspec *spec )
+{
+    return -1;
+}
+
+static inline void set_timer_slack( ULONG_PTR slack ) { }
+
+static inline ULONG_PTR get_timer_slack(void)
+{
+    return 0;
+}
+
+#endif  /* __linux__ */
+
+/* convert an NT timeout to an absolute unix time, returns FALSE if it's infinite */
+static BOOL get_deadline( const LARGE_INTEGER *timeout, struct timespec *ts, clockid_t *clock )
+{
+    if (!timeout || timeout->QuadPart == TIMEOUT_INFINITE) return FALSE;
+
+    if (timeout->QuadPart > 0)  /* absolute system time */
+    {
+        ULONGLONG when = max( timeout->QuadPart, TICKS_1601_TO_1970 ) - TICKS_1601_TO_1970;
+
+        *clock = CLOCK_REALTIME;
+        ts->tv_sec  = when / TICKSPERSEC;
+        ts->tv_nsec = (when % TICKSPERSEC) * 100;
+    }
+    else
+    {
+        ULONGLONG diff = -timeout->QuadPart;
+
+        *clock = CLOCK_MONOTONIC;
+        clock_gettime( CLOCK_MONOTONIC, ts );
+        ts->tv_sec  += diff / TICKSPERSEC;
+        ts->tv_nsec += (diff % TICKSPERSEC) * 100;
+        if (ts->tv_nsec >= 1000000000)
+        {
+            ts->tv_sec++;
+            ts->tv_nsec -= 1000000000;
+        }
+    }
+    return TRUE;
+}
+
+static LONGLONG get_clock_ns( clockid_t clock )
+{
+    struct timespec ts;
+
+    clock_gettime( clock, &ts );
+    return ts.tv_sec * (LONGLONG)1000000000 + ts.tv_nsec;
+}
+
+static BOOL deadline_passed( const struct timespec *deadline, clockid_t clock )
+{
+    struct timespec now;
+
+    clock_gettime( clock, &now );
+    if (now.tv_sec != deadline->tv_sec) return now.tv_sec > deadline->tv_sec;
+    return now.tv_nsec >= deadline->tv_nsec;
+}
+
+
+/***********************************************************************
+ *           Thread data
+ */
+
+/* user APC queued to a thread */
+struct sync_apc
+{
+    struct sync_apc *next;
+    PNTAPCFUNC       func;
+    ULONG_PTR        arg1;
+    ULONG_PTR        arg2;
+    ULONG_PTR        arg3;
+};
+
+struct sync_thread
+{
+    int                       tid;       /* unix thread id, stored in the mutexes owned */
+    struct robust_list_head_ *robust;    /* robust futex list of the thread, NULL if unsupported */
+    struct robust_list_head_  head;      /* our own list, if nobody registered one before */
+    struct sync_apc          *apcs;      /* pending APCs, newest first */
+    int                       apc_seq;   /* futex word, changed whenever an APC is queued */
+    int                       alertable; /* the thread is in an alertable wait */
+    int                       apc_fd;    /* eventfd for alertable waits that poll, -1 if none yet */
+    LONG                      refs;      /* the thread itself, and whoever may queue APCs to it */
+};
+
+static pthread_key_t sync_thread_key;
+static pthread_once_t sync_thread_once = PTHREAD_ONCE_INIT;
+
+static struct sync_thread fallback_thread;
+
+/***********************************************************************
+ *           sync_release_thread
+ *
+ * Release a reference taken with sync_get_current_thread.
+ */
+void sync_release_thread( struct sync_thread *thread )
+{
+    struct sync_apc *apc, *next;
+
+    if (thread == &fallback_thread || interlocked_xchg_add( &thread->refs, -1 ) > 1) return;
+
+    /* APCs of a thread that exited are never called */
+    for (apc = thread->apcs; apc; apc = next)
+    {
+        next = apc->next;
+        RtlFreeHeap( GetProcessHeap(), 0, apc );
+    }
+    if (thread->apc_fd != -1) close( thread->apc_fd );
+    RtlFreeHeap( GetProcessHeap(), 0, thread );
+}
+
+static void free_sync_thread( void *ptr )
+{
+    sync_release_thread( ptr );
+}
+
+/* the child of a fork runs on a new unix thread, which owns none of the mutexes */
+static void sync_thread_atfork_child(void)
+{
+    /* the old data is leaked, the heap may be locked by a thread that didn't survive the fork */
+    pthread_setspecific( sync_thread_key, NULL );
+    fallback_thread.tid = 0;
+}
+
+static void init_sync_thread_key(void)
+{
+    pthread_key_create( &sync_thread_key, free_sync_thread );
+    pthread_atfork( NULL, NULL, sync_thread_atfork_child );
+}
+
+/* use the robust list registered by the C library if there is one, the kernel only
+ * supports a single list per thread, otherwise register our own */
+static struct robust_list_head_ *get_robust_list_head( struct sync_thread *thread )
+{
+#if defined(__linux__) && defined(__NR_get_robust_list)
+    struct robust_list_head_ *head;
+    size_t len;
+
+    if (!syscall( __NR_get_robust_list, 0, &head, &len ) && head && len == sizeof(*head))
+        return head;
+
+    thread->head.list.next       = &thread->head.list;
+    thread->head.futex_offset    = offsetof( struct sync_object, state ) - offsetof( struct sync_object, robust );
+    thread->head.list_op_pending = NULL;
+    if (!syscall( __NR_set_robust_list, &thread->head, sizeof(thread->head) )) return &thread->head;
+#endif
+    WARN( "robust futexes not supported, abandoned mutexes won't be detected\n" );
+    return NULL;
+}
+
+static struct sync_thread *get_sync_thread(void)
+{
+    struct sync_thread *thread;
+
+    pthread_once( &sync_thread_once, init_sync_thread_key );
+    if ((thread = pthread_getspecific( sync_thread_key ))) return thread;
+
+    if (!(thread = RtlAllocateHeap( GetProcessHeap(), 0, sizeof(*thread) )))
+    {
+        /* can't track mutexes per thread, at least keep working */
+        if (!fallback_thread.tid)
+        {
+            fallback_thread.tid = get_unix_tid();
+            fallback_thread.apc_fd = -1;
+        }
+        return &fallback_thread;
+    }
+    thread->tid       = get_unix_tid();
+    thread->robust    = get_robust_list_head( thread );
+    thread->apcs      = NULL;
+    thread->apc_seq   = 0;
+    thread->alertable = 0;
+    thread->apc_fd    = -1;
+    thread->refs      = 1;
+    pthread_setspecific( sync_thread_key, thread );
+    return thread;
+}
+
+/***********************************************************************
+ *           sync_get_current_thread
+ *
+ * Get a reference to the current thread, for queuing APCs to it from
+ * other threads with sync_queue_apc.
+ */
+struct sync_thread *sync_get_current_thread(void)
+{
+    struct sync_thread *thread = get_sync_thread();
+
+    if (thread != &fallback_thread) interlocked_xchg_add( &thread->refs, 1 );
+    return thread;
+}
+
+/* the entry of a mutex in the robust list, it has to be at a fixed offset from the futex */
+static struct robust_list_ *get_robust_entry( struct sync_thread *thread, struct sync_object *obj )
+{
+    char *entry;
+
+    if (!thread->robust) return NULL;
+    entry = (char *)&obj->state - thread->robust->futex_offset;
+    if (entry < obj->robust || entry + sizeof(struct robust_list_) > obj->robust + sizeof(obj->robust))
+        return NULL;
+    if ((ULONG_PTR)entry % sizeof(void *)) return NULL;
+    return (struct robust_list_ *)entry;
+}
+
+static void robust_list_add( struct sync_thread *thread, struct robust_list_ *entry )
+{
+    entry->next = thread->robust->list.next;
+    thread->robust->list.next = entry;
+}
+
+static void robust_list_remove( struct sync_thread *thread, struct robust_list_ *entry )
+{
+    struct robust_list_ *prev = &thread->robust->list;
+
+    /* the low bit of the pointers marks PI futexes of the C library */
+    while ((struct robust_list_ *)((ULONG_PTR)prev->next & ~(ULONG_PTR)1) != entry)
+    {
+        prev = (struct robust_list_ *)((ULONG_PTR)prev->next & ~(ULONG_PTR)1);
+        if (prev == &thread->robust->list) return;
+    }
+    prev->next = entry->next;
+}
+
+
+/***********************************************************************
+ *           Object operations
+ */
+
+/* let the mixed waits of this process on the object know that it changed */
+static void notify_pollers( struct sync_object *obj )
+{
+    struct sync_mapping *mapping;
+    ULONGLONG count;
+
+    pthread_mutex_lock( &sync_mutex );
+    for (mapping = sync_mappings; mapping; mapping = mapping->next)
+    {
+        if (mapping->obj != obj) continue;
+        if (mapping->pollers && mapping->poll_fd != -1)
+        {
+            count = mapping->pollers;
+            write( mapping->poll_fd, &count, sizeof(count) );
+        }
+        break;
+    }
+    pthread_mutex_unlock( &sync_mutex );
+}
+
+static void wake_object( struct sync_object *obj, int count )
+{
+    futex_wake( &obj->state, count );
+    if (*(volatile int *)&sync_pollers) notify_pollers( obj );
+}
+
+/* returns STATUS_TIMEOUT if the object isn't signaled; start is the state at the
+ * beginning of the wait, a manual reset event set since then satisfies the wait */
+static NTSTATUS acquire_object( struct sync_object *obj, struct sync_thread *thread, int start )
+{
+    struct robust_list_ *entry;
+    int val, new;
+
+    switch (obj->type)
+    {
+    case SYNC_OBJECT_EVENT:
+    case SYNC_OBJECT_TIMER:
+        for (;;)
+        {
+            val = *(volatile int *)&obj->state;
+            if (obj->manual)
+                return ((val & 1) || (val >> 1) != (start >> 1)) ? STATUS_SUCCESS : STATUS_TIMEOUT;
+            if (!(val & 1)) return STATUS_TIMEOUT;
+            if (interlocked_cmpxchg( &obj->state, val & ~1, val ) == val) return STATUS_SUCCESS;
+        }
+
+    case SYNC_OBJECT_SEMAPHORE:
+        for (;;)
+        {
+            val = *(volatile int *)&obj->state;
+            if (!val) return STATUS_TIMEOUT;
+            if (interlocked_cmpxchg( &obj->state, val - 1, val ) == val) return STATUS_SUCCESS;
+        }
+
+    case SYNC_OBJECT_MUTEX:
+        entry = get_robust_entry( thread, obj );
+        for (;;)
+        {
+            val = *(volatile int *)&obj->state;
+            if ((val & FUTEX_TID_MASK_) == thread->tid)
+            {
+                if (obj->count == INT_MAX) return STATUS_MUTANT_LIMIT_EXCEEDED;
+                obj->count++;
+                return STATUS_SUCCESS;
+            }
+            if (val & FUTEX_TID_MASK_) return STATUS_TIMEOUT;
+
+            /* the kernel checks the pending entry if the thread dies before the list is updated */
+            if (entry) thread->robust->list_op_pending = entry;
+            new = thread->tid | (obj->waiters ? FUTEX_WAITERS_ : 0);
+            if (interlocked_cmpxchg( &obj->state, new, val ) == val) break;
+        }
+        if (entry)
+        {
+            robust_list_add( thread, entry );
+            thread->robust->list_op_pending = NULL;
+        }
+        obj->count = 1;
+        return (val & FUTEX_OWNER_DIED_) ? STATUS_ABANDONED : STATUS_SUCCESS;
+    }
+    return STATUS_OBJECT_TYPE_MISMATCH;
+}
+
+/* check whether the object could be acquired, without acquiring it */
+static BOOL is_object_signaled( struct sync_object *obj, struct sync_thread *thread, int start, int val )
+{
+    switch (obj->type)
+    {
+    case SYNC_OBJECT_EVENT:
+    case SYNC_OBJECT_TIMER:
+        if (obj->manual) return (val & 1) || (val >> 1) != (start >> 1);
+        return val & 1;
+    case SYNC_OBJECT_SEMAPHORE:
+        return val > 0;
+    case SYNC_OBJECT_MUTEX:
+        return !(val & FUTEX_TID_MASK_) || (val & FUTEX_TID_MASK_) == thread->tid;
+    }
+    return FALSE;
+}
+
+/* get the futex value to sleep on, with the waiter bit set for mutexes */
+static int prepare_wait( struct sync_object *obj )
+{
+    int val, tmp;
+
+    for (val = *(volatile int *)&obj->state;; val = tmp)
+    {
+        if (obj->type != SYNC_OBJECT_MUTEX) return val;
+        if (!(val & FUTEX_TID_MASK_) || (val & FUTEX_WAITERS_)) return val;
+        if ((tmp = interlocked_cmpxchg( &obj->state, val | FUTEX_WAITERS_, val )) == val)
+            return val | FUTEX_WAITERS_;
+    }
+}
+
+static BOOL wakes_single_thread( struct sync_object *obj )
+{
+    return (obj->type != SYNC_OBJECT_EVENT && obj->type != SYNC_OBJECT_TIMER) || !obj->manual;
+}
+
+static NTSTATUS set_event( struct sync_object *obj, LONG *prev )
+{
+    int val, tmp;
+
+    for (val = *(volatile int *)&obj->state;; val = tmp)
+    {
+        if (val & 1) break;
+        if ((tmp = interlocked_cmpxchg( &obj->state, (val + 2) | 1, val )) == val) break;
+    }
+    if (prev) *prev = val & 1;
+    if (!(val & 1) && obj->waiters) wake_object( obj, obj->manual ? INT_MAX : 1 );
+    return STATUS_SUCCESS;
+}
+
+static NTSTATUS reset_event( struct sync_object *obj, LONG *prev )
+{
+    int val, tmp;
+
+    for (val = *(volatile int *)&obj->state;; val = tmp)
+    {
+        if (!(val & 1)) break;
+        if ((tmp = interlocked_cmpxchg( &obj->state, val & ~1, val )) == val) break;
+    }
+    if (prev) *prev = val & 1;
+    return STATUS_SUCCESS;
+}
+
+static NTSTATUS release_mutex( struct sync_object *obj, struct sync_thread *thread, LONG *prev )
+{
+    struct robust_list_ *entry;
+    int val = *(volatile int *)&obj->state;
+
+    if ((val & FUTEX_TID_MASK_) != thread->tid) return STATUS_MUTANT_NOT_OWNED;
+    if (prev) *prev = 1 - obj->count;
+    if (--obj->count) return STATUS_SUCCESS;
+
+    if ((entry = get_robust_entry( thread, obj )))
+    {
+        thread->robust->list_op_pending = entry;
+        robust_list_remove( thread, entry );
+    }
+    val = interlocked_xchg( &obj->state, 0 );
+    if (entry) thread->robust->list_op_pending = NULL;
+    if (val & FUTEX_WAITERS_) wake_object( obj, 1 );
+    return STATUS_SUCCESS;
+}
+
+static NTSTATUS release_semaphore( struct sync_object *obj, ULONG count, ULONG *prev )
+{
+    int val, tmp;
+
+    for (val = *(volatile int *)&obj->state;; val = tmp)
+    {
+        if (count > (ULONG)(obj->max - val)) return STATUS_SEMAPHORE_LIMIT_EXCEEDED;
+        if ((tmp = interlocked_cmpxchg( &obj->state, val + count, val )) == val) break;
+    }
+    if (prev) *prev = val;
+    if (obj->waiters) wake_object( obj, min( count, INT_MAX ) );
+    return STATUS_SUCCESS;
+}
+
+/* give back an object acquired by a failed wait for all objects */
+static void undo_acquire( struct sync_object *obj, struct sync_thread *thread )
+{
+    switch (obj->type)
+    {
+    case SYNC_OBJECT_EVENT:
+    case SYNC_OBJECT_TIMER:
+        if (!obj->manual) set_event( obj, NULL );
+        break;
+    case SYNC_OBJECT_SEMAPHORE:
+        release_semaphore( obj, 1, NULL );
+        break;
+    case SYNC_OBJECT_MUTEX:
+        release_mutex( obj, thread, NULL );
+        break;
+    }
+}
+
+
+/***********************************************************************
+ *           Handles
+ */
+
+#define SYNC_BLOCK_SIZE  (65536 / sizeof(struct sync_mapping *))
+#define SYNC_ENTRIES     128  /* due to the memory layout, this covers SYNC_BLOCK_SIZE * 128 fds */
+
+static struct sync_mapping **sync_table[SYNC_ENTRIES];
+static struct sync_mapping *sync_initial_block[SYNC_BLOCK_SIZE];
+
+static inline unsigned int sync_handle_index( HANDLE handle, unsigned int *entry )
+{
+    unsigned int idx = HandleToULong( handle );
+    *entry = idx / SYNC_BLOCK_SIZE;
+    return idx % SYNC_BLOCK_SIZE;
+}
+
+static struct sync_mapping *get_mapping( HANDLE handle )
+{
+    unsigned int entry, idx = sync_handle_index( handle, &entry );
+
+    if (entry >= SYNC_ENTRIES || !sync_table[entry]) return NULL;
+    return sync_table[entry][idx];
+}
+
+static BOOL set_mapping( HANDLE handle, struct sync_mapping *mapping )
+{
+    unsigned int entry, idx = sync_handle_index( handle, &entry );
+
+    if (entry >= SYNC_ENTRIES) return FALSE;
+    if (!sync_table[entry])
+    {
+        struct sync_mapping **block;
+
+        if (!entry) block = sync_initial_block;
+        else if (!(block = RtlAllocateHeap( GetProcessHeap(), HEAP_ZERO_MEMORY,
+                                            SYNC_BLOCK_SIZE * sizeof(*block) ))) return FALSE;
+        if (interlocked_cmpxchg_ptr( (void **)&sync_table[entry], block, NULL ) && entry)
+            RtlFreeHeap( GetProcessHeap(), 0, block );  /* another thread was faster */
+    }
+    sync_table[entry][idx] = mapping;
+    return TRUE;
+}
+
+static struct sync_object *get_object( HANDLE handle, unsigned int type )
+{
+    struct sync_mapping *mapping = get_mapping( handle );
+
+    if (!mapping) return NULL;
+    if (type && mapping->obj->type != type) return NULL;
+    return mapping->obj;
+}
+
+/* status for handles that aren't objects of the expected type */
+static NTSTATUS get_object_error( HANDLE handle )
+{
+    return get_mapping( handle ) ? STATUS_OBJECT_TYPE_MISMATCH : STATUS_INVALID_HANDLE;
+}
+
+/* map the object of an fd, sharing the mapping with the other handles to it */
+static NTSTATUS map_object( int fd, const char *path, BOOL global, struct sync_mapping **ret )
+{
+    struct sync_mapping *mapping;
+    struct stat st;
+    void *ptr;
+
+    if (fstat( fd, &st ) == -1) return FILE_GetNtStatus();
+    if (st.st_size < SYNC_OBJECT_SIZE) return STATUS_OBJECT_TYPE_MISMATCH;
+
+    pthread_mutex_lock( &sync_mutex );
+    for (mapping = sync_mappings; mapping; mapping = mapping->next)
+        if (mapping->dev == st.st_dev && mapping->ino == st.st_ino) break;
+
+    if (mapping) mapping->refs++;
+    else if ((ptr = mmap( NULL, SYNC_OBJECT_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0 )) != MAP_FAILED)
+    {
+        if (!(mapping = RtlAllocateHeap( GetProcessHeap(), 0,
+                                         offsetof( struct sync_mapping, path[strlen(path) + 1] ))))
+        {
+            munmap( ptr, SYNC_OBJECT_SIZE );
+            pthread_mutex_unlock( &sync_mutex );
+            return STATUS_NO_MEMORY;
+        }
+        mapping->obj    = ptr;
+        mapping->dev    = st.st_dev;
+        mapping->ino    = st.st_ino;
+        mapping->refs   = 1;
+        mapping->poll_fd = -1;
+        mapping->pollers = 0;
+        mapping->watched = 0;
+        mapping->timer_fd = -1;
+        mapping->timer_seq = -1;
+        mapping->timer_apc = 0;
+        mapping->global = global;
+        strcpy( mapping->path, path );
+        mapping->next   = sync_mappings;
+        sync_mappings   = mapping;
+    }
+    pthread_mutex_unlock( &sync_mutex );
+
+    if (!mapping) return FILE_GetNtStatus();
+    *ret = mapping;
+    return STATUS_SUCCESS;
+}
+
+static void remove_timer_apc( struct sync_mapping *mapping );
+static void wake_timer_apc_thread(void);
+
+static void unmap_object( struct sync_mapping *mapping )
+{
+    struct sync_mapping **ptr;
+
+    pthread_mutex_lock( &sync_mutex );
+    if (--mapping->refs)
+    {
+        pthread_mutex_unlock( &sync_mutex );
+        return;
+    }
+    for (ptr = &sync_mappings; *ptr; ptr = &(*ptr)->next)
+    {
+        if (*ptr != mapping) continue;
+        *ptr = mapping->next;
+        break;
+    }
+    pthread_mutex_unlock( &sync_mutex );
+
+    if (mapping->timer_apc) remove_timer_apc( mapping );
+    if (mapping->poll_fd != -1) close( mapping->poll_fd );
+    if (mapping->timer_fd != -1) close( mapping->timer_fd );
+    munmap( mapping->obj, SYNC_OBJECT_SIZE );
+    RtlFreeHeap( GetProcessHeap(), 0, mapping );
+}
+
+
+/***********************************************************************
+ *           Namespace
+ *
+ * Names are resolved into the shared directory as otowi-<uid>-<name> for
+ * the session namespace and otowi-global-<name> for Global\ names. Every
+ * handle to a named object holds a shared flock on its file, and the last
+ * one closed removes the name; a lock file per namespace serializes that
+ * with the lookups. Since flocks go away with the process, names don't
+ * leak when a process crashes.
+ *
+ * A flock belongs to the open file, not to the fd, so this needs every
+ * handle to have an open file of its own. Opening by name gives one, and
+ * the child of a fork gets new ones before it runs, see sync_fork_prepare.
+ */
+
+static int namespace_lock_fd[2] = { -1, -1 };
+
+static int get_namespace_lock( BOOL global )
+{
+    char path[64];
+    int fd;
+
+    if ((fd = namespace_lock_fd[global]) != -1) return fd;
+
+    if (global) snprintf( path, sizeof(path), "%s/otowi-global.lock", sync_dir );
+    else snprintf( path, sizeof(path), "%s/otowi-%u.lock", sync_dir, (unsigned int)getuid() );
+    if ((fd = open( path, O_RDONLY | O_CREAT | O_CLOEXEC, global ? 0666 : 0600 )) == -1) return -1;
+    if (interlocked_cmpxchg( &namespace_lock_fd[global], fd, -1 ) != -1)
+    {
+        close( fd );  /* another thread was faster */
+        fd = namespace_lock_fd[global];
+    }
+    return fd;
+}
+
+static int lock_namespace( BOOL global )
+{
+    int fd = get_namespace_lock( global );
+
+    if (fd != -1) while (flock( fd, LOCK_EX ) == -1 && errno == EINTR);
+    return fd;
+}
+
+static void unlock_namespace( int fd )
+{
+    if (fd != -1) flock( fd, LOCK_UN );
+}
+
+static BOOL name_has_prefix( const WCHAR **name, unsigned int *len, const WCHAR *prefix, unsigned int prefix_len )
+{
+    if (*len < prefix_len || memcmp( *name, prefix, prefix_len * sizeof(WCHAR) )) return FALSE;
+    *name += prefix_len;
+    *len -= prefix_len;
+    return TRUE;
+}
+
+/* skip a session number followed by a backslash */
+static BOOL skip_session_id( const WCHAR **name, unsigned int *len )
+{
+    unsigned int i;
+
+    for (i = 0; i < *len && isdigitW( (*name)[i] ); i++);
+    if (!i || i == *len || (*name)[i] != '\\') return FALSE;
+    *name += i + 1;
+    *len -= i + 1;
+    return TRUE;
+}
+
+/* build the unix name of an object, *ret is NULL for unnamed objects */
+static NTSTATUS get_object_unix_name( const OBJECT_ATTRIBUTES *attr, char **ret, BOOL *global )
+{
+    static const WCHAR sessionsW[] = {'\\','S','e','s','s','i','o','n','s','\\'};
+    static const WCHAR basenamedW[] = {'\\','B','a','s','e','N','a','m','e','d','O','b','j','e','c','t','s','\\'};
+    static const WCHAR basenamed_relW[] = {'B','a','s','e','N','a','m','e','d','O','b','j','e','c','t','s','\\'};
+    static const WCHAR globalW[] = {'G','l','o','b','a','l','\\'};
+    static const WCHAR localW[] = {'L','o','c','a','l','\\'};
+    static const WCHAR sessionW[] = {'S','e','s','s','i','o','n','\\'};
+    const WCHAR *name;
+    unsigned int i, len, pos;
+    char *utf8, *unix_name;
+    int utf8_len;
+
+    *ret = NULL;
+    *global = FALSE;
+    if (!attr || !attr->ObjectName || !attr->ObjectName->Length) return STATUS_SUCCESS;
+
+    name = attr->ObjectName->Buffer;
+    len  = attr->ObjectName->Length / sizeof(WCHAR);
+    if (attr->RootDirectory) FIXME( "root directory %p not supported, using the session namespace\n",
+                                    attr->RootDirectory );
+
+    if (name_has_prefix( &name, &len, sessionsW, ARRAY_SIZE(sessionsW) ))
+    {
+        if (!skip_session_id( &name, &len ) ||
+            !name_has_prefix( &name, &len, basenamed_relW, ARRAY_SIZE(basenamed_relW) ))
+            return STATUS_OBJECT_PATH_NOT_FOUND;
+    }
+    else if (name_has_prefix( &name, &len, basenamedW, ARRAY_SIZE(basenamedW) )) *global = TRUE;
+
+    if (name_has_prefix( &name, &len, globalW, ARRAY_SIZE(globalW) )) *global = TRUE;
+    else if (name_has_prefix( &name, &len, localW, ARRAY_SIZE(localW) )) *global = FALSE;
+    else if (name_has_prefix( &name, &len, sessionW, ARRAY_SIZE(sessionW) ))
+    {
+        if (!skip_session_id( &name, &len )) return STATUS_OBJECT_PATH_NOT_FOUND;
+        *global = FALSE;
+    }
+
+    if (!len) return STATUS_OBJECT_NAME_INVALID;
+    for (i = 0; i < len; i++) if (name[i] == '\\') return STATUS_OBJECT_PATH_NOT_FOUND;
+
+    utf8_len = wine_utf8_wcstombs( 0, name, len, NULL, 0 );
+    if (!(utf8 = RtlAllocateHeap( GetProcessHeap(), 0, utf8_len ))) return STATUS_NO_MEMORY;
+    wine_utf8_wcstombs( 0, name, len, utf8, utf8_len );
+
+    /* room for the prefix and for escaping every byte */
+    if (!(unix_name = RtlAllocateHeap( GetProcessHeap(), 0, sizeof(sync_dir) + 32 + 3 * utf8_len )))
+    {
+        RtlFreeHeap( GetProcessHeap(), 0, utf8 );
+        return STATUS_NO_MEMORY;
+    }
+    if (*global) pos = sprintf( unix_name, "%s/otowi-global-", sync_dir );
+    else pos = sprintf( unix_name, "%s/otowi-%u-", sync_dir, (unsigned int)getuid() );
+
+    for (i = 0; i < utf8_len; i++)
+    {
+        unsigned char ch = utf8[i];
+        if (ch < 0x20 || ch == '/' || ch == '%') pos += sprintf( unix_name + pos, "%%%02x", ch );
+        else unix_name[pos++] = ch;
+    }
+    unix_name[pos] = 0;
+    RtlFreeHeap( GetProcessHeap(), 0, utf8 );
+
+    if (pos - strlen( sync_dir ) - 1 > NAME_MAX)
+    {
+        RtlFreeHeap( GetProcessHeap(), 0, unix_name );
+        return STATUS_NAME_TOO_LONG;
+    }
+    *ret = unix_name;
+    return STATUS_SUCCESS;
+}
+
+static int create_anonymous_file(void)
+{
+    int fd;
+
+#if defined(__linux__) && defined(__NR_memfd_create)
+    if ((fd = syscall( __NR_memfd_create, "otowi-sync", 1 /* MFD_CLOEXEC */ )) != -1) return fd;
+#endif
+#ifdef O_TMPFILE
+    if ((fd = open( sync_dir, O_RDWR | O_TMPFILE | O_CLOEXEC, 0600 )) != -1) return fd;
+#endif
+    {
+        char path[64];
+        static int counter;
+
+        snprintf( path, sizeof(path), "%s/otowi-%u-%x.tmp", sync_dir, (unsigned int)getpid(),
+                  interlocked_xchg_add( &counter, 1 ) );
+        if ((fd = open( path, O_RDWR | O_CREAT | O_EXCL | O_CLOEXEC, 0600 )) != -1) unlink( path );
+    }
+    return fd;
+}
+
+/* fill a new backing file, the type is written last so that a half created object can't be used */
+static NTSTATUS init_object_file( int fd, const struct sync_object *init )
+{
+    struct sync_object *obj;
+
+    if (ftruncate( fd, SYNC_OBJECT_SIZE ) == -1) return FILE_GetNtStatus();
+    obj = mmap( NULL, SYNC_OBJECT_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0 );
+    if (obj == MAP_FAILED) return FILE_GetNtStatus();
+    obj->state   = init->state;
+    obj->waiters = 0;
+    obj->max     = init->max;
+    obj->manual  = init->manual;
+    obj->count   = init->count;
+    __sync_synchronize();
+    obj->type    = init->type;
+    munmap( obj, SYNC_OBJECT_SIZE );
+    return STATUS_SUCCESS;
+}
+
+static void init_sync_fork(void);
+static void watcher_fork_child(void);
+
+/* create or open an object, init is NULL to only open an existing one */
+static NTSTATUS get_object_handle( HANDLE *handle, const OBJECT_ATTRIBUTES *attr,
+                                   unsigned int type, const struct sync_object *init )
+{
+    struct sync_mapping *mapping = NULL;
+    int fd, lock = -1, flags = O_RDWR;
+    NTSTATUS status = STATUS_SUCCESS;
+    BOOL global;
+    char *path;
+
+    *handle = 0;
+    if ((status = get_object_unix_name( attr, &path, &global ))) return status;
+    if (!(attr && (attr->Attributes & OBJ_INHERIT))) flags |= O_CLOEXEC;
+
+    if (!path)
+    {
+        if (!init) return STATUS_OBJECT_PATH_SYNTAX_BAD;
+        if ((fd = create_anonymous_file()) == -1) return FILE_GetNtStatus();
+        if (!(flags & O_CLOEXEC)) fcntl( fd, F_SETFD, 0 );
+        if (!(status = init_object_file( fd, init ))) status = map_object( fd, "", FALSE, &mapping );
+    }
+    else
+    {
+        pthread_once( &sync_fork_once, init_sync_fork );
+        lock = lock_namespace( global );
+        fd = -1;
+        if (init && (fd = open( path, flags | O_CREAT | O_EXCL, global ? 0666 & ~FILE_umask : 0600 )) != -1)
+        {
+            if (global) fchmod( fd, 0666 & ~FILE_umask );
+            status = init_object_file( fd, init );
+        }
+        else if (init && errno != EEXIST) status = FILE_GetNtStatus();
+        else if (init && !(attr->Attributes & OBJ_OPENIF)) status = STATUS_OBJECT_NAME_COLLISION;
+        else if ((fd = open( path, flags )) == -1)
+            status = (errno == ENOENT) ? STATUS_OBJECT_NAME_NOT_FOUND : FILE_GetNtStatus();
+        else if (init) status = STATUS_OBJECT_NAME_EXISTS;
+
+        if (!is_error(status))
+        {
+            NTSTATUS map_status = map_object( fd, path, global, &mapping );
+            if (map_status) status = map_status;
+        }
+        if (!is_error(status) && mapping->obj->type != type)
+        {
+            unmap_object( mapping );
+            status = STATUS_OBJECT_TYPE_MISMATCH;
+        }
+        if (!is_error(status)) flock( fd, LOCK_SH );
+        unlock_namespace( lock );
+        RtlFreeHeap( GetProcessHeap(), 0, path );
+    }
+
+    if (!is_error(status) && !set_mapping( ULongToHandle( fd ), mapping ))
+    {
+        unmap_object( mapping );
+        status = STATUS_TOO_MANY_OPENED_FILES;
+    }
+    if (is_error(status))
+    {
+        if (fd != -1) close( fd );
+        return status;
+    }
+    *handle = ULongToHandle( fd );
+    return status;
+}
+
+/***********************************************************************
+ *           sync_close_object
+ *
+ * Release the object of a handle that is being closed. The name of a
+ * named object goes away with its last handle.
+ */
+void sync_close_object( HANDLE handle )
+{
+    struct sync_mapping *mapping = get_mapping( handle );
+    int fd = HandleToULong( handle ), lock;
+    BOOL timer_apc;
+
+    if (!mapping) return;
+    set_mapping( handle, NULL );
+
+    if (mapping->path[0])
+    {
+        lock = lock_namespace( mapping->global );
+        if (!flock( fd, LOCK_EX | LOCK_NB )) unlink( mapping->path );
+        unlock_namespace( lock );
+    }
+    timer_apc = mapping->timer_apc;
+    unmap_object( mapping );
+    /* the timer thread holds on to the mapping while it sleeps, let it go */
+    if (timer_apc) wake_timer_apc_thread();
+}
+
+/* handle of a named object and the new open file the child of a fork puts in its place */
+struct sync_fork_fd
+{
+    int fd;
+    int new_fd;
+};
+
+static struct sync_fork_fd *sync_fork_fds;
+static unsigned int sync_fork_count;
+
+/* Open the file of each handle to a named object again and lock it, before
+ * the fork, so that the child never has a handle without a lock of its own. */
+static void sync_fork_prepare(void)
+{
+    struct sync_mapping *mapping;
+    struct sync_fork_fd *new_fds;
+    unsigned int entry, idx, size = 0;
+    char path[32];
+    int fd, new_fd;
+
+    pthread_mutex_lock( &sync_mutex );
+    for (entry = 0; entry < SYNC_ENTRIES; entry++)
+    {
+        if (!sync_table[entry]) continue;
+        for (idx = 0; idx < SYNC_BLOCK_SIZE; idx++)
+        {
+            if (!(mapping = sync_table[entry][idx]) || !mapping->path[0]) continue;
+            if (sync_fork_count == size)
+            {
+                size = max( 2 * size, 16 );
+                if (sync_fork_fds)
+                    new_fds = RtlReAllocateHeap( GetProcessHeap(), 0, sync_fork_fds, size * sizeof(*new_fds) );
+                else
+                    new_fds = RtlAllocateHeap( GetProcessHeap(), 0, size * sizeof(*new_fds) );
+                if (!new_fds) return;
+                sync_fork_fds = new_fds;
+            }
+            fd = entry * SYNC_BLOCK_SIZE + idx;
+            sprintf( path, "/proc/self/fd/%d", fd );
+            if ((new_fd = open( path, O_RDWR | O_CLOEXEC )) == -1) continue;
+            flock( new_fd, LOCK_SH );
+            sync_fork_fds[sync_fork_count].fd = fd;
+            sync_fork_fds[sync_fork_count].new_fd = new_fd;
+            sync_fork_count++;
+        }
+    }
+}
+
+static void sync_fork_parent(void)
+{
+    unsigned int i;
+
+    for (i = 0; i < sync_fork_count; i++) close( sync_fork_fds[i].new_fd );
+    RtlFreeHeap( GetProcessHeap(), 0, sync_fork_fds );
+    sync_fork_fds = NULL;
+    sync_fork_count = 0;
+    pthread_mutex_unlock( &sync_mutex );
+}
+
+static void sync_fork_child(void)
+{
+    unsigned int i;
+    int flags;
+
+    for (i = 0; i < sync_fork_count; i++)
+    {
+        flags = fcntl( sync_fork_fds[i].fd, F_GETFD );
+        dup2( sync_fork_fds[i].new_fd, sync_fork_fds[i].fd );
+        fcntl( sync_fork_fds[i].fd, F_SETFD, flags );
+        close( sync_fork_fds[i].new_fd );
+    }
+    RtlFreeHeap( GetProcessHeap(), 0, sync_fork_fds );
+    sync_fork_fds = NULL;
+    sync_fork_count = 0;
+
+    /* the lock files would be shared with the parent as well */
+    for (i = 0; i < ARRAY_SIZE(namespace_lock_fd); i++)
+    {
+        if (namespace_lock_fd[i] == -1) continue;
+        close( namespace_lock_fd[i] );
+        namespace_lock_fd[i] = -1;
+    }
+    watcher_fork_child();
+    pthread_mutex_unlock( &sync_mutex );
+}
+
+static void init_sync_fork(void)
+{
+    pthread_atfork( sync_fork_prepare, sync_fork_parent, sync_fork_child );
+}
+
+
+/***********************************************************************
+ *           Timers
+ *
+ * The schedule of a timer is in the shared object, and whoever notices
+ * that it's due first signals the timer, whatever process it's in. To
+ * sleep until then, each process arms a timerfd of its own from the
+ * schedule; the kernel re-arms it for periodic timers.
+ *
+ * The APC routine of a timer goes to the thread that set it. A thread of
+ * the process sleeps on the timerfds of such timers, so that the APC is
+ * queued when the timer fires even if nobody waits for it. Like the
+ * signaling, the APC is queued by the process that notices the timer is
+ * due, so a named timer set in two processes only calls one of them.
+ */
+
+struct timer_apc
+{
+    struct timer_apc    *next;
+    struct sync_mapping *mapping;
+    PTIMER_APC_ROUTINE   func;
+    void                *arg;
+    struct sync_thread  *thread;  /* thread that set the timer, it gets the APCs */
+};
+
+#define MAX_TIMER_APCS 64  /* timers watched by the timer thread */
+
+static struct timer_apc *timer_apcs;
+static pthread_mutex_t timer_apc_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_once_t timer_apc_once = PTHREAD_ONCE_INIT;
+static int timer_apc_wake_fd = -1;  /* makes the timer thread look at the list again */
+
+static NTSTATUS queue_apc( struct sync_thread *thread, PNTAPCFUNC func,
+                           ULONG_PTR arg1, ULONG_PTR arg2, ULONG_PTR arg3 );
+
+static void lock_timer( struct sync_object *obj )
+{
+    while (interlocked_cmpxchg( &obj->timer_lock, 1, 0 )) sched_yield();
+}
+
+static void unlock_timer( struct sync_object *obj )
+{
+    interlocked_xchg( &obj->timer_lock, 0 );
+}
+
+/* queue the APC routine of a timer that fired to the thread that set it */
+static void queue_timer_apc( struct sync_mapping *mapping )
+{
+    struct timer_apc *apc;
+    LARGE_INTEGER now;
+
+    NtQuerySystemTime( &now );
+    pthread_mutex_lock( &timer_apc_mutex );
+    for (apc = timer_apcs; apc; apc = apc->next)
+    {
+        if (apc->mapping != mapping) continue;
+        queue_apc( apc->thread, (PNTAPCFUNC)apc->func, (ULONG_PTR)apc->arg, now.u.LowPart, now.u.HighPart );
+        break;
+    }
+    pthread_mutex_unlock( &timer_apc_mutex );
+}
+
+/* signal the timer if it's due, returns TRUE if it is still running */
+static BOOL fire_timer( struct sync_mapping *mapping )
+{
+    struct sync_object *obj = mapping->obj;
+    ULONGLONG ticks;
+    LONGLONG now;
+    BOOL fired = FALSE, active;
+
+    if (!*(volatile int *)&obj->timer_active) return FALSE;
+
+    /* consume the expirations before looking at the clock, so none of them gets lost */
+    if (mapping->timer_fd != -1) read( mapping->timer_fd, &ticks, sizeof(ticks) );
+
+    lock_timer( obj );
+    if ((active = obj->timer_active) && (now = get_clock_ns( obj->timer_clock )) >= obj->timer_due)
+    {
+        if (obj->timer_period)
+            obj->timer_due += ((now - obj->timer_due) / obj->timer_period + 1) * obj->timer_period;
+        else
+            obj->timer_active = active = FALSE;
+        fired = TRUE;
+    }
+    unlock_timer( obj );
+
+    if (fired)
+    {
+        set_event( obj, NULL );
+        if (mapping->timer_apc) queue_timer_apc( mapping );
+    }
+    return active;
+}
+
+/* make the timerfd of this process follow the schedule of the timer */
+static void arm_timer( struct sync_mapping *mapping )
+{
+    struct sync_object *obj = mapping->obj;
+    struct itimerspec spec;
+    int seq, clock;
+
+    if (mapping->timer_seq == *(volatile int *)&obj->timer_seq) return;
+
+    memset( &spec, 0, sizeof(spec) );
+    lock_timer( obj );
+    seq = obj->timer_seq;
+    clock = obj->timer_clock;
+    if (obj->timer_active)
+    {
+        /* a zero value would disarm the timerfd */
+        spec.it_value.tv_sec     = obj->timer_due / 1000000000;
+        spec.it_value.tv_nsec    = max( obj->timer_due % 1000000000, 1 );
+        spec.it_interval.tv_sec  = obj->timer_period / 1000000000;
+        spec.it_interval.tv_nsec = obj->timer_period % 1000000000;
+    }
+    unlock_timer( obj );
+
+    pthread_mutex_lock( &sync_mutex );
+    if (mapping->timer_fd != -1 && mapping->timer_clock != clock)
+    {
+        close( mapping->timer_fd );
+        mapping->timer_fd = -1;
+    }
+    if (mapping->timer_fd == -1)
+    {
+        mapping->timer_fd = create_timerfd( clock );
+        mapping->timer_clock = clock;
+    }
+    if (mapping->timer_fd != -1) set_timerfd( mapping->timer_fd, &spec );
+    mapping->timer_seq = seq;
+    pthread_mutex_unlock( &sync_mutex );
+}
+
+/* sleep on the timerfds of the timers with an APC routine, and fire them */
+static void *timer_apc_thread( void *arg )
+{
+    struct sync_mapping *mappings[MAX_TIMER_APCS];
+    struct pollfd pfd[MAX_TIMER_APCS + 1];
+    struct timer_apc *apc;
+    ULONGLONG value;
+    int i, count;
+
+    pfd[0].fd = timer_apc_wake_fd;
+    pfd[0].events = POLLIN;
+    for (;;)
+    {
+        /* keep the mappings alive while we use them, they go away when their last handle is closed */
+        count = 0;
+        pthread_mutex_lock( &timer_apc_mutex );
+        pthread_mutex_lock( &sync_mutex );
+        for (apc = timer_apcs; apc && count < MAX_TIMER_APCS; apc = apc->next)
+        {
+            apc->mapping->refs++;
+            mappings[count++] = apc->mapping;
+        }
+        pthread_mutex_unlock( &sync_mutex );
+        pthread_mutex_unlock( &timer_apc_mutex );
+
+        for (i = 0; i < count; i++)
+        {
+            fire_timer( mappings[i] );
+            arm_timer( mappings[i] );
+            pfd[i + 1].fd = mappings[i]->timer_fd;
+            pfd[i + 1].events = POLLIN;
+        }
+
+        /* the timerfds stay open until the poll is done, closing a timer wakes us up */
+        if (poll( pfd, count + 1, -1 ) == -1 && errno != EINTR) break;
+        if (pfd[0].revents) read( timer_apc_wake_fd, &value, sizeof(value) );
+        for (i = 0; i < count; i++) unmap_object( mappings[i] );
+    }
+    ERR( "poll failed, errno %d\n", errno );
+    return NULL;
+}
+
+static void start_timer_apc_thread(void)
+{
+    pthread_t thread;
+
+    if ((timer_apc_wake_fd = create_eventfd()) == -1 ||
+        pthread_create( &thread, NULL, timer_apc_thread, NULL ))
+    {
+        WARN( "no timer thread, timer APCs are only queued while waiting for the timer\n" );
+        return;
+    }
+    pthread_detach( thread );
+}
+
+static void wake_timer_apc_thread(void)
+{
+    ULONGLONG value = 1;
+
+    if (timer_apc_wake_fd != -1) write( timer_apc_wake_fd, &value, sizeof(value) );
+}
+
+/* set the APC routine of a timer, the current thread gets the APCs */
+static NTSTATUS set_timer_apc( struct sync_mapping *mapping, PTIMER_APC_ROUTINE func, void *arg )
+{
+    struct sync_thread *old_thread = NULL;
+    struct timer_apc *apc;
+
+    pthread_once( &timer_apc_once, start_timer_apc_thread );
+
+    pthread_mutex_lock( &timer_apc_mutex );
+    for (apc = timer_apcs; apc; apc = apc->next) if (apc->mapping == mapping) break;
+    if (!apc)
+    {
+        if (!(apc = RtlAllocateHeap( GetProcessHeap(), 0, sizeof(*apc) )))
+        {
+            pthread_mutex_unlock( &timer_apc_mutex );
+            return STATUS_NO_MEMORY;
+        }
+        apc->mapping = mapping;
+        apc->thread  = NULL;
+        apc->next    = timer_apcs;
+        timer_apcs   = apc;
+    }
+    old_thread  = apc->thread;
+    apc->func   = func;
+    apc->arg    = arg;
+    apc->thread = sync_get_current_thread();
+    mapping->timer_apc = 1;
+    pthread_mutex_unlock( &timer_apc_mutex );
+
+    if (old_thread) sync_release_thread( old_thread );
+    wake_timer_apc_thread();
+    return STATUS_SUCCESS;
+}
+
+static void remove_timer_apc( struct sync_mapping *mapping )
+{
+    struct timer_apc *apc = NULL, **ptr;
+
+    pthread_mutex_lock( &timer_apc_mutex );
+    for (ptr = &timer_apcs; *ptr; ptr = &(*ptr)->next)
+    {
+        if ((*ptr)->mapping != mapping) continue;
+        apc = *ptr;
+        *ptr = apc->next;
+        break;
+    }
+    mapping->timer_apc = 0;
+    pthread_mutex_unlock( &timer_apc_mutex );
+
+    if (!apc) return;
+    sync_release_thread( apc->thread );
+    RtlFreeHeap( GetProcessHeap(), 0, apc );
+    wake_timer_apc_thread();
+}
+
+/* set or cancel (when == NULL) a timer */
+static NTSTATUS set_timer( HANDLE handle, const LARGE_INTEGER *when, PTIMER_APC_ROUTINE callback,
+                           void *callback_arg, ULONG period, ULONG tolerable_delay, BOOLEAN *state )
+{
+    struct sync_mapping *mapping = get_mapping( handle );
+    struct sync_object *obj;
+    NTSTATUS status;
+    LONG prev;
+
+    if (!mapping || mapping->obj->type != SYNC_OBJECT_TIMER) return get_object_error( handle );
+    obj = mapping->obj;
+
+    /* an APC routine only applies to the schedule it was given with */
+    if (when && callback)
+    {
+        if ((status = set_timer_apc( mapping, callback, callback_arg ))) return status;
+    }
+    else if (mapping->timer_apc) remove_timer_apc( mapping );
+
+    lock_timer( obj );
+    if (when)
+    {
+        if (when->QuadPart > 0)  /* absolute system time, follows changes of the wall clock */
+        {
+            obj->timer_clock = CLOCK_REALTIME;
+            obj->timer_due   = (max( when->QuadPart, TICKS_1601_TO_1970 ) - TICKS_1601_TO_1970) * 100;
+        }
+        else
+        {
+            obj->timer_clock = CLOCK_MONOTONIC;
+            obj->timer_due   = get_clock_ns( CLOCK_MONOTONIC ) - when->QuadPart * 100;
+        }
+        obj->timer_period = (LONGLONG)period * 1000000;
+        obj->timer_slack  = (LONGLONG)tolerable_delay * 1000000;
+    }
+    obj->timer_active = (when != NULL);
+    obj->timer_seq++;
+    unlock_timer( obj );
+
+    /* setting a timer resets it, cancelling it leaves its state alone */
+    if (when) reset_event( obj, &prev );
+    else prev = obj->state & 1;
+    if (state) *state = prev;
+
+    arm_timer( mapping );
+    /* wake up the waits of this process, they have to look at the new schedule */
+    if (obj->waiters) wake_object( obj, INT_MAX );
+    if (mapping->timer_apc) wake_timer_apc_thread();
+    return STATUS_SUCCESS;
+}
+
+
+/***********************************************************************
+ *           APCs
+ *
+ * The TEB is shared by all threads here, so the APC queue of a thread
+ * hangs off its sync_thread. Queuing is a lock-free push; the waits of
+ * an alertable thread also sleep on apc_seq (or poll apc_fd) to notice it.
+ */
+
+static NTSTATUS queue_apc( struct sync_thread *thread, PNTAPCFUNC func,
+                           ULONG_PTR arg1, ULONG_PTR arg2, ULONG_PTR arg3 )
+{
+    struct sync_apc *apc;
+    ULONGLONG value = 1;
+    int fd;
+
+    if (!(apc = RtlAllocateHeap( GetProcessHeap(), 0, sizeof(*apc) ))) return STATUS_NO_MEMORY;
+    apc->func = func;
+    apc->arg1 = arg1;
+    apc->arg2 = arg2;
+    apc->arg3 = arg3;
+    do apc->next = *(struct sync_apc * volatile *)&thread->apcs;
+    while (interlocked_cmpxchg_ptr( (void **)&thread->apcs, apc, apc->next ) != apc->next);
+    interlocked_xchg_add( &thread->apc_seq, 1 );
+
+    if (*(volatile int *)&thread->alertable)
+    {
+        futex_wake( &thread->apc_seq, 1 );
+        if ((fd = *(volatile int *)&thread->apc_fd) != -1) write( fd, &value, sizeof(value) );
+    }
+    return STATUS_SUCCESS;
+}
+
+/* call the pending APCs of the thread in the order they were queued */
+static BOOL call_apcs( struct sync_thread *thread )
+{
+    struct sync_apc *list, *apc, *next;
+    BOOL called = FALSE;
+
+    while ((list = interlocked_xchg_ptr( (void **)&thread->apcs, NULL )))
+    {
+        for (apc = NULL; list; list = next)
+        {
+            next = list->next;
+            list->next = apc;
+            apc = list;
+        }
+        for (; apc; apc = next)
+        {
+            next = apc->next;
+            apc->func( apc->arg1, apc->arg2, apc->arg3 );
+            RtlFreeHeap( GetProcessHeap(), 0, apc );
+        }
+        called = TRUE;
+    }
+    return called;
+}
+
+static inline BOOL apcs_pending( struct sync_thread *thread )
+{
+    return *(struct sync_apc * volatile *)&thread->apcs != NULL;
+}
+
+/* get the eventfd that wakes up the polls of an alertable thread */
+static int get_apc_fd( struct sync_thread *thread )
+{
+    /* published before the queue is checked, see queue_apc */
+    if (thread->apc_fd == -1) interlocked_xchg( &thread->apc_fd, create_eventfd() );
+    return thread->apc_fd;
+}
+
+
+/***********************************************************************
+ *           sync_queue_apc
+ *
+ * Queue an APC to a thread referenced with sync_get_current_thread, from
+ * any thread. The APC is called in the next alertable wait of that thread.
+ */
+NTSTATUS sync_queue_apc( struct sync_thread *thread, PNTAPCFUNC func,
+                         ULONG_PTR arg1, ULONG_PTR arg2, ULONG_PTR arg3 )
+{
+    return queue_apc( thread, func, arg1, arg2, arg3 );
+}
+
+
+/***********************************************************************
+ *           sync_delay_alertable
+ *
+ * Alertable NtDelayExecution: sleep until the timeout or an APC.
+ */
+NTSTATUS sync_delay_alertable( const LARGE_INTEGER *timeout )
+{
+    struct sync_thread *thread = get_sync_thread();
+    struct timespec deadline;
+    clockid_t clock = CLOCK_MONOTONIC;
+    BOOL has_deadline = get_deadline( timeout, &deadline, &clock );
+    NTSTATUS ret = STATUS_SUCCESS;
+    int prev, seq;
+
+    prev = interlocked_xchg( &thread->alertable, 1 );
+    for (;;)
+    {
+        seq = *(volatile int *)&thread->apc_seq;
+        if (apcs_pending( thread ) && call_apcs( thread ))
+        {
+            ret = STATUS_USER_APC;
+            break;
+        }
+        if (timeout && !timeout->QuadPart) break;
+        if (has_deadline && deadline_passed( &deadline, clock )) break;
+        futex_wait_until( &thread->apc_seq, seq, has_deadline ? &deadline : NULL, clock );
+    }
+    thread->alertable = prev;
+    return ret;
+}
+
+
+/***********************************************************************
+ *           Mixed waits
+ */
+
+#define SYNC_POLL_SLICE  10  /* ms between checks of objects that nothing wakes us for */
+#define MAX_WATCHED      127 /* futex_waitv takes 128 futexes, one is for the watcher itself */
+
+static int watcher_state;   /* 0 not started, 1 running, -1 unavailable */
+static int watcher_seq;     /* futex word, changed when a mixed wait starts */
+static int watched_count;   /* number of mappings with mixed waits */
+
+/* Other processes and the kernel (for the mutexes of dead threads) only
+ * wake the futex of an object, not the eventfds of our mixed waits. This
+ * thread sleeps on the futexes of all the objects with mixed waits and
+ * passes the changes on to their eventfds. */
+static void *watcher_thread( void *arg )
+{
+    struct futex_waitv_ waitv[MAX_WATCHED + 1];
+    BOOL single[MAX_WATCHED];
+    struct sync_mapping *mapping;
+    ULONGLONG value;
+    int count, val, ret;
+
+    for (;;)
+    {
+        waitv[0].val      = *(volatile int *)&watcher_seq;
+        waitv[0].uaddr    = (ULONG_PTR)&watcher_seq;
+        waitv[0].flags    = FUTEX2_SIZE_U32_;
+        waitv[0].reserved = 0;
+        count = 1;
+
+        /* the value we sleep on is the one we last told the pollers about, so that
+         * nothing is missed between their own check of the object and our wait */
+        pthread_mutex_lock( &sync_mutex );
+        for (mapping = sync_mappings; mapping; mapping = mapping->next)
+        {
+            if (!mapping->pollers || count > MAX_WATCHED)
+            {
+                mapping->watched = 0;
+                continue;
+            }
+            val = prepare_wait( mapping->obj );
+            if ((!mapping->watched || val != mapping->watch_state) && mapping->poll_fd != -1)
+            {
+                value = mapping->pollers;
+                write( mapping->poll_fd, &value, sizeof(value) );
+            }
+            mapping->watched     = 1;
+            mapping->watch_state = val;
+            single[count - 1]     = wakes_single_thread( mapping->obj );
+            waitv[count].val      = (unsigned int)val;
+            waitv[count].uaddr    = (ULONG_PTR)&mapping->obj->state;
+            waitv[count].flags    = FUTEX2_SIZE_U32_;
+            waitv[count].reserved = 0;
+            count++;
+        }
+        pthread_mutex_unlock( &sync_mutex );
+
+        /* a closed object stays in the list until the next wake-up, its futex key is still valid */
+        ret = futex_waitv( waitv, count, NULL, CLOCK_MONOTONIC );
+        if (ret == -1 && errno != EAGAIN && errno != EINTR && errno != EFAULT) break;
+
+        /* we may have taken the only wake-up of a thread sleeping on the futex */
+        if (ret > 0 && single[ret - 1]) futex_wake( (int *)(ULONG_PTR)waitv[ret].uaddr, 1 );
+    }
+    ERR( "futex_waitv failed, errno %d\n", errno );
+    pthread_mutex_lock( &sync_mutex );
+    watcher_state = -1;
+    pthread_mutex_unlock( &sync_mutex );
+    return NULL;
+}
+
+/* the thread doesn't survive a fork, start a new one in the child when needed */
+static void watcher_fork_child(void)
+{
+    struct sync_mapping *mapping;
+
+    if (watcher_state == 1) watcher_state = 0;
+    for (mapping = sync_mappings; mapping; mapping = mapping->next) mapping->watched = 0;
+}
+
+/* make sure that the watcher sees a new mixed wait, called with sync_mutex held;
+ * returns FALSE if the wait has to check the objects periodically instead */
+static BOOL watch_objects(void)
+{
+    pthread_t thread;
+
+    if (!watcher_state)
+    {
+        /* an empty wait only fails with EINVAL if the kernel has futex_waitv */
+        watcher_state = -1;
+        if (futex_waitv( NULL, 0, NULL, CLOCK_MONOTONIC ) == -1 && errno == ENOSYS)
+            WARN( "no futex_waitv, mixed waits check the objects every %u ms\n", SYNC_POLL_SLICE );
+        else if (pthread_create( &thread, NULL, watcher_thread, NULL ))
+            WARN( "no watcher thread, mixed waits check the objects every %u ms\n", SYNC_POLL_SLICE );
+        else
+        {
+            /* the fork handlers keep sync_mutex, which the thread takes all the time */
+            pthread_once( &sync_fork_once, init_sync_fork );
+            pthread_detach( thread );
+            watcher_state = 1;
+        }
+    }
+    if (watcher_state != 1) return FALSE;
+    interlocked_xchg_add( &watcher_seq, 1 );
+    futex_wake( &watcher_seq, 1 );
+    return watched_count <= MAX_WATCHED;
+}
+
+/* get the eventfd of an object for a mixed wait and count the wait as a poller;
+ * watched is set if changes from other processes also write the eventfd */
+static int add_poller( struct sync_mapping *mapping, BOOL *watched )
+{
+    int fd;
+
+    pthread_mutex_lock( &sync_mutex );
+    if (mapping->poll_fd == -1) mapping->poll_fd = create_eventfd();
+    fd = mapping->poll_fd;
+    if (!mapping->pollers++) watched_count++;
+    pthread_mutex_unlock( &sync_mutex );
+
+    /* pollers count as waiters, so that releases wake them */
+    interlocked_xchg_add( &sync_pollers, 1 );
+    interlocked_xchg_add( &mapping->obj->waiters, 1 );
+    prepare_wait( mapping->obj );
+
+    /* and the watcher, now that releases wake the futex */
+    pthread_mutex_lock( &sync_mutex );
+    *watched = fd != -1 && watch_objects();
+    pthread_mutex_unlock( &sync_mutex );
+    return fd;
+}
+
+static void remove_poller( struct sync_mapping *mapping )
+{
+    interlocked_xchg_add( &mapping->obj->waiters, -1 );
+    interlocked_xchg_add( &sync_pollers, -1 );
+    pthread_mutex_lock( &sync_mutex );
+    if (!--mapping->pollers) watched_count--;
+    pthread_mutex_unlock( &sync_mutex );
+}
+
+/* poll the fds of the handles, then consume the notifications of the objects */
+static int poll_handles( struct pollfd *pfd, int nfds, struct sync_mapping **mappings, DWORD count, int ms )
+{
+    ULONGLONG value;
+    int i, ret;
+
+    for (i = 0; i < nfds; i++) pfd[i].revents = 0;
+    if ((ret = poll( pfd, nfds, ms )) <= 0) return ret;
+    for (i = 0; i < count; i++)
+        if (mappings[i] && (pfd[i].revents & POLLIN)) read( pfd[i].fd, &value, sizeof(value) );
+    return ret;
+}
+
+/* get the time until a timer is due, -1 if it isn't running */
+static int get_timer_wait( struct sync_object *obj )
+{
+    LONGLONG left;
+
+    if (!*(volatile int *)&obj->timer_active) return -1;
+    left = *(volatile LONGLONG *)&obj->timer_due - get_clock_ns( obj->timer_clock );
+    return left <= 0 ? 0 : min( (left + 999999) / 1000000, INT_MAX );
+}
+
+/* wait for objects along with other handles, which are signaled when their fd is readable */
+static NTSTATUS poll_wait_objects( DWORD count, const HANDLE *handles, struct sync_mapping **mappings,
+                                   BOOLEAN wait_any, BOOLEAN alertable, const LARGE_INTEGER *timeout )
+{
+    struct pollfd pfd[2 * MAXIMUM_WAIT_OBJECTS + 1];
+    int start[MAXIMUM_WAIT_OBJECTS], timer_idx[MAXIMUM_WAIT_OBJECTS];
+    struct sync_object *obj;
+    struct sync_thread *thread;
+    struct timespec deadline, now;
+    clockid_t clock = CLOCK_MONOTONIC;
+    BOOL has_deadline, watched, foreign = FALSE;
+    ULONG_PTR old_slack = 0, slack = 0;
+    NTSTATUS status, ret;
+    int i, j, ms, timer_ms, apc_idx = -1, nfds = count;
+    ULONGLONG value;
+
+    for (i = 0; i < count; i++)
+    {
+        if (mappings[i]) continue;
+        if ((LONG_PTR)handles[i] < 0) return STATUS_NOT_IMPLEMENTED;  /* pseudo handle */
+        if (fcntl( HandleToULong( handles[i] ), F_GETFD ) == -1) return STATUS_INVALID_HANDLE;
+    }
+    thread = get_sync_thread();
+    has_deadline = get_deadline( timeout, &deadline, &clock );
+
+    for (i = 0; i < count; i++)
+    {
+        pfd[i].events = POLLIN;
+        timer_idx[i] = -1;
+        if (!mappings[i])
+        {
+            pfd[i].fd = HandleToULong( handles[i] );
+            continue;
+        }
+        pfd[i].fd = add_poller( mappings[i], &watched );
+        start[i] = mappings[i]->obj->state;
+        /* without the watcher, other processes and the kernel (for abandoned mutexes) don't write our eventfd */
+        if (!watched && (mappings[i]->path[0] || mappings[i]->obj->type == SYNC_OBJECT_MUTEX || pfd[i].fd == -1))
+            foreign = TRUE;
+        if (mappings[i]->obj->type != SYNC_OBJECT_TIMER) continue;
+
+        /* coalescable timers wake us through the poll timeout, which gets the slack */
+        if (mappings[i]->obj->timer_slack)
+        {
+            slack = max( slack, mappings[i]->obj->timer_slack );
+            continue;
+        }
+        arm_timer( mappings[i] );
+        timer_idx[i] = nfds;
+        pfd[nfds].fd = mappings[i]->timer_fd;
+        pfd[nfds].events = POLLIN;
+        nfds++;
+    }
+    if (alertable && get_apc_fd( thread ) != -1)
+    {
+        apc_idx = nfds;
+        pfd[nfds].fd = thread->apc_fd;
+        pfd[nfds].events = POLLIN;
+        nfds++;
+    }
+    if (slack)
+    {
+        old_slack = get_timer_slack();
+        set_timer_slack( slack );
+    }
+    poll_handles( pfd, nfds, mappings, count, 0 );
+
+    for (;;)
+    {
+        if (apc_idx != -1 && pfd[apc_idx].revents) read( pfd[apc_idx].fd, &value, sizeof(value) );
+        if (alertable && apcs_pending( thread ) && call_apcs( thread ))
+        {
+            ret = STATUS_USER_APC;
+            break;
+        }
+
+        timer_ms = -1;
+        for (i = 0; i < count; i++)
+        {
+            if (!mappings[i] || mappings[i]->obj->type != SYNC_OBJECT_TIMER) continue;
+            if (timer_idx[i] != -1)
+            {
+                /* the timer may have been set again in the meantime */
+                arm_timer( mappings[i] );
+                pfd[timer_idx[i]].fd = mappings[i]->timer_fd;
+            }
+            if (!fire_timer( mappings[i] ) || !mappings[i]->obj->timer_slack) continue;
+            ms = get_timer_wait( mappings[i]->obj );
+            if (ms != -1 && (timer_ms == -1 || ms < timer_ms)) timer_ms = ms;
+        }
+
+        if (wait_any)
+        {
+            for (i = 0; i < count; i++)
+            {
+                if (!mappings[i])
+                {
+                    if (!pfd[i].revents) continue;
+                    ret = STATUS_WAIT_0 + i;
+                    break;
+                }
+                status = acquire_object( mappings[i]->obj, thread, start[i] );
+                if (status == STATUS_TIMEOUT) continue;
+                if (status == STATUS_ABANDONED) ret = STATUS_ABANDONED_WAIT_0 + i;
+                else ret = is_error(status) ? status : STATUS_WAIT_0 + i;
+                break;
+            }
+            if (i < count) break;
+        }
+        else
+        {
+            for (i = 0; i < count; i++)
+            {
+                if (!mappings[i])
+                {
+                    if (!pfd[i].revents) break;
+                    continue;
+                }
+                obj = mappings[i]->obj;
+                if (!is_object_signaled( obj, thread, start[i], obj->state )) break;
+            }
+            if (i == count)
+            {
+                ret = STATUS_WAIT_0;
+                for (i = 0; i < count; i++)
+                {
+                    if (!mappings[i]) continue;
+                    status = acquire_object( mappings[i]->obj, thread, start[i] );
+                    if (status == STATUS_ABANDONED) ret = STATUS_ABANDONED_WAIT_0 + i;
+                    else if (status) break;
+                }
+                if (i == count) break;
+                for (j = 0; j < i; j++) if (mappings[j]) undo_acquire( mappings[j]->obj, thread );
+                if (is_error(status))
+                {
+                    ret = status;
+                    break;
+                }
+            }
+        }
+
+        ret = STATUS_TIMEOUT;
+        if (timeout && !timeout->QuadPart) break;
+        ms = -1;
+        if (has_deadline)
+        {
+            if (deadline_passed( &deadline, clock )) break;
+            clock_gettime( clock, &now );
+            ms = (deadline.tv_sec - now.tv_sec) * 1000 + (deadline.tv_nsec - now.tv_nsec + 999999) / 1000000;
+        }
+        /* without an eventfd, APCs are only noticed by polling */
+        if ((foreign || (alertable && apc_idx == -1)) && (ms == -1 || ms > SYNC_POLL_SLICE))
+            ms = SYNC_POLL_SLICE;
+        if (timer_ms != -1 && (ms == -1 || ms > timer_ms)) ms = timer_ms;
+        if (poll_handles( pfd, nfds, mappings, count, ms ) == -1 && errno != EINTR)
+        {
+            ret = FILE_GetNtStatus();
+            break;
+        }
+    }
+
+    if (slack) set_timer_slack( old_slack );
+    for (i = 0; i < count; i++) if (mappings[i]) remove_poller( mappings[i] );
+    return ret;
+}
+
+
+/* wait for objects that can all be waited on with futexes */
+static NTSTATUS futex_wait_objects( DWORD count, struct sync_mapping **mappings, BOOLEAN wait_any,
+                                    BOOLEAN alertable, const LARGE_INTEGER *timeout )
+{
+    struct sync_object *objs[MAXIMUM_WAIT_OBJECTS];
+    struct futex_waitv_ waitv[MAXIMUM_WAIT_OBJECTS + 1];
+    int start[MAXIMUM_WAIT_OBJECTS], vals[MAXIMUM_WAIT_OBJECTS];
+    struct sync_thread *thread;
+    struct timespec deadline;
+    clockid_t clock = CLOCK_MONOTONIC;
+    BOOL has_deadline, ready;
+    NTSTATUS status, ret;
+    int i, j, nwait, apc_seq = 0, woken = -1;
+
+    for (i = 0; i < count; i++)
+    {
+        objs[i] = mappings[i]->obj;
+        start[i] = objs[i]->state;
+    }
+    thread = get_sync_thread();
+    has_deadline = get_deadline( timeout, &deadline, &clock );
+
+    for (;;)
+    {
+        if (alertable)
+        {
+            /* read before checking the queue, a later push changes it and ends the wait */
+            apc_seq = *(volatile int *)&thread->apc_seq;
+            if (apcs_pending( thread ) && call_apcs( thread )) return STATUS_USER_APC;
+        }
+
+        if (wait_any)
+        {
+            for (i = 0; i < count; i++)
+            {
+                status = acquire_object( objs[i], thread, start[i] );
+                if (status == STATUS_TIMEOUT) continue;
+                /* pass on a wake-up meant for a single thread that we didn't use */
+                if (woken != -1 && woken != i && wakes_single_thread( objs[woken] ))
+                    wake_object( objs[woken], 1 );
+                if (status == STATUS_ABANDONED) return STATUS_ABANDONED_WAIT_0 + i;
+                return is_error(status) ? status : STATUS_WAIT_0 + i;
+            }
+        }
+        else
+        {
+            for (i = 0; i < count; i++)
+                if (!is_object_signaled( objs[i], thread, start[i], objs[i]->state )) break;
+            if (i == count)
+            {
+                /* all of them look signaled, grab them and give them back if we lose a race */
+                ret = STATUS_WAIT_0;
+                for (i = 0; i < count; i++)
+                {
+                    status = acquire_object( objs[i], thread, start[i] );
+                    if (status == STATUS_ABANDONED) ret = STATUS_ABANDONED_WAIT_0 + i;
+                    else if (status) break;
+                }
+                if (i == count) return ret;
+                for (j = 0; j < i; j++) undo_acquire( objs[j], thread );
+                if (is_error(status)) return status;
+            }
+        }
+
+        if (timeout && !timeout->QuadPart) return STATUS_TIMEOUT;
+        if (has_deadline && deadline_passed( &deadline, clock )) return STATUS_TIMEOUT;
+
+        /* announce ourselves, then check again: a release that didn't see us
+         * as a waiter has to be visible in the values we sleep on */
+        for (i = 0; i < count; i++) interlocked_xchg_add( &objs[i]->waiters, 1 );
+        ready = !wait_any;
+        for (i = 0; i < count; i++)
+        {
+            vals[i] = prepare_wait( objs[i] );
+            if (is_object_signaled( objs[i], thread, start[i], vals[i] ) == wait_any) ready = wait_any;
+        }
+
+        woken = -1;
+        if (!ready)
+        {
+            if (count == 1 && !alertable)
+            {
+                if (futex_wait_until( &objs[0]->state, vals[0], has_deadline ? &deadline : NULL, clock ) != -1)
+                    woken = 0;
+            }
+            else
+            {
+                for (i = 0; i < count; i++)
+                {
+                    waitv[i].val      = (unsigned int)vals[i];
+                    waitv[i].uaddr    = (ULONG_PTR)&objs[i]->state;
+                    waitv[i].flags    = FUTEX2_SIZE_U32_;
+                    waitv[i].reserved = 0;
+                }
+                nwait = count;
+                if (alertable)
+                {
+                    waitv[nwait].val      = (unsigned int)apc_seq;
+                    waitv[nwait].uaddr    = (ULONG_PTR)&thread->apc_seq;
+                    waitv[nwait].flags    = FUTEX2_SIZE_U32_;
+                    waitv[nwait].reserved = 0;
+                    nwait++;
+                }
+                woken = futex_waitv( waitv, nwait, has_deadline ? &deadline : NULL, clock );
+                if (woken >= (int)count) woken = -1;  /* an APC was queued */
+                else if (woken == -1 && errno == ENOSYS)
+                {
+                    /* no vectored waits, poll the objects */
+                    struct timespec poll_deadline;
+                    LARGE_INTEGER poll_timeout;
+                    clockid_t poll_clock;
+
+                    poll_timeout.QuadPart = -10000;  /* 1 ms */
+                    get_deadline( &poll_timeout, &poll_deadline, &poll_clock );
+                    futex_wait_until( &objs[0]->state, vals[0], &poll_deadline, poll_clock );
+                }
+            }
+        }
+        for (i = 0; i < count; i++) interlocked_xchg_add( &objs[i]->waiters, -1 );
+    }
+}
+
+
+/***********************************************************************
+ *           sync_wait_objects
+ *
+ * Wait for sync objects, possibly along with other handles. Returns
+ * STATUS_NOT_IMPLEMENTED for handles that are neither objects nor fds.
+ * Alertable waits return STATUS_USER_APC after calling queued APCs.
+ */
+NTSTATUS sync_wait_objects( DWORD count, const HANDLE *handles, BOOLEAN wait_any,
+                            BOOLEAN alertable, const LARGE_INTEGER *timeout )
+{
+    struct sync_mapping *mappings[MAXIMUM_WAIT_OBJECTS];
+    struct sync_thread *thread = NULL;
+    NTSTATUS ret;
+    int i, j, prev = 0;
+
+    if (!count || count > MAXIMUM_WAIT_OBJECTS) return STATUS_INVALID_PARAMETER_1;
+    for (i = j = 0; i < count; i++)
+        if ((mappings[i] = get_mapping( handles[i] )) && mappings[i]->obj->type != SYNC_OBJECT_TIMER) j++;
+
+    if (alertable)
+    {
+        thread = get_sync_thread();
+        prev = interlocked_xchg( &thread->alertable, 1 );
+    }
+    /* timers and handles other than objects can only be polled */
+    if (j < count) ret = poll_wait_objects( count, handles, mappings, wait_any, alertable, timeout );
+    else ret = futex_wait_objects( count, mappings, wait_any, alertable, timeout );
+    if (alertable) thread->alertable = prev;
+    return ret;
+}
+
+/***********************************************************************
+ *           sync_signal_object
+ *
+ * Signal an object for NtSignalAndWaitForSingleObject.
+ */
+NTSTATUS sync_signal_object( HANDLE handle )
+{
+    struct sync_object *obj = get_object( handle, 0 );
+
+    if (!obj) return STATUS_NOT_IMPLEMENTED;
+    switch (obj->type)
+    {
+    case SYNC_OBJECT_EVENT:     return set_event( obj, NULL );
+    case SYNC_OBJECT_MUTEX:     return release_mutex( obj, get_sync_thread(), NULL );
+    case SYNC_OBJECT_SEMAPHORE: return release_semaphore( obj, 1, NULL );
+    }
+    return STATUS_OBJECT_TYPE_MISMATCH;
+}
+
+
+/*
+ *	Events
+ */
+
+/**************************************************************************
+ * NtCreateEvent (NTDLL.@)
+ * ZwCreateEvent (NTDLL.@)
+ */
+NTSTATUS WINAPI NtCreateEvent( PHANDLE EventHandle, ACCESS_MASK DesiredAccess,
+                               const OBJECT_ATTRIBUTES *attr, EVENT_TYPE type, BOOLEAN InitialState)
+{
+    struct sync_object init;
+
+    memset( &init, 0, sizeof(init) );
+    init.type   = SYNC_OBJECT_EVENT;
+    init.state  = InitialState ? 1 : 0;
+    init.manual = (type == NotificationEvent);
+    return get_object_handle( EventHandle, attr, SYNC_OBJECT_EVENT, &init );
+}
+
+/******************************************************************************
+ *  NtOpenEvent (NTDLL.@)
+ *  ZwOpenEvent (NTDLL.@)
+ */
+NTSTATUS WINAPI NtOpenEvent( HANDLE *handle, ACCESS_MASK access, const OBJECT_ATTRIBUTES *attr )
+{
+    return get_object_handle( handle, attr, SYNC_OBJECT_EVENT, NULL );
+}
+
+/******************************************************************************
+ *  NtSetEvent (NTDLL.@)
+ *  ZwSetEvent (NTDLL.@)
+ */
+NTSTATUS WINAPI NtSetEvent( HANDLE handle, PULONG NumberOfThreadsReleased )
+{
+    struct sync_object *obj = get_object( handle, SYNC_OBJECT_EVENT );
+
+    if (!obj) return get_object_error( handle );
+    return set_event( obj, (LONG *)NumberOfThreadsReleased );
+}
+
+/******************************************************************************
+ *  NtResetEvent (NTDLL.@)
+ */
+NTSTATUS WINAPI NtResetEvent( HANDLE handle, PULONG NumberOfThreadsReleased )
+{
+    struct sync_object *obj = get_object( handle, SYNC_OBJECT_EVENT );
+
+    if (!obj) return get_object_error( handle );
+    return reset_event( obj, (LONG *)NumberOfThreadsReleased );
+}
+
+/******************************************************************************
+ *  NtClearEvent (NTDLL.@)
+ */
+NTSTATUS WINAPI NtClearEvent ( HANDLE handle )
+{
+    return NtResetEvent( handle, NULL );
+}
+
+/******************************************************************************
+ *  NtPulseEvent (NTDLL.@)
+ *
+ * Releases the threads waiting on the event and leaves it reset. An auto
+ * reset event is simply set if somebody waits on it, for the first waiter
+ * to reset it again.
+ */
+NTSTATUS WINAPI NtPulseEvent( HANDLE handle, PULONG PulseCount )
+{
+    struct sync_object *obj = get_object( handle, SYNC_OBJECT_EVENT );
+    int val, tmp;
+
+    if (!obj) return get_object_error( handle );
+
+    if (!obj->manual)
+    {
+        if (obj->waiters) return set_event( obj, (LONG *)PulseCount );
+        return reset_event( obj, (LONG *)PulseCount );
+    }
+    for (val = *(volatile int *)&obj->state;; val = tmp)
+        if ((tmp = interlocked_cmpxchg( &obj->state, (val + 2) & ~1, val )) == val) break;
+    if (PulseCount) *PulseCount = val & 1;
+    if (obj->waiters) wake_object( obj, INT_MAX );
+    return STATUS_SUCCESS;
+}
+
+/******************************************************************************
+ *  NtQueryEvent (NTDLL.@)
+ */
+NTSTATUS WINAPI NtQueryEvent( HANDLE handle, EVENT_INFORMATION_CLASS class,
+                              void *info, ULONG len, ULONG *ret_len )
+{
+    struct sync_object *obj;
+    EVENT_BASIC_INFORMATION *out = info;
+
+    TRACE("(%p, %u, %p, %u, %p)\n", handle, class, info, len, ret_len);
+
+    if (class != EventBasicInformation)
+    {
+        FIXME("(%p, %d, %d) Unknown class\n",
+              handle, class, len);
+        return STATUS_INVALID_INFO_CLASS;
+    }
+
+    if (len != sizeof(EVENT_BASIC_INFORMATION)) return STATUS_INFO_LENGTH_MISMATCH;
+    if (!(obj = get_object( handle, SYNC_OBJECT_EVENT ))) return get_object_error( handle );
+
+    out->EventType  = obj->manual ? NotificationEvent : SynchronizationEvent;
+    out->EventState = obj->state & 1;
+    if (ret_len) *ret_len = sizeof(EVENT_BASIC_INFORMATION);
+    return STATUS_SUCCESS;
+}
+
+
+/*
+ *	Mutants (known as Mutexes in Kernel32)
+ */
+
+/******************************************************************************
+ *              NtCreateMutant                          [NTDLL.@]
+ *              ZwCreateMutant                          [NTDLL.@]
+ */
+NTSTATUS WINAPI NtCreateMutant(OUT HANDLE* MutantHandle,
+                               IN ACCESS_MASK access,
+                               IN const OBJECT_ATTRIBUTES* attr OPTIONAL,
+                               IN BOOLEAN InitialOwner)
+{
+    struct sync_thread *thread = get_sync_thread();
+    struct robust_list_ *entry;
+    struct sync_object init;
+    NTSTATUS status;
+
+    memset( &init, 0, sizeof(init) );
+    init.type = SYNC_OBJECT_MUTEX;
+    if (InitialOwner)
+    {
+        /* owned from the start, so that no other process can get it first */
+        init.state = thread->tid;
+        init.count = 1;
+    }
+    status = get_object_handle( MutantHandle, attr, SYNC_OBJECT_MUTEX, &init );
+
+    /* the robust list entry is at a fixed offset in the mapping, link it once it exists */
+    if (!is_error(status) && InitialOwner && status != STATUS_OBJECT_NAME_EXISTS &&
+        (entry = get_robust_entry( thread, get_object( *MutantHandle, SYNC_OBJECT_MUTEX ) )))
+        robust_list_add( thread, entry );
+    return status;
+}
+
+/**************************************************************************
+ *		NtOpenMutant				[NTDLL.@]
+ *		ZwOpenMutant				[NTDLL.@]
+ */
+NTSTATUS WINAPI NtOpenMutant( HANDLE *handle, ACCESS_MASK access, const OBJECT_ATTRIBUTES *attr )
+{
+    return get_object_handle( handle, attr, SYNC_OBJECT_MUTEX, NULL );
+}
+
+/**************************************************************************
+ *		NtReleaseMutant				[NTDLL.@]
+ *		ZwReleaseMutant				[NTDLL.@]
+ */
+NTSTATUS WINAPI NtReleaseMutant( IN HANDLE handle, OUT PLONG prev_count OPTIONAL)
+{
+    struct sync_object *obj = get_object( handle, SYNC_OBJECT_MUTEX );
+
+    if (!obj) return get_object_error( handle );
+    return release_mutex( obj, get_sync_thread(), prev_count );
+}
+
+/******************************************************************
+ *		NtQueryMutant                   [NTDLL.@]
+ *		ZwQueryMutant                   [NTDLL.@]
+ */
+NTSTATUS WINAPI NtQueryMutant( HANDLE handle, MUTANT_INFORMATION_CLASS class,
+                               void *info, ULONG len, ULONG *ret_len )
+{
+    struct sync_object *obj;
+    MUTANT_BASIC_INFORMATION *out = info;
+    int val;
+
+    TRACE("(%p, %u, %p, %u, %p)\n", handle, class, info, len, ret_len);
+
+    if (class != MutantBasicInformation)
+    {
+        FIXME("(%p, %d, %d) Unknown class\n",
+              handle, class, len);
+        return STATUS_INVALID_INFO_CLASS;
+    }
+
+    if (len != sizeof(MUTANT_BASIC_INFORMATION)) return STATUS_INFO_LENGTH_MISMATCH;
+    if (!(obj = get_object( handle, SYNC_OBJECT_MUTEX ))) return get_object_error( handle );
+
+    val = obj->state;
+    out->OwnedByCaller  = (val & FUTEX_TID_MASK_) == get_sync_thread()->tid;
+    out->CurrentCount   = (val & FUTEX_TID_MASK_) ? 1 - obj->count : 1;
+    out->AbandonedState = (val & FUTEX_OWNER_DIED_) != 0;
+    if (ret_len) *ret_len = sizeof(MUTANT_BASIC_INFORMATION);
+    return STATUS_SUCCESS;
+}
+
+
+/*
+ *	Semaphores
+ */
+
+/******************************************************************************
+ *  NtCreateSemaphore (NTDLL.@)
+ */
+NTSTATUS WINAPI NtCreateSemaphore( OUT PHANDLE SemaphoreHandle,
+                                   IN ACCESS_MASK access,
+                                   IN const OBJECT_ATTRIBUTES *attr OPTIONAL,
+                                   IN LONG InitialCount,
+                                   IN LONG MaximumCount )
+{
+    struct sync_object init;
+
+    if (MaximumCount <= 0 || InitialCount < 0 || InitialCount > MaximumCount)
+        return STATUS_INVALID_PARAMETER;
+
+    memset( &init, 0, sizeof(init) );
+    init.type  = SYNC_OBJECT_SEMAPHORE;
+    init.state = InitialCount;
+    init.max   = MaximumCount;
+    return get_object_handle( SemaphoreHandle, attr, SYNC_OBJECT_SEMAPHORE, &init );
+}
+
+/******************************************************************************
+ *  NtOpenSemaphore (NTDLL.@)
+ */
+NTSTATUS WINAPI NtOpenSemaphore( HANDLE *handle, ACCESS_MASK access, const OBJECT_ATTRIBUTES *attr )
+{
+    return get_object_handle( handle, attr, SYNC_OBJECT_SEMAPHORE, NULL );
+}
+
+/******************************************************************************
+ *  NtQuerySemaphore (NTDLL.@)
+ */
+NTSTATUS WINAPI NtQuerySemaphore( HANDLE handle, SEMAPHORE_INFORMATION_CLASS class,
+                                  void *info, ULONG len, ULONG *ret_len )
+{
+    struct sync_object *obj;
+    SEMAPHORE_BASIC_INFORMATION *out = info;
+
+    TRACE("(%p, %u, %p, %u, %p)\n", handle, class, info, len, ret_len);
+
+    if (class != SemaphoreBasicInformation)
+    {
+        FIXME("(%p,%d,%u) Unknown class\n", handle, class, len);
+        return STATUS_INVALID_INFO_CLASS;
+    }
+
+    if (len != sizeof(SEMAPHORE_BASIC_INFORMATION)) return STATUS_INFO_LENGTH_MISMATCH;
+    if (!(obj = get_object( handle, SYNC_OBJECT_SEMAPHORE ))) return get_object_error( handle );
+
+    out->CurrentCount = obj->state;
+    out->MaximumCount = obj->max;
+    if (ret_len) *ret_len = sizeof(SEMAPHORE_BASIC_INFORMATION);
+    return STATUS_SUCCESS;
+}
+
+/******************************************************************************
+ *  NtReleaseSemaphore (NTDLL.@)
+ */
+NTSTATUS WINAPI NtReleaseSemaphore( HANDLE handle, ULONG count, PULONG previous )
+{
+    struct sync_object *obj = get_object( handle, SYNC_OBJECT_SEMAPHORE );
+
+    if (!obj) return get_object_error( handle );
+    return release_semaphore( obj, count, previous );
+}
+
+
+/*
+ *	Timers
+ */
+
+/**************************************************************************
+ *		NtCreateTimer				[NTDLL.@]
+ *		ZwCreateTimer				[NTDLL.@]
+ */
+NTSTATUS WINAPI NtCreateTimer(OUT HANDLE *handle,
+                              IN ACCESS_MASK access,
+                              IN const OBJECT_ATTRIBUTES *attr OPTIONAL,
+                              IN TIMER_TYPE timer_type)
+{
+    struct sync_object init;
+
+    if (timer_type != NotificationTimer && timer_type != SynchronizationTimer)
+        return STATUS_INVALID_PARAMETER;
+
+    memset( &init, 0, sizeof(init) );
+    init.type   = SYNC_OBJECT_TIMER;
+    init.manual = (timer_type == NotificationTimer);
+    return get_object_handle( handle, attr, SYNC_OBJECT_TIMER, &init );
+}
+
+/**************************************************************************
+ *		NtOpenTimer				[NTDLL.@]
+ *		ZwOpenTimer				[NTDLL.@]
+ */
+NTSTATUS WINAPI NtOpenTimer( HANDLE *handle, ACCESS_MASK access, const OBJECT_ATTRIBUTES *attr )
+{
+    return get_object_handle( handle, attr, SYNC_OBJECT_TIMER, NULL );
+}
+
+/**************************************************************************
+ *		NtSetTimer				[NTDLL.@]
+ *		ZwSetTimer				[NTDLL.@]
+ */
+NTSTATUS WINAPI NtSetTimer(IN HANDLE handle,
+                           IN const LARGE_INTEGER* when,
+                           IN PTIMER_APC_ROUTINE callback,
+                           IN PVOID callback_arg,
+                           IN BOOLEAN resume,
+                           IN ULONG period OPTIONAL,
+                           OUT PBOOLEAN state OPTIONAL)
+{
+    NTSTATUS status;
+
+    TRACE("(%p,%p,%p,%p,%08x,0x%08x,%p)\n",
+          handle, when, callback, callback_arg, resume, period, state);
+
+    status = set_timer( handle, when, callback, callback_arg, period, 0, state );
+
+    /* set error but can still succeed */
+    if (resume && status == STATUS_SUCCESS) return STATUS_TIMER_RESUME_IGNORED;
+    return status;
+}
+
+/**************************************************************************
+ *		NtSetTimerEx				[NTDLL.@]
+ *		ZwSetTimerEx				[NTDLL.@]
+ *
+ * Sets a timer that may expire up to TolerableDelay ms late, which is
+ * used as the timer slack of the threads waiting for it.
+ */
+NTSTATUS WINAPI NtSetTimerEx( HANDLE handle, TIMER_SET_INFORMATION_CLASS class, void *info, ULONG len )
+{
+    TIMER_SET_COALESCABLE_TIMER_INFO *params = info;
+
+    TRACE("(%p,%d,%p,%u)\n", handle, class, info, len);
+
+    if (class != TimerSetCoalescableTimer)
+    {
+        FIXME("(%p,%d,%u) Unknown class\n", handle, class, len);
+        return STATUS_INVALID_INFO_CLASS;
+    }
+    if (len != sizeof(*params)) return STATUS_INFO_LENGTH_MISMATCH;
+
+    return set_timer( handle, &params->DueTime, params->TimerApcRoutine, params->TimerContext,
+                      params->Period, params->TolerableDelay, params->PreviousState );
+}
+
+/**************************************************************************
+ *		NtCancelTimer				[NTDLL.@]
+ *		ZwCancelTimer				[NTDLL.@]
+ */
+NTSTATUS WINAPI NtCancelTimer(IN HANDLE handle, OUT BOOLEAN* state)
+{
+    return set_timer( handle, NULL, NULL, NULL, 0, 0, state );
+}
+
+/******************************************************************************
+ *  NtQueryTimer (NTDLL.@)
+ *
+ * Retrieves information about a timer.
+ *
+ * PARAMS
+ *  TimerHandle           [I] The timer to retrieve information about.
+ *  TimerInformationClass [I] The type of information to retrieve.
+ *  TimerInformation      [O] Pointer to buffer to store information in.
+ *  Length                [I] The length of the buffer pointed to by TimerInformation.
+ *  ReturnLength          [O] Optional. The size of buffer actually used.
+ *
+ * RETURNS
+ *  Success: STATUS_SUCCESS
+ *  Failure: STATUS_INFO_LENGTH_MISMATCH, if Length doesn't match the required data
+ *           size for the class specified.
+ *           STATUS_INVALID_INFO_CLASS, if an invalid TimerInformationClass was specified.
+ */
+NTSTATUS WINAPI NtQueryTimer(
+    HANDLE TimerHandle,
+    TIMER_INFORMATION_CLASS TimerInformationClass,
+    PVOID TimerInformation,
+    ULONG Length,
+    PULONG ReturnLength)
+{
+    TIMER_BASIC_INFORMATION * basic_info = TimerInformation;
+    struct sync_mapping *mapping;
+    struct sync_object *obj;
+    LONGLONG left = 0;
+
+    TRACE("(%p,%d,%p,0x%08x,%p)\n", TimerHandle, TimerInformationClass,
+       TimerInformation, Length, ReturnLength);
+
+    switch (TimerInformationClass)
+    {
+    case TimerBasicInformation:
+        if (Length < sizeof(TIMER_BASIC_INFORMATION))
+            return STATUS_INFO_LENGTH_MISMATCH;
+
+        mapping = get_mapping( TimerHandle );
+        if (!mapping || mapping->obj->type != SYNC_OBJECT_TIMER) return get_object_error( TimerHandle );
+        obj = mapping->obj;
+
+        fire_timer( mapping );
+        lock_timer( obj );
+        if (obj->timer_active) left = obj->timer_due - get_clock_ns( obj->timer_clock );
+        unlock_timer( obj );
+
+        basic_info->RemainingTime.QuadPart = max( left, 0 ) / 100;
+        basic_info->TimerState = obj->state & 1;
+        if (ReturnLength) *ReturnLength = sizeof(TIMER_BASIC_INFORMATION);
+        return STATUS_SUCCESS;
+    }
+
+    FIXME("Unhandled class %d\n", TimerInformationClass);
+    return STATUS_INVALID_INFO_CLASS;
+}
+
+
+/*
+ *	APCs
+ */
+
+/******************************************************************************
+ *              NtQueueApcThread  (NTDLL.@)
+ *
+ * Only the current thread can be targeted, there are no thread handles yet.
+ */
+NTSTATUS WINAPI NtQueueApcThread( HANDLE handle, PNTAPCFUNC func, ULONG_PTR arg1,
+                                  ULONG_PTR arg2, ULONG_PTR arg3 )
+{
+    TRACE( "(%p,%p,%lx,%lx,%lx)\n", handle, func, arg1, arg2, arg3 );
+
+    if (!func) return STATUS_SUCCESS;
+    if (handle != GetCurrentThread())
+    {
+        FIXME( "APC to thread handle %p not supported\n", handle );
+        return STATUS_INVALID_HANDLE;
+    }
+    return queue_apc( get_sync_thread(), func, arg1, arg2, arg3 );
+}
+
+/******************************************************************************
+ *              NtTestAlert  (NTDLL.@)
+ */
+NTSTATUS WINAPI NtTestAlert(void)
+{
+    struct sync_thread *thread = get_sync_thread();
+
+    if (apcs_pending( thread )) call_apcs( thread );
+    return STATUS_SUCCESS;
+}
@@ -22,8 +22,12 @@
 #include "wine/port.h"
 
 #include <assert.h>
+#include <errno.h>
+#include <pthread.h>
+#include <signal.h>
 #include <stdarg.h>
 #include <limits.h>
+#include <time.h>
 #include <sys/types.h>
 #ifdef HAVE_SYS_MMAN_H
 #include <sys/mman.h>
@@ -55,6 +59,10 @@ WINE_DEFAULT_DEBUG_CHANNEL(thread);
 struct _KUSER_SHARED_DATA *user_shared_data = NULL;
 static const WCHAR default_windirW[] = {'C',':','\\','w','i','n','d','o','w','s',0};
 
+#define USER_SHARED_DATA_ADDR   ((void *)0x7ffe0000)
+#define USER_SHARED_DATA_SIZE   0x10000
+#define USER_SHARED_DATA_TICK   15625000  /* ns between time updates, the default clock interval of Windows */
+
 //PUNHANDLED_EXCEPTION_FILTER unhandled_exception_filter = NULL;
 //void (WINAPI *kernel32_start_process)(LPTHREAD_START_ROUTINE,void*) = NULL;
 
@@ -101,6 +109,106 @@ static inline void get_unicode_string( UNICODE_STRING *str, WCHAR **src, WCHAR *
 }
 
 
+/* store a time so that readers never see a torn value: they either load it
+ * at once, or check High1Time against High2Time */
+static void set_ksystem_time( volatile KSYSTEM_TIME *time, LONGLONG value )
+{
+    time->High2Time = value >> 32;
+#ifdef _WIN64
+    *(volatile LONGLONG *)&time->LowPart = value;
+#else
+    time->LowPart   = value;
+    time->High1Time = value >> 32;
+#endif
+}
+
+/* update the time values in user_shared_data */
+static void update_shared_data_time(void)
+{
+    LARGE_INTEGER now;
+    ULONGLONG interrupt_time;
+
+    RtlQueryUnbiasedInterruptTime( &interrupt_time );
+    NtQuerySystemTime( &now );
+
+    set_ksystem_time( &user_shared_data->InterruptTime, interrupt_time );
+    set_ksystem_time( &user_shared_data->SystemTime, now.QuadPart );
+    set_ksystem_time( &user_shared_data->u.TickCount, interrupt_time / 10000 );
+    user_shared_data->TickCountLowDeprecated = user_shared_data->u.TickCount.LowPart;
+}
+
+/* thread keeping the time values in user_shared_data current, like the clock interrupt does */
+static void *shared_data_clock_thread( void *arg )
+{
+    struct timespec next, now;
+    sigset_t sigset;
+
+    sigfillset( &sigset );
+    pthread_sigmask( SIG_BLOCK, &sigset, NULL );
+
+    clock_gettime( CLOCK_MONOTONIC, &next );
+    for (;;)
+    {
+        next.tv_nsec += USER_SHARED_DATA_TICK;
+        if (next.tv_nsec >= 1000000000)
+        {
+            next.tv_sec++;
+            next.tv_nsec -= 1000000000;
+        }
+        while (clock_nanosleep( CLOCK_MONOTONIC, TIMER_ABSTIME, &next, NULL ) == EINTR);
+        update_shared_data_time();
+
+        /* don't try to catch up on the ticks missed while the process was stopped */
+        clock_gettime( CLOCK_MONOTONIC, &now );
+        if (now.tv_sec > next.tv_sec + 1) next = now;
+    }
+    return NULL;
+}
+
+static void start_shared_data_clock(void)
+{
+    pthread_attr_t attr;
+    pthread_t thread;
+
+    update_shared_data_time();
+    pthread_attr_init( &attr );
+    pthread_attr_setdetachstate( &attr, PTHREAD_CREATE_DETACHED );
+    pthread_attr_setstacksize( &attr, PTHREAD_STACK_MIN );
+    if (pthread_create( &thread, &attr, shared_data_clock_thread, NULL ))
+        ERR( "failed to start the shared data clock, time values won't be updated\n" );
+    pthread_attr_destroy( &attr );
+}
+
+/***********************************************************************
+ *           init_user_shared_data
+ *
+ * Map the shared user data at its fixed address, where Windows code
+ * expects it, and start updating its time values. If the address is
+ * already taken, user_shared_data stays NULL and the time functions
+ * fall back to the clock.
+ */
+static void init_user_shared_data(void)
+{
+    void *addr = wine_anon_mmap( USER_SHARED_DATA_ADDR, USER_SHARED_DATA_SIZE, PROT_READ | PROT_WRITE, 0 );
+
+    if (addr != USER_SHARED_DATA_ADDR)
+    {
+        if (addr != (void *)-1) munmap( addr, USER_SHARED_DATA_SIZE );
+        WARN( "failed to map the shared user data at %p, reading the clock instead\n",
+              USER_SHARED_DATA_ADDR );
+        return;
+    }
+    user_shared_data = addr;
+    memcpy( user_shared_data->NtSystemRoot, default_windirW, sizeof(default_windirW) );
+    user_shared_data->TickCountMultiplier = 1 << 24;
+    fill_cpu_info();
+
+    start_shared_data_clock();
+    /* the clock thread doesn't survive a fork */
+    pthread_atfork( NULL, NULL, start_shared_data_clock );
+}
+
+
 /***********************************************************************
  *           thread_init
  *
@@ -210,6 +318,8 @@ HANDLE thread_init(void)
     debug_info.out_pos = debug_info.output;
     debug_init();
 
+    init_user_shared_data();
+
 #if 0
     /* setup the server connection */
     server_init_process();
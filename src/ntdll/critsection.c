@@ -52,7 +52,7 @@ static inline LONG interlocked_dec( PLONG dest )
 
 static inline void small_pause(void)
 {
-#ifdef __i386__
+#if defined(__i386__) || defined(__x86_64__)
     __asm__ __volatile__( "rep;nop" : : : "memory" );
 #else
     __asm__ __volatile__( "" : : : "memory" );
@@ -201,6 +201,112 @@ static inline void close_semaphore( RTL_CRITICAL_SECTION *crit )
 
 #endif
 
+/* Adaptive spinning and contention statistics
+ *
+ * SpinCount is only an upper bound. Sections with debug info learn how
+ * long to spin from the number of iterations it took recent spins to get
+ * the section, which tracks how long the owner usually keeps it. A spin
+ * that runs out without getting the section usually means the owner was
+ * preempted or keeps the section for long, so the learned count backs off
+ * quickly in that case, which keeps oversubscribed machines from burning
+ * their CPU time on spinning.
+ *
+ * RTL_CRITICAL_SECTION_DEBUG has no room left for this, so the learned
+ * spin count and the wait time live in a small hash table keyed by the
+ * section. A slot is taken the first time the section is contended and
+ * given back when it is deleted; sections that don't find a free slot
+ * just spin for CRIT_SPIN_MIN iterations. The statistics are only updated
+ * by the owner of the section, so they don't need atomic operations.
+ */
+
+#define CRIT_SPIN_MIN     16    /* spins always allowed, so that sections can learn again */
+#define CRIT_STATS_SIZE   1024  /* number of sections that keep statistics, power of 2 */
+#define CRIT_STATS_PROBE  8     /* slots looked at for a section */
+
+struct crit_section_stats
+{
+    RTL_CRITICAL_SECTION *crit;          /* section, NULL if the slot is free */
+    LONG                  spin_average;  /* spin count learned from recent acquisitions */
+    ULONGLONG             wait_time;     /* total time spent waiting for the section, in ns */
+};
+
+static struct crit_section_stats crit_stats[CRIT_STATS_SIZE];
+static int crit_stats_lock;  /* only keeps RtlDumpCriticalSectionStats away from deleted sections */
+
+static inline void lock_crit_stats(void)
+{
+    while (interlocked_cmpxchg( &crit_stats_lock, 1, 0 )) small_pause();
+}
+
+static inline void unlock_crit_stats(void)
+{
+    interlocked_xchg( &crit_stats_lock, 0 );
+}
+
+static inline unsigned int crit_stats_hash( RTL_CRITICAL_SECTION *crit )
+{
+    return ((ULONG)((ULONG_PTR)crit >> 3) * 0x9e3779b1) >> 22;
+}
+
+/* find the statistics of a section, optionally taking a free slot for it */
+static struct crit_section_stats *get_crit_stats( RTL_CRITICAL_SECTION *crit, BOOL create )
+{
+    unsigned int i, hash = crit_stats_hash( crit );
+
+    for (i = 0; i < CRIT_STATS_PROBE; i++)
+    {
+        struct crit_section_stats *stats = &crit_stats[(hash + i) & (CRIT_STATS_SIZE - 1)];
+        if (stats->crit == crit) return stats;
+    }
+    if (!create) return NULL;
+    for (i = 0; i < CRIT_STATS_PROBE; i++)
+    {
+        struct crit_section_stats *stats = &crit_stats[(hash + i) & (CRIT_STATS_SIZE - 1)];
+        if (stats->crit || interlocked_cmpxchg_ptr( (void **)&stats->crit, crit, NULL )) continue;
+        stats->spin_average = 0;
+        stats->wait_time = 0;
+        return stats;
+    }
+    return NULL;
+}
+
+static void free_crit_stats( RTL_CRITICAL_SECTION *crit )
+{
+    struct crit_section_stats *stats;
+
+    lock_crit_stats();
+    if ((stats = get_crit_stats( crit, FALSE ))) stats->crit = NULL;
+    unlock_crit_stats();
+}
+
+static inline ULONG get_spin_limit( RTL_CRITICAL_SECTION *crit )
+{
+    struct crit_section_stats *stats;
+    ULONG limit = CRIT_SPIN_MIN;
+
+    if (!crit->DebugInfo) return crit->SpinCount;
+    if ((stats = get_crit_stats( crit, FALSE ))) limit += 2 * stats->spin_average;
+    return min( limit, crit->SpinCount );
+}
+
+/* update the learned spin count, spins is -1 if spinning didn't get the section */
+static inline void update_spin_average( RTL_CRITICAL_SECTION *crit, LONG spins )
+{
+    struct crit_section_stats *stats;
+
+    if (!crit->DebugInfo || !(stats = get_crit_stats( crit, TRUE ))) return;
+    if (spins >= 0) stats->spin_average += (spins - stats->spin_average) / 8;
+    else stats->spin_average -= (stats->spin_average + 3) / 4;
+}
+
+static inline ULONGLONG monotonic_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime( CLOCK_MONOTONIC, &ts );
+    return ts.tv_sec * (ULONGLONG)1000000000 + ts.tv_nsec;
+}
+
 #if 0
 /***********************************************************************
  *           get_semaphore
@@ -316,7 +422,7 @@ NTSTATUS WINAPI RtlInitializeCriticalSectionAndSpinCount( RTL_CRITICAL_SECTION *
  */
 NTSTATUS WINAPI RtlInitializeCriticalSectionEx( RTL_CRITICAL_SECTION *crit, ULONG spincount, ULONG flags )
 {
-    if (flags & (RTL_CRITICAL_SECTION_FLAG_DYNAMIC_SPIN|RTL_CRITICAL_SECTION_FLAG_STATIC_INIT))
+    if (flags & RTL_CRITICAL_SECTION_FLAG_STATIC_INIT)
         FIXME("(%p,%u,0x%08x) semi-stub\n", crit, spincount, flags);
 
     /* FIXME: if RTL_CRITICAL_SECTION_FLAG_STATIC_INIT is given, we should use
@@ -340,6 +446,7 @@ NTSTATUS WINAPI RtlInitializeCriticalSectionEx( RTL_CRITICAL_SECTION *crit, ULON
         crit->DebugInfo->EntryCount = 0;
         crit->DebugInfo->ContentionCount = 0;
         memset( crit->DebugInfo->Spare, 0, sizeof(crit->DebugInfo->Spare) );
+        free_crit_stats( crit );  /* in case the memory held a section that was never deleted */
     }
     crit->LockCount      = -1;
     crit->RecursionCount = 0;
@@ -403,6 +510,7 @@ NTSTATUS WINAPI RtlDeleteCriticalSection( RTL_CRITICAL_SECTION *crit )
     crit->OwningThread   = 0;
     if (crit->DebugInfo)
     {
+        free_crit_stats( crit );
         /* only free the ones we made in here */
         if (!crit->DebugInfo->Spare[0])
         {
@@ -441,6 +549,8 @@ NTSTATUS WINAPI RtlDeleteCriticalSection( RTL_CRITICAL_SECTION *crit )
 NTSTATUS WINAPI RtlpWaitForCriticalSection( RTL_CRITICAL_SECTION *crit )
 {
     LONGLONG timeout = NtCurrentTeb()->Peb->CriticalSectionTimeout.QuadPart / -10000000;
+    ULONGLONG start = crit->DebugInfo ? monotonic_ns() : 0;
+
     for (;;)
     {
         EXCEPTION_RECORD rec;
@@ -481,7 +591,13 @@ NTSTATUS WINAPI RtlpWaitForCriticalSection( RTL_CRITICAL_SECTION *crit )
         rec.ExceptionInformation[0] = (ULONG_PTR)crit;
         RtlRaiseException( &rec );
     }
-    if (crit->DebugInfo) crit->DebugInfo->ContentionCount++;
+    if (crit->DebugInfo)
+    {
+        struct crit_section_stats *stats = get_crit_stats( crit, TRUE );
+
+        crit->DebugInfo->ContentionCount++;
+        if (stats) stats->wait_time += monotonic_ns() - start;
+    }
     return STATUS_SUCCESS;
 }
 
@@ -543,20 +659,28 @@ NTSTATUS WINAPI RtlpUnWaitCriticalSection( RTL_CRITICAL_SECTION *crit )
  */
 NTSTATUS WINAPI RtlEnterCriticalSection( RTL_CRITICAL_SECTION *crit )
 {
+    LONG spins = 0;
+
     if (crit->SpinCount)
     {
-        ULONG count;
+        ULONG count, limit;
 
         if (RtlTryEnterCriticalSection( crit )) return STATUS_SUCCESS;
-        for (count = crit->SpinCount; count > 0; count--)
+        limit = get_spin_limit( crit );
+        for (count = 0; count < limit; count++)
         {
             if (crit->LockCount > 0) break;  /* more than one waiter, don't bother spinning */
             if (crit->LockCount == -1)       /* try again */
             {
-                if (interlocked_cmpxchg( &crit->LockCount, 0, -1 ) == -1) goto done;
+                if (interlocked_cmpxchg( &crit->LockCount, 0, -1 ) == -1)
+                {
+                    spins = count;
+                    goto done;
+                }
             }
             small_pause();
         }
+        spins = -1;
     }
 
     if (interlocked_inc( &crit->LockCount ))
@@ -573,6 +697,11 @@ NTSTATUS WINAPI RtlEnterCriticalSection( RTL_CRITICAL_SECTION *crit )
 done:
     crit->OwningThread   = ULongToHandle(GetCurrentThreadId());
     crit->RecursionCount = 1;
+    if (crit->DebugInfo)
+    {
+        crit->DebugInfo->EntryCount++;
+        if (crit->SpinCount) update_spin_average( crit, spins );
+    }
     return STATUS_SUCCESS;
 }
 
@@ -602,6 +731,7 @@ BOOL WINAPI RtlTryEnterCriticalSection( RTL_CRITICAL_SECTION *crit )
     {
         crit->OwningThread   = ULongToHandle(GetCurrentThreadId());
         crit->RecursionCount = 1;
+        if (crit->DebugInfo) crit->DebugInfo->EntryCount++;
         ret = TRUE;
     }
     else if (crit->OwningThread == ULongToHandle(GetCurrentThreadId()))
@@ -686,3 +816,37 @@ NTSTATUS WINAPI RtlLeaveCriticalSection( RTL_CRITICAL_SECTION *crit )
     }
     return STATUS_SUCCESS;
 }
+
+
+/***********************************************************************
+ *           RtlDumpCriticalSectionStats   (NTDLL.@)
+ *
+ * Prints the contention statistics of all the critical sections that
+ * were contended at least once.
+ *
+ * PARAMS
+ *  None.
+ *
+ * RETURNS
+ *  Nothing.
+ */
+void WINAPI RtlDumpCriticalSectionStats(void)
+{
+    unsigned int i;
+
+    lock_crit_stats();
+    for (i = 0; i < CRIT_STATS_SIZE; i++)
+    {
+        RTL_CRITICAL_SECTION *crit = crit_stats[i].crit;
+        RTL_CRITICAL_SECTION_DEBUG *debug;
+        const char *name;
+
+        if (!crit || !(debug = crit->DebugInfo)) continue;
+        name = (const char *)debug->Spare[0];
+        MESSAGE( "section %p %s: %u acquires, %u contended, %u.%03u ms waited, spin %d/%u\n",
+                 crit, debugstr_a(name ? name : "?"), debug->EntryCount, debug->ContentionCount,
+                 (ULONG)(crit_stats[i].wait_time / 1000000), (ULONG)(crit_stats[i].wait_time / 1000 % 1000),
+                 crit_stats[i].spin_average, (ULONG)crit->SpinCount );
+    }
+    unlock_crit_stats();
+}
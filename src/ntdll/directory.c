@@ -178,7 +178,7 @@ struct dir_data_buffer
 struct dir_data_names
 {
     const WCHAR *long_name;          /* long file name in Unicode */
-    const WCHAR *short_name;         /* short file name in Unicode */
+    const WCHAR *short_name;         /* short file name in Unicode, NULL if not generated */
     const char  *unix_name;          /* Unix file name in host encoding */
 };
 
@@ -190,6 +190,7 @@ struct dir_data
     struct file_identity    id;      /* directory file identity */
     struct dir_data_names  *names;   /* directory file names */
     struct dir_data_buffer *buffer;  /* head of data buffers list */
+    BOOL                    short_names; /* all short names have been generated */
 };
 
 static const unsigned int dir_data_buffer_initial_size = 4096;
@@ -291,6 +292,12 @@ static inline unsigned int dir_info_size( FILE_INFORMATION_CLASS class, unsigned
     }
 }
 
+/* check if the info class returns short names, which are expensive to generate */
+static inline BOOL class_needs_short_name( FILE_INFORMATION_CLASS class )
+{
+    return class == FileBothDirectoryInformation || class == FileIdBothDirectoryInformation;
+}
+
 static inline BOOL has_wildcard( const UNICODE_STRING *mask )
 {
     return (!mask ||
@@ -355,7 +362,8 @@ static BOOL add_dir_data_names( struct dir_data *data, const WCHAR *long_name,
         data->names = names;
     }
 
-    if (short_name[0])
+    if (!short_name) names[data->count].short_name = NULL;
+    else if (short_name[0])
     {
         if (!(names[data->count].short_name = add_dir_data_nameW( data, short_name ))) return FALSE;
     }
@@ -1349,6 +1357,23 @@ static ULONG hash_short_file_name( const UNICODE_STRING *name, LPWSTR buffer )
 }
 
 
+/***********************************************************************
+ *           generate_short_name
+ *
+ * Generate the short name for a long file name, if it is not a valid 8.3 name.
+ * 'buffer' must be at least 12 characters long.
+ * Returns length of short name in characters, 0 if no short name is needed.
+ */
+static ULONG generate_short_name( const UNICODE_STRING *name, LPWSTR buffer )
+{
+    BOOLEAN spaces;
+
+    if (!RtlIsNameLegalDOS8Dot3( name, NULL, &spaces ) || spaces)
+        return hash_short_file_name( name, buffer );
+    return 0;
+}
+
+
 /***********************************************************************
  *           match_filename
  *
@@ -1436,9 +1461,11 @@ static BOOLEAN match_filename( const UNICODE_STRING *name_str, const UNICODE_STR
  *           append_entry
  *
  * Add a file to the directory data if it matches the mask.
+ * If short_names is FALSE, a short name is only generated when it is needed
+ * to match the mask, otherwise it is left NULL.
  */
 static BOOL append_entry( struct dir_data *data, const char *long_name,
-                          const char *short_name, const UNICODE_STRING *mask )
+                          const char *short_name, const UNICODE_STRING *mask, BOOL short_names )
 {
     int i, long_len, short_len;
     WCHAR long_nameW[MAX_DIR_ENTRY_LEN + 1];
@@ -1453,6 +1480,12 @@ static BOOL append_entry( struct dir_data *data, const char *long_name,
     str.Length = long_len * sizeof(WCHAR);
     str.MaximumLength = sizeof(long_nameW);
 
+    if (!short_names && !short_name && (!mask || match_filename( &str, mask )))
+    {
+        TRACE( "long %s mask %s\n", debugstr_w( long_nameW ), debugstr_us( mask ));
+        return add_dir_data_names( data, long_nameW, NULL, long_name );
+    }
+
     if (short_name)
     {
         short_len = ntdll_umbstowcs( 0, short_name, strlen(short_name),
@@ -1460,14 +1493,7 @@ static BOOL append_entry( struct dir_data *data, const char *long_name,
         if (short_len == -1) short_len = sizeof(short_nameW) / sizeof(WCHAR) - 1;
         for (i = 0; i < short_len; i++) short_nameW[i] = toupperW( short_nameW[i] );
     }
-    else  /* generate a short name if necessary */
-    {
-        BOOLEAN spaces;
-
-        short_len = 0;
-        if (!RtlIsNameLegalDOS8Dot3( &str, NULL, &spaces ) || spaces)
-            short_len = hash_short_file_name( &str, short_nameW );
-    }
+    else short_len = generate_short_name( &str, short_nameW );  /* generate a short name if necessary */
     short_nameW[short_len] = 0;
 
     TRACE( "long %s short %s mask %s\n",
@@ -1633,7 +1659,8 @@ static KERNEL_DIRENT *start_vfat_ioctl( int fd )
  *
  * Read a directory using the VFAT ioctl; helper for NtQueryDirectoryFile.
  */
-static NTSTATUS read_directory_data_vfat( struct dir_data *data, int fd, const UNICODE_STRING *mask )
+static NTSTATUS read_directory_data_vfat( struct dir_data *data, int fd, const UNICODE_STRING *mask,
+                                          BOOL short_names )
 {
     char *short_name, *long_name;
     size_t len;
@@ -1645,8 +1672,8 @@ static NTSTATUS read_directory_data_vfat( struct dir_data *data, int fd, const U
 
     lseek( fd, 0, SEEK_SET );
 
-    if (!append_entry( data, ".", NULL, mask )) goto done;
-    if (!append_entry( data, "..", NULL, mask )) goto done;
+    if (!append_entry( data, ".", NULL, mask, short_names )) goto done;
+    if (!append_entry( data, "..", NULL, mask, short_names )) goto done;
 
     while (ioctl( fd, VFAT_IOCTL_READDIR_BOTH, (long)de ) != -1)
     {
@@ -1669,7 +1696,7 @@ static NTSTATUS read_directory_data_vfat( struct dir_data *data, int fd, const U
             long_name = de[0].d_name;
             short_name = NULL;
         }
-        if (!append_entry( data, long_name, short_name, mask )) goto done;
+        if (!append_entry( data, long_name, short_name, mask, short_names )) goto done;
     }
     status = STATUS_SUCCESS;
 done:
@@ -1686,7 +1713,8 @@ done:
  * Read a single file from a directory by determining whether the file
  * identified by mask exists using getattrlist.
  */
-static NTSTATUS read_directory_data_getattrlist( struct dir_data *data, const char *unix_name )
+static NTSTATUS read_directory_data_getattrlist( struct dir_data *data, const char *unix_name,
+                                                 BOOL short_names )
 {
     struct attrlist attrlist;
 #include "pshpack4.h"
@@ -1716,7 +1744,7 @@ static NTSTATUS read_directory_data_getattrlist( struct dir_data *data, const ch
 
     TRACE( "found %s\n", buffer.name );
 
-    if (!append_entry( data, buffer.name, NULL, NULL )) return STATUS_NO_MEMORY;
+    if (!append_entry( data, buffer.name, NULL, NULL, short_names )) return STATUS_NO_MEMORY;
 
     return STATUS_SUCCESS;
 }
@@ -1729,7 +1757,7 @@ static NTSTATUS read_directory_data_getattrlist( struct dir_data *data, const ch
  * Read a single file from a directory by determining whether the file
  * identified by mask exists using stat.
  */
-static NTSTATUS read_directory_data_stat( struct dir_data *data, const char *unix_name )
+static NTSTATUS read_directory_data_stat( struct dir_data *data, const char *unix_name, BOOL short_names )
 {
     struct stat st;
 
@@ -1739,7 +1767,7 @@ static NTSTATUS read_directory_data_stat( struct dir_data *data, const char *uni
 
     TRACE( "found %s\n", unix_name );
 
-    if (!append_entry( data, unix_name, NULL, NULL )) return STATUS_NO_MEMORY;
+    if (!append_entry( data, unix_name, NULL, NULL, short_names )) return STATUS_NO_MEMORY;
 
     return STATUS_SUCCESS;
 }
@@ -1750,7 +1778,8 @@ static NTSTATUS read_directory_data_stat( struct dir_data *data, const char *uni
  *
  * Read a directory using the POSIX readdir interface; helper for NtQueryDirectoryFile.
  */
-static NTSTATUS read_directory_data_readdir( struct dir_data *data, const UNICODE_STRING *mask )
+static NTSTATUS read_directory_data_readdir( struct dir_data *data, const UNICODE_STRING *mask,
+                                             BOOL short_names )
 {
     struct dirent *de;
     NTSTATUS status = STATUS_NO_MEMORY;
@@ -1758,12 +1787,12 @@ static NTSTATUS read_directory_data_readdir( struct dir_data *data, const UNICOD
 
     if (!dir) return STATUS_NO_SUCH_FILE;
 
-    if (!append_entry( data, ".", NULL, mask )) goto done;
-    if (!append_entry( data, "..", NULL, mask )) goto done;
+    if (!append_entry( data, ".", NULL, mask, short_names )) goto done;
+    if (!append_entry( data, "..", NULL, mask, short_names )) goto done;
     while ((de = readdir( dir )))
     {
         if (!strcmp( de->d_name, "." ) || !strcmp( de->d_name, ".." )) continue;
-        if (!append_entry( data, de->d_name, NULL, mask )) goto done;
+        if (!append_entry( data, de->d_name, NULL, mask, short_names )) goto done;
     }
     status = STATUS_SUCCESS;
 
@@ -1778,12 +1807,13 @@ done:
  *
  * Read the full contents of a directory, using one of the above helper functions.
  */
-static NTSTATUS read_directory_data( struct dir_data *data, int fd, const UNICODE_STRING *mask )
+static NTSTATUS read_directory_data( struct dir_data *data, int fd, const UNICODE_STRING *mask,
+                                     BOOL short_names )
 {
     NTSTATUS status;
 
 #ifdef VFAT_IOCTL_READDIR_BOTH
-    if (!(status = read_directory_data_vfat( data, fd, mask ))) return status;
+    if (!(status = read_directory_data_vfat( data, fd, mask, short_names ))) return status;
 #endif
 
     if (!has_wildcard( mask ))
@@ -1798,13 +1828,13 @@ static NTSTATUS read_directory_data( struct dir_data *data, int fd, const UNICOD
         {
             unix_name[ret] = 0;
 #ifdef HAVE_GETATTRLIST
-            if (!(status = read_directory_data_getattrlist( data, unix_name ))) return status;
+            if (!(status = read_directory_data_getattrlist( data, unix_name, short_names ))) return status;
 #endif
-            if (!(status = read_directory_data_stat( data, unix_name ))) return status;
+            if (!(status = read_directory_data_stat( data, unix_name, short_names ))) return status;
         }
     }
 
-    return read_directory_data_readdir( data, mask );
+    return read_directory_data_readdir( data, mask, short_names );
 }
 
 
@@ -1824,8 +1854,10 @@ static int name_compare( const void *a, const void *b )
  *           init_cached_dir_data
  *
  * Initialize the cached directory contents.
+ * Short names are only generated if the info class requires them.
  */
-static NTSTATUS init_cached_dir_data( struct dir_data **data_ret, int fd, const UNICODE_STRING *mask )
+static NTSTATUS init_cached_dir_data( struct dir_data **data_ret, int fd, const UNICODE_STRING *mask,
+                                      FILE_INFORMATION_CLASS class )
 {
     struct dir_data *data;
     struct stat st;
@@ -1835,7 +1867,8 @@ static NTSTATUS init_cached_dir_data( struct dir_data **data_ret, int fd, const
     if (!(data = RtlAllocateHeap( GetProcessHeap(), HEAP_ZERO_MEMORY, sizeof(*data) )))
         return STATUS_NO_MEMORY;
 
-    if ((status = read_directory_data( data, fd, mask )))
+    data->short_names = class_needs_short_name( class );
+    if ((status = read_directory_data( data, fd, mask, data->short_names )))
     {
         free_dir_data( data );
         return status;
@@ -1850,9 +1883,10 @@ static NTSTATUS init_cached_dir_data( struct dir_data **data_ret, int fd, const
     if (data->count)
     {
         /* release unused space */
-        if (data->buffer)
+        if (data->buffer &&
             RtlReAllocateHeap( GetProcessHeap(), HEAP_REALLOC_IN_PLACE_ONLY, data->buffer,
-                               offsetof( struct dir_data_buffer, data[data->buffer->pos] ));
+                               offsetof( struct dir_data_buffer, data[data->buffer->pos] )))
+            data->buffer->size = data->buffer->pos;  /* short names may still be added later */
         if (data->count < data->size)
             RtlReAllocateHeap( GetProcessHeap(), HEAP_REALLOC_IN_PLACE_ONLY, data->names,
                                data->count * sizeof(*data->names) );
@@ -1872,13 +1906,44 @@ static NTSTATUS init_cached_dir_data( struct dir_data **data_ret, int fd, const
 }
 
 
+/***********************************************************************
+ *           add_dir_data_short_names
+ *
+ * Generate the short names that were skipped when the directory was read.
+ */
+static BOOL add_dir_data_short_names( struct dir_data *data )
+{
+    static const WCHAR empty[1];
+    WCHAR short_nameW[13];
+    UNICODE_STRING str;
+    unsigned int i, len;
+
+    for (i = 0; i < data->count; i++)
+    {
+        if (data->names[i].short_name) continue;
+
+        str.Buffer = (WCHAR *)data->names[i].long_name;
+        str.Length = str.MaximumLength = strlenW( str.Buffer ) * sizeof(WCHAR);
+        if (!(len = generate_short_name( &str, short_nameW )))
+        {
+            data->names[i].short_name = empty;
+            continue;
+        }
+        short_nameW[len] = 0;
+        if (!(data->names[i].short_name = add_dir_data_nameW( data, short_nameW ))) return FALSE;
+    }
+    data->short_names = TRUE;
+    return TRUE;
+}
+
+
 /***********************************************************************
  *           get_cached_dir_data
  *
  * Retrieve the cached directory data, or initialize it if necessary.
  */
 static NTSTATUS get_cached_dir_data( HANDLE handle, struct dir_data **data_ret, int fd,
-                                     const UNICODE_STRING *mask )
+                                     const UNICODE_STRING *mask, FILE_INFORMATION_CLASS class )
 {
     unsigned int i;
     int entry = -1, free_entries[16];
@@ -1923,7 +1988,10 @@ static NTSTATUS get_cached_dir_data( HANDLE handle, struct dir_data **data_ret,
         dir_data_cache_size = size;
     }
 
-    if (!dir_data_cache[entry]) status = init_cached_dir_data( &dir_data_cache[entry], fd, mask );
+    if (!dir_data_cache[entry]) status = init_cached_dir_data( &dir_data_cache[entry], fd, mask, class );
+    else if (class_needs_short_name( class ) && !dir_data_cache[entry]->short_names &&
+             !add_dir_data_short_names( dir_data_cache[entry] ))
+        status = STATUS_NO_MEMORY;
 
     *data_ret = dir_data_cache[entry];
     return status;
@@ -1994,7 +2062,7 @@ NTSTATUS WINAPI NtQueryDirectoryFile( HANDLE handle, HANDLE event,
     cwd = open( ".", O_RDONLY );
     if (fchdir( fd ) != -1)
     {
-        if (!(status = get_cached_dir_data( handle, &data, fd, mask )))
+        if (!(status = get_cached_dir_data( handle, &data, fd, mask, info_class )))
         {
             union file_directory_info *last_info = NULL;
 
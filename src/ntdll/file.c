@@ -42,6 +42,9 @@
 #ifdef HAVE_SYS_TIME_H
 # include <sys/time.h>
 #endif
+#ifdef HAVE_SYS_UIO_H
+# include <sys/uio.h>
+#endif
 #ifdef HAVE_SYS_IOCTL_H
 #include <sys/ioctl.h>
 #endif
@@ -1029,6 +1032,26 @@ err:
 }
 
 
+#ifndef IOV_MAX
+#define IOV_MAX 1024
+#endif
+
+/* fill an iovec array with the remaining pages of a scatter/gather request,
+ * starting at offset pos of the first segment */
+static int get_segments_iovec( struct iovec *iov, const FILE_SEGMENT_ELEMENT *segments, ULONG pos, ULONG length )
+{
+    int count;
+
+    for (count = 0; length && count < IOV_MAX; count++)
+    {
+        iov[count].iov_base = (char *)segments[count].Buffer + pos;
+        iov[count].iov_len  = min( length, page_size - pos );
+        length -= iov[count].iov_len;
+        pos = 0;
+    }
+    return count;
+}
+
 /******************************************************************************
  *  NtReadFileScatter   [NTDLL.@]
  *  ZwReadFileScatter   [NTDLL.@]
@@ -1037,7 +1060,8 @@ NTSTATUS WINAPI NtReadFileScatter( HANDLE file, HANDLE event, PIO_APC_ROUTINE ap
                                    PIO_STATUS_BLOCK io_status, FILE_SEGMENT_ELEMENT *segments,
                                    ULONG length, PLARGE_INTEGER offset, PULONG key )
 {
-    int result, unix_handle, needs_close;
+    struct iovec iov[IOV_MAX];
+    int result, count, unix_handle, needs_close;
     unsigned int options;
     NTSTATUS status;
     ULONG pos = 0, total = 0;
@@ -1064,11 +1088,11 @@ NTSTATUS WINAPI NtReadFileScatter( HANDLE file, HANDLE event, PIO_APC_ROUTINE ap
 
     while (length)
     {
+        count = get_segments_iovec( iov, segments, pos, length );
         if (offset && offset->QuadPart != FILE_USE_FILE_POINTER_POSITION)
-            result = pread( unix_handle, (char *)segments->Buffer + pos,
-                            min( length - pos, page_size - pos ), offset->QuadPart + total );
+            result = preadv( unix_handle, iov, count, offset->QuadPart + total );
         else
-            result = read( unix_handle, (char *)segments->Buffer + pos, min( length - pos, page_size - pos ) );
+            result = readv( unix_handle, iov, count );
 
         if (result == -1)
         {
@@ -1079,11 +1103,9 @@ NTSTATUS WINAPI NtReadFileScatter( HANDLE file, HANDLE event, PIO_APC_ROUTINE ap
         if (!result) break;
         total += result;
         length -= result;
-        if ((pos += result) == page_size)
-        {
-            pos = 0;
-            segments++;
-        }
+        pos += result;
+        segments += pos / page_size;
+        pos %= page_size;
     }
 
     if (total == 0) status = STATUS_END_OF_FILE;
@@ -1431,7 +1453,8 @@ NTSTATUS WINAPI NtWriteFileGather( HANDLE file, HANDLE event, PIO_APC_ROUTINE ap
                                    PIO_STATUS_BLOCK io_status, FILE_SEGMENT_ELEMENT *segments,
                                    ULONG length, PLARGE_INTEGER offset, PULONG key )
 {
-    int result, unix_handle, needs_close;
+    struct iovec iov[IOV_MAX];
+    int result, count, unix_handle, needs_close;
     unsigned int options;
     NTSTATUS status;
     ULONG pos = 0, total = 0;
@@ -1459,11 +1482,11 @@ NTSTATUS WINAPI NtWriteFileGather( HANDLE file, HANDLE event, PIO_APC_ROUTINE ap
 
     while (length)
     {
+        count = get_segments_iovec( iov, segments, pos, length );
         if (offset && offset->QuadPart != FILE_USE_FILE_POINTER_POSITION)
-            result = pwrite( unix_handle, (char *)segments->Buffer + pos,
-                             page_size - pos, offset->QuadPart + total );
+            result = pwritev( unix_handle, iov, count, offset->QuadPart + total );
         else
-            result = write( unix_handle, (char *)segments->Buffer + pos, page_size - pos );
+            result = writev( unix_handle, iov, count );
 
         if (result == -1)
         {
@@ -1483,11 +1506,9 @@ NTSTATUS WINAPI NtWriteFileGather( HANDLE file, HANDLE event, PIO_APC_ROUTINE ap
         }
         total += result;
         length -= result;
-        if ((pos += result) == page_size)
-        {
-            pos = 0;
-            segments++;
-        }
+        pos += result;
+        segments += pos / page_size;
+        pos %= page_size;
     }
 
     send_completion = cvalue != 0;
@@ -1760,88 +1781,31 @@ NTSTATUS WINAPI NtFsControlFile(HANDLE handle, HANDLE event, PIO_APC_ROUTINE apc
 }
 
 
+#endif
+
 struct read_changes_fileio
 {
-    struct async_fileio io;
-    void               *buffer;
-    ULONG               buffer_size;
-    ULONG               data_size;
-    char                data[1];
+    struct sync_thread *thread;
+    HANDLE              event;
+    PIO_APC_ROUTINE     apc;
+    void               *apc_context;
 };
 
-static NTSTATUS read_changes_apc( void *user, IO_STATUS_BLOCK *iosb, NTSTATUS status )
+/* called by the change notification engine when a request completes, usually from
+ * its notification thread, which has no TEB and can't make server requests */
+static void read_changes_apc( void *user, IO_STATUS_BLOCK *iosb )
 {
     struct read_changes_fileio *fileio = user;
-    int size = 0;
 
-    if (status == STATUS_ALERTED)
+    /* setting an event is a plain futex operation, it works from any thread */
+    if (fileio->event) NtSetEvent( fileio->event, NULL );
+    if (fileio->apc)
     {
-        SERVER_START_REQ( read_change )
-        {
-            req->handle = wine_server_obj_handle( fileio->io.handle );
-            wine_server_set_reply( req, fileio->data, fileio->data_size );
-            status = wine_server_call( req );
-            size = wine_server_reply_size( reply );
-        }
-        SERVER_END_REQ;
-
-        if (status == STATUS_SUCCESS && fileio->buffer)
-        {
-            FILE_NOTIFY_INFORMATION *pfni = fileio->buffer;
-            int i, left = fileio->buffer_size;
-            DWORD *last_entry_offset = NULL;
-            struct filesystem_event *event = (struct filesystem_event*)fileio->data;
-
-            while (size && left >= sizeof(*pfni))
-            {
-                /* convert to an NT style path */
-                for (i = 0; i < event->len; i++)
-                    if (event->name[i] == '/') event->name[i] = '\\';
-
-                pfni->Action = event->action;
-                pfni->FileNameLength = ntdll_umbstowcs( 0, event->name, event->len, pfni->FileName,
-                             (left - offsetof(FILE_NOTIFY_INFORMATION, FileName)) / sizeof(WCHAR));
-                last_entry_offset = &pfni->NextEntryOffset;
-
-                if (pfni->FileNameLength == -1 || pfni->FileNameLength == -2) break;
-
-                i = offsetof(FILE_NOTIFY_INFORMATION, FileName[pfni->FileNameLength]);
-                pfni->FileNameLength *= sizeof(WCHAR);
-                pfni->NextEntryOffset = i;
-                pfni = (FILE_NOTIFY_INFORMATION*)((char*)pfni + i);
-                left -= i;
-
-                i = (offsetof(struct filesystem_event, name[event->len])
-                     + sizeof(int)-1) / sizeof(int) * sizeof(int);
-                event = (struct filesystem_event*)((char*)event + i);
-                size -= i;
-            }
-
-            if (size)
-            {
-                status = STATUS_NOTIFY_ENUM_DIR;
-                size = 0;
-            }
-            else
-            {
-                if (last_entry_offset) *last_entry_offset = 0;
-                size = fileio->buffer_size - left;
-            }
-        }
-        else
-        {
-            status = STATUS_NOTIFY_ENUM_DIR;
-            size = 0;
-        }
-    }
-
-    if (status != STATUS_PENDING)
-    {
-        iosb->u.Status = status;
-        iosb->Information = size;
-        release_fileio( &fileio->io );
+        sync_queue_apc( fileio->thread, (PNTAPCFUNC)fileio->apc,
+                        (ULONG_PTR)fileio->apc_context, (ULONG_PTR)iosb, 0 );
+        sync_release_thread( fileio->thread );
     }
-    return status;
+    RtlFreeHeap( GetProcessHeap(), 0, fileio );
 }
 
 #define FILE_NOTIFY_ALL        (  \
@@ -1856,14 +1820,19 @@ static NTSTATUS read_changes_apc( void *user, IO_STATUS_BLOCK *iosb, NTSTATUS st
 
 /******************************************************************************
  *  NtNotifyChangeDirectoryFile [NTDLL.@]
+ *
+ * The request always completes asynchronously, through the event and the
+ * APC. There are no I/O completion ports without the server, so a handle
+ * can't be bound to one.
  */
 NTSTATUS WINAPI NtNotifyChangeDirectoryFile( HANDLE handle, HANDLE event, PIO_APC_ROUTINE apc,
                                              void *apc_context, PIO_STATUS_BLOCK iosb, void *buffer,
                                              ULONG buffer_size, ULONG filter, BOOLEAN subtree )
 {
     struct read_changes_fileio *fileio;
+    int unix_fd = HandleToULong( handle );
+    struct stat st;
     NTSTATUS status;
-    ULONG size = max( 4096, buffer_size );
 
     TRACE( "%p %p %p %p %p %p %u %u %d\n",
            handle, event, apc, apc_context, iosb, buffer, buffer_size, filter, subtree );
@@ -1871,28 +1840,31 @@ NTSTATUS WINAPI NtNotifyChangeDirectoryFile( HANDLE handle, HANDLE event, PIO_AP
     if (!iosb) return STATUS_ACCESS_VIOLATION;
     if (filter == 0 || (filter & ~FILE_NOTIFY_ALL)) return STATUS_INVALID_PARAMETER;
 
-    fileio = (struct read_changes_fileio *)alloc_fileio( offsetof(struct read_changes_fileio, data[size]),
-                                                         read_changes_apc, handle );
-    if (!fileio) return STATUS_NO_MEMORY;
+    if (fstat( unix_fd, &st ) == -1) return FILE_GetNtStatus();
+    if (!S_ISDIR( st.st_mode )) return STATUS_INVALID_PARAMETER;
 
-    fileio->buffer      = buffer;
-    fileio->buffer_size = buffer_size;
-    fileio->data_size   = size;
+    if (!(fileio = RtlAllocateHeap( GetProcessHeap(), 0, sizeof(*fileio) ))) return STATUS_NO_MEMORY;
+    fileio->event       = event;
+    fileio->apc         = apc;
+    fileio->apc_context = apc_context;
+    /* the APC has to run in the caller, not on the notification thread */
+    fileio->thread      = apc ? sync_get_current_thread() : NULL;
 
-    SERVER_START_REQ( read_directory_changes )
+    if (event) NtResetEvent( event, NULL );
+
+    iosb->u.Status = STATUS_PENDING;
+    status = change_read_directory( handle, unix_fd, filter, subtree, buffer, buffer_size,
+                                    iosb, read_changes_apc, fileio );
+    if (status != STATUS_PENDING && iosb->u.Status == STATUS_PENDING)
     {
-        req->filter    = filter;
-        req->want_data = (buffer != NULL);
-        req->subtree   = subtree;
-        req->async     = server_async( handle, &fileio->io, event, apc, apc_context, iosb );
-        status = wine_server_call( req );
+        /* the request has been rejected, the completion routine will never run */
+        if (fileio->thread) sync_release_thread( fileio->thread );
+        RtlFreeHeap( GetProcessHeap(), 0, fileio );
     }
-    SERVER_END_REQ;
-
-    if (status != STATUS_PENDING) RtlFreeHeap( GetProcessHeap(), 0, fileio );
     return status;
 }
 
+#if 0
 /******************************************************************************
  *  NtSetVolumeInformationFile		[NTDLL.@]
  *  ZwSetVolumeInformationFile		[NTDLL.@]
@@ -274,6 +274,7 @@ PVOID WINAPI RtlAllocateHeap( HANDLE heap, ULONG flags, SIZE_T size )
     }
     if (rounded_size < HEAP_MIN_DATA_SIZE) rounded_size = HEAP_MIN_DATA_SIZE;
 
+    if (flags & HEAP_ZERO_MEMORY) return calloc(1, rounded_size);
     return malloc(rounded_size);
 }
 
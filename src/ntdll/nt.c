@@ -1276,6 +1276,43 @@ void fill_cpu_info(void)
           cached_sci.Architecture, cached_sci.Level, cached_sci.Revision, cached_sci.FeatureSet);
 }
 
+/******************************************************************
+ *		get_tsc_info
+ *
+ * Check whether the time stamp counter is invariant, i.e. runs at a
+ * constant rate in all power states, so that it can be used as a clock.
+ * Also reports whether rdtscp is available, and the TSC frequency when
+ * the processor enumerates it (0 if it has to be measured).
+ */
+BOOL get_tsc_info( BOOL *rdtscp, ULONGLONG *frequency )
+{
+#if defined(__i386__) || defined(__x86_64__)
+    unsigned int regs[4], regs2[4];
+
+    *rdtscp = FALSE;
+    *frequency = 0;
+    if (!have_cpuid()) return FALSE;
+
+    do_cpuid( 0x80000000, regs );  /* get vendor cpuid level */
+    if (regs[0] < 0x80000007) return FALSE;
+    do_cpuid( 0x80000007, regs2 );  /* get advanced power management features */
+    if (!((regs2[3] >> 8) & 1)) return FALSE;
+    do_cpuid( 0x80000001, regs2 );  /* get vendor features */
+    *rdtscp = (regs2[3] >> 27) & 1;
+
+    do_cpuid( 0x00000000, regs );  /* get standard cpuid level */
+    if (regs[0] >= 0x15)
+    {
+        do_cpuid( 0x00000015, regs2 );  /* get TSC/crystal clock ratio and crystal frequency */
+        if (regs2[0] && regs2[1] && regs2[2])
+            *frequency = (ULONGLONG)regs2[2] * regs2[1] / regs2[0];
+    }
+    return TRUE;
+#else
+    return FALSE;
+#endif
+}
+
 static BOOL grow_logical_proc_buf(SYSTEM_LOGICAL_PROCESSOR_INFORMATION **pdata,
         SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX **pdataex, DWORD *max_len)
 {
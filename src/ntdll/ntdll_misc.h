@@ -81,6 +81,7 @@ extern void actctx_init(void) DECLSPEC_HIDDEN;
 extern void virtual_init(void) DECLSPEC_HIDDEN;
 extern void virtual_init_threading(void) DECLSPEC_HIDDEN;
 extern void fill_cpu_info(void) DECLSPEC_HIDDEN;
+extern BOOL get_tsc_info( BOOL *rdtscp, ULONGLONG *frequency ) DECLSPEC_HIDDEN;
 extern void heap_set_debug_flags( HANDLE handle ) DECLSPEC_HIDDEN;
 
 
@@ -155,7 +156,6 @@ extern NTSTATUS COMM_FlushBuffersFile( int fd ) DECLSPEC_HIDDEN;
 
 /* file I/O */
 struct stat;
-extern NTSTATUS FILE_GetNtStatus(void) DECLSPEC_HIDDEN;
 extern int get_file_info( const char *path, struct stat *st, ULONG *attr ) DECLSPEC_HIDDEN;
 extern NTSTATUS fill_file_info( const struct stat *st, ULONG attr, void *ptr,
                                 FILE_INFORMATION_CLASS class ) DECLSPEC_HIDDEN;
@@ -167,10 +167,30 @@ extern NTSTATUS DIR_get_unix_cwd( char **cwd ) DECLSPEC_HIDDEN;
 extern unsigned int DIR_get_drives_info( struct drive_info info[MAX_DOS_DRIVES] ) DECLSPEC_HIDDEN;
 #endif
 
+extern NTSTATUS FILE_GetNtStatus(void) DECLSPEC_HIDDEN;
 extern NTSTATUS file_id_to_unix_file_name( const OBJECT_ATTRIBUTES *attr, ANSI_STRING *unix_name_ret ) DECLSPEC_HIDDEN;
 extern NTSTATUS nt_to_unix_file_name_attr( const OBJECT_ATTRIBUTES *attr, ANSI_STRING *unix_name_ret,
                                            UINT disposition ) DECLSPEC_HIDDEN;
 
+/* directory change notification */
+typedef void (*change_callback_t)( void *user, IO_STATUS_BLOCK *iosb );
+extern NTSTATUS change_read_directory( HANDLE handle, int fd, ULONG filter, BOOLEAN subtree,
+                                       void *buffer, ULONG size, IO_STATUS_BLOCK *iosb,
+                                       change_callback_t callback, void *user ) DECLSPEC_HIDDEN;
+extern void change_close_directory( HANDLE handle ) DECLSPEC_HIDDEN;
+
+/* synchronization objects */
+extern NTSTATUS sync_wait_objects( DWORD count, const HANDLE *handles, BOOLEAN wait_any,
+                                   BOOLEAN alertable, const LARGE_INTEGER *timeout ) DECLSPEC_HIDDEN;
+extern NTSTATUS sync_delay_alertable( const LARGE_INTEGER *timeout ) DECLSPEC_HIDDEN;
+extern NTSTATUS sync_signal_object( HANDLE handle ) DECLSPEC_HIDDEN;
+extern void sync_close_object( HANDLE handle ) DECLSPEC_HIDDEN;
+struct sync_thread;
+extern struct sync_thread *sync_get_current_thread(void) DECLSPEC_HIDDEN;
+extern void sync_release_thread( struct sync_thread *thread ) DECLSPEC_HIDDEN;
+extern NTSTATUS sync_queue_apc( struct sync_thread *thread, PNTAPCFUNC func,
+                                ULONG_PTR arg1, ULONG_PTR arg2, ULONG_PTR arg3 ) DECLSPEC_HIDDEN;
+
 #if 0
 /* virtual memory */
 extern NTSTATUS virtual_map_section( HANDLE handle, PVOID *addr_ptr, ULONG zero_bits, SIZE_T commit_size,
@@ -204,6 +224,8 @@ extern NTSTATUS NTDLL_AddCompletion( HANDLE hFile, ULONG_PTR CompletionValue,
 extern int ntdll_umbstowcs(DWORD flags, const char* src, int srclen, WCHAR* dst, int dstlen) DECLSPEC_HIDDEN;
 extern int ntdll_wcstoumbs(DWORD flags, const WCHAR* src, int srclen, char* dst, int dstlen,
                            const char* defchar, int *used ) DECLSPEC_HIDDEN;
+extern char *ntdll_wcstoumbs_alloc( DWORD flags, const WCHAR *src, int srclen, char *buffer, int size,
+                                    int *len, int *used ) DECLSPEC_HIDDEN;
 
 extern int CDECL NTDLL__vsnprintf( char *str, SIZE_T len, const char *format, __ms_va_list args ) DECLSPEC_HIDDEN;
 extern int CDECL NTDLL__vsnwprintf( WCHAR *str, SIZE_T len, const WCHAR *format, __ms_va_list args ) DECLSPEC_HIDDEN;
@@ -391,6 +391,8 @@ NTSTATUS close_handle( HANDLE handle )
 {
     NTSTATUS ret;
     ret = 0;
+    change_close_directory( handle );
+    sync_close_object( handle );
     close ((int)handle);
 #if 0
     int fd = server_remove_fd_from_cache( handle );
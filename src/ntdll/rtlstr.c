@@ -84,6 +84,22 @@ int ntdll_wcstoumbs(DWORD flags, const WCHAR* src, int srclen, char* dst, int ds
     return wine_utf8_wcstombs( flags, src, srclen, dst, dstlen );
 }
 
+/* same as ntdll_wcstoumbs, but without a separate pass to compute the length: the result
+ * goes to buffer if it is sure to fit in size bytes, else to a heap block that the caller
+ * frees. The string is NUL-terminated and len doesn't include the terminator. */
+char *ntdll_wcstoumbs_alloc( DWORD flags, const WCHAR *src, int srclen, char *buffer, int size,
+                             int *len, int *used )
+{
+    int max = srclen * (unix_table ? unix_table->info.char_size : 3);
+    char *dst = buffer;
+
+    if (max >= size && !(dst = RtlAllocateHeap( GetProcessHeap(), 0, max + 1 ))) return NULL;
+    *len = srclen ? ntdll_wcstoumbs( flags, src, srclen, dst, max, NULL, used ) : 0;
+    if (!srclen && used) *used = 0;
+    dst[*len] = 0;
+    return dst;
+}
+
 /**************************************************************************
  *      RtlInitAnsiString   (NTDLL.@)
  *
@@ -459,11 +475,20 @@ LONG WINAPI RtlCompareUnicodeStrings( const WCHAR *s1, SIZE_T len1, const WCHAR
                                       BOOLEAN case_insensitive )
 {
     LONG ret = 0;
-    SIZE_T len = min( len1, len2 );
+    SIZE_T len = min( len1, len2 ), skip;
 
     if (case_insensitive)
     {
-        while (!ret && len--) ret = toupperW(*s1++) - toupperW(*s2++);
+        while (!ret && len)
+        {
+            /* ASCII chars that match ignoring case are skipped in bulk */
+            skip = wine_ascii_icmp_prefix( s1, s2, min( len, 0x7fffffff ));
+            s1 += skip;
+            s2 += skip;
+            if (!(len -= skip)) break;
+            ret = toupperW(*s1++) - toupperW(*s2++);
+            len--;
+        }
     }
     else
     {
@@ -559,17 +584,21 @@ BOOLEAN WINAPI RtlPrefixUnicodeString( const UNICODE_STRING *s1,
                                        const UNICODE_STRING *s2,
                                        BOOLEAN ignore_case )
 {
-    unsigned int i;
+    unsigned int i, len = s1->Length / sizeof(WCHAR);
 
     if (s1->Length > s2->Length) return FALSE;
     if (ignore_case)
     {
-        for (i = 0; i < s1->Length / sizeof(WCHAR); i++)
+        for (i = 0; i < len; i++)
+        {
+            i += wine_ascii_icmp_prefix( s1->Buffer + i, s2->Buffer + i, len - i );
+            if (i == len) break;
             if (toupperW(s1->Buffer[i]) != toupperW(s2->Buffer[i])) return FALSE;
+        }
     }
     else
     {
-        for (i = 0; i < s1->Length / sizeof(WCHAR); i++)
+        for (i = 0; i < len; i++)
             if (s1->Buffer[i] != s2->Buffer[i]) return FALSE;
     }
     return TRUE;
@@ -667,6 +696,49 @@ WCHAR WINAPI RtlAnsiCharToUnicodeChar(LPSTR *ansi)
 */
 
 
+/* convert to a unicode string in a single pass; a byte never gives more than one char,
+ * so an allocated buffer can be sized for the worst case up front, and the length only
+ * needs to be counted first when the caller buffer is smaller than that */
+static NTSTATUS mbs_to_unicode_string( const union cptable *table, UNICODE_STRING *uni,
+                                       const STRING *str, BOOLEAN doalloc )
+{
+    DWORD total;
+    int max, ret = 0;
+
+    if (doalloc)
+    {
+        max = str->Length;
+        if (max >= 0xffff / sizeof(WCHAR))
+        {
+            total = (wine_cp_mbstowcs( table, 0, str->Buffer, str->Length, NULL, 0 ) + 1) * sizeof(WCHAR);
+            if (total > 0xffff) return STATUS_INVALID_PARAMETER_2;
+        }
+        if (!(uni->Buffer = RtlAllocateHeap( GetProcessHeap(), 0, (max + 1) * sizeof(WCHAR) )))
+            return STATUS_NO_MEMORY;
+    }
+    else
+    {
+        max = (int)(uni->MaximumLength / sizeof(WCHAR)) - 1;  /* room for the terminator */
+        if (str->Length > max)
+        {
+            total = (wine_cp_mbstowcs( table, 0, str->Buffer, str->Length, NULL, 0 ) + 1) * sizeof(WCHAR);
+            if (total > 0xffff) return STATUS_INVALID_PARAMETER_2;
+            if (total > uni->MaximumLength)
+            {
+                uni->Length = total - sizeof(WCHAR);
+                return STATUS_BUFFER_OVERFLOW;
+            }
+        }
+    }
+
+    if (str->Length) ret = wine_cp_mbstowcs( table, 0, str->Buffer, str->Length, uni->Buffer, max );
+    uni->Length = ret * sizeof(WCHAR);
+    if (doalloc) uni->MaximumLength = uni->Length + sizeof(WCHAR);
+    uni->Buffer[ret] = 0;
+    return STATUS_SUCCESS;
+}
+
+
 /**************************************************************************
  *      RtlAnsiStringToUnicodeString   (NTDLL.@)
  *
@@ -686,21 +758,7 @@ NTSTATUS WINAPI RtlAnsiStringToUnicodeString(
     PCANSI_STRING ansi,  /* [I]   Ansi string to be converted */
     BOOLEAN doalloc)     /* [I]   TRUE=Allocate new buffer for uni, FALSE=Use existing buffer */
 {
-    DWORD total = RtlAnsiStringToUnicodeSize( ansi );
-
-    if (total > 0xffff) return STATUS_INVALID_PARAMETER_2;
-    uni->Length = total - sizeof(WCHAR);
-    if (doalloc)
-    {
-        uni->MaximumLength = total;
-        if (!(uni->Buffer = RtlAllocateHeap( GetProcessHeap(), 0, total )))
-            return STATUS_NO_MEMORY;
-    }
-    else if (total > uni->MaximumLength) return STATUS_BUFFER_OVERFLOW;
-
-    RtlMultiByteToUnicodeN( uni->Buffer, uni->Length, NULL, ansi->Buffer, ansi->Length );
-    uni->Buffer[uni->Length / sizeof(WCHAR)] = 0;
-    return STATUS_SUCCESS;
+    return mbs_to_unicode_string( ansi_table, uni, ansi, doalloc );
 }
 
 
@@ -723,21 +781,7 @@ NTSTATUS WINAPI RtlOemStringToUnicodeString(
     const STRING *oem,   /* [I]   Oem string to be converted */
     BOOLEAN doalloc)     /* [I]   TRUE=Allocate new buffer for uni, FALSE=Use existing buffer */
 {
-    DWORD total = RtlOemStringToUnicodeSize( oem );
-
-    if (total > 0xffff) return STATUS_INVALID_PARAMETER_2;
-    uni->Length = total - sizeof(WCHAR);
-    if (doalloc)
-    {
-        uni->MaximumLength = total;
-        if (!(uni->Buffer = RtlAllocateHeap( GetProcessHeap(), 0, total )))
-            return STATUS_NO_MEMORY;
-    }
-    else if (total > uni->MaximumLength) return STATUS_BUFFER_OVERFLOW;
-
-    RtlOemToUnicodeN( uni->Buffer, uni->Length, NULL, oem->Buffer, oem->Length );
-    uni->Buffer[uni->Length / sizeof(WCHAR)] = 0;
-    return STATUS_SUCCESS;
+    return mbs_to_unicode_string( oem_table, uni, oem, doalloc );
 }
 
 
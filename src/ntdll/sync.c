@@ -26,6 +26,7 @@
 
 #include <assert.h>
 #include <errno.h>
+#include <limits.h>
 #include <signal.h>
 #ifdef HAVE_SYS_TIME_H
 # include <sys/time.h>
@@ -42,6 +43,9 @@
 #ifdef HAVE_SCHED_H
 # include <sched.h>
 #endif
+#ifdef HAVE_SYS_SYSCALL_H
+# include <sys/syscall.h>
+#endif
 #include <string.h>
 #include <stdarg.h>
 #include <stdio.h>
@@ -173,6 +177,7 @@ NTSTATUS validate_open_object_attributes( const OBJECT_ATTRIBUTES *attr )
  *	Semaphores
  */
 
+#if 0
 /******************************************************************************
  *  NtCreateSemaphore (NTDLL.@)
  */
@@ -182,8 +187,6 @@ NTSTATUS WINAPI NtCreateSemaphore( OUT PHANDLE SemaphoreHandle,
                                    IN LONG InitialCount,
                                    IN LONG MaximumCount )
 {
-    return 0;
-#if 0
     NTSTATUS ret;
     data_size_t len;
     struct object_attributes *objattr;
@@ -206,8 +209,8 @@ NTSTATUS WINAPI NtCreateSemaphore( OUT PHANDLE SemaphoreHandle,
 
     RtlFreeHeap( GetProcessHeap(), 0, objattr );
     return ret;
-#endif
 }
+#endif
 
 #if 0
 /******************************************************************************
@@ -269,13 +272,12 @@ NTSTATUS WINAPI NtQuerySemaphore( HANDLE handle, SEMAPHORE_INFORMATION_CLASS cla
 
 #endif
 
+#if 0
 /******************************************************************************
  *  NtReleaseSemaphore (NTDLL.@)
  */
 NTSTATUS WINAPI NtReleaseSemaphore( HANDLE handle, ULONG count, PULONG previous )
 {
-    return 0;
-#if 0
     NTSTATUS ret;
     SERVER_START_REQ( release_semaphore )
     {
@@ -288,8 +290,8 @@ NTSTATUS WINAPI NtReleaseSemaphore( HANDLE handle, ULONG count, PULONG previous
     }
     SERVER_END_REQ;
     return ret;
-#endif
 }
+#endif
 
 #if 0
 /*
@@ -999,6 +1001,20 @@ NTSTATUS WINAPI NtQueryTimer(
 }
 
 
+#endif
+
+/* timers are high resolution timers of the kernel, they don't depend on a
+ * global tick; the resolution a process asks for is only remembered */
+static ULONG timer_resolution_request;
+
+static ULONG get_timer_resolution(void)
+{
+    struct timespec res;
+
+    if (clock_getres( CLOCK_MONOTONIC, &res ) || res.tv_sec) return 156250;
+    return max( (res.tv_nsec + 99) / 100, 1 );
+}
+
 /******************************************************************************
  * NtQueryTimerResolution [NTDLL.@]
  */
@@ -1006,13 +1022,14 @@ NTSTATUS WINAPI NtQueryTimerResolution(OUT ULONG* min_resolution,
                                        OUT ULONG* max_resolution,
                                        OUT ULONG* current_resolution)
 {
-    FIXME("(%p,%p,%p), stub!\n",
-          min_resolution, max_resolution, current_resolution);
+    TRACE("(%p,%p,%p)\n", min_resolution, max_resolution, current_resolution);
 
-    return STATUS_NOT_IMPLEMENTED;
-}
+    if (!min_resolution || !max_resolution || !current_resolution) return STATUS_ACCESS_VIOLATION;
 
-#endif
+    *min_resolution = 156250;  /* the coarsest one, as on Windows */
+    *max_resolution = *current_resolution = get_timer_resolution();
+    return STATUS_SUCCESS;
+}
 
 /******************************************************************************
  * NtSetTimerResolution [NTDLL.@]
@@ -1021,10 +1038,18 @@ NTSTATUS WINAPI NtSetTimerResolution(IN ULONG resolution,
                                      IN BOOLEAN set_resolution,
                                      OUT ULONG* current_resolution )
 {
-    FIXME("(%u,%u,%p), stub!\n",
-          resolution, set_resolution, current_resolution);
+    TRACE("(%u,%u,%p)\n", resolution, set_resolution, current_resolution);
 
-    return STATUS_NOT_IMPLEMENTED;
+    if (!current_resolution) return STATUS_ACCESS_VIOLATION;
+
+    *current_resolution = get_timer_resolution();
+    if (set_resolution)
+    {
+        timer_resolution_request = resolution;
+        return STATUS_SUCCESS;
+    }
+    if (!interlocked_xchg( (int *)&timer_resolution_request, 0 )) return STATUS_TIMER_RESOLUTION_NOT_SET;
+    return STATUS_SUCCESS;
 }
 
 
@@ -1037,9 +1062,14 @@ static NTSTATUS wait_objects( DWORD count, const HANDLE *handles,
 {
     select_op_t select_op;
     UINT i, flags = SELECT_INTERRUPTIBLE;
+    NTSTATUS ret;
 
     if (!count || count > MAXIMUM_WAIT_OBJECTS) return STATUS_INVALID_PARAMETER_1;
 
+    /* events, mutexes and semaphores live in shared memory, other handles are fds */
+    if ((ret = sync_wait_objects( count, handles, wait_any, alertable, timeout )) != STATUS_NOT_IMPLEMENTED)
+        return ret;
+
     if (alertable) flags |= SELECT_ALERTABLE;
     select_op.wait.op = wait_any ? SELECT_WAIT : SELECT_WAIT_ALL;
     for (i = 0; i < count; i++) select_op.wait.handles[i] = wine_server_obj_handle( handles[i] );
@@ -1075,9 +1105,16 @@ NTSTATUS WINAPI NtSignalAndWaitForSingleObject( HANDLE hSignalObject, HANDLE hWa
 {
     select_op_t select_op;
     UINT flags = SELECT_INTERRUPTIBLE;
+    NTSTATUS ret;
 
     if (!hSignalObject) return STATUS_INVALID_HANDLE;
 
+    if ((ret = sync_signal_object( hSignalObject )) != STATUS_NOT_IMPLEMENTED)
+    {
+        if (ret) return ret;
+        return wait_objects( 1, &hWaitObject, FALSE, alertable, timeout );
+    }
+
     if (alertable) flags |= SELECT_ALERTABLE;
     select_op.signal_and_wait.op = SELECT_SIGNAL_AND_WAIT;
     select_op.signal_and_wait.wait = wine_server_obj_handle( hWaitObject );
@@ -1105,9 +1142,8 @@ NTSTATUS WINAPI NtYieldExecution(void)
  */
 NTSTATUS WINAPI NtDelayExecution( BOOLEAN alertable, const LARGE_INTEGER *timeout )
 {
-    /* if alertable, we need to query the server */
-    if (alertable)
-        return server_select( NULL, 0, SELECT_INTERRUPTIBLE | SELECT_ALERTABLE, timeout );
+    /* APCs are queued in process, no need to ask the server */
+    if (alertable) return sync_delay_alertable( timeout );
 
     if (!timeout || timeout->QuadPart == TIMEOUT_INFINITE)  /* sleep forever */
     {
@@ -1562,138 +1598,218 @@ DWORD WINAPI RtlRunOnceExecuteOnce( RTL_RUN_ONCE *once, PRTL_RUN_ONCE_INIT_FN fu
 
     return RtlRunOnceComplete( once, 0, context ? *context : NULL );
 }
+#endif
+
+#ifdef __linux__
+
+#define FUTEX_PRIVATE_FLAG_     128
+#define FUTEX_WAIT_BITSET_      9
+#define FUTEX_WAKE_BITSET_      10
+#define FUTEX_CMP_REQUEUE_      4
+#define FUTEX_BITSET_MATCH_ANY_ 0xffffffff
+
+static int futex_private = FUTEX_PRIVATE_FLAG_;
+
+static inline int futex_wait_bitset( int *addr, int val, struct timespec *timeout, int mask )
+{
+    return syscall( __NR_futex, addr, FUTEX_WAIT_BITSET_ | futex_private, val, timeout, 0, mask );
+}
+
+static inline int futex_wake_bitset( int *addr, int val, int mask )
+{
+    return syscall( __NR_futex, addr, FUTEX_WAKE_BITSET_ | futex_private, val, NULL, 0, mask );
+}
+
+static inline int futex_cmp_requeue( int *addr, int wake, int requeue, int *addr2, int val )
+{
+    return syscall( __NR_futex, addr, FUTEX_CMP_REQUEUE_ | futex_private, wake, (void *)(ULONG_PTR)requeue,
+                    addr2, val );
+}
+
+static inline int use_futexes(void)
+{
+    static int supported = -1;
+
+    if (supported == -1)
+    {
+        futex_wait_bitset( &supported, 10, NULL, FUTEX_BITSET_MATCH_ANY_ );
+        if (errno == ENOSYS)
+        {
+            futex_private = 0;
+            futex_wait_bitset( &supported, 10, NULL, FUTEX_BITSET_MATCH_ANY_ );
+        }
+        supported = (errno != ENOSYS);
+    }
+    return supported;
+}
+
+#else  /* __linux__ */
+
+#define FUTEX_BITSET_MATCH_ANY_ 0xffffffff
+
+static inline int use_futexes(void) { return 0; }
+static inline int futex_wait_bitset( int *addr, int val, struct timespec *timeout, int mask ) { return 0; }
+static inline int futex_wake_bitset( int *addr, int val, int mask ) { return 0; }
+static inline int futex_cmp_requeue( int *addr, int wake, int requeue, int *addr2, int val ) { return -1; }
+
+#endif  /* __linux__ */
+
+/* wait until *addr no longer contains val, or something wakes the thread;
+ * without futexes this just yields, callers re-check their condition anyway */
+static NTSTATUS futex_wait_value( int *addr, int val, const LARGE_INTEGER *timeout, int mask )
+{
+    struct timespec timespec, *ts = NULL;
+
+    if (!use_futexes())
+    {
+        NtYieldExecution();
+        return STATUS_SUCCESS;
+    }
+    if (timeout)
+    {
+        LONGLONG diff;
+
+        if (timeout->QuadPart > 0)
+        {
+            LARGE_INTEGER now;
+            NtQuerySystemTime( &now );
+            diff = max( timeout->QuadPart - now.QuadPart, 0 );
+        }
+        else diff = -timeout->QuadPart;
+
+        /* FUTEX_WAIT_BITSET takes an absolute CLOCK_MONOTONIC deadline */
+        clock_gettime( CLOCK_MONOTONIC, &timespec );
+        timespec.tv_sec  += diff / 10000000;
+        timespec.tv_nsec += (diff % 10000000) * 100;
+        if (timespec.tv_nsec >= 1000000000)
+        {
+            timespec.tv_sec++;
+            timespec.tv_nsec -= 1000000000;
+        }
+        ts = &timespec;
+    }
+    if (futex_wait_bitset( addr, val, ts, mask ) == -1 && errno == ETIMEDOUT) return STATUS_TIMEOUT;
+    return STATUS_SUCCESS;
+}
+
+static inline void small_pause(void)
+{
+#if defined(__i386__) || defined(__x86_64__)
+    __asm__ __volatile__( "rep;nop" : : : "memory" );
+#else
+    __asm__ __volatile__( "" : : : "memory" );
+#endif
+}
 
 
 /* SRW locks implementation
  *
- * The memory layout used by the lock is:
+ * The lock is a single 32-bit futex word:
  *
- * 32 31            16               0
- *  ________________ ________________
- * | X| #exclusive  |    #shared     |
- *  ¯¯¯¯¯¯¯¯¯¯¯¯¯¯¯¯¯¯¯¯¯¯¯¯¯¯¯¯¯¯¯¯¯
- * Since there is no space left for a separate counter of shared access
- * threads inside the locked section the #shared field is used for multiple
- * purposes. The following table lists all possible states the lock can be
- * in, notation: [X, #exclusive, #shared]:
+ *     31 - set while the lock is owned exclusively
+ *     30 - there may be threads waiting for exclusive access
+ *     29 - there may be threads waiting for shared access
+ *   28-0 - number of threads owning the lock in shared mode
  *
- * [0,   0,   N] -> locked by N shared access threads, if N=0 it's unlocked
- * [0, >=1, >=1] -> threads are requesting exclusive locks, but there are
- * still shared access threads inside. #shared should not be incremented
- * anymore!
- * [1, >=1, >=0] -> lock is owned by an exclusive thread and the #shared
- * counter can be used again to count the number of threads waiting in the
- * queue for shared access.
+ * Writers are preferred: as soon as a thread waits for exclusive access,
+ * new shared owners are queued behind it. The waiter bits are only hints;
+ * a thread that had to wait sets the exclusive waiter bit again when it
+ * gets the lock, since it can't tell whether it was the last one. This
+ * costs at most one unneeded wake-up on release.
  *
- * the following states are invalid and will never occur:
- * [0, >=1,   0], [1,   0, >=0]
- *
- * The main problem arising from the fact that we have no separate counter
- * of shared access threads inside the locked section is that in the state
- * [0, >=1, >=1] above we cannot add additional waiting threads to the
- * shared access queue - it wouldn't be possible to distinguish waiting
- * threads and those that are still inside. To solve this problem the lock
- * uses the following approach: a thread that isn't able to allocate a
- * shared lock just uses the exclusive queue instead. As soon as the thread
- * is woken up it is in the state [1, >=1, >=0]. In this state it's again
- * possible to use the shared access queue. The thread atomically moves
- * itself to the shared access queue and releases the exclusive lock, so
- * that the "real" exclusive access threads have a chance. As soon as they
- * are all ready the shared access threads are processed.
- */
-
-#define SRWLOCK_MASK_IN_EXCLUSIVE     0x80000000
-#define SRWLOCK_MASK_EXCLUSIVE_QUEUE  0x7fff0000
-#define SRWLOCK_MASK_SHARED_QUEUE     0x0000ffff
-#define SRWLOCK_RES_EXCLUSIVE         0x00010000
-#define SRWLOCK_RES_SHARED            0x00000001
-
-#ifdef WORDS_BIGENDIAN
-#define srwlock_key_exclusive(lock)   (&lock->Ptr)
-#define srwlock_key_shared(lock)      ((void *)((char *)&lock->Ptr + 2))
-#else
-#define srwlock_key_exclusive(lock)   ((void *)((char *)&lock->Ptr + 2))
-#define srwlock_key_shared(lock)      (&lock->Ptr)
-#endif
+ * Exclusive and shared waiters sleep on the same word with different
+ * futex bitsets, so a release only wakes the kind of thread it wants.
+ * Before sleeping, threads spin for a short while as long as nobody is
+ * queued yet, since most SRW sections are short.
+ */
+
+#define SRWLOCK_EXCLUSIVE          0x80000000
+#define SRWLOCK_EXCLUSIVE_WAITERS  0x40000000
+#define SRWLOCK_SHARED_WAITERS     0x20000000
+#define SRWLOCK_SHARED_MASK        0x1fffffff
+
+#define SRWLOCK_BITSET_EXCLUSIVE   1
+#define SRWLOCK_BITSET_SHARED      2
 
-static inline void srwlock_check_invalid( unsigned int val )
+#define SRWLOCK_SPIN_COUNT         100
+
+static inline int *srwlock_futex( RTL_SRWLOCK *lock )
 {
-    /* Throw exception if it's impossible to acquire/release this lock. */
-    if ((val & SRWLOCK_MASK_EXCLUSIVE_QUEUE) == SRWLOCK_MASK_EXCLUSIVE_QUEUE ||
-            (val & SRWLOCK_MASK_SHARED_QUEUE) == SRWLOCK_MASK_SHARED_QUEUE)
-        RtlRaiseStatus(STATUS_RESOURCE_NOT_OWNED);
+    return (int *)&lock->Ptr;
 }
 
-static inline unsigned int srwlock_lock_exclusive( unsigned int *dest, int incr )
+/* spin while the lock is busy and nobody is queued, returns the last seen value */
+static unsigned int srwlock_spin( RTL_SRWLOCK *lock, unsigned int busy_mask )
 {
-    unsigned int val, tmp;
-    /* Atomically modifies the value of *dest by adding incr. If the shared
-     * queue is empty and there are threads waiting for exclusive access, then
-     * sets the mark SRWLOCK_MASK_IN_EXCLUSIVE to signal other threads that
-     * they are allowed again to use the shared queue counter. */
-    for (val = *dest;; val = tmp)
+    unsigned int val = *(volatile unsigned int *)srwlock_futex( lock );
+    int count;
+
+    if (NtCurrentTeb()->Peb->NumberOfProcessors <= 1) return val;
+    for (count = SRWLOCK_SPIN_COUNT; count > 0; count--)
     {
-        tmp = val + incr;
-        srwlock_check_invalid( tmp );
-        if ((tmp & SRWLOCK_MASK_EXCLUSIVE_QUEUE) && !(tmp & SRWLOCK_MASK_SHARED_QUEUE))
-            tmp |= SRWLOCK_MASK_IN_EXCLUSIVE;
-        if ((tmp = interlocked_cmpxchg( (int *)dest, tmp, val )) == val)
-            break;
+        if (!(val & busy_mask)) break;
+        if (val & (SRWLOCK_EXCLUSIVE_WAITERS | SRWLOCK_SHARED_WAITERS)) break;  /* contended, sleep */
+        small_pause();
+        val = *(volatile unsigned int *)srwlock_futex( lock );
     }
     return val;
 }
 
-static inline unsigned int srwlock_unlock_exclusive( unsigned int *dest, int incr )
+/* wake one exclusive waiter, or all the shared waiters if there are none */
+static void srwlock_wake( RTL_SRWLOCK *lock, BOOL exclusive_waiters )
 {
+    int *futex = srwlock_futex( lock );
     unsigned int val, tmp;
-    /* Atomically modifies the value of *dest by adding incr. If the queue of
-     * threads waiting for exclusive access is empty, then remove the
-     * SRWLOCK_MASK_IN_EXCLUSIVE flag (only the shared queue counter will
-     * remain). */
-    for (val = *dest;; val = tmp)
+
+    if (exclusive_waiters && futex_wake_bitset( futex, 1, SRWLOCK_BITSET_EXCLUSIVE ) > 0) return;
+
+    for (val = *futex;; val = tmp)
     {
-        tmp = val + incr;
-        srwlock_check_invalid( tmp );
-        if (!(tmp & SRWLOCK_MASK_EXCLUSIVE_QUEUE))
-            tmp &= SRWLOCK_MASK_SHARED_QUEUE;
-        if ((tmp = interlocked_cmpxchg( (int *)dest, tmp, val )) == val)
-            break;
+        if (!(val & SRWLOCK_SHARED_WAITERS)) return;
+        /* a new writer got in first, it will wake the shared waiters when done */
+        if (val & (SRWLOCK_EXCLUSIVE | SRWLOCK_EXCLUSIVE_WAITERS)) return;
+        if ((tmp = interlocked_cmpxchg( futex, val & ~SRWLOCK_SHARED_WAITERS, val )) == val) break;
     }
-    return val;
+    futex_wake_bitset( futex, INT_MAX, SRWLOCK_BITSET_SHARED );
 }
 
-static inline void srwlock_leave_exclusive( RTL_SRWLOCK *lock, unsigned int val )
+/* acquire the lock exclusively, waited tells whether the thread slept on the lock before */
+static void srwlock_acquire_exclusive( RTL_SRWLOCK *lock, BOOL waited )
 {
-    /* Used when a thread leaves an exclusive section. If there are other
-     * exclusive access threads they are processed first, followed by
-     * the shared waiters. */
-    if (val & SRWLOCK_MASK_EXCLUSIVE_QUEUE)
-        NtReleaseKeyedEvent( keyed_event, srwlock_key_exclusive(lock), FALSE, NULL );
-    else
+    int *futex = srwlock_futex( lock );
+    unsigned int val, tmp, old;
+
+    val = srwlock_spin( lock, SRWLOCK_EXCLUSIVE | SRWLOCK_SHARED_MASK );
+    for (;;)
     {
-        val &= SRWLOCK_MASK_SHARED_QUEUE; /* remove SRWLOCK_MASK_IN_EXCLUSIVE */
-        while (val--)
-            NtReleaseKeyedEvent( keyed_event, srwlock_key_shared(lock), FALSE, NULL );
+        if (!(val & (SRWLOCK_EXCLUSIVE | SRWLOCK_SHARED_MASK)))
+        {
+            tmp = val | SRWLOCK_EXCLUSIVE;
+            if (waited) tmp |= SRWLOCK_EXCLUSIVE_WAITERS;
+            if ((tmp = interlocked_cmpxchg( futex, tmp, val )) == val) return;
+            val = tmp;
+            continue;
+        }
+        tmp = val | SRWLOCK_EXCLUSIVE_WAITERS;
+        if (tmp != val && (old = interlocked_cmpxchg( futex, tmp, val )) != val)
+        {
+            val = old;
+            continue;
+        }
+        futex_wait_value( futex, tmp, NULL, SRWLOCK_BITSET_EXCLUSIVE );
+        waited = TRUE;
+        val = *futex;
     }
 }
 
-static inline void srwlock_leave_shared( RTL_SRWLOCK *lock, unsigned int val )
-{
-    /* Wake up one exclusive thread as soon as the last shared access thread
-     * has left. */
-    if ((val & SRWLOCK_MASK_EXCLUSIVE_QUEUE) && !(val & SRWLOCK_MASK_SHARED_QUEUE))
-        NtReleaseKeyedEvent( keyed_event, srwlock_key_exclusive(lock), FALSE, NULL );
-}
-
 /***********************************************************************
  *              RtlInitializeSRWLock (NTDLL.@)
  *
  * NOTES
  *  Please note that SRWLocks do not keep track of the owner of a lock.
  *  It doesn't make any difference which thread for example unlocks an
- *  SRWLock (see corresponding tests). This implementation uses two
- *  keyed events (one for the exclusive waiters and one for the shared
- *  waiters) and is limited to 2^15-1 waiting threads.
+ *  SRWLock (see corresponding tests). This implementation waits directly
+ *  on the lock word with futexes and is limited to 2^29-1 shared owners.
  */
 void WINAPI RtlInitializeSRWLock( RTL_SRWLOCK *lock )
 {
@@ -1710,8 +1826,8 @@ void WINAPI RtlInitializeSRWLock( RTL_SRWLOCK *lock )
  */
 void WINAPI RtlAcquireSRWLockExclusive( RTL_SRWLOCK *lock )
 {
-    if (srwlock_lock_exclusive( (unsigned int *)&lock->Ptr, SRWLOCK_RES_EXCLUSIVE ))
-        NtWaitForKeyedEvent( keyed_event, srwlock_key_exclusive(lock), FALSE, NULL );
+    if (!interlocked_cmpxchg( srwlock_futex( lock ), SRWLOCK_EXCLUSIVE, 0 )) return;
+    srwlock_acquire_exclusive( lock, FALSE );
 }
 
 /***********************************************************************
@@ -1723,30 +1839,28 @@ void WINAPI RtlAcquireSRWLockExclusive( RTL_SRWLOCK *lock )
  */
 void WINAPI RtlAcquireSRWLockShared( RTL_SRWLOCK *lock )
 {
-    unsigned int val, tmp;
-    /* Acquires a shared lock. If it's currently not possible to add elements to
-     * the shared queue, then request exclusive access instead. */
-    for (val = *(unsigned int *)&lock->Ptr;; val = tmp)
-    {
-        if ((val & SRWLOCK_MASK_EXCLUSIVE_QUEUE) && !(val & SRWLOCK_MASK_IN_EXCLUSIVE))
-            tmp = val + SRWLOCK_RES_EXCLUSIVE;
-        else
-            tmp = val + SRWLOCK_RES_SHARED;
-        if ((tmp = interlocked_cmpxchg( (int *)&lock->Ptr, tmp, val )) == val)
-            break;
-    }
+    int *futex = srwlock_futex( lock );
+    unsigned int val, tmp, old;
 
-    /* Drop exclusive access again and instead requeue for shared access. */
-    if ((val & SRWLOCK_MASK_EXCLUSIVE_QUEUE) && !(val & SRWLOCK_MASK_IN_EXCLUSIVE))
+    val = srwlock_spin( lock, SRWLOCK_EXCLUSIVE | SRWLOCK_EXCLUSIVE_WAITERS );
+    for (;;)
     {
-        NtWaitForKeyedEvent( keyed_event, srwlock_key_exclusive(lock), FALSE, NULL );
-        val = srwlock_unlock_exclusive( (unsigned int *)&lock->Ptr, (SRWLOCK_RES_SHARED
-                                        - SRWLOCK_RES_EXCLUSIVE) ) - SRWLOCK_RES_EXCLUSIVE;
-        srwlock_leave_exclusive( lock, val );
+        if (!(val & (SRWLOCK_EXCLUSIVE | SRWLOCK_EXCLUSIVE_WAITERS)))
+        {
+            if ((val & SRWLOCK_SHARED_MASK) == SRWLOCK_SHARED_MASK) RtlRaiseStatus( STATUS_RESOURCE_NOT_OWNED );
+            if ((tmp = interlocked_cmpxchg( futex, val + 1, val )) == val) return;
+            val = tmp;
+            continue;
+        }
+        tmp = val | SRWLOCK_SHARED_WAITERS;
+        if (tmp != val && (old = interlocked_cmpxchg( futex, tmp, val )) != val)
+        {
+            val = old;
+            continue;
+        }
+        futex_wait_value( futex, tmp, NULL, SRWLOCK_BITSET_SHARED );
+        val = *futex;
     }
-
-    if (val & SRWLOCK_MASK_EXCLUSIVE_QUEUE)
-        NtWaitForKeyedEvent( keyed_event, srwlock_key_shared(lock), FALSE, NULL );
 }
 
 /***********************************************************************
@@ -1754,8 +1868,17 @@ void WINAPI RtlAcquireSRWLockShared( RTL_SRWLOCK *lock )
  */
 void WINAPI RtlReleaseSRWLockExclusive( RTL_SRWLOCK *lock )
 {
-    srwlock_leave_exclusive( lock, srwlock_unlock_exclusive( (unsigned int *)&lock->Ptr,
-                             - SRWLOCK_RES_EXCLUSIVE ) - SRWLOCK_RES_EXCLUSIVE );
+    int *futex = srwlock_futex( lock );
+    unsigned int val, tmp;
+
+    for (val = *futex;; val = tmp)
+    {
+        if (!(val & SRWLOCK_EXCLUSIVE)) RtlRaiseStatus( STATUS_RESOURCE_NOT_OWNED );
+        if ((tmp = interlocked_cmpxchg( futex, val & ~(SRWLOCK_EXCLUSIVE | SRWLOCK_EXCLUSIVE_WAITERS),
+                                        val )) == val) break;
+    }
+    if (val & (SRWLOCK_EXCLUSIVE_WAITERS | SRWLOCK_SHARED_WAITERS))
+        srwlock_wake( lock, val & SRWLOCK_EXCLUSIVE_WAITERS );
 }
 
 /***********************************************************************
@@ -1763,8 +1886,19 @@ void WINAPI RtlReleaseSRWLockExclusive( RTL_SRWLOCK *lock )
  */
 void WINAPI RtlReleaseSRWLockShared( RTL_SRWLOCK *lock )
 {
-    srwlock_leave_shared( lock, srwlock_lock_exclusive( (unsigned int *)&lock->Ptr,
-                          - SRWLOCK_RES_SHARED ) - SRWLOCK_RES_SHARED );
+    int *futex = srwlock_futex( lock );
+    unsigned int val, tmp;
+
+    for (val = *futex;; val = tmp)
+    {
+        if (!(val & SRWLOCK_SHARED_MASK)) RtlRaiseStatus( STATUS_RESOURCE_NOT_OWNED );
+        tmp = val - 1;
+        /* the last shared owner hands the lock over to the exclusive waiters */
+        if (!(tmp & SRWLOCK_SHARED_MASK)) tmp &= ~SRWLOCK_EXCLUSIVE_WAITERS;
+        if ((tmp = interlocked_cmpxchg( futex, tmp, val )) == val) break;
+    }
+    if (!((val - 1) & SRWLOCK_SHARED_MASK) && (val & (SRWLOCK_EXCLUSIVE_WAITERS | SRWLOCK_SHARED_WAITERS)))
+        srwlock_wake( lock, val & SRWLOCK_EXCLUSIVE_WAITERS );
 }
 
 /***********************************************************************
@@ -1776,8 +1910,14 @@ void WINAPI RtlReleaseSRWLockShared( RTL_SRWLOCK *lock )
  */
 BOOLEAN WINAPI RtlTryAcquireSRWLockExclusive( RTL_SRWLOCK *lock )
 {
-    return interlocked_cmpxchg( (int *)&lock->Ptr, SRWLOCK_MASK_IN_EXCLUSIVE |
-                                SRWLOCK_RES_EXCLUSIVE, 0 ) == 0;
+    int *futex = srwlock_futex( lock );
+    unsigned int val, tmp;
+
+    for (val = *futex;; val = tmp)
+    {
+        if (val & (SRWLOCK_EXCLUSIVE | SRWLOCK_SHARED_MASK)) return FALSE;
+        if ((tmp = interlocked_cmpxchg( futex, val | SRWLOCK_EXCLUSIVE, val )) == val) return TRUE;
+    }
 }
 
 /***********************************************************************
@@ -1785,15 +1925,101 @@ BOOLEAN WINAPI RtlTryAcquireSRWLockExclusive( RTL_SRWLOCK *lock )
  */
 BOOLEAN WINAPI RtlTryAcquireSRWLockShared( RTL_SRWLOCK *lock )
 {
+    int *futex = srwlock_futex( lock );
     unsigned int val, tmp;
-    for (val = *(unsigned int *)&lock->Ptr;; val = tmp)
+
+    for (val = *futex;; val = tmp)
     {
-        if (val & SRWLOCK_MASK_EXCLUSIVE_QUEUE)
-            return FALSE;
-        if ((tmp = interlocked_cmpxchg( (int *)&lock->Ptr, val + SRWLOCK_RES_SHARED, val )) == val)
-            break;
+        if (val & (SRWLOCK_EXCLUSIVE | SRWLOCK_EXCLUSIVE_WAITERS)) return FALSE;
+        if ((val & SRWLOCK_SHARED_MASK) == SRWLOCK_SHARED_MASK) return FALSE;
+        if ((tmp = interlocked_cmpxchg( futex, val + 1, val )) == val) return TRUE;
     }
-    return TRUE;
+}
+
+
+/* Condition variables implementation
+ *
+ * The variable is a futex sequence number, incremented on every wake.
+ * Sleepers wait for the sequence to change, which makes wakes that come
+ * in between releasing the lock and going to sleep impossible to miss.
+ *
+ * To avoid a thundering herd on WakeAll, waiters sleeping in exclusive
+ * mode on an SRW lock are requeued onto the lock itself: only one of them
+ * is woken, the others follow one by one as the lock gets released. This
+ * is only safe if all the waiters use the same lock, so sleepers register
+ * their lock in a small hash table for the duration of the wait, and a
+ * variable used with different locks (or with critical sections) falls
+ * back to waking everybody.
+ */
+
+#define CV_MIXED      ((void *)1)  /* several variables or locks share the entry */
+#define CV_HASH_SIZE  64
+
+struct cv_lock_entry
+{
+    int   busy;         /* spinlock for the entry */
+    int   waiters;      /* number of registered waiters, the entry is free if 0 */
+    void *variable;     /* condition variable of the waiters, or CV_MIXED */
+    void *lock;         /* exclusive SRW lock of the waiters, or CV_MIXED */
+    void *requeued;     /* variable whose waiters were last requeued onto the lock */
+    int   requeue_seq;  /* sequence number of the last requeue */
+};
+
+static struct cv_lock_entry cv_locks[CV_HASH_SIZE];
+
+static inline struct cv_lock_entry *cv_lock_entry( RTL_CONDITION_VARIABLE *variable )
+{
+    return &cv_locks[((ULONG_PTR)variable >> 4) % CV_HASH_SIZE];
+}
+
+static inline void cv_entry_lock( struct cv_lock_entry *entry )
+{
+    while (interlocked_cmpxchg( &entry->busy, 1, 0 )) small_pause();
+}
+
+static inline void cv_entry_unlock( struct cv_lock_entry *entry )
+{
+    interlocked_xchg( &entry->busy, 0 );
+}
+
+/* register a sleeper and its lock, lock is NULL for anything that can't be requeued */
+static void cv_register( RTL_CONDITION_VARIABLE *variable, void *lock )
+{
+    struct cv_lock_entry *entry = cv_lock_entry( variable );
+
+    if (!lock) lock = CV_MIXED;
+    cv_entry_lock( entry );
+    if (!entry->waiters++)
+    {
+        entry->variable = variable;
+        entry->lock     = lock;
+        entry->requeued = NULL;
+    }
+    else
+    {
+        if (entry->variable != variable) entry->variable = CV_MIXED;
+        if (entry->lock != lock) entry->lock = CV_MIXED;
+    }
+    cv_entry_unlock( entry );
+}
+
+/* unregister a sleeper, returns TRUE if it may have been requeued onto its lock */
+static BOOL cv_unregister( RTL_CONDITION_VARIABLE *variable, int seq )
+{
+    struct cv_lock_entry *entry = cv_lock_entry( variable );
+    BOOL requeued;
+
+    cv_entry_lock( entry );
+    requeued = entry->requeued == variable && entry->requeue_seq - seq > 0;
+    entry->waiters--;
+    cv_entry_unlock( entry );
+    return requeued;
+}
+
+/* common part of the RtlSleepConditionVariable functions */
+static NTSTATUS cv_wait( RTL_CONDITION_VARIABLE *variable, int seq, const LARGE_INTEGER *timeout )
+{
+    return futex_wait_value( (int *)&variable->Ptr, seq, timeout, FUTEX_BITSET_MATCH_ANY_ );
 }
 
 /***********************************************************************
@@ -1829,8 +2055,10 @@ void WINAPI RtlInitializeConditionVariable( RTL_CONDITION_VARIABLE *variable )
  */
 void WINAPI RtlWakeConditionVariable( RTL_CONDITION_VARIABLE *variable )
 {
-    if (interlocked_dec_if_nonzero( (int *)&variable->Ptr ))
-        NtReleaseKeyedEvent( keyed_event, &variable->Ptr, FALSE, NULL );
+    int *futex = (int *)&variable->Ptr;
+
+    interlocked_xchg_add( futex, 1 );
+    futex_wake_bitset( futex, 1, FUTEX_BITSET_MATCH_ANY_ );
 }
 
 /***********************************************************************
@@ -1840,9 +2068,35 @@ void WINAPI RtlWakeConditionVariable( RTL_CONDITION_VARIABLE *variable )
  */
 void WINAPI RtlWakeAllConditionVariable( RTL_CONDITION_VARIABLE *variable )
 {
-    int val = interlocked_xchg( (int *)&variable->Ptr, 0 );
-    while (val-- > 0)
-        NtReleaseKeyedEvent( keyed_event, &variable->Ptr, FALSE, NULL );
+    struct cv_lock_entry *entry = cv_lock_entry( variable );
+    int *futex = (int *)&variable->Ptr;
+    RTL_SRWLOCK *lock = NULL;
+    unsigned int val, tmp;
+    int seq;
+
+    /* sleepers read the sequence before registering, so anybody who registers after
+     * the entry is unlocked again has seen the new sequence and won't get requeued */
+    cv_entry_lock( entry );
+    seq = interlocked_xchg_add( futex, 1 ) + 1;
+    /* a registered waiter still has to reacquire the lock, so it can't be gone yet */
+    if (entry->waiters && entry->variable == variable && entry->lock != CV_MIXED) lock = entry->lock;
+
+    if (lock)
+    {
+        int *lock_futex = srwlock_futex( lock );
+
+        /* make sure the requeued waiters get woken when the lock is released */
+        for (val = *lock_futex;; val = tmp)
+        {
+            if (val & SRWLOCK_EXCLUSIVE_WAITERS) break;
+            if ((tmp = interlocked_cmpxchg( lock_futex, val | SRWLOCK_EXCLUSIVE_WAITERS, val )) == val) break;
+        }
+        entry->requeued    = variable;
+        entry->requeue_seq = seq;
+        if (futex_cmp_requeue( futex, 1, INT_MAX, lock_futex, seq ) == -1) lock = NULL;
+    }
+    if (!lock) futex_wake_bitset( futex, INT_MAX, FUTEX_BITSET_MATCH_ANY_ );
+    cv_entry_unlock( entry );
 }
 
 /***********************************************************************
@@ -1858,22 +2112,18 @@ void WINAPI RtlWakeAllConditionVariable( RTL_CONDITION_VARIABLE *variable )
  *  timeout   [I]   timeout
  *
  * RETURNS
- *  see NtWaitForKeyedEvent for all possible return values.
+ *  STATUS_SUCCESS when woken up, STATUS_TIMEOUT if the timeout expired.
  */
 NTSTATUS WINAPI RtlSleepConditionVariableCS( RTL_CONDITION_VARIABLE *variable, RTL_CRITICAL_SECTION *crit,
                                              const LARGE_INTEGER *timeout )
 {
+    int seq = *(volatile int *)&variable->Ptr;
     NTSTATUS status;
-    interlocked_xchg_add( (int *)&variable->Ptr, 1 );
-    RtlLeaveCriticalSection( crit );
-
-    status = NtWaitForKeyedEvent( keyed_event, &variable->Ptr, FALSE, timeout );
-    if (status != STATUS_SUCCESS)
-    {
-        if (!interlocked_dec_if_nonzero( (int *)&variable->Ptr ))
-            status = NtWaitForKeyedEvent( keyed_event, &variable->Ptr, FALSE, NULL );
-    }
 
+    cv_register( variable, NULL );
+    RtlLeaveCriticalSection( crit );
+    status = cv_wait( variable, seq, timeout );
+    cv_unregister( variable, seq );
     RtlEnterCriticalSection( crit );
     return status;
 }
@@ -1892,7 +2142,7 @@ NTSTATUS WINAPI RtlSleepConditionVariableCS( RTL_CONDITION_VARIABLE *variable, R
  *  flags     [I]   type of the current lock (exclusive / shared)
  *
  * RETURNS
- *  see NtWaitForKeyedEvent for all possible return values.
+ *  STATUS_SUCCESS when woken up, STATUS_TIMEOUT if the timeout expired.
  *
  * NOTES
  *  the behaviour is undefined if the thread doesn't own the lock.
@@ -1900,25 +2150,162 @@ NTSTATUS WINAPI RtlSleepConditionVariableCS( RTL_CONDITION_VARIABLE *variable, R
 NTSTATUS WINAPI RtlSleepConditionVariableSRW( RTL_CONDITION_VARIABLE *variable, RTL_SRWLOCK *lock,
                                               const LARGE_INTEGER *timeout, ULONG flags )
 {
+    int seq = *(volatile int *)&variable->Ptr;
     NTSTATUS status;
-    interlocked_xchg_add( (int *)&variable->Ptr, 1 );
 
     if (flags & RTL_CONDITION_VARIABLE_LOCKMODE_SHARED)
+    {
+        cv_register( variable, NULL );
         RtlReleaseSRWLockShared( lock );
-    else
-        RtlReleaseSRWLockExclusive( lock );
+        status = cv_wait( variable, seq, timeout );
+        cv_unregister( variable, seq );
+        RtlAcquireSRWLockShared( lock );
+        return status;
+    }
 
-    status = NtWaitForKeyedEvent( keyed_event, &variable->Ptr, FALSE, timeout );
-    if (status != STATUS_SUCCESS)
+    cv_register( variable, lock );
+    RtlReleaseSRWLockExclusive( lock );
+    status = cv_wait( variable, seq, timeout );
+
+    /* other requeued waiters rely on the release of the lock to get woken */
+    if (cv_unregister( variable, seq )) srwlock_acquire_exclusive( lock, TRUE );
+    else RtlAcquireSRWLockExclusive( lock );
+    return status;
+}
+
+
+/* Wait on address implementation
+ *
+ * Values of 1, 2, 4 or 8 bytes can be waited on, so the address itself
+ * can't always be used as a futex. Instead addresses are hashed into a
+ * table of buckets, each with a futex sequence number that is incremented
+ * on every wake. Like for condition variables, this makes a wake between
+ * the comparison and going to sleep impossible to miss.
+ *
+ * Buckets also keep track of their waiters, so that waking an address
+ * nobody waits on doesn't need a system call, and WakeByAddressSingle only
+ * wakes a single thread when it can't hit a waiter of another address.
+ */
+
+#define ADDR_MIXED       ((const void *)1)  /* waiters on several addresses share the bucket */
+#define ADDR_HASH_SIZE   256
+
+struct addr_wait_bucket
+{
+    int         seq;      /* futex sequence number */
+    int         busy;     /* spinlock for the bucket */
+    int         waiters;  /* number of waiting threads */
+    const void *addr;     /* address the threads are waiting on, or ADDR_MIXED */
+};
+
+static struct addr_wait_bucket addr_wait_buckets[ADDR_HASH_SIZE];
+
+static inline struct addr_wait_bucket *addr_wait_bucket( const void *addr )
+{
+    ULONG_PTR val = (ULONG_PTR)addr;
+    return &addr_wait_buckets[((val >> 3) ^ (val >> 11)) % ADDR_HASH_SIZE];
+}
+
+static inline void addr_bucket_lock( struct addr_wait_bucket *bucket )
+{
+    while (interlocked_cmpxchg( &bucket->busy, 1, 0 )) small_pause();
+}
+
+static inline void addr_bucket_unlock( struct addr_wait_bucket *bucket )
+{
+    interlocked_xchg( &bucket->busy, 0 );
+}
+
+static inline BOOL compare_addr( const volatile void *addr, const void *cmp, SIZE_T size )
+{
+    switch (size)
     {
-        if (!interlocked_dec_if_nonzero( (int *)&variable->Ptr ))
-            status = NtWaitForKeyedEvent( keyed_event, &variable->Ptr, FALSE, NULL );
+    case 1: return *(const volatile BYTE *)addr == *(const BYTE *)cmp;
+    case 2: return *(const volatile WORD *)addr == *(const WORD *)cmp;
+    case 4: return *(const volatile DWORD *)addr == *(const DWORD *)cmp;
+    case 8: return *(const volatile ULONGLONG *)addr == *(const ULONGLONG *)cmp;
     }
+    return FALSE;
+}
 
-    if (flags & RTL_CONDITION_VARIABLE_LOCKMODE_SHARED)
-        RtlAcquireSRWLockShared( lock );
-    else
-        RtlAcquireSRWLockExclusive( lock );
+/* wake the waiters of addr, count is 1 or INT_MAX */
+static void addr_wake( const void *addr, int count )
+{
+    struct addr_wait_bucket *bucket = addr_wait_bucket( addr );
+
+    addr_bucket_lock( bucket );
+    if (!bucket->waiters)
+    {
+        addr_bucket_unlock( bucket );
+        return;
+    }
+    bucket->seq++;
+    if (bucket->addr == ADDR_MIXED) count = INT_MAX;
+    else if (bucket->addr != addr) count = 0;
+    addr_bucket_unlock( bucket );
+    if (count) futex_wake_bitset( &bucket->seq, count, FUTEX_BITSET_MATCH_ANY_ );
+}
+
+/***********************************************************************
+ *           RtlWaitOnAddress   (NTDLL.@)
+ *
+ * Waits until the value at an address is changed and the address woken.
+ *
+ * PARAMS
+ *  addr    [I] address to wait on
+ *  cmp     [I] value the caller doesn't want to see at addr
+ *  size    [I] size of the value, 1, 2, 4 or 8 bytes
+ *  timeout [I] timeout for the wait, NULL for infinite
+ *
+ * RETURNS
+ *  STATUS_SUCCESS when woken up or if the value is already different,
+ *  STATUS_TIMEOUT if the timeout expired.
+ *
+ * NOTES
+ *  Like on Windows, the thread may return without the value having
+ *  changed; callers have to check it again.
+ */
+NTSTATUS WINAPI RtlWaitOnAddress( const void *addr, const void *cmp, SIZE_T size,
+                                  const LARGE_INTEGER *timeout )
+{
+    struct addr_wait_bucket *bucket;
+    NTSTATUS status = STATUS_SUCCESS;
+    int seq;
+
+    if (size != 1 && size != 2 && size != 4 && size != 8) return STATUS_INVALID_PARAMETER;
+
+    bucket = addr_wait_bucket( addr );
+    addr_bucket_lock( bucket );
+    if (!bucket->waiters++) bucket->addr = addr;
+    else if (bucket->addr != addr) bucket->addr = ADDR_MIXED;
+    seq = bucket->seq;
+    addr_bucket_unlock( bucket );
+
+    if (compare_addr( addr, cmp, size ))
+        status = futex_wait_value( &bucket->seq, seq, timeout, FUTEX_BITSET_MATCH_ANY_ );
+
+    addr_bucket_lock( bucket );
+    bucket->waiters--;
+    addr_bucket_unlock( bucket );
     return status;
 }
-#endif
+
+/***********************************************************************
+ *           RtlWakeAddressAll   (NTDLL.@)
+ *
+ * Wakes all the threads waiting on an address.
+ */
+void WINAPI RtlWakeAddressAll( const void *addr )
+{
+    addr_wake( addr, INT_MAX );
+}
+
+/***********************************************************************
+ *           RtlWakeAddressSingle   (NTDLL.@)
+ *
+ * Wakes one of the threads waiting on an address.
+ */
+void WINAPI RtlWakeAddressSingle( const void *addr )
+{
+    addr_wake( addr, 1 );
+}
@@ -32,6 +32,10 @@
 #include <string.h>
 #include <limits.h>
 #include <time.h>
+#include <fcntl.h>
+#ifdef HAVE_PTHREAD_H
+# include <pthread.h>
+#endif
 #ifdef HAVE_SYS_TIME_H
 # include <sys/time.h>
 #endif
@@ -46,6 +50,7 @@
 #define WIN32_NO_STATUS
 #include "windef.h"
 #include "winternl.h"
+#include "ddk/wdm.h"
 #include "wine/exception.h"
 #include "wine/unicode.h"
 #include "wine/debug.h"
@@ -114,10 +119,7 @@ static ULONGLONG monotonic_counter(void)
     return mach_absolute_time() * timebase.numer / timebase.denom / 100;
 #elif defined(HAVE_CLOCK_GETTIME)
     struct timespec ts;
-#ifdef CLOCK_MONOTONIC_RAW
-    if (!clock_gettime( CLOCK_MONOTONIC_RAW, &ts ))
-        return ts.tv_sec * (ULONGLONG)TICKSPERSEC + ts.tv_nsec / 100;
-#endif
+    /* CLOCK_MONOTONIC is read in the vDSO, CLOCK_MONOTONIC_RAW is a system call on many kernels */
     if (!clock_gettime( CLOCK_MONOTONIC, &ts ))
         return ts.tv_sec * (ULONGLONG)TICKSPERSEC + ts.tv_nsec / 100;
 #endif
@@ -126,6 +128,119 @@ static ULONGLONG monotonic_counter(void)
     return now.tv_sec * (ULONGLONG)TICKSPERSEC + now.tv_usec * 10 + TICKS_1601_TO_1970 - server_start_time;
 }
 
+/* return the monotonic counter at the resolution of the scheduler tick, which is enough
+ * for tick counts and cheaper to read */
+static ULONGLONG monotonic_counter_coarse(void)
+{
+#if defined(HAVE_CLOCK_GETTIME) && defined(CLOCK_MONOTONIC_COARSE)
+    struct timespec ts;
+
+    if (!clock_gettime( CLOCK_MONOTONIC_COARSE, &ts ))
+        return ts.tv_sec * (ULONGLONG)TICKSPERSEC + ts.tv_nsec / 100;
+#endif
+    return monotonic_counter();
+}
+
+#if defined(__i386__) || defined(__x86_64__)
+
+#define TSC_CALIBRATION_NS  2000000  /* how long to measure the TSC against CLOCK_MONOTONIC */
+
+static ULONGLONG tsc_frequency;  /* 0 if the performance counter doesn't use the TSC */
+static BOOL tsc_rdtscp;
+static pthread_once_t tsc_once = PTHREAD_ONCE_INIT;
+
+static inline ULONGLONG read_tsc(void)
+{
+    unsigned int lo, hi, aux;
+
+    /* keep the read from moving ahead of earlier instructions, like the kernel does */
+    if (tsc_rdtscp) __asm__ __volatile__( "rdtscp" : "=a" (lo), "=d" (hi), "=c" (aux) );
+    else __asm__ __volatile__( "lfence; rdtsc" : "=a" (lo), "=d" (hi) :: "memory" );
+    return (ULONGLONG)hi << 32 | lo;
+}
+
+/* check that the kernel keeps time with the TSC; it switches to another clock
+ * source when it finds the TSC unstable (e.g. unsynchronized between CPUs) */
+static BOOL kernel_trusts_tsc(void)
+{
+    char buffer[32];
+    int fd, len;
+
+    if ((fd = open( "/sys/devices/system/clocksource/clocksource0/current_clocksource", O_RDONLY )) == -1)
+        return TRUE;  /* nothing to go by, trust the cpuid flag */
+    len = read( fd, buffer, sizeof(buffer) - 1 );
+    close( fd );
+    if (len <= 0) return TRUE;
+    while (len && (buffer[len - 1] == '\n' || buffer[len - 1] == ' ')) len--;
+    buffer[len] = 0;
+    return !strcmp( buffer, "tsc" );
+}
+
+/* measure the TSC frequency against CLOCK_MONOTONIC */
+static ULONGLONG calibrate_tsc(void)
+{
+    struct timespec start, now;
+    ULONGLONG tsc_start, tsc_end, ns;
+
+    clock_gettime( CLOCK_MONOTONIC, &start );
+    tsc_start = read_tsc();
+    do
+    {
+        clock_gettime( CLOCK_MONOTONIC, &now );
+        tsc_end = read_tsc();
+        ns = (now.tv_sec - start.tv_sec) * (ULONGLONG)1000000000 + now.tv_nsec - start.tv_nsec;
+    }
+    while (ns < TSC_CALIBRATION_NS);
+    return (tsc_end - tsc_start) * 1000000000 / ns;
+}
+
+static void init_tsc(void)
+{
+    ULONGLONG frequency;
+
+    if (!get_tsc_info( &tsc_rdtscp, &frequency ) || !kernel_trusts_tsc())
+    {
+        TRACE( "TSC not invariant, using clock_gettime\n" );
+        return;
+    }
+    /* round to kHz, the measurement isn't more accurate than that */
+    if (!frequency) frequency = (calibrate_tsc() + 500) / 1000 * 1000;
+    TRACE( "using the TSC at %s Hz, rdtscp %d\n", wine_dbgstr_longlong(frequency), tsc_rdtscp );
+    tsc_frequency = frequency;
+}
+
+#endif  /* __i386__ || __x86_64__ */
+
+/* return the performance counter, and its frequency if requested */
+static inline ULONGLONG performance_counter( ULONGLONG *frequency )
+{
+#if defined(__i386__) || defined(__x86_64__)
+    pthread_once( &tsc_once, init_tsc );
+    if (tsc_frequency)
+    {
+        if (frequency) *frequency = tsc_frequency;
+        return read_tsc();
+    }
+#endif
+    if (frequency) *frequency = TICKSPERSEC;
+    return monotonic_counter();
+}
+
+/* return the system time, in Win32 ticks since 1601 */
+static LONGLONG system_time(void)
+{
+    struct timeval now;
+
+#ifdef HAVE_CLOCK_GETTIME
+    struct timespec ts;
+
+    if (!clock_gettime( CLOCK_REALTIME, &ts ))
+        return ts.tv_sec * (ULONGLONG)TICKSPERSEC + ts.tv_nsec / 100 + TICKS_1601_TO_1970;
+#endif
+    gettimeofday( &now, 0 );
+    return now.tv_sec * (ULONGLONG)TICKSPERSEC + now.tv_usec * 10 + TICKS_1601_TO_1970;
+}
+
 /******************************************************************************
  *       RtlTimeToTimeFields [NTDLL.@]
  *
@@ -466,23 +581,31 @@ void WINAPI RtlTimeToElapsedTimeFields( const LARGE_INTEGER *Time, PTIME_FIELDS
  */
 NTSTATUS WINAPI NtQuerySystemTime( PLARGE_INTEGER Time )
 {
-    struct timeval now;
-
-    gettimeofday( &now, 0 );
-    Time->QuadPart = now.tv_sec * (ULONGLONG)TICKSPERSEC + TICKS_1601_TO_1970;
-    Time->QuadPart += now.tv_usec * 10;
+    Time->QuadPart = system_time();
     return STATUS_SUCCESS;
 }
 
+/***********************************************************************
+ *       RtlGetSystemTimePrecise [NTDLL.@]
+ *
+ * Get the current system time with the full 100ns resolution.
+ */
+LONGLONG WINAPI RtlGetSystemTimePrecise(void)
+{
+    return system_time();
+}
+
 /******************************************************************************
  *  NtQueryPerformanceCounter	[NTDLL.@]
  */
 NTSTATUS WINAPI NtQueryPerformanceCounter( LARGE_INTEGER *counter, LARGE_INTEGER *frequency )
 {
+    ULONGLONG freq;
+
     __TRY
     {
-        counter->QuadPart = monotonic_counter();
-        if (frequency) frequency->QuadPart = TICKSPERSEC;
+        counter->QuadPart = performance_counter( &freq );
+        if (frequency) frequency->QuadPart = freq;
     }
     __EXCEPT_PAGE_FAULT
     {
@@ -493,6 +616,27 @@ NTSTATUS WINAPI NtQueryPerformanceCounter( LARGE_INTEGER *counter, LARGE_INTEGER
     return STATUS_SUCCESS;
 }
 
+/******************************************************************************
+ *  RtlQueryPerformanceCounter	[NTDLL.@]
+ */
+BOOL WINAPI RtlQueryPerformanceCounter( LARGE_INTEGER *counter )
+{
+    counter->QuadPart = performance_counter( NULL );
+    return TRUE;
+}
+
+/******************************************************************************
+ *  RtlQueryPerformanceFrequency	[NTDLL.@]
+ */
+BOOL WINAPI RtlQueryPerformanceFrequency( LARGE_INTEGER *frequency )
+{
+    ULONGLONG freq;
+
+    performance_counter( &freq );
+    frequency->QuadPart = freq;
+    return TRUE;
+}
+
 
 /******************************************************************************
  * NtGetTickCount   (NTDLL.@)
@@ -500,7 +644,9 @@ NTSTATUS WINAPI NtQueryPerformanceCounter( LARGE_INTEGER *counter, LARGE_INTEGER
  */
 ULONG WINAPI NtGetTickCount(void)
 {
-    return monotonic_counter() / TICKSPERMSEC;
+    /* kept current by the clock thread once it is mapped */
+    if (user_shared_data) return user_shared_data->TickCount.LowPart;
+    return monotonic_counter_coarse() / TICKSPERMSEC;
 }
 
 /* calculate the mday of dst change date, so that for instance Sun 5 Oct 2007
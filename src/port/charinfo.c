@@ -0,0 +1,20348 @@
+/* Unicode character properties, one record per character */
+/* generated by make_charinfo from wctype.c, casemap.c, digitmap.c and collation.c */
+/* DO NOT EDIT!! */
+
+#include "wine/unicode.h"
+
+const unsigned char wine_char_info_index[256] =
+{
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+    0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+    0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
+    0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f,
+    0x30, 0x31, 0x32, 0x33, 0x34, 0x34, 0x34, 0x34,
+    0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34,
+    0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34,
+    0x34, 0x34, 0x34, 0x34, 0x34, 0x35, 0x34, 0x34,
+    0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34,
+    0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34,
+    0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34,
+    0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34,
+    0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34,
+    0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34,
+    0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34,
+    0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34,
+    0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34,
+    0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x36,
+    0x34, 0x34, 0x34, 0x34, 0x37, 0x34, 0x38, 0x39,
+    0x3a, 0x3b, 0x3c, 0x3d, 0x34, 0x34, 0x34, 0x34,
+    0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34,
+    0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34,
+    0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34,
+    0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34,
+    0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x3e,
+    0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f,
+    0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f,
+    0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f,
+    0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f,
+    0x3f, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46,
+};
+
+const struct wine_char_info wine_char_info_table[18176] =
+{
+    /* block 0 */
+    { 0xe220, 0x0000, 0x0000, 0x00000000 },
+    { 0xe220, 0x0000, 0x0000, 0x00000000 },
+    { 0xe220, 0x0000, 0x0000, 0x00000000 },
+    { 0xe220, 0x0000, 0x0000, 0x00000000 },
+    { 0xe220, 0x0000, 0x0000, 0x00000000 },
+    { 0xe220, 0x0000, 0x0000, 0x00000000 },
+    { 0xe220, 0x0000, 0x0000, 0x00000000 },
+    { 0xe220, 0x0000, 0x0000, 0x00000000 },
+    { 0xe220, 0x0000, 0x0000, 0x00000000 },
+    { 0x9268, 0x0000, 0x0000, 0x02010111 },
+    { 0x8228, 0x0000, 0x0000, 0x02020111 },
+    { 0x9228, 0x0000, 0x0000, 0x02030111 },
+    { 0xa228, 0x0000, 0x0000, 0x02040111 },
+    { 0x8228, 0x0000, 0x0000, 0x02050111 },
+    { 0xe220, 0x0000, 0x0000, 0x00000000 },
+    { 0xe220, 0x0000, 0x0000, 0x00000000 },
+    { 0xe220, 0x0000, 0x0000, 0x00000000 },
+    { 0xe220, 0x0000, 0x0000, 0x00000000 },
+    { 0xe220, 0x0000, 0x0000, 0x00000000 },
+    { 0xe220, 0x0000, 0x0000, 0x00000000 },
+    { 0xe220, 0x0000, 0x0000, 0x00000000 },
+    { 0xe220, 0x0000, 0x0000, 0x00000000 },
+    { 0xe220, 0x0000, 0x0000, 0x00000000 },
+    { 0xe220, 0x0000, 0x0000, 0x00000000 },
+    { 0xe220, 0x0000, 0x0000, 0x00000000 },
+    { 0xe220, 0x0000, 0x0000, 0x00000000 },
+    { 0xe220, 0x0000, 0x0000, 0x00000000 },
+    { 0xe220, 0x0000, 0x0000, 0x00000000 },
+    { 0x8220, 0x0000, 0x0000, 0x00000000 },
+    { 0x8220, 0x0000, 0x0000, 0x00000000 },
+    { 0x8220, 0x0000, 0x0000, 0x00000000 },
+    { 0x9220, 0x0000, 0x0000, 0x00000000 },
+    { 0xa248, 0x0000, 0x0000, 0x02090111 },
+    { 0xb210, 0x0000, 0x0000, 0x024b0111 },
+    { 0xb210, 0x0000, 0x0000, 0x02700111 },
+    { 0x5210, 0x0000, 0x0000, 0x02a90111 },
+    { 0x5210, 0x0000, 0x0000, 0x09e00111 },
+    { 0x5210, 0x0000, 0x0000, 0x02aa0111 },
+    { 0xb210, 0x0000, 0x0000, 0x02a70111 },
+    { 0xb210, 0x0000, 0x0000, 0x02690111 },
+    { 0xb210, 0x0000, 0x0000, 0x027a0111 },
+    { 0xb210, 0x0000, 0x0000, 0x027b0111 },
+    { 0xb210, 0x0000, 0x0000, 0x02a20111 },
+    { 0x4210, 0x0000, 0x0000, 0x039f0111 },
+    { 0x7210, 0x0000, 0x0000, 0x022d0111 },
+    { 0x4210, 0x0000, 0x0000, 0x02210111 },
+    { 0x7210, 0x0000, 0x0000, 0x02550111 },
+    { 0x7210, 0x0000, 0x0000, 0x02a40111 },
+    { 0x3284, 0x0000, 0x0000, 0x0a0b0111 },
+    { 0x3284, 0x0000, 0x0000, 0x0a0c0111 },
+    { 0x3284, 0x0000, 0x0000, 0x0a0d0111 },
+    { 0x3284, 0x0000, 0x0000, 0x0a0e0111 },
+    { 0x3284, 0x0000, 0x0000, 0x0a0f0111 },
+    { 0x3284, 0x0000, 0x0000, 0x0a100111 },
+    { 0x3284, 0x0000, 0x0000, 0x0a110111 },
+    { 0x3284, 0x0000, 0x0000, 0x0a120111 },
+    { 0x3284, 0x0000, 0x0000, 0x0a130111 },
+    { 0x3284, 0x0000, 0x0000, 0x0a140111 },
+    { 0x7210, 0x0000, 0x0000, 0x02370111 },
+    { 0xb210, 0x0000, 0x0000, 0x02350111 },
+    { 0xb210, 0x0000, 0x0000, 0x03a30111 },
+    { 0xb210, 0x0000, 0x0000, 0x03a40111 },
+    { 0xb210, 0x0000, 0x0000, 0x03a50111 },
+    { 0xb210, 0x0000, 0x0000, 0x024e0111 },
+    { 0xb210, 0x0000, 0x0000, 0x02a10111 },
+    { 0x1381, 0x0020, 0x0000, 0x0a150151 },
+    { 0x1381, 0x0020, 0x0000, 0x0a290141 },
+    { 0x1381, 0x0020, 0x0000, 0x0a3d0151 },
+    { 0x1381, 0x0020, 0x0000, 0x0a490151 },
+    { 0x1381, 0x0020, 0x0000, 0x0a650151 },
+    { 0x1381, 0x0020, 0x0000, 0x0a910151 },
+    { 0x1301, 0x0020, 0x0000, 0x0a990151 },
+    { 0x1301, 0x0020, 0x0000, 0x0ab90151 },
+    { 0x1301, 0x0020, 0x0000, 0x0ad30161 },
+    { 0x1301, 0x0020, 0x0000, 0x0ae70141 },
+    { 0x1301, 0x0020, 0x0000, 0x0af70141 },
+    { 0x1301, 0x0020, 0x0000, 0x0b030161 },
+    { 0x1301, 0x0020, 0x0000, 0x0b2b0151 },
+    { 0x1301, 0x0020, 0x0000, 0x0b330151 },
+    { 0x1301, 0x0020, 0x0000, 0x0b4b0161 },
+    { 0x1301, 0x0020, 0x0000, 0x0b670141 },
+    { 0x1301, 0x0020, 0x0000, 0x0b730141 },
+    { 0x1301, 0x0020, 0x0000, 0x0b7f0141 },
+    { 0x1301, 0x0020, 0x0000, 0x0ba70151 },
+    { 0x1301, 0x0020, 0x0000, 0x0bbf0151 },
+    { 0x1301, 0x0020, 0x0000, 0x0bd70141 },
+    { 0x1301, 0x0020, 0x0000, 0x0bef0151 },
+    { 0x1301, 0x0020, 0x0000, 0x0bfb0141 },
+    { 0x1301, 0x0020, 0x0000, 0x0c030151 },
+    { 0x1301, 0x0020, 0x0000, 0x0c070141 },
+    { 0x1301, 0x0020, 0x0000, 0x0c130141 },
+    { 0xb210, 0x0000, 0x0000, 0x027c0111 },
+    { 0xb210, 0x0000, 0x0000, 0x02a60111 },
+    { 0xb210, 0x0000, 0x0000, 0x027d0111 },
+    { 0xb210, 0x0000, 0x0000, 0x020f0111 },
+    { 0xb210, 0x0000, 0x0000, 0x021b0111 },
+    { 0xb210, 0x0000, 0x0000, 0x020c0111 },
+    { 0x1382, 0x0000, 0xffe0, 0x0a150111 },
+    { 0x1382, 0x0000, 0xffe0, 0x0a290111 },
+    { 0x1382, 0x0000, 0xffe0, 0x0a3d0111 },
+    { 0x1382, 0x0000, 0xffe0, 0x0a490111 },
+    { 0x1382, 0x0000, 0xffe0, 0x0a650111 },
+    { 0x1382, 0x0000, 0xffe0, 0x0a910111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0a990111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0ab90111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0ad30111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0ae70111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0af70111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0b030111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0b2b0111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0b330111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0b4b0111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0b670111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0b730111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0b7f0111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0ba70111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0bbf0111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0bd70111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0bef0111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0bfb0111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0c030111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0c070111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0c130111 },
+    { 0xb210, 0x0000, 0x0000, 0x027e0111 },
+    { 0xb210, 0x0000, 0x0000, 0x03a70111 },
+    { 0xb210, 0x0000, 0x0000, 0x027f0111 },
+    { 0xb210, 0x0000, 0x0000, 0x03aa0111 },
+    { 0xe220, 0x0000, 0x0000, 0x00000000 },
+    { 0xe220, 0x0000, 0x0000, 0x00000000 },
+    { 0xe220, 0x0000, 0x0000, 0x00000000 },
+    { 0xe220, 0x0000, 0x0000, 0x00000000 },
+    { 0xe220, 0x0000, 0x0000, 0x00000000 },
+    { 0xe220, 0x0000, 0x0000, 0x00000000 },
+    { 0x8228, 0x0000, 0x0000, 0x02060111 },
+    { 0xe220, 0x0000, 0x0000, 0x00000000 },
+    { 0xe220, 0x0000, 0x0000, 0x00000000 },
+    { 0xe220, 0x0000, 0x0000, 0x00000000 },
+    { 0xe220, 0x0000, 0x0000, 0x00000000 },
+    { 0xe220, 0x0000, 0x0000, 0x00000000 },
+    { 0xe220, 0x0000, 0x0000, 0x00000000 },
+    { 0xe220, 0x0000, 0x0000, 0x00000000 },
+    { 0xe220, 0x0000, 0x0000, 0x00000000 },
+    { 0xe220, 0x0000, 0x0000, 0x00000000 },
+    { 0xe220, 0x0000, 0x0000, 0x00000000 },
+    { 0xe220, 0x0000, 0x0000, 0x00000000 },
+    { 0xe220, 0x0000, 0x0000, 0x00000000 },
+    { 0xe220, 0x0000, 0x0000, 0x00000000 },
+    { 0xe220, 0x0000, 0x0000, 0x00000000 },
+    { 0xe220, 0x0000, 0x0000, 0x00000000 },
+    { 0xe220, 0x0000, 0x0000, 0x00000000 },
+    { 0xe220, 0x0000, 0x0000, 0x00000000 },
+    { 0xe220, 0x0000, 0x0000, 0x00000000 },
+    { 0xe220, 0x0000, 0x0000, 0x00000000 },
+    { 0xe220, 0x0000, 0x0000, 0x00000000 },
+    { 0xe220, 0x0000, 0x0000, 0x00000000 },
+    { 0xe220, 0x0000, 0x0000, 0x00000000 },
+    { 0xe220, 0x0000, 0x0000, 0x00000000 },
+    { 0xe220, 0x0000, 0x0000, 0x00000000 },
+    { 0xe220, 0x0000, 0x0000, 0x00000000 },
+    { 0xe220, 0x0000, 0x0000, 0x00000000 },
+    { 0x7248, 0x0000, 0x0000, 0x02090141 },
+    { 0xb210, 0x0000, 0x0000, 0x024c0111 },
+    { 0x5210, 0x0000, 0x0000, 0x09df0111 },
+    { 0x5210, 0x0000, 0x0000, 0x09e10111 },
+    { 0x5210, 0x0000, 0x0000, 0x09de0111 },
+    { 0x5210, 0x0000, 0x0000, 0x09e20111 },
+    { 0xb210, 0x0000, 0x0000, 0x03a80111 },
+    { 0xb210, 0x0000, 0x0000, 0x029c0111 },
+    { 0xb210, 0x0000, 0x0000, 0x02140111 },
+    { 0xb210, 0x0000, 0x0000, 0x029f0111 },
+    { 0x1310, 0x0000, 0x0000, 0x0a150181 },
+    { 0xb210, 0x0000, 0x0000, 0x02780111 },
+    { 0xb210, 0x0000, 0x0000, 0x03a60111 },
+    { 0xe230, 0x0000, 0x0000, 0x02200111 },
+    { 0xb210, 0x0000, 0x0000, 0x02a00111 },
+    { 0xb210, 0x0000, 0x0000, 0x02100111 },
+    { 0x5210, 0x0000, 0x0000, 0x030a0111 },
+    { 0x5210, 0x0000, 0x0000, 0x03a00111 },
+    { 0x3214, 0x0000, 0x0000, 0x0a0d0151 },
+    { 0x3214, 0x0000, 0x0000, 0x0a0e0151 },
+    { 0xb210, 0x0000, 0x0000, 0x020d0111 },
+    { 0x1312, 0x0000, 0x02e7, 0x0c9f0121 },
+    { 0xb210, 0x0000, 0x0000, 0x029d0111 },
+    { 0xb210, 0x0000, 0x0000, 0x025f0111 },
+    { 0xb210, 0x0000, 0x0000, 0x02190111 },
+    { 0x3214, 0x0000, 0x0000, 0x0a0c0151 },
+    { 0x1310, 0x0000, 0x0000, 0x0b4b01a1 },
+    { 0xb210, 0x0000, 0x0000, 0x02790111 },
+    { 0xb210, 0x0000, 0x0000, 0x0a0c0171 },
+    { 0xb210, 0x0000, 0x0000, 0x0a0c0171 },
+    { 0xb210, 0x0000, 0x0000, 0x0a0e0171 },
+    { 0xb210, 0x0000, 0x0000, 0x024f0111 },
+    { 0x1301, 0x0020, 0x0000, 0x0a150151 },
+    { 0x1301, 0x0020, 0x0000, 0x0a150151 },
+    { 0x1301, 0x0020, 0x0000, 0x0a150151 },
+    { 0x1301, 0x0020, 0x0000, 0x0a150151 },
+    { 0x1301, 0x0020, 0x0000, 0x0a150151 },
+    { 0x1301, 0x0020, 0x0000, 0x0a150151 },
+    { 0x1301, 0x0020, 0x0000, 0x0a190121 },
+    { 0x1301, 0x0020, 0x0000, 0x0a3d0151 },
+    { 0x1301, 0x0020, 0x0000, 0x0a650151 },
+    { 0x1301, 0x0020, 0x0000, 0x0a650151 },
+    { 0x1301, 0x0020, 0x0000, 0x0a650151 },
+    { 0x1301, 0x0020, 0x0000, 0x0a650151 },
+    { 0x1301, 0x0020, 0x0000, 0x0ad30161 },
+    { 0x1301, 0x0020, 0x0000, 0x0ad30161 },
+    { 0x1301, 0x0020, 0x0000, 0x0ad30161 },
+    { 0x1301, 0x0020, 0x0000, 0x0ad30161 },
+    { 0x1301, 0x0020, 0x0000, 0x0a5d0121 },
+    { 0x1301, 0x0020, 0x0000, 0x0b330151 },
+    { 0x1301, 0x0020, 0x0000, 0x0b4b0161 },
+    { 0x1301, 0x0020, 0x0000, 0x0b4b0161 },
+    { 0x1301, 0x0020, 0x0000, 0x0b4b0161 },
+    { 0x1301, 0x0020, 0x0000, 0x0b4b0161 },
+    { 0x1301, 0x0020, 0x0000, 0x0b4b0161 },
+    { 0xb210, 0x0000, 0x0000, 0x03a20111 },
+    { 0x1301, 0x0020, 0x0000, 0x0b530121 },
+    { 0x1301, 0x0020, 0x0000, 0x0bd70141 },
+    { 0x1301, 0x0020, 0x0000, 0x0bd70141 },
+    { 0x1301, 0x0020, 0x0000, 0x0bd70141 },
+    { 0x1301, 0x0020, 0x0000, 0x0bd70141 },
+    { 0x1301, 0x0020, 0x0000, 0x0c070141 },
+    { 0x1301, 0x0020, 0x0000, 0x0c3b0121 },
+    { 0x1302, 0x0000, 0x0000, 0x0ba70131 },
+    { 0x1302, 0x0000, 0xffe0, 0x0a150111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0a150111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0a150111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0a150111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0a150111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0a150111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0a190111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0a3d0111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0a650111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0a650111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0a650111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0a650111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0ad30111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0ad30111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0ad30111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0ad30111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0a5d0111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0b330111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0b4b0111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0b4b0111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0b4b0111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0b4b0111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0b4b0111 },
+    { 0xb210, 0x0000, 0x0000, 0x03a10111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0b530111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0bd70111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0bd70111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0bd70111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0bd70111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0c070111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0c3b0111 },
+    { 0x1302, 0x0000, 0x0079, 0x0c070111 },
+    /* block 1 */
+    { 0x1301, 0x0001, 0x0000, 0x0a150151 },
+    { 0x1302, 0x0000, 0xffff, 0x0a150111 },
+    { 0x1301, 0x0001, 0x0000, 0x0a150151 },
+    { 0x1302, 0x0000, 0xffff, 0x0a150111 },
+    { 0x1301, 0x0001, 0x0000, 0x0a150151 },
+    { 0x1302, 0x0000, 0xffff, 0x0a150111 },
+    { 0x1301, 0x0001, 0x0000, 0x0a3d0151 },
+    { 0x1302, 0x0000, 0xffff, 0x0a3d0111 },
+    { 0x1301, 0x0001, 0x0000, 0x0a3d0151 },
+    { 0x1302, 0x0000, 0xffff, 0x0a3d0111 },
+    { 0x1301, 0x0001, 0x0000, 0x0a3d0151 },
+    { 0x1302, 0x0000, 0xffff, 0x0a3d0111 },
+    { 0x1301, 0x0001, 0x0000, 0x0a3d0151 },
+    { 0x1302, 0x0000, 0xffff, 0x0a3d0111 },
+    { 0x1301, 0x0001, 0x0000, 0x0a490151 },
+    { 0x1302, 0x0000, 0xffff, 0x0a490111 },
+    { 0x1301, 0x0001, 0x0000, 0x0a4d0121 },
+    { 0x1302, 0x0000, 0xffff, 0x0a4d0111 },
+    { 0x1301, 0x0001, 0x0000, 0x0a650151 },
+    { 0x1302, 0x0000, 0xffff, 0x0a650111 },
+    { 0x1301, 0x0001, 0x0000, 0x0a650151 },
+    { 0x1302, 0x0000, 0xffff, 0x0a650111 },
+    { 0x1301, 0x0001, 0x0000, 0x0a650151 },
+    { 0x1302, 0x0000, 0xffff, 0x0a650111 },
+    { 0x1301, 0x0001, 0x0000, 0x0a650151 },
+    { 0x1302, 0x0000, 0xffff, 0x0a650111 },
+    { 0x1301, 0x0001, 0x0000, 0x0a650151 },
+    { 0x1302, 0x0000, 0xffff, 0x0a650111 },
+    { 0x1301, 0x0001, 0x0000, 0x0a990151 },
+    { 0x1302, 0x0000, 0xffff, 0x0a990111 },
+    { 0x1301, 0x0001, 0x0000, 0x0a990151 },
+    { 0x1302, 0x0000, 0xffff, 0x0a990111 },
+    { 0x1301, 0x0001, 0x0000, 0x0a990151 },
+    { 0x1302, 0x0000, 0xffff, 0x0a990111 },
+    { 0x1301, 0x0001, 0x0000, 0x0a990151 },
+    { 0x1302, 0x0000, 0xffff, 0x0a990111 },
+    { 0x1301, 0x0001, 0x0000, 0x0ab90151 },
+    { 0x1302, 0x0000, 0xffff, 0x0ab90111 },
+    { 0x1301, 0x0001, 0x0000, 0x0ac50131 },
+    { 0x1302, 0x0000, 0xffff, 0x0ac50111 },
+    { 0x1301, 0x0001, 0x0000, 0x0ad30161 },
+    { 0x1302, 0x0000, 0xffff, 0x0ad30111 },
+    { 0x1301, 0x0001, 0x0000, 0x0ad30161 },
+    { 0x1302, 0x0000, 0xffff, 0x0ad30111 },
+    { 0x1301, 0x0001, 0x0000, 0x0ad30161 },
+    { 0x1302, 0x0000, 0xffff, 0x0ad30111 },
+    { 0x1301, 0x0001, 0x0000, 0x0ad30161 },
+    { 0x1302, 0x0000, 0xffff, 0x0ad30111 },
+    { 0x1301, 0xff39, 0x0000, 0x0ad30161 },
+    { 0x1302, 0x0000, 0xff18, 0x0ad70111 },
+    { 0x1301, 0x0001, 0x0000, 0x0ad30181 },
+    { 0x1302, 0x0000, 0xffff, 0x0ad30131 },
+    { 0x1301, 0x0001, 0x0000, 0x0ae70141 },
+    { 0x1302, 0x0000, 0xffff, 0x0ae70111 },
+    { 0x1301, 0x0001, 0x0000, 0x0af70141 },
+    { 0x1302, 0x0000, 0xffff, 0x0af70111 },
+    { 0x1302, 0x0000, 0x0000, 0x0b7b0111 },
+    { 0x1301, 0x0001, 0x0000, 0x0b030161 },
+    { 0x1302, 0x0000, 0xffff, 0x0b030111 },
+    { 0x1301, 0x0001, 0x0000, 0x0b030161 },
+    { 0x1302, 0x0000, 0xffff, 0x0b030111 },
+    { 0x1301, 0x0001, 0x0000, 0x0b030161 },
+    { 0x1302, 0x0000, 0xffff, 0x0b030111 },
+    { 0x1301, 0x0001, 0x0000, 0x0b030181 },
+    { 0x1302, 0x0000, 0xffff, 0x0b030131 },
+    { 0x1301, 0x0001, 0x0000, 0x0b0b0121 },
+    { 0x1302, 0x0000, 0xffff, 0x0b0b0111 },
+    { 0x1301, 0x0001, 0x0000, 0x0b330151 },
+    { 0x1302, 0x0000, 0xffff, 0x0b330111 },
+    { 0x1301, 0x0001, 0x0000, 0x0b330151 },
+    { 0x1302, 0x0000, 0xffff, 0x0b330111 },
+    { 0x1301, 0x0001, 0x0000, 0x0b330151 },
+    { 0x1302, 0x0000, 0xffff, 0x0b330111 },
+    { 0x1302, 0x0000, 0x0000, 0x0c580121 },
+    { 0x1301, 0x0001, 0x0000, 0x0b470121 },
+    { 0x1302, 0x0000, 0xffff, 0x0b470111 },
+    { 0x1301, 0x0001, 0x0000, 0x0b4b0161 },
+    { 0x1302, 0x0000, 0xffff, 0x0b4b0111 },
+    { 0x1301, 0x0001, 0x0000, 0x0b4b0161 },
+    { 0x1302, 0x0000, 0xffff, 0x0b4b0111 },
+    { 0x1301, 0x0001, 0x0000, 0x0b4b0161 },
+    { 0x1302, 0x0000, 0xffff, 0x0b4b0111 },
+    { 0x1301, 0x0001, 0x0000, 0x0b4b0181 },
+    { 0x1302, 0x0000, 0xffff, 0x0b4b0131 },
+    { 0x1301, 0x0001, 0x0000, 0x0b7f0141 },
+    { 0x1302, 0x0000, 0xffff, 0x0b7f0111 },
+    { 0x1301, 0x0001, 0x0000, 0x0b7f0141 },
+    { 0x1302, 0x0000, 0xffff, 0x0b7f0111 },
+    { 0x1301, 0x0001, 0x0000, 0x0b7f0141 },
+    { 0x1302, 0x0000, 0xffff, 0x0b7f0111 },
+    { 0x1301, 0x0001, 0x0000, 0x0ba70151 },
+    { 0x1302, 0x0000, 0xffff, 0x0ba70111 },
+    { 0x1301, 0x0001, 0x0000, 0x0ba70151 },
+    { 0x1302, 0x0000, 0xffff, 0x0ba70111 },
+    { 0x1301, 0x0001, 0x0000, 0x0ba70151 },
+    { 0x1302, 0x0000, 0xffff, 0x0ba70111 },
+    { 0x1301, 0x0001, 0x0000, 0x0ba70151 },
+    { 0x1302, 0x0000, 0xffff, 0x0ba70111 },
+    { 0x1301, 0x0001, 0x0000, 0x0bbf0151 },
+    { 0x1302, 0x0000, 0xffff, 0x0bbf0111 },
+    { 0x1301, 0x0001, 0x0000, 0x0bbf0151 },
+    { 0x1302, 0x0000, 0xffff, 0x0bbf0111 },
+    { 0x1301, 0x0001, 0x0000, 0x0bc30121 },
+    { 0x1302, 0x0000, 0xffff, 0x0bc30111 },
+    { 0x1301, 0x0001, 0x0000, 0x0bd70141 },
+    { 0x1302, 0x0000, 0xffff, 0x0bd70111 },
+    { 0x1301, 0x0001, 0x0000, 0x0bd70141 },
+    { 0x1302, 0x0000, 0xffff, 0x0bd70111 },
+    { 0x1301, 0x0001, 0x0000, 0x0bd70141 },
+    { 0x1302, 0x0000, 0xffff, 0x0bd70111 },
+    { 0x1301, 0x0001, 0x0000, 0x0bd70141 },
+    { 0x1302, 0x0000, 0xffff, 0x0bd70111 },
+    { 0x1301, 0x0001, 0x0000, 0x0bd70141 },
+    { 0x1302, 0x0000, 0xffff, 0x0bd70111 },
+    { 0x1301, 0x0001, 0x0000, 0x0bd70141 },
+    { 0x1302, 0x0000, 0xffff, 0x0bd70111 },
+    { 0x1301, 0x0001, 0x0000, 0x0bfb0141 },
+    { 0x1302, 0x0000, 0xffff, 0x0bfb0111 },
+    { 0x1301, 0x0001, 0x0000, 0x0c070141 },
+    { 0x1302, 0x0000, 0xffff, 0x0c070111 },
+    { 0x1301, 0xff87, 0x0000, 0x0c070141 },
+    { 0x1301, 0x0001, 0x0000, 0x0c130141 },
+    { 0x1302, 0x0000, 0xffff, 0x0c130111 },
+    { 0x1301, 0x0001, 0x0000, 0x0c130141 },
+    { 0x1302, 0x0000, 0xffff, 0x0c130111 },
+    { 0x1301, 0x0001, 0x0000, 0x0c130141 },
+    { 0x1302, 0x0000, 0xffff, 0x0c130111 },
+    { 0x1302, 0x0000, 0xfed4, 0x0ba70131 },
+    { 0x1302, 0x0000, 0x00c3, 0x0a310111 },
+    { 0x1301, 0x00d2, 0x0000, 0x0a350121 },
+    { 0x1301, 0x0001, 0x0000, 0x0a390121 },
+    { 0x1302, 0x0000, 0xffff, 0x0a390111 },
+    { 0x1301, 0x0001, 0x0000, 0x0c4f0121 },
+    { 0x1302, 0x0000, 0xffff, 0x0c4f0111 },
+    { 0x1301, 0x00ce, 0x0000, 0x0b570121 },
+    { 0x1301, 0x0001, 0x0000, 0x0a410121 },
+    { 0x1302, 0x0000, 0xffff, 0x0a410111 },
+    { 0x1301, 0x00cd, 0x0000, 0x0a510121 },
+    { 0x1301, 0x00cd, 0x0000, 0x0a550121 },
+    { 0x1301, 0x0001, 0x0000, 0x0a590121 },
+    { 0x1302, 0x0000, 0xffff, 0x0a590111 },
+    { 0x1302, 0x0000, 0x0000, 0x0a610111 },
+    { 0x1301, 0x004f, 0x0000, 0x0a690121 },
+    { 0x1301, 0x00ca, 0x0000, 0x0a6d0121 },
+    { 0x1301, 0x00cb, 0x0000, 0x0a710121 },
+    { 0x1301, 0x0001, 0x0000, 0x0a950121 },
+    { 0x1302, 0x0000, 0xffff, 0x0a950111 },
+    { 0x1301, 0x00cd, 0x0000, 0x0aa50121 },
+    { 0x1301, 0x00cf, 0x0000, 0x0aad0121 },
+    { 0x1302, 0x0000, 0x0061, 0x0ac10111 },
+    { 0x1301, 0x00d3, 0x0000, 0x0ae30121 },
+    { 0x1301, 0x00d1, 0x0000, 0x0adf0121 },
+    { 0x1301, 0x0001, 0x0000, 0x0afb0121 },
+    { 0x1302, 0x0000, 0xffff, 0x0afb0111 },
+    { 0x1302, 0x0000, 0x00a3, 0x0b0f0111 },
+    { 0x1302, 0x0000, 0x0000, 0x0b230111 },
+    { 0x1301, 0x00d3, 0x0000, 0x0be30121 },
+    { 0x1301, 0x00d5, 0x0000, 0x0b3b0121 },
+    { 0x1302, 0x0000, 0x0082, 0x0b3f0111 },
+    { 0x1301, 0x00d6, 0x0000, 0x0b5b0121 },
+    { 0x1301, 0x0001, 0x0000, 0x0b4b0161 },
+    { 0x1302, 0x0000, 0xffff, 0x0b4b0111 },
+    { 0x1301, 0x0001, 0x0000, 0x0ab50121 },
+    { 0x1302, 0x0000, 0xffff, 0x0ab50111 },
+    { 0x1301, 0x0001, 0x0000, 0x0b6b0121 },
+    { 0x1302, 0x0000, 0xffff, 0x0b6b0111 },
+    { 0x1301, 0x00da, 0x0000, 0x0b830121 },
+    { 0x1301, 0x0001, 0x0000, 0x0c470121 },
+    { 0x1302, 0x0000, 0xffff, 0x0c470111 },
+    { 0x1301, 0x00da, 0x0000, 0x0baf0121 },
+    { 0x1302, 0x0000, 0x0000, 0x0bb30111 },
+    { 0x1302, 0x0000, 0x0000, 0x0bc70111 },
+    { 0x1301, 0x0001, 0x0000, 0x0bcb0121 },
+    { 0x1302, 0x0000, 0xffff, 0x0bcb0111 },
+    { 0x1301, 0x00da, 0x0000, 0x0bcf0121 },
+    { 0x1301, 0x0001, 0x0000, 0x0bd70141 },
+    { 0x1302, 0x0000, 0xffff, 0x0bd70111 },
+    { 0x1301, 0x00d9, 0x0000, 0x0beb0121 },
+    { 0x1301, 0x00d9, 0x0000, 0x0bf30121 },
+    { 0x1301, 0x0001, 0x0000, 0x0c0f0121 },
+    { 0x1302, 0x0000, 0xffff, 0x0c0f0111 },
+    { 0x1301, 0x0001, 0x0000, 0x0c170121 },
+    { 0x1302, 0x0000, 0xffff, 0x0c170111 },
+    { 0x1301, 0x00db, 0x0000, 0x0c270121 },
+    { 0x1301, 0x0001, 0x0000, 0x0c2b0121 },
+    { 0x1302, 0x0000, 0xffff, 0x0c2b0111 },
+    { 0x1302, 0x0000, 0x0000, 0x0c2f0111 },
+    { 0x1300, 0x0000, 0x0000, 0x0c430111 },
+    { 0x1301, 0x0001, 0x0000, 0x0c4b0121 },
+    { 0x1302, 0x0000, 0xffff, 0x0c4b0111 },
+    { 0x1302, 0x0000, 0x0000, 0x0c610111 },
+    { 0x1302, 0x0000, 0x0038, 0x0c3f0111 },
+    { 0x1300, 0x0000, 0x0000, 0x0c710111 },
+    { 0x1300, 0x0000, 0x0000, 0x0c750111 },
+    { 0x1300, 0x0000, 0x0000, 0x0c790111 },
+    { 0x1300, 0x0000, 0x0000, 0x0c7d0111 },
+    { 0x1301, 0x0002, 0x0000, 0x0a490171 },
+    { 0x1303, 0x0001, 0xffff, 0x0a490171 },
+    { 0x1302, 0x0000, 0xfffe, 0x0a490131 },
+    { 0x1301, 0x0002, 0x0000, 0x0b030181 },
+    { 0x1303, 0x0001, 0xffff, 0x0b030181 },
+    { 0x1302, 0x0000, 0xfffe, 0x0b030131 },
+    { 0x1301, 0x0002, 0x0000, 0x0b330171 },
+    { 0x1303, 0x0001, 0xffff, 0x0b330171 },
+    { 0x1302, 0x0000, 0xfffe, 0x0b330131 },
+    { 0x1301, 0x0001, 0x0000, 0x0a150151 },
+    { 0x1302, 0x0000, 0xffff, 0x0a150111 },
+    { 0x1301, 0x0001, 0x0000, 0x0ad30161 },
+    { 0x1302, 0x0000, 0xffff, 0x0ad30111 },
+    { 0x1301, 0x0001, 0x0000, 0x0b4b0161 },
+    { 0x1302, 0x0000, 0xffff, 0x0b4b0111 },
+    { 0x1301, 0x0001, 0x0000, 0x0bd70141 },
+    { 0x1302, 0x0000, 0xffff, 0x0bd70111 },
+    { 0x1301, 0x0001, 0x0000, 0x0bd70141 },
+    { 0x1302, 0x0000, 0xffff, 0x0bd70111 },
+    { 0x1301, 0x0001, 0x0000, 0x0bd70141 },
+    { 0x1302, 0x0000, 0xffff, 0x0bd70111 },
+    { 0x1301, 0x0001, 0x0000, 0x0bd70141 },
+    { 0x1302, 0x0000, 0xffff, 0x0bd70111 },
+    { 0x1301, 0x0001, 0x0000, 0x0bd70141 },
+    { 0x1302, 0x0000, 0xffff, 0x0bd70111 },
+    { 0x1302, 0x0000, 0xffb1, 0x0a690111 },
+    { 0x1301, 0x0001, 0x0000, 0x0a150151 },
+    { 0x1302, 0x0000, 0xffff, 0x0a150111 },
+    { 0x1301, 0x0001, 0x0000, 0x0a150151 },
+    { 0x1302, 0x0000, 0xffff, 0x0a150111 },
+    { 0x1301, 0x0001, 0x0000, 0x0a190121 },
+    { 0x1302, 0x0000, 0xffff, 0x0a190111 },
+    { 0x1301, 0x0001, 0x0000, 0x0aa10121 },
+    { 0x1302, 0x0000, 0xffff, 0x0aa10111 },
+    { 0x1301, 0x0001, 0x0000, 0x0a990151 },
+    { 0x1302, 0x0000, 0xffff, 0x0a990111 },
+    { 0x1301, 0x0001, 0x0000, 0x0af70141 },
+    { 0x1302, 0x0000, 0xffff, 0x0af70111 },
+    { 0x1301, 0x0001, 0x0000, 0x0b4b0161 },
+    { 0x1302, 0x0000, 0xffff, 0x0b4b0111 },
+    { 0x1301, 0x0001, 0x0000, 0x0b4b0161 },
+    { 0x1302, 0x0000, 0xffff, 0x0b4b0111 },
+    { 0x1301, 0x0001, 0x0000, 0x0c270121 },
+    { 0x1302, 0x0000, 0xffff, 0x0c270111 },
+    { 0x1302, 0x0000, 0x0000, 0x0ae70111 },
+    { 0x1301, 0x0002, 0x0000, 0x0a490171 },
+    { 0x1303, 0x0001, 0xffff, 0x0a490171 },
+    { 0x1302, 0x0000, 0xfffe, 0x0a490131 },
+    { 0x1301, 0x0001, 0x0000, 0x0a990151 },
+    { 0x1302, 0x0000, 0xffff, 0x0a990111 },
+    { 0x1301, 0xff9f, 0x0000, 0x0ac10121 },
+    { 0x1301, 0xffc8, 0x0000, 0x0c3f0121 },
+    { 0x1301, 0x0001, 0x0000, 0x0b330151 },
+    { 0x1302, 0x0000, 0xffff, 0x0b330111 },
+    { 0x1301, 0x0001, 0x0000, 0x0a150151 },
+    { 0x1302, 0x0000, 0xffff, 0x0a150111 },
+    { 0x1301, 0x0001, 0x0000, 0x0a190121 },
+    { 0x1302, 0x0000, 0xffff, 0x0a190111 },
+    { 0x1301, 0x0001, 0x0000, 0x0b530121 },
+    { 0x1302, 0x0000, 0xffff, 0x0b530111 },
+    /* block 2 */
+    { 0x1301, 0x0001, 0x0000, 0x0a150151 },
+    { 0x1302, 0x0000, 0xffff, 0x0a150111 },
+    { 0x1301, 0x0001, 0x0000, 0x0a150151 },
+    { 0x1302, 0x0000, 0xffff, 0x0a150111 },
+    { 0x1301, 0x0001, 0x0000, 0x0a650151 },
+    { 0x1302, 0x0000, 0xffff, 0x0a650111 },
+    { 0x1301, 0x0001, 0x0000, 0x0a650151 },
+    { 0x1302, 0x0000, 0xffff, 0x0a650111 },
+    { 0x1301, 0x0001, 0x0000, 0x0ad30161 },
+    { 0x1302, 0x0000, 0xffff, 0x0ad30111 },
+    { 0x1301, 0x0001, 0x0000, 0x0ad30161 },
+    { 0x1302, 0x0000, 0xffff, 0x0ad30111 },
+    { 0x1301, 0x0001, 0x0000, 0x0b4b0161 },
+    { 0x1302, 0x0000, 0xffff, 0x0b4b0111 },
+    { 0x1301, 0x0001, 0x0000, 0x0b4b0161 },
+    { 0x1302, 0x0000, 0xffff, 0x0b4b0111 },
+    { 0x1301, 0x0001, 0x0000, 0x0b7f0141 },
+    { 0x1302, 0x0000, 0xffff, 0x0b7f0111 },
+    { 0x1301, 0x0001, 0x0000, 0x0b7f0141 },
+    { 0x1302, 0x0000, 0xffff, 0x0b7f0111 },
+    { 0x1301, 0x0001, 0x0000, 0x0bd70141 },
+    { 0x1302, 0x0000, 0xffff, 0x0bd70111 },
+    { 0x1301, 0x0001, 0x0000, 0x0bd70141 },
+    { 0x1302, 0x0000, 0xffff, 0x0bd70111 },
+    { 0x1301, 0x0001, 0x0000, 0x0ba70151 },
+    { 0x1302, 0x0000, 0xffff, 0x0ba70111 },
+    { 0x1301, 0x0001, 0x0000, 0x0bbf0151 },
+    { 0x1302, 0x0000, 0xffff, 0x0bbf0111 },
+    { 0x1301, 0x0001, 0x0000, 0x0c370121 },
+    { 0x1302, 0x0000, 0xffff, 0x0c370111 },
+    { 0x1301, 0x0001, 0x0000, 0x0ab90151 },
+    { 0x1302, 0x0000, 0xffff, 0x0ab90111 },
+    { 0x1301, 0xff7e, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0x0b630121 },
+    { 0x1302, 0x0000, 0xffff, 0x0b630111 },
+    { 0x1301, 0x0001, 0x0000, 0x0c1b0121 },
+    { 0x1302, 0x0000, 0xffff, 0x0c1b0111 },
+    { 0x1301, 0x0001, 0x0000, 0x0a150151 },
+    { 0x1302, 0x0000, 0xffff, 0x0a150111 },
+    { 0x1301, 0x0001, 0x0000, 0x0a650151 },
+    { 0x1302, 0x0000, 0xffff, 0x0a650111 },
+    { 0x1301, 0x0001, 0x0000, 0x0b4b0161 },
+    { 0x1302, 0x0000, 0xffff, 0x0b4b0111 },
+    { 0x1301, 0x0001, 0x0000, 0x0b4b0161 },
+    { 0x1302, 0x0000, 0xffff, 0x0b4b0111 },
+    { 0x1301, 0x0001, 0x0000, 0x0b4b0161 },
+    { 0x1302, 0x0000, 0xffff, 0x0b4b0111 },
+    { 0x1301, 0x0001, 0x0000, 0x0b4b0161 },
+    { 0x1302, 0x0000, 0xffff, 0x0b4b0111 },
+    { 0x1301, 0x0001, 0x0000, 0x0c070141 },
+    { 0x1302, 0x0000, 0xffff, 0x0c070111 },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1301, 0x2a2b, 0x0000, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0xff5d, 0x0000, 0xffffffff },
+    { 0x1301, 0x2a28, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x2a3f, 0xffffffff },
+    { 0x1302, 0x0000, 0x2a3f, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0xff3d, 0x0000, 0xffffffff },
+    { 0x1301, 0x0045, 0x0000, 0xffffffff },
+    { 0x1301, 0x0047, 0x0000, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1302, 0x0000, 0x2a1f, 0x0a1d0111 },
+    { 0x1302, 0x0000, 0x2a1c, 0x0a210111 },
+    { 0x1302, 0x0000, 0x2a1e, 0x0a250111 },
+    { 0x1302, 0x0000, 0xff2e, 0x0a350111 },
+    { 0x1302, 0x0000, 0xff32, 0x0b570111 },
+    { 0x1302, 0x0000, 0x0000, 0x0a450111 },
+    { 0x1302, 0x0000, 0xff33, 0x0a510111 },
+    { 0x1302, 0x0000, 0xff33, 0x0a550111 },
+    { 0x1302, 0x0000, 0x0000, 0x0a750111 },
+    { 0x1302, 0x0000, 0xff36, 0x0a6d0111 },
+    { 0x1302, 0x0000, 0x0000, 0x0a790111 },
+    { 0x1302, 0x0000, 0xff35, 0x0a710111 },
+    { 0x1302, 0x0000, 0xa54f, 0x0a7d0111 },
+    { 0x1302, 0x0000, 0x0000, 0x0a810111 },
+    { 0x1302, 0x0000, 0x0000, 0x0a850111 },
+    { 0x1302, 0x0000, 0x0000, 0x0aef0111 },
+    { 0x1302, 0x0000, 0xff33, 0x0aa50111 },
+    { 0x1302, 0x0000, 0xa54b, 0x0ab10111 },
+    { 0x1302, 0x0000, 0x0000, 0x0a9d0111 },
+    { 0x1302, 0x0000, 0xff31, 0x0aad0111 },
+    { 0x1302, 0x0000, 0x0000, 0x0a8d0111 },
+    { 0x1302, 0x0000, 0xa528, 0x0bdf0111 },
+    { 0x1302, 0x0000, 0xa544, 0x0ac90111 },
+    { 0x1302, 0x0000, 0x0000, 0x0acd0111 },
+    { 0x1302, 0x0000, 0xff2f, 0x0adf0111 },
+    { 0x1302, 0x0000, 0xff2d, 0x0ae30111 },
+    { 0x1302, 0x0000, 0xa544, 0x0adb0111 },
+    { 0x1302, 0x0000, 0x29f7, 0x0b130111 },
+    { 0x1302, 0x0000, 0xa541, 0x0b170111 },
+    { 0x1302, 0x0000, 0x0000, 0x0b1b0111 },
+    { 0x1302, 0x0000, 0x0000, 0x0b1f0111 },
+    { 0x1302, 0x0000, 0xff2d, 0x0be30111 },
+    { 0x1302, 0x0000, 0x0000, 0x0be70111 },
+    { 0x1302, 0x0000, 0x29fd, 0x0b2f0111 },
+    { 0x1302, 0x0000, 0xff2b, 0x0b3b0111 },
+    { 0x1302, 0x0000, 0x0000, 0x0b430111 },
+    { 0x1302, 0x0000, 0x0000, 0x0b370111 },
+    { 0x1302, 0x0000, 0xff2a, 0x0b5b0111 },
+    { 0x1302, 0x0000, 0x0000, 0x0b4f0111 },
+    { 0x1302, 0x0000, 0x0000, 0x0b5f0111 },
+    { 0x1302, 0x0000, 0x0000, 0x0b6f0111 },
+    { 0x1302, 0x0000, 0x0000, 0x0b870111 },
+    { 0x1302, 0x0000, 0x0000, 0x0b8b0111 },
+    { 0x1302, 0x0000, 0x0000, 0x0b8f0111 },
+    { 0x1302, 0x0000, 0x0000, 0x0b930111 },
+    { 0x1302, 0x0000, 0x29e7, 0x0b970111 },
+    { 0x1302, 0x0000, 0x0000, 0x0b9b0111 },
+    { 0x1302, 0x0000, 0x0000, 0x0b9f0111 },
+    { 0x1302, 0x0000, 0xff26, 0x0b830111 },
+    { 0x1302, 0x0000, 0x0000, 0x0ba30111 },
+    { 0x1302, 0x0000, 0x0000, 0x0bab0111 },
+    { 0x1302, 0x0000, 0xff26, 0x0baf0111 },
+    { 0x1302, 0x0000, 0x0000, 0x0af30111 },
+    { 0x1302, 0x0000, 0x0000, 0x0bb70111 },
+    { 0x1302, 0x0000, 0x0000, 0x0bbb0111 },
+    { 0x1302, 0x0000, 0xa52a, 0x0bd30111 },
+    { 0x1302, 0x0000, 0xff26, 0x0bcf0111 },
+    { 0x1302, 0x0000, 0xffbb, 0x0bdb0111 },
+    { 0x1302, 0x0000, 0xff27, 0x0beb0111 },
+    { 0x1302, 0x0000, 0xff27, 0x0bf30111 },
+    { 0x1302, 0x0000, 0xffb9, 0x0bf70111 },
+    { 0x1302, 0x0000, 0x0000, 0x0bff0111 },
+    { 0x1302, 0x0000, 0x0000, 0x0b270111 },
+    { 0x1302, 0x0000, 0x0000, 0x0c0b0111 },
+    { 0x1302, 0x0000, 0x0000, 0x0c1f0111 },
+    { 0x1302, 0x0000, 0x0000, 0x0c230111 },
+    { 0x1302, 0x0000, 0xff25, 0x0c270111 },
+    { 0x1302, 0x0000, 0x0000, 0x0c330111 },
+    { 0x1300, 0x0000, 0x0000, 0x0c530111 },
+    { 0x1302, 0x0000, 0x0000, 0x0c5b0111 },
+    { 0x1302, 0x0000, 0x0000, 0x0c6d0111 },
+    { 0x1302, 0x0000, 0x0000, 0x0c810111 },
+    { 0x1302, 0x0000, 0x0000, 0x0c850111 },
+    { 0x1302, 0x0000, 0x0000, 0x0a2d0111 },
+    { 0x1302, 0x0000, 0x0000, 0x0a890111 },
+    { 0x1302, 0x0000, 0x0000, 0x0aa90111 },
+    { 0x1302, 0x0000, 0x0000, 0x0abd0111 },
+    { 0x1302, 0x0000, 0xa515, 0x0aeb0111 },
+    { 0x1302, 0x0000, 0xa512, 0x0aff0111 },
+    { 0x1302, 0x0000, 0x0000, 0x0b070111 },
+    { 0x1302, 0x0000, 0x0000, 0x0b770111 },
+    { 0x1302, 0x0000, 0x0000, 0x0c650111 },
+    { 0x1302, 0x0000, 0x0000, 0x0c690111 },
+    { 0x1302, 0x0000, 0x0000, 0x0a490131 },
+    { 0x1302, 0x0000, 0x0000, 0x0a490131 },
+    { 0x1302, 0x0000, 0x0000, 0x0a490131 },
+    { 0x1302, 0x0000, 0x0000, 0x0bbf0131 },
+    { 0x1302, 0x0000, 0x0000, 0x0bbf0131 },
+    { 0x1302, 0x0000, 0x0000, 0x0bbf0131 },
+    { 0x1302, 0x0000, 0x0000, 0x0a910131 },
+    { 0x1302, 0x0000, 0x0000, 0x0b030131 },
+    { 0x1302, 0x0000, 0x0000, 0x0b030131 },
+    { 0x1302, 0x0000, 0x0000, 0x0c890111 },
+    { 0x1302, 0x0000, 0x0000, 0x0c8d0111 },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x0ab90191 },
+    { 0x1300, 0x0000, 0x0000, 0x0ac90121 },
+    { 0x1300, 0x0000, 0x0000, 0x0ae70171 },
+    { 0x1300, 0x0000, 0x0000, 0x0b7f0191 },
+    { 0x1300, 0x0000, 0x0000, 0x0b870121 },
+    { 0x1300, 0x0000, 0x0000, 0x0b8f0121 },
+    { 0x1300, 0x0000, 0x0000, 0x0ba30121 },
+    { 0x1300, 0x0000, 0x0000, 0x0bfb0171 },
+    { 0x1300, 0x0000, 0x0000, 0x0c070171 },
+    { 0xb300, 0x0000, 0x0000, 0x02e90111 },
+    { 0xb300, 0x0000, 0x0000, 0x02eb0111 },
+    { 0x1300, 0x0000, 0x0000, 0x0ad10111 },
+    { 0x1300, 0x0000, 0x0000, 0x0c580111 },
+    { 0x1300, 0x0000, 0x0000, 0x0ad20111 },
+    { 0x1300, 0x0000, 0x0000, 0x0c5a0111 },
+    { 0x1300, 0x0000, 0x0000, 0x0c5f0111 },
+    { 0x1300, 0x0000, 0x0000, 0x0c570111 },
+    { 0x1300, 0x0000, 0x0000, 0x0c600111 },
+    { 0xb200, 0x0000, 0x0000, 0x02ec0111 },
+    { 0xb200, 0x0000, 0x0000, 0x02ed0111 },
+    { 0xb200, 0x0000, 0x0000, 0x02ee0111 },
+    { 0xb200, 0x0000, 0x0000, 0x02ef0111 },
+    { 0xb300, 0x0000, 0x0000, 0x02f00111 },
+    { 0xb300, 0x0000, 0x0000, 0x02f10111 },
+    { 0xb300, 0x0000, 0x0000, 0x02f20111 },
+    { 0xb300, 0x0000, 0x0000, 0x02f30111 },
+    { 0xb300, 0x0000, 0x0000, 0x02f40111 },
+    { 0xb300, 0x0000, 0x0000, 0x02f50111 },
+    { 0xb300, 0x0000, 0x0000, 0x02f60111 },
+    { 0xb300, 0x0000, 0x0000, 0x02f70111 },
+    { 0xb300, 0x0000, 0x0000, 0x02f80111 },
+    { 0xb300, 0x0000, 0x0000, 0x02f90111 },
+    { 0x1300, 0x0000, 0x0000, 0x09d30111 },
+    { 0x1300, 0x0000, 0x0000, 0x09d40111 },
+    { 0xb200, 0x0000, 0x0000, 0x02fa0111 },
+    { 0xb200, 0x0000, 0x0000, 0x02fb0111 },
+    { 0xb200, 0x0000, 0x0000, 0x02fc0111 },
+    { 0xb200, 0x0000, 0x0000, 0x02fd0111 },
+    { 0xb200, 0x0000, 0x0000, 0x02fe0111 },
+    { 0xb200, 0x0000, 0x0000, 0x02ff0111 },
+    { 0xb200, 0x0000, 0x0000, 0x02120111 },
+    { 0xb200, 0x0000, 0x0000, 0x02130111 },
+    { 0xb200, 0x0000, 0x0000, 0x02150111 },
+    { 0xb200, 0x0000, 0x0000, 0x021a0111 },
+    { 0xb200, 0x0000, 0x0000, 0x020e0111 },
+    { 0xb200, 0x0000, 0x0000, 0x02160111 },
+    { 0xb200, 0x0000, 0x0000, 0x03000111 },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x0aad0131 },
+    { 0x1300, 0x0000, 0x0000, 0x0b0301b1 },
+    { 0x1300, 0x0000, 0x0000, 0x0ba70181 },
+    { 0x1300, 0x0000, 0x0000, 0x0c030191 },
+    { 0x1300, 0x0000, 0x0000, 0x0c5b0121 },
+    { 0xb200, 0x0000, 0x0000, 0x03010111 },
+    { 0xb200, 0x0000, 0x0000, 0x03020111 },
+    { 0xb200, 0x0000, 0x0000, 0x03030111 },
+    { 0xb200, 0x0000, 0x0000, 0x03040111 },
+    { 0xb200, 0x0000, 0x0000, 0x03050111 },
+    { 0xb200, 0x0000, 0x0000, 0x03060111 },
+    { 0xb200, 0x0000, 0x0000, 0x03070111 },
+    { 0xb300, 0x0000, 0x0000, 0x03080111 },
+    { 0xb200, 0x0000, 0x0000, 0x03090111 },
+    { 0x1300, 0x0000, 0x0000, 0x0c590111 },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    /* block 3 */
+    { 0xd200, 0x0000, 0x0000, 0x00000611 },
+    { 0xd200, 0x0000, 0x0000, 0x00000511 },
+    { 0xd200, 0x0000, 0x0000, 0x00000811 },
+    { 0xd200, 0x0000, 0x0000, 0x00000e11 },
+    { 0xd200, 0x0000, 0x0000, 0x00001311 },
+    { 0xd200, 0x0000, 0x0000, 0x00001411 },
+    { 0xd200, 0x0000, 0x0000, 0x00000711 },
+    { 0xd200, 0x0000, 0x0000, 0x00000f11 },
+    { 0xd200, 0x0000, 0x0000, 0x00000c11 },
+    { 0xd200, 0x0000, 0x0000, 0x00001511 },
+    { 0xd200, 0x0000, 0x0000, 0x00000a11 },
+    { 0xd200, 0x0000, 0x0000, 0x00000d11 },
+    { 0xd200, 0x0000, 0x0000, 0x00000911 },
+    { 0xd200, 0x0000, 0x0000, 0x00001611 },
+    { 0xd200, 0x0000, 0x0000, 0x00001711 },
+    { 0xd200, 0x0000, 0x0000, 0x00001811 },
+    { 0xd200, 0x0000, 0x0000, 0x00001911 },
+    { 0xd200, 0x0000, 0x0000, 0x00001a11 },
+    { 0xd200, 0x0000, 0x0000, 0x00001b11 },
+    { 0xd200, 0x0000, 0x0000, 0x00000311 },
+    { 0xd200, 0x0000, 0x0000, 0x00000411 },
+    { 0xd200, 0x0000, 0x0000, 0x00001c11 },
+    { 0xd200, 0x0000, 0x0000, 0x00001d11 },
+    { 0xd200, 0x0000, 0x0000, 0x00001e11 },
+    { 0xd200, 0x0000, 0x0000, 0x00001f11 },
+    { 0xd200, 0x0000, 0x0000, 0x00002011 },
+    { 0xd200, 0x0000, 0x0000, 0x00002111 },
+    { 0xd200, 0x0000, 0x0000, 0x00002211 },
+    { 0xd200, 0x0000, 0x0000, 0x00002311 },
+    { 0xd200, 0x0000, 0x0000, 0x00002411 },
+    { 0xd200, 0x0000, 0x0000, 0x00002511 },
+    { 0xd200, 0x0000, 0x0000, 0x00002611 },
+    { 0xd200, 0x0000, 0x0000, 0x00002711 },
+    { 0xd200, 0x0000, 0x0000, 0x00002811 },
+    { 0xd200, 0x0000, 0x0000, 0x00002911 },
+    { 0xd200, 0x0000, 0x0000, 0x00002a11 },
+    { 0xd200, 0x0000, 0x0000, 0x00002b11 },
+    { 0xd200, 0x0000, 0x0000, 0x00002c11 },
+    { 0xd200, 0x0000, 0x0000, 0x00002d11 },
+    { 0xd200, 0x0000, 0x0000, 0x00001111 },
+    { 0xd200, 0x0000, 0x0000, 0x00001211 },
+    { 0xd200, 0x0000, 0x0000, 0x00002e11 },
+    { 0xd200, 0x0000, 0x0000, 0x00002f11 },
+    { 0xd200, 0x0000, 0x0000, 0x00003011 },
+    { 0xd200, 0x0000, 0x0000, 0x00003111 },
+    { 0xd200, 0x0000, 0x0000, 0x00003211 },
+    { 0xd200, 0x0000, 0x0000, 0x00003311 },
+    { 0xd200, 0x0000, 0x0000, 0x00003411 },
+    { 0xd200, 0x0000, 0x0000, 0x00003511 },
+    { 0xd200, 0x0000, 0x0000, 0x00003611 },
+    { 0xd200, 0x0000, 0x0000, 0x00000211 },
+    { 0xd200, 0x0000, 0x0000, 0x00003711 },
+    { 0xd200, 0x0000, 0x0000, 0x00003811 },
+    { 0xd200, 0x0000, 0x0000, 0x00003911 },
+    { 0xd200, 0x0000, 0x0000, 0x00003a11 },
+    { 0xd200, 0x0000, 0x0000, 0x00003b11 },
+    { 0xd200, 0x0000, 0x0000, 0x00001011 },
+    { 0xd200, 0x0000, 0x0000, 0x00003c11 },
+    { 0xd200, 0x0000, 0x0000, 0x00003d11 },
+    { 0xd200, 0x0000, 0x0000, 0x00003e11 },
+    { 0xd200, 0x0000, 0x0000, 0x00003f11 },
+    { 0xd200, 0x0000, 0x0000, 0x00004011 },
+    { 0xd200, 0x0000, 0x0000, 0x00004111 },
+    { 0xd200, 0x0000, 0x0000, 0x00004211 },
+    { 0xd200, 0x0000, 0x0000, 0x00000611 },
+    { 0xd200, 0x0000, 0x0000, 0x00000511 },
+    { 0xd200, 0x0000, 0x0000, 0x00000b11 },
+    { 0xd200, 0x0000, 0x0000, 0x00000311 },
+    { 0xd200, 0x0000, 0x0000, 0x00000c11 },
+    { 0xd200, 0x0000, 0x0054, 0x00004311 },
+    { 0xd200, 0x0000, 0x0000, 0x00004411 },
+    { 0xd200, 0x0000, 0x0000, 0x00004511 },
+    { 0xd200, 0x0000, 0x0000, 0x00004611 },
+    { 0xd200, 0x0000, 0x0000, 0x00004711 },
+    { 0xd200, 0x0000, 0x0000, 0x00004811 },
+    { 0xd200, 0x0000, 0x0000, 0x00004911 },
+    { 0xd200, 0x0000, 0x0000, 0x00004a11 },
+    { 0xd200, 0x0000, 0x0000, 0x00004b11 },
+    { 0xd200, 0x0000, 0x0000, 0x00004c11 },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0x00004d11 },
+    { 0xd200, 0x0000, 0x0000, 0x00004e11 },
+    { 0xd200, 0x0000, 0x0000, 0x00004f11 },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0xb300, 0x0000, 0x0000, 0x02e90111 },
+    { 0xb200, 0x0000, 0x0000, 0x02ea0111 },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x0c9b0111 },
+    { 0x1302, 0x0000, 0x0082, 0xffffffff },
+    { 0x1302, 0x0000, 0x0082, 0xffffffff },
+    { 0x1302, 0x0000, 0x0082, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0x02350111 },
+    { 0x1301, 0x0074, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0x020d0111 },
+    { 0xb200, 0x0000, 0x0000, 0x02140111 },
+    { 0x1301, 0x0026, 0x0000, 0x0c910121 },
+    { 0xb210, 0x0000, 0x0000, 0x025f0111 },
+    { 0x1301, 0x0025, 0x0000, 0x0c950131 },
+    { 0x1301, 0x0025, 0x0000, 0x0c990121 },
+    { 0x1301, 0x0025, 0x0000, 0x0c9b0121 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1301, 0x0040, 0x0000, 0x0ca20121 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1301, 0x003f, 0x0000, 0x0ca80121 },
+    { 0x1301, 0x003f, 0x0000, 0x0cac0121 },
+    { 0x1302, 0x0000, 0x0000, 0x0c9b0111 },
+    { 0x1301, 0x0020, 0x0000, 0x0c910121 },
+    { 0x1301, 0x0020, 0x0000, 0x0c920131 },
+    { 0x1301, 0x0020, 0x0000, 0x0c930121 },
+    { 0x1301, 0x0020, 0x0000, 0x0c940121 },
+    { 0x1301, 0x0020, 0x0000, 0x0c950131 },
+    { 0x1301, 0x0020, 0x0000, 0x0c980121 },
+    { 0x1301, 0x0020, 0x0000, 0x0c990121 },
+    { 0x1301, 0x0020, 0x0000, 0x0c9a0131 },
+    { 0x1301, 0x0020, 0x0000, 0x0c9b0121 },
+    { 0x1301, 0x0020, 0x0000, 0x0c9d0131 },
+    { 0x1301, 0x0020, 0x0000, 0x0c9e0121 },
+    { 0x1301, 0x0020, 0x0000, 0x0c9f0131 },
+    { 0x1301, 0x0020, 0x0000, 0x0ca00121 },
+    { 0x1301, 0x0020, 0x0000, 0x0ca10121 },
+    { 0x1301, 0x0020, 0x0000, 0x0ca20121 },
+    { 0x1301, 0x0020, 0x0000, 0x0ca30131 },
+    { 0x1301, 0x0020, 0x0000, 0x0ca50131 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1301, 0x0020, 0x0000, 0x0ca60131 },
+    { 0x1301, 0x0020, 0x0000, 0x0ca70121 },
+    { 0x1301, 0x0020, 0x0000, 0x0ca80121 },
+    { 0x1301, 0x0020, 0x0000, 0x0ca90131 },
+    { 0x1301, 0x0020, 0x0000, 0x0caa0121 },
+    { 0x1301, 0x0020, 0x0000, 0x0cab0121 },
+    { 0x1301, 0x0020, 0x0000, 0x0cac0121 },
+    { 0x1301, 0x0020, 0x0000, 0x0c9b0121 },
+    { 0x1301, 0x0020, 0x0000, 0x0ca80121 },
+    { 0x1302, 0x0000, 0xffda, 0x0c910111 },
+    { 0x1302, 0x0000, 0xffdb, 0x0c950111 },
+    { 0x1302, 0x0000, 0xffdb, 0x0c990111 },
+    { 0x1302, 0x0000, 0xffdb, 0x0c9b0111 },
+    { 0x1302, 0x0000, 0x0000, 0x0ca80111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0c910111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0c920111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0c930111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0c940111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0c950111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0c980111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0c990111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0c9a0111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0c9b0111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0c9d0111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0c9e0111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0c9f0111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0ca00111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0ca10111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0ca20111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0ca30111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0ca50111 },
+    { 0x1302, 0x0000, 0xffe1, 0x0ca60141 },
+    { 0x1302, 0x0000, 0xffe0, 0x0ca60111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0ca70111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0ca80111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0ca90111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0caa0111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0cab0111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0cac0111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0c9b0111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0ca80111 },
+    { 0x1302, 0x0000, 0xffc0, 0x0ca20111 },
+    { 0x1302, 0x0000, 0xffc1, 0x0ca80111 },
+    { 0x1302, 0x0000, 0xffc1, 0x0cac0111 },
+    { 0x1301, 0x0008, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffc2, 0x0c920121 },
+    { 0x1302, 0x0000, 0xffc7, 0x0c9a0121 },
+    { 0x1301, 0x0000, 0x0000, 0x0ca80131 },
+    { 0x1301, 0x0000, 0x0000, 0x0ca80131 },
+    { 0x1301, 0x0000, 0x0000, 0x0ca80131 },
+    { 0x1302, 0x0000, 0xffd1, 0x0ca90121 },
+    { 0x1302, 0x0000, 0xffca, 0x0ca30121 },
+    { 0x1302, 0x0000, 0xfff8, 0x0c9d0121 },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0x0c970121 },
+    { 0x1302, 0x0000, 0xffff, 0x0c970111 },
+    { 0x1301, 0x0001, 0x0000, 0x0c960121 },
+    { 0x1302, 0x0000, 0xffff, 0x0c960111 },
+    { 0x1301, 0x0001, 0x0000, 0x0ca40121 },
+    { 0x1302, 0x0000, 0xffff, 0x0ca40111 },
+    { 0x1301, 0x0001, 0x0000, 0x0cad0121 },
+    { 0x1302, 0x0000, 0xffff, 0x0cad0111 },
+    { 0x1301, 0x0001, 0x0000, 0x0cae0121 },
+    { 0x1302, 0x0000, 0xffff, 0x0cae0111 },
+    { 0x1301, 0x0001, 0x0000, 0x0caf0121 },
+    { 0x1302, 0x0000, 0xffff, 0x0caf0111 },
+    { 0x1301, 0x0001, 0x0000, 0x0cb00121 },
+    { 0x1302, 0x0000, 0xffff, 0x0cb00111 },
+    { 0x1301, 0x0001, 0x0000, 0x0cb10121 },
+    { 0x1302, 0x0000, 0xffff, 0x0cb10111 },
+    { 0x1301, 0x0001, 0x0000, 0x0cb20121 },
+    { 0x1302, 0x0000, 0xffff, 0x0cb20111 },
+    { 0x1301, 0x0001, 0x0000, 0x0cb30121 },
+    { 0x1302, 0x0000, 0xffff, 0x0cb30111 },
+    { 0x1301, 0x0001, 0x0000, 0x0cb40121 },
+    { 0x1302, 0x0000, 0xffff, 0x0cb40111 },
+    { 0x1302, 0x0000, 0xffaa, 0x0c9d0121 },
+    { 0x1302, 0x0000, 0xffb0, 0x0ca50121 },
+    { 0x1302, 0x0000, 0x0007, 0x0ca60121 },
+    { 0x1302, 0x0000, 0xff8c, 0x0c9c0111 },
+    { 0x1301, 0xffc4, 0x0000, 0x0c9a0141 },
+    { 0x1302, 0x0000, 0xffa0, 0x0c950121 },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0xfff9, 0x0000, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1301, 0xff7e, 0x0000, 0xffffffff },
+    { 0x1301, 0xff7e, 0x0000, 0xffffffff },
+    { 0x1301, 0xff7e, 0x0000, 0xffffffff },
+    /* block 4 */
+    { 0x1301, 0x0050, 0x0000, 0x0cf10121 },
+    { 0x1301, 0x0050, 0x0000, 0x0cf10121 },
+    { 0x1301, 0x0050, 0x0000, 0x0ce50121 },
+    { 0x1301, 0x0050, 0x0000, 0x0ce90121 },
+    { 0x1301, 0x0050, 0x0000, 0x0cf90121 },
+    { 0x1301, 0x0050, 0x0000, 0x0d110121 },
+    { 0x1301, 0x0050, 0x0000, 0x0d210121 },
+    { 0x1301, 0x0050, 0x0000, 0x0d250121 },
+    { 0x1301, 0x0050, 0x0000, 0x0d2d0121 },
+    { 0x1301, 0x0050, 0x0000, 0x0d4d0121 },
+    { 0x1301, 0x0050, 0x0000, 0x0d650121 },
+    { 0x1301, 0x0050, 0x0000, 0x0d9d0121 },
+    { 0x1301, 0x0050, 0x0000, 0x0da10121 },
+    { 0x1301, 0x0050, 0x0000, 0x0d190121 },
+    { 0x1301, 0x0050, 0x0000, 0x0da90121 },
+    { 0x1301, 0x0050, 0x0000, 0x0e050121 },
+    { 0x1301, 0x0020, 0x0000, 0x0cb50121 },
+    { 0x1301, 0x0020, 0x0000, 0x0ccd0121 },
+    { 0x1301, 0x0020, 0x0000, 0x0cd10121 },
+    { 0x1301, 0x0020, 0x0000, 0x0cd50131 },
+    { 0x1301, 0x0020, 0x0000, 0x0ce10121 },
+    { 0x1301, 0x0020, 0x0000, 0x0cf10121 },
+    { 0x1301, 0x0020, 0x0000, 0x0cfd0121 },
+    { 0x1301, 0x0020, 0x0000, 0x0d090121 },
+    { 0x1301, 0x0020, 0x0000, 0x0d190121 },
+    { 0x1301, 0x0020, 0x0000, 0x0d290121 },
+    { 0x1301, 0x0020, 0x0000, 0x0d310121 },
+    { 0x1301, 0x0020, 0x0000, 0x0d490121 },
+    { 0x1301, 0x0020, 0x0000, 0x0d510121 },
+    { 0x1301, 0x0020, 0x0000, 0x0d550121 },
+    { 0x1301, 0x0020, 0x0000, 0x0d690121 },
+    { 0x1301, 0x0020, 0x0000, 0x0d790121 },
+    { 0x1301, 0x0020, 0x0000, 0x0d850121 },
+    { 0x1301, 0x0020, 0x0000, 0x0d8d0121 },
+    { 0x1301, 0x0020, 0x0000, 0x0d950121 },
+    { 0x1301, 0x0020, 0x0000, 0x0da50121 },
+    { 0x1301, 0x0020, 0x0000, 0x0dc10121 },
+    { 0x1301, 0x0020, 0x0000, 0x0dc50121 },
+    { 0x1301, 0x0020, 0x0000, 0x0de10121 },
+    { 0x1301, 0x0020, 0x0000, 0x0de90121 },
+    { 0x1301, 0x0020, 0x0000, 0x0e090121 },
+    { 0x1301, 0x0020, 0x0000, 0x0e0d0121 },
+    { 0x1301, 0x0020, 0x0000, 0x0e110121 },
+    { 0x1301, 0x0020, 0x0000, 0x0e150121 },
+    { 0x1301, 0x0020, 0x0000, 0x0e1d0121 },
+    { 0x1301, 0x0020, 0x0000, 0x0e290121 },
+    { 0x1301, 0x0020, 0x0000, 0x0e310121 },
+    { 0x1301, 0x0020, 0x0000, 0x0e350121 },
+    { 0x1302, 0x0000, 0xffe0, 0x0cb50111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0ccd0111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0cd10111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0cd50111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0ce10111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0cf10111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0cfd0111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0d090111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0d190111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0d290111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0d310111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0d490111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0d510111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0d550111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0d690111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0d790111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0d850111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0d8d0111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0d950111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0da50111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0dc10111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0dc50111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0de10111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0de90111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0e090111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0e0d0111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0e110111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0e150111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0e1d0111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0e290111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0e310111 },
+    { 0x1302, 0x0000, 0xffe0, 0x0e350111 },
+    { 0x1302, 0x0000, 0xffb0, 0x0cf10111 },
+    { 0x1302, 0x0000, 0xffb0, 0x0cf10111 },
+    { 0x1302, 0x0000, 0xffb0, 0x0ce50111 },
+    { 0x1302, 0x0000, 0xffb0, 0x0ce90111 },
+    { 0x1302, 0x0000, 0xffb0, 0x0cf90111 },
+    { 0x1302, 0x0000, 0xffb0, 0x0d110111 },
+    { 0x1302, 0x0000, 0xffb0, 0x0d210111 },
+    { 0x1302, 0x0000, 0xffb0, 0x0d250111 },
+    { 0x1302, 0x0000, 0xffb0, 0x0d2d0111 },
+    { 0x1302, 0x0000, 0xffb0, 0x0d4d0111 },
+    { 0x1302, 0x0000, 0xffb0, 0x0d650111 },
+    { 0x1302, 0x0000, 0xffb0, 0x0d9d0111 },
+    { 0x1302, 0x0000, 0xffb0, 0x0da10111 },
+    { 0x1302, 0x0000, 0xffb0, 0x0d190111 },
+    { 0x1302, 0x0000, 0xffb0, 0x0da90111 },
+    { 0x1302, 0x0000, 0xffb0, 0x0e050111 },
+    { 0x1301, 0x0001, 0x0000, 0x0dd10121 },
+    { 0x1302, 0x0000, 0xffff, 0x0dd10111 },
+    { 0x1301, 0x0001, 0x0000, 0x0e250121 },
+    { 0x1302, 0x0000, 0xffff, 0x0e250111 },
+    { 0x1301, 0x0001, 0x0000, 0x0e390121 },
+    { 0x1302, 0x0000, 0xffff, 0x0e390111 },
+    { 0x1301, 0x0001, 0x0000, 0x0e3d0121 },
+    { 0x1302, 0x0000, 0xffff, 0x0e3d0111 },
+    { 0x1301, 0x0001, 0x0000, 0x0e450121 },
+    { 0x1302, 0x0000, 0xffff, 0x0e450111 },
+    { 0x1301, 0x0001, 0x0000, 0x0e410121 },
+    { 0x1302, 0x0000, 0xffff, 0x0e410111 },
+    { 0x1301, 0x0001, 0x0000, 0x0e490121 },
+    { 0x1302, 0x0000, 0xffff, 0x0e490111 },
+    { 0x1301, 0x0001, 0x0000, 0x0e4d0121 },
+    { 0x1302, 0x0000, 0xffff, 0x0e4d0111 },
+    { 0x1301, 0x0001, 0x0000, 0x0e510121 },
+    { 0x1302, 0x0000, 0xffff, 0x0e510111 },
+    { 0x1301, 0x0001, 0x0000, 0x0e550121 },
+    { 0x1302, 0x0000, 0xffff, 0x0e550111 },
+    { 0x1301, 0x0001, 0x0000, 0x0e590121 },
+    { 0x1302, 0x0000, 0xffff, 0x0e590111 },
+    { 0x1301, 0x0001, 0x0000, 0x0e5d0121 },
+    { 0x1302, 0x0000, 0xffff, 0x0e5d0111 },
+    { 0x1301, 0x0001, 0x0000, 0x0dbd0121 },
+    { 0x1302, 0x0000, 0xffff, 0x0dbd0111 },
+    { 0x1301, 0x0001, 0x0000, 0x0ddd0121 },
+    { 0x1302, 0x0000, 0xffff, 0x0ddd0111 },
+    { 0x1301, 0x0001, 0x0000, 0x0dd90121 },
+    { 0x1302, 0x0000, 0xffff, 0x0dd90111 },
+    { 0x1301, 0x0001, 0x0000, 0x0dd50121 },
+    { 0x1302, 0x0000, 0xffff, 0x0dd50111 },
+    { 0x1301, 0x0001, 0x0000, 0x0d810121 },
+    { 0x1302, 0x0000, 0xffff, 0x0d810111 },
+    { 0x1200, 0x0000, 0x0000, 0x030b0111 },
+    { 0xd200, 0x0000, 0x0000, 0x00005411 },
+    { 0xd200, 0x0000, 0x0000, 0x00005511 },
+    { 0xd200, 0x0000, 0x0000, 0x00005611 },
+    { 0xd200, 0x0000, 0x0000, 0x00005711 },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0x00000001 },
+    { 0xd200, 0x0000, 0x0000, 0x00000001 },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0x0e210121 },
+    { 0x1302, 0x0000, 0xffff, 0x0e210111 },
+    { 0x1301, 0x0001, 0x0000, 0x0d890121 },
+    { 0x1302, 0x0000, 0xffff, 0x0d890111 },
+    { 0x1301, 0x0001, 0x0000, 0x0cd50141 },
+    { 0x1302, 0x0000, 0xffff, 0x0cd50121 },
+    { 0x1301, 0x0001, 0x0000, 0x0cd90121 },
+    { 0x1302, 0x0000, 0xffff, 0x0cd90111 },
+    { 0x1301, 0x0001, 0x0000, 0x0cdd0121 },
+    { 0x1302, 0x0000, 0xffff, 0x0cdd0111 },
+    { 0x1301, 0x0001, 0x0000, 0x0d050121 },
+    { 0x1302, 0x0000, 0xffff, 0x0d050111 },
+    { 0x1301, 0x0001, 0x0000, 0x0ced0121 },
+    { 0x1302, 0x0000, 0xffff, 0x0ced0111 },
+    { 0x1301, 0x0001, 0x0000, 0x0d350121 },
+    { 0x1302, 0x0000, 0xffff, 0x0d350111 },
+    { 0x1301, 0x0001, 0x0000, 0x0d450121 },
+    { 0x1302, 0x0000, 0xffff, 0x0d450111 },
+    { 0x1301, 0x0001, 0x0000, 0x0d410121 },
+    { 0x1302, 0x0000, 0xffff, 0x0d410111 },
+    { 0x1301, 0x0001, 0x0000, 0x0d3d0121 },
+    { 0x1302, 0x0000, 0xffff, 0x0d3d0111 },
+    { 0x1301, 0x0001, 0x0000, 0x0d590121 },
+    { 0x1302, 0x0000, 0xffff, 0x0d590111 },
+    { 0x1301, 0x0001, 0x0000, 0x0d610121 },
+    { 0x1302, 0x0000, 0xffff, 0x0d610111 },
+    { 0x1301, 0x0001, 0x0000, 0x0d7d0121 },
+    { 0x1302, 0x0000, 0xffff, 0x0d7d0111 },
+    { 0x1301, 0x0001, 0x0000, 0x0e610121 },
+    { 0x1302, 0x0000, 0xffff, 0x0e610111 },
+    { 0x1301, 0x0001, 0x0000, 0x0d910121 },
+    { 0x1302, 0x0000, 0xffff, 0x0d910111 },
+    { 0x1301, 0x0001, 0x0000, 0x0d990121 },
+    { 0x1302, 0x0000, 0xffff, 0x0d990111 },
+    { 0x1301, 0x0001, 0x0000, 0x0db50121 },
+    { 0x1302, 0x0000, 0xffff, 0x0db50111 },
+    { 0x1301, 0x0001, 0x0000, 0x0db90121 },
+    { 0x1302, 0x0000, 0xffff, 0x0db90111 },
+    { 0x1301, 0x0001, 0x0000, 0x0dc90121 },
+    { 0x1302, 0x0000, 0xffff, 0x0dc90111 },
+    { 0x1301, 0x0001, 0x0000, 0x0de50121 },
+    { 0x1302, 0x0000, 0xffff, 0x0de50111 },
+    { 0x1301, 0x0001, 0x0000, 0x0df10121 },
+    { 0x1302, 0x0000, 0xffff, 0x0df10111 },
+    { 0x1301, 0x0001, 0x0000, 0x0df90121 },
+    { 0x1302, 0x0000, 0xffff, 0x0df90111 },
+    { 0x1301, 0x0001, 0x0000, 0x0dcd0121 },
+    { 0x1302, 0x0000, 0xffff, 0x0dcd0111 },
+    { 0x1301, 0x0001, 0x0000, 0x0dfd0121 },
+    { 0x1302, 0x0000, 0xffff, 0x0dfd0111 },
+    { 0x1301, 0x0001, 0x0000, 0x0e010121 },
+    { 0x1302, 0x0000, 0xffff, 0x0e010111 },
+    { 0x1301, 0x000f, 0x0000, 0x0e650111 },
+    { 0x1301, 0x0001, 0x0000, 0x0cfd0121 },
+    { 0x1302, 0x0000, 0xffff, 0x0cfd0111 },
+    { 0x1301, 0x0001, 0x0000, 0x0d390121 },
+    { 0x1302, 0x0000, 0xffff, 0x0d390111 },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0x0d5d0121 },
+    { 0x1302, 0x0000, 0xffff, 0x0d5d0111 },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0x0df50121 },
+    { 0x1302, 0x0000, 0xffff, 0x0df50111 },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1302, 0x0000, 0xfff1, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0x0cb90121 },
+    { 0x1302, 0x0000, 0xffff, 0x0cb90111 },
+    { 0x1301, 0x0001, 0x0000, 0x0cbd0121 },
+    { 0x1302, 0x0000, 0xffff, 0x0cbd0111 },
+    { 0x1301, 0x0001, 0x0000, 0x0cc90121 },
+    { 0x1302, 0x0000, 0xffff, 0x0cc90111 },
+    { 0x1301, 0x0001, 0x0000, 0x0cf50121 },
+    { 0x1302, 0x0000, 0xffff, 0x0cf50111 },
+    { 0x1301, 0x0001, 0x0000, 0x0cc10121 },
+    { 0x1302, 0x0000, 0xffff, 0x0cc10111 },
+    { 0x1301, 0x0001, 0x0000, 0x0cc50121 },
+    { 0x1302, 0x0000, 0xffff, 0x0cc50111 },
+    { 0x1301, 0x0001, 0x0000, 0x0d010121 },
+    { 0x1302, 0x0000, 0xffff, 0x0d010111 },
+    { 0x1301, 0x0001, 0x0000, 0x0d0d0121 },
+    { 0x1302, 0x0000, 0xffff, 0x0d0d0111 },
+    { 0x1301, 0x0001, 0x0000, 0x0d150121 },
+    { 0x1302, 0x0000, 0xffff, 0x0d150111 },
+    { 0x1301, 0x0001, 0x0000, 0x0d190121 },
+    { 0x1302, 0x0000, 0xffff, 0x0d190111 },
+    { 0x1301, 0x0001, 0x0000, 0x0d1d0121 },
+    { 0x1302, 0x0000, 0xffff, 0x0d1d0111 },
+    { 0x1301, 0x0001, 0x0000, 0x0d6d0121 },
+    { 0x1302, 0x0000, 0xffff, 0x0d6d0111 },
+    { 0x1301, 0x0001, 0x0000, 0x0d710121 },
+    { 0x1302, 0x0000, 0xffff, 0x0d710111 },
+    { 0x1301, 0x0001, 0x0000, 0x0d750121 },
+    { 0x1302, 0x0000, 0xffff, 0x0d750111 },
+    { 0x1301, 0x0001, 0x0000, 0x0e2d0121 },
+    { 0x1302, 0x0000, 0xffff, 0x0e2d0111 },
+    { 0x1301, 0x0001, 0x0000, 0x0da50121 },
+    { 0x1302, 0x0000, 0xffff, 0x0da50111 },
+    { 0x1301, 0x0001, 0x0000, 0x0dad0121 },
+    { 0x1302, 0x0000, 0xffff, 0x0dad0111 },
+    { 0x1301, 0x0001, 0x0000, 0x0db10121 },
+    { 0x1302, 0x0000, 0xffff, 0x0db10111 },
+    { 0x1301, 0x0001, 0x0000, 0x0ded0121 },
+    { 0x1302, 0x0000, 0xffff, 0x0ded0111 },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0x0e190121 },
+    { 0x1302, 0x0000, 0xffff, 0x0e190111 },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    /* block 5 */
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1301, 0x0030, 0x0000, 0x0e900121 },
+    { 0x1301, 0x0030, 0x0000, 0x0e910121 },
+    { 0x1301, 0x0030, 0x0000, 0x0e920121 },
+    { 0x1301, 0x0030, 0x0000, 0x0e930121 },
+    { 0x1301, 0x0030, 0x0000, 0x0e940131 },
+    { 0x1301, 0x0030, 0x0000, 0x0e950121 },
+    { 0x1301, 0x0030, 0x0000, 0x0e960121 },
+    { 0x1301, 0x0030, 0x0000, 0x0e970121 },
+    { 0x1301, 0x0030, 0x0000, 0x0e980121 },
+    { 0x1301, 0x0030, 0x0000, 0x0e990121 },
+    { 0x1301, 0x0030, 0x0000, 0x0e9a0121 },
+    { 0x1301, 0x0030, 0x0000, 0x0e9b0121 },
+    { 0x1301, 0x0030, 0x0000, 0x0e9c0121 },
+    { 0x1301, 0x0030, 0x0000, 0x0e9d0121 },
+    { 0x1301, 0x0030, 0x0000, 0x0e9e0121 },
+    { 0x1301, 0x0030, 0x0000, 0x0e9f0121 },
+    { 0x1301, 0x0030, 0x0000, 0x0ea00121 },
+    { 0x1301, 0x0030, 0x0000, 0x0ea10121 },
+    { 0x1301, 0x0030, 0x0000, 0x0ea20121 },
+    { 0x1301, 0x0030, 0x0000, 0x0ea30131 },
+    { 0x1301, 0x0030, 0x0000, 0x0ea40121 },
+    { 0x1301, 0x0030, 0x0000, 0x0ea50121 },
+    { 0x1301, 0x0030, 0x0000, 0x0ea60121 },
+    { 0x1301, 0x0030, 0x0000, 0x0ea70121 },
+    { 0x1301, 0x0030, 0x0000, 0x0ea80121 },
+    { 0x1301, 0x0030, 0x0000, 0x0ea90121 },
+    { 0x1301, 0x0030, 0x0000, 0x0eaa0121 },
+    { 0x1301, 0x0030, 0x0000, 0x0eab0121 },
+    { 0x1301, 0x0030, 0x0000, 0x0eac0121 },
+    { 0x1301, 0x0030, 0x0000, 0x0ead0131 },
+    { 0x1301, 0x0030, 0x0000, 0x0eae0121 },
+    { 0x1301, 0x0030, 0x0000, 0x0eaf0121 },
+    { 0x1301, 0x0030, 0x0000, 0x0eb00121 },
+    { 0x1301, 0x0030, 0x0000, 0x0eb10121 },
+    { 0x1301, 0x0030, 0x0000, 0x0eb20121 },
+    { 0x1301, 0x0030, 0x0000, 0x0eb30121 },
+    { 0x1301, 0x0030, 0x0000, 0x0eb40121 },
+    { 0x1301, 0x0030, 0x0000, 0x0eb50121 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x0eb60111 },
+    { 0x1210, 0x0000, 0x0000, 0x02bf0111 },
+    { 0x1210, 0x0000, 0x0000, 0x02c00111 },
+    { 0x1210, 0x0000, 0x0000, 0x024d0111 },
+    { 0x1210, 0x0000, 0x0000, 0x022e0111 },
+    { 0x1210, 0x0000, 0x0000, 0x02500111 },
+    { 0x1210, 0x0000, 0x0000, 0x02c10111 },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffd0, 0x0e900111 },
+    { 0x1302, 0x0000, 0xffd0, 0x0e910111 },
+    { 0x1302, 0x0000, 0xffd0, 0x0e920111 },
+    { 0x1302, 0x0000, 0xffd0, 0x0e930111 },
+    { 0x1302, 0x0000, 0xffd0, 0x0e940111 },
+    { 0x1302, 0x0000, 0xffd0, 0x0e950111 },
+    { 0x1302, 0x0000, 0xffd0, 0x0e960111 },
+    { 0x1302, 0x0000, 0xffd0, 0x0e970111 },
+    { 0x1302, 0x0000, 0xffd0, 0x0e980111 },
+    { 0x1302, 0x0000, 0xffd0, 0x0e990111 },
+    { 0x1302, 0x0000, 0xffd0, 0x0e9a0111 },
+    { 0x1302, 0x0000, 0xffd0, 0x0e9b0111 },
+    { 0x1302, 0x0000, 0xffd0, 0x0e9c0111 },
+    { 0x1302, 0x0000, 0xffd0, 0x0e9d0111 },
+    { 0x1302, 0x0000, 0xffd0, 0x0e9e0111 },
+    { 0x1302, 0x0000, 0xffd0, 0x0e9f0111 },
+    { 0x1302, 0x0000, 0xffd0, 0x0ea00111 },
+    { 0x1302, 0x0000, 0xffd0, 0x0ea10111 },
+    { 0x1302, 0x0000, 0xffd0, 0x0ea20111 },
+    { 0x1302, 0x0000, 0xffd0, 0x0ea30111 },
+    { 0x1302, 0x0000, 0xffd0, 0x0ea40111 },
+    { 0x1302, 0x0000, 0xffd0, 0x0ea50111 },
+    { 0x1302, 0x0000, 0xffd0, 0x0ea60111 },
+    { 0x1302, 0x0000, 0xffd0, 0x0ea70111 },
+    { 0x1302, 0x0000, 0xffd0, 0x0ea80111 },
+    { 0x1302, 0x0000, 0xffd0, 0x0ea90111 },
+    { 0x1302, 0x0000, 0xffd0, 0x0eaa0111 },
+    { 0x1302, 0x0000, 0xffd0, 0x0eab0111 },
+    { 0x1302, 0x0000, 0xffd0, 0x0eac0111 },
+    { 0x1302, 0x0000, 0xffd0, 0x0ead0111 },
+    { 0x1302, 0x0000, 0xffd0, 0x0eae0111 },
+    { 0x1302, 0x0000, 0xffd0, 0x0eaf0111 },
+    { 0x1302, 0x0000, 0xffd0, 0x0eb00111 },
+    { 0x1302, 0x0000, 0xffd0, 0x0eb10111 },
+    { 0x1302, 0x0000, 0xffd0, 0x0eb20111 },
+    { 0x1302, 0x0000, 0xffd0, 0x0eb30111 },
+    { 0x1302, 0x0000, 0xffd0, 0x0eb40111 },
+    { 0x1302, 0x0000, 0xffd0, 0x0eb50111 },
+    { 0x1302, 0x0000, 0x0000, 0x0e940121 },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0x02380111 },
+    { 0xb210, 0x0000, 0x0000, 0x02220111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0x5200, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0x00000001 },
+    { 0xd200, 0x0000, 0x0000, 0x00000001 },
+    { 0xd200, 0x0000, 0x0000, 0x00000001 },
+    { 0xd200, 0x0000, 0x0000, 0x00000001 },
+    { 0xd200, 0x0000, 0x0000, 0x00000001 },
+    { 0xd200, 0x0000, 0x0000, 0x00000001 },
+    { 0xd200, 0x0000, 0x0000, 0x00000001 },
+    { 0xd200, 0x0000, 0x0000, 0x00000001 },
+    { 0xd200, 0x0000, 0x0000, 0x00000001 },
+    { 0xd200, 0x0000, 0x0000, 0x00000001 },
+    { 0xd200, 0x0000, 0x0000, 0x00000001 },
+    { 0xd200, 0x0000, 0x0000, 0x00000001 },
+    { 0xd200, 0x0000, 0x0000, 0x00000001 },
+    { 0xd200, 0x0000, 0x0000, 0x00000001 },
+    { 0xd200, 0x0000, 0x0000, 0x00000001 },
+    { 0xd200, 0x0000, 0x0000, 0x00000001 },
+    { 0xd200, 0x0000, 0x0000, 0x00000001 },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0x00000001 },
+    { 0xd200, 0x0000, 0x0000, 0x00000001 },
+    { 0xd200, 0x0000, 0x0000, 0x00000001 },
+    { 0xd200, 0x0000, 0x0000, 0x00000001 },
+    { 0xd200, 0x0000, 0x0000, 0x00000001 },
+    { 0xd200, 0x0000, 0x0000, 0x00000001 },
+    { 0xd200, 0x0000, 0x0000, 0x00000001 },
+    { 0xd200, 0x0000, 0x0000, 0x00000001 },
+    { 0xd200, 0x0000, 0x0000, 0x00000001 },
+    { 0xd200, 0x0000, 0x0000, 0x00000001 },
+    { 0xd200, 0x0000, 0x0000, 0x00000001 },
+    { 0xd200, 0x0000, 0x0000, 0x00000001 },
+    { 0xd200, 0x0000, 0x0000, 0x00000001 },
+    { 0xd200, 0x0000, 0x0000, 0x00005811 },
+    { 0xd200, 0x0000, 0x0000, 0x00005911 },
+    { 0xd200, 0x0000, 0x0000, 0x00005a11 },
+    { 0xd200, 0x0000, 0x0000, 0x00005b11 },
+    { 0xd200, 0x0000, 0x0000, 0x00005c11 },
+    { 0xd200, 0x0000, 0x0000, 0x00005d11 },
+    { 0xd200, 0x0000, 0x0000, 0x00005e11 },
+    { 0xd200, 0x0000, 0x0000, 0x00005f11 },
+    { 0xd200, 0x0000, 0x0000, 0x00006011 },
+    { 0xd200, 0x0000, 0x0000, 0x00006111 },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0x00006211 },
+    { 0xd200, 0x0000, 0x0000, 0x00006311 },
+    { 0xd200, 0x0000, 0x0000, 0x00000001 },
+    { 0x2210, 0x0000, 0x0000, 0x02c20111 },
+    { 0xd200, 0x0000, 0x0000, 0x00006411 },
+    { 0x2210, 0x0000, 0x0000, 0x02c30111 },
+    { 0xd200, 0x0000, 0x0000, 0x00006511 },
+    { 0xd200, 0x0000, 0x0000, 0x00006611 },
+    { 0x2210, 0x0000, 0x0000, 0x02c40111 },
+    { 0xd200, 0x0000, 0x0000, 0x00000001 },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x2210, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0x0eb70111 },
+    { 0x2300, 0x0000, 0x0000, 0x0eb80111 },
+    { 0x2300, 0x0000, 0x0000, 0x0eb90111 },
+    { 0x2300, 0x0000, 0x0000, 0x0eba0111 },
+    { 0x2300, 0x0000, 0x0000, 0x0ebb0111 },
+    { 0x2300, 0x0000, 0x0000, 0x0ebc0111 },
+    { 0x2300, 0x0000, 0x0000, 0x0ebd0111 },
+    { 0x2300, 0x0000, 0x0000, 0x0ebe0111 },
+    { 0x2300, 0x0000, 0x0000, 0x0ebf0111 },
+    { 0x2300, 0x0000, 0x0000, 0x0ec00111 },
+    { 0x2300, 0x0000, 0x0000, 0x0ec10131 },
+    { 0x2300, 0x0000, 0x0000, 0x0ec10111 },
+    { 0x2300, 0x0000, 0x0000, 0x0ec20111 },
+    { 0x2300, 0x0000, 0x0000, 0x0ec30131 },
+    { 0x2300, 0x0000, 0x0000, 0x0ec30111 },
+    { 0x2300, 0x0000, 0x0000, 0x0ec40121 },
+    { 0x2300, 0x0000, 0x0000, 0x0ec40111 },
+    { 0x2300, 0x0000, 0x0000, 0x0ec50111 },
+    { 0x2300, 0x0000, 0x0000, 0x0ec60111 },
+    { 0x2300, 0x0000, 0x0000, 0x0ec70121 },
+    { 0x2300, 0x0000, 0x0000, 0x0ec70111 },
+    { 0x2300, 0x0000, 0x0000, 0x0ec80121 },
+    { 0x2300, 0x0000, 0x0000, 0x0ec80111 },
+    { 0x2300, 0x0000, 0x0000, 0x0ec90111 },
+    { 0x2300, 0x0000, 0x0000, 0x0eca0111 },
+    { 0x2300, 0x0000, 0x0000, 0x0ecb0111 },
+    { 0x2300, 0x0000, 0x0000, 0x0ecc0111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0x0ebc0121 },
+    { 0x2300, 0x0000, 0x0000, 0x0ebc0121 },
+    { 0x2300, 0x0000, 0x0000, 0x0ec00121 },
+    { 0x2210, 0x0000, 0x0000, 0x02c50111 },
+    { 0x2210, 0x0000, 0x0000, 0x02c60111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    /* block 6 */
+    { 0x6220, 0x0000, 0x0000, 0xffffffff },
+    { 0x6220, 0x0000, 0x0000, 0xffffffff },
+    { 0x6220, 0x0000, 0x0000, 0xffffffff },
+    { 0x6220, 0x0000, 0x0000, 0xffffffff },
+    { 0x6220, 0x0000, 0x0000, 0xffffffff },
+    { 0x6220, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xc200, 0x0000, 0x0000, 0xffffffff },
+    { 0x5210, 0x0000, 0x0000, 0xffffffff },
+    { 0x5210, 0x0000, 0x0000, 0xffffffff },
+    { 0xc200, 0x0000, 0x0000, 0xffffffff },
+    { 0x7210, 0x0000, 0x0000, 0x022f0111 },
+    { 0xc210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xc210, 0x0000, 0x0000, 0x02360111 },
+    { 0xc220, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0xc210, 0x0000, 0x0000, 0xffffffff },
+    { 0xc210, 0x0000, 0x0000, 0x02510111 },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0x0ecd0111 },
+    { 0xc300, 0x0000, 0x0000, 0x0ece0111 },
+    { 0xc300, 0x0000, 0x0000, 0x0ecf0111 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed20111 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed30111 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed50111 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed60111 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed70111 },
+    { 0xc300, 0x0000, 0x0000, 0x0edb0111 },
+    { 0xc300, 0x0000, 0x0000, 0x0edc0111 },
+    { 0xc300, 0x0000, 0x0000, 0x0edd0111 },
+    { 0xc300, 0x0000, 0x0000, 0x0ee30111 },
+    { 0xc300, 0x0000, 0x0000, 0x0ee90111 },
+    { 0xc300, 0x0000, 0x0000, 0x0eea0111 },
+    { 0xc300, 0x0000, 0x0000, 0x0eee0111 },
+    { 0xc300, 0x0000, 0x0000, 0x0eef0111 },
+    { 0xc300, 0x0000, 0x0000, 0x0ef90111 },
+    { 0xc300, 0x0000, 0x0000, 0x0efa0111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f040111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f050111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f0a0111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f0b0111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f0f0111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f100111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f120111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f130111 },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0x020b0111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f160111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f1d0111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f200111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f2d0111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f320111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f330111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f390111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f3e0111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f480111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f490111 },
+    { 0xd200, 0x0000, 0x0000, 0x00006811 },
+    { 0xd200, 0x0000, 0x0000, 0x00006911 },
+    { 0xd200, 0x0000, 0x0000, 0x00006a11 },
+    { 0xd200, 0x0000, 0x0000, 0x00006b11 },
+    { 0xd200, 0x0000, 0x0000, 0x00006c11 },
+    { 0xd200, 0x0000, 0x0000, 0x00006d11 },
+    { 0xd200, 0x0000, 0x0000, 0x00006e11 },
+    { 0xd200, 0x0000, 0x0000, 0x00006f11 },
+    { 0xd200, 0x0000, 0x0000, 0x00007011 },
+    { 0xd200, 0x0000, 0x0000, 0x00007111 },
+    { 0xd200, 0x0000, 0x0000, 0x00007211 },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x6204, 0x0000, 0x0000, 0x0a0b0111 },
+    { 0x6204, 0x0000, 0x0000, 0x0a0c0111 },
+    { 0x6204, 0x0000, 0x0000, 0x0a0d0111 },
+    { 0x6204, 0x0000, 0x0000, 0x0a0e0111 },
+    { 0x6204, 0x0000, 0x0000, 0x0a0f0111 },
+    { 0x6204, 0x0000, 0x0000, 0x0a100111 },
+    { 0x6204, 0x0000, 0x0000, 0x0a110111 },
+    { 0x6204, 0x0000, 0x0000, 0x0a120111 },
+    { 0x6204, 0x0000, 0x0000, 0x0a130111 },
+    { 0x6204, 0x0000, 0x0000, 0x0a140111 },
+    { 0x5210, 0x0000, 0x0000, 0x02ab0111 },
+    { 0x6210, 0x0000, 0x0000, 0x02300111 },
+    { 0x6210, 0x0000, 0x0000, 0x02310111 },
+    { 0xc210, 0x0000, 0x0000, 0x02a30111 },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0x00007311 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed10111 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed00111 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed40111 },
+    { 0xc300, 0x0000, 0x0000, 0x0ecd0111 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed60121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f3e0121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f420121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f490121 },
+    { 0xc300, 0x0000, 0x0000, 0x0ede0111 },
+    { 0xc300, 0x0000, 0x0000, 0x0edf0111 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed80111 },
+    { 0xc300, 0x0000, 0x0000, 0x0ee00111 },
+    { 0xc300, 0x0000, 0x0000, 0x0ee10111 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed90111 },
+    { 0xc300, 0x0000, 0x0000, 0x0ee20111 },
+    { 0xc300, 0x0000, 0x0000, 0x0eda0111 },
+    { 0xc300, 0x0000, 0x0000, 0x0eeb0111 },
+    { 0xc300, 0x0000, 0x0000, 0x0eec0111 },
+    { 0xc300, 0x0000, 0x0000, 0x0ee40111 },
+    { 0xc300, 0x0000, 0x0000, 0x0ee50111 },
+    { 0xc300, 0x0000, 0x0000, 0x0eed0111 },
+    { 0xc300, 0x0000, 0x0000, 0x0ee60111 },
+    { 0xc300, 0x0000, 0x0000, 0x0ee80111 },
+    { 0xc300, 0x0000, 0x0000, 0x0ef00111 },
+    { 0xc300, 0x0000, 0x0000, 0x0ef10111 },
+    { 0xc300, 0x0000, 0x0000, 0x0ef20111 },
+    { 0xc300, 0x0000, 0x0000, 0x0ef30111 },
+    { 0xc300, 0x0000, 0x0000, 0x0ef40111 },
+    { 0xc300, 0x0000, 0x0000, 0x0ef50111 },
+    { 0xc300, 0x0000, 0x0000, 0x0ef60111 },
+    { 0xc300, 0x0000, 0x0000, 0x0ef70111 },
+    { 0xc300, 0x0000, 0x0000, 0x0ef80111 },
+    { 0xc300, 0x0000, 0x0000, 0x0efb0111 },
+    { 0xc300, 0x0000, 0x0000, 0x0efc0111 },
+    { 0xc300, 0x0000, 0x0000, 0x0efd0111 },
+    { 0xc300, 0x0000, 0x0000, 0x0efe0111 },
+    { 0xc300, 0x0000, 0x0000, 0x0eff0111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f000111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f010111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f020111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f030111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f060111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f070111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f080111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f0c0111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f0d0111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f110111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f140111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f170111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f180111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f190111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f1a0111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f1b0111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f1c0111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f1e0111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f1f0111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f210111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f220111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f230111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f240111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f250111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f260111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f270111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f280111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f290111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f2a0111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f2b0111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f2c0111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f2e0111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f2f0111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f300111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f310111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f380111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f340111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f350111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f360111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f370111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f3a0111 },
+    { 0xc300, 0x0000, 0x0000, 0x0ee70111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f3d0111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f3b0111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f3b0111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f3c0111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f3f0111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f400111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f410111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f420111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f430111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f440111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f450111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f460111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f4a0111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f4b0111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f4c0111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f470111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f4d0111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f4e0111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f4f0111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f4f0111 },
+    { 0xc210, 0x0000, 0x0000, 0x02570111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f3d0111 },
+    { 0xd200, 0x0000, 0x0000, 0x00007411 },
+    { 0xd200, 0x0000, 0x0000, 0x00007511 },
+    { 0xd200, 0x0000, 0x0000, 0x00007611 },
+    { 0xd200, 0x0000, 0x0000, 0x00007711 },
+    { 0xd200, 0x0000, 0x0000, 0x00007811 },
+    { 0xd200, 0x0000, 0x0000, 0x00007911 },
+    { 0xd200, 0x0000, 0x0000, 0x00007a11 },
+    { 0x6220, 0x0000, 0x0000, 0x00000001 },
+    { 0xb200, 0x0000, 0x0000, 0x00000001 },
+    { 0xd200, 0x0000, 0x0000, 0x00000001 },
+    { 0xd200, 0x0000, 0x0000, 0x00000001 },
+    { 0xd200, 0x0000, 0x0000, 0x00007b11 },
+    { 0xd200, 0x0000, 0x0000, 0x00007c11 },
+    { 0xd200, 0x0000, 0x0000, 0x00007d11 },
+    { 0xd200, 0x0000, 0x0000, 0x00007e11 },
+    { 0xc300, 0x0000, 0x0000, 0x0f3e0121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f490121 },
+    { 0xd200, 0x0000, 0x0000, 0x00007f11 },
+    { 0xd200, 0x0000, 0x0000, 0x00008011 },
+    { 0xb200, 0x0000, 0x0000, 0x030c0111 },
+    { 0xd200, 0x0000, 0x0000, 0x00000001 },
+    { 0xd200, 0x0000, 0x0000, 0x00000001 },
+    { 0xd200, 0x0000, 0x0000, 0x00000001 },
+    { 0xd200, 0x0000, 0x0000, 0x00008111 },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0x3204, 0x0000, 0x0000, 0x0a0b0111 },
+    { 0x3204, 0x0000, 0x0000, 0x0a0c0111 },
+    { 0x3204, 0x0000, 0x0000, 0x0a0d0111 },
+    { 0x3204, 0x0000, 0x0000, 0x0a0e0111 },
+    { 0x3204, 0x0000, 0x0000, 0x0a0f0111 },
+    { 0x3204, 0x0000, 0x0000, 0x0a100111 },
+    { 0x3204, 0x0000, 0x0000, 0x0a110111 },
+    { 0x3204, 0x0000, 0x0000, 0x0a120111 },
+    { 0x3204, 0x0000, 0x0000, 0x0a130111 },
+    { 0x3204, 0x0000, 0x0000, 0x0a140111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f090111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f0e0111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f150111 },
+    { 0xc200, 0x0000, 0x0000, 0x0ecd0121 },
+    { 0xc200, 0x0000, 0x0000, 0x0f320121 },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    /* block 7 */
+    { 0xc210, 0x0000, 0x0000, 0x02660111 },
+    { 0xc210, 0x0000, 0x0000, 0x02580111 },
+    { 0xc210, 0x0000, 0x0000, 0x02590111 },
+    { 0xc210, 0x0000, 0x0000, 0x02390111 },
+    { 0xc210, 0x0000, 0x0000, 0x023a0111 },
+    { 0xc210, 0x0000, 0x0000, 0x023b0111 },
+    { 0xc210, 0x0000, 0x0000, 0x023c0111 },
+    { 0xc210, 0x0000, 0x0000, 0x023d0111 },
+    { 0xc210, 0x0000, 0x0000, 0x023e0111 },
+    { 0xc210, 0x0000, 0x0000, 0x02520111 },
+    { 0xc210, 0x0000, 0x0000, 0x02c70111 },
+    { 0xc210, 0x0000, 0x0000, 0x02c80111 },
+    { 0xc210, 0x0000, 0x0000, 0x02c90111 },
+    { 0xc210, 0x0000, 0x0000, 0x02ca0111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0xc220, 0x0000, 0x0000, 0x00000000 },
+    { 0xc300, 0x0000, 0x0000, 0x0f500111 },
+    { 0xd200, 0x0000, 0x0000, 0x00008211 },
+    { 0xc300, 0x0000, 0x0000, 0x0f510111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f520111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f520121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f530111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f540111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f550111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f560111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f570111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f580111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f590111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f590121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f5a0111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f5b0111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f5c0111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f5d0111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f5e0111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f5f0111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f600111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f600121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f610111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f620111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f620121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f630111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f640111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f650111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f660111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f670111 },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0x00008311 },
+    { 0xd200, 0x0000, 0x0000, 0x00008411 },
+    { 0xd200, 0x0000, 0x0000, 0x00008511 },
+    { 0xd200, 0x0000, 0x0000, 0x00008611 },
+    { 0xd200, 0x0000, 0x0000, 0x00008711 },
+    { 0xd200, 0x0000, 0x0000, 0x00008811 },
+    { 0xd200, 0x0000, 0x0000, 0x00008911 },
+    { 0xd200, 0x0000, 0x0000, 0x00008a11 },
+    { 0xd200, 0x0000, 0x0000, 0x00008b11 },
+    { 0xd200, 0x0000, 0x0000, 0x00008c11 },
+    { 0xd200, 0x0000, 0x0000, 0x00008d11 },
+    { 0xd200, 0x0000, 0x0000, 0x00008e11 },
+    { 0xd200, 0x0000, 0x0000, 0x00008f11 },
+    { 0xd200, 0x0000, 0x0000, 0x00009011 },
+    { 0xd200, 0x0000, 0x0000, 0x00009111 },
+    { 0xd200, 0x0000, 0x0000, 0x00009211 },
+    { 0xd200, 0x0000, 0x0000, 0x00009311 },
+    { 0xd200, 0x0000, 0x0000, 0x00009411 },
+    { 0xd200, 0x0000, 0x0000, 0x00009511 },
+    { 0xd200, 0x0000, 0x0000, 0x00009611 },
+    { 0xd200, 0x0000, 0x0000, 0x00009711 },
+    { 0xd200, 0x0000, 0x0000, 0x00009811 },
+    { 0xd200, 0x0000, 0x0000, 0x00009911 },
+    { 0xd200, 0x0000, 0x0000, 0x00009a11 },
+    { 0xd200, 0x0000, 0x0000, 0x00009b11 },
+    { 0xd200, 0x0000, 0x0000, 0x00009c11 },
+    { 0xd200, 0x0000, 0x0000, 0x00009d11 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0x0f680111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f6b0111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f6c0111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f6d0111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f6f0111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f700111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f710111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f720111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f750111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f770111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f780111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f790111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f7b0111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f7f0111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f800111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f820111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f830111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f870111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f880111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f890111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f8a0111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f8b0111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f8c0111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f8d0111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f7c0111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f690111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f6a0111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f7a0111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f6e0111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f840111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f850111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f860111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f7d0111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f7e0111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f730111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f740111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f810111 },
+    { 0xc300, 0x0000, 0x0000, 0x0f760111 },
+    { 0xd200, 0x0000, 0x0000, 0x0f8e0111 },
+    { 0xd200, 0x0000, 0x0000, 0x0f8f0111 },
+    { 0xd200, 0x0000, 0x0000, 0x0f900111 },
+    { 0xd200, 0x0000, 0x0000, 0x0f910111 },
+    { 0xd200, 0x0000, 0x0000, 0x0f920111 },
+    { 0xd200, 0x0000, 0x0000, 0x0f930111 },
+    { 0xd200, 0x0000, 0x0000, 0x0f940111 },
+    { 0xd200, 0x0000, 0x0000, 0x0f950111 },
+    { 0xd200, 0x0000, 0x0000, 0x0f960111 },
+    { 0xd200, 0x0000, 0x0000, 0x0f970111 },
+    { 0xd200, 0x0000, 0x0000, 0x0f980111 },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x2204, 0x0000, 0x0000, 0xffffffff },
+    { 0x2204, 0x0000, 0x0000, 0xffffffff },
+    { 0x2204, 0x0000, 0x0000, 0xffffffff },
+    { 0x2204, 0x0000, 0x0000, 0xffffffff },
+    { 0x2204, 0x0000, 0x0000, 0xffffffff },
+    { 0x2204, 0x0000, 0x0000, 0xffffffff },
+    { 0x2204, 0x0000, 0x0000, 0xffffffff },
+    { 0x2204, 0x0000, 0x0000, 0xffffffff },
+    { 0x2204, 0x0000, 0x0000, 0xffffffff },
+    { 0x2204, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x2200, 0x0000, 0x0000, 0xffffffff },
+    { 0x2200, 0x0000, 0x0000, 0xffffffff },
+    /* block 8 */
+    { 0x2300, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x2210, 0x0000, 0x0000, 0xffffffff },
+    { 0x2210, 0x0000, 0x0000, 0xffffffff },
+    { 0x2210, 0x0000, 0x0000, 0xffffffff },
+    { 0x2210, 0x0000, 0x0000, 0xffffffff },
+    { 0x2210, 0x0000, 0x0000, 0xffffffff },
+    { 0x2210, 0x0000, 0x0000, 0xffffffff },
+    { 0x2210, 0x0000, 0x0000, 0xffffffff },
+    { 0x2210, 0x0000, 0x0000, 0xffffffff },
+    { 0x2210, 0x0000, 0x0000, 0xffffffff },
+    { 0x2210, 0x0000, 0x0000, 0xffffffff },
+    { 0x2210, 0x0000, 0x0000, 0xffffffff },
+    { 0x2210, 0x0000, 0x0000, 0xffffffff },
+    { 0x2210, 0x0000, 0x0000, 0xffffffff },
+    { 0x2210, 0x0000, 0x0000, 0xffffffff },
+    { 0x2210, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x2210, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x6220, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    /* block 9 */
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0x00009f11 },
+    { 0xd200, 0x0000, 0x0000, 0x0000a011 },
+    { 0x1200, 0x0000, 0x0000, 0x0000a111 },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x10d70111 },
+    { 0x1300, 0x0000, 0x0000, 0x10d80111 },
+    { 0x1300, 0x0000, 0x0000, 0x10d90111 },
+    { 0x1300, 0x0000, 0x0000, 0x10da0111 },
+    { 0x1300, 0x0000, 0x0000, 0x10db0111 },
+    { 0x1300, 0x0000, 0x0000, 0x10dc0111 },
+    { 0x1300, 0x0000, 0x0000, 0x10dd0111 },
+    { 0x1300, 0x0000, 0x0000, 0x10df0111 },
+    { 0x1300, 0x0000, 0x0000, 0x10e10111 },
+    { 0x1300, 0x0000, 0x0000, 0x10e20111 },
+    { 0x1300, 0x0000, 0x0000, 0x10e30111 },
+    { 0x1300, 0x0000, 0x0000, 0x10e40111 },
+    { 0x1300, 0x0000, 0x0000, 0x10e50111 },
+    { 0x1300, 0x0000, 0x0000, 0x10e60111 },
+    { 0x1300, 0x0000, 0x0000, 0x10e70111 },
+    { 0x1300, 0x0000, 0x0000, 0x10e80111 },
+    { 0x1300, 0x0000, 0x0000, 0x10e90111 },
+    { 0x1300, 0x0000, 0x0000, 0x10ea0111 },
+    { 0x1300, 0x0000, 0x0000, 0x10eb0111 },
+    { 0x1300, 0x0000, 0x0000, 0x10ec0111 },
+    { 0x1300, 0x0000, 0x0000, 0x10ed0111 },
+    { 0x1300, 0x0000, 0x0000, 0x10ee0111 },
+    { 0x1300, 0x0000, 0x0000, 0x10ef0111 },
+    { 0x1300, 0x0000, 0x0000, 0x10f00111 },
+    { 0x1300, 0x0000, 0x0000, 0x10f10111 },
+    { 0x1300, 0x0000, 0x0000, 0x10f20111 },
+    { 0x1300, 0x0000, 0x0000, 0x10f30111 },
+    { 0x1300, 0x0000, 0x0000, 0x10f40111 },
+    { 0x1300, 0x0000, 0x0000, 0x10f50111 },
+    { 0x1300, 0x0000, 0x0000, 0x10f60111 },
+    { 0x1300, 0x0000, 0x0000, 0x10f70111 },
+    { 0x1300, 0x0000, 0x0000, 0x10f80111 },
+    { 0x1300, 0x0000, 0x0000, 0x10f90111 },
+    { 0x1300, 0x0000, 0x0000, 0x10fa0111 },
+    { 0x1300, 0x0000, 0x0000, 0x10fb0111 },
+    { 0x1300, 0x0000, 0x0000, 0x10fc0111 },
+    { 0x1300, 0x0000, 0x0000, 0x10fc0111 },
+    { 0x1300, 0x0000, 0x0000, 0x10fd0111 },
+    { 0x1300, 0x0000, 0x0000, 0x10fe0111 },
+    { 0x1300, 0x0000, 0x0000, 0x10ff0111 },
+    { 0x1300, 0x0000, 0x0000, 0x11000111 },
+    { 0x1300, 0x0000, 0x0000, 0x11010111 },
+    { 0x1300, 0x0000, 0x0000, 0x11020111 },
+    { 0x1300, 0x0000, 0x0000, 0x11030111 },
+    { 0x1300, 0x0000, 0x0000, 0x11030111 },
+    { 0x1300, 0x0000, 0x0000, 0x11040111 },
+    { 0x1300, 0x0000, 0x0000, 0x11050111 },
+    { 0x1300, 0x0000, 0x0000, 0x11050111 },
+    { 0x1300, 0x0000, 0x0000, 0x11060111 },
+    { 0x1300, 0x0000, 0x0000, 0x11070111 },
+    { 0x1300, 0x0000, 0x0000, 0x11080111 },
+    { 0x1300, 0x0000, 0x0000, 0x11090111 },
+    { 0x1300, 0x0000, 0x0000, 0x110a0111 },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0x00009e11 },
+    { 0x1300, 0x0000, 0x0000, 0x110b0111 },
+    { 0x1200, 0x0000, 0x0000, 0x110c0111 },
+    { 0x1200, 0x0000, 0x0000, 0x110d0111 },
+    { 0x1200, 0x0000, 0x0000, 0x110e0111 },
+    { 0xd200, 0x0000, 0x0000, 0x110f0111 },
+    { 0xd200, 0x0000, 0x0000, 0x11100111 },
+    { 0xd200, 0x0000, 0x0000, 0x11110111 },
+    { 0xd200, 0x0000, 0x0000, 0x11120111 },
+    { 0xd200, 0x0000, 0x0000, 0x11150111 },
+    { 0xd200, 0x0000, 0x0000, 0x11160111 },
+    { 0xd200, 0x0000, 0x0000, 0x11170111 },
+    { 0xd200, 0x0000, 0x0000, 0x11180111 },
+    { 0x1200, 0x0000, 0x0000, 0x11190111 },
+    { 0x1200, 0x0000, 0x0000, 0x111a0111 },
+    { 0x1200, 0x0000, 0x0000, 0x111b0111 },
+    { 0x1200, 0x0000, 0x0000, 0x111c0111 },
+    { 0xd200, 0x0000, 0x0000, 0x111d0111 },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x10d60111 },
+    { 0xd200, 0x0000, 0x0000, 0x0000a211 },
+    { 0xd200, 0x0000, 0x0000, 0x0000a311 },
+    { 0xd200, 0x0000, 0x0000, 0x0000a411 },
+    { 0xd200, 0x0000, 0x0000, 0x0000a511 },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x10e90111 },
+    { 0x1300, 0x0000, 0x0000, 0x10ea0111 },
+    { 0x1300, 0x0000, 0x0000, 0x10eb0111 },
+    { 0x1300, 0x0000, 0x0000, 0x10f00111 },
+    { 0x1300, 0x0000, 0x0000, 0x10f50111 },
+    { 0x1300, 0x0000, 0x0000, 0x10f60111 },
+    { 0x1300, 0x0000, 0x0000, 0x10fe0111 },
+    { 0x1300, 0x0000, 0x0000, 0x11020111 },
+    { 0x1300, 0x0000, 0x0000, 0x10de0111 },
+    { 0x1300, 0x0000, 0x0000, 0x10e00111 },
+    { 0xd200, 0x0000, 0x0000, 0x11130111 },
+    { 0xd200, 0x0000, 0x0000, 0x11140111 },
+    { 0x1210, 0x0000, 0x0000, 0x02600111 },
+    { 0x1210, 0x0000, 0x0000, 0x02610111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a0b0111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a0c0111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a0d0111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a0e0111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a0f0111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a100111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a110111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a120111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a130111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a140111 },
+    { 0x1210, 0x0000, 0x0000, 0x02cd0111 },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0x0000a711 },
+    { 0x1200, 0x0000, 0x0000, 0x0000a811 },
+    { 0x1200, 0x0000, 0x0000, 0x0000a911 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x111e0111 },
+    { 0x1300, 0x0000, 0x0000, 0x111f0111 },
+    { 0x1300, 0x0000, 0x0000, 0x11200111 },
+    { 0x1300, 0x0000, 0x0000, 0x11210111 },
+    { 0x1300, 0x0000, 0x0000, 0x11220111 },
+    { 0x1300, 0x0000, 0x0000, 0x11230111 },
+    { 0x1300, 0x0000, 0x0000, 0x11240111 },
+    { 0x1300, 0x0000, 0x0000, 0x11260111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x11280111 },
+    { 0x1300, 0x0000, 0x0000, 0x11290111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x112a0111 },
+    { 0x1300, 0x0000, 0x0000, 0x112b0111 },
+    { 0x1300, 0x0000, 0x0000, 0x112c0111 },
+    { 0x1300, 0x0000, 0x0000, 0x112d0111 },
+    { 0x1300, 0x0000, 0x0000, 0x112e0111 },
+    { 0x1300, 0x0000, 0x0000, 0x112f0111 },
+    { 0x1300, 0x0000, 0x0000, 0x11300111 },
+    { 0x1300, 0x0000, 0x0000, 0x11310111 },
+    { 0x1300, 0x0000, 0x0000, 0x11320111 },
+    { 0x1300, 0x0000, 0x0000, 0x11330111 },
+    { 0x1300, 0x0000, 0x0000, 0x11340111 },
+    { 0x1300, 0x0000, 0x0000, 0x11350111 },
+    { 0x1300, 0x0000, 0x0000, 0x11360111 },
+    { 0x1300, 0x0000, 0x0000, 0x11370111 },
+    { 0x1300, 0x0000, 0x0000, 0x11380111 },
+    { 0x1300, 0x0000, 0x0000, 0x11390111 },
+    { 0x1300, 0x0000, 0x0000, 0x113a0111 },
+    { 0x1300, 0x0000, 0x0000, 0x113b0111 },
+    { 0x1300, 0x0000, 0x0000, 0x113c0111 },
+    { 0x1300, 0x0000, 0x0000, 0x113d0111 },
+    { 0x1300, 0x0000, 0x0000, 0x113e0111 },
+    { 0x1300, 0x0000, 0x0000, 0x113f0111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x11400111 },
+    { 0x1300, 0x0000, 0x0000, 0x11410111 },
+    { 0x1300, 0x0000, 0x0000, 0x11420111 },
+    { 0x1300, 0x0000, 0x0000, 0x11430111 },
+    { 0x1300, 0x0000, 0x0000, 0x11440111 },
+    { 0x1300, 0x0000, 0x0000, 0x11450111 },
+    { 0x1300, 0x0000, 0x0000, 0x11460111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x11480111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x114a0111 },
+    { 0x1300, 0x0000, 0x0000, 0x114b0111 },
+    { 0x1300, 0x0000, 0x0000, 0x114c0111 },
+    { 0x1300, 0x0000, 0x0000, 0x114d0111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0x0000a611 },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0x114e0111 },
+    { 0x1200, 0x0000, 0x0000, 0x114f0111 },
+    { 0x1200, 0x0000, 0x0000, 0x11500111 },
+    { 0xd200, 0x0000, 0x0000, 0x11510111 },
+    { 0xd200, 0x0000, 0x0000, 0x11520111 },
+    { 0xd200, 0x0000, 0x0000, 0x11530111 },
+    { 0xd200, 0x0000, 0x0000, 0x11540111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0x11570111 },
+    { 0x1200, 0x0000, 0x0000, 0x11580111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0x11590111 },
+    { 0x1200, 0x0000, 0x0000, 0x115a0111 },
+    { 0xd200, 0x0000, 0x0000, 0x115b0111 },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0x115c0111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x11380111 },
+    { 0x1300, 0x0000, 0x0000, 0x11390111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x11450111 },
+    { 0x1300, 0x0000, 0x0000, 0x11250111 },
+    { 0x1300, 0x0000, 0x0000, 0x11270111 },
+    { 0xd200, 0x0000, 0x0000, 0x11550111 },
+    { 0xd200, 0x0000, 0x0000, 0x11560111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0x0a0b0111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a0c0111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a0d0111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a0e0111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a0f0111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a100111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a110111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a120111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a130111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a140111 },
+    { 0x1300, 0x0000, 0x0000, 0x11470111 },
+    { 0x1300, 0x0000, 0x0000, 0x11490111 },
+    { 0x5200, 0x0000, 0x0000, 0x09e30111 },
+    { 0x5200, 0x0000, 0x0000, 0x09e40111 },
+    { 0x1200, 0x0000, 0x0000, 0x0a0c0111 },
+    { 0x1200, 0x0000, 0x0000, 0x0a0d0111 },
+    { 0x1200, 0x0000, 0x0000, 0x0a0e0111 },
+    { 0x1200, 0x0000, 0x0000, 0x0a0f0111 },
+    { 0x1200, 0x0000, 0x0000, 0x09c10111 },
+    { 0x1200, 0x0000, 0x0000, 0x09c20111 },
+    { 0x1200, 0x0000, 0x0000, 0x030d0111 },
+    { 0x5200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    /* block 10 */
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0x0000ab11 },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x11620111 },
+    { 0x1300, 0x0000, 0x0000, 0x11630111 },
+    { 0x1300, 0x0000, 0x0000, 0x11670111 },
+    { 0x1300, 0x0000, 0x0000, 0x11680111 },
+    { 0x1300, 0x0000, 0x0000, 0x115f0111 },
+    { 0x1300, 0x0000, 0x0000, 0x11600111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x11690111 },
+    { 0x1300, 0x0000, 0x0000, 0x11640111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x11610111 },
+    { 0x1300, 0x0000, 0x0000, 0x11650111 },
+    { 0x1300, 0x0000, 0x0000, 0x116c0111 },
+    { 0x1300, 0x0000, 0x0000, 0x116d0111 },
+    { 0x1300, 0x0000, 0x0000, 0x116e0111 },
+    { 0x1300, 0x0000, 0x0000, 0x116f0111 },
+    { 0x1300, 0x0000, 0x0000, 0x11700111 },
+    { 0x1300, 0x0000, 0x0000, 0x11710111 },
+    { 0x1300, 0x0000, 0x0000, 0x11720111 },
+    { 0x1300, 0x0000, 0x0000, 0x11730111 },
+    { 0x1300, 0x0000, 0x0000, 0x11740111 },
+    { 0x1300, 0x0000, 0x0000, 0x11750111 },
+    { 0x1300, 0x0000, 0x0000, 0x11760111 },
+    { 0x1300, 0x0000, 0x0000, 0x11770111 },
+    { 0x1300, 0x0000, 0x0000, 0x11780111 },
+    { 0x1300, 0x0000, 0x0000, 0x11790111 },
+    { 0x1300, 0x0000, 0x0000, 0x117a0111 },
+    { 0x1300, 0x0000, 0x0000, 0x117b0111 },
+    { 0x1300, 0x0000, 0x0000, 0x117c0111 },
+    { 0x1300, 0x0000, 0x0000, 0x117d0111 },
+    { 0x1300, 0x0000, 0x0000, 0x117e0111 },
+    { 0x1300, 0x0000, 0x0000, 0x117f0111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x11800111 },
+    { 0x1300, 0x0000, 0x0000, 0x11810111 },
+    { 0x1300, 0x0000, 0x0000, 0x11820111 },
+    { 0x1300, 0x0000, 0x0000, 0x11830111 },
+    { 0x1300, 0x0000, 0x0000, 0x11840111 },
+    { 0x1300, 0x0000, 0x0000, 0x11850111 },
+    { 0x1300, 0x0000, 0x0000, 0x11860111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x11870111 },
+    { 0x1300, 0x0000, 0x0000, 0x11870111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x11880111 },
+    { 0x1300, 0x0000, 0x0000, 0x116a0111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x116a0111 },
+    { 0x1300, 0x0000, 0x0000, 0x116b0111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0x0000aa11 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0x118a0111 },
+    { 0x1200, 0x0000, 0x0000, 0x118b0111 },
+    { 0x1200, 0x0000, 0x0000, 0x118c0111 },
+    { 0xd200, 0x0000, 0x0000, 0x118d0111 },
+    { 0xd200, 0x0000, 0x0000, 0x118e0111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0x118f0111 },
+    { 0xd200, 0x0000, 0x0000, 0x11900111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0x11910111 },
+    { 0xd200, 0x0000, 0x0000, 0x11920111 },
+    { 0xd200, 0x0000, 0x0000, 0x11930111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x116d0111 },
+    { 0x1300, 0x0000, 0x0000, 0x116e0111 },
+    { 0x1300, 0x0000, 0x0000, 0x11730111 },
+    { 0x1300, 0x0000, 0x0000, 0x11890111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x11810111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0x0a0b0111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a0c0111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a0d0111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a0e0111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a0f0111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a100111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a110111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a120111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a130111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a140111 },
+    { 0xd200, 0x0000, 0x0000, 0x0000ac11 },
+    { 0xd200, 0x0000, 0x0000, 0x0000ad11 },
+    { 0x1300, 0x0000, 0x0000, 0x11660111 },
+    { 0x1300, 0x0000, 0x0000, 0x115e0111 },
+    { 0x1300, 0x0000, 0x0000, 0x115d0111 },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0x0000af11 },
+    { 0xd200, 0x0000, 0x0000, 0x0000b011 },
+    { 0x1200, 0x0000, 0x0000, 0x0000b111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x11950111 },
+    { 0x1300, 0x0000, 0x0000, 0x11960111 },
+    { 0x1300, 0x0000, 0x0000, 0x11970111 },
+    { 0x1300, 0x0000, 0x0000, 0x11980111 },
+    { 0x1300, 0x0000, 0x0000, 0x11990111 },
+    { 0x1300, 0x0000, 0x0000, 0x119a0111 },
+    { 0x1300, 0x0000, 0x0000, 0x119b0111 },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x119d0111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x119e0111 },
+    { 0x1300, 0x0000, 0x0000, 0x119f0111 },
+    { 0x1300, 0x0000, 0x0000, 0x11a00111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x11a10111 },
+    { 0x1300, 0x0000, 0x0000, 0x11a20111 },
+    { 0x1300, 0x0000, 0x0000, 0x11a30111 },
+    { 0x1300, 0x0000, 0x0000, 0x11a40111 },
+    { 0x1300, 0x0000, 0x0000, 0x11a50111 },
+    { 0x1300, 0x0000, 0x0000, 0x11a60111 },
+    { 0x1300, 0x0000, 0x0000, 0x11a70111 },
+    { 0x1300, 0x0000, 0x0000, 0x11a80111 },
+    { 0x1300, 0x0000, 0x0000, 0x11a90111 },
+    { 0x1300, 0x0000, 0x0000, 0x11aa0111 },
+    { 0x1300, 0x0000, 0x0000, 0x11ab0111 },
+    { 0x1300, 0x0000, 0x0000, 0x11ac0111 },
+    { 0x1300, 0x0000, 0x0000, 0x11ad0111 },
+    { 0x1300, 0x0000, 0x0000, 0x11ae0111 },
+    { 0x1300, 0x0000, 0x0000, 0x11af0111 },
+    { 0x1300, 0x0000, 0x0000, 0x11b00111 },
+    { 0x1300, 0x0000, 0x0000, 0x11b10111 },
+    { 0x1300, 0x0000, 0x0000, 0x11b20111 },
+    { 0x1300, 0x0000, 0x0000, 0x11b30111 },
+    { 0x1300, 0x0000, 0x0000, 0x11b40111 },
+    { 0x1300, 0x0000, 0x0000, 0x11b50111 },
+    { 0x1300, 0x0000, 0x0000, 0x11b60111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x11b70111 },
+    { 0x1300, 0x0000, 0x0000, 0x11b80111 },
+    { 0x1300, 0x0000, 0x0000, 0x11b90111 },
+    { 0x1300, 0x0000, 0x0000, 0x11ba0111 },
+    { 0x1300, 0x0000, 0x0000, 0x11bb0111 },
+    { 0x1300, 0x0000, 0x0000, 0x11bc0111 },
+    { 0x1300, 0x0000, 0x0000, 0x11bd0111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x11be0111 },
+    { 0x1300, 0x0000, 0x0000, 0x11bf0111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x11c00111 },
+    { 0x1300, 0x0000, 0x0000, 0x11c10111 },
+    { 0x1300, 0x0000, 0x0000, 0x11c20111 },
+    { 0x1300, 0x0000, 0x0000, 0x11c30111 },
+    { 0x1300, 0x0000, 0x0000, 0x11c40111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0x0000ae11 },
+    { 0x1300, 0x0000, 0x0000, 0x11c50111 },
+    { 0x1200, 0x0000, 0x0000, 0x11c60111 },
+    { 0x1200, 0x0000, 0x0000, 0x11c70111 },
+    { 0x1200, 0x0000, 0x0000, 0x11c80111 },
+    { 0xd200, 0x0000, 0x0000, 0x11c90111 },
+    { 0xd200, 0x0000, 0x0000, 0x11ca0111 },
+    { 0xd200, 0x0000, 0x0000, 0x11cb0111 },
+    { 0xd200, 0x0000, 0x0000, 0x11cc0111 },
+    { 0xd200, 0x0000, 0x0000, 0x11cd0111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0x11ce0111 },
+    { 0xd200, 0x0000, 0x0000, 0x11cf0111 },
+    { 0x1200, 0x0000, 0x0000, 0x11d00111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0x11d10111 },
+    { 0x1200, 0x0000, 0x0000, 0x11d20111 },
+    { 0xd200, 0x0000, 0x0000, 0x11d30111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x11940111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x119c0111 },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0x0a0b0111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a0c0111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a0d0111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a0e0111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a0f0111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a100111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a110111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a120111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a130111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a140111 },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x5200, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    /* block 11 */
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0x0000b311 },
+    { 0x1200, 0x0000, 0x0000, 0x0000b411 },
+    { 0x1200, 0x0000, 0x0000, 0x0000b511 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x11d40111 },
+    { 0x1300, 0x0000, 0x0000, 0x11d50111 },
+    { 0x1300, 0x0000, 0x0000, 0x11d60111 },
+    { 0x1300, 0x0000, 0x0000, 0x11d70111 },
+    { 0x1300, 0x0000, 0x0000, 0x11d80111 },
+    { 0x1300, 0x0000, 0x0000, 0x11d90111 },
+    { 0x1300, 0x0000, 0x0000, 0x11da0111 },
+    { 0x1300, 0x0000, 0x0000, 0x11dc0111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x11de0111 },
+    { 0x1300, 0x0000, 0x0000, 0x11df0111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x11e00111 },
+    { 0x1300, 0x0000, 0x0000, 0x11e10111 },
+    { 0x1300, 0x0000, 0x0000, 0x11e20111 },
+    { 0x1300, 0x0000, 0x0000, 0x11e30111 },
+    { 0x1300, 0x0000, 0x0000, 0x11e40111 },
+    { 0x1300, 0x0000, 0x0000, 0x11e50111 },
+    { 0x1300, 0x0000, 0x0000, 0x11e60111 },
+    { 0x1300, 0x0000, 0x0000, 0x11e70111 },
+    { 0x1300, 0x0000, 0x0000, 0x11e80111 },
+    { 0x1300, 0x0000, 0x0000, 0x11e90111 },
+    { 0x1300, 0x0000, 0x0000, 0x11ea0111 },
+    { 0x1300, 0x0000, 0x0000, 0x11eb0111 },
+    { 0x1300, 0x0000, 0x0000, 0x11ec0111 },
+    { 0x1300, 0x0000, 0x0000, 0x11ed0111 },
+    { 0x1300, 0x0000, 0x0000, 0x11ee0111 },
+    { 0x1300, 0x0000, 0x0000, 0x11ef0111 },
+    { 0x1300, 0x0000, 0x0000, 0x11f00111 },
+    { 0x1300, 0x0000, 0x0000, 0x11f10111 },
+    { 0x1300, 0x0000, 0x0000, 0x11f20111 },
+    { 0x1300, 0x0000, 0x0000, 0x11f30111 },
+    { 0x1300, 0x0000, 0x0000, 0x11f40111 },
+    { 0x1300, 0x0000, 0x0000, 0x11f50111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x11f60111 },
+    { 0x1300, 0x0000, 0x0000, 0x11f70111 },
+    { 0x1300, 0x0000, 0x0000, 0x11f80111 },
+    { 0x1300, 0x0000, 0x0000, 0x11f90111 },
+    { 0x1300, 0x0000, 0x0000, 0x11fa0111 },
+    { 0x1300, 0x0000, 0x0000, 0x11fb0111 },
+    { 0x1300, 0x0000, 0x0000, 0x11fd0111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x11fe0111 },
+    { 0x1300, 0x0000, 0x0000, 0x11ff0111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x12000111 },
+    { 0x1300, 0x0000, 0x0000, 0x12010111 },
+    { 0x1300, 0x0000, 0x0000, 0x12020111 },
+    { 0x1300, 0x0000, 0x0000, 0x12030111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0x0000b211 },
+    { 0x1300, 0x0000, 0x0000, 0x12040111 },
+    { 0x1200, 0x0000, 0x0000, 0x12050111 },
+    { 0xd200, 0x0000, 0x0000, 0x12060111 },
+    { 0x1200, 0x0000, 0x0000, 0x12070111 },
+    { 0xd200, 0x0000, 0x0000, 0x12080111 },
+    { 0xd200, 0x0000, 0x0000, 0x12090111 },
+    { 0xd200, 0x0000, 0x0000, 0x120a0111 },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0x120b0111 },
+    { 0x1200, 0x0000, 0x0000, 0x120c0111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0x120d0111 },
+    { 0x1200, 0x0000, 0x0000, 0x120e0111 },
+    { 0xd200, 0x0000, 0x0000, 0x120f0111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0x12100111 },
+    { 0x1200, 0x0000, 0x0000, 0x12110111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x11ee0111 },
+    { 0x1300, 0x0000, 0x0000, 0x11ef0111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x11fc0111 },
+    { 0x1300, 0x0000, 0x0000, 0x11db0111 },
+    { 0x1300, 0x0000, 0x0000, 0x11dd0111 },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0x0a0b0111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a0c0111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a0d0111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a0e0111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a0f0111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a100111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a110111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a120111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a130111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a140111 },
+    { 0x1200, 0x0000, 0x0000, 0x030e0111 },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0x0000b611 },
+    { 0x1300, 0x0000, 0x0000, 0x12120111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x12130111 },
+    { 0x1300, 0x0000, 0x0000, 0x12140111 },
+    { 0x1300, 0x0000, 0x0000, 0x12150111 },
+    { 0x1300, 0x0000, 0x0000, 0x12160111 },
+    { 0x1300, 0x0000, 0x0000, 0x12170111 },
+    { 0x1300, 0x0000, 0x0000, 0x12180111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x12190111 },
+    { 0x1300, 0x0000, 0x0000, 0x121a0111 },
+    { 0x1300, 0x0000, 0x0000, 0x121b0111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x121c0111 },
+    { 0x1300, 0x0000, 0x0000, 0x121d0111 },
+    { 0x1300, 0x0000, 0x0000, 0x121e0111 },
+    { 0x1300, 0x0000, 0x0000, 0x121f0111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x12200111 },
+    { 0x1300, 0x0000, 0x0000, 0x12210111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x12220111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x12230111 },
+    { 0x1300, 0x0000, 0x0000, 0x12240111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x12250111 },
+    { 0x1300, 0x0000, 0x0000, 0x12260111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x12270111 },
+    { 0x1300, 0x0000, 0x0000, 0x12280111 },
+    { 0x1300, 0x0000, 0x0000, 0x12290111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x122a0111 },
+    { 0x1300, 0x0000, 0x0000, 0x122b0111 },
+    { 0x1300, 0x0000, 0x0000, 0x122c0111 },
+    { 0x1300, 0x0000, 0x0000, 0x122d0111 },
+    { 0x1300, 0x0000, 0x0000, 0x122e0111 },
+    { 0x1300, 0x0000, 0x0000, 0x122f0111 },
+    { 0x1300, 0x0000, 0x0000, 0x12300111 },
+    { 0x1300, 0x0000, 0x0000, 0x12310111 },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x12320111 },
+    { 0x1300, 0x0000, 0x0000, 0x12330111 },
+    { 0x1300, 0x0000, 0x0000, 0x12340111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0x12350111 },
+    { 0x1200, 0x0000, 0x0000, 0x12360111 },
+    { 0xd200, 0x0000, 0x0000, 0x12370111 },
+    { 0x1200, 0x0000, 0x0000, 0x12380111 },
+    { 0x1200, 0x0000, 0x0000, 0x12390111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0x123a0111 },
+    { 0x1200, 0x0000, 0x0000, 0x123b0111 },
+    { 0x1200, 0x0000, 0x0000, 0x123c0111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0x123d0111 },
+    { 0x1200, 0x0000, 0x0000, 0x123e0111 },
+    { 0x1200, 0x0000, 0x0000, 0x123f0111 },
+    { 0xd200, 0x0000, 0x0000, 0x12400111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0x12410111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0x0a0c0111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a0d0111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a0e0111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a0f0111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a100111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a110111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a120111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a130111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a140111 },
+    { 0x1200, 0x0000, 0x0000, 0x09c30111 },
+    { 0x1200, 0x0000, 0x0000, 0x09c40111 },
+    { 0x1200, 0x0000, 0x0000, 0x09c50111 },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0x5200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    /* block 12 */
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0x0000b711 },
+    { 0x1200, 0x0000, 0x0000, 0x0000b811 },
+    { 0x1200, 0x0000, 0x0000, 0x0000b911 },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x12420111 },
+    { 0x1300, 0x0000, 0x0000, 0x12430111 },
+    { 0x1300, 0x0000, 0x0000, 0x12440111 },
+    { 0x1300, 0x0000, 0x0000, 0x12450111 },
+    { 0x1300, 0x0000, 0x0000, 0x12460111 },
+    { 0x1300, 0x0000, 0x0000, 0x12470111 },
+    { 0x1300, 0x0000, 0x0000, 0x12480111 },
+    { 0x1300, 0x0000, 0x0000, 0x124a0111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x124c0111 },
+    { 0x1300, 0x0000, 0x0000, 0x124d0111 },
+    { 0x1300, 0x0000, 0x0000, 0x124e0111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x124f0111 },
+    { 0x1300, 0x0000, 0x0000, 0x12500111 },
+    { 0x1300, 0x0000, 0x0000, 0x12510111 },
+    { 0x1300, 0x0000, 0x0000, 0x12520111 },
+    { 0x1300, 0x0000, 0x0000, 0x12530111 },
+    { 0x1300, 0x0000, 0x0000, 0x12540111 },
+    { 0x1300, 0x0000, 0x0000, 0x12550111 },
+    { 0x1300, 0x0000, 0x0000, 0x12560111 },
+    { 0x1300, 0x0000, 0x0000, 0x12570111 },
+    { 0x1300, 0x0000, 0x0000, 0x12580111 },
+    { 0x1300, 0x0000, 0x0000, 0x12590111 },
+    { 0x1300, 0x0000, 0x0000, 0x125a0111 },
+    { 0x1300, 0x0000, 0x0000, 0x125b0111 },
+    { 0x1300, 0x0000, 0x0000, 0x125c0111 },
+    { 0x1300, 0x0000, 0x0000, 0x125d0111 },
+    { 0x1300, 0x0000, 0x0000, 0x125e0111 },
+    { 0x1300, 0x0000, 0x0000, 0x125f0111 },
+    { 0x1300, 0x0000, 0x0000, 0x12600111 },
+    { 0x1300, 0x0000, 0x0000, 0x12610111 },
+    { 0x1300, 0x0000, 0x0000, 0x12620111 },
+    { 0x1300, 0x0000, 0x0000, 0x12630111 },
+    { 0x1300, 0x0000, 0x0000, 0x12640111 },
+    { 0x1300, 0x0000, 0x0000, 0x12650111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x12660111 },
+    { 0x1300, 0x0000, 0x0000, 0x12670111 },
+    { 0x1300, 0x0000, 0x0000, 0x12680111 },
+    { 0x1300, 0x0000, 0x0000, 0x12690111 },
+    { 0x1300, 0x0000, 0x0000, 0x126a0111 },
+    { 0x1300, 0x0000, 0x0000, 0x126b0111 },
+    { 0x1300, 0x0000, 0x0000, 0x126c0111 },
+    { 0x1300, 0x0000, 0x0000, 0x126d0111 },
+    { 0x1300, 0x0000, 0x0000, 0x126e0111 },
+    { 0x1300, 0x0000, 0x0000, 0x126f0111 },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x12700111 },
+    { 0x1300, 0x0000, 0x0000, 0x12710111 },
+    { 0x1300, 0x0000, 0x0000, 0x12720111 },
+    { 0x1300, 0x0000, 0x0000, 0x12730111 },
+    { 0x1300, 0x0000, 0x0000, 0x12740111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0x12750111 },
+    { 0xd200, 0x0000, 0x0000, 0x12760111 },
+    { 0xd200, 0x0000, 0x0000, 0x12770111 },
+    { 0x1200, 0x0000, 0x0000, 0x12780111 },
+    { 0x1200, 0x0000, 0x0000, 0x12790111 },
+    { 0x1200, 0x0000, 0x0000, 0x127a0111 },
+    { 0x1200, 0x0000, 0x0000, 0x127b0111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0x127c0111 },
+    { 0xd200, 0x0000, 0x0000, 0x127d0111 },
+    { 0xd200, 0x0000, 0x0000, 0x127e0111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0x127f0111 },
+    { 0xd200, 0x0000, 0x0000, 0x12800111 },
+    { 0xd200, 0x0000, 0x0000, 0x12810111 },
+    { 0xd200, 0x0000, 0x0000, 0x12820111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0x12830111 },
+    { 0xd200, 0x0000, 0x0000, 0x12840111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x12490111 },
+    { 0x1300, 0x0000, 0x0000, 0x124b0111 },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0x0a0b0111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a0c0111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a0d0111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a0e0111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a0f0111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a100111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a110111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a120111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a130111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a140111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0x0000ba11 },
+    { 0x1200, 0x0000, 0x0000, 0x0000bb11 },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x12850111 },
+    { 0x1300, 0x0000, 0x0000, 0x12860111 },
+    { 0x1300, 0x0000, 0x0000, 0x12870111 },
+    { 0x1300, 0x0000, 0x0000, 0x12880111 },
+    { 0x1300, 0x0000, 0x0000, 0x12890111 },
+    { 0x1300, 0x0000, 0x0000, 0x128a0111 },
+    { 0x1300, 0x0000, 0x0000, 0x128b0111 },
+    { 0x1300, 0x0000, 0x0000, 0x128d0111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x128f0111 },
+    { 0x1300, 0x0000, 0x0000, 0x12900111 },
+    { 0x1300, 0x0000, 0x0000, 0x12910111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x12920111 },
+    { 0x1300, 0x0000, 0x0000, 0x12930111 },
+    { 0x1300, 0x0000, 0x0000, 0x12940111 },
+    { 0x1300, 0x0000, 0x0000, 0x12950111 },
+    { 0x1300, 0x0000, 0x0000, 0x12960111 },
+    { 0x1300, 0x0000, 0x0000, 0x12970111 },
+    { 0x1300, 0x0000, 0x0000, 0x12980111 },
+    { 0x1300, 0x0000, 0x0000, 0x12990111 },
+    { 0x1300, 0x0000, 0x0000, 0x129a0111 },
+    { 0x1300, 0x0000, 0x0000, 0x129b0111 },
+    { 0x1300, 0x0000, 0x0000, 0x129c0111 },
+    { 0x1300, 0x0000, 0x0000, 0x129d0111 },
+    { 0x1300, 0x0000, 0x0000, 0x129e0111 },
+    { 0x1300, 0x0000, 0x0000, 0x129f0111 },
+    { 0x1300, 0x0000, 0x0000, 0x12a00111 },
+    { 0x1300, 0x0000, 0x0000, 0x12a10111 },
+    { 0x1300, 0x0000, 0x0000, 0x12a20111 },
+    { 0x1300, 0x0000, 0x0000, 0x12a30111 },
+    { 0x1300, 0x0000, 0x0000, 0x12a40111 },
+    { 0x1300, 0x0000, 0x0000, 0x12a50111 },
+    { 0x1300, 0x0000, 0x0000, 0x12a60111 },
+    { 0x1300, 0x0000, 0x0000, 0x12a70111 },
+    { 0x1300, 0x0000, 0x0000, 0x12a80111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x12a90111 },
+    { 0x1300, 0x0000, 0x0000, 0x12aa0111 },
+    { 0x1300, 0x0000, 0x0000, 0x12ab0111 },
+    { 0x1300, 0x0000, 0x0000, 0x12ac0111 },
+    { 0x1300, 0x0000, 0x0000, 0x12ad0111 },
+    { 0x1300, 0x0000, 0x0000, 0x12ae0111 },
+    { 0x1300, 0x0000, 0x0000, 0x12af0111 },
+    { 0x1300, 0x0000, 0x0000, 0x12b00111 },
+    { 0x1300, 0x0000, 0x0000, 0x12b10111 },
+    { 0x1300, 0x0000, 0x0000, 0x12b70111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x12b20111 },
+    { 0x1300, 0x0000, 0x0000, 0x12b30111 },
+    { 0x1300, 0x0000, 0x0000, 0x12b40111 },
+    { 0x1300, 0x0000, 0x0000, 0x12b50111 },
+    { 0x1300, 0x0000, 0x0000, 0x12b60111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0x12b90111 },
+    { 0x1200, 0x0000, 0x0000, 0x12ba0111 },
+    { 0x1200, 0x0000, 0x0000, 0x12bb0111 },
+    { 0x1200, 0x0000, 0x0000, 0x12bc0111 },
+    { 0x1200, 0x0000, 0x0000, 0x12bd0111 },
+    { 0x1200, 0x0000, 0x0000, 0x12be0111 },
+    { 0x1200, 0x0000, 0x0000, 0x12bf0111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0x12c00111 },
+    { 0x1200, 0x0000, 0x0000, 0x12c10111 },
+    { 0x1200, 0x0000, 0x0000, 0x12c20111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0x12c30111 },
+    { 0x1200, 0x0000, 0x0000, 0x12c40111 },
+    { 0xd200, 0x0000, 0x0000, 0x12c50111 },
+    { 0xd200, 0x0000, 0x0000, 0x12c60111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0x12c70111 },
+    { 0x1200, 0x0000, 0x0000, 0x12c80111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x12b80111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x128c0111 },
+    { 0x1300, 0x0000, 0x0000, 0x128e0111 },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0x0a0b0111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a0c0111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a0d0111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a0e0111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a0f0111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a100111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a110111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a120111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a130111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a140111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    /* block 13 */
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0x0000bc11 },
+    { 0x1200, 0x0000, 0x0000, 0x0000bd11 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x12c90111 },
+    { 0x1300, 0x0000, 0x0000, 0x12ca0111 },
+    { 0x1300, 0x0000, 0x0000, 0x12cb0111 },
+    { 0x1300, 0x0000, 0x0000, 0x12cc0111 },
+    { 0x1300, 0x0000, 0x0000, 0x12cd0111 },
+    { 0x1300, 0x0000, 0x0000, 0x12ce0111 },
+    { 0x1300, 0x0000, 0x0000, 0x12cf0111 },
+    { 0x1300, 0x0000, 0x0000, 0x12d10111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x12d30111 },
+    { 0x1300, 0x0000, 0x0000, 0x12d40111 },
+    { 0x1300, 0x0000, 0x0000, 0x12d50111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x12d60111 },
+    { 0x1300, 0x0000, 0x0000, 0x12d70111 },
+    { 0x1300, 0x0000, 0x0000, 0x12d80111 },
+    { 0x1300, 0x0000, 0x0000, 0x12d90111 },
+    { 0x1300, 0x0000, 0x0000, 0x12da0111 },
+    { 0x1300, 0x0000, 0x0000, 0x12db0111 },
+    { 0x1300, 0x0000, 0x0000, 0x12dc0111 },
+    { 0x1300, 0x0000, 0x0000, 0x12dd0111 },
+    { 0x1300, 0x0000, 0x0000, 0x12de0111 },
+    { 0x1300, 0x0000, 0x0000, 0x12df0111 },
+    { 0x1300, 0x0000, 0x0000, 0x12e00111 },
+    { 0x1300, 0x0000, 0x0000, 0x12e10111 },
+    { 0x1300, 0x0000, 0x0000, 0x12e20111 },
+    { 0x1300, 0x0000, 0x0000, 0x12e30111 },
+    { 0x1300, 0x0000, 0x0000, 0x12e40111 },
+    { 0x1300, 0x0000, 0x0000, 0x12e50111 },
+    { 0x1300, 0x0000, 0x0000, 0x12e60111 },
+    { 0x1300, 0x0000, 0x0000, 0x12e70111 },
+    { 0x1300, 0x0000, 0x0000, 0x12e80111 },
+    { 0x1300, 0x0000, 0x0000, 0x12e90111 },
+    { 0x1300, 0x0000, 0x0000, 0x12ea0111 },
+    { 0x1300, 0x0000, 0x0000, 0x12eb0111 },
+    { 0x1300, 0x0000, 0x0000, 0x12ec0111 },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x12ed0111 },
+    { 0x1300, 0x0000, 0x0000, 0x12ee0111 },
+    { 0x1300, 0x0000, 0x0000, 0x12ef0111 },
+    { 0x1300, 0x0000, 0x0000, 0x12f00111 },
+    { 0x1300, 0x0000, 0x0000, 0x12f10111 },
+    { 0x1300, 0x0000, 0x0000, 0x12f20111 },
+    { 0x1300, 0x0000, 0x0000, 0x12f30111 },
+    { 0x1300, 0x0000, 0x0000, 0x12f40111 },
+    { 0x1300, 0x0000, 0x0000, 0x12f50111 },
+    { 0x1300, 0x0000, 0x0000, 0x12f60111 },
+    { 0x1300, 0x0000, 0x0000, 0x12f70111 },
+    { 0x1300, 0x0000, 0x0000, 0x12f80111 },
+    { 0x1300, 0x0000, 0x0000, 0x12f90111 },
+    { 0x1300, 0x0000, 0x0000, 0x12fa0111 },
+    { 0x1300, 0x0000, 0x0000, 0x12fb0111 },
+    { 0x1300, 0x0000, 0x0000, 0x12fc0111 },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0x12fd0111 },
+    { 0x1200, 0x0000, 0x0000, 0x12fe0111 },
+    { 0x1200, 0x0000, 0x0000, 0x12ff0111 },
+    { 0xd200, 0x0000, 0x0000, 0x13000111 },
+    { 0xd200, 0x0000, 0x0000, 0x13010111 },
+    { 0xd200, 0x0000, 0x0000, 0x13020111 },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0x13030111 },
+    { 0x1200, 0x0000, 0x0000, 0x13040111 },
+    { 0x1200, 0x0000, 0x0000, 0x13050111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0x13060111 },
+    { 0x1200, 0x0000, 0x0000, 0x13070111 },
+    { 0x1200, 0x0000, 0x0000, 0x13080111 },
+    { 0xd200, 0x0000, 0x0000, 0x13090111 },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0x130a0111 },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x12d00111 },
+    { 0x1300, 0x0000, 0x0000, 0x12d20111 },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0x0a0b0111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a0c0111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a0d0111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a0e0111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a0f0111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a100111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a110111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a120111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a130111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a140111 },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0x0000be11 },
+    { 0x1200, 0x0000, 0x0000, 0x0000bf11 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x130b0111 },
+    { 0x1300, 0x0000, 0x0000, 0x130c0111 },
+    { 0x1300, 0x0000, 0x0000, 0x130d0111 },
+    { 0x1300, 0x0000, 0x0000, 0x130e0111 },
+    { 0x1300, 0x0000, 0x0000, 0x130f0111 },
+    { 0x1300, 0x0000, 0x0000, 0x13100111 },
+    { 0x1300, 0x0000, 0x0000, 0x13110111 },
+    { 0x1300, 0x0000, 0x0000, 0x13120111 },
+    { 0x1300, 0x0000, 0x0000, 0x13130111 },
+    { 0x1300, 0x0000, 0x0000, 0x13140111 },
+    { 0x1300, 0x0000, 0x0000, 0x13150111 },
+    { 0x1300, 0x0000, 0x0000, 0x13160111 },
+    { 0x1300, 0x0000, 0x0000, 0x13170111 },
+    { 0x1300, 0x0000, 0x0000, 0x13180111 },
+    { 0x1300, 0x0000, 0x0000, 0x13190111 },
+    { 0x1300, 0x0000, 0x0000, 0x131a0111 },
+    { 0x1300, 0x0000, 0x0000, 0x131b0111 },
+    { 0x1300, 0x0000, 0x0000, 0x131c0111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x131d0111 },
+    { 0x1300, 0x0000, 0x0000, 0x131e0111 },
+    { 0x1300, 0x0000, 0x0000, 0x131f0111 },
+    { 0x1300, 0x0000, 0x0000, 0x13200111 },
+    { 0x1300, 0x0000, 0x0000, 0x13210111 },
+    { 0x1300, 0x0000, 0x0000, 0x13220111 },
+    { 0x1300, 0x0000, 0x0000, 0x13230111 },
+    { 0x1300, 0x0000, 0x0000, 0x13240111 },
+    { 0x1300, 0x0000, 0x0000, 0x13250111 },
+    { 0x1300, 0x0000, 0x0000, 0x13260111 },
+    { 0x1300, 0x0000, 0x0000, 0x13270111 },
+    { 0x1300, 0x0000, 0x0000, 0x13280111 },
+    { 0x1300, 0x0000, 0x0000, 0x13290111 },
+    { 0x1300, 0x0000, 0x0000, 0x132a0111 },
+    { 0x1300, 0x0000, 0x0000, 0x132b0111 },
+    { 0x1300, 0x0000, 0x0000, 0x132c0111 },
+    { 0x1300, 0x0000, 0x0000, 0x132d0111 },
+    { 0x1300, 0x0000, 0x0000, 0x132e0111 },
+    { 0x1300, 0x0000, 0x0000, 0x132f0111 },
+    { 0x1300, 0x0000, 0x0000, 0x13300111 },
+    { 0x1300, 0x0000, 0x0000, 0x13310111 },
+    { 0x1300, 0x0000, 0x0000, 0x13320111 },
+    { 0x1300, 0x0000, 0x0000, 0x13330111 },
+    { 0x1300, 0x0000, 0x0000, 0x13340111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x13350111 },
+    { 0x1300, 0x0000, 0x0000, 0x13360111 },
+    { 0x1300, 0x0000, 0x0000, 0x13370111 },
+    { 0x1300, 0x0000, 0x0000, 0x13380111 },
+    { 0x1300, 0x0000, 0x0000, 0x13390111 },
+    { 0x1300, 0x0000, 0x0000, 0x133a0111 },
+    { 0x1300, 0x0000, 0x0000, 0x133b0111 },
+    { 0x1300, 0x0000, 0x0000, 0x133c0111 },
+    { 0x1300, 0x0000, 0x0000, 0x133d0111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x133e0111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x133f0111 },
+    { 0x1300, 0x0000, 0x0000, 0x13400111 },
+    { 0x1300, 0x0000, 0x0000, 0x13410111 },
+    { 0x1300, 0x0000, 0x0000, 0x13420111 },
+    { 0x1300, 0x0000, 0x0000, 0x13430111 },
+    { 0x1300, 0x0000, 0x0000, 0x13440111 },
+    { 0x1300, 0x0000, 0x0000, 0x13450111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0x13460111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0x13470111 },
+    { 0x1200, 0x0000, 0x0000, 0x13480111 },
+    { 0x1200, 0x0000, 0x0000, 0x13490111 },
+    { 0xd200, 0x0000, 0x0000, 0x134a0111 },
+    { 0xd200, 0x0000, 0x0000, 0x134b0111 },
+    { 0xd200, 0x0000, 0x0000, 0x134c0111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0x134d0111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0x134e0111 },
+    { 0x1200, 0x0000, 0x0000, 0x134f0111 },
+    { 0x1200, 0x0000, 0x0000, 0x13500111 },
+    { 0x1200, 0x0000, 0x0000, 0x13510111 },
+    { 0x1200, 0x0000, 0x0000, 0x13520111 },
+    { 0x1200, 0x0000, 0x0000, 0x13530111 },
+    { 0x1200, 0x0000, 0x0000, 0x13540111 },
+    { 0x1200, 0x0000, 0x0000, 0x13550111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0x13560111 },
+    { 0x1200, 0x0000, 0x0000, 0x13570111 },
+    { 0x1210, 0x0000, 0x0000, 0x02ce0111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    /* block 14 */
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x13580111 },
+    { 0x1300, 0x0000, 0x0000, 0x13590111 },
+    { 0x1300, 0x0000, 0x0000, 0x135a0111 },
+    { 0x1300, 0x0000, 0x0000, 0x135b0111 },
+    { 0x1300, 0x0000, 0x0000, 0x135c0111 },
+    { 0x1300, 0x0000, 0x0000, 0x135d0111 },
+    { 0x1300, 0x0000, 0x0000, 0x135e0111 },
+    { 0x1300, 0x0000, 0x0000, 0x135f0111 },
+    { 0x1300, 0x0000, 0x0000, 0x13600111 },
+    { 0x1300, 0x0000, 0x0000, 0x13610111 },
+    { 0x1300, 0x0000, 0x0000, 0x13620111 },
+    { 0x1300, 0x0000, 0x0000, 0x13630111 },
+    { 0x1300, 0x0000, 0x0000, 0x13640111 },
+    { 0x1300, 0x0000, 0x0000, 0x13650111 },
+    { 0x1300, 0x0000, 0x0000, 0x13660111 },
+    { 0x1300, 0x0000, 0x0000, 0x13670111 },
+    { 0x1300, 0x0000, 0x0000, 0x13680111 },
+    { 0x1300, 0x0000, 0x0000, 0x13690111 },
+    { 0x1300, 0x0000, 0x0000, 0x136a0111 },
+    { 0x1300, 0x0000, 0x0000, 0x136b0111 },
+    { 0x1300, 0x0000, 0x0000, 0x136c0111 },
+    { 0x1300, 0x0000, 0x0000, 0x136d0111 },
+    { 0x1300, 0x0000, 0x0000, 0x136e0111 },
+    { 0x1300, 0x0000, 0x0000, 0x136f0111 },
+    { 0x1300, 0x0000, 0x0000, 0x13700111 },
+    { 0x1300, 0x0000, 0x0000, 0x13710111 },
+    { 0x1300, 0x0000, 0x0000, 0x13720111 },
+    { 0x1300, 0x0000, 0x0000, 0x13730111 },
+    { 0x1300, 0x0000, 0x0000, 0x13740111 },
+    { 0x1300, 0x0000, 0x0000, 0x13750111 },
+    { 0x1300, 0x0000, 0x0000, 0x13760111 },
+    { 0x1300, 0x0000, 0x0000, 0x13770111 },
+    { 0x1300, 0x0000, 0x0000, 0x13780111 },
+    { 0x1300, 0x0000, 0x0000, 0x13790111 },
+    { 0x1300, 0x0000, 0x0000, 0x137a0111 },
+    { 0x1300, 0x0000, 0x0000, 0x137b0111 },
+    { 0x1300, 0x0000, 0x0000, 0x137c0111 },
+    { 0x1300, 0x0000, 0x0000, 0x137d0111 },
+    { 0x1300, 0x0000, 0x0000, 0x137e0111 },
+    { 0x1300, 0x0000, 0x0000, 0x137f0111 },
+    { 0x1300, 0x0000, 0x0000, 0x13800111 },
+    { 0x1300, 0x0000, 0x0000, 0x13810111 },
+    { 0x1300, 0x0000, 0x0000, 0x13820111 },
+    { 0x1300, 0x0000, 0x0000, 0x13830111 },
+    { 0x1300, 0x0000, 0x0000, 0x13840111 },
+    { 0x1300, 0x0000, 0x0000, 0x13850111 },
+    { 0x1300, 0x0000, 0x0000, 0x13860111 },
+    { 0x1300, 0x0000, 0x0000, 0x13870111 },
+    { 0xd200, 0x0000, 0x0000, 0x13880111 },
+    { 0x1300, 0x0000, 0x0000, 0x13890111 },
+    { 0x1300, 0x0000, 0x0000, 0x138a0111 },
+    { 0xd200, 0x0000, 0x0000, 0x138b0111 },
+    { 0xd200, 0x0000, 0x0000, 0x138c0111 },
+    { 0xd200, 0x0000, 0x0000, 0x138d0111 },
+    { 0xd200, 0x0000, 0x0000, 0x138e0111 },
+    { 0xd200, 0x0000, 0x0000, 0x138f0111 },
+    { 0xd200, 0x0000, 0x0000, 0x13900111 },
+    { 0xd200, 0x0000, 0x0000, 0x13910111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x5200, 0x0000, 0x0000, 0x09e50111 },
+    { 0x1300, 0x0000, 0x0000, 0x13920111 },
+    { 0x1300, 0x0000, 0x0000, 0x13930111 },
+    { 0x1300, 0x0000, 0x0000, 0x13940111 },
+    { 0x1300, 0x0000, 0x0000, 0x13950111 },
+    { 0x1300, 0x0000, 0x0000, 0x13960111 },
+    { 0x1300, 0x0000, 0x0000, 0x13970111 },
+    { 0x1300, 0x0000, 0x0000, 0x09d50111 },
+    { 0xd200, 0x0000, 0x0000, 0x0000c011 },
+    { 0xd200, 0x0000, 0x0000, 0x0000c111 },
+    { 0xd200, 0x0000, 0x0000, 0x0000c211 },
+    { 0xd200, 0x0000, 0x0000, 0x0000c311 },
+    { 0xd200, 0x0000, 0x0000, 0x0000c411 },
+    { 0xd200, 0x0000, 0x0000, 0x13980111 },
+    { 0xd200, 0x0000, 0x0000, 0x13990111 },
+    { 0xd200, 0x0000, 0x0000, 0x00000001 },
+    { 0x1210, 0x0000, 0x0000, 0x030f0111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a0b0111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a0c0111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a0d0111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a0e0111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a0f0111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a100111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a110111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a120111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a130111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a140111 },
+    { 0x1210, 0x0000, 0x0000, 0x02cf0111 },
+    { 0x1210, 0x0000, 0x0000, 0x02d00111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x139a0111 },
+    { 0x1300, 0x0000, 0x0000, 0x139b0111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x139c0111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x139d0111 },
+    { 0x1300, 0x0000, 0x0000, 0x139e0111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x139f0111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x13a00111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x13a10111 },
+    { 0x1300, 0x0000, 0x0000, 0x13a20111 },
+    { 0x1300, 0x0000, 0x0000, 0x13a30111 },
+    { 0x1300, 0x0000, 0x0000, 0x13a40111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x13a50111 },
+    { 0x1300, 0x0000, 0x0000, 0x13a60111 },
+    { 0x1300, 0x0000, 0x0000, 0x13a70111 },
+    { 0x1300, 0x0000, 0x0000, 0x13a80111 },
+    { 0x1300, 0x0000, 0x0000, 0x13a90111 },
+    { 0x1300, 0x0000, 0x0000, 0x13aa0111 },
+    { 0x1300, 0x0000, 0x0000, 0x13ab0111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x13ac0111 },
+    { 0x1300, 0x0000, 0x0000, 0x13ad0111 },
+    { 0x1300, 0x0000, 0x0000, 0x13ae0111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x13af0111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x13b00111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x13b10111 },
+    { 0x1300, 0x0000, 0x0000, 0x13b20111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x13b30111 },
+    { 0x1300, 0x0000, 0x0000, 0x13b40111 },
+    { 0x1300, 0x0000, 0x0000, 0x13b50111 },
+    { 0x1300, 0x0000, 0x0000, 0x13b60111 },
+    { 0xd200, 0x0000, 0x0000, 0x13b70111 },
+    { 0x1300, 0x0000, 0x0000, 0x13b80111 },
+    { 0x1300, 0x0000, 0x0000, 0x13b90111 },
+    { 0xd200, 0x0000, 0x0000, 0x13ba0111 },
+    { 0xd200, 0x0000, 0x0000, 0x13bb0111 },
+    { 0xd200, 0x0000, 0x0000, 0x13bc0111 },
+    { 0xd200, 0x0000, 0x0000, 0x13bd0111 },
+    { 0xd200, 0x0000, 0x0000, 0x13be0111 },
+    { 0xd200, 0x0000, 0x0000, 0x13bf0111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0x13c00111 },
+    { 0xd200, 0x0000, 0x0000, 0x13c10111 },
+    { 0x1300, 0x0000, 0x0000, 0x13c20111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x13c30111 },
+    { 0x1300, 0x0000, 0x0000, 0x13c40111 },
+    { 0x1300, 0x0000, 0x0000, 0x13c50111 },
+    { 0x1300, 0x0000, 0x0000, 0x13c60111 },
+    { 0x1300, 0x0000, 0x0000, 0x13c70111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x09d60111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0x0000c511 },
+    { 0xd200, 0x0000, 0x0000, 0x0000c611 },
+    { 0xd200, 0x0000, 0x0000, 0x0000c711 },
+    { 0xd200, 0x0000, 0x0000, 0x0000c811 },
+    { 0xd200, 0x0000, 0x0000, 0x13c80111 },
+    { 0xd200, 0x0000, 0x0000, 0x13c90111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0x0a0b0111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a0c0111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a0d0111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a0e0111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a0f0111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a100111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a110111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a120111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a130111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a140111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x13b20121 },
+    { 0x1300, 0x0000, 0x0000, 0x13b20121 },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    /* block 15 */
+    { 0x1300, 0x0000, 0x0000, 0x140e0121 },
+    { 0x1200, 0x0000, 0x0000, 0x03100111 },
+    { 0x1200, 0x0000, 0x0000, 0x03110111 },
+    { 0x1200, 0x0000, 0x0000, 0x03120111 },
+    { 0x1210, 0x0000, 0x0000, 0x02d10111 },
+    { 0x1210, 0x0000, 0x0000, 0x02d20111 },
+    { 0x1210, 0x0000, 0x0000, 0x02d30111 },
+    { 0x1210, 0x0000, 0x0000, 0x02d40111 },
+    { 0x1210, 0x0000, 0x0000, 0x02d50111 },
+    { 0x1210, 0x0000, 0x0000, 0x02d60111 },
+    { 0x1210, 0x0000, 0x0000, 0x02d70111 },
+    { 0x1210, 0x0000, 0x0000, 0x02d80111 },
+    { 0x1210, 0x0000, 0x0000, 0x02d80121 },
+    { 0x1210, 0x0000, 0x0000, 0x02d90111 },
+    { 0x1210, 0x0000, 0x0000, 0x02da0111 },
+    { 0x1210, 0x0000, 0x0000, 0x02db0111 },
+    { 0x1210, 0x0000, 0x0000, 0x02dc0111 },
+    { 0x1210, 0x0000, 0x0000, 0x02dd0111 },
+    { 0x1210, 0x0000, 0x0000, 0x02de0111 },
+    { 0x1200, 0x0000, 0x0000, 0x03130111 },
+    { 0x1210, 0x0000, 0x0000, 0x02460111 },
+    { 0x1200, 0x0000, 0x0000, 0x03140111 },
+    { 0x1200, 0x0000, 0x0000, 0x03150111 },
+    { 0x1200, 0x0000, 0x0000, 0x03160111 },
+    { 0xd200, 0x0000, 0x0000, 0x00000001 },
+    { 0xd200, 0x0000, 0x0000, 0x00000001 },
+    { 0x1200, 0x0000, 0x0000, 0x03170111 },
+    { 0x1200, 0x0000, 0x0000, 0x03180111 },
+    { 0x1200, 0x0000, 0x0000, 0x03190111 },
+    { 0x1200, 0x0000, 0x0000, 0x031a0111 },
+    { 0x1200, 0x0000, 0x0000, 0x031b0111 },
+    { 0x1200, 0x0000, 0x0000, 0x031c0111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a0b0111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a0c0111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a0d0111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a0e0111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a0f0111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a100111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a110111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a120111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a130111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a140111 },
+    { 0x1200, 0x0000, 0x0000, 0x0a0c0111 },
+    { 0x1200, 0x0000, 0x0000, 0x0a0d0111 },
+    { 0x1200, 0x0000, 0x0000, 0x0a0e0111 },
+    { 0x1200, 0x0000, 0x0000, 0x0a0f0111 },
+    { 0x1200, 0x0000, 0x0000, 0x0a100111 },
+    { 0x1200, 0x0000, 0x0000, 0x0a110111 },
+    { 0x1200, 0x0000, 0x0000, 0x0a120111 },
+    { 0x1200, 0x0000, 0x0000, 0x0a130111 },
+    { 0x1200, 0x0000, 0x0000, 0x0a140111 },
+    { 0x1200, 0x0000, 0x0000, 0x0a0b0111 },
+    { 0x1200, 0x0000, 0x0000, 0x031d0111 },
+    { 0xd200, 0x0000, 0x0000, 0x00000001 },
+    { 0x1200, 0x0000, 0x0000, 0x031e0111 },
+    { 0xd200, 0x0000, 0x0000, 0x00000001 },
+    { 0x1200, 0x0000, 0x0000, 0x031f0111 },
+    { 0xd200, 0x0000, 0x0000, 0x0000c911 },
+    { 0xb210, 0x0000, 0x0000, 0x02800111 },
+    { 0xb210, 0x0000, 0x0000, 0x02810111 },
+    { 0xb210, 0x0000, 0x0000, 0x02820111 },
+    { 0xb210, 0x0000, 0x0000, 0x02830111 },
+    { 0x1200, 0x0000, 0x0000, 0x03200111 },
+    { 0x1200, 0x0000, 0x0000, 0x03210111 },
+    { 0x1300, 0x0000, 0x0000, 0x13ca0111 },
+    { 0x1300, 0x0000, 0x0000, 0x13cc0111 },
+    { 0x1300, 0x0000, 0x0000, 0x13ce0111 },
+    { 0x1300, 0x0000, 0x0000, 0x13ce0111 },
+    { 0x1300, 0x0000, 0x0000, 0x13d00111 },
+    { 0x1300, 0x0000, 0x0000, 0x13d20111 },
+    { 0x1300, 0x0000, 0x0000, 0x13d40111 },
+    { 0x1300, 0x0000, 0x0000, 0x13d60111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x13d80111 },
+    { 0x1300, 0x0000, 0x0000, 0x13da0111 },
+    { 0x1300, 0x0000, 0x0000, 0x13dc0111 },
+    { 0x1300, 0x0000, 0x0000, 0x13de0111 },
+    { 0x1300, 0x0000, 0x0000, 0x13de0111 },
+    { 0x1300, 0x0000, 0x0000, 0x13e00111 },
+    { 0x1300, 0x0000, 0x0000, 0x13e20111 },
+    { 0x1300, 0x0000, 0x0000, 0x13e40111 },
+    { 0x1300, 0x0000, 0x0000, 0x13e60111 },
+    { 0x1300, 0x0000, 0x0000, 0x13e60111 },
+    { 0x1300, 0x0000, 0x0000, 0x13e80111 },
+    { 0x1300, 0x0000, 0x0000, 0x13ea0111 },
+    { 0x1300, 0x0000, 0x0000, 0x13ec0111 },
+    { 0x1300, 0x0000, 0x0000, 0x13ee0111 },
+    { 0x1300, 0x0000, 0x0000, 0x13ee0111 },
+    { 0x1300, 0x0000, 0x0000, 0x13f00111 },
+    { 0x1300, 0x0000, 0x0000, 0x13f20111 },
+    { 0x1300, 0x0000, 0x0000, 0x13f40111 },
+    { 0x1300, 0x0000, 0x0000, 0x13f60111 },
+    { 0x1300, 0x0000, 0x0000, 0x13f60111 },
+    { 0x1300, 0x0000, 0x0000, 0x13f80111 },
+    { 0x1300, 0x0000, 0x0000, 0x13fa0111 },
+    { 0x1300, 0x0000, 0x0000, 0x13fc0111 },
+    { 0x1300, 0x0000, 0x0000, 0x13fe0111 },
+    { 0x1300, 0x0000, 0x0000, 0x14000111 },
+    { 0x1300, 0x0000, 0x0000, 0x14020111 },
+    { 0x1300, 0x0000, 0x0000, 0x14040111 },
+    { 0x1300, 0x0000, 0x0000, 0x14060111 },
+    { 0x1300, 0x0000, 0x0000, 0x14080111 },
+    { 0x1300, 0x0000, 0x0000, 0x140a0111 },
+    { 0x1300, 0x0000, 0x0000, 0x140c0111 },
+    { 0x1300, 0x0000, 0x0000, 0x140e0111 },
+    { 0x1300, 0x0000, 0x0000, 0x13ca0111 },
+    { 0x1300, 0x0000, 0x0000, 0x14020121 },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0x14140111 },
+    { 0xd200, 0x0000, 0x0000, 0x14150111 },
+    { 0xd200, 0x0000, 0x0000, 0x14160111 },
+    { 0xd200, 0x0000, 0x0000, 0x14190111 },
+    { 0xd200, 0x0000, 0x0000, 0x141a0111 },
+    { 0xd200, 0x0000, 0x0000, 0x141b0111 },
+    { 0xd200, 0x0000, 0x0000, 0x141c0111 },
+    { 0xd200, 0x0000, 0x0000, 0x141d0111 },
+    { 0xd200, 0x0000, 0x0000, 0x141e0111 },
+    { 0xd200, 0x0000, 0x0000, 0x141f0111 },
+    { 0xd200, 0x0000, 0x0000, 0x14200111 },
+    { 0xd200, 0x0000, 0x0000, 0x14210111 },
+    { 0xd200, 0x0000, 0x0000, 0x14220111 },
+    { 0xd200, 0x0000, 0x0000, 0x0000ca11 },
+    { 0x1200, 0x0000, 0x0000, 0x0000cb11 },
+    { 0xd200, 0x0000, 0x0000, 0x14170111 },
+    { 0xd200, 0x0000, 0x0000, 0x14180111 },
+    { 0xd200, 0x0000, 0x0000, 0x00000001 },
+    { 0xd200, 0x0000, 0x0000, 0x00000001 },
+    { 0xd200, 0x0000, 0x0000, 0x14230111 },
+    { 0x1210, 0x0000, 0x0000, 0x02df0111 },
+    { 0xd200, 0x0000, 0x0000, 0x00000001 },
+    { 0xd200, 0x0000, 0x0000, 0x00000001 },
+    { 0x1300, 0x0000, 0x0000, 0x14100111 },
+    { 0x1300, 0x0000, 0x0000, 0x14110111 },
+    { 0x1300, 0x0000, 0x0000, 0x14120111 },
+    { 0x1300, 0x0000, 0x0000, 0x14130111 },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0x13cb0111 },
+    { 0xd200, 0x0000, 0x0000, 0x13cd0111 },
+    { 0xd200, 0x0000, 0x0000, 0x13cf0111 },
+    { 0xd200, 0x0000, 0x0000, 0x13cf0111 },
+    { 0xd200, 0x0000, 0x0000, 0x13d10111 },
+    { 0xd200, 0x0000, 0x0000, 0x13d30111 },
+    { 0xd200, 0x0000, 0x0000, 0x13d50111 },
+    { 0xd200, 0x0000, 0x0000, 0x13d70111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0x13d90111 },
+    { 0xd200, 0x0000, 0x0000, 0x13db0111 },
+    { 0xd200, 0x0000, 0x0000, 0x13dd0111 },
+    { 0xd200, 0x0000, 0x0000, 0x13df0111 },
+    { 0xd200, 0x0000, 0x0000, 0x13df0111 },
+    { 0xd200, 0x0000, 0x0000, 0x13e10111 },
+    { 0xd200, 0x0000, 0x0000, 0x13e30111 },
+    { 0xd200, 0x0000, 0x0000, 0x13e50111 },
+    { 0xd200, 0x0000, 0x0000, 0x13e70111 },
+    { 0xd200, 0x0000, 0x0000, 0x13e70111 },
+    { 0xd200, 0x0000, 0x0000, 0x13e90111 },
+    { 0xd200, 0x0000, 0x0000, 0x13eb0111 },
+    { 0xd200, 0x0000, 0x0000, 0x13ed0111 },
+    { 0xd200, 0x0000, 0x0000, 0x13ef0111 },
+    { 0xd200, 0x0000, 0x0000, 0x13ef0111 },
+    { 0xd200, 0x0000, 0x0000, 0x13f10111 },
+    { 0xd200, 0x0000, 0x0000, 0x13f30111 },
+    { 0xd200, 0x0000, 0x0000, 0x13f50111 },
+    { 0xd200, 0x0000, 0x0000, 0x13f70111 },
+    { 0xd200, 0x0000, 0x0000, 0x13f70111 },
+    { 0xd200, 0x0000, 0x0000, 0x13f90111 },
+    { 0xd200, 0x0000, 0x0000, 0x13fb0111 },
+    { 0xd200, 0x0000, 0x0000, 0x13fd0111 },
+    { 0xd200, 0x0000, 0x0000, 0x13ff0111 },
+    { 0xd200, 0x0000, 0x0000, 0x14010111 },
+    { 0xd200, 0x0000, 0x0000, 0x14030111 },
+    { 0xd200, 0x0000, 0x0000, 0x14050111 },
+    { 0xd200, 0x0000, 0x0000, 0x14070111 },
+    { 0xd200, 0x0000, 0x0000, 0x14090111 },
+    { 0xd200, 0x0000, 0x0000, 0x140b0111 },
+    { 0xd200, 0x0000, 0x0000, 0x140d0111 },
+    { 0xd200, 0x0000, 0x0000, 0x140f0111 },
+    { 0xd200, 0x0000, 0x0000, 0x13cb0111 },
+    { 0xd200, 0x0000, 0x0000, 0x13f90121 },
+    { 0xd200, 0x0000, 0x0000, 0x14010121 },
+    { 0xd200, 0x0000, 0x0000, 0x14030121 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0x03220111 },
+    { 0x1200, 0x0000, 0x0000, 0x03230111 },
+    { 0x1200, 0x0000, 0x0000, 0x03240111 },
+    { 0x1200, 0x0000, 0x0000, 0x03250111 },
+    { 0x1200, 0x0000, 0x0000, 0x03260111 },
+    { 0x1200, 0x0000, 0x0000, 0x03270111 },
+    { 0x1200, 0x0000, 0x0000, 0x03280111 },
+    { 0x1200, 0x0000, 0x0000, 0x03290111 },
+    { 0xd200, 0x0000, 0x0000, 0x00000001 },
+    { 0x1200, 0x0000, 0x0000, 0x032a0111 },
+    { 0x1200, 0x0000, 0x0000, 0x032b0111 },
+    { 0x1200, 0x0000, 0x0000, 0x032c0111 },
+    { 0x1200, 0x0000, 0x0000, 0x032d0111 },
+    { 0x1200, 0x0000, 0x0000, 0x032e0111 },
+    { 0x1200, 0x0000, 0x0000, 0x032f0111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0x03300111 },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    /* block 16 */
+    { 0x1300, 0x0000, 0x0000, 0x14240111 },
+    { 0x1300, 0x0000, 0x0000, 0x14250111 },
+    { 0x1300, 0x0000, 0x0000, 0x14260111 },
+    { 0x1300, 0x0000, 0x0000, 0x14270111 },
+    { 0x1300, 0x0000, 0x0000, 0x14280111 },
+    { 0x1300, 0x0000, 0x0000, 0x14290111 },
+    { 0x1300, 0x0000, 0x0000, 0x142a0111 },
+    { 0x1300, 0x0000, 0x0000, 0x142b0111 },
+    { 0x1300, 0x0000, 0x0000, 0x142c0111 },
+    { 0x1300, 0x0000, 0x0000, 0x142d0111 },
+    { 0x1300, 0x0000, 0x0000, 0x142e0111 },
+    { 0x1300, 0x0000, 0x0000, 0x142f0111 },
+    { 0x1300, 0x0000, 0x0000, 0x14300111 },
+    { 0x1300, 0x0000, 0x0000, 0x14310111 },
+    { 0x1300, 0x0000, 0x0000, 0x14320111 },
+    { 0x1300, 0x0000, 0x0000, 0x14330111 },
+    { 0x1300, 0x0000, 0x0000, 0x14340111 },
+    { 0x1300, 0x0000, 0x0000, 0x14350111 },
+    { 0x1300, 0x0000, 0x0000, 0x14360111 },
+    { 0x1300, 0x0000, 0x0000, 0x14370111 },
+    { 0x1300, 0x0000, 0x0000, 0x14380111 },
+    { 0x1300, 0x0000, 0x0000, 0x14390111 },
+    { 0x1300, 0x0000, 0x0000, 0x143a0111 },
+    { 0x1300, 0x0000, 0x0000, 0x143b0111 },
+    { 0x1300, 0x0000, 0x0000, 0x143c0111 },
+    { 0x1300, 0x0000, 0x0000, 0x143d0111 },
+    { 0x1300, 0x0000, 0x0000, 0x143e0111 },
+    { 0x1300, 0x0000, 0x0000, 0x143f0111 },
+    { 0x1300, 0x0000, 0x0000, 0x14400111 },
+    { 0x1300, 0x0000, 0x0000, 0x14410111 },
+    { 0x1300, 0x0000, 0x0000, 0x14440111 },
+    { 0x1300, 0x0000, 0x0000, 0x14450111 },
+    { 0x1300, 0x0000, 0x0000, 0x14460111 },
+    { 0x1300, 0x0000, 0x0000, 0x14470111 },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x14480111 },
+    { 0x1300, 0x0000, 0x0000, 0x14490111 },
+    { 0x1300, 0x0000, 0x0000, 0x144a0111 },
+    { 0x1300, 0x0000, 0x0000, 0x144b0111 },
+    { 0x1300, 0x0000, 0x0000, 0x144c0111 },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x144d0111 },
+    { 0x1300, 0x0000, 0x0000, 0x144e0111 },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0x14530111 },
+    { 0xd200, 0x0000, 0x0000, 0x14540111 },
+    { 0xd200, 0x0000, 0x0000, 0x14550111 },
+    { 0xd200, 0x0000, 0x0000, 0x14560111 },
+    { 0xd200, 0x0000, 0x0000, 0x14570111 },
+    { 0x1200, 0x0000, 0x0000, 0x14580111 },
+    { 0xd200, 0x0000, 0x0000, 0x14590111 },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0x0000cc11 },
+    { 0xd200, 0x0000, 0x0000, 0x0000cd11 },
+    { 0x1200, 0x0000, 0x0000, 0x0000ce11 },
+    { 0xd200, 0x0000, 0x0000, 0x145e0111 },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0x0a0b0111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a0c0111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a0d0111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a0e0111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a0f0111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a100111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a110111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a120111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a130111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a140111 },
+    { 0x1210, 0x0000, 0x0000, 0x02620111 },
+    { 0x1210, 0x0000, 0x0000, 0x02630111 },
+    { 0x1210, 0x0000, 0x0000, 0x02e00111 },
+    { 0x1210, 0x0000, 0x0000, 0x02e10111 },
+    { 0x1210, 0x0000, 0x0000, 0x02e20111 },
+    { 0x1210, 0x0000, 0x0000, 0x02e30111 },
+    { 0x1300, 0x0000, 0x0000, 0x14420111 },
+    { 0x1300, 0x0000, 0x0000, 0x14430111 },
+    { 0x1300, 0x0000, 0x0000, 0x144f0111 },
+    { 0x1300, 0x0000, 0x0000, 0x14500111 },
+    { 0x1300, 0x0000, 0x0000, 0x14510111 },
+    { 0x1300, 0x0000, 0x0000, 0x14520111 },
+    { 0x1200, 0x0000, 0x0000, 0x145a0111 },
+    { 0x1200, 0x0000, 0x0000, 0x145b0111 },
+    { 0xd200, 0x0000, 0x0000, 0x145c0111 },
+    { 0xd200, 0x0000, 0x0000, 0x145d0111 },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1301, 0x1c60, 0x0000, 0x0e690121 },
+    { 0x1301, 0x1c60, 0x0000, 0x0e6a0121 },
+    { 0x1301, 0x1c60, 0x0000, 0x0e6b0121 },
+    { 0x1301, 0x1c60, 0x0000, 0x0e6c0121 },
+    { 0x1301, 0x1c60, 0x0000, 0x0e6d0121 },
+    { 0x1301, 0x1c60, 0x0000, 0x0e6e0121 },
+    { 0x1301, 0x1c60, 0x0000, 0x0e6f0121 },
+    { 0x1301, 0x1c60, 0x0000, 0x0e710121 },
+    { 0x1301, 0x1c60, 0x0000, 0x0e720121 },
+    { 0x1301, 0x1c60, 0x0000, 0x0e730121 },
+    { 0x1301, 0x1c60, 0x0000, 0x0e740121 },
+    { 0x1301, 0x1c60, 0x0000, 0x0e750121 },
+    { 0x1301, 0x1c60, 0x0000, 0x0e760121 },
+    { 0x1301, 0x1c60, 0x0000, 0x0e780121 },
+    { 0x1301, 0x1c60, 0x0000, 0x0e790121 },
+    { 0x1301, 0x1c60, 0x0000, 0x0e7a0121 },
+    { 0x1301, 0x1c60, 0x0000, 0x0e7b0121 },
+    { 0x1301, 0x1c60, 0x0000, 0x0e7c0121 },
+    { 0x1301, 0x1c60, 0x0000, 0x0e7d0121 },
+    { 0x1301, 0x1c60, 0x0000, 0x0e7f0121 },
+    { 0x1301, 0x1c60, 0x0000, 0x0e800121 },
+    { 0x1301, 0x1c60, 0x0000, 0x0e810121 },
+    { 0x1301, 0x1c60, 0x0000, 0x0e820121 },
+    { 0x1301, 0x1c60, 0x0000, 0x0e830121 },
+    { 0x1301, 0x1c60, 0x0000, 0x0e840121 },
+    { 0x1301, 0x1c60, 0x0000, 0x0e850121 },
+    { 0x1301, 0x1c60, 0x0000, 0x0e860121 },
+    { 0x1301, 0x1c60, 0x0000, 0x0e870121 },
+    { 0x1301, 0x1c60, 0x0000, 0x0e880121 },
+    { 0x1301, 0x1c60, 0x0000, 0x0e890121 },
+    { 0x1301, 0x1c60, 0x0000, 0x0e8a0121 },
+    { 0x1301, 0x1c60, 0x0000, 0x0e8c0121 },
+    { 0x1301, 0x1c60, 0x0000, 0x0e8d0121 },
+    { 0x1301, 0x1c60, 0x0000, 0x0e700121 },
+    { 0x1301, 0x1c60, 0x0000, 0x0e770121 },
+    { 0x1301, 0x1c60, 0x0000, 0x0e7e0121 },
+    { 0x1301, 0x1c60, 0x0000, 0x0e8b0121 },
+    { 0x1301, 0x1c60, 0x0000, 0x0e8e0121 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1301, 0x1c60, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1301, 0x1c60, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0bc0, 0x0e690111 },
+    { 0x1302, 0x0000, 0x0bc0, 0x0e6a0111 },
+    { 0x1302, 0x0000, 0x0bc0, 0x0e6b0111 },
+    { 0x1302, 0x0000, 0x0bc0, 0x0e6c0111 },
+    { 0x1302, 0x0000, 0x0bc0, 0x0e6d0111 },
+    { 0x1302, 0x0000, 0x0bc0, 0x0e6e0111 },
+    { 0x1302, 0x0000, 0x0bc0, 0x0e6f0111 },
+    { 0x1302, 0x0000, 0x0bc0, 0x0e710111 },
+    { 0x1302, 0x0000, 0x0bc0, 0x0e720111 },
+    { 0x1302, 0x0000, 0x0bc0, 0x0e730111 },
+    { 0x1302, 0x0000, 0x0bc0, 0x0e740111 },
+    { 0x1302, 0x0000, 0x0bc0, 0x0e750111 },
+    { 0x1302, 0x0000, 0x0bc0, 0x0e760111 },
+    { 0x1302, 0x0000, 0x0bc0, 0x0e780111 },
+    { 0x1302, 0x0000, 0x0bc0, 0x0e790111 },
+    { 0x1302, 0x0000, 0x0bc0, 0x0e7a0111 },
+    { 0x1302, 0x0000, 0x0bc0, 0x0e7b0111 },
+    { 0x1302, 0x0000, 0x0bc0, 0x0e7c0111 },
+    { 0x1302, 0x0000, 0x0bc0, 0x0e7d0111 },
+    { 0x1302, 0x0000, 0x0bc0, 0x0e7f0111 },
+    { 0x1302, 0x0000, 0x0bc0, 0x0e800111 },
+    { 0x1302, 0x0000, 0x0bc0, 0x0e810111 },
+    { 0x1302, 0x0000, 0x0bc0, 0x0e820111 },
+    { 0x1302, 0x0000, 0x0bc0, 0x0e830111 },
+    { 0x1302, 0x0000, 0x0bc0, 0x0e840111 },
+    { 0x1302, 0x0000, 0x0bc0, 0x0e850111 },
+    { 0x1302, 0x0000, 0x0bc0, 0x0e860111 },
+    { 0x1302, 0x0000, 0x0bc0, 0x0e870111 },
+    { 0x1302, 0x0000, 0x0bc0, 0x0e880111 },
+    { 0x1302, 0x0000, 0x0bc0, 0x0e890111 },
+    { 0x1302, 0x0000, 0x0bc0, 0x0e8a0111 },
+    { 0x1302, 0x0000, 0x0bc0, 0x0e8c0111 },
+    { 0x1302, 0x0000, 0x0bc0, 0x0e8d0111 },
+    { 0x1302, 0x0000, 0x0bc0, 0x0e700111 },
+    { 0x1302, 0x0000, 0x0bc0, 0x0e770111 },
+    { 0x1302, 0x0000, 0x0bc0, 0x0e7e0111 },
+    { 0x1302, 0x0000, 0x0bc0, 0x0e8b0111 },
+    { 0x1302, 0x0000, 0x0bc0, 0x0e8e0111 },
+    { 0x1302, 0x0000, 0x0bc0, 0x0e8f0111 },
+    { 0x1302, 0x0000, 0x0bc0, 0xffffffff },
+    { 0x1302, 0x0000, 0x0bc0, 0xffffffff },
+    { 0x1302, 0x0000, 0x0bc0, 0xffffffff },
+    { 0x1302, 0x0000, 0x0bc0, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0x02670111 },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0bc0, 0xffffffff },
+    { 0x1302, 0x0000, 0x0bc0, 0xffffffff },
+    { 0x1302, 0x0000, 0x0bc0, 0xffffffff },
+    /* block 17 */
+    { 0x1300, 0x0000, 0x0000, 0x18310111 },
+    { 0x1300, 0x0000, 0x0000, 0x18320111 },
+    { 0x1300, 0x0000, 0x0000, 0x18330111 },
+    { 0x1300, 0x0000, 0x0000, 0x18340111 },
+    { 0x1300, 0x0000, 0x0000, 0x18350111 },
+    { 0x1300, 0x0000, 0x0000, 0x18360111 },
+    { 0x1300, 0x0000, 0x0000, 0x18370111 },
+    { 0x1300, 0x0000, 0x0000, 0x18380111 },
+    { 0x1300, 0x0000, 0x0000, 0x18390111 },
+    { 0x1300, 0x0000, 0x0000, 0x183a0111 },
+    { 0x1300, 0x0000, 0x0000, 0x183b0111 },
+    { 0x1300, 0x0000, 0x0000, 0x183c0111 },
+    { 0x1300, 0x0000, 0x0000, 0x183d0111 },
+    { 0x1300, 0x0000, 0x0000, 0x183e0111 },
+    { 0x1300, 0x0000, 0x0000, 0x183f0111 },
+    { 0x1300, 0x0000, 0x0000, 0x18400111 },
+    { 0x1300, 0x0000, 0x0000, 0x18410111 },
+    { 0x1300, 0x0000, 0x0000, 0x18420111 },
+    { 0x1300, 0x0000, 0x0000, 0x18430111 },
+    { 0x1300, 0x0000, 0x0000, 0x18440111 },
+    { 0x1300, 0x0000, 0x0000, 0x18450111 },
+    { 0x1300, 0x0000, 0x0000, 0x18460111 },
+    { 0x1300, 0x0000, 0x0000, 0x18470111 },
+    { 0x1300, 0x0000, 0x0000, 0x18480111 },
+    { 0x1300, 0x0000, 0x0000, 0x18490111 },
+    { 0x1300, 0x0000, 0x0000, 0x184a0111 },
+    { 0x1300, 0x0000, 0x0000, 0x184b0111 },
+    { 0x1300, 0x0000, 0x0000, 0x184c0111 },
+    { 0x1300, 0x0000, 0x0000, 0x184d0111 },
+    { 0x1300, 0x0000, 0x0000, 0x184e0111 },
+    { 0x1300, 0x0000, 0x0000, 0x184f0111 },
+    { 0x1300, 0x0000, 0x0000, 0x18500111 },
+    { 0x1300, 0x0000, 0x0000, 0x18510111 },
+    { 0x1300, 0x0000, 0x0000, 0x18520111 },
+    { 0x1300, 0x0000, 0x0000, 0x18530111 },
+    { 0x1300, 0x0000, 0x0000, 0x18540111 },
+    { 0x1300, 0x0000, 0x0000, 0x18550111 },
+    { 0x1300, 0x0000, 0x0000, 0x18560111 },
+    { 0x1300, 0x0000, 0x0000, 0x18570111 },
+    { 0x1300, 0x0000, 0x0000, 0x18580111 },
+    { 0x1300, 0x0000, 0x0000, 0x18590111 },
+    { 0x1300, 0x0000, 0x0000, 0x185a0111 },
+    { 0x1300, 0x0000, 0x0000, 0x185b0111 },
+    { 0x1300, 0x0000, 0x0000, 0x185c0111 },
+    { 0x1300, 0x0000, 0x0000, 0x185d0111 },
+    { 0x1300, 0x0000, 0x0000, 0x185e0111 },
+    { 0x1300, 0x0000, 0x0000, 0x185f0111 },
+    { 0x1300, 0x0000, 0x0000, 0x18600111 },
+    { 0x1300, 0x0000, 0x0000, 0x18610111 },
+    { 0x1300, 0x0000, 0x0000, 0x18620111 },
+    { 0x1300, 0x0000, 0x0000, 0x18630111 },
+    { 0x1300, 0x0000, 0x0000, 0x18640111 },
+    { 0x1300, 0x0000, 0x0000, 0x18650111 },
+    { 0x1300, 0x0000, 0x0000, 0x18660111 },
+    { 0x1300, 0x0000, 0x0000, 0x18670111 },
+    { 0x1300, 0x0000, 0x0000, 0x18680111 },
+    { 0x1300, 0x0000, 0x0000, 0x18690111 },
+    { 0x1300, 0x0000, 0x0000, 0x186a0111 },
+    { 0x1300, 0x0000, 0x0000, 0x186b0111 },
+    { 0x1300, 0x0000, 0x0000, 0x186c0111 },
+    { 0x1300, 0x0000, 0x0000, 0x186d0111 },
+    { 0x1300, 0x0000, 0x0000, 0x186e0111 },
+    { 0x1300, 0x0000, 0x0000, 0x186f0111 },
+    { 0x1300, 0x0000, 0x0000, 0x18700111 },
+    { 0x1300, 0x0000, 0x0000, 0x18710111 },
+    { 0x1300, 0x0000, 0x0000, 0x18720111 },
+    { 0x1300, 0x0000, 0x0000, 0x18730111 },
+    { 0x1300, 0x0000, 0x0000, 0x18740111 },
+    { 0x1300, 0x0000, 0x0000, 0x18750111 },
+    { 0x1300, 0x0000, 0x0000, 0x18760111 },
+    { 0x1300, 0x0000, 0x0000, 0x18770111 },
+    { 0x1300, 0x0000, 0x0000, 0x18780111 },
+    { 0x1300, 0x0000, 0x0000, 0x18790111 },
+    { 0x1300, 0x0000, 0x0000, 0x187a0111 },
+    { 0x1300, 0x0000, 0x0000, 0x187b0111 },
+    { 0x1300, 0x0000, 0x0000, 0x187c0111 },
+    { 0x1300, 0x0000, 0x0000, 0x187d0111 },
+    { 0x1300, 0x0000, 0x0000, 0x187e0111 },
+    { 0x1300, 0x0000, 0x0000, 0x187f0111 },
+    { 0x1300, 0x0000, 0x0000, 0x18800111 },
+    { 0x1300, 0x0000, 0x0000, 0x18810111 },
+    { 0x1300, 0x0000, 0x0000, 0x18820111 },
+    { 0x1300, 0x0000, 0x0000, 0x18830111 },
+    { 0x1300, 0x0000, 0x0000, 0x18840111 },
+    { 0x1300, 0x0000, 0x0000, 0x18850111 },
+    { 0x1300, 0x0000, 0x0000, 0x18860111 },
+    { 0x1300, 0x0000, 0x0000, 0x18870111 },
+    { 0x1300, 0x0000, 0x0000, 0x18880111 },
+    { 0x1300, 0x0000, 0x0000, 0x18890111 },
+    { 0x1300, 0x0000, 0x0000, 0x188a0111 },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x188b0111 },
+    { 0x1300, 0x0000, 0x0000, 0x188c0111 },
+    { 0x1300, 0x0000, 0x0000, 0x188d0111 },
+    { 0x1300, 0x0000, 0x0000, 0x188e0111 },
+    { 0x1300, 0x0000, 0x0000, 0x188f0111 },
+    { 0x1300, 0x0000, 0x0000, 0x18900111 },
+    { 0x1300, 0x0000, 0x0000, 0x18910111 },
+    { 0x1300, 0x0000, 0x0000, 0x18920111 },
+    { 0x1300, 0x0000, 0x0000, 0x18930111 },
+    { 0x1300, 0x0000, 0x0000, 0x18940111 },
+    { 0x1300, 0x0000, 0x0000, 0x18950111 },
+    { 0x1300, 0x0000, 0x0000, 0x18960111 },
+    { 0x1300, 0x0000, 0x0000, 0x18970111 },
+    { 0x1300, 0x0000, 0x0000, 0x18980111 },
+    { 0x1300, 0x0000, 0x0000, 0x18990111 },
+    { 0x1300, 0x0000, 0x0000, 0x189a0111 },
+    { 0x1300, 0x0000, 0x0000, 0x189b0111 },
+    { 0x1300, 0x0000, 0x0000, 0x189c0111 },
+    { 0x1300, 0x0000, 0x0000, 0x189d0111 },
+    { 0x1300, 0x0000, 0x0000, 0x189e0111 },
+    { 0x1300, 0x0000, 0x0000, 0x189f0111 },
+    { 0x1300, 0x0000, 0x0000, 0x18a00111 },
+    { 0x1300, 0x0000, 0x0000, 0x18a10111 },
+    { 0x1300, 0x0000, 0x0000, 0x18a20111 },
+    { 0x1300, 0x0000, 0x0000, 0x18a30111 },
+    { 0x1300, 0x0000, 0x0000, 0x18a40111 },
+    { 0x1300, 0x0000, 0x0000, 0x18a50111 },
+    { 0x1300, 0x0000, 0x0000, 0x18a60111 },
+    { 0x1300, 0x0000, 0x0000, 0x18a70111 },
+    { 0x1300, 0x0000, 0x0000, 0x18a80111 },
+    { 0x1300, 0x0000, 0x0000, 0x18a90111 },
+    { 0x1300, 0x0000, 0x0000, 0x18aa0111 },
+    { 0x1300, 0x0000, 0x0000, 0x18ab0111 },
+    { 0x1300, 0x0000, 0x0000, 0x18ac0111 },
+    { 0x1300, 0x0000, 0x0000, 0x18ad0111 },
+    { 0x1300, 0x0000, 0x0000, 0x18ae0111 },
+    { 0x1300, 0x0000, 0x0000, 0x18af0111 },
+    { 0x1300, 0x0000, 0x0000, 0x18b00111 },
+    { 0x1300, 0x0000, 0x0000, 0x18b10111 },
+    { 0x1300, 0x0000, 0x0000, 0x18b20111 },
+    { 0x1300, 0x0000, 0x0000, 0x18b30111 },
+    { 0x1300, 0x0000, 0x0000, 0x18b40111 },
+    { 0x1300, 0x0000, 0x0000, 0x18b50111 },
+    { 0x1300, 0x0000, 0x0000, 0x18b60111 },
+    { 0x1300, 0x0000, 0x0000, 0x18b70111 },
+    { 0x1300, 0x0000, 0x0000, 0x18b80111 },
+    { 0x1300, 0x0000, 0x0000, 0x18b90111 },
+    { 0x1300, 0x0000, 0x0000, 0x18ba0111 },
+    { 0x1300, 0x0000, 0x0000, 0x18bb0111 },
+    { 0x1300, 0x0000, 0x0000, 0x18bc0111 },
+    { 0x1300, 0x0000, 0x0000, 0x18bd0111 },
+    { 0x1300, 0x0000, 0x0000, 0x18be0111 },
+    { 0x1300, 0x0000, 0x0000, 0x18bf0111 },
+    { 0x1300, 0x0000, 0x0000, 0x18c00111 },
+    { 0x1300, 0x0000, 0x0000, 0x18c10111 },
+    { 0x1300, 0x0000, 0x0000, 0x18c20111 },
+    { 0x1300, 0x0000, 0x0000, 0x18c30111 },
+    { 0x1300, 0x0000, 0x0000, 0x18c40111 },
+    { 0x1300, 0x0000, 0x0000, 0x18c50111 },
+    { 0x1300, 0x0000, 0x0000, 0x18c60111 },
+    { 0x1300, 0x0000, 0x0000, 0x18c70111 },
+    { 0x1300, 0x0000, 0x0000, 0x18c80111 },
+    { 0x1300, 0x0000, 0x0000, 0x18c90111 },
+    { 0x1300, 0x0000, 0x0000, 0x18ca0111 },
+    { 0x1300, 0x0000, 0x0000, 0x18cb0111 },
+    { 0x1300, 0x0000, 0x0000, 0x18cc0111 },
+    { 0x1300, 0x0000, 0x0000, 0x18cd0111 },
+    { 0x1300, 0x0000, 0x0000, 0x18ce0111 },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x18cf0111 },
+    { 0x1300, 0x0000, 0x0000, 0x18d00111 },
+    { 0x1300, 0x0000, 0x0000, 0x18d10111 },
+    { 0x1300, 0x0000, 0x0000, 0x18d20111 },
+    { 0x1300, 0x0000, 0x0000, 0x18d30111 },
+    { 0x1300, 0x0000, 0x0000, 0x18d40111 },
+    { 0x1300, 0x0000, 0x0000, 0x18d50111 },
+    { 0x1300, 0x0000, 0x0000, 0x18d60111 },
+    { 0x1300, 0x0000, 0x0000, 0x18d70111 },
+    { 0x1300, 0x0000, 0x0000, 0x18d80111 },
+    { 0x1300, 0x0000, 0x0000, 0x18d90111 },
+    { 0x1300, 0x0000, 0x0000, 0x18da0111 },
+    { 0x1300, 0x0000, 0x0000, 0x18db0111 },
+    { 0x1300, 0x0000, 0x0000, 0x18dc0111 },
+    { 0x1300, 0x0000, 0x0000, 0x18dd0111 },
+    { 0x1300, 0x0000, 0x0000, 0x18de0111 },
+    { 0x1300, 0x0000, 0x0000, 0x18df0111 },
+    { 0x1300, 0x0000, 0x0000, 0x18e00111 },
+    { 0x1300, 0x0000, 0x0000, 0x18e10111 },
+    { 0x1300, 0x0000, 0x0000, 0x18e20111 },
+    { 0x1300, 0x0000, 0x0000, 0x18e30111 },
+    { 0x1300, 0x0000, 0x0000, 0x18e40111 },
+    { 0x1300, 0x0000, 0x0000, 0x18e50111 },
+    { 0x1300, 0x0000, 0x0000, 0x18e60111 },
+    { 0x1300, 0x0000, 0x0000, 0x18e70111 },
+    { 0x1300, 0x0000, 0x0000, 0x18e80111 },
+    { 0x1300, 0x0000, 0x0000, 0x18e90111 },
+    { 0x1300, 0x0000, 0x0000, 0x18ea0111 },
+    { 0x1300, 0x0000, 0x0000, 0x18eb0111 },
+    { 0x1300, 0x0000, 0x0000, 0x18ec0111 },
+    { 0x1300, 0x0000, 0x0000, 0x18ed0111 },
+    { 0x1300, 0x0000, 0x0000, 0x18ee0111 },
+    { 0x1300, 0x0000, 0x0000, 0x18ef0111 },
+    { 0x1300, 0x0000, 0x0000, 0x18f00111 },
+    { 0x1300, 0x0000, 0x0000, 0x18f10111 },
+    { 0x1300, 0x0000, 0x0000, 0x18f20111 },
+    { 0x1300, 0x0000, 0x0000, 0x18f30111 },
+    { 0x1300, 0x0000, 0x0000, 0x18f40111 },
+    { 0x1300, 0x0000, 0x0000, 0x18f50111 },
+    { 0x1300, 0x0000, 0x0000, 0x18f60111 },
+    { 0x1300, 0x0000, 0x0000, 0x18f70111 },
+    { 0x1300, 0x0000, 0x0000, 0x18f80111 },
+    { 0x1300, 0x0000, 0x0000, 0x18f90111 },
+    { 0x1300, 0x0000, 0x0000, 0x18fa0111 },
+    { 0x1300, 0x0000, 0x0000, 0x18fb0111 },
+    { 0x1300, 0x0000, 0x0000, 0x18fc0111 },
+    { 0x1300, 0x0000, 0x0000, 0x18fd0111 },
+    { 0x1300, 0x0000, 0x0000, 0x18fe0111 },
+    { 0x1300, 0x0000, 0x0000, 0x18ff0111 },
+    { 0x1300, 0x0000, 0x0000, 0x19000111 },
+    { 0x1300, 0x0000, 0x0000, 0x19010111 },
+    { 0x1300, 0x0000, 0x0000, 0x19020111 },
+    { 0x1300, 0x0000, 0x0000, 0x19030111 },
+    { 0x1300, 0x0000, 0x0000, 0x19040111 },
+    { 0x1300, 0x0000, 0x0000, 0x19050111 },
+    { 0x1300, 0x0000, 0x0000, 0x19060111 },
+    { 0x1300, 0x0000, 0x0000, 0x19070111 },
+    { 0x1300, 0x0000, 0x0000, 0x19080111 },
+    { 0x1300, 0x0000, 0x0000, 0x19090111 },
+    { 0x1300, 0x0000, 0x0000, 0x190a0111 },
+    { 0x1300, 0x0000, 0x0000, 0x190b0111 },
+    { 0x1300, 0x0000, 0x0000, 0x190c0111 },
+    { 0x1300, 0x0000, 0x0000, 0x190d0111 },
+    { 0x1300, 0x0000, 0x0000, 0x190e0111 },
+    { 0x1300, 0x0000, 0x0000, 0x190f0111 },
+    { 0x1300, 0x0000, 0x0000, 0x19100111 },
+    { 0x1300, 0x0000, 0x0000, 0x19110111 },
+    { 0x1300, 0x0000, 0x0000, 0x19120111 },
+    { 0x1300, 0x0000, 0x0000, 0x19130111 },
+    { 0x1300, 0x0000, 0x0000, 0x19140111 },
+    { 0x1300, 0x0000, 0x0000, 0x19150111 },
+    { 0x1300, 0x0000, 0x0000, 0x19160111 },
+    { 0x1300, 0x0000, 0x0000, 0x19170111 },
+    { 0x1300, 0x0000, 0x0000, 0x19180111 },
+    { 0x1300, 0x0000, 0x0000, 0x19190111 },
+    { 0x1300, 0x0000, 0x0000, 0x191a0111 },
+    { 0x1300, 0x0000, 0x0000, 0x191b0111 },
+    { 0x1300, 0x0000, 0x0000, 0x191c0111 },
+    { 0x1300, 0x0000, 0x0000, 0x191d0111 },
+    { 0x1300, 0x0000, 0x0000, 0x191e0111 },
+    { 0x1300, 0x0000, 0x0000, 0x191f0111 },
+    { 0x1300, 0x0000, 0x0000, 0x19200111 },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    /* block 18 */
+    { 0x1300, 0x0000, 0x0000, 0x0f990111 },
+    { 0x1300, 0x0000, 0x0000, 0x0f9a0111 },
+    { 0x1300, 0x0000, 0x0000, 0x0f9b0111 },
+    { 0x1300, 0x0000, 0x0000, 0x0f9c0111 },
+    { 0x1300, 0x0000, 0x0000, 0x0f9d0111 },
+    { 0x1300, 0x0000, 0x0000, 0x0f9e0111 },
+    { 0x1300, 0x0000, 0x0000, 0x0f9f0111 },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x0fa00111 },
+    { 0x1300, 0x0000, 0x0000, 0x0fa10111 },
+    { 0x1300, 0x0000, 0x0000, 0x0fa20111 },
+    { 0x1300, 0x0000, 0x0000, 0x0fa30111 },
+    { 0x1300, 0x0000, 0x0000, 0x0fa40111 },
+    { 0x1300, 0x0000, 0x0000, 0x0fa50111 },
+    { 0x1300, 0x0000, 0x0000, 0x0fa60111 },
+    { 0x1300, 0x0000, 0x0000, 0x0fa70111 },
+    { 0x1300, 0x0000, 0x0000, 0x0fa80111 },
+    { 0x1300, 0x0000, 0x0000, 0x0fa90111 },
+    { 0x1300, 0x0000, 0x0000, 0x0faa0111 },
+    { 0x1300, 0x0000, 0x0000, 0x0fab0111 },
+    { 0x1300, 0x0000, 0x0000, 0x0fac0111 },
+    { 0x1300, 0x0000, 0x0000, 0x0fad0111 },
+    { 0x1300, 0x0000, 0x0000, 0x0fae0111 },
+    { 0x1300, 0x0000, 0x0000, 0x0faf0111 },
+    { 0x1300, 0x0000, 0x0000, 0x0fb00111 },
+    { 0x1300, 0x0000, 0x0000, 0x0fb10111 },
+    { 0x1300, 0x0000, 0x0000, 0x0fb20111 },
+    { 0x1300, 0x0000, 0x0000, 0x0fb30111 },
+    { 0x1300, 0x0000, 0x0000, 0x0fb40111 },
+    { 0x1300, 0x0000, 0x0000, 0x0fb50111 },
+    { 0x1300, 0x0000, 0x0000, 0x0fb60111 },
+    { 0x1300, 0x0000, 0x0000, 0x0fb70111 },
+    { 0x1300, 0x0000, 0x0000, 0x0fb80111 },
+    { 0x1300, 0x0000, 0x0000, 0x0fb90111 },
+    { 0x1300, 0x0000, 0x0000, 0x0fba0111 },
+    { 0x1300, 0x0000, 0x0000, 0x0fbb0111 },
+    { 0x1300, 0x0000, 0x0000, 0x0fbc0111 },
+    { 0x1300, 0x0000, 0x0000, 0x0fbd0111 },
+    { 0x1300, 0x0000, 0x0000, 0x0fbe0111 },
+    { 0x1300, 0x0000, 0x0000, 0x0fbf0111 },
+    { 0x1300, 0x0000, 0x0000, 0x0fc00111 },
+    { 0x1300, 0x0000, 0x0000, 0x0fc10111 },
+    { 0x1300, 0x0000, 0x0000, 0x0fc20111 },
+    { 0x1300, 0x0000, 0x0000, 0x0fc30111 },
+    { 0x1300, 0x0000, 0x0000, 0x0fc40111 },
+    { 0x1300, 0x0000, 0x0000, 0x0fc50111 },
+    { 0x1300, 0x0000, 0x0000, 0x0fc60111 },
+    { 0x1300, 0x0000, 0x0000, 0x0fc70111 },
+    { 0x1300, 0x0000, 0x0000, 0x0fc80111 },
+    { 0x1300, 0x0000, 0x0000, 0x0fc90111 },
+    { 0x1300, 0x0000, 0x0000, 0x0fca0111 },
+    { 0x1300, 0x0000, 0x0000, 0x0fcb0111 },
+    { 0x1300, 0x0000, 0x0000, 0x0fcc0111 },
+    { 0x1300, 0x0000, 0x0000, 0x0fcd0111 },
+    { 0x1300, 0x0000, 0x0000, 0x0fce0111 },
+    { 0x1300, 0x0000, 0x0000, 0x0fcf0111 },
+    { 0x1300, 0x0000, 0x0000, 0x0fd00111 },
+    { 0x1300, 0x0000, 0x0000, 0x0fd10111 },
+    { 0x1300, 0x0000, 0x0000, 0x0fd20111 },
+    { 0x1300, 0x0000, 0x0000, 0x0fd30111 },
+    { 0x1300, 0x0000, 0x0000, 0x0fd40111 },
+    { 0x1300, 0x0000, 0x0000, 0x0fd50111 },
+    { 0x1300, 0x0000, 0x0000, 0x0fd60111 },
+    { 0x1300, 0x0000, 0x0000, 0x0fd70111 },
+    { 0x1300, 0x0000, 0x0000, 0x0fd80111 },
+    { 0x1300, 0x0000, 0x0000, 0x0fd90111 },
+    { 0x1300, 0x0000, 0x0000, 0x0fda0111 },
+    { 0x1300, 0x0000, 0x0000, 0x0fdb0111 },
+    { 0x1300, 0x0000, 0x0000, 0x0fdc0111 },
+    { 0x1300, 0x0000, 0x0000, 0x0fdd0111 },
+    { 0x1300, 0x0000, 0x0000, 0x0fde0111 },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x0fdf0111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x0fe00111 },
+    { 0x1300, 0x0000, 0x0000, 0x0fe10111 },
+    { 0x1300, 0x0000, 0x0000, 0x0fe20111 },
+    { 0x1300, 0x0000, 0x0000, 0x0fe30111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x0fe40111 },
+    { 0x1300, 0x0000, 0x0000, 0x0fe50111 },
+    { 0x1300, 0x0000, 0x0000, 0x0fe60111 },
+    { 0x1300, 0x0000, 0x0000, 0x0fe70111 },
+    { 0x1300, 0x0000, 0x0000, 0x0fe80111 },
+    { 0x1300, 0x0000, 0x0000, 0x0fe90111 },
+    { 0x1300, 0x0000, 0x0000, 0x0fea0111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x0feb0111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x0fec0111 },
+    { 0x1300, 0x0000, 0x0000, 0x0fed0111 },
+    { 0x1300, 0x0000, 0x0000, 0x0fee0111 },
+    { 0x1300, 0x0000, 0x0000, 0x0fef0111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x0ff00111 },
+    { 0x1300, 0x0000, 0x0000, 0x0ff10111 },
+    { 0x1300, 0x0000, 0x0000, 0x0ff20111 },
+    { 0x1300, 0x0000, 0x0000, 0x0ff30111 },
+    { 0x1300, 0x0000, 0x0000, 0x0ff40111 },
+    { 0x1300, 0x0000, 0x0000, 0x0ff50111 },
+    { 0x1300, 0x0000, 0x0000, 0x0ff60111 },
+    { 0x1300, 0x0000, 0x0000, 0x0ff70111 },
+    { 0x1300, 0x0000, 0x0000, 0x0ff80111 },
+    { 0x1300, 0x0000, 0x0000, 0x0ff90111 },
+    { 0x1300, 0x0000, 0x0000, 0x0ffa0111 },
+    { 0x1300, 0x0000, 0x0000, 0x0ffb0111 },
+    { 0x1300, 0x0000, 0x0000, 0x0ffc0111 },
+    { 0x1300, 0x0000, 0x0000, 0x0ffd0111 },
+    { 0x1300, 0x0000, 0x0000, 0x0ffe0111 },
+    { 0x1300, 0x0000, 0x0000, 0x0fff0111 },
+    { 0x1300, 0x0000, 0x0000, 0x10000111 },
+    { 0x1300, 0x0000, 0x0000, 0x10010111 },
+    { 0x1300, 0x0000, 0x0000, 0x10020111 },
+    { 0x1300, 0x0000, 0x0000, 0x10030111 },
+    { 0x1300, 0x0000, 0x0000, 0x10040111 },
+    { 0x1300, 0x0000, 0x0000, 0x10050111 },
+    { 0x1300, 0x0000, 0x0000, 0x10060111 },
+    { 0x1300, 0x0000, 0x0000, 0x10070111 },
+    { 0x1300, 0x0000, 0x0000, 0x10080111 },
+    { 0x1300, 0x0000, 0x0000, 0x10090111 },
+    { 0x1300, 0x0000, 0x0000, 0x100a0111 },
+    { 0x1300, 0x0000, 0x0000, 0x100b0111 },
+    { 0x1300, 0x0000, 0x0000, 0x100c0111 },
+    { 0x1300, 0x0000, 0x0000, 0x100d0111 },
+    { 0x1300, 0x0000, 0x0000, 0x100e0111 },
+    { 0x1300, 0x0000, 0x0000, 0x100f0111 },
+    { 0x1300, 0x0000, 0x0000, 0x10100111 },
+    { 0x1300, 0x0000, 0x0000, 0x10110111 },
+    { 0x1300, 0x0000, 0x0000, 0x10120111 },
+    { 0x1300, 0x0000, 0x0000, 0x10130111 },
+    { 0x1300, 0x0000, 0x0000, 0x10140111 },
+    { 0x1300, 0x0000, 0x0000, 0x10150111 },
+    { 0x1300, 0x0000, 0x0000, 0x10160111 },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x10170111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x10180111 },
+    { 0x1300, 0x0000, 0x0000, 0x10190111 },
+    { 0x1300, 0x0000, 0x0000, 0x101a0111 },
+    { 0x1300, 0x0000, 0x0000, 0x101b0111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x101c0111 },
+    { 0x1300, 0x0000, 0x0000, 0x101d0111 },
+    { 0x1300, 0x0000, 0x0000, 0x101e0111 },
+    { 0x1300, 0x0000, 0x0000, 0x101f0111 },
+    { 0x1300, 0x0000, 0x0000, 0x10200111 },
+    { 0x1300, 0x0000, 0x0000, 0x10210111 },
+    { 0x1300, 0x0000, 0x0000, 0x10220111 },
+    { 0x1300, 0x0000, 0x0000, 0x10230111 },
+    { 0x1300, 0x0000, 0x0000, 0x10240111 },
+    { 0x1300, 0x0000, 0x0000, 0x10250111 },
+    { 0x1300, 0x0000, 0x0000, 0x10260111 },
+    { 0x1300, 0x0000, 0x0000, 0x10270111 },
+    { 0x1300, 0x0000, 0x0000, 0x10280111 },
+    { 0x1300, 0x0000, 0x0000, 0x10290111 },
+    { 0x1300, 0x0000, 0x0000, 0x102a0111 },
+    { 0x1300, 0x0000, 0x0000, 0x102b0111 },
+    { 0x1300, 0x0000, 0x0000, 0x102c0111 },
+    { 0x1300, 0x0000, 0x0000, 0x102d0111 },
+    { 0x1300, 0x0000, 0x0000, 0x102e0111 },
+    { 0x1300, 0x0000, 0x0000, 0x102f0111 },
+    { 0x1300, 0x0000, 0x0000, 0x10300111 },
+    { 0x1300, 0x0000, 0x0000, 0x10310111 },
+    { 0x1300, 0x0000, 0x0000, 0x10320111 },
+    { 0x1300, 0x0000, 0x0000, 0x10330111 },
+    { 0x1300, 0x0000, 0x0000, 0x10340111 },
+    { 0x1300, 0x0000, 0x0000, 0x10350111 },
+    { 0x1300, 0x0000, 0x0000, 0x10360111 },
+    { 0x1300, 0x0000, 0x0000, 0x10370111 },
+    { 0x1300, 0x0000, 0x0000, 0x10380111 },
+    { 0x1300, 0x0000, 0x0000, 0x10390111 },
+    { 0x1300, 0x0000, 0x0000, 0x103a0111 },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x103b0111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x103c0111 },
+    { 0x1300, 0x0000, 0x0000, 0x103d0111 },
+    { 0x1300, 0x0000, 0x0000, 0x103e0111 },
+    { 0x1300, 0x0000, 0x0000, 0x103f0111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x10400111 },
+    { 0x1300, 0x0000, 0x0000, 0x10410111 },
+    { 0x1300, 0x0000, 0x0000, 0x10420111 },
+    { 0x1300, 0x0000, 0x0000, 0x10430111 },
+    { 0x1300, 0x0000, 0x0000, 0x10440111 },
+    { 0x1300, 0x0000, 0x0000, 0x10450111 },
+    { 0x1300, 0x0000, 0x0000, 0x10460111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x10470111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x10480111 },
+    { 0x1300, 0x0000, 0x0000, 0x10490111 },
+    { 0x1300, 0x0000, 0x0000, 0x104a0111 },
+    { 0x1300, 0x0000, 0x0000, 0x104b0111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x104c0111 },
+    { 0x1300, 0x0000, 0x0000, 0x104d0111 },
+    { 0x1300, 0x0000, 0x0000, 0x104e0111 },
+    { 0x1300, 0x0000, 0x0000, 0x104f0111 },
+    { 0x1300, 0x0000, 0x0000, 0x10500111 },
+    { 0x1300, 0x0000, 0x0000, 0x10510111 },
+    { 0x1300, 0x0000, 0x0000, 0x10520111 },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x10530111 },
+    { 0x1300, 0x0000, 0x0000, 0x10540111 },
+    { 0x1300, 0x0000, 0x0000, 0x10550111 },
+    { 0x1300, 0x0000, 0x0000, 0x10560111 },
+    { 0x1300, 0x0000, 0x0000, 0x10570111 },
+    { 0x1300, 0x0000, 0x0000, 0x10580111 },
+    { 0x1300, 0x0000, 0x0000, 0x10590111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x105a0111 },
+    { 0x1300, 0x0000, 0x0000, 0x105b0111 },
+    { 0x1300, 0x0000, 0x0000, 0x105c0111 },
+    { 0x1300, 0x0000, 0x0000, 0x105d0111 },
+    { 0x1300, 0x0000, 0x0000, 0x105e0111 },
+    { 0x1300, 0x0000, 0x0000, 0x105f0111 },
+    { 0x1300, 0x0000, 0x0000, 0x10600111 },
+    { 0x1300, 0x0000, 0x0000, 0x10610111 },
+    { 0x1300, 0x0000, 0x0000, 0x10620111 },
+    { 0x1300, 0x0000, 0x0000, 0x10630111 },
+    { 0x1300, 0x0000, 0x0000, 0x10640111 },
+    { 0x1300, 0x0000, 0x0000, 0x10650111 },
+    { 0x1300, 0x0000, 0x0000, 0x10660111 },
+    { 0x1300, 0x0000, 0x0000, 0x10670111 },
+    { 0x1300, 0x0000, 0x0000, 0x10680111 },
+    { 0x1300, 0x0000, 0x0000, 0x10690111 },
+    { 0x1300, 0x0000, 0x0000, 0x106a0111 },
+    { 0x1300, 0x0000, 0x0000, 0x106b0111 },
+    { 0x1300, 0x0000, 0x0000, 0x106c0111 },
+    { 0x1300, 0x0000, 0x0000, 0x106d0111 },
+    { 0x1300, 0x0000, 0x0000, 0x106e0111 },
+    { 0x1300, 0x0000, 0x0000, 0x106f0111 },
+    { 0x1300, 0x0000, 0x0000, 0x10700111 },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x10710111 },
+    { 0x1300, 0x0000, 0x0000, 0x10720111 },
+    { 0x1300, 0x0000, 0x0000, 0x10730111 },
+    { 0x1300, 0x0000, 0x0000, 0x10740111 },
+    { 0x1300, 0x0000, 0x0000, 0x10750111 },
+    { 0x1300, 0x0000, 0x0000, 0x10760111 },
+    { 0x1300, 0x0000, 0x0000, 0x10770111 },
+    { 0x1300, 0x0000, 0x0000, 0x10780111 },
+    { 0x1300, 0x0000, 0x0000, 0x10790111 },
+    { 0x1300, 0x0000, 0x0000, 0x107a0111 },
+    { 0x1300, 0x0000, 0x0000, 0x107b0111 },
+    { 0x1300, 0x0000, 0x0000, 0x107c0111 },
+    { 0x1300, 0x0000, 0x0000, 0x107d0111 },
+    { 0x1300, 0x0000, 0x0000, 0x107e0111 },
+    { 0x1300, 0x0000, 0x0000, 0x107f0111 },
+    { 0x1300, 0x0000, 0x0000, 0x10800111 },
+    /* block 19 */
+    { 0x1300, 0x0000, 0x0000, 0x10810111 },
+    { 0x1300, 0x0000, 0x0000, 0x10820111 },
+    { 0x1300, 0x0000, 0x0000, 0x10830111 },
+    { 0x1300, 0x0000, 0x0000, 0x10840111 },
+    { 0x1300, 0x0000, 0x0000, 0x10850111 },
+    { 0x1300, 0x0000, 0x0000, 0x10860111 },
+    { 0x1300, 0x0000, 0x0000, 0x10870111 },
+    { 0x1300, 0x0000, 0x0000, 0x10880111 },
+    { 0x1300, 0x0000, 0x0000, 0x10890111 },
+    { 0x1300, 0x0000, 0x0000, 0x108a0111 },
+    { 0x1300, 0x0000, 0x0000, 0x108b0111 },
+    { 0x1300, 0x0000, 0x0000, 0x108c0111 },
+    { 0x1300, 0x0000, 0x0000, 0x108d0111 },
+    { 0x1300, 0x0000, 0x0000, 0x108e0111 },
+    { 0x1300, 0x0000, 0x0000, 0x108f0111 },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x10900111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x10910111 },
+    { 0x1300, 0x0000, 0x0000, 0x10920111 },
+    { 0x1300, 0x0000, 0x0000, 0x10930111 },
+    { 0x1300, 0x0000, 0x0000, 0x10940111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x10950111 },
+    { 0x1300, 0x0000, 0x0000, 0x10960111 },
+    { 0x1300, 0x0000, 0x0000, 0x10970111 },
+    { 0x1300, 0x0000, 0x0000, 0x10980111 },
+    { 0x1300, 0x0000, 0x0000, 0x10990111 },
+    { 0x1300, 0x0000, 0x0000, 0x109a0111 },
+    { 0x1300, 0x0000, 0x0000, 0x109b0111 },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x109c0111 },
+    { 0x1300, 0x0000, 0x0000, 0x109d0111 },
+    { 0x1300, 0x0000, 0x0000, 0x109e0111 },
+    { 0x1300, 0x0000, 0x0000, 0x109f0111 },
+    { 0x1300, 0x0000, 0x0000, 0x10a00111 },
+    { 0x1300, 0x0000, 0x0000, 0x10a10111 },
+    { 0x1300, 0x0000, 0x0000, 0x10a20111 },
+    { 0x1300, 0x0000, 0x0000, 0x10a30111 },
+    { 0x1300, 0x0000, 0x0000, 0x10a40111 },
+    { 0x1300, 0x0000, 0x0000, 0x10a50111 },
+    { 0x1300, 0x0000, 0x0000, 0x10a60111 },
+    { 0x1300, 0x0000, 0x0000, 0x10a70111 },
+    { 0x1300, 0x0000, 0x0000, 0x10a80111 },
+    { 0x1300, 0x0000, 0x0000, 0x10a90111 },
+    { 0x1300, 0x0000, 0x0000, 0x10aa0111 },
+    { 0x1300, 0x0000, 0x0000, 0x10ab0111 },
+    { 0x1300, 0x0000, 0x0000, 0x10ac0111 },
+    { 0x1300, 0x0000, 0x0000, 0x10ad0111 },
+    { 0x1300, 0x0000, 0x0000, 0x10ae0111 },
+    { 0x1300, 0x0000, 0x0000, 0x10af0111 },
+    { 0x1300, 0x0000, 0x0000, 0x10b00111 },
+    { 0x1300, 0x0000, 0x0000, 0x10b10111 },
+    { 0x1300, 0x0000, 0x0000, 0x10b20111 },
+    { 0x1300, 0x0000, 0x0000, 0x10b30111 },
+    { 0x1300, 0x0000, 0x0000, 0x10b40111 },
+    { 0x1300, 0x0000, 0x0000, 0x10b50111 },
+    { 0x1300, 0x0000, 0x0000, 0x10b60111 },
+    { 0x1300, 0x0000, 0x0000, 0x10b70111 },
+    { 0x1300, 0x0000, 0x0000, 0x10b80111 },
+    { 0x1300, 0x0000, 0x0000, 0x10b90111 },
+    { 0x1300, 0x0000, 0x0000, 0x10ba0111 },
+    { 0x1300, 0x0000, 0x0000, 0x10bb0111 },
+    { 0x1300, 0x0000, 0x0000, 0x10bc0111 },
+    { 0x1300, 0x0000, 0x0000, 0x10bd0111 },
+    { 0x1300, 0x0000, 0x0000, 0x10be0111 },
+    { 0x1300, 0x0000, 0x0000, 0x10bf0111 },
+    { 0x1300, 0x0000, 0x0000, 0x10c00111 },
+    { 0x1300, 0x0000, 0x0000, 0x10c10111 },
+    { 0x1300, 0x0000, 0x0000, 0x10c20111 },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x10c30111 },
+    { 0x1300, 0x0000, 0x0000, 0x10c40111 },
+    { 0x1300, 0x0000, 0x0000, 0x10c50111 },
+    { 0x1300, 0x0000, 0x0000, 0x10c60111 },
+    { 0x1300, 0x0000, 0x0000, 0x10c70111 },
+    { 0x1300, 0x0000, 0x0000, 0x10c80111 },
+    { 0x1300, 0x0000, 0x0000, 0x10c90111 },
+    { 0x1300, 0x0000, 0x0000, 0x10ca0111 },
+    { 0x1300, 0x0000, 0x0000, 0x10cb0111 },
+    { 0x1300, 0x0000, 0x0000, 0x10cc0111 },
+    { 0x1300, 0x0000, 0x0000, 0x10cd0111 },
+    { 0x1300, 0x0000, 0x0000, 0x10ce0111 },
+    { 0x1300, 0x0000, 0x0000, 0x10cf0111 },
+    { 0x1300, 0x0000, 0x0000, 0x10d00111 },
+    { 0x1300, 0x0000, 0x0000, 0x10d10111 },
+    { 0x1300, 0x0000, 0x0000, 0x10d20111 },
+    { 0x1300, 0x0000, 0x0000, 0x10d30111 },
+    { 0x1300, 0x0000, 0x0000, 0x10d40111 },
+    { 0x1300, 0x0000, 0x0000, 0x10d50111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0x023f0111 },
+    { 0x1210, 0x0000, 0x0000, 0x025a0111 },
+    { 0x1210, 0x0000, 0x0000, 0x02400111 },
+    { 0x1210, 0x0000, 0x0000, 0x02410111 },
+    { 0x1210, 0x0000, 0x0000, 0x02420111 },
+    { 0x1210, 0x0000, 0x0000, 0x02430111 },
+    { 0x1210, 0x0000, 0x0000, 0x02530111 },
+    { 0x1210, 0x0000, 0x0000, 0x02680111 },
+    { 0x1200, 0x0000, 0x0000, 0x0a0c0111 },
+    { 0x1200, 0x0000, 0x0000, 0x0a0d0111 },
+    { 0x1200, 0x0000, 0x0000, 0x0a0e0111 },
+    { 0x1200, 0x0000, 0x0000, 0x0a0f0111 },
+    { 0x1200, 0x0000, 0x0000, 0x0a100111 },
+    { 0x1200, 0x0000, 0x0000, 0x0a110111 },
+    { 0x1200, 0x0000, 0x0000, 0x0a120111 },
+    { 0x1200, 0x0000, 0x0000, 0x0a130111 },
+    { 0x1200, 0x0000, 0x0000, 0x0a140111 },
+    { 0x1200, 0x0000, 0x0000, 0x09c60111 },
+    { 0x1200, 0x0000, 0x0000, 0x09c70111 },
+    { 0x1200, 0x0000, 0x0000, 0x09c80111 },
+    { 0x1200, 0x0000, 0x0000, 0x09c90111 },
+    { 0x1200, 0x0000, 0x0000, 0x09ca0111 },
+    { 0x1200, 0x0000, 0x0000, 0x09cb0111 },
+    { 0x1200, 0x0000, 0x0000, 0x09cc0111 },
+    { 0x1200, 0x0000, 0x0000, 0x09cd0111 },
+    { 0x1200, 0x0000, 0x0000, 0x09ce0111 },
+    { 0x1200, 0x0000, 0x0000, 0x09cf0111 },
+    { 0x1200, 0x0000, 0x0000, 0x09d00111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1301, 0x97d0, 0x0000, 0x15280111 },
+    { 0x1301, 0x97d0, 0x0000, 0x15290111 },
+    { 0x1301, 0x97d0, 0x0000, 0x152a0111 },
+    { 0x1301, 0x97d0, 0x0000, 0x152b0111 },
+    { 0x1301, 0x97d0, 0x0000, 0x152c0111 },
+    { 0x1301, 0x97d0, 0x0000, 0x152d0111 },
+    { 0x1301, 0x97d0, 0x0000, 0x152e0111 },
+    { 0x1301, 0x97d0, 0x0000, 0x152f0111 },
+    { 0x1301, 0x97d0, 0x0000, 0x15300111 },
+    { 0x1301, 0x97d0, 0x0000, 0x15310111 },
+    { 0x1301, 0x97d0, 0x0000, 0x15320111 },
+    { 0x1301, 0x97d0, 0x0000, 0x15330111 },
+    { 0x1301, 0x97d0, 0x0000, 0x15340111 },
+    { 0x1301, 0x97d0, 0x0000, 0x15350111 },
+    { 0x1301, 0x97d0, 0x0000, 0x15360111 },
+    { 0x1301, 0x97d0, 0x0000, 0x15370111 },
+    { 0x1301, 0x97d0, 0x0000, 0x15380111 },
+    { 0x1301, 0x97d0, 0x0000, 0x15390111 },
+    { 0x1301, 0x97d0, 0x0000, 0x153a0111 },
+    { 0x1301, 0x97d0, 0x0000, 0x153b0111 },
+    { 0x1301, 0x97d0, 0x0000, 0x153c0111 },
+    { 0x1301, 0x97d0, 0x0000, 0x153d0111 },
+    { 0x1301, 0x97d0, 0x0000, 0x153e0111 },
+    { 0x1301, 0x97d0, 0x0000, 0x153f0111 },
+    { 0x1301, 0x97d0, 0x0000, 0x15400111 },
+    { 0x1301, 0x97d0, 0x0000, 0x15410111 },
+    { 0x1301, 0x97d0, 0x0000, 0x15420111 },
+    { 0x1301, 0x97d0, 0x0000, 0x15430111 },
+    { 0x1301, 0x97d0, 0x0000, 0x15440111 },
+    { 0x1301, 0x97d0, 0x0000, 0x15450111 },
+    { 0x1301, 0x97d0, 0x0000, 0x15460111 },
+    { 0x1301, 0x97d0, 0x0000, 0x15470111 },
+    { 0x1301, 0x97d0, 0x0000, 0x15480111 },
+    { 0x1301, 0x97d0, 0x0000, 0x15490111 },
+    { 0x1301, 0x97d0, 0x0000, 0x154a0111 },
+    { 0x1301, 0x97d0, 0x0000, 0x154b0111 },
+    { 0x1301, 0x97d0, 0x0000, 0x154c0111 },
+    { 0x1301, 0x97d0, 0x0000, 0x154d0111 },
+    { 0x1301, 0x97d0, 0x0000, 0x154e0111 },
+    { 0x1301, 0x97d0, 0x0000, 0x154f0111 },
+    { 0x1301, 0x97d0, 0x0000, 0x15500111 },
+    { 0x1301, 0x97d0, 0x0000, 0x15510111 },
+    { 0x1301, 0x97d0, 0x0000, 0x15520111 },
+    { 0x1301, 0x97d0, 0x0000, 0x15530111 },
+    { 0x1301, 0x97d0, 0x0000, 0x15540111 },
+    { 0x1301, 0x97d0, 0x0000, 0x15550111 },
+    { 0x1301, 0x97d0, 0x0000, 0x15560111 },
+    { 0x1301, 0x97d0, 0x0000, 0x15570111 },
+    { 0x1301, 0x97d0, 0x0000, 0x15580111 },
+    { 0x1301, 0x97d0, 0x0000, 0x15590111 },
+    { 0x1301, 0x97d0, 0x0000, 0x155a0111 },
+    { 0x1301, 0x97d0, 0x0000, 0x155b0111 },
+    { 0x1301, 0x97d0, 0x0000, 0x155c0111 },
+    { 0x1301, 0x97d0, 0x0000, 0x155d0111 },
+    { 0x1301, 0x97d0, 0x0000, 0x155e0111 },
+    { 0x1301, 0x97d0, 0x0000, 0x155f0111 },
+    { 0x1301, 0x97d0, 0x0000, 0x15600111 },
+    { 0x1301, 0x97d0, 0x0000, 0x15610111 },
+    { 0x1301, 0x97d0, 0x0000, 0x15620111 },
+    { 0x1301, 0x97d0, 0x0000, 0x15630111 },
+    { 0x1301, 0x97d0, 0x0000, 0x15640111 },
+    { 0x1301, 0x97d0, 0x0000, 0x15650111 },
+    { 0x1301, 0x97d0, 0x0000, 0x15660111 },
+    { 0x1301, 0x97d0, 0x0000, 0x15670111 },
+    { 0x1301, 0x97d0, 0x0000, 0x15680111 },
+    { 0x1301, 0x97d0, 0x0000, 0x15690111 },
+    { 0x1301, 0x97d0, 0x0000, 0x156a0111 },
+    { 0x1301, 0x97d0, 0x0000, 0x156b0111 },
+    { 0x1301, 0x97d0, 0x0000, 0x156c0111 },
+    { 0x1301, 0x97d0, 0x0000, 0x156d0111 },
+    { 0x1301, 0x97d0, 0x0000, 0x156e0111 },
+    { 0x1301, 0x97d0, 0x0000, 0x156f0111 },
+    { 0x1301, 0x97d0, 0x0000, 0x15700111 },
+    { 0x1301, 0x97d0, 0x0000, 0x15710111 },
+    { 0x1301, 0x97d0, 0x0000, 0x15720111 },
+    { 0x1301, 0x97d0, 0x0000, 0x15730111 },
+    { 0x1301, 0x97d0, 0x0000, 0x15740111 },
+    { 0x1301, 0x97d0, 0x0000, 0x15750111 },
+    { 0x1301, 0x97d0, 0x0000, 0x15760111 },
+    { 0x1301, 0x97d0, 0x0000, 0x15770111 },
+    { 0x1301, 0x0008, 0x0000, 0x15780111 },
+    { 0x1301, 0x0008, 0x0000, 0x15790111 },
+    { 0x1301, 0x0008, 0x0000, 0x157a0111 },
+    { 0x1301, 0x0008, 0x0000, 0x157b0111 },
+    { 0x1301, 0x0008, 0x0000, 0x157c0111 },
+    { 0x1301, 0x0008, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xfff8, 0xffffffff },
+    { 0x1302, 0x0000, 0xfff8, 0xffffffff },
+    { 0x1302, 0x0000, 0xfff8, 0xffffffff },
+    { 0x1302, 0x0000, 0xfff8, 0xffffffff },
+    { 0x1302, 0x0000, 0xfff8, 0xffffffff },
+    { 0x1302, 0x0000, 0xfff8, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    /* block 20 */
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x157d0111 },
+    { 0x1300, 0x0000, 0x0000, 0x157e0111 },
+    { 0x1300, 0x0000, 0x0000, 0x157f0111 },
+    { 0x1300, 0x0000, 0x0000, 0x15800111 },
+    { 0x1300, 0x0000, 0x0000, 0x15810111 },
+    { 0x1300, 0x0000, 0x0000, 0x15820111 },
+    { 0x1300, 0x0000, 0x0000, 0x15830111 },
+    { 0x1300, 0x0000, 0x0000, 0x15840111 },
+    { 0x1300, 0x0000, 0x0000, 0x15850111 },
+    { 0x1300, 0x0000, 0x0000, 0x15860111 },
+    { 0x1300, 0x0000, 0x0000, 0x15870111 },
+    { 0x1300, 0x0000, 0x0000, 0x15880111 },
+    { 0x1300, 0x0000, 0x0000, 0x15890111 },
+    { 0x1300, 0x0000, 0x0000, 0x158a0111 },
+    { 0x1300, 0x0000, 0x0000, 0x158b0111 },
+    { 0x1300, 0x0000, 0x0000, 0x158c0111 },
+    { 0x1300, 0x0000, 0x0000, 0x158d0111 },
+    { 0x1300, 0x0000, 0x0000, 0x158e0111 },
+    { 0x1300, 0x0000, 0x0000, 0x158f0111 },
+    { 0x1300, 0x0000, 0x0000, 0x15900111 },
+    { 0x1300, 0x0000, 0x0000, 0x15910111 },
+    { 0x1300, 0x0000, 0x0000, 0x15920111 },
+    { 0x1300, 0x0000, 0x0000, 0x15930111 },
+    { 0x1300, 0x0000, 0x0000, 0x15940111 },
+    { 0x1300, 0x0000, 0x0000, 0x15950111 },
+    { 0x1300, 0x0000, 0x0000, 0x15960111 },
+    { 0x1300, 0x0000, 0x0000, 0x15970111 },
+    { 0x1300, 0x0000, 0x0000, 0x15980111 },
+    { 0x1300, 0x0000, 0x0000, 0x15990111 },
+    { 0x1300, 0x0000, 0x0000, 0x159a0111 },
+    { 0x1300, 0x0000, 0x0000, 0x159b0111 },
+    { 0x1300, 0x0000, 0x0000, 0x159c0111 },
+    { 0x1300, 0x0000, 0x0000, 0x159d0111 },
+    { 0x1300, 0x0000, 0x0000, 0x159e0111 },
+    { 0x1300, 0x0000, 0x0000, 0x159f0111 },
+    { 0x1300, 0x0000, 0x0000, 0x15a00111 },
+    { 0x1300, 0x0000, 0x0000, 0x15a10111 },
+    { 0x1300, 0x0000, 0x0000, 0x15a20111 },
+    { 0x1300, 0x0000, 0x0000, 0x15a30111 },
+    { 0x1300, 0x0000, 0x0000, 0x15a40111 },
+    { 0x1300, 0x0000, 0x0000, 0x15a50111 },
+    { 0x1300, 0x0000, 0x0000, 0x15a60111 },
+    { 0x1300, 0x0000, 0x0000, 0x15a70111 },
+    { 0x1300, 0x0000, 0x0000, 0x15a80111 },
+    { 0x1300, 0x0000, 0x0000, 0x15a90111 },
+    { 0x1300, 0x0000, 0x0000, 0x15aa0111 },
+    { 0x1300, 0x0000, 0x0000, 0x15ab0111 },
+    { 0x1300, 0x0000, 0x0000, 0x15ac0111 },
+    { 0x1300, 0x0000, 0x0000, 0x15ad0111 },
+    { 0x1300, 0x0000, 0x0000, 0x15ae0111 },
+    { 0x1300, 0x0000, 0x0000, 0x15af0111 },
+    { 0x1300, 0x0000, 0x0000, 0x15b00111 },
+    { 0x1300, 0x0000, 0x0000, 0x15b10111 },
+    { 0x1300, 0x0000, 0x0000, 0x15b20111 },
+    { 0x1300, 0x0000, 0x0000, 0x15b30111 },
+    { 0x1300, 0x0000, 0x0000, 0x15b40111 },
+    { 0x1300, 0x0000, 0x0000, 0x15b50111 },
+    { 0x1300, 0x0000, 0x0000, 0x15b60111 },
+    { 0x1300, 0x0000, 0x0000, 0x15b70111 },
+    { 0x1300, 0x0000, 0x0000, 0x15b80111 },
+    { 0x1300, 0x0000, 0x0000, 0x15b90111 },
+    { 0x1300, 0x0000, 0x0000, 0x15ba0111 },
+    { 0x1300, 0x0000, 0x0000, 0x15bb0111 },
+    { 0x1300, 0x0000, 0x0000, 0x15bc0111 },
+    { 0x1300, 0x0000, 0x0000, 0x15bd0111 },
+    { 0x1300, 0x0000, 0x0000, 0x15be0111 },
+    { 0x1300, 0x0000, 0x0000, 0x15bf0111 },
+    { 0x1300, 0x0000, 0x0000, 0x15c00111 },
+    { 0x1300, 0x0000, 0x0000, 0x15c10111 },
+    { 0x1300, 0x0000, 0x0000, 0x15c20111 },
+    { 0x1300, 0x0000, 0x0000, 0x15c30111 },
+    { 0x1300, 0x0000, 0x0000, 0x15c40111 },
+    { 0x1300, 0x0000, 0x0000, 0x15c50111 },
+    { 0x1300, 0x0000, 0x0000, 0x15c60111 },
+    { 0x1300, 0x0000, 0x0000, 0x15c70111 },
+    { 0x1300, 0x0000, 0x0000, 0x15c80111 },
+    { 0x1300, 0x0000, 0x0000, 0x15c90111 },
+    { 0x1300, 0x0000, 0x0000, 0x15ca0111 },
+    { 0x1300, 0x0000, 0x0000, 0x15cb0111 },
+    { 0x1300, 0x0000, 0x0000, 0x15cc0111 },
+    { 0x1300, 0x0000, 0x0000, 0x15cd0111 },
+    { 0x1300, 0x0000, 0x0000, 0x15ce0111 },
+    { 0x1300, 0x0000, 0x0000, 0x15cf0111 },
+    { 0x1300, 0x0000, 0x0000, 0x15d00111 },
+    { 0x1300, 0x0000, 0x0000, 0x15d10111 },
+    { 0x1300, 0x0000, 0x0000, 0x15d20111 },
+    { 0x1300, 0x0000, 0x0000, 0x15d30111 },
+    { 0x1300, 0x0000, 0x0000, 0x15d40111 },
+    { 0x1300, 0x0000, 0x0000, 0x15d50111 },
+    { 0x1300, 0x0000, 0x0000, 0x15d60111 },
+    { 0x1300, 0x0000, 0x0000, 0x15d70111 },
+    { 0x1300, 0x0000, 0x0000, 0x15d80111 },
+    { 0x1300, 0x0000, 0x0000, 0x15d90111 },
+    { 0x1300, 0x0000, 0x0000, 0x15da0111 },
+    { 0x1300, 0x0000, 0x0000, 0x15db0111 },
+    { 0x1300, 0x0000, 0x0000, 0x15dc0111 },
+    { 0x1300, 0x0000, 0x0000, 0x15dd0111 },
+    { 0x1300, 0x0000, 0x0000, 0x15de0111 },
+    { 0x1300, 0x0000, 0x0000, 0x15df0111 },
+    { 0x1300, 0x0000, 0x0000, 0x15e00111 },
+    { 0x1300, 0x0000, 0x0000, 0x15e10111 },
+    { 0x1300, 0x0000, 0x0000, 0x15e20111 },
+    { 0x1300, 0x0000, 0x0000, 0x15e30111 },
+    { 0x1300, 0x0000, 0x0000, 0x15e40111 },
+    { 0x1300, 0x0000, 0x0000, 0x15e50111 },
+    { 0x1300, 0x0000, 0x0000, 0x15e60111 },
+    { 0x1300, 0x0000, 0x0000, 0x15e70111 },
+    { 0x1300, 0x0000, 0x0000, 0x15e80111 },
+    { 0x1300, 0x0000, 0x0000, 0x15e90111 },
+    { 0x1300, 0x0000, 0x0000, 0x15ea0111 },
+    { 0x1300, 0x0000, 0x0000, 0x15eb0111 },
+    { 0x1300, 0x0000, 0x0000, 0x15ec0111 },
+    { 0x1300, 0x0000, 0x0000, 0x15ed0111 },
+    { 0x1300, 0x0000, 0x0000, 0x15ee0111 },
+    { 0x1300, 0x0000, 0x0000, 0x15ef0111 },
+    { 0x1300, 0x0000, 0x0000, 0x15f00111 },
+    { 0x1300, 0x0000, 0x0000, 0x15f10111 },
+    { 0x1300, 0x0000, 0x0000, 0x15f20111 },
+    { 0x1300, 0x0000, 0x0000, 0x15f30111 },
+    { 0x1300, 0x0000, 0x0000, 0x15f40111 },
+    { 0x1300, 0x0000, 0x0000, 0x15f50111 },
+    { 0x1300, 0x0000, 0x0000, 0x15f60111 },
+    { 0x1300, 0x0000, 0x0000, 0x15f70111 },
+    { 0x1300, 0x0000, 0x0000, 0x15f80111 },
+    { 0x1300, 0x0000, 0x0000, 0x15f90111 },
+    { 0x1300, 0x0000, 0x0000, 0x15fa0111 },
+    { 0x1300, 0x0000, 0x0000, 0x15fb0111 },
+    { 0x1300, 0x0000, 0x0000, 0x15fc0111 },
+    { 0x1300, 0x0000, 0x0000, 0x15fd0111 },
+    { 0x1300, 0x0000, 0x0000, 0x15fe0111 },
+    { 0x1300, 0x0000, 0x0000, 0x15ff0111 },
+    { 0x1300, 0x0000, 0x0000, 0x16000111 },
+    { 0x1300, 0x0000, 0x0000, 0x16010111 },
+    { 0x1300, 0x0000, 0x0000, 0x16020111 },
+    { 0x1300, 0x0000, 0x0000, 0x16030111 },
+    { 0x1300, 0x0000, 0x0000, 0x16040111 },
+    { 0x1300, 0x0000, 0x0000, 0x16050111 },
+    { 0x1300, 0x0000, 0x0000, 0x16060111 },
+    { 0x1300, 0x0000, 0x0000, 0x16070111 },
+    { 0x1300, 0x0000, 0x0000, 0x16080111 },
+    { 0x1300, 0x0000, 0x0000, 0x16090111 },
+    { 0x1300, 0x0000, 0x0000, 0x160a0111 },
+    { 0x1300, 0x0000, 0x0000, 0x160b0111 },
+    { 0x1300, 0x0000, 0x0000, 0x160c0111 },
+    { 0x1300, 0x0000, 0x0000, 0x160d0111 },
+    { 0x1300, 0x0000, 0x0000, 0x160e0111 },
+    { 0x1300, 0x0000, 0x0000, 0x160f0111 },
+    { 0x1300, 0x0000, 0x0000, 0x16100111 },
+    { 0x1300, 0x0000, 0x0000, 0x16110111 },
+    { 0x1300, 0x0000, 0x0000, 0x16120111 },
+    { 0x1300, 0x0000, 0x0000, 0x16130111 },
+    { 0x1300, 0x0000, 0x0000, 0x16140111 },
+    { 0x1300, 0x0000, 0x0000, 0x16150111 },
+    { 0x1300, 0x0000, 0x0000, 0x16160111 },
+    { 0x1300, 0x0000, 0x0000, 0x16170111 },
+    { 0x1300, 0x0000, 0x0000, 0x16180111 },
+    { 0x1300, 0x0000, 0x0000, 0x16190111 },
+    { 0x1300, 0x0000, 0x0000, 0x161a0111 },
+    { 0x1300, 0x0000, 0x0000, 0x161b0111 },
+    { 0x1300, 0x0000, 0x0000, 0x161c0111 },
+    { 0x1300, 0x0000, 0x0000, 0x161d0111 },
+    { 0x1300, 0x0000, 0x0000, 0x161e0111 },
+    { 0x1300, 0x0000, 0x0000, 0x161f0111 },
+    { 0x1300, 0x0000, 0x0000, 0x16200111 },
+    { 0x1300, 0x0000, 0x0000, 0x16210111 },
+    { 0x1300, 0x0000, 0x0000, 0x16220111 },
+    { 0x1300, 0x0000, 0x0000, 0x16230111 },
+    { 0x1300, 0x0000, 0x0000, 0x16240111 },
+    { 0x1300, 0x0000, 0x0000, 0x16250111 },
+    { 0x1300, 0x0000, 0x0000, 0x16260111 },
+    { 0x1300, 0x0000, 0x0000, 0x16270111 },
+    { 0x1300, 0x0000, 0x0000, 0x16280111 },
+    { 0x1300, 0x0000, 0x0000, 0x16290111 },
+    { 0x1300, 0x0000, 0x0000, 0x162a0111 },
+    { 0x1300, 0x0000, 0x0000, 0x162b0111 },
+    { 0x1300, 0x0000, 0x0000, 0x162c0111 },
+    { 0x1300, 0x0000, 0x0000, 0x162d0111 },
+    { 0x1300, 0x0000, 0x0000, 0x162e0111 },
+    { 0x1300, 0x0000, 0x0000, 0x162f0111 },
+    { 0x1300, 0x0000, 0x0000, 0x16300111 },
+    { 0x1300, 0x0000, 0x0000, 0x16310111 },
+    { 0x1300, 0x0000, 0x0000, 0x16320111 },
+    { 0x1300, 0x0000, 0x0000, 0x16330111 },
+    { 0x1300, 0x0000, 0x0000, 0x16340111 },
+    { 0x1300, 0x0000, 0x0000, 0x16350111 },
+    { 0x1300, 0x0000, 0x0000, 0x16360111 },
+    { 0x1300, 0x0000, 0x0000, 0x16370111 },
+    { 0x1300, 0x0000, 0x0000, 0x16380111 },
+    { 0x1300, 0x0000, 0x0000, 0x16390111 },
+    { 0x1300, 0x0000, 0x0000, 0x163a0111 },
+    { 0x1300, 0x0000, 0x0000, 0x163b0111 },
+    { 0x1300, 0x0000, 0x0000, 0x163c0111 },
+    { 0x1300, 0x0000, 0x0000, 0x163d0111 },
+    { 0x1300, 0x0000, 0x0000, 0x163e0111 },
+    { 0x1300, 0x0000, 0x0000, 0x163f0111 },
+    { 0x1300, 0x0000, 0x0000, 0x16400111 },
+    { 0x1300, 0x0000, 0x0000, 0x16410111 },
+    { 0x1300, 0x0000, 0x0000, 0x16420111 },
+    { 0x1300, 0x0000, 0x0000, 0x16430111 },
+    { 0x1300, 0x0000, 0x0000, 0x16440111 },
+    { 0x1300, 0x0000, 0x0000, 0x16450111 },
+    { 0x1300, 0x0000, 0x0000, 0x16460111 },
+    { 0x1300, 0x0000, 0x0000, 0x16470111 },
+    { 0x1300, 0x0000, 0x0000, 0x16480111 },
+    { 0x1300, 0x0000, 0x0000, 0x16490111 },
+    { 0x1300, 0x0000, 0x0000, 0x164a0111 },
+    { 0x1300, 0x0000, 0x0000, 0x164b0111 },
+    { 0x1300, 0x0000, 0x0000, 0x164c0111 },
+    { 0x1300, 0x0000, 0x0000, 0x164d0111 },
+    { 0x1300, 0x0000, 0x0000, 0x164e0111 },
+    { 0x1300, 0x0000, 0x0000, 0x164f0111 },
+    { 0x1300, 0x0000, 0x0000, 0x16500111 },
+    { 0x1300, 0x0000, 0x0000, 0x16510111 },
+    { 0x1300, 0x0000, 0x0000, 0x16520111 },
+    { 0x1300, 0x0000, 0x0000, 0x16530111 },
+    { 0x1300, 0x0000, 0x0000, 0x16540111 },
+    { 0x1300, 0x0000, 0x0000, 0x16550111 },
+    { 0x1300, 0x0000, 0x0000, 0x16560111 },
+    { 0x1300, 0x0000, 0x0000, 0x16570111 },
+    { 0x1300, 0x0000, 0x0000, 0x16580111 },
+    { 0x1300, 0x0000, 0x0000, 0x16590111 },
+    { 0x1300, 0x0000, 0x0000, 0x165a0111 },
+    { 0x1300, 0x0000, 0x0000, 0x165b0111 },
+    { 0x1300, 0x0000, 0x0000, 0x165c0111 },
+    { 0x1300, 0x0000, 0x0000, 0x165d0111 },
+    { 0x1300, 0x0000, 0x0000, 0x165e0111 },
+    { 0x1300, 0x0000, 0x0000, 0x165f0111 },
+    { 0x1300, 0x0000, 0x0000, 0x16600111 },
+    { 0x1300, 0x0000, 0x0000, 0x16610111 },
+    { 0x1300, 0x0000, 0x0000, 0x16620111 },
+    { 0x1300, 0x0000, 0x0000, 0x16630111 },
+    { 0x1300, 0x0000, 0x0000, 0x16640111 },
+    { 0x1300, 0x0000, 0x0000, 0x16650111 },
+    { 0x1300, 0x0000, 0x0000, 0x16660111 },
+    { 0x1300, 0x0000, 0x0000, 0x16670111 },
+    { 0x1300, 0x0000, 0x0000, 0x16680111 },
+    { 0x1300, 0x0000, 0x0000, 0x16690111 },
+    { 0x1300, 0x0000, 0x0000, 0x166a0111 },
+    { 0x1300, 0x0000, 0x0000, 0x166b0111 },
+    { 0x1300, 0x0000, 0x0000, 0x166c0111 },
+    { 0x1300, 0x0000, 0x0000, 0x166d0111 },
+    { 0x1300, 0x0000, 0x0000, 0x166e0111 },
+    { 0x1300, 0x0000, 0x0000, 0x166f0111 },
+    { 0x1300, 0x0000, 0x0000, 0x16700111 },
+    { 0x1300, 0x0000, 0x0000, 0x16710111 },
+    { 0x1300, 0x0000, 0x0000, 0x16720111 },
+    { 0x1300, 0x0000, 0x0000, 0x16730111 },
+    { 0x1300, 0x0000, 0x0000, 0x16740111 },
+    { 0x1300, 0x0000, 0x0000, 0x16750111 },
+    { 0x1300, 0x0000, 0x0000, 0x16760111 },
+    { 0x1300, 0x0000, 0x0000, 0x16770111 },
+    { 0x1300, 0x0000, 0x0000, 0x16780111 },
+    { 0x1300, 0x0000, 0x0000, 0x16790111 },
+    { 0x1300, 0x0000, 0x0000, 0x167a0111 },
+    { 0x1300, 0x0000, 0x0000, 0x167b0111 },
+    /* block 21 */
+    { 0x1300, 0x0000, 0x0000, 0x167c0111 },
+    { 0x1300, 0x0000, 0x0000, 0x167d0111 },
+    { 0x1300, 0x0000, 0x0000, 0x167e0111 },
+    { 0x1300, 0x0000, 0x0000, 0x167f0111 },
+    { 0x1300, 0x0000, 0x0000, 0x16800111 },
+    { 0x1300, 0x0000, 0x0000, 0x16810111 },
+    { 0x1300, 0x0000, 0x0000, 0x16820111 },
+    { 0x1300, 0x0000, 0x0000, 0x16830111 },
+    { 0x1300, 0x0000, 0x0000, 0x16840111 },
+    { 0x1300, 0x0000, 0x0000, 0x16850111 },
+    { 0x1300, 0x0000, 0x0000, 0x16860111 },
+    { 0x1300, 0x0000, 0x0000, 0x16870111 },
+    { 0x1300, 0x0000, 0x0000, 0x16880111 },
+    { 0x1300, 0x0000, 0x0000, 0x16890111 },
+    { 0x1300, 0x0000, 0x0000, 0x168a0111 },
+    { 0x1300, 0x0000, 0x0000, 0x168b0111 },
+    { 0x1300, 0x0000, 0x0000, 0x168c0111 },
+    { 0x1300, 0x0000, 0x0000, 0x168d0111 },
+    { 0x1300, 0x0000, 0x0000, 0x168e0111 },
+    { 0x1300, 0x0000, 0x0000, 0x168f0111 },
+    { 0x1300, 0x0000, 0x0000, 0x16900111 },
+    { 0x1300, 0x0000, 0x0000, 0x16910111 },
+    { 0x1300, 0x0000, 0x0000, 0x16920111 },
+    { 0x1300, 0x0000, 0x0000, 0x16930111 },
+    { 0x1300, 0x0000, 0x0000, 0x16940111 },
+    { 0x1300, 0x0000, 0x0000, 0x16950111 },
+    { 0x1300, 0x0000, 0x0000, 0x16960111 },
+    { 0x1300, 0x0000, 0x0000, 0x16970111 },
+    { 0x1300, 0x0000, 0x0000, 0x16980111 },
+    { 0x1300, 0x0000, 0x0000, 0x16990111 },
+    { 0x1300, 0x0000, 0x0000, 0x169a0111 },
+    { 0x1300, 0x0000, 0x0000, 0x169b0111 },
+    { 0x1300, 0x0000, 0x0000, 0x169c0111 },
+    { 0x1300, 0x0000, 0x0000, 0x169d0111 },
+    { 0x1300, 0x0000, 0x0000, 0x169e0111 },
+    { 0x1300, 0x0000, 0x0000, 0x169f0111 },
+    { 0x1300, 0x0000, 0x0000, 0x16a00111 },
+    { 0x1300, 0x0000, 0x0000, 0x16a10111 },
+    { 0x1300, 0x0000, 0x0000, 0x16a20111 },
+    { 0x1300, 0x0000, 0x0000, 0x16a30111 },
+    { 0x1300, 0x0000, 0x0000, 0x16a40111 },
+    { 0x1300, 0x0000, 0x0000, 0x16a50111 },
+    { 0x1300, 0x0000, 0x0000, 0x16a60111 },
+    { 0x1300, 0x0000, 0x0000, 0x16a70111 },
+    { 0x1300, 0x0000, 0x0000, 0x16a80111 },
+    { 0x1300, 0x0000, 0x0000, 0x16a90111 },
+    { 0x1300, 0x0000, 0x0000, 0x16aa0111 },
+    { 0x1300, 0x0000, 0x0000, 0x16ab0111 },
+    { 0x1300, 0x0000, 0x0000, 0x16ac0111 },
+    { 0x1300, 0x0000, 0x0000, 0x16ad0111 },
+    { 0x1300, 0x0000, 0x0000, 0x16ae0111 },
+    { 0x1300, 0x0000, 0x0000, 0x16af0111 },
+    { 0x1300, 0x0000, 0x0000, 0x16b00111 },
+    { 0x1300, 0x0000, 0x0000, 0x16b10111 },
+    { 0x1300, 0x0000, 0x0000, 0x16b20111 },
+    { 0x1300, 0x0000, 0x0000, 0x16b30111 },
+    { 0x1300, 0x0000, 0x0000, 0x16b40111 },
+    { 0x1300, 0x0000, 0x0000, 0x16b50111 },
+    { 0x1300, 0x0000, 0x0000, 0x16b60111 },
+    { 0x1300, 0x0000, 0x0000, 0x16b70111 },
+    { 0x1300, 0x0000, 0x0000, 0x16b80111 },
+    { 0x1300, 0x0000, 0x0000, 0x16b90111 },
+    { 0x1300, 0x0000, 0x0000, 0x16ba0111 },
+    { 0x1300, 0x0000, 0x0000, 0x16bb0111 },
+    { 0x1300, 0x0000, 0x0000, 0x16bc0111 },
+    { 0x1300, 0x0000, 0x0000, 0x16bd0111 },
+    { 0x1300, 0x0000, 0x0000, 0x16be0111 },
+    { 0x1300, 0x0000, 0x0000, 0x16bf0111 },
+    { 0x1300, 0x0000, 0x0000, 0x16c00111 },
+    { 0x1300, 0x0000, 0x0000, 0x16c10111 },
+    { 0x1300, 0x0000, 0x0000, 0x16c20111 },
+    { 0x1300, 0x0000, 0x0000, 0x16c30111 },
+    { 0x1300, 0x0000, 0x0000, 0x16c40111 },
+    { 0x1300, 0x0000, 0x0000, 0x16c50111 },
+    { 0x1300, 0x0000, 0x0000, 0x16c60111 },
+    { 0x1300, 0x0000, 0x0000, 0x16c70111 },
+    { 0x1300, 0x0000, 0x0000, 0x16c80111 },
+    { 0x1300, 0x0000, 0x0000, 0x16c90111 },
+    { 0x1300, 0x0000, 0x0000, 0x16ca0111 },
+    { 0x1300, 0x0000, 0x0000, 0x16cb0111 },
+    { 0x1300, 0x0000, 0x0000, 0x16cc0111 },
+    { 0x1300, 0x0000, 0x0000, 0x16cd0111 },
+    { 0x1300, 0x0000, 0x0000, 0x16ce0111 },
+    { 0x1300, 0x0000, 0x0000, 0x16cf0111 },
+    { 0x1300, 0x0000, 0x0000, 0x16d00111 },
+    { 0x1300, 0x0000, 0x0000, 0x16d10111 },
+    { 0x1300, 0x0000, 0x0000, 0x16d20111 },
+    { 0x1300, 0x0000, 0x0000, 0x16d30111 },
+    { 0x1300, 0x0000, 0x0000, 0x16d40111 },
+    { 0x1300, 0x0000, 0x0000, 0x16d50111 },
+    { 0x1300, 0x0000, 0x0000, 0x16d60111 },
+    { 0x1300, 0x0000, 0x0000, 0x16d70111 },
+    { 0x1300, 0x0000, 0x0000, 0x16d80111 },
+    { 0x1300, 0x0000, 0x0000, 0x16d90111 },
+    { 0x1300, 0x0000, 0x0000, 0x16da0111 },
+    { 0x1300, 0x0000, 0x0000, 0x16db0111 },
+    { 0x1300, 0x0000, 0x0000, 0x16dc0111 },
+    { 0x1300, 0x0000, 0x0000, 0x16dd0111 },
+    { 0x1300, 0x0000, 0x0000, 0x16de0111 },
+    { 0x1300, 0x0000, 0x0000, 0x16df0111 },
+    { 0x1300, 0x0000, 0x0000, 0x16e00111 },
+    { 0x1300, 0x0000, 0x0000, 0x16e10111 },
+    { 0x1300, 0x0000, 0x0000, 0x16e20111 },
+    { 0x1300, 0x0000, 0x0000, 0x16e30111 },
+    { 0x1300, 0x0000, 0x0000, 0x16e40111 },
+    { 0x1300, 0x0000, 0x0000, 0x16e50111 },
+    { 0x1300, 0x0000, 0x0000, 0x16e60111 },
+    { 0x1300, 0x0000, 0x0000, 0x16e70111 },
+    { 0x1300, 0x0000, 0x0000, 0x16e80111 },
+    { 0x1300, 0x0000, 0x0000, 0x16e90111 },
+    { 0x1300, 0x0000, 0x0000, 0x16ea0111 },
+    { 0x1300, 0x0000, 0x0000, 0x16eb0111 },
+    { 0x1300, 0x0000, 0x0000, 0x16ec0111 },
+    { 0x1300, 0x0000, 0x0000, 0x16ed0111 },
+    { 0x1300, 0x0000, 0x0000, 0x16ee0111 },
+    { 0x1300, 0x0000, 0x0000, 0x16ef0111 },
+    { 0x1300, 0x0000, 0x0000, 0x16f00111 },
+    { 0x1300, 0x0000, 0x0000, 0x16f10111 },
+    { 0x1300, 0x0000, 0x0000, 0x16f20111 },
+    { 0x1300, 0x0000, 0x0000, 0x16f30111 },
+    { 0x1300, 0x0000, 0x0000, 0x16f40111 },
+    { 0x1300, 0x0000, 0x0000, 0x16f50111 },
+    { 0x1300, 0x0000, 0x0000, 0x16f60111 },
+    { 0x1300, 0x0000, 0x0000, 0x16f70111 },
+    { 0x1300, 0x0000, 0x0000, 0x172a0111 },
+    { 0x1300, 0x0000, 0x0000, 0x16f80111 },
+    { 0x1300, 0x0000, 0x0000, 0x16fa0111 },
+    { 0x1300, 0x0000, 0x0000, 0x16fb0111 },
+    { 0x1300, 0x0000, 0x0000, 0x16fc0111 },
+    { 0x1300, 0x0000, 0x0000, 0x16fd0111 },
+    { 0x1300, 0x0000, 0x0000, 0x16fe0111 },
+    { 0x1300, 0x0000, 0x0000, 0x16ff0111 },
+    { 0x1300, 0x0000, 0x0000, 0x17000111 },
+    { 0x1300, 0x0000, 0x0000, 0x17010111 },
+    { 0x1300, 0x0000, 0x0000, 0x17020111 },
+    { 0x1300, 0x0000, 0x0000, 0x17030111 },
+    { 0x1300, 0x0000, 0x0000, 0x17040111 },
+    { 0x1300, 0x0000, 0x0000, 0x17050111 },
+    { 0x1300, 0x0000, 0x0000, 0x17060111 },
+    { 0x1300, 0x0000, 0x0000, 0x17070111 },
+    { 0x1300, 0x0000, 0x0000, 0x17080111 },
+    { 0x1300, 0x0000, 0x0000, 0x17090111 },
+    { 0x1300, 0x0000, 0x0000, 0x170b0111 },
+    { 0x1300, 0x0000, 0x0000, 0x170c0111 },
+    { 0x1300, 0x0000, 0x0000, 0x170d0111 },
+    { 0x1300, 0x0000, 0x0000, 0x170e0111 },
+    { 0x1300, 0x0000, 0x0000, 0x170f0111 },
+    { 0x1300, 0x0000, 0x0000, 0x17100111 },
+    { 0x1300, 0x0000, 0x0000, 0x17110111 },
+    { 0x1300, 0x0000, 0x0000, 0x17120111 },
+    { 0x1300, 0x0000, 0x0000, 0x17190111 },
+    { 0x1300, 0x0000, 0x0000, 0x171a0111 },
+    { 0x1300, 0x0000, 0x0000, 0x171b0111 },
+    { 0x1300, 0x0000, 0x0000, 0x171c0111 },
+    { 0x1300, 0x0000, 0x0000, 0x171d0111 },
+    { 0x1300, 0x0000, 0x0000, 0x171e0111 },
+    { 0x1300, 0x0000, 0x0000, 0x171f0111 },
+    { 0x1300, 0x0000, 0x0000, 0x17200111 },
+    { 0x1300, 0x0000, 0x0000, 0x17210111 },
+    { 0x1300, 0x0000, 0x0000, 0x17220111 },
+    { 0x1300, 0x0000, 0x0000, 0x17230111 },
+    { 0x1300, 0x0000, 0x0000, 0x17240111 },
+    { 0x1300, 0x0000, 0x0000, 0x17250111 },
+    { 0x1300, 0x0000, 0x0000, 0x17260111 },
+    { 0x1300, 0x0000, 0x0000, 0x17270111 },
+    { 0x1300, 0x0000, 0x0000, 0x17280111 },
+    { 0x1300, 0x0000, 0x0000, 0x17290111 },
+    { 0x1300, 0x0000, 0x0000, 0x172b0111 },
+    { 0x1300, 0x0000, 0x0000, 0x172c0111 },
+    { 0x1300, 0x0000, 0x0000, 0x172d0111 },
+    { 0x1300, 0x0000, 0x0000, 0x172e0111 },
+    { 0x1300, 0x0000, 0x0000, 0x172f0111 },
+    { 0x1300, 0x0000, 0x0000, 0x17300111 },
+    { 0x1300, 0x0000, 0x0000, 0x17310111 },
+    { 0x1300, 0x0000, 0x0000, 0x17320111 },
+    { 0x1300, 0x0000, 0x0000, 0x17330111 },
+    { 0x1300, 0x0000, 0x0000, 0x17340111 },
+    { 0x1300, 0x0000, 0x0000, 0x17350111 },
+    { 0x1300, 0x0000, 0x0000, 0x17360111 },
+    { 0x1300, 0x0000, 0x0000, 0x17370111 },
+    { 0x1300, 0x0000, 0x0000, 0x17380111 },
+    { 0x1300, 0x0000, 0x0000, 0x17390111 },
+    { 0x1300, 0x0000, 0x0000, 0x173a0111 },
+    { 0x1300, 0x0000, 0x0000, 0x173b0111 },
+    { 0x1300, 0x0000, 0x0000, 0x173c0111 },
+    { 0x1300, 0x0000, 0x0000, 0x173d0111 },
+    { 0x1300, 0x0000, 0x0000, 0x173e0111 },
+    { 0x1300, 0x0000, 0x0000, 0x173f0111 },
+    { 0x1300, 0x0000, 0x0000, 0x17400111 },
+    { 0x1300, 0x0000, 0x0000, 0x17410111 },
+    { 0x1300, 0x0000, 0x0000, 0x17420111 },
+    { 0x1300, 0x0000, 0x0000, 0x17430111 },
+    { 0x1300, 0x0000, 0x0000, 0x17440111 },
+    { 0x1300, 0x0000, 0x0000, 0x17450111 },
+    { 0x1300, 0x0000, 0x0000, 0x17460111 },
+    { 0x1300, 0x0000, 0x0000, 0x17470111 },
+    { 0x1300, 0x0000, 0x0000, 0x17480111 },
+    { 0x1300, 0x0000, 0x0000, 0x17490111 },
+    { 0x1300, 0x0000, 0x0000, 0x174a0111 },
+    { 0x1300, 0x0000, 0x0000, 0x174b0111 },
+    { 0x1300, 0x0000, 0x0000, 0x174c0111 },
+    { 0x1300, 0x0000, 0x0000, 0x174d0111 },
+    { 0x1300, 0x0000, 0x0000, 0x174e0111 },
+    { 0x1300, 0x0000, 0x0000, 0x174f0111 },
+    { 0x1300, 0x0000, 0x0000, 0x17500111 },
+    { 0x1300, 0x0000, 0x0000, 0x17510111 },
+    { 0x1300, 0x0000, 0x0000, 0x17520111 },
+    { 0x1300, 0x0000, 0x0000, 0x17530111 },
+    { 0x1300, 0x0000, 0x0000, 0x17540111 },
+    { 0x1300, 0x0000, 0x0000, 0x17550111 },
+    { 0x1300, 0x0000, 0x0000, 0x17560111 },
+    { 0x1300, 0x0000, 0x0000, 0x17570111 },
+    { 0x1300, 0x0000, 0x0000, 0x17580111 },
+    { 0x1300, 0x0000, 0x0000, 0x17590111 },
+    { 0x1300, 0x0000, 0x0000, 0x175a0111 },
+    { 0x1300, 0x0000, 0x0000, 0x175b0111 },
+    { 0x1300, 0x0000, 0x0000, 0x175c0111 },
+    { 0x1300, 0x0000, 0x0000, 0x175d0111 },
+    { 0x1300, 0x0000, 0x0000, 0x175e0111 },
+    { 0x1300, 0x0000, 0x0000, 0x175f0111 },
+    { 0x1300, 0x0000, 0x0000, 0x17600111 },
+    { 0x1300, 0x0000, 0x0000, 0x17610111 },
+    { 0x1300, 0x0000, 0x0000, 0x17620111 },
+    { 0x1300, 0x0000, 0x0000, 0x17630111 },
+    { 0x1300, 0x0000, 0x0000, 0x17640111 },
+    { 0x1300, 0x0000, 0x0000, 0x17650111 },
+    { 0x1300, 0x0000, 0x0000, 0x17660111 },
+    { 0x1300, 0x0000, 0x0000, 0x17670111 },
+    { 0x1300, 0x0000, 0x0000, 0x17680111 },
+    { 0x1300, 0x0000, 0x0000, 0x17690111 },
+    { 0x1300, 0x0000, 0x0000, 0x176a0111 },
+    { 0x1300, 0x0000, 0x0000, 0x176b0111 },
+    { 0x1300, 0x0000, 0x0000, 0x176c0111 },
+    { 0x1300, 0x0000, 0x0000, 0x176d0111 },
+    { 0x1300, 0x0000, 0x0000, 0x176e0111 },
+    { 0x1300, 0x0000, 0x0000, 0x176f0111 },
+    { 0x1300, 0x0000, 0x0000, 0x17700111 },
+    { 0x1300, 0x0000, 0x0000, 0x17710111 },
+    { 0x1300, 0x0000, 0x0000, 0x17720111 },
+    { 0x1300, 0x0000, 0x0000, 0x17730111 },
+    { 0x1300, 0x0000, 0x0000, 0x17740111 },
+    { 0x1300, 0x0000, 0x0000, 0x17750111 },
+    { 0x1300, 0x0000, 0x0000, 0x17760111 },
+    { 0x1300, 0x0000, 0x0000, 0x17770111 },
+    { 0x1300, 0x0000, 0x0000, 0x17780111 },
+    { 0x1300, 0x0000, 0x0000, 0x17790111 },
+    { 0x1300, 0x0000, 0x0000, 0x177a0111 },
+    { 0x1300, 0x0000, 0x0000, 0x177b0111 },
+    { 0x1300, 0x0000, 0x0000, 0x177c0111 },
+    { 0x1300, 0x0000, 0x0000, 0x177d0111 },
+    { 0x1300, 0x0000, 0x0000, 0x177e0111 },
+    { 0x1300, 0x0000, 0x0000, 0x177f0111 },
+    { 0x1300, 0x0000, 0x0000, 0x17800111 },
+    { 0x1300, 0x0000, 0x0000, 0x17810111 },
+    { 0x1300, 0x0000, 0x0000, 0x17820111 },
+    { 0x1300, 0x0000, 0x0000, 0x17830111 },
+    /* block 22 */
+    { 0x1300, 0x0000, 0x0000, 0x17840111 },
+    { 0x1300, 0x0000, 0x0000, 0x17850111 },
+    { 0x1300, 0x0000, 0x0000, 0x17860111 },
+    { 0x1300, 0x0000, 0x0000, 0x17870111 },
+    { 0x1300, 0x0000, 0x0000, 0x17880111 },
+    { 0x1300, 0x0000, 0x0000, 0x17890111 },
+    { 0x1300, 0x0000, 0x0000, 0x178a0111 },
+    { 0x1300, 0x0000, 0x0000, 0x178b0111 },
+    { 0x1300, 0x0000, 0x0000, 0x178c0111 },
+    { 0x1300, 0x0000, 0x0000, 0x178d0111 },
+    { 0x1300, 0x0000, 0x0000, 0x178e0111 },
+    { 0x1300, 0x0000, 0x0000, 0x178f0111 },
+    { 0x1300, 0x0000, 0x0000, 0x17900111 },
+    { 0x1300, 0x0000, 0x0000, 0x17910111 },
+    { 0x1300, 0x0000, 0x0000, 0x17920111 },
+    { 0x1300, 0x0000, 0x0000, 0x17930111 },
+    { 0x1300, 0x0000, 0x0000, 0x17940111 },
+    { 0x1300, 0x0000, 0x0000, 0x17950111 },
+    { 0x1300, 0x0000, 0x0000, 0x17960111 },
+    { 0x1300, 0x0000, 0x0000, 0x17970111 },
+    { 0x1300, 0x0000, 0x0000, 0x17980111 },
+    { 0x1300, 0x0000, 0x0000, 0x17990111 },
+    { 0x1300, 0x0000, 0x0000, 0x179a0111 },
+    { 0x1300, 0x0000, 0x0000, 0x179b0111 },
+    { 0x1300, 0x0000, 0x0000, 0x179c0111 },
+    { 0x1300, 0x0000, 0x0000, 0x179d0111 },
+    { 0x1300, 0x0000, 0x0000, 0x179e0111 },
+    { 0x1300, 0x0000, 0x0000, 0x179f0111 },
+    { 0x1300, 0x0000, 0x0000, 0x17a00111 },
+    { 0x1300, 0x0000, 0x0000, 0x17a10111 },
+    { 0x1300, 0x0000, 0x0000, 0x17a20111 },
+    { 0x1300, 0x0000, 0x0000, 0x17a30111 },
+    { 0x1300, 0x0000, 0x0000, 0x17a40111 },
+    { 0x1300, 0x0000, 0x0000, 0x17a50111 },
+    { 0x1300, 0x0000, 0x0000, 0x17a60111 },
+    { 0x1300, 0x0000, 0x0000, 0x17a70111 },
+    { 0x1300, 0x0000, 0x0000, 0x17a80111 },
+    { 0x1300, 0x0000, 0x0000, 0x17a90111 },
+    { 0x1300, 0x0000, 0x0000, 0x17aa0111 },
+    { 0x1300, 0x0000, 0x0000, 0x17ab0111 },
+    { 0x1300, 0x0000, 0x0000, 0x17ac0111 },
+    { 0x1300, 0x0000, 0x0000, 0x17ad0111 },
+    { 0x1300, 0x0000, 0x0000, 0x17ae0111 },
+    { 0x1300, 0x0000, 0x0000, 0x17af0111 },
+    { 0x1300, 0x0000, 0x0000, 0x17b00111 },
+    { 0x1300, 0x0000, 0x0000, 0x17b10111 },
+    { 0x1300, 0x0000, 0x0000, 0x17b20111 },
+    { 0x1300, 0x0000, 0x0000, 0x17b30111 },
+    { 0x1300, 0x0000, 0x0000, 0x17b40111 },
+    { 0x1300, 0x0000, 0x0000, 0x17b50111 },
+    { 0x1300, 0x0000, 0x0000, 0x17b60111 },
+    { 0x1300, 0x0000, 0x0000, 0x17b70111 },
+    { 0x1300, 0x0000, 0x0000, 0x17b80111 },
+    { 0x1300, 0x0000, 0x0000, 0x17b90111 },
+    { 0x1300, 0x0000, 0x0000, 0x17ba0111 },
+    { 0x1300, 0x0000, 0x0000, 0x17bb0111 },
+    { 0x1300, 0x0000, 0x0000, 0x17bc0111 },
+    { 0x1300, 0x0000, 0x0000, 0x17bd0111 },
+    { 0x1300, 0x0000, 0x0000, 0x17be0111 },
+    { 0x1300, 0x0000, 0x0000, 0x17bf0111 },
+    { 0x1300, 0x0000, 0x0000, 0x17c00111 },
+    { 0x1300, 0x0000, 0x0000, 0x17c10111 },
+    { 0x1300, 0x0000, 0x0000, 0x17c20111 },
+    { 0x1300, 0x0000, 0x0000, 0x17c30111 },
+    { 0x1300, 0x0000, 0x0000, 0x17c40111 },
+    { 0x1300, 0x0000, 0x0000, 0x17c50111 },
+    { 0x1300, 0x0000, 0x0000, 0x17c60111 },
+    { 0x1300, 0x0000, 0x0000, 0x17c70111 },
+    { 0x1300, 0x0000, 0x0000, 0x17c80111 },
+    { 0x1300, 0x0000, 0x0000, 0x17c90111 },
+    { 0x1300, 0x0000, 0x0000, 0x17ca0111 },
+    { 0x1300, 0x0000, 0x0000, 0x17cb0111 },
+    { 0x1300, 0x0000, 0x0000, 0x17cc0111 },
+    { 0x1300, 0x0000, 0x0000, 0x17cd0111 },
+    { 0x1300, 0x0000, 0x0000, 0x17ce0111 },
+    { 0x1300, 0x0000, 0x0000, 0x17cf0111 },
+    { 0x1300, 0x0000, 0x0000, 0x17d00111 },
+    { 0x1300, 0x0000, 0x0000, 0x17d10111 },
+    { 0x1300, 0x0000, 0x0000, 0x17d20111 },
+    { 0x1300, 0x0000, 0x0000, 0x17d30111 },
+    { 0x1300, 0x0000, 0x0000, 0x17d40111 },
+    { 0x1300, 0x0000, 0x0000, 0x17d50111 },
+    { 0x1300, 0x0000, 0x0000, 0x17d60111 },
+    { 0x1300, 0x0000, 0x0000, 0x17d70111 },
+    { 0x1300, 0x0000, 0x0000, 0x17d80111 },
+    { 0x1300, 0x0000, 0x0000, 0x17d90111 },
+    { 0x1300, 0x0000, 0x0000, 0x17da0111 },
+    { 0x1300, 0x0000, 0x0000, 0x17db0111 },
+    { 0x1300, 0x0000, 0x0000, 0x17dc0111 },
+    { 0x1300, 0x0000, 0x0000, 0x17dd0111 },
+    { 0x1300, 0x0000, 0x0000, 0x17de0111 },
+    { 0x1300, 0x0000, 0x0000, 0x17df0111 },
+    { 0x1300, 0x0000, 0x0000, 0x17e00111 },
+    { 0x1300, 0x0000, 0x0000, 0x17e10111 },
+    { 0x1300, 0x0000, 0x0000, 0x17e20111 },
+    { 0x1300, 0x0000, 0x0000, 0x17e30111 },
+    { 0x1300, 0x0000, 0x0000, 0x17e40111 },
+    { 0x1300, 0x0000, 0x0000, 0x17e50111 },
+    { 0x1300, 0x0000, 0x0000, 0x17e60111 },
+    { 0x1300, 0x0000, 0x0000, 0x17e70111 },
+    { 0x1300, 0x0000, 0x0000, 0x17e80111 },
+    { 0x1300, 0x0000, 0x0000, 0x17e90111 },
+    { 0x1300, 0x0000, 0x0000, 0x17ea0111 },
+    { 0x1300, 0x0000, 0x0000, 0x17eb0111 },
+    { 0x1300, 0x0000, 0x0000, 0x17ec0111 },
+    { 0x1300, 0x0000, 0x0000, 0x17ed0111 },
+    { 0x1300, 0x0000, 0x0000, 0x17ee0111 },
+    { 0x1300, 0x0000, 0x0000, 0x17ef0111 },
+    { 0x1300, 0x0000, 0x0000, 0x17f00111 },
+    { 0x1210, 0x0000, 0x0000, 0x03310111 },
+    { 0x1210, 0x0000, 0x0000, 0x025d0111 },
+    { 0x1300, 0x0000, 0x0000, 0x16f90111 },
+    { 0x1300, 0x0000, 0x0000, 0x170a0111 },
+    { 0x1300, 0x0000, 0x0000, 0x17130111 },
+    { 0x1300, 0x0000, 0x0000, 0x17140111 },
+    { 0x1300, 0x0000, 0x0000, 0x17150111 },
+    { 0x1300, 0x0000, 0x0000, 0x17160111 },
+    { 0x1300, 0x0000, 0x0000, 0x17170111 },
+    { 0x1300, 0x0000, 0x0000, 0x17180111 },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0xa208, 0x0000, 0x0000, 0x020a0111 },
+    { 0x1300, 0x0000, 0x0000, 0x17f10111 },
+    { 0x1300, 0x0000, 0x0000, 0x17f20111 },
+    { 0x1300, 0x0000, 0x0000, 0x17f30111 },
+    { 0x1300, 0x0000, 0x0000, 0x17f40111 },
+    { 0x1300, 0x0000, 0x0000, 0x17f50111 },
+    { 0x1300, 0x0000, 0x0000, 0x17f60111 },
+    { 0x1300, 0x0000, 0x0000, 0x17f70111 },
+    { 0x1300, 0x0000, 0x0000, 0x17f80111 },
+    { 0x1300, 0x0000, 0x0000, 0x17f90111 },
+    { 0x1300, 0x0000, 0x0000, 0x17fa0111 },
+    { 0x1300, 0x0000, 0x0000, 0x17fb0111 },
+    { 0x1300, 0x0000, 0x0000, 0x17fc0111 },
+    { 0x1300, 0x0000, 0x0000, 0x17fd0111 },
+    { 0x1300, 0x0000, 0x0000, 0x17fe0111 },
+    { 0x1300, 0x0000, 0x0000, 0x17ff0111 },
+    { 0x1300, 0x0000, 0x0000, 0x18000111 },
+    { 0x1300, 0x0000, 0x0000, 0x18010111 },
+    { 0x1300, 0x0000, 0x0000, 0x18020111 },
+    { 0x1300, 0x0000, 0x0000, 0x18030111 },
+    { 0x1300, 0x0000, 0x0000, 0x18040111 },
+    { 0x1300, 0x0000, 0x0000, 0x18050111 },
+    { 0x1300, 0x0000, 0x0000, 0x18060111 },
+    { 0x1300, 0x0000, 0x0000, 0x18070111 },
+    { 0x1300, 0x0000, 0x0000, 0x18080111 },
+    { 0x1300, 0x0000, 0x0000, 0x18090111 },
+    { 0x1300, 0x0000, 0x0000, 0x180a0111 },
+    { 0xb210, 0x0000, 0x0000, 0x02840111 },
+    { 0xb210, 0x0000, 0x0000, 0x02850111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x180b0111 },
+    { 0x1300, 0x0000, 0x0000, 0x180b0121 },
+    { 0x1300, 0x0000, 0x0000, 0x180c0111 },
+    { 0x1300, 0x0000, 0x0000, 0x18280111 },
+    { 0x1300, 0x0000, 0x0000, 0x180c0121 },
+    { 0x1300, 0x0000, 0x0000, 0x180c0121 },
+    { 0x1300, 0x0000, 0x0000, 0x180d0111 },
+    { 0x1300, 0x0000, 0x0000, 0x180d0121 },
+    { 0x1300, 0x0000, 0x0000, 0x180e0111 },
+    { 0x1300, 0x0000, 0x0000, 0x180e0121 },
+    { 0x1300, 0x0000, 0x0000, 0x18260111 },
+    { 0x1300, 0x0000, 0x0000, 0x18270111 },
+    { 0x1300, 0x0000, 0x0000, 0x180e0121 },
+    { 0x1300, 0x0000, 0x0000, 0x180e0121 },
+    { 0x1300, 0x0000, 0x0000, 0x180e0121 },
+    { 0x1300, 0x0000, 0x0000, 0x180f0111 },
+    { 0x1300, 0x0000, 0x0000, 0x18100111 },
+    { 0x1300, 0x0000, 0x0000, 0x18110111 },
+    { 0x1300, 0x0000, 0x0000, 0x18120111 },
+    { 0x1300, 0x0000, 0x0000, 0x18120121 },
+    { 0x1300, 0x0000, 0x0000, 0x18120121 },
+    { 0x1300, 0x0000, 0x0000, 0x18120121 },
+    { 0x1300, 0x0000, 0x0000, 0x18120121 },
+    { 0x1300, 0x0000, 0x0000, 0x18130111 },
+    { 0x1300, 0x0000, 0x0000, 0x182b0111 },
+    { 0x1300, 0x0000, 0x0000, 0x18140111 },
+    { 0x1300, 0x0000, 0x0000, 0x18150111 },
+    { 0x1300, 0x0000, 0x0000, 0x18150121 },
+    { 0x1300, 0x0000, 0x0000, 0x18150121 },
+    { 0x1300, 0x0000, 0x0000, 0x18150121 },
+    { 0x1300, 0x0000, 0x0000, 0x18160111 },
+    { 0x1300, 0x0000, 0x0000, 0x18160121 },
+    { 0x1300, 0x0000, 0x0000, 0x18160121 },
+    { 0x1300, 0x0000, 0x0000, 0x18170111 },
+    { 0x1300, 0x0000, 0x0000, 0x18170121 },
+    { 0x1300, 0x0000, 0x0000, 0x18180111 },
+    { 0x1300, 0x0000, 0x0000, 0x18180121 },
+    { 0x1300, 0x0000, 0x0000, 0x18190111 },
+    { 0x1300, 0x0000, 0x0000, 0x18190121 },
+    { 0x1300, 0x0000, 0x0000, 0x181a0111 },
+    { 0x1300, 0x0000, 0x0000, 0x181b0111 },
+    { 0x1300, 0x0000, 0x0000, 0x181c0111 },
+    { 0x1300, 0x0000, 0x0000, 0x181d0111 },
+    { 0x1300, 0x0000, 0x0000, 0x181d0121 },
+    { 0x1300, 0x0000, 0x0000, 0x181d0121 },
+    { 0x1300, 0x0000, 0x0000, 0x181d0121 },
+    { 0x1300, 0x0000, 0x0000, 0x181d0121 },
+    { 0x1300, 0x0000, 0x0000, 0x181e0111 },
+    { 0x1300, 0x0000, 0x0000, 0x181e0121 },
+    { 0x1300, 0x0000, 0x0000, 0x181e0121 },
+    { 0x1300, 0x0000, 0x0000, 0x181f0111 },
+    { 0x1300, 0x0000, 0x0000, 0x181f0121 },
+    { 0x1300, 0x0000, 0x0000, 0x181f0121 },
+    { 0x1300, 0x0000, 0x0000, 0x181b0121 },
+    { 0x1300, 0x0000, 0x0000, 0x18200111 },
+    { 0x1300, 0x0000, 0x0000, 0x18210111 },
+    { 0x1300, 0x0000, 0x0000, 0x18210121 },
+    { 0x1300, 0x0000, 0x0000, 0x18210121 },
+    { 0x1300, 0x0000, 0x0000, 0x18220111 },
+    { 0x1300, 0x0000, 0x0000, 0x18220121 },
+    { 0x1300, 0x0000, 0x0000, 0x18230111 },
+    { 0x1300, 0x0000, 0x0000, 0x18230121 },
+    { 0x1300, 0x0000, 0x0000, 0x18240111 },
+    { 0x1300, 0x0000, 0x0000, 0x18250111 },
+    { 0x1300, 0x0000, 0x0000, 0x18290111 },
+    { 0x1300, 0x0000, 0x0000, 0x182d0111 },
+    { 0x1300, 0x0000, 0x0000, 0x182e0111 },
+    { 0x1300, 0x0000, 0x0000, 0x182a0111 },
+    { 0x1300, 0x0000, 0x0000, 0x182c0111 },
+    { 0x1300, 0x0000, 0x0000, 0x182f0111 },
+    { 0x1300, 0x0000, 0x0000, 0x18300111 },
+    { 0x1300, 0x0000, 0x0000, 0x18300121 },
+    { 0x1300, 0x0000, 0x0000, 0x18300121 },
+    { 0x1300, 0x0000, 0x0000, 0x18140121 },
+    { 0x1300, 0x0000, 0x0000, 0x181d0121 },
+    { 0x1210, 0x0000, 0x0000, 0x02480111 },
+    { 0x1210, 0x0000, 0x0000, 0x02490111 },
+    { 0x1210, 0x0000, 0x0000, 0x024a0111 },
+    { 0x1300, 0x0000, 0x0000, 0x18190121 },
+    { 0x1300, 0x0000, 0x0000, 0x18210121 },
+    { 0x1300, 0x0000, 0x0000, 0x180d0121 },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    /* block 23 */
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x145f0111 },
+    { 0x1300, 0x0000, 0x0000, 0x14600111 },
+    { 0x1300, 0x0000, 0x0000, 0x14610111 },
+    { 0x1300, 0x0000, 0x0000, 0x14620111 },
+    { 0x1300, 0x0000, 0x0000, 0x14630111 },
+    { 0x1300, 0x0000, 0x0000, 0x14640111 },
+    { 0x1300, 0x0000, 0x0000, 0x14650111 },
+    { 0x1300, 0x0000, 0x0000, 0x14660111 },
+    { 0x1300, 0x0000, 0x0000, 0x14670111 },
+    { 0x1300, 0x0000, 0x0000, 0x14680111 },
+    { 0x1300, 0x0000, 0x0000, 0x14690111 },
+    { 0x1300, 0x0000, 0x0000, 0x146a0111 },
+    { 0x1300, 0x0000, 0x0000, 0x146b0111 },
+    { 0x1300, 0x0000, 0x0000, 0x146c0111 },
+    { 0x1300, 0x0000, 0x0000, 0x146d0111 },
+    { 0x1300, 0x0000, 0x0000, 0x146e0111 },
+    { 0x1300, 0x0000, 0x0000, 0x146f0111 },
+    { 0x1300, 0x0000, 0x0000, 0x14700111 },
+    { 0x1300, 0x0000, 0x0000, 0x14710111 },
+    { 0x1300, 0x0000, 0x0000, 0x14720111 },
+    { 0x1300, 0x0000, 0x0000, 0x14730111 },
+    { 0x1300, 0x0000, 0x0000, 0x14740111 },
+    { 0x1300, 0x0000, 0x0000, 0x14750111 },
+    { 0x1300, 0x0000, 0x0000, 0x14760111 },
+    { 0x1300, 0x0000, 0x0000, 0x14770111 },
+    { 0x1300, 0x0000, 0x0000, 0x14780111 },
+    { 0x1300, 0x0000, 0x0000, 0x14790111 },
+    { 0x1300, 0x0000, 0x0000, 0x147a0111 },
+    { 0x1300, 0x0000, 0x0000, 0x147b0111 },
+    { 0x1300, 0x0000, 0x0000, 0x147c0111 },
+    { 0x1300, 0x0000, 0x0000, 0x147d0111 },
+    { 0x1300, 0x0000, 0x0000, 0x147e0111 },
+    { 0x1300, 0x0000, 0x0000, 0x147f0111 },
+    { 0x1300, 0x0000, 0x0000, 0x14800111 },
+    { 0x1300, 0x0000, 0x0000, 0x14810111 },
+    { 0x1300, 0x0000, 0x0000, 0x14820111 },
+    { 0x1300, 0x0000, 0x0000, 0x14830111 },
+    { 0x1300, 0x0000, 0x0000, 0x14840111 },
+    { 0x1300, 0x0000, 0x0000, 0x14850111 },
+    { 0x1300, 0x0000, 0x0000, 0x14860111 },
+    { 0x1300, 0x0000, 0x0000, 0x14870111 },
+    { 0x1300, 0x0000, 0x0000, 0x14880111 },
+    { 0x1300, 0x0000, 0x0000, 0x14890111 },
+    { 0x1300, 0x0000, 0x0000, 0x148a0111 },
+    { 0x1300, 0x0000, 0x0000, 0x148b0111 },
+    { 0x1300, 0x0000, 0x0000, 0x148c0111 },
+    { 0x1300, 0x0000, 0x0000, 0x148d0111 },
+    { 0x1300, 0x0000, 0x0000, 0x148e0111 },
+    { 0x1300, 0x0000, 0x0000, 0x148f0111 },
+    { 0x1300, 0x0000, 0x0000, 0x14900111 },
+    { 0x1300, 0x0000, 0x0000, 0x14910111 },
+    { 0x1300, 0x0000, 0x0000, 0x14920111 },
+    { 0xd200, 0x0000, 0x0000, 0x14930111 },
+    { 0xd200, 0x0000, 0x0000, 0x14940111 },
+    { 0x1200, 0x0000, 0x0000, 0x14950111 },
+    { 0xd200, 0x0000, 0x0000, 0x14960111 },
+    { 0xd200, 0x0000, 0x0000, 0x14970111 },
+    { 0xd200, 0x0000, 0x0000, 0x14980111 },
+    { 0xd200, 0x0000, 0x0000, 0x14990111 },
+    { 0xd200, 0x0000, 0x0000, 0x149a0111 },
+    { 0xd200, 0x0000, 0x0000, 0x149b0111 },
+    { 0xd200, 0x0000, 0x0000, 0x149c0111 },
+    { 0x1200, 0x0000, 0x0000, 0x149d0111 },
+    { 0x1200, 0x0000, 0x0000, 0x149e0111 },
+    { 0x1200, 0x0000, 0x0000, 0x149f0111 },
+    { 0x1200, 0x0000, 0x0000, 0x14a00111 },
+    { 0x1200, 0x0000, 0x0000, 0x14a10111 },
+    { 0x1200, 0x0000, 0x0000, 0x14a20111 },
+    { 0x1200, 0x0000, 0x0000, 0x14a30111 },
+    { 0x1200, 0x0000, 0x0000, 0x14a40111 },
+    { 0xd200, 0x0000, 0x0000, 0x0000cf11 },
+    { 0x1200, 0x0000, 0x0000, 0x0000d011 },
+    { 0x1200, 0x0000, 0x0000, 0x0000d111 },
+    { 0xd200, 0x0000, 0x0000, 0x0000d211 },
+    { 0xd200, 0x0000, 0x0000, 0x0000d311 },
+    { 0xd200, 0x0000, 0x0000, 0x0000d411 },
+    { 0xd200, 0x0000, 0x0000, 0x0000d511 },
+    { 0xd200, 0x0000, 0x0000, 0x0000d611 },
+    { 0xd200, 0x0000, 0x0000, 0x0000d711 },
+    { 0xd200, 0x0000, 0x0000, 0x0000d811 },
+    { 0xd200, 0x0000, 0x0000, 0x0000d911 },
+    { 0xd200, 0x0000, 0x0000, 0x0000da11 },
+    { 0xd200, 0x0000, 0x0000, 0x14a50111 },
+    { 0xd200, 0x0000, 0x0000, 0x0000db11 },
+    { 0x1210, 0x0000, 0x0000, 0x02640111 },
+    { 0x1210, 0x0000, 0x0000, 0x02650111 },
+    { 0x1210, 0x0000, 0x0000, 0x02470111 },
+    { 0x1300, 0x0000, 0x0000, 0x02e40111 },
+    { 0x1210, 0x0000, 0x0000, 0x02e50111 },
+    { 0x1210, 0x0000, 0x0000, 0x02e60111 },
+    { 0x1210, 0x0000, 0x0000, 0x02e70111 },
+    { 0x5200, 0x0000, 0x0000, 0x09e60111 },
+    { 0x1300, 0x0000, 0x0000, 0x02e80111 },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0x0a0b0111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a0c0111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a0d0111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a0e0111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a0f0111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a100111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a110111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a120111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a130111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a140111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    /* block 24 */
+    { 0xb210, 0x0000, 0x0000, 0x02cb0111 },
+    { 0xb210, 0x0000, 0x0000, 0x02560111 },
+    { 0xb210, 0x0000, 0x0000, 0x02320111 },
+    { 0xb210, 0x0000, 0x0000, 0x025b0111 },
+    { 0xb210, 0x0000, 0x0000, 0x02440111 },
+    { 0xb210, 0x0000, 0x0000, 0x02450111 },
+    { 0xb210, 0x0000, 0x0000, 0x02230111 },
+    { 0xb210, 0x0000, 0x0000, 0x02240111 },
+    { 0xb210, 0x0000, 0x0000, 0x02330111 },
+    { 0xb210, 0x0000, 0x0000, 0x025c0111 },
+    { 0xb210, 0x0000, 0x0000, 0x02cc0111 },
+    { 0xd200, 0x0000, 0x0000, 0x00000000 },
+    { 0xd200, 0x0000, 0x0000, 0x00000000 },
+    { 0xd200, 0x0000, 0x0000, 0x00000000 },
+    { 0xe220, 0x0000, 0x0000, 0x00000000 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0x0a0b0111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a0c0111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a0d0111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a0e0111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a0f0111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a100111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a110111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a120111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a130111 },
+    { 0x1204, 0x0000, 0x0000, 0x0a140111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x14ae0111 },
+    { 0x1300, 0x0000, 0x0000, 0x14b00111 },
+    { 0x1300, 0x0000, 0x0000, 0x14b30111 },
+    { 0x1300, 0x0000, 0x0000, 0x14b90111 },
+    { 0x1300, 0x0000, 0x0000, 0x14bb0111 },
+    { 0x1300, 0x0000, 0x0000, 0x14be0111 },
+    { 0x1300, 0x0000, 0x0000, 0x14c00111 },
+    { 0x1300, 0x0000, 0x0000, 0x14c30111 },
+    { 0x1300, 0x0000, 0x0000, 0x14c40111 },
+    { 0x1300, 0x0000, 0x0000, 0x14c50111 },
+    { 0x1300, 0x0000, 0x0000, 0x14ca0111 },
+    { 0x1300, 0x0000, 0x0000, 0x14cc0111 },
+    { 0x1300, 0x0000, 0x0000, 0x14cf0111 },
+    { 0x1300, 0x0000, 0x0000, 0x14d10111 },
+    { 0x1300, 0x0000, 0x0000, 0x14d60111 },
+    { 0x1300, 0x0000, 0x0000, 0x14d80111 },
+    { 0x1300, 0x0000, 0x0000, 0x14d90111 },
+    { 0x1300, 0x0000, 0x0000, 0x14da0111 },
+    { 0x1300, 0x0000, 0x0000, 0x14e10111 },
+    { 0x1300, 0x0000, 0x0000, 0x14e40111 },
+    { 0x1300, 0x0000, 0x0000, 0x14e70111 },
+    { 0x1300, 0x0000, 0x0000, 0x14ec0111 },
+    { 0x1300, 0x0000, 0x0000, 0x14f00111 },
+    { 0x1300, 0x0000, 0x0000, 0x14f30111 },
+    { 0x1300, 0x0000, 0x0000, 0x14f50111 },
+    { 0x1300, 0x0000, 0x0000, 0x14f70111 },
+    { 0x1300, 0x0000, 0x0000, 0x14fa0111 },
+    { 0x1300, 0x0000, 0x0000, 0x14ff0111 },
+    { 0x1300, 0x0000, 0x0000, 0x15000111 },
+    { 0x1300, 0x0000, 0x0000, 0x15030111 },
+    { 0x1300, 0x0000, 0x0000, 0x15070111 },
+    { 0x1300, 0x0000, 0x0000, 0x150a0111 },
+    { 0x1300, 0x0000, 0x0000, 0x150b0111 },
+    { 0x1300, 0x0000, 0x0000, 0x150c0111 },
+    { 0x1300, 0x0000, 0x0000, 0x150d0111 },
+    { 0x1300, 0x0000, 0x0000, 0x14ad0111 },
+    { 0x1300, 0x0000, 0x0000, 0x14b10111 },
+    { 0x1300, 0x0000, 0x0000, 0x14b40111 },
+    { 0x1300, 0x0000, 0x0000, 0x14ba0111 },
+    { 0x1300, 0x0000, 0x0000, 0x14bc0111 },
+    { 0x1300, 0x0000, 0x0000, 0x14bf0111 },
+    { 0x1300, 0x0000, 0x0000, 0x14c10111 },
+    { 0x1300, 0x0000, 0x0000, 0x14c60111 },
+    { 0x1300, 0x0000, 0x0000, 0x14cb0111 },
+    { 0x1300, 0x0000, 0x0000, 0x14cd0111 },
+    { 0x1300, 0x0000, 0x0000, 0x14d00111 },
+    { 0x1300, 0x0000, 0x0000, 0x14d20111 },
+    { 0x1300, 0x0000, 0x0000, 0x14d70111 },
+    { 0x1300, 0x0000, 0x0000, 0x14e20111 },
+    { 0x1300, 0x0000, 0x0000, 0x14e50111 },
+    { 0x1300, 0x0000, 0x0000, 0x14e80111 },
+    { 0x1300, 0x0000, 0x0000, 0x14ed0111 },
+    { 0x1300, 0x0000, 0x0000, 0x15010111 },
+    { 0x1300, 0x0000, 0x0000, 0x14f10111 },
+    { 0x1300, 0x0000, 0x0000, 0x14f60111 },
+    { 0x1300, 0x0000, 0x0000, 0x14fb0111 },
+    { 0x1300, 0x0000, 0x0000, 0x15050111 },
+    { 0x1300, 0x0000, 0x0000, 0x15080111 },
+    { 0x1300, 0x0000, 0x0000, 0x150e0111 },
+    { 0x1300, 0x0000, 0x0000, 0x150f0111 },
+    { 0x1300, 0x0000, 0x0000, 0x14ea0111 },
+    { 0x1300, 0x0000, 0x0000, 0x14b20111 },
+    { 0x1300, 0x0000, 0x0000, 0x14b50111 },
+    { 0x1300, 0x0000, 0x0000, 0x14b80111 },
+    { 0x1300, 0x0000, 0x0000, 0x14c20111 },
+    { 0x1300, 0x0000, 0x0000, 0x14bd0111 },
+    { 0x1300, 0x0000, 0x0000, 0x14c70111 },
+    { 0x1300, 0x0000, 0x0000, 0x14fc0111 },
+    { 0x1300, 0x0000, 0x0000, 0x14d30111 },
+    { 0x1300, 0x0000, 0x0000, 0x14d50111 },
+    { 0x1300, 0x0000, 0x0000, 0x14ce0111 },
+    { 0x1300, 0x0000, 0x0000, 0x14db0111 },
+    { 0x1300, 0x0000, 0x0000, 0x14e30111 },
+    { 0x1300, 0x0000, 0x0000, 0x14e60111 },
+    { 0x1300, 0x0000, 0x0000, 0x14ee0111 },
+    { 0x1300, 0x0000, 0x0000, 0x14f80111 },
+    { 0x1300, 0x0000, 0x0000, 0x15060111 },
+    { 0x1300, 0x0000, 0x0000, 0x15090111 },
+    { 0x1300, 0x0000, 0x0000, 0x15020111 },
+    { 0x1300, 0x0000, 0x0000, 0x15040111 },
+    { 0x1300, 0x0000, 0x0000, 0x15100111 },
+    { 0x1300, 0x0000, 0x0000, 0x14e90111 },
+    { 0x1300, 0x0000, 0x0000, 0x14f20111 },
+    { 0x1300, 0x0000, 0x0000, 0x14b60111 },
+    { 0x1300, 0x0000, 0x0000, 0x14fd0111 },
+    { 0x1300, 0x0000, 0x0000, 0x14f40111 },
+    { 0x1300, 0x0000, 0x0000, 0x14f90111 },
+    { 0x1300, 0x0000, 0x0000, 0x14ef0111 },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x14a60111 },
+    { 0x1300, 0x0000, 0x0000, 0x14a70111 },
+    { 0x1300, 0x0000, 0x0000, 0x14a80111 },
+    { 0x1300, 0x0000, 0x0000, 0x14a90111 },
+    { 0x1300, 0x0000, 0x0000, 0x14aa0111 },
+    { 0xd200, 0x0000, 0x0000, 0x14ab0111 },
+    { 0xd200, 0x0000, 0x0000, 0x14ac0111 },
+    { 0x1300, 0x0000, 0x0000, 0x14af0111 },
+    { 0x1300, 0x0000, 0x0000, 0x14b70111 },
+    { 0x1300, 0x0000, 0x0000, 0x14fe0111 },
+    { 0x1300, 0x0000, 0x0000, 0x14c80111 },
+    { 0x1300, 0x0000, 0x0000, 0x14eb0111 },
+    { 0x1300, 0x0000, 0x0000, 0x15110111 },
+    { 0x1300, 0x0000, 0x0000, 0x15130111 },
+    { 0x1300, 0x0000, 0x0000, 0x15140111 },
+    { 0x1300, 0x0000, 0x0000, 0x15160111 },
+    { 0x1300, 0x0000, 0x0000, 0x15170111 },
+    { 0x1300, 0x0000, 0x0000, 0x151a0111 },
+    { 0x1300, 0x0000, 0x0000, 0x151c0111 },
+    { 0x1300, 0x0000, 0x0000, 0x151d0111 },
+    { 0x1300, 0x0000, 0x0000, 0x151f0111 },
+    { 0x1300, 0x0000, 0x0000, 0x15210111 },
+    { 0x1300, 0x0000, 0x0000, 0x15230111 },
+    { 0x1300, 0x0000, 0x0000, 0x15240111 },
+    { 0x1300, 0x0000, 0x0000, 0x15180111 },
+    { 0x1300, 0x0000, 0x0000, 0x15220111 },
+    { 0x1300, 0x0000, 0x0000, 0x14d40111 },
+    { 0x1300, 0x0000, 0x0000, 0x14c90111 },
+    { 0x1300, 0x0000, 0x0000, 0x14dc0111 },
+    { 0x1300, 0x0000, 0x0000, 0x14dd0111 },
+    { 0x1300, 0x0000, 0x0000, 0x15120111 },
+    { 0x1300, 0x0000, 0x0000, 0x15150111 },
+    { 0x1300, 0x0000, 0x0000, 0x15190111 },
+    { 0x1300, 0x0000, 0x0000, 0x151b0111 },
+    { 0x1300, 0x0000, 0x0000, 0x14de0111 },
+    { 0x1300, 0x0000, 0x0000, 0x15200111 },
+    { 0x1300, 0x0000, 0x0000, 0x14df0111 },
+    { 0x1300, 0x0000, 0x0000, 0x14e00111 },
+    { 0x1300, 0x0000, 0x0000, 0x15250111 },
+    { 0x1300, 0x0000, 0x0000, 0x15260111 },
+    { 0x1300, 0x0000, 0x0000, 0x151e0111 },
+    { 0xd200, 0x0000, 0x0000, 0x15270111 },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    /* block 25 */
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    /* block 26 */
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    /* block 27 */
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    /* block 28 */
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xe792, 0xffffffff },
+    { 0x1302, 0x0000, 0xe793, 0xffffffff },
+    { 0x1302, 0x0000, 0xe79c, 0xffffffff },
+    { 0x1302, 0x0000, 0xe79e, 0xffffffff },
+    { 0x1302, 0x0000, 0xe79e, 0xffffffff },
+    { 0x1302, 0x0000, 0xe79d, 0xffffffff },
+    { 0x1302, 0x0000, 0xe7a4, 0xffffffff },
+    { 0x1302, 0x0000, 0xe7db, 0xffffffff },
+    { 0x1302, 0x0000, 0x89c2, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1301, 0xf440, 0x0000, 0xffffffff },
+    { 0x1301, 0xf440, 0x0000, 0xffffffff },
+    { 0x1301, 0xf440, 0x0000, 0xffffffff },
+    { 0x1301, 0xf440, 0x0000, 0xffffffff },
+    { 0x1301, 0xf440, 0x0000, 0xffffffff },
+    { 0x1301, 0xf440, 0x0000, 0xffffffff },
+    { 0x1301, 0xf440, 0x0000, 0xffffffff },
+    { 0x1301, 0xf440, 0x0000, 0xffffffff },
+    { 0x1301, 0xf440, 0x0000, 0xffffffff },
+    { 0x1301, 0xf440, 0x0000, 0xffffffff },
+    { 0x1301, 0xf440, 0x0000, 0xffffffff },
+    { 0x1301, 0xf440, 0x0000, 0xffffffff },
+    { 0x1301, 0xf440, 0x0000, 0xffffffff },
+    { 0x1301, 0xf440, 0x0000, 0xffffffff },
+    { 0x1301, 0xf440, 0x0000, 0xffffffff },
+    { 0x1301, 0xf440, 0x0000, 0xffffffff },
+    { 0x1301, 0xf440, 0x0000, 0xffffffff },
+    { 0x1301, 0xf440, 0x0000, 0xffffffff },
+    { 0x1301, 0xf440, 0x0000, 0xffffffff },
+    { 0x1301, 0xf440, 0x0000, 0xffffffff },
+    { 0x1301, 0xf440, 0x0000, 0xffffffff },
+    { 0x1301, 0xf440, 0x0000, 0xffffffff },
+    { 0x1301, 0xf440, 0x0000, 0xffffffff },
+    { 0x1301, 0xf440, 0x0000, 0xffffffff },
+    { 0x1301, 0xf440, 0x0000, 0xffffffff },
+    { 0x1301, 0xf440, 0x0000, 0xffffffff },
+    { 0x1301, 0xf440, 0x0000, 0xffffffff },
+    { 0x1301, 0xf440, 0x0000, 0xffffffff },
+    { 0x1301, 0xf440, 0x0000, 0xffffffff },
+    { 0x1301, 0xf440, 0x0000, 0xffffffff },
+    { 0x1301, 0xf440, 0x0000, 0xffffffff },
+    { 0x1301, 0xf440, 0x0000, 0xffffffff },
+    { 0x1301, 0xf440, 0x0000, 0xffffffff },
+    { 0x1301, 0xf440, 0x0000, 0xffffffff },
+    { 0x1301, 0xf440, 0x0000, 0xffffffff },
+    { 0x1301, 0xf440, 0x0000, 0xffffffff },
+    { 0x1301, 0xf440, 0x0000, 0xffffffff },
+    { 0x1301, 0xf440, 0x0000, 0xffffffff },
+    { 0x1301, 0xf440, 0x0000, 0xffffffff },
+    { 0x1301, 0xf440, 0x0000, 0xffffffff },
+    { 0x1301, 0xf440, 0x0000, 0xffffffff },
+    { 0x1301, 0xf440, 0x0000, 0xffffffff },
+    { 0x1301, 0xf440, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1301, 0xf440, 0x0000, 0xffffffff },
+    { 0x1301, 0xf440, 0x0000, 0xffffffff },
+    { 0x1301, 0xf440, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    /* block 29 */
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x8a04, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0ee6, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    /* block 30 */
+    { 0x1301, 0x0001, 0x0000, 0x0a150151 },
+    { 0x1302, 0x0000, 0xffff, 0x0a150111 },
+    { 0x1301, 0x0001, 0x0000, 0x0a290141 },
+    { 0x1302, 0x0000, 0xffff, 0x0a290111 },
+    { 0x1301, 0x0001, 0x0000, 0x0a290141 },
+    { 0x1302, 0x0000, 0xffff, 0x0a290111 },
+    { 0x1301, 0x0001, 0x0000, 0x0a290141 },
+    { 0x1302, 0x0000, 0xffff, 0x0a290111 },
+    { 0x1301, 0x0001, 0x0000, 0x0a3d0151 },
+    { 0x1302, 0x0000, 0xffff, 0x0a3d0111 },
+    { 0x1301, 0x0001, 0x0000, 0x0a490151 },
+    { 0x1302, 0x0000, 0xffff, 0x0a490111 },
+    { 0x1301, 0x0001, 0x0000, 0x0a490151 },
+    { 0x1302, 0x0000, 0xffff, 0x0a490111 },
+    { 0x1301, 0x0001, 0x0000, 0x0a490151 },
+    { 0x1302, 0x0000, 0xffff, 0x0a490111 },
+    { 0x1301, 0x0001, 0x0000, 0x0a490151 },
+    { 0x1302, 0x0000, 0xffff, 0x0a490111 },
+    { 0x1301, 0x0001, 0x0000, 0x0a490151 },
+    { 0x1302, 0x0000, 0xffff, 0x0a490111 },
+    { 0x1301, 0x0001, 0x0000, 0x0a650151 },
+    { 0x1302, 0x0000, 0xffff, 0x0a650111 },
+    { 0x1301, 0x0001, 0x0000, 0x0a650151 },
+    { 0x1302, 0x0000, 0xffff, 0x0a650111 },
+    { 0x1301, 0x0001, 0x0000, 0x0a650151 },
+    { 0x1302, 0x0000, 0xffff, 0x0a650111 },
+    { 0x1301, 0x0001, 0x0000, 0x0a650151 },
+    { 0x1302, 0x0000, 0xffff, 0x0a650111 },
+    { 0x1301, 0x0001, 0x0000, 0x0a650151 },
+    { 0x1302, 0x0000, 0xffff, 0x0a650111 },
+    { 0x1301, 0x0001, 0x0000, 0x0a910151 },
+    { 0x1302, 0x0000, 0xffff, 0x0a910111 },
+    { 0x1301, 0x0001, 0x0000, 0x0a990151 },
+    { 0x1302, 0x0000, 0xffff, 0x0a990111 },
+    { 0x1301, 0x0001, 0x0000, 0x0ab90151 },
+    { 0x1302, 0x0000, 0xffff, 0x0ab90111 },
+    { 0x1301, 0x0001, 0x0000, 0x0ab90151 },
+    { 0x1302, 0x0000, 0xffff, 0x0ab90111 },
+    { 0x1301, 0x0001, 0x0000, 0x0ab90151 },
+    { 0x1302, 0x0000, 0xffff, 0x0ab90111 },
+    { 0x1301, 0x0001, 0x0000, 0x0ab90151 },
+    { 0x1302, 0x0000, 0xffff, 0x0ab90111 },
+    { 0x1301, 0x0001, 0x0000, 0x0ab90151 },
+    { 0x1302, 0x0000, 0xffff, 0x0ab90111 },
+    { 0x1301, 0x0001, 0x0000, 0x0ad30161 },
+    { 0x1302, 0x0000, 0xffff, 0x0ad30111 },
+    { 0x1301, 0x0001, 0x0000, 0x0ad30161 },
+    { 0x1302, 0x0000, 0xffff, 0x0ad30111 },
+    { 0x1301, 0x0001, 0x0000, 0x0af70141 },
+    { 0x1302, 0x0000, 0xffff, 0x0af70111 },
+    { 0x1301, 0x0001, 0x0000, 0x0af70141 },
+    { 0x1302, 0x0000, 0xffff, 0x0af70111 },
+    { 0x1301, 0x0001, 0x0000, 0x0af70141 },
+    { 0x1302, 0x0000, 0xffff, 0x0af70111 },
+    { 0x1301, 0x0001, 0x0000, 0x0b030161 },
+    { 0x1302, 0x0000, 0xffff, 0x0b030111 },
+    { 0x1301, 0x0001, 0x0000, 0x0b030161 },
+    { 0x1302, 0x0000, 0xffff, 0x0b030111 },
+    { 0x1301, 0x0001, 0x0000, 0x0b030161 },
+    { 0x1302, 0x0000, 0xffff, 0x0b030111 },
+    { 0x1301, 0x0001, 0x0000, 0x0b030161 },
+    { 0x1302, 0x0000, 0xffff, 0x0b030111 },
+    { 0x1301, 0x0001, 0x0000, 0x0b2b0151 },
+    { 0x1302, 0x0000, 0xffff, 0x0b2b0111 },
+    { 0x1301, 0x0001, 0x0000, 0x0b2b0151 },
+    { 0x1302, 0x0000, 0xffff, 0x0b2b0111 },
+    { 0x1301, 0x0001, 0x0000, 0x0b2b0151 },
+    { 0x1302, 0x0000, 0xffff, 0x0b2b0111 },
+    { 0x1301, 0x0001, 0x0000, 0x0b330151 },
+    { 0x1302, 0x0000, 0xffff, 0x0b330111 },
+    { 0x1301, 0x0001, 0x0000, 0x0b330151 },
+    { 0x1302, 0x0000, 0xffff, 0x0b330111 },
+    { 0x1301, 0x0001, 0x0000, 0x0b330151 },
+    { 0x1302, 0x0000, 0xffff, 0x0b330111 },
+    { 0x1301, 0x0001, 0x0000, 0x0b330151 },
+    { 0x1302, 0x0000, 0xffff, 0x0b330111 },
+    { 0x1301, 0x0001, 0x0000, 0x0b4b0161 },
+    { 0x1302, 0x0000, 0xffff, 0x0b4b0111 },
+    { 0x1301, 0x0001, 0x0000, 0x0b4b0161 },
+    { 0x1302, 0x0000, 0xffff, 0x0b4b0111 },
+    { 0x1301, 0x0001, 0x0000, 0x0b4b0161 },
+    { 0x1302, 0x0000, 0xffff, 0x0b4b0111 },
+    { 0x1301, 0x0001, 0x0000, 0x0b4b0161 },
+    { 0x1302, 0x0000, 0xffff, 0x0b4b0111 },
+    { 0x1301, 0x0001, 0x0000, 0x0b670141 },
+    { 0x1302, 0x0000, 0xffff, 0x0b670111 },
+    { 0x1301, 0x0001, 0x0000, 0x0b670141 },
+    { 0x1302, 0x0000, 0xffff, 0x0b670111 },
+    { 0x1301, 0x0001, 0x0000, 0x0b7f0141 },
+    { 0x1302, 0x0000, 0xffff, 0x0b7f0111 },
+    { 0x1301, 0x0001, 0x0000, 0x0b7f0141 },
+    { 0x1302, 0x0000, 0xffff, 0x0b7f0111 },
+    { 0x1301, 0x0001, 0x0000, 0x0b7f0141 },
+    { 0x1302, 0x0000, 0xffff, 0x0b7f0111 },
+    { 0x1301, 0x0001, 0x0000, 0x0b7f0141 },
+    { 0x1302, 0x0000, 0xffff, 0x0b7f0111 },
+    { 0x1301, 0x0001, 0x0000, 0x0ba70151 },
+    { 0x1302, 0x0000, 0xffff, 0x0ba70111 },
+    { 0x1301, 0x0001, 0x0000, 0x0ba70151 },
+    { 0x1302, 0x0000, 0xffff, 0x0ba70111 },
+    { 0x1301, 0x0001, 0x0000, 0x0ba70151 },
+    { 0x1302, 0x0000, 0xffff, 0x0ba70111 },
+    { 0x1301, 0x0001, 0x0000, 0x0ba70151 },
+    { 0x1302, 0x0000, 0xffff, 0x0ba70111 },
+    { 0x1301, 0x0001, 0x0000, 0x0ba70151 },
+    { 0x1302, 0x0000, 0xffff, 0x0ba70111 },
+    { 0x1301, 0x0001, 0x0000, 0x0bbf0151 },
+    { 0x1302, 0x0000, 0xffff, 0x0bbf0111 },
+    { 0x1301, 0x0001, 0x0000, 0x0bbf0151 },
+    { 0x1302, 0x0000, 0xffff, 0x0bbf0111 },
+    { 0x1301, 0x0001, 0x0000, 0x0bbf0151 },
+    { 0x1302, 0x0000, 0xffff, 0x0bbf0111 },
+    { 0x1301, 0x0001, 0x0000, 0x0bbf0151 },
+    { 0x1302, 0x0000, 0xffff, 0x0bbf0111 },
+    { 0x1301, 0x0001, 0x0000, 0x0bd70141 },
+    { 0x1302, 0x0000, 0xffff, 0x0bd70111 },
+    { 0x1301, 0x0001, 0x0000, 0x0bd70141 },
+    { 0x1302, 0x0000, 0xffff, 0x0bd70111 },
+    { 0x1301, 0x0001, 0x0000, 0x0bd70141 },
+    { 0x1302, 0x0000, 0xffff, 0x0bd70111 },
+    { 0x1301, 0x0001, 0x0000, 0x0bd70141 },
+    { 0x1302, 0x0000, 0xffff, 0x0bd70111 },
+    { 0x1301, 0x0001, 0x0000, 0x0bd70141 },
+    { 0x1302, 0x0000, 0xffff, 0x0bd70111 },
+    { 0x1301, 0x0001, 0x0000, 0x0bef0151 },
+    { 0x1302, 0x0000, 0xffff, 0x0bef0111 },
+    { 0x1301, 0x0001, 0x0000, 0x0bef0151 },
+    { 0x1302, 0x0000, 0xffff, 0x0bef0111 },
+    { 0x1301, 0x0001, 0x0000, 0x0bfb0141 },
+    { 0x1302, 0x0000, 0xffff, 0x0bfb0111 },
+    { 0x1301, 0x0001, 0x0000, 0x0bfb0141 },
+    { 0x1302, 0x0000, 0xffff, 0x0bfb0111 },
+    { 0x1301, 0x0001, 0x0000, 0x0bfb0141 },
+    { 0x1302, 0x0000, 0xffff, 0x0bfb0111 },
+    { 0x1301, 0x0001, 0x0000, 0x0bfb0141 },
+    { 0x1302, 0x0000, 0xffff, 0x0bfb0111 },
+    { 0x1301, 0x0001, 0x0000, 0x0bfb0141 },
+    { 0x1302, 0x0000, 0xffff, 0x0bfb0111 },
+    { 0x1301, 0x0001, 0x0000, 0x0c030151 },
+    { 0x1302, 0x0000, 0xffff, 0x0c030111 },
+    { 0x1301, 0x0001, 0x0000, 0x0c030151 },
+    { 0x1302, 0x0000, 0xffff, 0x0c030111 },
+    { 0x1301, 0x0001, 0x0000, 0x0c070141 },
+    { 0x1302, 0x0000, 0xffff, 0x0c070111 },
+    { 0x1301, 0x0001, 0x0000, 0x0c130141 },
+    { 0x1302, 0x0000, 0xffff, 0x0c130111 },
+    { 0x1301, 0x0001, 0x0000, 0x0c130141 },
+    { 0x1302, 0x0000, 0xffff, 0x0c130111 },
+    { 0x1301, 0x0001, 0x0000, 0x0c130141 },
+    { 0x1302, 0x0000, 0xffff, 0x0c130111 },
+    { 0x1302, 0x0000, 0x0000, 0x0ab90111 },
+    { 0x1302, 0x0000, 0x0000, 0x0bbf0111 },
+    { 0x1302, 0x0000, 0x0000, 0x0bfb0111 },
+    { 0x1302, 0x0000, 0x0000, 0x0c070111 },
+    { 0x1302, 0x0000, 0x0000, 0x0a150131 },
+    { 0x1302, 0x0000, 0xffc5, 0x0ba70131 },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1301, 0xe241, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0x0a150151 },
+    { 0x1302, 0x0000, 0xffff, 0x0a150111 },
+    { 0x1301, 0x0001, 0x0000, 0x0a150151 },
+    { 0x1302, 0x0000, 0xffff, 0x0a150111 },
+    { 0x1301, 0x0001, 0x0000, 0x0a150151 },
+    { 0x1302, 0x0000, 0xffff, 0x0a150111 },
+    { 0x1301, 0x0001, 0x0000, 0x0a150151 },
+    { 0x1302, 0x0000, 0xffff, 0x0a150111 },
+    { 0x1301, 0x0001, 0x0000, 0x0a150151 },
+    { 0x1302, 0x0000, 0xffff, 0x0a150111 },
+    { 0x1301, 0x0001, 0x0000, 0x0a150151 },
+    { 0x1302, 0x0000, 0xffff, 0x0a150111 },
+    { 0x1301, 0x0001, 0x0000, 0x0a150151 },
+    { 0x1302, 0x0000, 0xffff, 0x0a150111 },
+    { 0x1301, 0x0001, 0x0000, 0x0a150151 },
+    { 0x1302, 0x0000, 0xffff, 0x0a150111 },
+    { 0x1301, 0x0001, 0x0000, 0x0a150151 },
+    { 0x1302, 0x0000, 0xffff, 0x0a150111 },
+    { 0x1301, 0x0001, 0x0000, 0x0a150151 },
+    { 0x1302, 0x0000, 0xffff, 0x0a150111 },
+    { 0x1301, 0x0001, 0x0000, 0x0a150151 },
+    { 0x1302, 0x0000, 0xffff, 0x0a150111 },
+    { 0x1301, 0x0001, 0x0000, 0x0a150151 },
+    { 0x1302, 0x0000, 0xffff, 0x0a150111 },
+    { 0x1301, 0x0001, 0x0000, 0x0a650151 },
+    { 0x1302, 0x0000, 0xffff, 0x0a650111 },
+    { 0x1301, 0x0001, 0x0000, 0x0a650151 },
+    { 0x1302, 0x0000, 0xffff, 0x0a650111 },
+    { 0x1301, 0x0001, 0x0000, 0x0a650151 },
+    { 0x1302, 0x0000, 0xffff, 0x0a650111 },
+    { 0x1301, 0x0001, 0x0000, 0x0a650151 },
+    { 0x1302, 0x0000, 0xffff, 0x0a650111 },
+    { 0x1301, 0x0001, 0x0000, 0x0a650151 },
+    { 0x1302, 0x0000, 0xffff, 0x0a650111 },
+    { 0x1301, 0x0001, 0x0000, 0x0a650151 },
+    { 0x1302, 0x0000, 0xffff, 0x0a650111 },
+    { 0x1301, 0x0001, 0x0000, 0x0a650151 },
+    { 0x1302, 0x0000, 0xffff, 0x0a650111 },
+    { 0x1301, 0x0001, 0x0000, 0x0a650151 },
+    { 0x1302, 0x0000, 0xffff, 0x0a650111 },
+    { 0x1301, 0x0001, 0x0000, 0x0ad30161 },
+    { 0x1302, 0x0000, 0xffff, 0x0ad30111 },
+    { 0x1301, 0x0001, 0x0000, 0x0ad30161 },
+    { 0x1302, 0x0000, 0xffff, 0x0ad30111 },
+    { 0x1301, 0x0001, 0x0000, 0x0b4b0161 },
+    { 0x1302, 0x0000, 0xffff, 0x0b4b0111 },
+    { 0x1301, 0x0001, 0x0000, 0x0b4b0161 },
+    { 0x1302, 0x0000, 0xffff, 0x0b4b0111 },
+    { 0x1301, 0x0001, 0x0000, 0x0b4b0161 },
+    { 0x1302, 0x0000, 0xffff, 0x0b4b0111 },
+    { 0x1301, 0x0001, 0x0000, 0x0b4b0161 },
+    { 0x1302, 0x0000, 0xffff, 0x0b4b0111 },
+    { 0x1301, 0x0001, 0x0000, 0x0b4b0161 },
+    { 0x1302, 0x0000, 0xffff, 0x0b4b0111 },
+    { 0x1301, 0x0001, 0x0000, 0x0b4b0161 },
+    { 0x1302, 0x0000, 0xffff, 0x0b4b0111 },
+    { 0x1301, 0x0001, 0x0000, 0x0b4b0161 },
+    { 0x1302, 0x0000, 0xffff, 0x0b4b0111 },
+    { 0x1301, 0x0001, 0x0000, 0x0b4b0161 },
+    { 0x1302, 0x0000, 0xffff, 0x0b4b0111 },
+    { 0x1301, 0x0001, 0x0000, 0x0b4b0161 },
+    { 0x1302, 0x0000, 0xffff, 0x0b4b0111 },
+    { 0x1301, 0x0001, 0x0000, 0x0b4b0161 },
+    { 0x1302, 0x0000, 0xffff, 0x0b4b0111 },
+    { 0x1301, 0x0001, 0x0000, 0x0b4b0161 },
+    { 0x1302, 0x0000, 0xffff, 0x0b4b0111 },
+    { 0x1301, 0x0001, 0x0000, 0x0b4b0161 },
+    { 0x1302, 0x0000, 0xffff, 0x0b4b0111 },
+    { 0x1301, 0x0001, 0x0000, 0x0bd70141 },
+    { 0x1302, 0x0000, 0xffff, 0x0bd70111 },
+    { 0x1301, 0x0001, 0x0000, 0x0bd70141 },
+    { 0x1302, 0x0000, 0xffff, 0x0bd70111 },
+    { 0x1301, 0x0001, 0x0000, 0x0bd70141 },
+    { 0x1302, 0x0000, 0xffff, 0x0bd70111 },
+    { 0x1301, 0x0001, 0x0000, 0x0bd70141 },
+    { 0x1302, 0x0000, 0xffff, 0x0bd70111 },
+    { 0x1301, 0x0001, 0x0000, 0x0bd70141 },
+    { 0x1302, 0x0000, 0xffff, 0x0bd70111 },
+    { 0x1301, 0x0001, 0x0000, 0x0bd70141 },
+    { 0x1302, 0x0000, 0xffff, 0x0bd70111 },
+    { 0x1301, 0x0001, 0x0000, 0x0bd70141 },
+    { 0x1302, 0x0000, 0xffff, 0x0bd70111 },
+    { 0x1301, 0x0001, 0x0000, 0x0c070141 },
+    { 0x1302, 0x0000, 0xffff, 0x0c070111 },
+    { 0x1301, 0x0001, 0x0000, 0x0c070141 },
+    { 0x1302, 0x0000, 0xffff, 0x0c070111 },
+    { 0x1301, 0x0001, 0x0000, 0x0c070141 },
+    { 0x1302, 0x0000, 0xffff, 0x0c070111 },
+    { 0x1301, 0x0001, 0x0000, 0x0c070141 },
+    { 0x1302, 0x0000, 0xffff, 0x0c070111 },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    /* block 31 */
+    { 0x1302, 0x0000, 0x0008, 0x0c910111 },
+    { 0x1302, 0x0000, 0x0008, 0x0c910111 },
+    { 0x1302, 0x0000, 0x0008, 0x0c910111 },
+    { 0x1302, 0x0000, 0x0008, 0x0c910111 },
+    { 0x1302, 0x0000, 0x0008, 0x0c910111 },
+    { 0x1302, 0x0000, 0x0008, 0x0c910111 },
+    { 0x1302, 0x0000, 0x0008, 0x0c910111 },
+    { 0x1302, 0x0000, 0x0008, 0x0c910111 },
+    { 0x1301, 0xfff8, 0x0000, 0x0c910121 },
+    { 0x1301, 0xfff8, 0x0000, 0x0c910121 },
+    { 0x1301, 0xfff8, 0x0000, 0x0c910121 },
+    { 0x1301, 0xfff8, 0x0000, 0x0c910121 },
+    { 0x1301, 0xfff8, 0x0000, 0x0c910121 },
+    { 0x1301, 0xfff8, 0x0000, 0x0c910121 },
+    { 0x1301, 0xfff8, 0x0000, 0x0c910121 },
+    { 0x1301, 0xfff8, 0x0000, 0x0c910121 },
+    { 0x1302, 0x0000, 0x0008, 0x0c950111 },
+    { 0x1302, 0x0000, 0x0008, 0x0c950111 },
+    { 0x1302, 0x0000, 0x0008, 0x0c950111 },
+    { 0x1302, 0x0000, 0x0008, 0x0c950111 },
+    { 0x1302, 0x0000, 0x0008, 0x0c950111 },
+    { 0x1302, 0x0000, 0x0008, 0x0c950111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1301, 0xfff8, 0x0000, 0x0c950131 },
+    { 0x1301, 0xfff8, 0x0000, 0x0c950131 },
+    { 0x1301, 0xfff8, 0x0000, 0x0c950131 },
+    { 0x1301, 0xfff8, 0x0000, 0x0c950131 },
+    { 0x1301, 0xfff8, 0x0000, 0x0c950131 },
+    { 0x1301, 0xfff8, 0x0000, 0x0c950131 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0008, 0x0c990111 },
+    { 0x1302, 0x0000, 0x0008, 0x0c990111 },
+    { 0x1302, 0x0000, 0x0008, 0x0c990111 },
+    { 0x1302, 0x0000, 0x0008, 0x0c990111 },
+    { 0x1302, 0x0000, 0x0008, 0x0c990111 },
+    { 0x1302, 0x0000, 0x0008, 0x0c990111 },
+    { 0x1302, 0x0000, 0x0008, 0x0c990111 },
+    { 0x1302, 0x0000, 0x0008, 0x0c990111 },
+    { 0x1301, 0xfff8, 0x0000, 0x0c990121 },
+    { 0x1301, 0xfff8, 0x0000, 0x0c990121 },
+    { 0x1301, 0xfff8, 0x0000, 0x0c990121 },
+    { 0x1301, 0xfff8, 0x0000, 0x0c990121 },
+    { 0x1301, 0xfff8, 0x0000, 0x0c990121 },
+    { 0x1301, 0xfff8, 0x0000, 0x0c990121 },
+    { 0x1301, 0xfff8, 0x0000, 0x0c990121 },
+    { 0x1301, 0xfff8, 0x0000, 0x0c990121 },
+    { 0x1302, 0x0000, 0x0008, 0x0c9b0111 },
+    { 0x1302, 0x0000, 0x0008, 0x0c9b0111 },
+    { 0x1302, 0x0000, 0x0008, 0x0c9b0111 },
+    { 0x1302, 0x0000, 0x0008, 0x0c9b0111 },
+    { 0x1302, 0x0000, 0x0008, 0x0c9b0111 },
+    { 0x1302, 0x0000, 0x0008, 0x0c9b0111 },
+    { 0x1302, 0x0000, 0x0008, 0x0c9b0111 },
+    { 0x1302, 0x0000, 0x0008, 0x0c9b0111 },
+    { 0x1301, 0xfff8, 0x0000, 0x0c9b0121 },
+    { 0x1301, 0xfff8, 0x0000, 0x0c9b0121 },
+    { 0x1301, 0xfff8, 0x0000, 0x0c9b0121 },
+    { 0x1301, 0xfff8, 0x0000, 0x0c9b0121 },
+    { 0x1301, 0xfff8, 0x0000, 0x0c9b0121 },
+    { 0x1301, 0xfff8, 0x0000, 0x0c9b0121 },
+    { 0x1301, 0xfff8, 0x0000, 0x0c9b0121 },
+    { 0x1301, 0xfff8, 0x0000, 0x0c9b0121 },
+    { 0x1302, 0x0000, 0x0008, 0x0ca20111 },
+    { 0x1302, 0x0000, 0x0008, 0x0ca20111 },
+    { 0x1302, 0x0000, 0x0008, 0x0ca20111 },
+    { 0x1302, 0x0000, 0x0008, 0x0ca20111 },
+    { 0x1302, 0x0000, 0x0008, 0x0ca20111 },
+    { 0x1302, 0x0000, 0x0008, 0x0ca20111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1301, 0xfff8, 0x0000, 0x0ca20121 },
+    { 0x1301, 0xfff8, 0x0000, 0x0ca20121 },
+    { 0x1301, 0xfff8, 0x0000, 0x0ca20121 },
+    { 0x1301, 0xfff8, 0x0000, 0x0ca20121 },
+    { 0x1301, 0xfff8, 0x0000, 0x0ca20121 },
+    { 0x1301, 0xfff8, 0x0000, 0x0ca20121 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0x0ca80111 },
+    { 0x1302, 0x0000, 0x0008, 0x0ca80111 },
+    { 0x1302, 0x0000, 0x0000, 0x0ca80111 },
+    { 0x1302, 0x0000, 0x0008, 0x0ca80111 },
+    { 0x1302, 0x0000, 0x0000, 0x0ca80111 },
+    { 0x1302, 0x0000, 0x0008, 0x0ca80111 },
+    { 0x1302, 0x0000, 0x0000, 0x0ca80111 },
+    { 0x1302, 0x0000, 0x0008, 0x0ca80111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1301, 0xfff8, 0x0000, 0x0ca80121 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1301, 0xfff8, 0x0000, 0x0ca80121 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1301, 0xfff8, 0x0000, 0x0ca80121 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1301, 0xfff8, 0x0000, 0x0ca80121 },
+    { 0x1302, 0x0000, 0x0008, 0x0cac0111 },
+    { 0x1302, 0x0000, 0x0008, 0x0cac0111 },
+    { 0x1302, 0x0000, 0x0008, 0x0cac0111 },
+    { 0x1302, 0x0000, 0x0008, 0x0cac0111 },
+    { 0x1302, 0x0000, 0x0008, 0x0cac0111 },
+    { 0x1302, 0x0000, 0x0008, 0x0cac0111 },
+    { 0x1302, 0x0000, 0x0008, 0x0cac0111 },
+    { 0x1302, 0x0000, 0x0008, 0x0cac0111 },
+    { 0x1301, 0xfff8, 0x0000, 0x0cac0121 },
+    { 0x1301, 0xfff8, 0x0000, 0x0cac0121 },
+    { 0x1301, 0xfff8, 0x0000, 0x0cac0121 },
+    { 0x1301, 0xfff8, 0x0000, 0x0cac0121 },
+    { 0x1301, 0xfff8, 0x0000, 0x0cac0121 },
+    { 0x1301, 0xfff8, 0x0000, 0x0cac0121 },
+    { 0x1301, 0xfff8, 0x0000, 0x0cac0121 },
+    { 0x1301, 0xfff8, 0x0000, 0x0cac0121 },
+    { 0x1302, 0x0000, 0x004a, 0x0c910111 },
+    { 0x1302, 0x0000, 0x004a, 0x0c910111 },
+    { 0x1302, 0x0000, 0x0056, 0x0c950111 },
+    { 0x1302, 0x0000, 0x0056, 0x0c950111 },
+    { 0x1302, 0x0000, 0x0056, 0x0c990111 },
+    { 0x1302, 0x0000, 0x0056, 0x0c990111 },
+    { 0x1302, 0x0000, 0x0064, 0x0c9b0111 },
+    { 0x1302, 0x0000, 0x0064, 0x0c9b0111 },
+    { 0x1302, 0x0000, 0x0080, 0x0ca20111 },
+    { 0x1302, 0x0000, 0x0080, 0x0ca20111 },
+    { 0x1302, 0x0000, 0x0070, 0x0ca80111 },
+    { 0x1302, 0x0000, 0x0070, 0x0ca80111 },
+    { 0x1302, 0x0000, 0x007e, 0x0cac0111 },
+    { 0x1302, 0x0000, 0x007e, 0x0cac0111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0008, 0x0c910111 },
+    { 0x1302, 0x0000, 0x0008, 0x0c910111 },
+    { 0x1302, 0x0000, 0x0008, 0x0c910111 },
+    { 0x1302, 0x0000, 0x0008, 0x0c910111 },
+    { 0x1302, 0x0000, 0x0008, 0x0c910111 },
+    { 0x1302, 0x0000, 0x0008, 0x0c910111 },
+    { 0x1302, 0x0000, 0x0008, 0x0c910111 },
+    { 0x1302, 0x0000, 0x0008, 0x0c910111 },
+    { 0x1303, 0xfff8, 0x0000, 0x0c910121 },
+    { 0x1303, 0xfff8, 0x0000, 0x0c910121 },
+    { 0x1303, 0xfff8, 0x0000, 0x0c910121 },
+    { 0x1303, 0xfff8, 0x0000, 0x0c910121 },
+    { 0x1303, 0xfff8, 0x0000, 0x0c910121 },
+    { 0x1303, 0xfff8, 0x0000, 0x0c910121 },
+    { 0x1303, 0xfff8, 0x0000, 0x0c910121 },
+    { 0x1303, 0xfff8, 0x0000, 0x0c910121 },
+    { 0x1302, 0x0000, 0x0008, 0x0c990111 },
+    { 0x1302, 0x0000, 0x0008, 0x0c990111 },
+    { 0x1302, 0x0000, 0x0008, 0x0c990111 },
+    { 0x1302, 0x0000, 0x0008, 0x0c990111 },
+    { 0x1302, 0x0000, 0x0008, 0x0c990111 },
+    { 0x1302, 0x0000, 0x0008, 0x0c990111 },
+    { 0x1302, 0x0000, 0x0008, 0x0c990111 },
+    { 0x1302, 0x0000, 0x0008, 0x0c990111 },
+    { 0x1303, 0xfff8, 0x0000, 0x0c990121 },
+    { 0x1303, 0xfff8, 0x0000, 0x0c990121 },
+    { 0x1303, 0xfff8, 0x0000, 0x0c990121 },
+    { 0x1303, 0xfff8, 0x0000, 0x0c990121 },
+    { 0x1303, 0xfff8, 0x0000, 0x0c990121 },
+    { 0x1303, 0xfff8, 0x0000, 0x0c990121 },
+    { 0x1303, 0xfff8, 0x0000, 0x0c990121 },
+    { 0x1303, 0xfff8, 0x0000, 0x0c990121 },
+    { 0x1302, 0x0000, 0x0008, 0x0cac0111 },
+    { 0x1302, 0x0000, 0x0008, 0x0cac0111 },
+    { 0x1302, 0x0000, 0x0008, 0x0cac0111 },
+    { 0x1302, 0x0000, 0x0008, 0x0cac0111 },
+    { 0x1302, 0x0000, 0x0008, 0x0cac0111 },
+    { 0x1302, 0x0000, 0x0008, 0x0cac0111 },
+    { 0x1302, 0x0000, 0x0008, 0x0cac0111 },
+    { 0x1302, 0x0000, 0x0008, 0x0cac0111 },
+    { 0x1303, 0xfff8, 0x0000, 0x0cac0121 },
+    { 0x1303, 0xfff8, 0x0000, 0x0cac0121 },
+    { 0x1303, 0xfff8, 0x0000, 0x0cac0121 },
+    { 0x1303, 0xfff8, 0x0000, 0x0cac0121 },
+    { 0x1303, 0xfff8, 0x0000, 0x0cac0121 },
+    { 0x1303, 0xfff8, 0x0000, 0x0cac0121 },
+    { 0x1303, 0xfff8, 0x0000, 0x0cac0121 },
+    { 0x1303, 0xfff8, 0x0000, 0x0cac0121 },
+    { 0x1302, 0x0000, 0x0008, 0x0c910111 },
+    { 0x1302, 0x0000, 0x0008, 0x0c910111 },
+    { 0x1302, 0x0000, 0x0000, 0x0c910111 },
+    { 0x1302, 0x0000, 0x0009, 0x0c910111 },
+    { 0x1302, 0x0000, 0x0000, 0x0c910111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0x0c910111 },
+    { 0x1302, 0x0000, 0x0000, 0x0c910111 },
+    { 0x1301, 0xfff8, 0x0000, 0x0c910121 },
+    { 0x1301, 0xfff8, 0x0000, 0x0c910121 },
+    { 0x1301, 0xffb6, 0x0000, 0x0c910121 },
+    { 0x1301, 0xffb6, 0x0000, 0x0c910121 },
+    { 0x1303, 0xfff7, 0x0000, 0x0c910121 },
+    { 0xb200, 0x0000, 0x0000, 0x02170111 },
+    { 0x1302, 0x0000, 0xe3db, 0x0c9b0111 },
+    { 0xb200, 0x0000, 0x0000, 0x02170111 },
+    { 0xb200, 0x0000, 0x0000, 0x021d0111 },
+    { 0xb200, 0x0000, 0x0000, 0x02140111 },
+    { 0x1302, 0x0000, 0x0000, 0x0c990111 },
+    { 0x1302, 0x0000, 0x0009, 0x0c990111 },
+    { 0x1302, 0x0000, 0x0000, 0x0c990111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0x0c990111 },
+    { 0x1302, 0x0000, 0x0000, 0x0c990111 },
+    { 0x1301, 0xffaa, 0x0000, 0x0c950131 },
+    { 0x1301, 0xffaa, 0x0000, 0x0c950131 },
+    { 0x1301, 0xffaa, 0x0000, 0x0c990121 },
+    { 0x1301, 0xffaa, 0x0000, 0x0c990121 },
+    { 0x1303, 0xfff7, 0x0000, 0x0c990121 },
+    { 0xb200, 0x0000, 0x0000, 0x02170111 },
+    { 0xb200, 0x0000, 0x0000, 0x02170111 },
+    { 0xb200, 0x0000, 0x0000, 0x02170111 },
+    { 0x1302, 0x0000, 0x0008, 0x0c9b0111 },
+    { 0x1302, 0x0000, 0x0008, 0x0c9b0111 },
+    { 0x1302, 0x0000, 0x0000, 0x0c9b0111 },
+    { 0x1302, 0x0000, 0x0000, 0x0c9b0111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0x0c9b0111 },
+    { 0x1302, 0x0000, 0x0000, 0x0c9b0111 },
+    { 0x1301, 0xfff8, 0x0000, 0x0c9b0121 },
+    { 0x1301, 0xfff8, 0x0000, 0x0c9b0121 },
+    { 0x1301, 0xff9c, 0x0000, 0x0c9b0121 },
+    { 0x1301, 0xff9c, 0x0000, 0x0c9b0121 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0x02180111 },
+    { 0xb200, 0x0000, 0x0000, 0x02180111 },
+    { 0xb200, 0x0000, 0x0000, 0x02180111 },
+    { 0x1302, 0x0000, 0x0008, 0x0ca80111 },
+    { 0x1302, 0x0000, 0x0008, 0x0ca80111 },
+    { 0x1302, 0x0000, 0x0000, 0x0ca80111 },
+    { 0x1302, 0x0000, 0x0000, 0x0ca80111 },
+    { 0x1302, 0x0000, 0x0000, 0x0ca50111 },
+    { 0x1302, 0x0000, 0x0007, 0x0ca50111 },
+    { 0x1302, 0x0000, 0x0000, 0x0ca80111 },
+    { 0x1302, 0x0000, 0x0000, 0x0ca80111 },
+    { 0x1301, 0xfff8, 0x0000, 0x0ca80121 },
+    { 0x1301, 0xfff8, 0x0000, 0x0ca80121 },
+    { 0x1301, 0xff90, 0x0000, 0x0ca80121 },
+    { 0x1301, 0xff90, 0x0000, 0x0ca80121 },
+    { 0x1301, 0xfff9, 0x0000, 0x0ca50131 },
+    { 0xb200, 0x0000, 0x0000, 0x02140111 },
+    { 0xb200, 0x0000, 0x0000, 0x02140111 },
+    { 0xb200, 0x0000, 0x0000, 0x020c0111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0x0cac0111 },
+    { 0x1302, 0x0000, 0x0009, 0x0cac0111 },
+    { 0x1302, 0x0000, 0x0000, 0x0cac0111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0x0cac0111 },
+    { 0x1302, 0x0000, 0x0000, 0x0cac0111 },
+    { 0x1301, 0xff80, 0x0000, 0x0ca20121 },
+    { 0x1301, 0xff80, 0x0000, 0x0ca20121 },
+    { 0x1301, 0xff82, 0x0000, 0x0cac0121 },
+    { 0x1301, 0xff82, 0x0000, 0x0cac0121 },
+    { 0x1303, 0xfff7, 0x0000, 0x0cac0121 },
+    { 0xb200, 0x0000, 0x0000, 0x020d0111 },
+    { 0xb200, 0x0000, 0x0000, 0x02180111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    /* block 32 */
+    { 0xa208, 0x0000, 0x0000, 0x02090131 },
+    { 0xa208, 0x0000, 0x0000, 0x02090131 },
+    { 0xa208, 0x0000, 0x0000, 0x02090131 },
+    { 0xa208, 0x0000, 0x0000, 0x02090131 },
+    { 0xa208, 0x0000, 0x0000, 0x02090131 },
+    { 0xa208, 0x0000, 0x0000, 0x02090131 },
+    { 0xa208, 0x0000, 0x0000, 0x02090131 },
+    { 0xa208, 0x0000, 0x0000, 0x02090141 },
+    { 0xa208, 0x0000, 0x0000, 0x02090131 },
+    { 0xa208, 0x0000, 0x0000, 0x02090131 },
+    { 0xa208, 0x0000, 0x0000, 0x02090131 },
+    { 0xe220, 0x0000, 0x0000, 0x00000000 },
+    { 0xe220, 0x0000, 0x0000, 0x00000000 },
+    { 0xe220, 0x0000, 0x0000, 0x00000000 },
+    { 0x1220, 0x0000, 0x0000, 0x00000000 },
+    { 0x2220, 0x0000, 0x0000, 0x00000000 },
+    { 0xb210, 0x0000, 0x0000, 0x02250111 },
+    { 0xb210, 0x0000, 0x0000, 0x02250121 },
+    { 0xb210, 0x0000, 0x0000, 0x02260111 },
+    { 0xb210, 0x0000, 0x0000, 0x02270111 },
+    { 0xb210, 0x0000, 0x0000, 0x02280111 },
+    { 0xb210, 0x0000, 0x0000, 0x02290111 },
+    { 0xb210, 0x0000, 0x0000, 0x03a90111 },
+    { 0xb210, 0x0000, 0x0000, 0x021c0111 },
+    { 0xb210, 0x0000, 0x0000, 0x026a0111 },
+    { 0xb210, 0x0000, 0x0000, 0x026b0111 },
+    { 0xb210, 0x0000, 0x0000, 0x026c0111 },
+    { 0xb210, 0x0000, 0x0000, 0x026d0111 },
+    { 0xb210, 0x0000, 0x0000, 0x02710111 },
+    { 0xb210, 0x0000, 0x0000, 0x02720111 },
+    { 0xb210, 0x0000, 0x0000, 0x02730111 },
+    { 0xb210, 0x0000, 0x0000, 0x02740111 },
+    { 0xb210, 0x0000, 0x0000, 0x02ae0111 },
+    { 0xb210, 0x0000, 0x0000, 0x02af0111 },
+    { 0xb210, 0x0000, 0x0000, 0x02b00111 },
+    { 0xb210, 0x0000, 0x0000, 0x02b10111 },
+    { 0xb210, 0x0000, 0x0000, 0x02550131 },
+    { 0xb210, 0x0000, 0x0000, 0x02550131 },
+    { 0xb210, 0x0000, 0x0000, 0x02550131 },
+    { 0xb210, 0x0000, 0x0000, 0x02b20111 },
+    { 0xa208, 0x0000, 0x0000, 0x02070111 },
+    { 0x8208, 0x0000, 0x0000, 0x02080111 },
+    { 0xf220, 0x0000, 0x0000, 0x00000000 },
+    { 0xf220, 0x0000, 0x0000, 0x00000000 },
+    { 0xf220, 0x0000, 0x0000, 0x00000000 },
+    { 0xf220, 0x0000, 0x0000, 0x00000000 },
+    { 0xf220, 0x0000, 0x0000, 0x00000000 },
+    { 0x7208, 0x0000, 0x0000, 0x02090141 },
+    { 0x5210, 0x0000, 0x0000, 0x02ac0111 },
+    { 0x5210, 0x0000, 0x0000, 0x02ad0111 },
+    { 0x5210, 0x0000, 0x0000, 0x02b60111 },
+    { 0x5210, 0x0000, 0x0000, 0x02b60121 },
+    { 0x5210, 0x0000, 0x0000, 0x02b60121 },
+    { 0xb210, 0x0000, 0x0000, 0x02b70111 },
+    { 0xb210, 0x0000, 0x0000, 0x02b70121 },
+    { 0xb210, 0x0000, 0x0000, 0x02b70121 },
+    { 0xb210, 0x0000, 0x0000, 0x02b90111 },
+    { 0xb210, 0x0000, 0x0000, 0x026e0111 },
+    { 0xb210, 0x0000, 0x0000, 0x026f0111 },
+    { 0xb210, 0x0000, 0x0000, 0x02ba0111 },
+    { 0xb210, 0x0000, 0x0000, 0x024b0131 },
+    { 0xb210, 0x0000, 0x0000, 0x02540111 },
+    { 0xb210, 0x0000, 0x0000, 0x02110111 },
+    { 0xb210, 0x0000, 0x0000, 0x02bb0111 },
+    { 0xb210, 0x0000, 0x0000, 0x02bc0111 },
+    { 0xb210, 0x0000, 0x0000, 0x02bd0111 },
+    { 0xb210, 0x0000, 0x0000, 0x02be0111 },
+    { 0xb210, 0x0000, 0x0000, 0x02b30111 },
+    { 0x7200, 0x0000, 0x0000, 0x02a50111 },
+    { 0xb210, 0x0000, 0x0000, 0x02860111 },
+    { 0xb210, 0x0000, 0x0000, 0x02870111 },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0x024e0131 },
+    { 0xb210, 0x0000, 0x0000, 0x024b0131 },
+    { 0xb210, 0x0000, 0x0000, 0x02a80111 },
+    { 0xb210, 0x0000, 0x0000, 0x029e0111 },
+    { 0xb210, 0x0000, 0x0000, 0x02b40111 },
+    { 0xb210, 0x0000, 0x0000, 0x02b50111 },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xa208, 0x0000, 0x0000, 0xffffffff },
+    { 0xe220, 0x0000, 0x0000, 0xffffffff },
+    { 0xe220, 0x0000, 0x0000, 0xffffffff },
+    { 0xe220, 0x0000, 0x0000, 0xffffffff },
+    { 0xe220, 0x0000, 0x0000, 0xffffffff },
+    { 0xe220, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0xf220, 0x0000, 0x0000, 0xffffffff },
+    { 0xf220, 0x0000, 0x0000, 0xffffffff },
+    { 0xf220, 0x0000, 0x0000, 0xffffffff },
+    { 0xf220, 0x0000, 0x0000, 0xffffffff },
+    { 0xe220, 0x0000, 0x0000, 0x00000000 },
+    { 0xe220, 0x0000, 0x0000, 0x00000000 },
+    { 0xe220, 0x0000, 0x0000, 0x00000000 },
+    { 0xe220, 0x0000, 0x0000, 0x00000000 },
+    { 0xe220, 0x0000, 0x0000, 0x00000000 },
+    { 0xe220, 0x0000, 0x0000, 0x00000000 },
+    { 0x3200, 0x0000, 0x0000, 0x0a0b0151 },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x3200, 0x0000, 0x0000, 0x0a0f0151 },
+    { 0x3200, 0x0000, 0x0000, 0x0a100151 },
+    { 0x3200, 0x0000, 0x0000, 0x0a110151 },
+    { 0x3200, 0x0000, 0x0000, 0x0a120151 },
+    { 0x3200, 0x0000, 0x0000, 0x0a130151 },
+    { 0x3200, 0x0000, 0x0000, 0x0a140151 },
+    { 0x4200, 0x0000, 0x0000, 0x039f0151 },
+    { 0x4200, 0x0000, 0x0000, 0x03ab0121 },
+    { 0xb200, 0x0000, 0x0000, 0x03a40141 },
+    { 0xb210, 0x0000, 0x0000, 0x027a0151 },
+    { 0xb210, 0x0000, 0x0000, 0x027b0141 },
+    { 0x1302, 0x0000, 0x0000, 0x0b3301a1 },
+    { 0x3200, 0x0000, 0x0000, 0x0a0b0161 },
+    { 0x3200, 0x0000, 0x0000, 0x0a0c0161 },
+    { 0x3200, 0x0000, 0x0000, 0x0a0d0161 },
+    { 0x3200, 0x0000, 0x0000, 0x0a0e0161 },
+    { 0x3200, 0x0000, 0x0000, 0x0a0f0161 },
+    { 0x3200, 0x0000, 0x0000, 0x0a100161 },
+    { 0x3200, 0x0000, 0x0000, 0x0a110161 },
+    { 0x3200, 0x0000, 0x0000, 0x0a120161 },
+    { 0x3200, 0x0000, 0x0000, 0x0a130161 },
+    { 0x3200, 0x0000, 0x0000, 0x0a140161 },
+    { 0x4200, 0x0000, 0x0000, 0x039f0161 },
+    { 0x4200, 0x0000, 0x0000, 0x03ab0131 },
+    { 0xb200, 0x0000, 0x0000, 0x03a40151 },
+    { 0xb210, 0x0000, 0x0000, 0x027a0161 },
+    { 0xb210, 0x0000, 0x0000, 0x027b0151 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x5200, 0x0000, 0x0000, 0x09e70111 },
+    { 0x5200, 0x0000, 0x0000, 0x09e80111 },
+    { 0x5200, 0x0000, 0x0000, 0x09e90111 },
+    { 0x5200, 0x0000, 0x0000, 0x09ea0111 },
+    { 0x5200, 0x0000, 0x0000, 0x09eb0111 },
+    { 0x5200, 0x0000, 0x0000, 0x09ec0111 },
+    { 0x5200, 0x0000, 0x0000, 0x09ed0111 },
+    { 0x5200, 0x0000, 0x0000, 0x09ee0111 },
+    { 0x5200, 0x0000, 0x0000, 0x0b7f0161 },
+    { 0x5200, 0x0000, 0x0000, 0x09ef0111 },
+    { 0x5200, 0x0000, 0x0000, 0x09f00111 },
+    { 0x5200, 0x0000, 0x0000, 0x09f10111 },
+    { 0x5200, 0x0000, 0x0000, 0x09f20111 },
+    { 0x5200, 0x0000, 0x0000, 0x09f30111 },
+    { 0x5200, 0x0000, 0x0000, 0x09f40111 },
+    { 0x5200, 0x0000, 0x0000, 0x09f50111 },
+    { 0x5200, 0x0000, 0x0000, 0xffffffff },
+    { 0x5200, 0x0000, 0x0000, 0xffffffff },
+    { 0x5200, 0x0000, 0x0000, 0xffffffff },
+    { 0x5200, 0x0000, 0x0000, 0xffffffff },
+    { 0x5200, 0x0000, 0x0000, 0xffffffff },
+    { 0x5200, 0x0000, 0x0000, 0xffffffff },
+    { 0x5200, 0x0000, 0x0000, 0xffffffff },
+    { 0x5200, 0x0000, 0x0000, 0xffffffff },
+    { 0x5200, 0x0000, 0x0000, 0xffffffff },
+    { 0x5200, 0x0000, 0x0000, 0xffffffff },
+    { 0x5200, 0x0000, 0x0000, 0xffffffff },
+    { 0x5200, 0x0000, 0x0000, 0xffffffff },
+    { 0x5200, 0x0000, 0x0000, 0xffffffff },
+    { 0x5200, 0x0000, 0x0000, 0xffffffff },
+    { 0x5200, 0x0000, 0x0000, 0xffffffff },
+    { 0x5200, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0x0000e411 },
+    { 0xd200, 0x0000, 0x0000, 0x0000e511 },
+    { 0xd200, 0x0000, 0x0000, 0x0000e611 },
+    { 0xd200, 0x0000, 0x0000, 0x0000e711 },
+    { 0xd200, 0x0000, 0x0000, 0x0000e811 },
+    { 0xd200, 0x0000, 0x0000, 0x0000e911 },
+    { 0xd200, 0x0000, 0x0000, 0x0000ea11 },
+    { 0xd200, 0x0000, 0x0000, 0x0000eb11 },
+    { 0xd200, 0x0000, 0x0000, 0x0000ec11 },
+    { 0xd200, 0x0000, 0x0000, 0x0000ed11 },
+    { 0xd200, 0x0000, 0x0000, 0x0000ee11 },
+    { 0xd200, 0x0000, 0x0000, 0x0000ef11 },
+    { 0xd200, 0x0000, 0x0000, 0x0000f011 },
+    { 0xd200, 0x0000, 0x0000, 0x0000f111 },
+    { 0xd200, 0x0000, 0x0000, 0x0000f211 },
+    { 0xd200, 0x0000, 0x0000, 0x0000f311 },
+    { 0xd200, 0x0000, 0x0000, 0x0000f411 },
+    { 0xd200, 0x0000, 0x0000, 0x0000f511 },
+    { 0xd200, 0x0000, 0x0000, 0x0000f611 },
+    { 0xd200, 0x0000, 0x0000, 0x0000f711 },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    /* block 33 */
+    { 0xb200, 0x0000, 0x0000, 0x0a150131 },
+    { 0xb200, 0x0000, 0x0000, 0x0a150131 },
+    { 0x1301, 0x0000, 0x0000, 0x0a3d0181 },
+    { 0xb200, 0x0000, 0x0000, 0x030a0121 },
+    { 0xb200, 0x0000, 0x0000, 0x09f60111 },
+    { 0xb200, 0x0000, 0x0000, 0x0a3d0131 },
+    { 0xb200, 0x0000, 0x0000, 0x0a3d0131 },
+    { 0x1301, 0x0000, 0x0000, 0x0a710131 },
+    { 0xb200, 0x0000, 0x0000, 0x09f70111 },
+    { 0xb200, 0x0000, 0x0000, 0x030a0121 },
+    { 0x1302, 0x0000, 0x0000, 0x0a990131 },
+    { 0x1301, 0x0000, 0x0000, 0x0ab90171 },
+    { 0x1301, 0x0000, 0x0000, 0x0ab90171 },
+    { 0x1301, 0x0000, 0x0000, 0x0ab90171 },
+    { 0x1302, 0x0000, 0x0000, 0x0ab90131 },
+    { 0x1302, 0x0000, 0x0000, 0x0ac50121 },
+    { 0x1301, 0x0000, 0x0000, 0x0ad30191 },
+    { 0x1301, 0x0000, 0x0000, 0x0ad30191 },
+    { 0x1301, 0x0000, 0x0000, 0x0b030191 },
+    { 0x1302, 0x0000, 0x0000, 0x0b030141 },
+    { 0xb200, 0x0000, 0x0000, 0x09f80111 },
+    { 0x1301, 0x0000, 0x0000, 0x0b330181 },
+    { 0xb200, 0x0000, 0x0000, 0x0b330171 },
+    { 0xb200, 0x0000, 0x0000, 0x09f90111 },
+    { 0xb200, 0x0000, 0x0000, 0x09fa0111 },
+    { 0x1301, 0x0000, 0x0000, 0x0b670161 },
+    { 0x1301, 0x0000, 0x0000, 0x0b730161 },
+    { 0x1301, 0x0000, 0x0000, 0x0b7f0171 },
+    { 0x1301, 0x0000, 0x0000, 0x0b7f0171 },
+    { 0x1301, 0x0000, 0x0000, 0x0b7f0171 },
+    { 0xb200, 0x0000, 0x0000, 0x09fb0111 },
+    { 0xb200, 0x0000, 0x0000, 0x09fc0111 },
+    { 0xb200, 0x0000, 0x0000, 0x0ba70181 },
+    { 0xb200, 0x0000, 0x0000, 0x0bbf0171 },
+    { 0xb200, 0x0000, 0x0000, 0x0bbf0191 },
+    { 0xb200, 0x0000, 0x0000, 0x09fd0111 },
+    { 0x1301, 0x0000, 0x0000, 0x0c130161 },
+    { 0xb200, 0x0000, 0x0000, 0x09fe0111 },
+    { 0x1301, 0xe2a3, 0x0000, 0x0cac0121 },
+    { 0xb200, 0x0000, 0x0000, 0x09ff0111 },
+    { 0x1301, 0x0000, 0x0000, 0x0c130161 },
+    { 0xb200, 0x0000, 0x0000, 0x0a000111 },
+    { 0x1301, 0xdf41, 0x0000, 0x0af70141 },
+    { 0x1301, 0xdfba, 0x0000, 0x0a150151 },
+    { 0x1301, 0x0000, 0x0000, 0x0a290161 },
+    { 0x1301, 0x0000, 0x0000, 0x0a3d0181 },
+    { 0x5200, 0x0000, 0x0000, 0x0a010111 },
+    { 0x1302, 0x0000, 0x0000, 0x0a650131 },
+    { 0x1301, 0x0000, 0x0000, 0x0a650171 },
+    { 0x1301, 0x0000, 0x0000, 0x0a910171 },
+    { 0x1301, 0x001c, 0x0000, 0x0a020111 },
+    { 0x1301, 0x0000, 0x0000, 0x0b2b0181 },
+    { 0x1302, 0x0000, 0x0000, 0x0b4b0141 },
+    { 0x1300, 0x0000, 0x0000, 0x0eb70121 },
+    { 0x1300, 0x0000, 0x0000, 0x0eb80121 },
+    { 0x1300, 0x0000, 0x0000, 0x0eb90121 },
+    { 0x1300, 0x0000, 0x0000, 0x0eba0121 },
+    { 0x1302, 0x0000, 0x0000, 0x0ad30141 },
+    { 0xb200, 0x0000, 0x0000, 0x0a030111 },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1301, 0x0000, 0x0000, 0xffffffff },
+    { 0x1301, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1301, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffe4, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0x0a0c0171 },
+    { 0xb200, 0x0000, 0x0000, 0x0a0d0171 },
+    { 0xb200, 0x0000, 0x0000, 0x0a0c0171 },
+    { 0xb200, 0x0000, 0x0000, 0x0a0d0171 },
+    { 0xb200, 0x0000, 0x0000, 0x0a0e0171 },
+    { 0xb200, 0x0000, 0x0000, 0x0a0f0171 },
+    { 0xb200, 0x0000, 0x0000, 0x0a0c0171 },
+    { 0xb200, 0x0000, 0x0000, 0x0a100171 },
+    { 0xb200, 0x0000, 0x0000, 0x0a0c0171 },
+    { 0xb200, 0x0000, 0x0000, 0x0a0e0171 },
+    { 0xb200, 0x0000, 0x0000, 0x0a100171 },
+    { 0xb200, 0x0000, 0x0000, 0x0a120171 },
+    { 0xb200, 0x0000, 0x0000, 0x0a0c0171 },
+    { 0x1300, 0x0010, 0x0000, 0x0ad30181 },
+    { 0x1300, 0x0010, 0x0000, 0x0ad30181 },
+    { 0x1300, 0x0010, 0x0000, 0x0ad30181 },
+    { 0x1300, 0x0010, 0x0000, 0x0ad30181 },
+    { 0x1300, 0x0010, 0x0000, 0x0bef0171 },
+    { 0x1300, 0x0010, 0x0000, 0x0bef0171 },
+    { 0x1300, 0x0010, 0x0000, 0x0bef0171 },
+    { 0x1300, 0x0010, 0x0000, 0x0bef0171 },
+    { 0x1300, 0x0010, 0x0000, 0x0ad30181 },
+    { 0x1300, 0x0010, 0x0000, 0x0c030171 },
+    { 0x1300, 0x0010, 0x0000, 0x0c030171 },
+    { 0x1300, 0x0010, 0x0000, 0x0c030171 },
+    { 0x1300, 0x0010, 0x0000, 0x0b030181 },
+    { 0x1300, 0x0010, 0x0000, 0x0a3d0171 },
+    { 0x1300, 0x0010, 0x0000, 0x0a490171 },
+    { 0x1300, 0x0010, 0x0000, 0x0b2b0171 },
+    { 0x1300, 0x0000, 0xfff0, 0x0ad30131 },
+    { 0x1300, 0x0000, 0xfff0, 0x0ad30131 },
+    { 0x1300, 0x0000, 0xfff0, 0x0ad30131 },
+    { 0x1300, 0x0000, 0xfff0, 0x0ad30131 },
+    { 0x1300, 0x0000, 0xfff0, 0x0bef0131 },
+    { 0x1300, 0x0000, 0xfff0, 0x0bef0131 },
+    { 0x1300, 0x0000, 0xfff0, 0x0bef0131 },
+    { 0x1300, 0x0000, 0xfff0, 0x0bef0131 },
+    { 0x1300, 0x0000, 0xfff0, 0x0ad30131 },
+    { 0x1300, 0x0000, 0xfff0, 0x0c030131 },
+    { 0x1300, 0x0000, 0xfff0, 0x0c030131 },
+    { 0x1300, 0x0000, 0xfff0, 0x0c030131 },
+    { 0x1300, 0x0000, 0xfff0, 0x0b030131 },
+    { 0x1300, 0x0000, 0xfff0, 0x0a3d0131 },
+    { 0x1300, 0x0000, 0xfff0, 0x0a490131 },
+    { 0x1300, 0x0000, 0xfff0, 0x0b2b0131 },
+    { 0x1300, 0x0000, 0x0000, 0x0a040111 },
+    { 0x1300, 0x0000, 0x0000, 0x0a050111 },
+    { 0x1300, 0x0000, 0x0000, 0x0a060111 },
+    { 0x1301, 0x0001, 0x0000, 0x0a070111 },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0x03320111 },
+    { 0xb200, 0x0000, 0x0000, 0x03340111 },
+    { 0xb200, 0x0000, 0x0000, 0x03330111 },
+    { 0xb200, 0x0000, 0x0000, 0x03350111 },
+    { 0xb200, 0x0000, 0x0000, 0x03360111 },
+    { 0xb200, 0x0000, 0x0000, 0x03370111 },
+    { 0xb200, 0x0000, 0x0000, 0x03380111 },
+    { 0xb200, 0x0000, 0x0000, 0x03390111 },
+    { 0xb200, 0x0000, 0x0000, 0x033a0111 },
+    { 0xb200, 0x0000, 0x0000, 0x033b0111 },
+    { 0xb200, 0x0000, 0x0000, 0x03320111 },
+    { 0xb200, 0x0000, 0x0000, 0x03330111 },
+    { 0xb200, 0x0000, 0x0000, 0x033c0111 },
+    { 0xb200, 0x0000, 0x0000, 0x033d0111 },
+    { 0xb200, 0x0000, 0x0000, 0x033e0111 },
+    { 0xb200, 0x0000, 0x0000, 0x033f0111 },
+    { 0xb200, 0x0000, 0x0000, 0x03400111 },
+    { 0xb200, 0x0000, 0x0000, 0x03410111 },
+    { 0xb200, 0x0000, 0x0000, 0x03420111 },
+    { 0xb200, 0x0000, 0x0000, 0x03430111 },
+    { 0xb200, 0x0000, 0x0000, 0x03440111 },
+    { 0xb200, 0x0000, 0x0000, 0x03450111 },
+    { 0xb200, 0x0000, 0x0000, 0x03460111 },
+    { 0xb200, 0x0000, 0x0000, 0x03470111 },
+    { 0xb200, 0x0000, 0x0000, 0x03480111 },
+    { 0xb200, 0x0000, 0x0000, 0x03490111 },
+    { 0xb200, 0x0000, 0x0000, 0x034a0111 },
+    { 0xb200, 0x0000, 0x0000, 0x034b0111 },
+    { 0xb200, 0x0000, 0x0000, 0x034c0111 },
+    { 0xb200, 0x0000, 0x0000, 0x034d0111 },
+    { 0xb200, 0x0000, 0x0000, 0x03360111 },
+    { 0xb200, 0x0000, 0x0000, 0x034e0111 },
+    { 0xb200, 0x0000, 0x0000, 0x034f0111 },
+    { 0xb200, 0x0000, 0x0000, 0x03500111 },
+    { 0xb200, 0x0000, 0x0000, 0x03510111 },
+    { 0xb200, 0x0000, 0x0000, 0x03520111 },
+    { 0xb200, 0x0000, 0x0000, 0x03530111 },
+    { 0xb200, 0x0000, 0x0000, 0x03540111 },
+    { 0xb200, 0x0000, 0x0000, 0x03550111 },
+    { 0xb200, 0x0000, 0x0000, 0x03560111 },
+    { 0xb200, 0x0000, 0x0000, 0x03570111 },
+    { 0xb200, 0x0000, 0x0000, 0x03580111 },
+    { 0xb200, 0x0000, 0x0000, 0x03590111 },
+    { 0xb200, 0x0000, 0x0000, 0x035a0111 },
+    { 0xb200, 0x0000, 0x0000, 0x035b0111 },
+    { 0xb200, 0x0000, 0x0000, 0x035c0111 },
+    { 0xb200, 0x0000, 0x0000, 0x035d0111 },
+    { 0xb200, 0x0000, 0x0000, 0x035e0111 },
+    { 0xb200, 0x0000, 0x0000, 0x035f0111 },
+    { 0xb200, 0x0000, 0x0000, 0x03600111 },
+    { 0xb200, 0x0000, 0x0000, 0x03610111 },
+    { 0xb200, 0x0000, 0x0000, 0x03620111 },
+    { 0xb200, 0x0000, 0x0000, 0x03630111 },
+    { 0xb200, 0x0000, 0x0000, 0x03640111 },
+    { 0xb200, 0x0000, 0x0000, 0x03650111 },
+    { 0xb200, 0x0000, 0x0000, 0x03660111 },
+    { 0xb200, 0x0000, 0x0000, 0x03670111 },
+    { 0xb200, 0x0000, 0x0000, 0x03680111 },
+    { 0xb200, 0x0000, 0x0000, 0x03690111 },
+    { 0xb200, 0x0000, 0x0000, 0x036a0111 },
+    { 0xb200, 0x0000, 0x0000, 0x036b0111 },
+    { 0xb200, 0x0000, 0x0000, 0x036c0111 },
+    { 0xb200, 0x0000, 0x0000, 0x03700111 },
+    { 0xb200, 0x0000, 0x0000, 0x036e0111 },
+    { 0xb200, 0x0000, 0x0000, 0x036c0111 },
+    { 0xb200, 0x0000, 0x0000, 0x036d0111 },
+    { 0xb200, 0x0000, 0x0000, 0x036e0111 },
+    { 0xb200, 0x0000, 0x0000, 0x036f0111 },
+    { 0xb200, 0x0000, 0x0000, 0x03700111 },
+    { 0xb200, 0x0000, 0x0000, 0x03710111 },
+    { 0xb200, 0x0000, 0x0000, 0x03720111 },
+    { 0xb200, 0x0000, 0x0000, 0x03730111 },
+    { 0xb200, 0x0000, 0x0000, 0x03740111 },
+    { 0xb200, 0x0000, 0x0000, 0x03750111 },
+    { 0xb200, 0x0000, 0x0000, 0x03760111 },
+    { 0xb200, 0x0000, 0x0000, 0x03770111 },
+    { 0xb200, 0x0000, 0x0000, 0x03780111 },
+    { 0xb200, 0x0000, 0x0000, 0x03790111 },
+    { 0xb200, 0x0000, 0x0000, 0x037a0111 },
+    { 0xb200, 0x0000, 0x0000, 0x037b0111 },
+    { 0xb200, 0x0000, 0x0000, 0x037c0111 },
+    { 0xb200, 0x0000, 0x0000, 0x037d0111 },
+    { 0xb200, 0x0000, 0x0000, 0x037e0111 },
+    { 0xb200, 0x0000, 0x0000, 0x037f0111 },
+    { 0xb200, 0x0000, 0x0000, 0x03800111 },
+    { 0xb200, 0x0000, 0x0000, 0x03810111 },
+    { 0xb200, 0x0000, 0x0000, 0x03820111 },
+    { 0xb200, 0x0000, 0x0000, 0x03830111 },
+    { 0xb200, 0x0000, 0x0000, 0x03840111 },
+    { 0xb200, 0x0000, 0x0000, 0x03850111 },
+    { 0xb200, 0x0000, 0x0000, 0x03860111 },
+    { 0xb200, 0x0000, 0x0000, 0x03870111 },
+    { 0xb200, 0x0000, 0x0000, 0x03880111 },
+    { 0xb200, 0x0000, 0x0000, 0x03890111 },
+    { 0xb200, 0x0000, 0x0000, 0x038a0111 },
+    { 0xb200, 0x0000, 0x0000, 0x038b0111 },
+    { 0xb200, 0x0000, 0x0000, 0x038c0111 },
+    { 0xb200, 0x0000, 0x0000, 0x038d0111 },
+    { 0xb200, 0x0000, 0x0000, 0x038e0111 },
+    { 0xb200, 0x0000, 0x0000, 0x038f0111 },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    /* block 34 */
+    { 0xb200, 0x0000, 0x0000, 0x03900111 },
+    { 0xb200, 0x0000, 0x0000, 0x03910111 },
+    { 0xb200, 0x0000, 0x0000, 0x03920111 },
+    { 0xb200, 0x0000, 0x0000, 0x03930111 },
+    { 0xb200, 0x0000, 0x0000, 0x03930111 },
+    { 0xb200, 0x0000, 0x0000, 0x03940111 },
+    { 0xb200, 0x0000, 0x0000, 0x03950111 },
+    { 0xb200, 0x0000, 0x0000, 0x03960111 },
+    { 0xb200, 0x0000, 0x0000, 0x03970111 },
+    { 0xb200, 0x0000, 0x0000, 0x03970111 },
+    { 0xb200, 0x0000, 0x0000, 0x03980111 },
+    { 0xb200, 0x0000, 0x0000, 0x03990111 },
+    { 0xb200, 0x0000, 0x0000, 0x03990111 },
+    { 0xb200, 0x0000, 0x0000, 0x039a0111 },
+    { 0xb200, 0x0000, 0x0000, 0x039b0111 },
+    { 0xb200, 0x0000, 0x0000, 0x039c0111 },
+    { 0xb200, 0x0000, 0x0000, 0x039d0111 },
+    { 0xb200, 0x0000, 0x0000, 0x039e0111 },
+    { 0x4200, 0x0000, 0x0000, 0x03ab0111 },
+    { 0x5200, 0x0000, 0x0000, 0x03ac0111 },
+    { 0xb200, 0x0000, 0x0000, 0x03ad0111 },
+    { 0xb200, 0x0000, 0x0000, 0x03ae0111 },
+    { 0xb200, 0x0000, 0x0000, 0x03af0111 },
+    { 0xb200, 0x0000, 0x0000, 0x03b00111 },
+    { 0xb200, 0x0000, 0x0000, 0x03b10111 },
+    { 0xb200, 0x0000, 0x0000, 0x03b20111 },
+    { 0xb200, 0x0000, 0x0000, 0x03b30111 },
+    { 0xb200, 0x0000, 0x0000, 0x03b40111 },
+    { 0xb200, 0x0000, 0x0000, 0x03b50111 },
+    { 0xb200, 0x0000, 0x0000, 0x03b60111 },
+    { 0xb200, 0x0000, 0x0000, 0x03b70111 },
+    { 0xb200, 0x0000, 0x0000, 0x03b80111 },
+    { 0xb200, 0x0000, 0x0000, 0x03b90111 },
+    { 0xb200, 0x0000, 0x0000, 0x03ba0111 },
+    { 0xb200, 0x0000, 0x0000, 0x03bb0111 },
+    { 0xb200, 0x0000, 0x0000, 0x03bc0111 },
+    { 0xb200, 0x0000, 0x0000, 0x03bc0111 },
+    { 0xb200, 0x0000, 0x0000, 0x03bd0111 },
+    { 0xb200, 0x0000, 0x0000, 0x03bd0111 },
+    { 0xb200, 0x0000, 0x0000, 0x03be0111 },
+    { 0xb200, 0x0000, 0x0000, 0x03bf0111 },
+    { 0xb200, 0x0000, 0x0000, 0x03c00111 },
+    { 0xb200, 0x0000, 0x0000, 0x03c10111 },
+    { 0xb200, 0x0000, 0x0000, 0x03c20111 },
+    { 0xb200, 0x0000, 0x0000, 0x03c20121 },
+    { 0xb200, 0x0000, 0x0000, 0x03c20121 },
+    { 0xb200, 0x0000, 0x0000, 0x03c30111 },
+    { 0xb200, 0x0000, 0x0000, 0x03c30121 },
+    { 0xb200, 0x0000, 0x0000, 0x03c30121 },
+    { 0xb200, 0x0000, 0x0000, 0x03c40111 },
+    { 0xb200, 0x0000, 0x0000, 0x03c50111 },
+    { 0xb200, 0x0000, 0x0000, 0x03c60111 },
+    { 0xb200, 0x0000, 0x0000, 0x03c70111 },
+    { 0xb200, 0x0000, 0x0000, 0x03c80111 },
+    { 0xb200, 0x0000, 0x0000, 0x03c90111 },
+    { 0xb200, 0x0000, 0x0000, 0x03ca0111 },
+    { 0xb200, 0x0000, 0x0000, 0x03cb0111 },
+    { 0xb200, 0x0000, 0x0000, 0x03cc0111 },
+    { 0xb200, 0x0000, 0x0000, 0x03cd0111 },
+    { 0xb200, 0x0000, 0x0000, 0x03ce0111 },
+    { 0xb200, 0x0000, 0x0000, 0x03cf0111 },
+    { 0xb200, 0x0000, 0x0000, 0x03d00111 },
+    { 0xb200, 0x0000, 0x0000, 0x03d10111 },
+    { 0xb200, 0x0000, 0x0000, 0x03d20111 },
+    { 0xb200, 0x0000, 0x0000, 0x03d30111 },
+    { 0xb200, 0x0000, 0x0000, 0x03cf0111 },
+    { 0xb200, 0x0000, 0x0000, 0x03d40111 },
+    { 0xb200, 0x0000, 0x0000, 0x03d50111 },
+    { 0xb200, 0x0000, 0x0000, 0x03d50111 },
+    { 0xb200, 0x0000, 0x0000, 0x03d60111 },
+    { 0xb200, 0x0000, 0x0000, 0x03d70111 },
+    { 0xb200, 0x0000, 0x0000, 0x03d60111 },
+    { 0xb200, 0x0000, 0x0000, 0x03d80111 },
+    { 0xb200, 0x0000, 0x0000, 0x03d80111 },
+    { 0xb200, 0x0000, 0x0000, 0x03d90111 },
+    { 0xb200, 0x0000, 0x0000, 0x03da0111 },
+    { 0xb200, 0x0000, 0x0000, 0x03db0111 },
+    { 0xb200, 0x0000, 0x0000, 0x03dc0111 },
+    { 0xb200, 0x0000, 0x0000, 0x03dd0111 },
+    { 0xb200, 0x0000, 0x0000, 0x03de0111 },
+    { 0xb200, 0x0000, 0x0000, 0x03df0111 },
+    { 0xb200, 0x0000, 0x0000, 0x03e00111 },
+    { 0xb200, 0x0000, 0x0000, 0x03e10111 },
+    { 0xb200, 0x0000, 0x0000, 0x03e20111 },
+    { 0xb200, 0x0000, 0x0000, 0x03e30111 },
+    { 0xb200, 0x0000, 0x0000, 0x03e40111 },
+    { 0xb200, 0x0000, 0x0000, 0x03e50111 },
+    { 0xb200, 0x0000, 0x0000, 0x03e60111 },
+    { 0xb200, 0x0000, 0x0000, 0x03e70111 },
+    { 0xb200, 0x0000, 0x0000, 0x03e80111 },
+    { 0xb200, 0x0000, 0x0000, 0x03e90111 },
+    { 0xb200, 0x0000, 0x0000, 0x03ea0111 },
+    { 0xb200, 0x0000, 0x0000, 0x03eb0111 },
+    { 0xb200, 0x0000, 0x0000, 0x03ec0111 },
+    { 0xb200, 0x0000, 0x0000, 0x03ed0111 },
+    { 0xb200, 0x0000, 0x0000, 0x03ee0111 },
+    { 0xb200, 0x0000, 0x0000, 0x03a40111 },
+    { 0xb200, 0x0000, 0x0000, 0x03ef0111 },
+    { 0xb200, 0x0000, 0x0000, 0x03ef0111 },
+    { 0xb200, 0x0000, 0x0000, 0x03f00111 },
+    { 0xb200, 0x0000, 0x0000, 0x03f10111 },
+    { 0xb200, 0x0000, 0x0000, 0x03f20111 },
+    { 0xb200, 0x0000, 0x0000, 0x03f30111 },
+    { 0xb200, 0x0000, 0x0000, 0x03f40111 },
+    { 0xb200, 0x0000, 0x0000, 0x03f50111 },
+    { 0xb200, 0x0000, 0x0000, 0x03f60111 },
+    { 0xb200, 0x0000, 0x0000, 0x03f70111 },
+    { 0xb200, 0x0000, 0x0000, 0x03f80111 },
+    { 0xb200, 0x0000, 0x0000, 0x03f90111 },
+    { 0xb200, 0x0000, 0x0000, 0x03dc0111 },
+    { 0xb200, 0x0000, 0x0000, 0x03a30111 },
+    { 0xb200, 0x0000, 0x0000, 0x03a50111 },
+    { 0xb200, 0x0000, 0x0000, 0x03f10111 },
+    { 0xb200, 0x0000, 0x0000, 0x03f20111 },
+    { 0xb200, 0x0000, 0x0000, 0x03fa0111 },
+    { 0xb200, 0x0000, 0x0000, 0x03fb0111 },
+    { 0xb200, 0x0000, 0x0000, 0x03fa0111 },
+    { 0xb200, 0x0000, 0x0000, 0x03fb0111 },
+    { 0xb200, 0x0000, 0x0000, 0x03fc0111 },
+    { 0xb200, 0x0000, 0x0000, 0x03fd0111 },
+    { 0xb200, 0x0000, 0x0000, 0x03fc0111 },
+    { 0xb200, 0x0000, 0x0000, 0x03fd0111 },
+    { 0xb200, 0x0000, 0x0000, 0x03fe0111 },
+    { 0xb200, 0x0000, 0x0000, 0x03ff0111 },
+    { 0xb200, 0x0000, 0x0000, 0x04000111 },
+    { 0xb200, 0x0000, 0x0000, 0x04010111 },
+    { 0xb200, 0x0000, 0x0000, 0x04020111 },
+    { 0xb200, 0x0000, 0x0000, 0x04030111 },
+    { 0xb200, 0x0000, 0x0000, 0x03fe0111 },
+    { 0xb200, 0x0000, 0x0000, 0x03ff0111 },
+    { 0xb200, 0x0000, 0x0000, 0x04040111 },
+    { 0xb200, 0x0000, 0x0000, 0x04050111 },
+    { 0xb200, 0x0000, 0x0000, 0x04040111 },
+    { 0xb200, 0x0000, 0x0000, 0x04050111 },
+    { 0xb200, 0x0000, 0x0000, 0x04060111 },
+    { 0xb200, 0x0000, 0x0000, 0x04070111 },
+    { 0xb200, 0x0000, 0x0000, 0x04060111 },
+    { 0xb200, 0x0000, 0x0000, 0x04070111 },
+    { 0xb200, 0x0000, 0x0000, 0x04080111 },
+    { 0xb200, 0x0000, 0x0000, 0x04090111 },
+    { 0xb200, 0x0000, 0x0000, 0x040a0111 },
+    { 0xb200, 0x0000, 0x0000, 0x040b0111 },
+    { 0xb200, 0x0000, 0x0000, 0x040c0111 },
+    { 0xb200, 0x0000, 0x0000, 0x040d0111 },
+    { 0xb200, 0x0000, 0x0000, 0x040e0111 },
+    { 0xb200, 0x0000, 0x0000, 0x040f0111 },
+    { 0xb200, 0x0000, 0x0000, 0x04100111 },
+    { 0xb200, 0x0000, 0x0000, 0x04110111 },
+    { 0xb200, 0x0000, 0x0000, 0x04120111 },
+    { 0xb200, 0x0000, 0x0000, 0x04130111 },
+    { 0xb200, 0x0000, 0x0000, 0x04140111 },
+    { 0xb200, 0x0000, 0x0000, 0x04150111 },
+    { 0xb200, 0x0000, 0x0000, 0x04160111 },
+    { 0xb200, 0x0000, 0x0000, 0x04170111 },
+    { 0xb200, 0x0000, 0x0000, 0x04180111 },
+    { 0xb200, 0x0000, 0x0000, 0x04190111 },
+    { 0xb200, 0x0000, 0x0000, 0x041a0111 },
+    { 0xb200, 0x0000, 0x0000, 0x041b0111 },
+    { 0xb200, 0x0000, 0x0000, 0x041c0111 },
+    { 0xb200, 0x0000, 0x0000, 0x041d0111 },
+    { 0xb200, 0x0000, 0x0000, 0x041e0111 },
+    { 0xb200, 0x0000, 0x0000, 0x041f0111 },
+    { 0xb200, 0x0000, 0x0000, 0x04200111 },
+    { 0xb200, 0x0000, 0x0000, 0x04210111 },
+    { 0xb200, 0x0000, 0x0000, 0x04220111 },
+    { 0xb200, 0x0000, 0x0000, 0x04230111 },
+    { 0xb200, 0x0000, 0x0000, 0x04240111 },
+    { 0xb200, 0x0000, 0x0000, 0x04250111 },
+    { 0xb200, 0x0000, 0x0000, 0x04260111 },
+    { 0xb200, 0x0000, 0x0000, 0x04270111 },
+    { 0xb200, 0x0000, 0x0000, 0x04280111 },
+    { 0xb200, 0x0000, 0x0000, 0x04290111 },
+    { 0xb200, 0x0000, 0x0000, 0x04200111 },
+    { 0xb200, 0x0000, 0x0000, 0x04260111 },
+    { 0xb200, 0x0000, 0x0000, 0x04270111 },
+    { 0xb200, 0x0000, 0x0000, 0x04290111 },
+    { 0xb200, 0x0000, 0x0000, 0x042a0111 },
+    { 0xb200, 0x0000, 0x0000, 0x042b0111 },
+    { 0xb200, 0x0000, 0x0000, 0x042c0111 },
+    { 0xb200, 0x0000, 0x0000, 0x042d0111 },
+    { 0xb200, 0x0000, 0x0000, 0x042e0111 },
+    { 0xb200, 0x0000, 0x0000, 0x042f0111 },
+    { 0xb200, 0x0000, 0x0000, 0x04300111 },
+    { 0xb200, 0x0000, 0x0000, 0x04310111 },
+    { 0xb200, 0x0000, 0x0000, 0x04320111 },
+    { 0xb200, 0x0000, 0x0000, 0x04330111 },
+    { 0xb200, 0x0000, 0x0000, 0x04340111 },
+    { 0xb200, 0x0000, 0x0000, 0x04350111 },
+    { 0xb200, 0x0000, 0x0000, 0x04360111 },
+    { 0xb200, 0x0000, 0x0000, 0x04370111 },
+    { 0xb200, 0x0000, 0x0000, 0x04380111 },
+    { 0xb200, 0x0000, 0x0000, 0x04390111 },
+    { 0xb200, 0x0000, 0x0000, 0x043a0111 },
+    { 0xb200, 0x0000, 0x0000, 0x043b0111 },
+    { 0xb200, 0x0000, 0x0000, 0x043c0111 },
+    { 0xb200, 0x0000, 0x0000, 0x043d0111 },
+    { 0xb200, 0x0000, 0x0000, 0x043e0111 },
+    { 0xb200, 0x0000, 0x0000, 0x043f0111 },
+    { 0xb200, 0x0000, 0x0000, 0x04400111 },
+    { 0xb200, 0x0000, 0x0000, 0x04410111 },
+    { 0xb200, 0x0000, 0x0000, 0x04420111 },
+    { 0xb200, 0x0000, 0x0000, 0x04430111 },
+    { 0xb200, 0x0000, 0x0000, 0x04440111 },
+    { 0xb200, 0x0000, 0x0000, 0x04450111 },
+    { 0xb200, 0x0000, 0x0000, 0x04460111 },
+    { 0xb200, 0x0000, 0x0000, 0x04470111 },
+    { 0xb200, 0x0000, 0x0000, 0x04480111 },
+    { 0xb200, 0x0000, 0x0000, 0x04490111 },
+    { 0xb200, 0x0000, 0x0000, 0x044a0111 },
+    { 0xb200, 0x0000, 0x0000, 0x044b0111 },
+    { 0xb200, 0x0000, 0x0000, 0x044c0111 },
+    { 0xb200, 0x0000, 0x0000, 0x044d0111 },
+    { 0xb200, 0x0000, 0x0000, 0x044e0111 },
+    { 0xb200, 0x0000, 0x0000, 0x044f0111 },
+    { 0xb200, 0x0000, 0x0000, 0x04500111 },
+    { 0xb200, 0x0000, 0x0000, 0x04510111 },
+    { 0xb200, 0x0000, 0x0000, 0x04520111 },
+    { 0xb200, 0x0000, 0x0000, 0x04530111 },
+    { 0xb200, 0x0000, 0x0000, 0x04540111 },
+    { 0xb200, 0x0000, 0x0000, 0x04550111 },
+    { 0xb200, 0x0000, 0x0000, 0x04560111 },
+    { 0xb200, 0x0000, 0x0000, 0x04570111 },
+    { 0xb200, 0x0000, 0x0000, 0x04580111 },
+    { 0xb200, 0x0000, 0x0000, 0x04590111 },
+    { 0xb200, 0x0000, 0x0000, 0x04000111 },
+    { 0xb200, 0x0000, 0x0000, 0x04010111 },
+    { 0xb200, 0x0000, 0x0000, 0x040f0111 },
+    { 0xb200, 0x0000, 0x0000, 0x04100111 },
+    { 0xb200, 0x0000, 0x0000, 0x045a0111 },
+    { 0xb200, 0x0000, 0x0000, 0x045b0111 },
+    { 0xb200, 0x0000, 0x0000, 0x045c0111 },
+    { 0xb200, 0x0000, 0x0000, 0x045d0111 },
+    { 0xb200, 0x0000, 0x0000, 0x045e0111 },
+    { 0xb200, 0x0000, 0x0000, 0x045f0111 },
+    { 0xb200, 0x0000, 0x0000, 0x042c0111 },
+    { 0xb200, 0x0000, 0x0000, 0x042d0111 },
+    { 0xb200, 0x0000, 0x0000, 0x042e0111 },
+    { 0xb200, 0x0000, 0x0000, 0x042f0111 },
+    { 0xb200, 0x0000, 0x0000, 0x04600111 },
+    { 0xb200, 0x0000, 0x0000, 0x04610111 },
+    { 0xb200, 0x0000, 0x0000, 0x04620111 },
+    { 0xb200, 0x0000, 0x0000, 0x04630111 },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    /* block 35 */
+    { 0xb200, 0x0000, 0x0000, 0x04640111 },
+    { 0xb200, 0x0000, 0x0000, 0x04650111 },
+    { 0xb200, 0x0000, 0x0000, 0x04660111 },
+    { 0xb200, 0x0000, 0x0000, 0x04670111 },
+    { 0xb200, 0x0000, 0x0000, 0x04680111 },
+    { 0xb200, 0x0000, 0x0000, 0x04690111 },
+    { 0xb200, 0x0000, 0x0000, 0x046a0111 },
+    { 0xb200, 0x0000, 0x0000, 0x046b0111 },
+    { 0xb210, 0x0000, 0x0000, 0x046c0111 },
+    { 0xb210, 0x0000, 0x0000, 0x046d0111 },
+    { 0xb210, 0x0000, 0x0000, 0x046e0111 },
+    { 0xb210, 0x0000, 0x0000, 0x046f0111 },
+    { 0xb200, 0x0000, 0x0000, 0x04700111 },
+    { 0xb200, 0x0000, 0x0000, 0x04710111 },
+    { 0xb200, 0x0000, 0x0000, 0x04720111 },
+    { 0xb200, 0x0000, 0x0000, 0x04730111 },
+    { 0xb200, 0x0000, 0x0000, 0x04740111 },
+    { 0xb200, 0x0000, 0x0000, 0x04750111 },
+    { 0xb200, 0x0000, 0x0000, 0x04760111 },
+    { 0xb200, 0x0000, 0x0000, 0x04770111 },
+    { 0xb200, 0x0000, 0x0000, 0x04780111 },
+    { 0xb200, 0x0000, 0x0000, 0x04790111 },
+    { 0xb200, 0x0000, 0x0000, 0x047a0111 },
+    { 0xb200, 0x0000, 0x0000, 0x047b0111 },
+    { 0xb200, 0x0000, 0x0000, 0x047c0111 },
+    { 0xb200, 0x0000, 0x0000, 0x047d0111 },
+    { 0xb200, 0x0000, 0x0000, 0x047e0111 },
+    { 0xb200, 0x0000, 0x0000, 0x047f0111 },
+    { 0xb200, 0x0000, 0x0000, 0x04800111 },
+    { 0xb200, 0x0000, 0x0000, 0x04810111 },
+    { 0xb200, 0x0000, 0x0000, 0x04820111 },
+    { 0xb200, 0x0000, 0x0000, 0x04830111 },
+    { 0xb200, 0x0000, 0x0000, 0x04840111 },
+    { 0xb200, 0x0000, 0x0000, 0x04850111 },
+    { 0xb200, 0x0000, 0x0000, 0x04860111 },
+    { 0xb200, 0x0000, 0x0000, 0x04870111 },
+    { 0xb200, 0x0000, 0x0000, 0x04880111 },
+    { 0xb200, 0x0000, 0x0000, 0x04890111 },
+    { 0xb200, 0x0000, 0x0000, 0x048a0111 },
+    { 0xb200, 0x0000, 0x0000, 0x048b0111 },
+    { 0xb200, 0x0000, 0x0000, 0x048c0111 },
+    { 0xb210, 0x0000, 0x0000, 0x02880111 },
+    { 0xb210, 0x0000, 0x0000, 0x02890111 },
+    { 0xb200, 0x0000, 0x0000, 0x048d0111 },
+    { 0xb200, 0x0000, 0x0000, 0x048e0111 },
+    { 0xb200, 0x0000, 0x0000, 0x048f0111 },
+    { 0xb200, 0x0000, 0x0000, 0x04900111 },
+    { 0xb200, 0x0000, 0x0000, 0x04910111 },
+    { 0xb200, 0x0000, 0x0000, 0x04920111 },
+    { 0xb200, 0x0000, 0x0000, 0x04930111 },
+    { 0xb200, 0x0000, 0x0000, 0x04940111 },
+    { 0xb200, 0x0000, 0x0000, 0x04950111 },
+    { 0xb200, 0x0000, 0x0000, 0x04960111 },
+    { 0xb200, 0x0000, 0x0000, 0x04970111 },
+    { 0x1200, 0x0000, 0x0000, 0x04980111 },
+    { 0x1200, 0x0000, 0x0000, 0x04990111 },
+    { 0x1200, 0x0000, 0x0000, 0x049a0111 },
+    { 0x1200, 0x0000, 0x0000, 0x049b0111 },
+    { 0x1200, 0x0000, 0x0000, 0x049c0111 },
+    { 0x1200, 0x0000, 0x0000, 0x049d0111 },
+    { 0x1200, 0x0000, 0x0000, 0x049e0111 },
+    { 0x1200, 0x0000, 0x0000, 0x049f0111 },
+    { 0x1200, 0x0000, 0x0000, 0x04a00111 },
+    { 0x1200, 0x0000, 0x0000, 0x04a10111 },
+    { 0x1200, 0x0000, 0x0000, 0x04a20111 },
+    { 0x1200, 0x0000, 0x0000, 0x04a30111 },
+    { 0x1200, 0x0000, 0x0000, 0x04a40111 },
+    { 0x1200, 0x0000, 0x0000, 0x04a50111 },
+    { 0x1200, 0x0000, 0x0000, 0x04a60111 },
+    { 0x1200, 0x0000, 0x0000, 0x04a70111 },
+    { 0x1200, 0x0000, 0x0000, 0x04a80111 },
+    { 0x1200, 0x0000, 0x0000, 0x04a90111 },
+    { 0x1200, 0x0000, 0x0000, 0x04aa0111 },
+    { 0x1200, 0x0000, 0x0000, 0x04ab0111 },
+    { 0x1200, 0x0000, 0x0000, 0x04ac0111 },
+    { 0x1200, 0x0000, 0x0000, 0x04ad0111 },
+    { 0x1200, 0x0000, 0x0000, 0x04ae0111 },
+    { 0x1200, 0x0000, 0x0000, 0x04af0111 },
+    { 0x1200, 0x0000, 0x0000, 0x04b00111 },
+    { 0x1200, 0x0000, 0x0000, 0x04b10111 },
+    { 0x1200, 0x0000, 0x0000, 0x04b20111 },
+    { 0x1200, 0x0000, 0x0000, 0x04b30111 },
+    { 0x1200, 0x0000, 0x0000, 0x04b40111 },
+    { 0x1200, 0x0000, 0x0000, 0x04b50111 },
+    { 0x1200, 0x0000, 0x0000, 0x04b60111 },
+    { 0x1200, 0x0000, 0x0000, 0x04b70111 },
+    { 0x1200, 0x0000, 0x0000, 0x04b80111 },
+    { 0x1200, 0x0000, 0x0000, 0x04b90111 },
+    { 0x1200, 0x0000, 0x0000, 0x04ba0111 },
+    { 0x1200, 0x0000, 0x0000, 0x04bb0111 },
+    { 0x1200, 0x0000, 0x0000, 0x04bc0111 },
+    { 0x1200, 0x0000, 0x0000, 0x04bd0111 },
+    { 0x1200, 0x0000, 0x0000, 0x04be0111 },
+    { 0x1200, 0x0000, 0x0000, 0x04bf0111 },
+    { 0x1200, 0x0000, 0x0000, 0x04c00111 },
+    { 0x1200, 0x0000, 0x0000, 0x04c10111 },
+    { 0x1200, 0x0000, 0x0000, 0x04c20111 },
+    { 0x1200, 0x0000, 0x0000, 0x04c30111 },
+    { 0x1200, 0x0000, 0x0000, 0x04c40111 },
+    { 0x1200, 0x0000, 0x0000, 0x04c50111 },
+    { 0x1200, 0x0000, 0x0000, 0x04c60111 },
+    { 0x1200, 0x0000, 0x0000, 0x04c70111 },
+    { 0x1200, 0x0000, 0x0000, 0x04c80111 },
+    { 0x1200, 0x0000, 0x0000, 0x04c90111 },
+    { 0x1200, 0x0000, 0x0000, 0x04ca0111 },
+    { 0x1200, 0x0000, 0x0000, 0x04cb0111 },
+    { 0x1200, 0x0000, 0x0000, 0x04cc0111 },
+    { 0x1200, 0x0000, 0x0000, 0x04cd0111 },
+    { 0x1200, 0x0000, 0x0000, 0x04ce0111 },
+    { 0x1200, 0x0000, 0x0000, 0x04cf0111 },
+    { 0x1200, 0x0000, 0x0000, 0x04d00111 },
+    { 0x1200, 0x0000, 0x0000, 0x04d10111 },
+    { 0x1200, 0x0000, 0x0000, 0x04d20111 },
+    { 0x1200, 0x0000, 0x0000, 0x04d30111 },
+    { 0x1200, 0x0000, 0x0000, 0x04d40111 },
+    { 0x1200, 0x0000, 0x0000, 0x04d50111 },
+    { 0x1200, 0x0000, 0x0000, 0x04d60111 },
+    { 0x1200, 0x0000, 0x0000, 0x04d70111 },
+    { 0x1200, 0x0000, 0x0000, 0x04d80111 },
+    { 0x1200, 0x0000, 0x0000, 0x04d90111 },
+    { 0x1200, 0x0000, 0x0000, 0x04da0111 },
+    { 0x1200, 0x0000, 0x0000, 0x04db0111 },
+    { 0x1200, 0x0000, 0x0000, 0x04dc0111 },
+    { 0xb200, 0x0000, 0x0000, 0x04dd0111 },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0x04de0111 },
+    { 0xb200, 0x0000, 0x0000, 0x04df0111 },
+    { 0xb200, 0x0000, 0x0000, 0x04e00111 },
+    { 0xb200, 0x0000, 0x0000, 0x04e10111 },
+    { 0xb200, 0x0000, 0x0000, 0x04e20111 },
+    { 0xb200, 0x0000, 0x0000, 0x04e30111 },
+    { 0xb200, 0x0000, 0x0000, 0x04e40111 },
+    { 0xb200, 0x0000, 0x0000, 0x04e50111 },
+    { 0xb200, 0x0000, 0x0000, 0x04e60111 },
+    { 0xb200, 0x0000, 0x0000, 0x04e70111 },
+    { 0xb200, 0x0000, 0x0000, 0x04e80111 },
+    { 0xb200, 0x0000, 0x0000, 0x04e90111 },
+    { 0xb200, 0x0000, 0x0000, 0x04ea0111 },
+    { 0xb200, 0x0000, 0x0000, 0x04eb0111 },
+    { 0xb200, 0x0000, 0x0000, 0x04ec0111 },
+    { 0xb200, 0x0000, 0x0000, 0x04ed0111 },
+    { 0xb200, 0x0000, 0x0000, 0x04ee0111 },
+    { 0xb200, 0x0000, 0x0000, 0x04ef0111 },
+    { 0xb200, 0x0000, 0x0000, 0x04f00111 },
+    { 0xb200, 0x0000, 0x0000, 0x04f10111 },
+    { 0xb200, 0x0000, 0x0000, 0x04f20111 },
+    { 0xb200, 0x0000, 0x0000, 0x04f30111 },
+    { 0xb200, 0x0000, 0x0000, 0x04f40111 },
+    { 0xb200, 0x0000, 0x0000, 0x04f50111 },
+    { 0x1200, 0x0000, 0x0000, 0x04f60111 },
+    { 0xb200, 0x0000, 0x0000, 0x04f70111 },
+    { 0xb200, 0x0000, 0x0000, 0x04f80111 },
+    { 0xb200, 0x0000, 0x0000, 0x04f90111 },
+    { 0xb200, 0x0000, 0x0000, 0x04fa0111 },
+    { 0xb200, 0x0000, 0x0000, 0x04fb0111 },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    /* block 36 */
+    { 0xb200, 0x0000, 0x0000, 0x04fc0111 },
+    { 0xb200, 0x0000, 0x0000, 0x04fd0111 },
+    { 0xb200, 0x0000, 0x0000, 0x04fe0111 },
+    { 0xb200, 0x0000, 0x0000, 0x04ff0111 },
+    { 0xb200, 0x0000, 0x0000, 0x05000111 },
+    { 0xb200, 0x0000, 0x0000, 0x05010111 },
+    { 0xb200, 0x0000, 0x0000, 0x05020111 },
+    { 0xb200, 0x0000, 0x0000, 0x05030111 },
+    { 0xb200, 0x0000, 0x0000, 0x05040111 },
+    { 0xb200, 0x0000, 0x0000, 0x05050111 },
+    { 0xb200, 0x0000, 0x0000, 0x05060111 },
+    { 0xb200, 0x0000, 0x0000, 0x05070111 },
+    { 0xb200, 0x0000, 0x0000, 0x05080111 },
+    { 0xb200, 0x0000, 0x0000, 0x05090111 },
+    { 0xb200, 0x0000, 0x0000, 0x050a0111 },
+    { 0xb200, 0x0000, 0x0000, 0x050b0111 },
+    { 0xb200, 0x0000, 0x0000, 0x050c0111 },
+    { 0xb200, 0x0000, 0x0000, 0x050d0111 },
+    { 0xb200, 0x0000, 0x0000, 0x050e0111 },
+    { 0xb200, 0x0000, 0x0000, 0x050f0111 },
+    { 0xb200, 0x0000, 0x0000, 0x05100111 },
+    { 0xb200, 0x0000, 0x0000, 0x05110111 },
+    { 0xb200, 0x0000, 0x0000, 0x05120111 },
+    { 0xb200, 0x0000, 0x0000, 0x05130111 },
+    { 0xb200, 0x0000, 0x0000, 0x05140111 },
+    { 0xb200, 0x0000, 0x0000, 0x05150111 },
+    { 0xb200, 0x0000, 0x0000, 0x05160111 },
+    { 0xb200, 0x0000, 0x0000, 0x05170111 },
+    { 0xb200, 0x0000, 0x0000, 0x05180111 },
+    { 0xb200, 0x0000, 0x0000, 0x05190111 },
+    { 0xb200, 0x0000, 0x0000, 0x051a0111 },
+    { 0xb200, 0x0000, 0x0000, 0x051b0111 },
+    { 0xb200, 0x0000, 0x0000, 0x051c0111 },
+    { 0xb200, 0x0000, 0x0000, 0x051d0111 },
+    { 0xb200, 0x0000, 0x0000, 0x051e0111 },
+    { 0xb200, 0x0000, 0x0000, 0x051f0111 },
+    { 0xb200, 0x0000, 0x0000, 0x05200111 },
+    { 0xb200, 0x0000, 0x0000, 0x05210111 },
+    { 0xb200, 0x0000, 0x0000, 0x05220111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0x05230111 },
+    { 0xb200, 0x0000, 0x0000, 0x05240111 },
+    { 0xb200, 0x0000, 0x0000, 0x05250111 },
+    { 0xb200, 0x0000, 0x0000, 0x05260111 },
+    { 0xb200, 0x0000, 0x0000, 0x05270111 },
+    { 0xb200, 0x0000, 0x0000, 0x05280111 },
+    { 0xb200, 0x0000, 0x0000, 0x05290111 },
+    { 0xb200, 0x0000, 0x0000, 0x052a0111 },
+    { 0xb200, 0x0000, 0x0000, 0x052b0111 },
+    { 0xb200, 0x0000, 0x0000, 0x052c0111 },
+    { 0xb200, 0x0000, 0x0000, 0x052d0111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0x0a0c0141 },
+    { 0xb200, 0x0000, 0x0000, 0x0a0d0141 },
+    { 0xb200, 0x0000, 0x0000, 0x0a0e0141 },
+    { 0xb200, 0x0000, 0x0000, 0x0a0f0141 },
+    { 0xb200, 0x0000, 0x0000, 0x0a100141 },
+    { 0xb200, 0x0000, 0x0000, 0x0a110141 },
+    { 0xb200, 0x0000, 0x0000, 0x0a120141 },
+    { 0xb200, 0x0000, 0x0000, 0x0a130141 },
+    { 0xb200, 0x0000, 0x0000, 0x0a140141 },
+    { 0xb200, 0x0000, 0x0000, 0x0a0c0141 },
+    { 0xb200, 0x0000, 0x0000, 0x0a0c0141 },
+    { 0xb200, 0x0000, 0x0000, 0x0a0c0141 },
+    { 0xb200, 0x0000, 0x0000, 0x0a0c0141 },
+    { 0xb200, 0x0000, 0x0000, 0x0a0c0141 },
+    { 0xb200, 0x0000, 0x0000, 0x0a0c0141 },
+    { 0xb200, 0x0000, 0x0000, 0x0a0c0141 },
+    { 0xb200, 0x0000, 0x0000, 0x0a0c0141 },
+    { 0xb200, 0x0000, 0x0000, 0x0a0c0141 },
+    { 0xb200, 0x0000, 0x0000, 0x0a0c0141 },
+    { 0xb200, 0x0000, 0x0000, 0x0a0d0141 },
+    { 0xb200, 0x0000, 0x0000, 0x027a0131 },
+    { 0xb200, 0x0000, 0x0000, 0x027a0131 },
+    { 0xb200, 0x0000, 0x0000, 0x027a0131 },
+    { 0xb200, 0x0000, 0x0000, 0x027a0131 },
+    { 0xb200, 0x0000, 0x0000, 0x027a0131 },
+    { 0xb200, 0x0000, 0x0000, 0x027a0131 },
+    { 0xb200, 0x0000, 0x0000, 0x027a0131 },
+    { 0xb200, 0x0000, 0x0000, 0x027a0131 },
+    { 0xb200, 0x0000, 0x0000, 0x027a0131 },
+    { 0xb200, 0x0000, 0x0000, 0x027a0131 },
+    { 0xb200, 0x0000, 0x0000, 0x027a0131 },
+    { 0xb200, 0x0000, 0x0000, 0x027a0131 },
+    { 0xb200, 0x0000, 0x0000, 0x027a0131 },
+    { 0xb200, 0x0000, 0x0000, 0x027a0131 },
+    { 0xb200, 0x0000, 0x0000, 0x027a0131 },
+    { 0xb200, 0x0000, 0x0000, 0x027a0131 },
+    { 0xb200, 0x0000, 0x0000, 0x027a0131 },
+    { 0xb200, 0x0000, 0x0000, 0x027a0131 },
+    { 0xb200, 0x0000, 0x0000, 0x027a0131 },
+    { 0xb200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x3200, 0x0000, 0x0000, 0x0a0c0131 },
+    { 0x3200, 0x0000, 0x0000, 0x0a0d0131 },
+    { 0x3200, 0x0000, 0x0000, 0x0a0e0131 },
+    { 0x3200, 0x0000, 0x0000, 0x0a0f0131 },
+    { 0x3200, 0x0000, 0x0000, 0x0a100131 },
+    { 0x3200, 0x0000, 0x0000, 0x0a110131 },
+    { 0x3200, 0x0000, 0x0000, 0x0a120131 },
+    { 0x3200, 0x0000, 0x0000, 0x0a130131 },
+    { 0x3200, 0x0000, 0x0000, 0x0a140131 },
+    { 0x3200, 0x0000, 0x0000, 0x0a0c0131 },
+    { 0x3200, 0x0000, 0x0000, 0x0a0c0131 },
+    { 0x3200, 0x0000, 0x0000, 0x0a0c0131 },
+    { 0x3200, 0x0000, 0x0000, 0x0a0c0131 },
+    { 0x3200, 0x0000, 0x0000, 0x0a0c0131 },
+    { 0x3200, 0x0000, 0x0000, 0x0a0c0131 },
+    { 0x3200, 0x0000, 0x0000, 0x0a0c0131 },
+    { 0x3200, 0x0000, 0x0000, 0x0a0c0131 },
+    { 0x3200, 0x0000, 0x0000, 0x0a0c0131 },
+    { 0x3200, 0x0000, 0x0000, 0x0a0c0131 },
+    { 0x3200, 0x0000, 0x0000, 0x0a0d0131 },
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x1200, 0x001a, 0x0000, 0x0a150171 },
+    { 0x1200, 0x001a, 0x0000, 0x0a290171 },
+    { 0x1200, 0x001a, 0x0000, 0x0a3d0191 },
+    { 0x1200, 0x001a, 0x0000, 0x0a490181 },
+    { 0x1200, 0x001a, 0x0000, 0x0a650181 },
+    { 0x1200, 0x001a, 0x0000, 0x0a910181 },
+    { 0x1200, 0x001a, 0x0000, 0x0a990171 },
+    { 0x1200, 0x001a, 0x0000, 0x0ab90181 },
+    { 0x1200, 0x001a, 0x0000, 0x0ad301a1 },
+    { 0x1200, 0x001a, 0x0000, 0x0ae70161 },
+    { 0x1200, 0x001a, 0x0000, 0x0af70161 },
+    { 0x1200, 0x001a, 0x0000, 0x0b0301a1 },
+    { 0x1200, 0x001a, 0x0000, 0x0b2b0191 },
+    { 0x1200, 0x001a, 0x0000, 0x0b330191 },
+    { 0x1200, 0x001a, 0x0000, 0x0b4b0191 },
+    { 0x1200, 0x001a, 0x0000, 0x0b670171 },
+    { 0x1200, 0x001a, 0x0000, 0x0b730171 },
+    { 0x1200, 0x001a, 0x0000, 0x0b7f0181 },
+    { 0x1200, 0x001a, 0x0000, 0x0ba70171 },
+    { 0x1200, 0x001a, 0x0000, 0x0bbf0181 },
+    { 0x1200, 0x001a, 0x0000, 0x0bd70161 },
+    { 0x1200, 0x001a, 0x0000, 0x0bef0181 },
+    { 0x1200, 0x001a, 0x0000, 0x0bfb0161 },
+    { 0x1200, 0x001a, 0x0000, 0x0c030181 },
+    { 0x1200, 0x001a, 0x0000, 0x0c070161 },
+    { 0x1200, 0x001a, 0x0000, 0x0c130171 },
+    { 0x1200, 0x0000, 0xffe6, 0x0a150141 },
+    { 0x1200, 0x0000, 0xffe6, 0x0a290131 },
+    { 0x1200, 0x0000, 0xffe6, 0x0a3d0141 },
+    { 0x1200, 0x0000, 0xffe6, 0x0a490141 },
+    { 0x1200, 0x0000, 0xffe6, 0x0a650141 },
+    { 0x1200, 0x0000, 0xffe6, 0x0a910141 },
+    { 0x1200, 0x0000, 0xffe6, 0x0a990141 },
+    { 0x1200, 0x0000, 0xffe6, 0x0ab90141 },
+    { 0x1200, 0x0000, 0xffe6, 0x0ad30151 },
+    { 0x1200, 0x0000, 0xffe6, 0x0ae70131 },
+    { 0x1200, 0x0000, 0xffe6, 0x0af70131 },
+    { 0x1200, 0x0000, 0xffe6, 0x0b030151 },
+    { 0x1200, 0x0000, 0xffe6, 0x0b2b0141 },
+    { 0x1200, 0x0000, 0xffe6, 0x0b330141 },
+    { 0x1200, 0x0000, 0xffe6, 0x0b4b0151 },
+    { 0x1200, 0x0000, 0xffe6, 0x0b670131 },
+    { 0x1200, 0x0000, 0xffe6, 0x0b730131 },
+    { 0x1200, 0x0000, 0xffe6, 0x0b7f0131 },
+    { 0x1200, 0x0000, 0xffe6, 0x0ba70141 },
+    { 0x1200, 0x0000, 0xffe6, 0x0bbf0141 },
+    { 0x1200, 0x0000, 0xffe6, 0x0bd70131 },
+    { 0x1200, 0x0000, 0xffe6, 0x0bef0141 },
+    { 0x1200, 0x0000, 0xffe6, 0x0bfb0131 },
+    { 0x1200, 0x0000, 0xffe6, 0x0c030141 },
+    { 0x1200, 0x0000, 0xffe6, 0x0c070131 },
+    { 0x1200, 0x0000, 0xffe6, 0x0c130131 },
+    { 0xb200, 0x0000, 0x0000, 0x0a0b0141 },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    /* block 37 */
+    { 0xb200, 0x0000, 0x0000, 0x052e0111 },
+    { 0xb200, 0x0000, 0x0000, 0x052f0111 },
+    { 0xb200, 0x0000, 0x0000, 0x05300111 },
+    { 0xb200, 0x0000, 0x0000, 0x05310111 },
+    { 0xb200, 0x0000, 0x0000, 0x05320111 },
+    { 0xb200, 0x0000, 0x0000, 0x05330111 },
+    { 0xb200, 0x0000, 0x0000, 0x05340111 },
+    { 0xb200, 0x0000, 0x0000, 0x05350111 },
+    { 0xb200, 0x0000, 0x0000, 0x05360111 },
+    { 0xb200, 0x0000, 0x0000, 0x05370111 },
+    { 0xb200, 0x0000, 0x0000, 0x05380111 },
+    { 0xb200, 0x0000, 0x0000, 0x05390111 },
+    { 0xb200, 0x0000, 0x0000, 0x053a0111 },
+    { 0xb200, 0x0000, 0x0000, 0x053b0111 },
+    { 0xb200, 0x0000, 0x0000, 0x053c0111 },
+    { 0xb200, 0x0000, 0x0000, 0x053d0111 },
+    { 0xb200, 0x0000, 0x0000, 0x053e0111 },
+    { 0xb200, 0x0000, 0x0000, 0x053f0111 },
+    { 0xb200, 0x0000, 0x0000, 0x05400111 },
+    { 0xb200, 0x0000, 0x0000, 0x05410111 },
+    { 0xb200, 0x0000, 0x0000, 0x05420111 },
+    { 0xb200, 0x0000, 0x0000, 0x05430111 },
+    { 0xb200, 0x0000, 0x0000, 0x05440111 },
+    { 0xb200, 0x0000, 0x0000, 0x05450111 },
+    { 0xb200, 0x0000, 0x0000, 0x05460111 },
+    { 0xb200, 0x0000, 0x0000, 0x05470111 },
+    { 0xb200, 0x0000, 0x0000, 0x05480111 },
+    { 0xb200, 0x0000, 0x0000, 0x05490111 },
+    { 0xb200, 0x0000, 0x0000, 0x054a0111 },
+    { 0xb200, 0x0000, 0x0000, 0x054b0111 },
+    { 0xb200, 0x0000, 0x0000, 0x054c0111 },
+    { 0xb200, 0x0000, 0x0000, 0x054d0111 },
+    { 0xb200, 0x0000, 0x0000, 0x054e0111 },
+    { 0xb200, 0x0000, 0x0000, 0x054f0111 },
+    { 0xb200, 0x0000, 0x0000, 0x05500111 },
+    { 0xb200, 0x0000, 0x0000, 0x05510111 },
+    { 0xb200, 0x0000, 0x0000, 0x05520111 },
+    { 0xb200, 0x0000, 0x0000, 0x05530111 },
+    { 0xb200, 0x0000, 0x0000, 0x05540111 },
+    { 0xb200, 0x0000, 0x0000, 0x05550111 },
+    { 0xb200, 0x0000, 0x0000, 0x05560111 },
+    { 0xb200, 0x0000, 0x0000, 0x05570111 },
+    { 0xb200, 0x0000, 0x0000, 0x05580111 },
+    { 0xb200, 0x0000, 0x0000, 0x05590111 },
+    { 0xb200, 0x0000, 0x0000, 0x055a0111 },
+    { 0xb200, 0x0000, 0x0000, 0x055b0111 },
+    { 0xb200, 0x0000, 0x0000, 0x055c0111 },
+    { 0xb200, 0x0000, 0x0000, 0x055d0111 },
+    { 0xb200, 0x0000, 0x0000, 0x055e0111 },
+    { 0xb200, 0x0000, 0x0000, 0x055f0111 },
+    { 0xb200, 0x0000, 0x0000, 0x05600111 },
+    { 0xb200, 0x0000, 0x0000, 0x05610111 },
+    { 0xb200, 0x0000, 0x0000, 0x05620111 },
+    { 0xb200, 0x0000, 0x0000, 0x05630111 },
+    { 0xb200, 0x0000, 0x0000, 0x05640111 },
+    { 0xb200, 0x0000, 0x0000, 0x05650111 },
+    { 0xb200, 0x0000, 0x0000, 0x05660111 },
+    { 0xb200, 0x0000, 0x0000, 0x05670111 },
+    { 0xb200, 0x0000, 0x0000, 0x05680111 },
+    { 0xb200, 0x0000, 0x0000, 0x05690111 },
+    { 0xb200, 0x0000, 0x0000, 0x056a0111 },
+    { 0xb200, 0x0000, 0x0000, 0x056b0111 },
+    { 0xb200, 0x0000, 0x0000, 0x056c0111 },
+    { 0xb200, 0x0000, 0x0000, 0x056d0111 },
+    { 0xb200, 0x0000, 0x0000, 0x056e0111 },
+    { 0xb200, 0x0000, 0x0000, 0x056f0111 },
+    { 0xb200, 0x0000, 0x0000, 0x05700111 },
+    { 0xb200, 0x0000, 0x0000, 0x05710111 },
+    { 0xb200, 0x0000, 0x0000, 0x05720111 },
+    { 0xb200, 0x0000, 0x0000, 0x05730111 },
+    { 0xb200, 0x0000, 0x0000, 0x05740111 },
+    { 0xb200, 0x0000, 0x0000, 0x05750111 },
+    { 0xb200, 0x0000, 0x0000, 0x05760111 },
+    { 0xb200, 0x0000, 0x0000, 0x05770111 },
+    { 0xb200, 0x0000, 0x0000, 0x05780111 },
+    { 0xb200, 0x0000, 0x0000, 0x05790111 },
+    { 0xb200, 0x0000, 0x0000, 0x057a0111 },
+    { 0xb200, 0x0000, 0x0000, 0x057b0111 },
+    { 0xb200, 0x0000, 0x0000, 0x057c0111 },
+    { 0xb200, 0x0000, 0x0000, 0x057d0111 },
+    { 0xb200, 0x0000, 0x0000, 0x057e0111 },
+    { 0xb200, 0x0000, 0x0000, 0x057f0111 },
+    { 0xb200, 0x0000, 0x0000, 0x05800111 },
+    { 0xb200, 0x0000, 0x0000, 0x05810111 },
+    { 0xb200, 0x0000, 0x0000, 0x05820111 },
+    { 0xb200, 0x0000, 0x0000, 0x05830111 },
+    { 0xb200, 0x0000, 0x0000, 0x05840111 },
+    { 0xb200, 0x0000, 0x0000, 0x05850111 },
+    { 0xb200, 0x0000, 0x0000, 0x05860111 },
+    { 0xb200, 0x0000, 0x0000, 0x05870111 },
+    { 0xb200, 0x0000, 0x0000, 0x05880111 },
+    { 0xb200, 0x0000, 0x0000, 0x05890111 },
+    { 0xb200, 0x0000, 0x0000, 0x058a0111 },
+    { 0xb200, 0x0000, 0x0000, 0x058b0111 },
+    { 0xb200, 0x0000, 0x0000, 0x058c0111 },
+    { 0xb200, 0x0000, 0x0000, 0x058d0111 },
+    { 0xb200, 0x0000, 0x0000, 0x058e0111 },
+    { 0xb200, 0x0000, 0x0000, 0x058f0111 },
+    { 0xb200, 0x0000, 0x0000, 0x05900111 },
+    { 0xb200, 0x0000, 0x0000, 0x05910111 },
+    { 0xb200, 0x0000, 0x0000, 0x05920111 },
+    { 0xb200, 0x0000, 0x0000, 0x05930111 },
+    { 0xb200, 0x0000, 0x0000, 0x05940111 },
+    { 0xb200, 0x0000, 0x0000, 0x05950111 },
+    { 0xb200, 0x0000, 0x0000, 0x05960111 },
+    { 0xb200, 0x0000, 0x0000, 0x05970111 },
+    { 0xb200, 0x0000, 0x0000, 0x05980111 },
+    { 0xb200, 0x0000, 0x0000, 0x05990111 },
+    { 0xb200, 0x0000, 0x0000, 0x059a0111 },
+    { 0xb200, 0x0000, 0x0000, 0x059b0111 },
+    { 0xb200, 0x0000, 0x0000, 0x059c0111 },
+    { 0xb200, 0x0000, 0x0000, 0x059d0111 },
+    { 0xb200, 0x0000, 0x0000, 0x059e0111 },
+    { 0xb200, 0x0000, 0x0000, 0x059f0111 },
+    { 0xb200, 0x0000, 0x0000, 0x05a00111 },
+    { 0xb200, 0x0000, 0x0000, 0x05a10111 },
+    { 0xb200, 0x0000, 0x0000, 0x05a20111 },
+    { 0xb200, 0x0000, 0x0000, 0x05a30111 },
+    { 0xb200, 0x0000, 0x0000, 0x05a40111 },
+    { 0xb200, 0x0000, 0x0000, 0x05a50111 },
+    { 0xb200, 0x0000, 0x0000, 0x05a60111 },
+    { 0xb200, 0x0000, 0x0000, 0x05a70111 },
+    { 0xb200, 0x0000, 0x0000, 0x05a80111 },
+    { 0xb200, 0x0000, 0x0000, 0x05a90111 },
+    { 0xb200, 0x0000, 0x0000, 0x05aa0111 },
+    { 0xb200, 0x0000, 0x0000, 0x05ab0111 },
+    { 0xb200, 0x0000, 0x0000, 0x05ac0111 },
+    { 0xb200, 0x0000, 0x0000, 0x05ad0111 },
+    { 0xb200, 0x0000, 0x0000, 0x05ae0111 },
+    { 0xb200, 0x0000, 0x0000, 0x05af0111 },
+    { 0xb200, 0x0000, 0x0000, 0x05b00111 },
+    { 0xb200, 0x0000, 0x0000, 0x05b10111 },
+    { 0xb200, 0x0000, 0x0000, 0x05b20111 },
+    { 0xb200, 0x0000, 0x0000, 0x05b30111 },
+    { 0xb200, 0x0000, 0x0000, 0x05b40111 },
+    { 0xb200, 0x0000, 0x0000, 0x05b50111 },
+    { 0xb200, 0x0000, 0x0000, 0x05b60111 },
+    { 0xb200, 0x0000, 0x0000, 0x05b70111 },
+    { 0xb200, 0x0000, 0x0000, 0x05b80111 },
+    { 0xb200, 0x0000, 0x0000, 0x05b90111 },
+    { 0xb200, 0x0000, 0x0000, 0x05ba0111 },
+    { 0xb200, 0x0000, 0x0000, 0x05bb0111 },
+    { 0xb200, 0x0000, 0x0000, 0x05bc0111 },
+    { 0xb200, 0x0000, 0x0000, 0x05bd0111 },
+    { 0xb200, 0x0000, 0x0000, 0x05be0111 },
+    { 0xb200, 0x0000, 0x0000, 0x05bf0111 },
+    { 0xb200, 0x0000, 0x0000, 0x05c00111 },
+    { 0xb200, 0x0000, 0x0000, 0x05c10111 },
+    { 0xb200, 0x0000, 0x0000, 0x05c20111 },
+    { 0xb200, 0x0000, 0x0000, 0x05c30111 },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0x05c40111 },
+    { 0xb200, 0x0000, 0x0000, 0x05c50111 },
+    { 0xb200, 0x0000, 0x0000, 0x05c60111 },
+    { 0xb200, 0x0000, 0x0000, 0x05c70111 },
+    { 0xb200, 0x0000, 0x0000, 0x05c80111 },
+    { 0xb200, 0x0000, 0x0000, 0x05c90111 },
+    { 0xb200, 0x0000, 0x0000, 0x05ca0111 },
+    { 0xb200, 0x0000, 0x0000, 0x05cb0111 },
+    { 0xb200, 0x0000, 0x0000, 0x05cc0111 },
+    { 0xb200, 0x0000, 0x0000, 0x05cd0111 },
+    { 0xb200, 0x0000, 0x0000, 0x05ce0111 },
+    { 0xb200, 0x0000, 0x0000, 0x05cf0111 },
+    { 0xb200, 0x0000, 0x0000, 0x05d00111 },
+    { 0xb200, 0x0000, 0x0000, 0x05d10111 },
+    { 0xb200, 0x0000, 0x0000, 0x05d20111 },
+    { 0xb200, 0x0000, 0x0000, 0x05d30111 },
+    { 0xb200, 0x0000, 0x0000, 0x05d40111 },
+    { 0xb200, 0x0000, 0x0000, 0x05d50111 },
+    { 0xb200, 0x0000, 0x0000, 0x05d60111 },
+    { 0xb200, 0x0000, 0x0000, 0x05d70111 },
+    { 0xb200, 0x0000, 0x0000, 0x05d80111 },
+    { 0xb200, 0x0000, 0x0000, 0x05d90111 },
+    { 0xb200, 0x0000, 0x0000, 0x05da0111 },
+    { 0xb200, 0x0000, 0x0000, 0x05db0111 },
+    { 0xb200, 0x0000, 0x0000, 0x05dc0111 },
+    { 0xb200, 0x0000, 0x0000, 0x05dd0111 },
+    { 0xb200, 0x0000, 0x0000, 0x05de0111 },
+    { 0xb200, 0x0000, 0x0000, 0x05df0111 },
+    { 0xb200, 0x0000, 0x0000, 0x05e00111 },
+    { 0xb200, 0x0000, 0x0000, 0x05e10111 },
+    { 0xb200, 0x0000, 0x0000, 0x05e20111 },
+    { 0xb200, 0x0000, 0x0000, 0x05e30111 },
+    { 0xb200, 0x0000, 0x0000, 0x05e40111 },
+    { 0xb200, 0x0000, 0x0000, 0x05e50111 },
+    { 0xb200, 0x0000, 0x0000, 0x05e60111 },
+    { 0xb200, 0x0000, 0x0000, 0x05e70111 },
+    { 0xb200, 0x0000, 0x0000, 0x05e80111 },
+    { 0xb200, 0x0000, 0x0000, 0x05e90111 },
+    { 0xb200, 0x0000, 0x0000, 0x05ea0111 },
+    { 0xb200, 0x0000, 0x0000, 0x05eb0111 },
+    { 0xb200, 0x0000, 0x0000, 0x05ec0111 },
+    { 0xb200, 0x0000, 0x0000, 0x05ed0111 },
+    { 0xb200, 0x0000, 0x0000, 0x05ee0111 },
+    { 0xb200, 0x0000, 0x0000, 0x05ef0111 },
+    { 0xb200, 0x0000, 0x0000, 0x05f00111 },
+    { 0xb200, 0x0000, 0x0000, 0x05f10111 },
+    { 0xb200, 0x0000, 0x0000, 0x05f20111 },
+    { 0xb200, 0x0000, 0x0000, 0x05f30111 },
+    { 0xb200, 0x0000, 0x0000, 0x05f40111 },
+    { 0xb200, 0x0000, 0x0000, 0x05f50111 },
+    { 0xb200, 0x0000, 0x0000, 0x05f60111 },
+    { 0xb200, 0x0000, 0x0000, 0x05f70111 },
+    { 0xb200, 0x0000, 0x0000, 0x05f80111 },
+    { 0xb200, 0x0000, 0x0000, 0x05f90111 },
+    { 0xb200, 0x0000, 0x0000, 0x05fa0111 },
+    { 0xb200, 0x0000, 0x0000, 0x05fb0111 },
+    { 0xb200, 0x0000, 0x0000, 0x05fc0111 },
+    { 0xb200, 0x0000, 0x0000, 0x05fd0111 },
+    { 0xb200, 0x0000, 0x0000, 0x05fe0111 },
+    { 0xb200, 0x0000, 0x0000, 0x05ff0111 },
+    { 0xb200, 0x0000, 0x0000, 0x06000111 },
+    { 0xb200, 0x0000, 0x0000, 0x06010111 },
+    { 0xb200, 0x0000, 0x0000, 0x06020111 },
+    { 0xb200, 0x0000, 0x0000, 0x06030111 },
+    { 0xb200, 0x0000, 0x0000, 0x06040111 },
+    { 0xb200, 0x0000, 0x0000, 0x06050111 },
+    { 0xb200, 0x0000, 0x0000, 0x06060111 },
+    { 0xb200, 0x0000, 0x0000, 0x06070111 },
+    { 0xb200, 0x0000, 0x0000, 0x06080111 },
+    { 0xb200, 0x0000, 0x0000, 0x06090111 },
+    { 0xb200, 0x0000, 0x0000, 0x060a0111 },
+    { 0xb200, 0x0000, 0x0000, 0x060b0111 },
+    { 0xb200, 0x0000, 0x0000, 0x060c0111 },
+    { 0xb200, 0x0000, 0x0000, 0x060d0111 },
+    { 0xb200, 0x0000, 0x0000, 0x060e0111 },
+    { 0xb200, 0x0000, 0x0000, 0x060f0111 },
+    { 0xb200, 0x0000, 0x0000, 0x06100111 },
+    { 0xb200, 0x0000, 0x0000, 0x06110111 },
+    { 0xb200, 0x0000, 0x0000, 0x06120111 },
+    { 0xb200, 0x0000, 0x0000, 0x06130111 },
+    { 0xb200, 0x0000, 0x0000, 0x06140111 },
+    { 0xb200, 0x0000, 0x0000, 0x06150111 },
+    { 0xb200, 0x0000, 0x0000, 0x06160111 },
+    { 0xb200, 0x0000, 0x0000, 0x06170111 },
+    { 0xb200, 0x0000, 0x0000, 0x06180111 },
+    { 0xb200, 0x0000, 0x0000, 0x06190111 },
+    { 0xb200, 0x0000, 0x0000, 0x061a0111 },
+    { 0xb200, 0x0000, 0x0000, 0x061b0111 },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    /* block 38 */
+    { 0xb200, 0x0000, 0x0000, 0x061c0111 },
+    { 0xb200, 0x0000, 0x0000, 0x061d0111 },
+    { 0xb200, 0x0000, 0x0000, 0x061e0111 },
+    { 0xb200, 0x0000, 0x0000, 0x061f0111 },
+    { 0xb200, 0x0000, 0x0000, 0x06200111 },
+    { 0xb200, 0x0000, 0x0000, 0x06210111 },
+    { 0xb200, 0x0000, 0x0000, 0x06220111 },
+    { 0xb200, 0x0000, 0x0000, 0x06230111 },
+    { 0xb200, 0x0000, 0x0000, 0x06240111 },
+    { 0xb200, 0x0000, 0x0000, 0x06250111 },
+    { 0xb200, 0x0000, 0x0000, 0x06260111 },
+    { 0xb200, 0x0000, 0x0000, 0x06270111 },
+    { 0xb200, 0x0000, 0x0000, 0x06280111 },
+    { 0xb200, 0x0000, 0x0000, 0x06290111 },
+    { 0xb200, 0x0000, 0x0000, 0x062a0111 },
+    { 0xb200, 0x0000, 0x0000, 0x062b0111 },
+    { 0xb200, 0x0000, 0x0000, 0x062c0111 },
+    { 0xb200, 0x0000, 0x0000, 0x062d0111 },
+    { 0xb200, 0x0000, 0x0000, 0x062e0111 },
+    { 0xb200, 0x0000, 0x0000, 0x062f0111 },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0x06300111 },
+    { 0xb200, 0x0000, 0x0000, 0x06310111 },
+    { 0xb200, 0x0000, 0x0000, 0x06320111 },
+    { 0xb200, 0x0000, 0x0000, 0x06330111 },
+    { 0xb200, 0x0000, 0x0000, 0x06340111 },
+    { 0xb200, 0x0000, 0x0000, 0x06350111 },
+    { 0xb200, 0x0000, 0x0000, 0x06360111 },
+    { 0xb200, 0x0000, 0x0000, 0x06370111 },
+    { 0xb200, 0x0000, 0x0000, 0x06380111 },
+    { 0xb200, 0x0000, 0x0000, 0x06390111 },
+    { 0xb200, 0x0000, 0x0000, 0x063a0111 },
+    { 0xb200, 0x0000, 0x0000, 0x063b0111 },
+    { 0xb200, 0x0000, 0x0000, 0x063c0111 },
+    { 0xb200, 0x0000, 0x0000, 0x063d0111 },
+    { 0xb200, 0x0000, 0x0000, 0x063e0111 },
+    { 0xb200, 0x0000, 0x0000, 0x063f0111 },
+    { 0xb200, 0x0000, 0x0000, 0x06400111 },
+    { 0xb200, 0x0000, 0x0000, 0x06410111 },
+    { 0xb200, 0x0000, 0x0000, 0x06420111 },
+    { 0xb200, 0x0000, 0x0000, 0x06430111 },
+    { 0xb200, 0x0000, 0x0000, 0x06440111 },
+    { 0xb200, 0x0000, 0x0000, 0x06450111 },
+    { 0xb200, 0x0000, 0x0000, 0x06460111 },
+    { 0xb200, 0x0000, 0x0000, 0x06470111 },
+    { 0xb200, 0x0000, 0x0000, 0x06480111 },
+    { 0xb200, 0x0000, 0x0000, 0x06490111 },
+    { 0xb200, 0x0000, 0x0000, 0x064a0111 },
+    { 0xb200, 0x0000, 0x0000, 0x064b0111 },
+    { 0xb200, 0x0000, 0x0000, 0x064c0111 },
+    { 0xb200, 0x0000, 0x0000, 0x064d0111 },
+    { 0xb200, 0x0000, 0x0000, 0x064e0111 },
+    { 0xb200, 0x0000, 0x0000, 0x064f0111 },
+    { 0xb200, 0x0000, 0x0000, 0x06500111 },
+    { 0xb200, 0x0000, 0x0000, 0x06510111 },
+    { 0xb200, 0x0000, 0x0000, 0x06520111 },
+    { 0xb200, 0x0000, 0x0000, 0x06530111 },
+    { 0xb200, 0x0000, 0x0000, 0x06540111 },
+    { 0xb200, 0x0000, 0x0000, 0x06550111 },
+    { 0xb200, 0x0000, 0x0000, 0x06560111 },
+    { 0xb200, 0x0000, 0x0000, 0x06570111 },
+    { 0xb200, 0x0000, 0x0000, 0x06580111 },
+    { 0xb200, 0x0000, 0x0000, 0x06590111 },
+    { 0xb200, 0x0000, 0x0000, 0x065a0111 },
+    { 0xb200, 0x0000, 0x0000, 0x065b0111 },
+    { 0xb200, 0x0000, 0x0000, 0x065c0111 },
+    { 0xb200, 0x0000, 0x0000, 0x065d0111 },
+    { 0xb200, 0x0000, 0x0000, 0x065e0111 },
+    { 0xb200, 0x0000, 0x0000, 0x065f0111 },
+    { 0xb200, 0x0000, 0x0000, 0x06600111 },
+    { 0xb200, 0x0000, 0x0000, 0x06610111 },
+    { 0xb200, 0x0000, 0x0000, 0x06620111 },
+    { 0xb200, 0x0000, 0x0000, 0x06630111 },
+    { 0xb200, 0x0000, 0x0000, 0x06640111 },
+    { 0xb200, 0x0000, 0x0000, 0x06650111 },
+    { 0xb200, 0x0000, 0x0000, 0x06660111 },
+    { 0xb200, 0x0000, 0x0000, 0x06670111 },
+    { 0xb200, 0x0000, 0x0000, 0x06680111 },
+    { 0xb200, 0x0000, 0x0000, 0x06690111 },
+    { 0xb200, 0x0000, 0x0000, 0x066a0111 },
+    { 0xb200, 0x0000, 0x0000, 0x066b0111 },
+    { 0xb200, 0x0000, 0x0000, 0x066c0111 },
+    { 0xb200, 0x0000, 0x0000, 0x066d0111 },
+    { 0xb200, 0x0000, 0x0000, 0x066e0111 },
+    { 0xb200, 0x0000, 0x0000, 0x066f0111 },
+    { 0xb200, 0x0000, 0x0000, 0x06700111 },
+    { 0xb200, 0x0000, 0x0000, 0x06710111 },
+    { 0xb200, 0x0000, 0x0000, 0x06720111 },
+    { 0xb200, 0x0000, 0x0000, 0x06730111 },
+    { 0xb200, 0x0000, 0x0000, 0x06740111 },
+    { 0xb200, 0x0000, 0x0000, 0x06750111 },
+    { 0xb200, 0x0000, 0x0000, 0x06760111 },
+    { 0xb200, 0x0000, 0x0000, 0x06770111 },
+    { 0xb200, 0x0000, 0x0000, 0x06780111 },
+    { 0xb200, 0x0000, 0x0000, 0x06790111 },
+    { 0xb200, 0x0000, 0x0000, 0x067a0111 },
+    { 0xb200, 0x0000, 0x0000, 0x067b0111 },
+    { 0xb200, 0x0000, 0x0000, 0x067c0111 },
+    { 0xb200, 0x0000, 0x0000, 0x067d0111 },
+    { 0xb200, 0x0000, 0x0000, 0x067e0111 },
+    { 0xb200, 0x0000, 0x0000, 0x067f0111 },
+    { 0xb200, 0x0000, 0x0000, 0x06800111 },
+    { 0xb200, 0x0000, 0x0000, 0x06810111 },
+    { 0xb200, 0x0000, 0x0000, 0x06820111 },
+    { 0xb200, 0x0000, 0x0000, 0x06830111 },
+    { 0xb200, 0x0000, 0x0000, 0x0a080111 },
+    { 0xb200, 0x0000, 0x0000, 0x0a090111 },
+    { 0xb200, 0x0000, 0x0000, 0x0a0a0111 },
+    { 0xb200, 0x0000, 0x0000, 0x06840111 },
+    { 0xb200, 0x0000, 0x0000, 0x06850111 },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    /* block 39 */
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0x06860111 },
+    { 0xb200, 0x0000, 0x0000, 0x06870111 },
+    { 0xb200, 0x0000, 0x0000, 0x06880111 },
+    { 0xb200, 0x0000, 0x0000, 0x06890111 },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0x068a0111 },
+    { 0xb200, 0x0000, 0x0000, 0x068b0111 },
+    { 0xb200, 0x0000, 0x0000, 0x068c0111 },
+    { 0xb200, 0x0000, 0x0000, 0x068d0111 },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0x068e0111 },
+    { 0xb200, 0x0000, 0x0000, 0x068f0111 },
+    { 0xb200, 0x0000, 0x0000, 0x06900111 },
+    { 0xb200, 0x0000, 0x0000, 0x06910111 },
+    { 0xb200, 0x0000, 0x0000, 0x06920111 },
+    { 0xb200, 0x0000, 0x0000, 0x06930111 },
+    { 0xb200, 0x0000, 0x0000, 0x06940111 },
+    { 0xb200, 0x0000, 0x0000, 0x06950111 },
+    { 0xb200, 0x0000, 0x0000, 0x06960111 },
+    { 0xb200, 0x0000, 0x0000, 0x06970111 },
+    { 0xb200, 0x0000, 0x0000, 0x06980111 },
+    { 0xb200, 0x0000, 0x0000, 0x06990111 },
+    { 0xb200, 0x0000, 0x0000, 0x069a0111 },
+    { 0xb200, 0x0000, 0x0000, 0x069b0111 },
+    { 0xb200, 0x0000, 0x0000, 0x069c0111 },
+    { 0xb200, 0x0000, 0x0000, 0x069d0111 },
+    { 0xb200, 0x0000, 0x0000, 0x069e0111 },
+    { 0xb200, 0x0000, 0x0000, 0x069f0111 },
+    { 0xb200, 0x0000, 0x0000, 0x06a00111 },
+    { 0xb200, 0x0000, 0x0000, 0x06a10111 },
+    { 0xb200, 0x0000, 0x0000, 0x06a20111 },
+    { 0xb200, 0x0000, 0x0000, 0x06a30111 },
+    { 0xb200, 0x0000, 0x0000, 0x06a40111 },
+    { 0xb200, 0x0000, 0x0000, 0x06a50111 },
+    { 0xb200, 0x0000, 0x0000, 0x06a60111 },
+    { 0xb200, 0x0000, 0x0000, 0x06a70111 },
+    { 0xb200, 0x0000, 0x0000, 0x06a80111 },
+    { 0xb200, 0x0000, 0x0000, 0x06a90111 },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0x06aa0111 },
+    { 0xb200, 0x0000, 0x0000, 0x06ab0111 },
+    { 0xb200, 0x0000, 0x0000, 0x06ac0111 },
+    { 0xb200, 0x0000, 0x0000, 0x06ad0111 },
+    { 0xb200, 0x0000, 0x0000, 0x06ae0111 },
+    { 0xb200, 0x0000, 0x0000, 0x06af0111 },
+    { 0xb200, 0x0000, 0x0000, 0x06b00111 },
+    { 0xb200, 0x0000, 0x0000, 0x06b10111 },
+    { 0xb200, 0x0000, 0x0000, 0x06b20111 },
+    { 0xb200, 0x0000, 0x0000, 0x06b30111 },
+    { 0xb200, 0x0000, 0x0000, 0x06b40111 },
+    { 0xb200, 0x0000, 0x0000, 0x06b50111 },
+    { 0xb200, 0x0000, 0x0000, 0x06b60111 },
+    { 0xb200, 0x0000, 0x0000, 0x06b70111 },
+    { 0xb200, 0x0000, 0x0000, 0x06b80111 },
+    { 0xb200, 0x0000, 0x0000, 0x06b90111 },
+    { 0xb200, 0x0000, 0x0000, 0x06ba0111 },
+    { 0xb200, 0x0000, 0x0000, 0x06bb0111 },
+    { 0xb200, 0x0000, 0x0000, 0x06bc0111 },
+    { 0xb200, 0x0000, 0x0000, 0x06bd0111 },
+    { 0xb200, 0x0000, 0x0000, 0x06be0111 },
+    { 0xb200, 0x0000, 0x0000, 0x06bf0111 },
+    { 0xb200, 0x0000, 0x0000, 0x06c00111 },
+    { 0xb200, 0x0000, 0x0000, 0x06c10111 },
+    { 0xb200, 0x0000, 0x0000, 0x06c20111 },
+    { 0xb200, 0x0000, 0x0000, 0x06c30111 },
+    { 0xb200, 0x0000, 0x0000, 0x06c40111 },
+    { 0xb200, 0x0000, 0x0000, 0x06c50111 },
+    { 0xb200, 0x0000, 0x0000, 0x06c60111 },
+    { 0xb200, 0x0000, 0x0000, 0x06c70111 },
+    { 0xb200, 0x0000, 0x0000, 0x06c80111 },
+    { 0xb200, 0x0000, 0x0000, 0x06c90111 },
+    { 0xb200, 0x0000, 0x0000, 0x06ca0111 },
+    { 0xb200, 0x0000, 0x0000, 0x06cb0111 },
+    { 0xb200, 0x0000, 0x0000, 0x06cc0111 },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0x06cd0111 },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0x06ce0111 },
+    { 0xb200, 0x0000, 0x0000, 0x06cf0111 },
+    { 0xb200, 0x0000, 0x0000, 0x06d00111 },
+    { 0xb200, 0x0000, 0x0000, 0x06d10111 },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0x06d20111 },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0x06d30111 },
+    { 0xb200, 0x0000, 0x0000, 0x06d40111 },
+    { 0xb200, 0x0000, 0x0000, 0x06d50111 },
+    { 0xb200, 0x0000, 0x0000, 0x06d60111 },
+    { 0xb200, 0x0000, 0x0000, 0x06d70111 },
+    { 0xb200, 0x0000, 0x0000, 0x06d80111 },
+    { 0xb200, 0x0000, 0x0000, 0x06d90111 },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0x06da0111 },
+    { 0xb200, 0x0000, 0x0000, 0x06db0111 },
+    { 0xb200, 0x0000, 0x0000, 0x06dc0111 },
+    { 0xb200, 0x0000, 0x0000, 0x06dd0111 },
+    { 0xb200, 0x0000, 0x0000, 0x06de0111 },
+    { 0xb200, 0x0000, 0x0000, 0x06df0111 },
+    { 0xb200, 0x0000, 0x0000, 0x06e00111 },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0x0a0c0141 },
+    { 0xb200, 0x0000, 0x0000, 0x0a0d0141 },
+    { 0xb200, 0x0000, 0x0000, 0x0a0e0141 },
+    { 0xb200, 0x0000, 0x0000, 0x0a0f0141 },
+    { 0xb200, 0x0000, 0x0000, 0x0a100141 },
+    { 0xb200, 0x0000, 0x0000, 0x0a110141 },
+    { 0xb200, 0x0000, 0x0000, 0x0a120141 },
+    { 0xb200, 0x0000, 0x0000, 0x0a130141 },
+    { 0xb200, 0x0000, 0x0000, 0x0a140141 },
+    { 0xb200, 0x0000, 0x0000, 0x06e10111 },
+    { 0xb200, 0x0000, 0x0000, 0x0a0c0141 },
+    { 0xb200, 0x0000, 0x0000, 0x0a0d0141 },
+    { 0xb200, 0x0000, 0x0000, 0x0a0e0141 },
+    { 0xb200, 0x0000, 0x0000, 0x0a0f0141 },
+    { 0xb200, 0x0000, 0x0000, 0x0a100141 },
+    { 0xb200, 0x0000, 0x0000, 0x0a110141 },
+    { 0xb200, 0x0000, 0x0000, 0x0a120141 },
+    { 0xb200, 0x0000, 0x0000, 0x0a130141 },
+    { 0xb200, 0x0000, 0x0000, 0x0a140141 },
+    { 0xb200, 0x0000, 0x0000, 0x06e20111 },
+    { 0xb200, 0x0000, 0x0000, 0x0a0c0141 },
+    { 0xb200, 0x0000, 0x0000, 0x0a0d0141 },
+    { 0xb200, 0x0000, 0x0000, 0x0a0e0141 },
+    { 0xb200, 0x0000, 0x0000, 0x0a0f0141 },
+    { 0xb200, 0x0000, 0x0000, 0x0a100141 },
+    { 0xb200, 0x0000, 0x0000, 0x0a110141 },
+    { 0xb200, 0x0000, 0x0000, 0x0a120141 },
+    { 0xb200, 0x0000, 0x0000, 0x0a130141 },
+    { 0xb200, 0x0000, 0x0000, 0x0a140141 },
+    { 0xb200, 0x0000, 0x0000, 0x06e30111 },
+    { 0xb200, 0x0000, 0x0000, 0x06e40111 },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0x06e50111 },
+    { 0xb200, 0x0000, 0x0000, 0x06e60111 },
+    { 0xb200, 0x0000, 0x0000, 0x06e70111 },
+    { 0xb200, 0x0000, 0x0000, 0x06e80111 },
+    { 0xb200, 0x0000, 0x0000, 0x06e90111 },
+    { 0xb200, 0x0000, 0x0000, 0x06ea0111 },
+    { 0xb200, 0x0000, 0x0000, 0x06eb0111 },
+    { 0xb200, 0x0000, 0x0000, 0x06ec0111 },
+    { 0xb200, 0x0000, 0x0000, 0x06ed0111 },
+    { 0xb200, 0x0000, 0x0000, 0x06ee0111 },
+    { 0xb200, 0x0000, 0x0000, 0x06ef0111 },
+    { 0xb200, 0x0000, 0x0000, 0x06f00111 },
+    { 0xb200, 0x0000, 0x0000, 0x06f10111 },
+    { 0xb200, 0x0000, 0x0000, 0x06f20111 },
+    { 0xb200, 0x0000, 0x0000, 0x06f30111 },
+    { 0xb200, 0x0000, 0x0000, 0x06f40111 },
+    { 0xb200, 0x0000, 0x0000, 0x06f50111 },
+    { 0xb200, 0x0000, 0x0000, 0x06f60111 },
+    { 0xb200, 0x0000, 0x0000, 0x06f70111 },
+    { 0xb200, 0x0000, 0x0000, 0x06f80111 },
+    { 0xb200, 0x0000, 0x0000, 0x06f90111 },
+    { 0xb200, 0x0000, 0x0000, 0x06fa0111 },
+    { 0xb200, 0x0000, 0x0000, 0x06fb0111 },
+    { 0xb200, 0x0000, 0x0000, 0x06fc0111 },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0x06fd0111 },
+    { 0xb200, 0x0000, 0x0000, 0x06fe0111 },
+    { 0xb200, 0x0000, 0x0000, 0x06ff0111 },
+    { 0xb200, 0x0000, 0x0000, 0x07000111 },
+    { 0xb200, 0x0000, 0x0000, 0x07010111 },
+    { 0xb200, 0x0000, 0x0000, 0x07020111 },
+    { 0xb200, 0x0000, 0x0000, 0x07030111 },
+    { 0xb200, 0x0000, 0x0000, 0x07040111 },
+    { 0xb200, 0x0000, 0x0000, 0x07050111 },
+    { 0xb200, 0x0000, 0x0000, 0x07060111 },
+    { 0xb200, 0x0000, 0x0000, 0x07070111 },
+    { 0xb200, 0x0000, 0x0000, 0x07080111 },
+    { 0xb200, 0x0000, 0x0000, 0x07090111 },
+    { 0xb200, 0x0000, 0x0000, 0x070a0111 },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    /* block 40 */
+    { 0x1200, 0x0000, 0x0000, 0x070b0111 },
+    { 0x1200, 0x0000, 0x0000, 0x070c0111 },
+    { 0x1200, 0x0000, 0x0000, 0x070d0111 },
+    { 0x1200, 0x0000, 0x0000, 0x070e0111 },
+    { 0x1200, 0x0000, 0x0000, 0x070f0111 },
+    { 0x1200, 0x0000, 0x0000, 0x07100111 },
+    { 0x1200, 0x0000, 0x0000, 0x07110111 },
+    { 0x1200, 0x0000, 0x0000, 0x07120111 },
+    { 0x1200, 0x0000, 0x0000, 0x07130111 },
+    { 0x1200, 0x0000, 0x0000, 0x07140111 },
+    { 0x1200, 0x0000, 0x0000, 0x07150111 },
+    { 0x1200, 0x0000, 0x0000, 0x07160111 },
+    { 0x1200, 0x0000, 0x0000, 0x07170111 },
+    { 0x1200, 0x0000, 0x0000, 0x07180111 },
+    { 0x1200, 0x0000, 0x0000, 0x07190111 },
+    { 0x1200, 0x0000, 0x0000, 0x071a0111 },
+    { 0x1200, 0x0000, 0x0000, 0x071b0111 },
+    { 0x1200, 0x0000, 0x0000, 0x071c0111 },
+    { 0x1200, 0x0000, 0x0000, 0x071d0111 },
+    { 0x1200, 0x0000, 0x0000, 0x071e0111 },
+    { 0x1200, 0x0000, 0x0000, 0x071f0111 },
+    { 0x1200, 0x0000, 0x0000, 0x07200111 },
+    { 0x1200, 0x0000, 0x0000, 0x07210111 },
+    { 0x1200, 0x0000, 0x0000, 0x07220111 },
+    { 0x1200, 0x0000, 0x0000, 0x07230111 },
+    { 0x1200, 0x0000, 0x0000, 0x07240111 },
+    { 0x1200, 0x0000, 0x0000, 0x07250111 },
+    { 0x1200, 0x0000, 0x0000, 0x07260111 },
+    { 0x1200, 0x0000, 0x0000, 0x07270111 },
+    { 0x1200, 0x0000, 0x0000, 0x07280111 },
+    { 0x1200, 0x0000, 0x0000, 0x07290111 },
+    { 0x1200, 0x0000, 0x0000, 0x072a0111 },
+    { 0x1200, 0x0000, 0x0000, 0x072b0111 },
+    { 0x1200, 0x0000, 0x0000, 0x072c0111 },
+    { 0x1200, 0x0000, 0x0000, 0x072d0111 },
+    { 0x1200, 0x0000, 0x0000, 0x072e0111 },
+    { 0x1200, 0x0000, 0x0000, 0x072f0111 },
+    { 0x1200, 0x0000, 0x0000, 0x07300111 },
+    { 0x1200, 0x0000, 0x0000, 0x07310111 },
+    { 0x1200, 0x0000, 0x0000, 0x07320111 },
+    { 0x1200, 0x0000, 0x0000, 0x07330111 },
+    { 0x1200, 0x0000, 0x0000, 0x07340111 },
+    { 0x1200, 0x0000, 0x0000, 0x07350111 },
+    { 0x1200, 0x0000, 0x0000, 0x07360111 },
+    { 0x1200, 0x0000, 0x0000, 0x07370111 },
+    { 0x1200, 0x0000, 0x0000, 0x07380111 },
+    { 0x1200, 0x0000, 0x0000, 0x07390111 },
+    { 0x1200, 0x0000, 0x0000, 0x073a0111 },
+    { 0x1200, 0x0000, 0x0000, 0x073b0111 },
+    { 0x1200, 0x0000, 0x0000, 0x073c0111 },
+    { 0x1200, 0x0000, 0x0000, 0x073d0111 },
+    { 0x1200, 0x0000, 0x0000, 0x073e0111 },
+    { 0x1200, 0x0000, 0x0000, 0x073f0111 },
+    { 0x1200, 0x0000, 0x0000, 0x07400111 },
+    { 0x1200, 0x0000, 0x0000, 0x07410111 },
+    { 0x1200, 0x0000, 0x0000, 0x07420111 },
+    { 0x1200, 0x0000, 0x0000, 0x07430111 },
+    { 0x1200, 0x0000, 0x0000, 0x07440111 },
+    { 0x1200, 0x0000, 0x0000, 0x07450111 },
+    { 0x1200, 0x0000, 0x0000, 0x07460111 },
+    { 0x1200, 0x0000, 0x0000, 0x07470111 },
+    { 0x1200, 0x0000, 0x0000, 0x07480111 },
+    { 0x1200, 0x0000, 0x0000, 0x07490111 },
+    { 0x1200, 0x0000, 0x0000, 0x074a0111 },
+    { 0x1200, 0x0000, 0x0000, 0x074b0111 },
+    { 0x1200, 0x0000, 0x0000, 0x074c0111 },
+    { 0x1200, 0x0000, 0x0000, 0x074d0111 },
+    { 0x1200, 0x0000, 0x0000, 0x074e0111 },
+    { 0x1200, 0x0000, 0x0000, 0x074f0111 },
+    { 0x1200, 0x0000, 0x0000, 0x07500111 },
+    { 0x1200, 0x0000, 0x0000, 0x07510111 },
+    { 0x1200, 0x0000, 0x0000, 0x07520111 },
+    { 0x1200, 0x0000, 0x0000, 0x07530111 },
+    { 0x1200, 0x0000, 0x0000, 0x07540111 },
+    { 0x1200, 0x0000, 0x0000, 0x07550111 },
+    { 0x1200, 0x0000, 0x0000, 0x07560111 },
+    { 0x1200, 0x0000, 0x0000, 0x07570111 },
+    { 0x1200, 0x0000, 0x0000, 0x07580111 },
+    { 0x1200, 0x0000, 0x0000, 0x07590111 },
+    { 0x1200, 0x0000, 0x0000, 0x075a0111 },
+    { 0x1200, 0x0000, 0x0000, 0x075b0111 },
+    { 0x1200, 0x0000, 0x0000, 0x075c0111 },
+    { 0x1200, 0x0000, 0x0000, 0x075d0111 },
+    { 0x1200, 0x0000, 0x0000, 0x075e0111 },
+    { 0x1200, 0x0000, 0x0000, 0x075f0111 },
+    { 0x1200, 0x0000, 0x0000, 0x07600111 },
+    { 0x1200, 0x0000, 0x0000, 0x07610111 },
+    { 0x1200, 0x0000, 0x0000, 0x07620111 },
+    { 0x1200, 0x0000, 0x0000, 0x07630111 },
+    { 0x1200, 0x0000, 0x0000, 0x07640111 },
+    { 0x1200, 0x0000, 0x0000, 0x07650111 },
+    { 0x1200, 0x0000, 0x0000, 0x07660111 },
+    { 0x1200, 0x0000, 0x0000, 0x07670111 },
+    { 0x1200, 0x0000, 0x0000, 0x07680111 },
+    { 0x1200, 0x0000, 0x0000, 0x07690111 },
+    { 0x1200, 0x0000, 0x0000, 0x076a0111 },
+    { 0x1200, 0x0000, 0x0000, 0x076b0111 },
+    { 0x1200, 0x0000, 0x0000, 0x076c0111 },
+    { 0x1200, 0x0000, 0x0000, 0x076d0111 },
+    { 0x1200, 0x0000, 0x0000, 0x076e0111 },
+    { 0x1200, 0x0000, 0x0000, 0x076f0111 },
+    { 0x1200, 0x0000, 0x0000, 0x07700111 },
+    { 0x1200, 0x0000, 0x0000, 0x07710111 },
+    { 0x1200, 0x0000, 0x0000, 0x07720111 },
+    { 0x1200, 0x0000, 0x0000, 0x07730111 },
+    { 0x1200, 0x0000, 0x0000, 0x07740111 },
+    { 0x1200, 0x0000, 0x0000, 0x07750111 },
+    { 0x1200, 0x0000, 0x0000, 0x07760111 },
+    { 0x1200, 0x0000, 0x0000, 0x07770111 },
+    { 0x1200, 0x0000, 0x0000, 0x07780111 },
+    { 0x1200, 0x0000, 0x0000, 0x07790111 },
+    { 0x1200, 0x0000, 0x0000, 0x077a0111 },
+    { 0x1200, 0x0000, 0x0000, 0x077b0111 },
+    { 0x1200, 0x0000, 0x0000, 0x077c0111 },
+    { 0x1200, 0x0000, 0x0000, 0x077d0111 },
+    { 0x1200, 0x0000, 0x0000, 0x077e0111 },
+    { 0x1200, 0x0000, 0x0000, 0x077f0111 },
+    { 0x1200, 0x0000, 0x0000, 0x07800111 },
+    { 0x1200, 0x0000, 0x0000, 0x07810111 },
+    { 0x1200, 0x0000, 0x0000, 0x07820111 },
+    { 0x1200, 0x0000, 0x0000, 0x07830111 },
+    { 0x1200, 0x0000, 0x0000, 0x07840111 },
+    { 0x1200, 0x0000, 0x0000, 0x07850111 },
+    { 0x1200, 0x0000, 0x0000, 0x07860111 },
+    { 0x1200, 0x0000, 0x0000, 0x07870111 },
+    { 0x1200, 0x0000, 0x0000, 0x07880111 },
+    { 0x1200, 0x0000, 0x0000, 0x07890111 },
+    { 0x1200, 0x0000, 0x0000, 0x078a0111 },
+    { 0x1200, 0x0000, 0x0000, 0x078b0111 },
+    { 0x1200, 0x0000, 0x0000, 0x078c0111 },
+    { 0x1200, 0x0000, 0x0000, 0x078d0111 },
+    { 0x1200, 0x0000, 0x0000, 0x078e0111 },
+    { 0x1200, 0x0000, 0x0000, 0x078f0111 },
+    { 0x1200, 0x0000, 0x0000, 0x07900111 },
+    { 0x1200, 0x0000, 0x0000, 0x07910111 },
+    { 0x1200, 0x0000, 0x0000, 0x07920111 },
+    { 0x1200, 0x0000, 0x0000, 0x07930111 },
+    { 0x1200, 0x0000, 0x0000, 0x07940111 },
+    { 0x1200, 0x0000, 0x0000, 0x07950111 },
+    { 0x1200, 0x0000, 0x0000, 0x07960111 },
+    { 0x1200, 0x0000, 0x0000, 0x07970111 },
+    { 0x1200, 0x0000, 0x0000, 0x07980111 },
+    { 0x1200, 0x0000, 0x0000, 0x07990111 },
+    { 0x1200, 0x0000, 0x0000, 0x079a0111 },
+    { 0x1200, 0x0000, 0x0000, 0x079b0111 },
+    { 0x1200, 0x0000, 0x0000, 0x079c0111 },
+    { 0x1200, 0x0000, 0x0000, 0x079d0111 },
+    { 0x1200, 0x0000, 0x0000, 0x079e0111 },
+    { 0x1200, 0x0000, 0x0000, 0x079f0111 },
+    { 0x1200, 0x0000, 0x0000, 0x07a00111 },
+    { 0x1200, 0x0000, 0x0000, 0x07a10111 },
+    { 0x1200, 0x0000, 0x0000, 0x07a20111 },
+    { 0x1200, 0x0000, 0x0000, 0x07a30111 },
+    { 0x1200, 0x0000, 0x0000, 0x07a40111 },
+    { 0x1200, 0x0000, 0x0000, 0x07a50111 },
+    { 0x1200, 0x0000, 0x0000, 0x07a60111 },
+    { 0x1200, 0x0000, 0x0000, 0x07a70111 },
+    { 0x1200, 0x0000, 0x0000, 0x07a80111 },
+    { 0x1200, 0x0000, 0x0000, 0x07a90111 },
+    { 0x1200, 0x0000, 0x0000, 0x07aa0111 },
+    { 0x1200, 0x0000, 0x0000, 0x07ab0111 },
+    { 0x1200, 0x0000, 0x0000, 0x07ac0111 },
+    { 0x1200, 0x0000, 0x0000, 0x07ad0111 },
+    { 0x1200, 0x0000, 0x0000, 0x07ae0111 },
+    { 0x1200, 0x0000, 0x0000, 0x07af0111 },
+    { 0x1200, 0x0000, 0x0000, 0x07b00111 },
+    { 0x1200, 0x0000, 0x0000, 0x07b10111 },
+    { 0x1200, 0x0000, 0x0000, 0x07b20111 },
+    { 0x1200, 0x0000, 0x0000, 0x07b30111 },
+    { 0x1200, 0x0000, 0x0000, 0x07b40111 },
+    { 0x1200, 0x0000, 0x0000, 0x07b50111 },
+    { 0x1200, 0x0000, 0x0000, 0x07b60111 },
+    { 0x1200, 0x0000, 0x0000, 0x07b70111 },
+    { 0x1200, 0x0000, 0x0000, 0x07b80111 },
+    { 0x1200, 0x0000, 0x0000, 0x07b90111 },
+    { 0x1200, 0x0000, 0x0000, 0x07ba0111 },
+    { 0x1200, 0x0000, 0x0000, 0x07bb0111 },
+    { 0x1200, 0x0000, 0x0000, 0x07bc0111 },
+    { 0x1200, 0x0000, 0x0000, 0x07bd0111 },
+    { 0x1200, 0x0000, 0x0000, 0x07be0111 },
+    { 0x1200, 0x0000, 0x0000, 0x07bf0111 },
+    { 0x1200, 0x0000, 0x0000, 0x07c00111 },
+    { 0x1200, 0x0000, 0x0000, 0x07c10111 },
+    { 0x1200, 0x0000, 0x0000, 0x07c20111 },
+    { 0x1200, 0x0000, 0x0000, 0x07c30111 },
+    { 0x1200, 0x0000, 0x0000, 0x07c40111 },
+    { 0x1200, 0x0000, 0x0000, 0x07c50111 },
+    { 0x1200, 0x0000, 0x0000, 0x07c60111 },
+    { 0x1200, 0x0000, 0x0000, 0x07c70111 },
+    { 0x1200, 0x0000, 0x0000, 0x07c80111 },
+    { 0x1200, 0x0000, 0x0000, 0x07c90111 },
+    { 0x1200, 0x0000, 0x0000, 0x07ca0111 },
+    { 0x1200, 0x0000, 0x0000, 0x07cb0111 },
+    { 0x1200, 0x0000, 0x0000, 0x07cc0111 },
+    { 0x1200, 0x0000, 0x0000, 0x07cd0111 },
+    { 0x1200, 0x0000, 0x0000, 0x07ce0111 },
+    { 0x1200, 0x0000, 0x0000, 0x07cf0111 },
+    { 0x1200, 0x0000, 0x0000, 0x07d00111 },
+    { 0x1200, 0x0000, 0x0000, 0x07d10111 },
+    { 0x1200, 0x0000, 0x0000, 0x07d20111 },
+    { 0x1200, 0x0000, 0x0000, 0x07d30111 },
+    { 0x1200, 0x0000, 0x0000, 0x07d40111 },
+    { 0x1200, 0x0000, 0x0000, 0x07d50111 },
+    { 0x1200, 0x0000, 0x0000, 0x07d60111 },
+    { 0x1200, 0x0000, 0x0000, 0x07d70111 },
+    { 0x1200, 0x0000, 0x0000, 0x07d80111 },
+    { 0x1200, 0x0000, 0x0000, 0x07d90111 },
+    { 0x1200, 0x0000, 0x0000, 0x07da0111 },
+    { 0x1200, 0x0000, 0x0000, 0x07db0111 },
+    { 0x1200, 0x0000, 0x0000, 0x07dc0111 },
+    { 0x1200, 0x0000, 0x0000, 0x07dd0111 },
+    { 0x1200, 0x0000, 0x0000, 0x07de0111 },
+    { 0x1200, 0x0000, 0x0000, 0x07df0111 },
+    { 0x1200, 0x0000, 0x0000, 0x07e00111 },
+    { 0x1200, 0x0000, 0x0000, 0x07e10111 },
+    { 0x1200, 0x0000, 0x0000, 0x07e20111 },
+    { 0x1200, 0x0000, 0x0000, 0x07e30111 },
+    { 0x1200, 0x0000, 0x0000, 0x07e40111 },
+    { 0x1200, 0x0000, 0x0000, 0x07e50111 },
+    { 0x1200, 0x0000, 0x0000, 0x07e60111 },
+    { 0x1200, 0x0000, 0x0000, 0x07e70111 },
+    { 0x1200, 0x0000, 0x0000, 0x07e80111 },
+    { 0x1200, 0x0000, 0x0000, 0x07e90111 },
+    { 0x1200, 0x0000, 0x0000, 0x07ea0111 },
+    { 0x1200, 0x0000, 0x0000, 0x07eb0111 },
+    { 0x1200, 0x0000, 0x0000, 0x07ec0111 },
+    { 0x1200, 0x0000, 0x0000, 0x07ed0111 },
+    { 0x1200, 0x0000, 0x0000, 0x07ee0111 },
+    { 0x1200, 0x0000, 0x0000, 0x07ef0111 },
+    { 0x1200, 0x0000, 0x0000, 0x07f00111 },
+    { 0x1200, 0x0000, 0x0000, 0x07f10111 },
+    { 0x1200, 0x0000, 0x0000, 0x07f20111 },
+    { 0x1200, 0x0000, 0x0000, 0x07f30111 },
+    { 0x1200, 0x0000, 0x0000, 0x07f40111 },
+    { 0x1200, 0x0000, 0x0000, 0x07f50111 },
+    { 0x1200, 0x0000, 0x0000, 0x07f60111 },
+    { 0x1200, 0x0000, 0x0000, 0x07f70111 },
+    { 0x1200, 0x0000, 0x0000, 0x07f80111 },
+    { 0x1200, 0x0000, 0x0000, 0x07f90111 },
+    { 0x1200, 0x0000, 0x0000, 0x07fa0111 },
+    { 0x1200, 0x0000, 0x0000, 0x07fb0111 },
+    { 0x1200, 0x0000, 0x0000, 0x07fc0111 },
+    { 0x1200, 0x0000, 0x0000, 0x07fd0111 },
+    { 0x1200, 0x0000, 0x0000, 0x07fe0111 },
+    { 0x1200, 0x0000, 0x0000, 0x07ff0111 },
+    { 0x1200, 0x0000, 0x0000, 0x08000111 },
+    { 0x1200, 0x0000, 0x0000, 0x08010111 },
+    { 0x1200, 0x0000, 0x0000, 0x08020111 },
+    { 0x1200, 0x0000, 0x0000, 0x08030111 },
+    { 0x1200, 0x0000, 0x0000, 0x08040111 },
+    { 0x1200, 0x0000, 0x0000, 0x08050111 },
+    { 0x1200, 0x0000, 0x0000, 0x08060111 },
+    { 0x1200, 0x0000, 0x0000, 0x08070111 },
+    { 0x1200, 0x0000, 0x0000, 0x08080111 },
+    { 0x1200, 0x0000, 0x0000, 0x08090111 },
+    { 0x1200, 0x0000, 0x0000, 0x080a0111 },
+    /* block 41 */
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    /* block 42 */
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    /* block 43 */
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    /* block 44 */
+    { 0x1301, 0x0030, 0x0000, 0xffffffff },
+    { 0x1301, 0x0030, 0x0000, 0xffffffff },
+    { 0x1301, 0x0030, 0x0000, 0xffffffff },
+    { 0x1301, 0x0030, 0x0000, 0xffffffff },
+    { 0x1301, 0x0030, 0x0000, 0xffffffff },
+    { 0x1301, 0x0030, 0x0000, 0xffffffff },
+    { 0x1301, 0x0030, 0x0000, 0xffffffff },
+    { 0x1301, 0x0030, 0x0000, 0xffffffff },
+    { 0x1301, 0x0030, 0x0000, 0xffffffff },
+    { 0x1301, 0x0030, 0x0000, 0xffffffff },
+    { 0x1301, 0x0030, 0x0000, 0xffffffff },
+    { 0x1301, 0x0030, 0x0000, 0xffffffff },
+    { 0x1301, 0x0030, 0x0000, 0xffffffff },
+    { 0x1301, 0x0030, 0x0000, 0xffffffff },
+    { 0x1301, 0x0030, 0x0000, 0xffffffff },
+    { 0x1301, 0x0030, 0x0000, 0xffffffff },
+    { 0x1301, 0x0030, 0x0000, 0xffffffff },
+    { 0x1301, 0x0030, 0x0000, 0xffffffff },
+    { 0x1301, 0x0030, 0x0000, 0xffffffff },
+    { 0x1301, 0x0030, 0x0000, 0xffffffff },
+    { 0x1301, 0x0030, 0x0000, 0xffffffff },
+    { 0x1301, 0x0030, 0x0000, 0xffffffff },
+    { 0x1301, 0x0030, 0x0000, 0xffffffff },
+    { 0x1301, 0x0030, 0x0000, 0xffffffff },
+    { 0x1301, 0x0030, 0x0000, 0xffffffff },
+    { 0x1301, 0x0030, 0x0000, 0xffffffff },
+    { 0x1301, 0x0030, 0x0000, 0xffffffff },
+    { 0x1301, 0x0030, 0x0000, 0xffffffff },
+    { 0x1301, 0x0030, 0x0000, 0xffffffff },
+    { 0x1301, 0x0030, 0x0000, 0xffffffff },
+    { 0x1301, 0x0030, 0x0000, 0xffffffff },
+    { 0x1301, 0x0030, 0x0000, 0xffffffff },
+    { 0x1301, 0x0030, 0x0000, 0xffffffff },
+    { 0x1301, 0x0030, 0x0000, 0xffffffff },
+    { 0x1301, 0x0030, 0x0000, 0xffffffff },
+    { 0x1301, 0x0030, 0x0000, 0xffffffff },
+    { 0x1301, 0x0030, 0x0000, 0xffffffff },
+    { 0x1301, 0x0030, 0x0000, 0xffffffff },
+    { 0x1301, 0x0030, 0x0000, 0xffffffff },
+    { 0x1301, 0x0030, 0x0000, 0xffffffff },
+    { 0x1301, 0x0030, 0x0000, 0xffffffff },
+    { 0x1301, 0x0030, 0x0000, 0xffffffff },
+    { 0x1301, 0x0030, 0x0000, 0xffffffff },
+    { 0x1301, 0x0030, 0x0000, 0xffffffff },
+    { 0x1301, 0x0030, 0x0000, 0xffffffff },
+    { 0x1301, 0x0030, 0x0000, 0xffffffff },
+    { 0x1301, 0x0030, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffd0, 0xffffffff },
+    { 0x1302, 0x0000, 0xffd0, 0xffffffff },
+    { 0x1302, 0x0000, 0xffd0, 0xffffffff },
+    { 0x1302, 0x0000, 0xffd0, 0xffffffff },
+    { 0x1302, 0x0000, 0xffd0, 0xffffffff },
+    { 0x1302, 0x0000, 0xffd0, 0xffffffff },
+    { 0x1302, 0x0000, 0xffd0, 0xffffffff },
+    { 0x1302, 0x0000, 0xffd0, 0xffffffff },
+    { 0x1302, 0x0000, 0xffd0, 0xffffffff },
+    { 0x1302, 0x0000, 0xffd0, 0xffffffff },
+    { 0x1302, 0x0000, 0xffd0, 0xffffffff },
+    { 0x1302, 0x0000, 0xffd0, 0xffffffff },
+    { 0x1302, 0x0000, 0xffd0, 0xffffffff },
+    { 0x1302, 0x0000, 0xffd0, 0xffffffff },
+    { 0x1302, 0x0000, 0xffd0, 0xffffffff },
+    { 0x1302, 0x0000, 0xffd0, 0xffffffff },
+    { 0x1302, 0x0000, 0xffd0, 0xffffffff },
+    { 0x1302, 0x0000, 0xffd0, 0xffffffff },
+    { 0x1302, 0x0000, 0xffd0, 0xffffffff },
+    { 0x1302, 0x0000, 0xffd0, 0xffffffff },
+    { 0x1302, 0x0000, 0xffd0, 0xffffffff },
+    { 0x1302, 0x0000, 0xffd0, 0xffffffff },
+    { 0x1302, 0x0000, 0xffd0, 0xffffffff },
+    { 0x1302, 0x0000, 0xffd0, 0xffffffff },
+    { 0x1302, 0x0000, 0xffd0, 0xffffffff },
+    { 0x1302, 0x0000, 0xffd0, 0xffffffff },
+    { 0x1302, 0x0000, 0xffd0, 0xffffffff },
+    { 0x1302, 0x0000, 0xffd0, 0xffffffff },
+    { 0x1302, 0x0000, 0xffd0, 0xffffffff },
+    { 0x1302, 0x0000, 0xffd0, 0xffffffff },
+    { 0x1302, 0x0000, 0xffd0, 0xffffffff },
+    { 0x1302, 0x0000, 0xffd0, 0xffffffff },
+    { 0x1302, 0x0000, 0xffd0, 0xffffffff },
+    { 0x1302, 0x0000, 0xffd0, 0xffffffff },
+    { 0x1302, 0x0000, 0xffd0, 0xffffffff },
+    { 0x1302, 0x0000, 0xffd0, 0xffffffff },
+    { 0x1302, 0x0000, 0xffd0, 0xffffffff },
+    { 0x1302, 0x0000, 0xffd0, 0xffffffff },
+    { 0x1302, 0x0000, 0xffd0, 0xffffffff },
+    { 0x1302, 0x0000, 0xffd0, 0xffffffff },
+    { 0x1302, 0x0000, 0xffd0, 0xffffffff },
+    { 0x1302, 0x0000, 0xffd0, 0xffffffff },
+    { 0x1302, 0x0000, 0xffd0, 0xffffffff },
+    { 0x1302, 0x0000, 0xffd0, 0xffffffff },
+    { 0x1302, 0x0000, 0xffd0, 0xffffffff },
+    { 0x1302, 0x0000, 0xffd0, 0xffffffff },
+    { 0x1302, 0x0000, 0xffd0, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0xd609, 0x0000, 0xffffffff },
+    { 0x1301, 0xf11a, 0x0000, 0xffffffff },
+    { 0x1301, 0xd619, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xd5d5, 0xffffffff },
+    { 0x1302, 0x0000, 0xd5d8, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0xd5e4, 0x0000, 0xffffffff },
+    { 0x1301, 0xd603, 0x0000, 0xffffffff },
+    { 0x1301, 0xd5e1, 0x0000, 0xffffffff },
+    { 0x1301, 0xd5e2, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1301, 0xd5c1, 0x0000, 0xffffffff },
+    { 0x1301, 0xd5c1, 0x0000, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    /* block 45 */
+    { 0x1302, 0x0000, 0xe3a0, 0xffffffff },
+    { 0x1302, 0x0000, 0xe3a0, 0xffffffff },
+    { 0x1302, 0x0000, 0xe3a0, 0xffffffff },
+    { 0x1302, 0x0000, 0xe3a0, 0xffffffff },
+    { 0x1302, 0x0000, 0xe3a0, 0xffffffff },
+    { 0x1302, 0x0000, 0xe3a0, 0xffffffff },
+    { 0x1302, 0x0000, 0xe3a0, 0xffffffff },
+    { 0x1302, 0x0000, 0xe3a0, 0xffffffff },
+    { 0x1302, 0x0000, 0xe3a0, 0xffffffff },
+    { 0x1302, 0x0000, 0xe3a0, 0xffffffff },
+    { 0x1302, 0x0000, 0xe3a0, 0xffffffff },
+    { 0x1302, 0x0000, 0xe3a0, 0xffffffff },
+    { 0x1302, 0x0000, 0xe3a0, 0xffffffff },
+    { 0x1302, 0x0000, 0xe3a0, 0xffffffff },
+    { 0x1302, 0x0000, 0xe3a0, 0xffffffff },
+    { 0x1302, 0x0000, 0xe3a0, 0xffffffff },
+    { 0x1302, 0x0000, 0xe3a0, 0xffffffff },
+    { 0x1302, 0x0000, 0xe3a0, 0xffffffff },
+    { 0x1302, 0x0000, 0xe3a0, 0xffffffff },
+    { 0x1302, 0x0000, 0xe3a0, 0xffffffff },
+    { 0x1302, 0x0000, 0xe3a0, 0xffffffff },
+    { 0x1302, 0x0000, 0xe3a0, 0xffffffff },
+    { 0x1302, 0x0000, 0xe3a0, 0xffffffff },
+    { 0x1302, 0x0000, 0xe3a0, 0xffffffff },
+    { 0x1302, 0x0000, 0xe3a0, 0xffffffff },
+    { 0x1302, 0x0000, 0xe3a0, 0xffffffff },
+    { 0x1302, 0x0000, 0xe3a0, 0xffffffff },
+    { 0x1302, 0x0000, 0xe3a0, 0xffffffff },
+    { 0x1302, 0x0000, 0xe3a0, 0xffffffff },
+    { 0x1302, 0x0000, 0xe3a0, 0xffffffff },
+    { 0x1302, 0x0000, 0xe3a0, 0xffffffff },
+    { 0x1302, 0x0000, 0xe3a0, 0xffffffff },
+    { 0x1302, 0x0000, 0xe3a0, 0xffffffff },
+    { 0x1302, 0x0000, 0xe3a0, 0xffffffff },
+    { 0x1302, 0x0000, 0xe3a0, 0xffffffff },
+    { 0x1302, 0x0000, 0xe3a0, 0xffffffff },
+    { 0x1302, 0x0000, 0xe3a0, 0xffffffff },
+    { 0x1302, 0x0000, 0xe3a0, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xe3a0, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xe3a0, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    /* block 46 */
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb300, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400111 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400111 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400111 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400111 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400111 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400111 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400111 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400111 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400111 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400111 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400111 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xfb400111 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400111 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400111 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400111 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400111 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400111 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400111 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400111 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400111 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400111 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400111 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400111 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400111 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400111 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410111 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410111 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410111 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410111 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410111 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410111 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410111 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410111 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410111 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410111 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410111 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410111 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410111 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410111 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410111 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410111 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410111 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410111 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410111 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410111 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410111 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410111 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410111 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410111 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410111 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410111 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410111 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410111 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410111 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410111 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410111 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410111 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410111 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410111 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410111 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410111 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    /* block 47 */
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb400121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0xb200, 0x0000, 0x0000, 0xfb410121 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0x09a90111 },
+    { 0xb200, 0x0000, 0x0000, 0x09aa0111 },
+    { 0xb200, 0x0000, 0x0000, 0x09ab0111 },
+    { 0xb200, 0x0000, 0x0000, 0x09ac0111 },
+    { 0xb200, 0x0000, 0x0000, 0x09ad0111 },
+    { 0xb200, 0x0000, 0x0000, 0x09ae0111 },
+    { 0xb200, 0x0000, 0x0000, 0x09af0111 },
+    { 0xb200, 0x0000, 0x0000, 0x09b00111 },
+    { 0xb200, 0x0000, 0x0000, 0x09b10111 },
+    { 0xb200, 0x0000, 0x0000, 0x09b20111 },
+    { 0xb200, 0x0000, 0x0000, 0x09b30111 },
+    { 0xb200, 0x0000, 0x0000, 0x09b40111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    /* block 48 */
+    { 0xa248, 0x0000, 0x0000, 0x02090121 },
+    { 0xb210, 0x0000, 0x0000, 0x02340111 },
+    { 0xb210, 0x0000, 0x0000, 0x025e0111 },
+    { 0xb210, 0x0000, 0x0000, 0x02b80111 },
+    { 0xb200, 0x0000, 0x0000, 0x09b50111 },
+    { 0x1300, 0x0000, 0x0000, 0x09d70111 },
+    { 0x1300, 0x0000, 0x0000, 0x192c0111 },
+    { 0x1300, 0x0000, 0x0000, 0x0a0b0111 },
+    { 0xb210, 0x0000, 0x0000, 0x02880111 },
+    { 0xb210, 0x0000, 0x0000, 0x02890111 },
+    { 0xb210, 0x0000, 0x0000, 0x028a0111 },
+    { 0xb210, 0x0000, 0x0000, 0x028b0111 },
+    { 0xb210, 0x0000, 0x0000, 0x028c0111 },
+    { 0xb210, 0x0000, 0x0000, 0x028d0111 },
+    { 0xb210, 0x0000, 0x0000, 0x028e0111 },
+    { 0xb210, 0x0000, 0x0000, 0x028f0111 },
+    { 0xb210, 0x0000, 0x0000, 0x02900111 },
+    { 0xb210, 0x0000, 0x0000, 0x02910111 },
+    { 0xb200, 0x0000, 0x0000, 0x09b60111 },
+    { 0xb200, 0x0000, 0x0000, 0x09b70111 },
+    { 0xb210, 0x0000, 0x0000, 0x02920111 },
+    { 0xb210, 0x0000, 0x0000, 0x02930111 },
+    { 0xb210, 0x0000, 0x0000, 0x02940111 },
+    { 0xb210, 0x0000, 0x0000, 0x02950111 },
+    { 0xb210, 0x0000, 0x0000, 0x02960111 },
+    { 0xb210, 0x0000, 0x0000, 0x02970111 },
+    { 0xb210, 0x0000, 0x0000, 0x02980111 },
+    { 0xb210, 0x0000, 0x0000, 0x02990111 },
+    { 0xb210, 0x0000, 0x0000, 0x022a0111 },
+    { 0xb210, 0x0000, 0x0000, 0x02750111 },
+    { 0xb210, 0x0000, 0x0000, 0x02760111 },
+    { 0xb210, 0x0000, 0x0000, 0x02770111 },
+    { 0xb200, 0x0000, 0x0000, 0x09b80111 },
+    { 0x1300, 0x0000, 0x0000, 0x0a0c0111 },
+    { 0x1300, 0x0000, 0x0000, 0x0a0d0111 },
+    { 0x1300, 0x0000, 0x0000, 0x0a0e0111 },
+    { 0x1300, 0x0000, 0x0000, 0x0a0f0111 },
+    { 0x1300, 0x0000, 0x0000, 0x0a100111 },
+    { 0x1300, 0x0000, 0x0000, 0x0a110111 },
+    { 0x1300, 0x0000, 0x0000, 0x0a120111 },
+    { 0x1300, 0x0000, 0x0000, 0x0a130111 },
+    { 0x1300, 0x0000, 0x0000, 0x0a140111 },
+    { 0xd200, 0x0000, 0x0000, 0x0000dc11 },
+    { 0xd200, 0x0000, 0x0000, 0x0000dd11 },
+    { 0xd200, 0x0000, 0x0000, 0x0000de11 },
+    { 0xd200, 0x0000, 0x0000, 0x0000df11 },
+    { 0x1200, 0x0000, 0x0000, 0x0000e011 },
+    { 0x1200, 0x0000, 0x0000, 0x0000e111 },
+    { 0xb210, 0x0000, 0x0000, 0x022b0111 },
+    { 0x1300, 0x0000, 0x0000, 0x09d80111 },
+    { 0x1300, 0x0000, 0x0000, 0x09d80111 },
+    { 0x1300, 0x0000, 0x0000, 0x09d90111 },
+    { 0x1300, 0x0000, 0x0000, 0x09d90111 },
+    { 0x1300, 0x0000, 0x0000, 0x09da0111 },
+    { 0xb200, 0x0000, 0x0000, 0x09b60121 },
+    { 0xb200, 0x0000, 0x0000, 0x09b90111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400121 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400121 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400121 },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0x09ba0111 },
+    { 0xb200, 0x0000, 0x0000, 0x09bb0111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x19210111 },
+    { 0x1300, 0x0000, 0x0000, 0x19210121 },
+    { 0x1300, 0x0000, 0x0000, 0x19220111 },
+    { 0x1300, 0x0000, 0x0000, 0x19220121 },
+    { 0x1300, 0x0000, 0x0000, 0x19230111 },
+    { 0x1300, 0x0000, 0x0000, 0x19230121 },
+    { 0x1300, 0x0000, 0x0000, 0x19240111 },
+    { 0x1300, 0x0000, 0x0000, 0x19240121 },
+    { 0x1300, 0x0000, 0x0000, 0x19250111 },
+    { 0x1300, 0x0000, 0x0000, 0x19250121 },
+    { 0x1300, 0x0000, 0x0000, 0x19260111 },
+    { 0x1300, 0x0000, 0x0000, 0x19260111 },
+    { 0x1300, 0x0000, 0x0000, 0x19270111 },
+    { 0x1300, 0x0000, 0x0000, 0x19270111 },
+    { 0x1300, 0x0000, 0x0000, 0x19280111 },
+    { 0x1300, 0x0000, 0x0000, 0x19280111 },
+    { 0x1300, 0x0000, 0x0000, 0x19290111 },
+    { 0x1300, 0x0000, 0x0000, 0x19290111 },
+    { 0x1300, 0x0000, 0x0000, 0x192a0111 },
+    { 0x1300, 0x0000, 0x0000, 0x192a0111 },
+    { 0x1300, 0x0000, 0x0000, 0x192b0111 },
+    { 0x1300, 0x0000, 0x0000, 0x192b0111 },
+    { 0x1300, 0x0000, 0x0000, 0x192c0121 },
+    { 0x1300, 0x0000, 0x0000, 0x192c0121 },
+    { 0x1300, 0x0000, 0x0000, 0x192d0111 },
+    { 0x1300, 0x0000, 0x0000, 0x192d0111 },
+    { 0x1300, 0x0000, 0x0000, 0x192e0111 },
+    { 0x1300, 0x0000, 0x0000, 0x192e0111 },
+    { 0x1300, 0x0000, 0x0000, 0x192f0111 },
+    { 0x1300, 0x0000, 0x0000, 0x192f0111 },
+    { 0x1300, 0x0000, 0x0000, 0x19300111 },
+    { 0x1300, 0x0000, 0x0000, 0x19300111 },
+    { 0x1300, 0x0000, 0x0000, 0x19310111 },
+    { 0x1300, 0x0000, 0x0000, 0x19310111 },
+    { 0x1300, 0x0000, 0x0000, 0x19320111 },
+    { 0x1300, 0x0000, 0x0000, 0x19320121 },
+    { 0x1300, 0x0000, 0x0000, 0x19320121 },
+    { 0x1300, 0x0000, 0x0000, 0x19330111 },
+    { 0x1300, 0x0000, 0x0000, 0x19330111 },
+    { 0x1300, 0x0000, 0x0000, 0x19340111 },
+    { 0x1300, 0x0000, 0x0000, 0x19340111 },
+    { 0x1300, 0x0000, 0x0000, 0x19350111 },
+    { 0x1300, 0x0000, 0x0000, 0x19360111 },
+    { 0x1300, 0x0000, 0x0000, 0x19370111 },
+    { 0x1300, 0x0000, 0x0000, 0x19380111 },
+    { 0x1300, 0x0000, 0x0000, 0x19390111 },
+    { 0x1300, 0x0000, 0x0000, 0x193a0111 },
+    { 0x1300, 0x0000, 0x0000, 0x193a0111 },
+    { 0x1300, 0x0000, 0x0000, 0x193a0111 },
+    { 0x1300, 0x0000, 0x0000, 0x193b0111 },
+    { 0x1300, 0x0000, 0x0000, 0x193b0111 },
+    { 0x1300, 0x0000, 0x0000, 0x193b0111 },
+    { 0x1300, 0x0000, 0x0000, 0x193c0111 },
+    { 0x1300, 0x0000, 0x0000, 0x193c0111 },
+    { 0x1300, 0x0000, 0x0000, 0x193c0111 },
+    { 0x1300, 0x0000, 0x0000, 0x193d0111 },
+    { 0x1300, 0x0000, 0x0000, 0x193d0111 },
+    { 0x1300, 0x0000, 0x0000, 0x193d0111 },
+    { 0x1300, 0x0000, 0x0000, 0x193e0111 },
+    { 0x1300, 0x0000, 0x0000, 0x193e0111 },
+    { 0x1300, 0x0000, 0x0000, 0x193e0111 },
+    { 0x1300, 0x0000, 0x0000, 0x193f0111 },
+    { 0x1300, 0x0000, 0x0000, 0x19400111 },
+    { 0x1300, 0x0000, 0x0000, 0x19410111 },
+    { 0x1300, 0x0000, 0x0000, 0x19420111 },
+    { 0x1300, 0x0000, 0x0000, 0x19430111 },
+    { 0x1300, 0x0000, 0x0000, 0x19440111 },
+    { 0x1300, 0x0000, 0x0000, 0x19440121 },
+    { 0x1300, 0x0000, 0x0000, 0x19450111 },
+    { 0x1300, 0x0000, 0x0000, 0x19450121 },
+    { 0x1300, 0x0000, 0x0000, 0x19460111 },
+    { 0x1300, 0x0000, 0x0000, 0x19460121 },
+    { 0x1300, 0x0000, 0x0000, 0x19470111 },
+    { 0x1300, 0x0000, 0x0000, 0x19480111 },
+    { 0x1300, 0x0000, 0x0000, 0x19490111 },
+    { 0x1300, 0x0000, 0x0000, 0x194a0111 },
+    { 0x1300, 0x0000, 0x0000, 0x194b0111 },
+    { 0x1300, 0x0000, 0x0000, 0x194c0111 },
+    { 0x1300, 0x0000, 0x0000, 0x194c0121 },
+    { 0x1300, 0x0000, 0x0000, 0x194d0111 },
+    { 0x1300, 0x0000, 0x0000, 0x194e0111 },
+    { 0x1300, 0x0000, 0x0000, 0x194f0111 },
+    { 0x1300, 0x0000, 0x0000, 0x19500111 },
+    { 0x1300, 0x0000, 0x0000, 0x19230121 },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0x0000e211 },
+    { 0xd200, 0x0000, 0x0000, 0x0000e311 },
+    { 0xb200, 0x0000, 0x0000, 0x021e0111 },
+    { 0xb200, 0x0000, 0x0000, 0x021f0111 },
+    { 0x1300, 0x0000, 0x0000, 0x09db0111 },
+    { 0x1300, 0x0000, 0x0000, 0x09db0111 },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x19210131 },
+    { 0x1300, 0x0000, 0x0000, 0x19210151 },
+    { 0x1300, 0x0000, 0x0000, 0x19220131 },
+    { 0x1300, 0x0000, 0x0000, 0x19220151 },
+    { 0x1300, 0x0000, 0x0000, 0x19230131 },
+    { 0x1300, 0x0000, 0x0000, 0x19230151 },
+    { 0x1300, 0x0000, 0x0000, 0x19240131 },
+    { 0x1300, 0x0000, 0x0000, 0x19240151 },
+    { 0x1300, 0x0000, 0x0000, 0x19250131 },
+    { 0x1300, 0x0000, 0x0000, 0x19250151 },
+    { 0x1300, 0x0000, 0x0000, 0x19260131 },
+    { 0x1300, 0x0000, 0x0000, 0x19260131 },
+    { 0x1300, 0x0000, 0x0000, 0x19270121 },
+    { 0x1300, 0x0000, 0x0000, 0x19270121 },
+    { 0x1300, 0x0000, 0x0000, 0x19280121 },
+    { 0x1300, 0x0000, 0x0000, 0x19280121 },
+    { 0x1300, 0x0000, 0x0000, 0x19290131 },
+    { 0x1300, 0x0000, 0x0000, 0x19290131 },
+    { 0x1300, 0x0000, 0x0000, 0x192a0121 },
+    { 0x1300, 0x0000, 0x0000, 0x192a0121 },
+    { 0x1300, 0x0000, 0x0000, 0x192b0121 },
+    { 0x1300, 0x0000, 0x0000, 0x192b0121 },
+    { 0x1300, 0x0000, 0x0000, 0x192c0131 },
+    { 0x1300, 0x0000, 0x0000, 0x192c0131 },
+    { 0x1300, 0x0000, 0x0000, 0x192d0121 },
+    { 0x1300, 0x0000, 0x0000, 0x192d0121 },
+    { 0x1300, 0x0000, 0x0000, 0x192e0121 },
+    { 0x1300, 0x0000, 0x0000, 0x192e0121 },
+    { 0x1300, 0x0000, 0x0000, 0x192f0121 },
+    { 0x1300, 0x0000, 0x0000, 0x192f0121 },
+    { 0x1300, 0x0000, 0x0000, 0x19300121 },
+    { 0x1300, 0x0000, 0x0000, 0x19300121 },
+    { 0x1300, 0x0000, 0x0000, 0x19310121 },
+    { 0x1300, 0x0000, 0x0000, 0x19310121 },
+    { 0x1300, 0x0000, 0x0000, 0x19320131 },
+    { 0x1300, 0x0000, 0x0000, 0x19320151 },
+    { 0x1300, 0x0000, 0x0000, 0x19320151 },
+    { 0x1300, 0x0000, 0x0000, 0x19330121 },
+    { 0x1300, 0x0000, 0x0000, 0x19330121 },
+    { 0x1300, 0x0000, 0x0000, 0x19340121 },
+    { 0x1300, 0x0000, 0x0000, 0x19340121 },
+    { 0x1300, 0x0000, 0x0000, 0x19350121 },
+    { 0x1300, 0x0000, 0x0000, 0x19360121 },
+    { 0x1300, 0x0000, 0x0000, 0x19370121 },
+    { 0x1300, 0x0000, 0x0000, 0x19380121 },
+    { 0x1300, 0x0000, 0x0000, 0x19390121 },
+    { 0x1300, 0x0000, 0x0000, 0x193a0121 },
+    { 0x1300, 0x0000, 0x0000, 0x193a0121 },
+    { 0x1300, 0x0000, 0x0000, 0x193a0121 },
+    { 0x1300, 0x0000, 0x0000, 0x193b0121 },
+    { 0x1300, 0x0000, 0x0000, 0x193b0121 },
+    { 0x1300, 0x0000, 0x0000, 0x193b0121 },
+    { 0x1300, 0x0000, 0x0000, 0x193c0121 },
+    { 0x1300, 0x0000, 0x0000, 0x193c0121 },
+    { 0x1300, 0x0000, 0x0000, 0x193c0121 },
+    { 0x1300, 0x0000, 0x0000, 0x193d0121 },
+    { 0x1300, 0x0000, 0x0000, 0x193d0121 },
+    { 0x1300, 0x0000, 0x0000, 0x193d0121 },
+    { 0x1300, 0x0000, 0x0000, 0x193e0121 },
+    { 0x1300, 0x0000, 0x0000, 0x193e0121 },
+    { 0x1300, 0x0000, 0x0000, 0x193e0121 },
+    { 0x1300, 0x0000, 0x0000, 0x193f0121 },
+    { 0x1300, 0x0000, 0x0000, 0x19400121 },
+    { 0x1300, 0x0000, 0x0000, 0x19410121 },
+    { 0x1300, 0x0000, 0x0000, 0x19420121 },
+    { 0x1300, 0x0000, 0x0000, 0x19430121 },
+    { 0x1300, 0x0000, 0x0000, 0x19440131 },
+    { 0x1300, 0x0000, 0x0000, 0x19440151 },
+    { 0x1300, 0x0000, 0x0000, 0x19450131 },
+    { 0x1300, 0x0000, 0x0000, 0x19450151 },
+    { 0x1300, 0x0000, 0x0000, 0x19460131 },
+    { 0x1300, 0x0000, 0x0000, 0x19460151 },
+    { 0x1300, 0x0000, 0x0000, 0x19470121 },
+    { 0x1300, 0x0000, 0x0000, 0x19480121 },
+    { 0x1300, 0x0000, 0x0000, 0x19490121 },
+    { 0x1300, 0x0000, 0x0000, 0x194a0121 },
+    { 0x1300, 0x0000, 0x0000, 0x194b0121 },
+    { 0x1300, 0x0000, 0x0000, 0x194c0131 },
+    { 0x1300, 0x0000, 0x0000, 0x194c0141 },
+    { 0x1300, 0x0000, 0x0000, 0x194d0121 },
+    { 0x1300, 0x0000, 0x0000, 0x194e0121 },
+    { 0x1300, 0x0000, 0x0000, 0x194f0121 },
+    { 0x1300, 0x0000, 0x0000, 0x19500121 },
+    { 0x1300, 0x0000, 0x0000, 0x19230151 },
+    { 0x1300, 0x0000, 0x0000, 0x19260121 },
+    { 0x1300, 0x0000, 0x0000, 0x19290121 },
+    { 0x1300, 0x0000, 0x0000, 0x194c0141 },
+    { 0x1300, 0x0000, 0x0000, 0x194d0121 },
+    { 0x1300, 0x0000, 0x0000, 0x194e0121 },
+    { 0x1300, 0x0000, 0x0000, 0x194f0121 },
+    { 0xb210, 0x0000, 0x0000, 0x022c0111 },
+    { 0x1300, 0x0000, 0x0000, 0x09dc0111 },
+    { 0x1300, 0x0000, 0x0000, 0x09dd0111 },
+    { 0x1300, 0x0000, 0x0000, 0x09dd0111 },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    /* block 49 */
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x19510111 },
+    { 0x1300, 0x0000, 0x0000, 0x19520111 },
+    { 0x1300, 0x0000, 0x0000, 0x19530111 },
+    { 0x1300, 0x0000, 0x0000, 0x19540111 },
+    { 0x1300, 0x0000, 0x0000, 0x19560111 },
+    { 0x1300, 0x0000, 0x0000, 0x19570111 },
+    { 0x1300, 0x0000, 0x0000, 0x19580111 },
+    { 0x1300, 0x0000, 0x0000, 0x19590111 },
+    { 0x1300, 0x0000, 0x0000, 0x195a0111 },
+    { 0x1300, 0x0000, 0x0000, 0x195b0111 },
+    { 0x1300, 0x0000, 0x0000, 0x195e0111 },
+    { 0x1300, 0x0000, 0x0000, 0x195f0111 },
+    { 0x1300, 0x0000, 0x0000, 0x19600111 },
+    { 0x1300, 0x0000, 0x0000, 0x19610111 },
+    { 0x1300, 0x0000, 0x0000, 0x19630111 },
+    { 0x1300, 0x0000, 0x0000, 0x19640111 },
+    { 0x1300, 0x0000, 0x0000, 0x19650111 },
+    { 0x1300, 0x0000, 0x0000, 0x19660111 },
+    { 0x1300, 0x0000, 0x0000, 0x19670111 },
+    { 0x1300, 0x0000, 0x0000, 0x19680111 },
+    { 0x1300, 0x0000, 0x0000, 0x19690111 },
+    { 0x1300, 0x0000, 0x0000, 0x196a0111 },
+    { 0x1300, 0x0000, 0x0000, 0x196b0111 },
+    { 0x1300, 0x0000, 0x0000, 0x196d0111 },
+    { 0x1300, 0x0000, 0x0000, 0x196e0111 },
+    { 0x1300, 0x0000, 0x0000, 0x19700111 },
+    { 0x1300, 0x0000, 0x0000, 0x19710111 },
+    { 0x1300, 0x0000, 0x0000, 0x19720111 },
+    { 0x1300, 0x0000, 0x0000, 0x19730111 },
+    { 0x1300, 0x0000, 0x0000, 0x19740111 },
+    { 0x1300, 0x0000, 0x0000, 0x19750111 },
+    { 0x1300, 0x0000, 0x0000, 0x19760111 },
+    { 0x1300, 0x0000, 0x0000, 0x19780111 },
+    { 0x1300, 0x0000, 0x0000, 0x197c0111 },
+    { 0x1300, 0x0000, 0x0000, 0x197d0111 },
+    { 0x1300, 0x0000, 0x0000, 0x197e0111 },
+    { 0x1300, 0x0000, 0x0000, 0x197f0111 },
+    { 0x1300, 0x0000, 0x0000, 0x19550111 },
+    { 0x1300, 0x0000, 0x0000, 0x195c0111 },
+    { 0x1300, 0x0000, 0x0000, 0x19620111 },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x18310121 },
+    { 0x1300, 0x0000, 0x0000, 0x18320121 },
+    { 0x1300, 0x0000, 0x0000, 0x18d10121 },
+    { 0x1300, 0x0000, 0x0000, 0x18330121 },
+    { 0x1300, 0x0000, 0x0000, 0x18d30121 },
+    { 0x1300, 0x0000, 0x0000, 0x18d40121 },
+    { 0x1300, 0x0000, 0x0000, 0x18340121 },
+    { 0x1300, 0x0000, 0x0000, 0x18350121 },
+    { 0x1300, 0x0000, 0x0000, 0x18360121 },
+    { 0x1300, 0x0000, 0x0000, 0x18d70121 },
+    { 0x1300, 0x0000, 0x0000, 0x18d80121 },
+    { 0x1300, 0x0000, 0x0000, 0x18d90121 },
+    { 0x1300, 0x0000, 0x0000, 0x18da0121 },
+    { 0x1300, 0x0000, 0x0000, 0x18db0121 },
+    { 0x1300, 0x0000, 0x0000, 0x18dc0121 },
+    { 0x1300, 0x0000, 0x0000, 0x184b0121 },
+    { 0x1300, 0x0000, 0x0000, 0x18370121 },
+    { 0x1300, 0x0000, 0x0000, 0x18380121 },
+    { 0x1300, 0x0000, 0x0000, 0x18390121 },
+    { 0x1300, 0x0000, 0x0000, 0x18520121 },
+    { 0x1300, 0x0000, 0x0000, 0x183a0121 },
+    { 0x1300, 0x0000, 0x0000, 0x183b0121 },
+    { 0x1300, 0x0000, 0x0000, 0x183c0121 },
+    { 0x1300, 0x0000, 0x0000, 0x183d0121 },
+    { 0x1300, 0x0000, 0x0000, 0x183e0121 },
+    { 0x1300, 0x0000, 0x0000, 0x183f0121 },
+    { 0x1300, 0x0000, 0x0000, 0x18400121 },
+    { 0x1300, 0x0000, 0x0000, 0x18410121 },
+    { 0x1300, 0x0000, 0x0000, 0x18420121 },
+    { 0x1300, 0x0000, 0x0000, 0x18430121 },
+    { 0x1300, 0x0000, 0x0000, 0x188d0121 },
+    { 0x1300, 0x0000, 0x0000, 0x188e0121 },
+    { 0x1300, 0x0000, 0x0000, 0x188f0121 },
+    { 0x1300, 0x0000, 0x0000, 0x18900121 },
+    { 0x1300, 0x0000, 0x0000, 0x18910121 },
+    { 0x1300, 0x0000, 0x0000, 0x18920121 },
+    { 0x1300, 0x0000, 0x0000, 0x18930121 },
+    { 0x1300, 0x0000, 0x0000, 0x18940121 },
+    { 0x1300, 0x0000, 0x0000, 0x18950121 },
+    { 0x1300, 0x0000, 0x0000, 0x18960121 },
+    { 0x1300, 0x0000, 0x0000, 0x18970121 },
+    { 0x1300, 0x0000, 0x0000, 0x18980121 },
+    { 0x1300, 0x0000, 0x0000, 0x18990121 },
+    { 0x1300, 0x0000, 0x0000, 0x189a0121 },
+    { 0x1300, 0x0000, 0x0000, 0x189b0121 },
+    { 0x1300, 0x0000, 0x0000, 0x189c0121 },
+    { 0x1300, 0x0000, 0x0000, 0x189d0121 },
+    { 0x1300, 0x0000, 0x0000, 0x189e0121 },
+    { 0x1300, 0x0000, 0x0000, 0x189f0121 },
+    { 0x1300, 0x0000, 0x0000, 0x18a00121 },
+    { 0x1300, 0x0000, 0x0000, 0x18a10121 },
+    { 0x1300, 0x0000, 0x0000, 0x188c0121 },
+    { 0x1300, 0x0000, 0x0000, 0x18450121 },
+    { 0x1300, 0x0000, 0x0000, 0x18460121 },
+    { 0x1300, 0x0000, 0x0000, 0x18ee0121 },
+    { 0x1300, 0x0000, 0x0000, 0x18ef0121 },
+    { 0x1300, 0x0000, 0x0000, 0x18f30121 },
+    { 0x1300, 0x0000, 0x0000, 0x18f50121 },
+    { 0x1300, 0x0000, 0x0000, 0x18fa0121 },
+    { 0x1300, 0x0000, 0x0000, 0x18fe0121 },
+    { 0x1300, 0x0000, 0x0000, 0x19000121 },
+    { 0x1300, 0x0000, 0x0000, 0x184d0121 },
+    { 0x1300, 0x0000, 0x0000, 0x19040121 },
+    { 0x1300, 0x0000, 0x0000, 0x19060121 },
+    { 0x1300, 0x0000, 0x0000, 0x184e0121 },
+    { 0x1300, 0x0000, 0x0000, 0x184f0121 },
+    { 0x1300, 0x0000, 0x0000, 0x18510121 },
+    { 0x1300, 0x0000, 0x0000, 0x18530121 },
+    { 0x1300, 0x0000, 0x0000, 0x18540121 },
+    { 0x1300, 0x0000, 0x0000, 0x18580121 },
+    { 0x1300, 0x0000, 0x0000, 0x185a0121 },
+    { 0x1300, 0x0000, 0x0000, 0x185c0121 },
+    { 0x1300, 0x0000, 0x0000, 0x185d0121 },
+    { 0x1300, 0x0000, 0x0000, 0x185e0121 },
+    { 0x1300, 0x0000, 0x0000, 0x185f0121 },
+    { 0x1300, 0x0000, 0x0000, 0x18600121 },
+    { 0x1300, 0x0000, 0x0000, 0x18630121 },
+    { 0x1300, 0x0000, 0x0000, 0x18670121 },
+    { 0x1300, 0x0000, 0x0000, 0x18710121 },
+    { 0x1300, 0x0000, 0x0000, 0x18780121 },
+    { 0x1300, 0x0000, 0x0000, 0x187d0121 },
+    { 0x1300, 0x0000, 0x0000, 0x19180121 },
+    { 0x1300, 0x0000, 0x0000, 0x19190121 },
+    { 0x1300, 0x0000, 0x0000, 0x18880121 },
+    { 0x1300, 0x0000, 0x0000, 0x18890121 },
+    { 0x1300, 0x0000, 0x0000, 0x188a0121 },
+    { 0x1300, 0x0000, 0x0000, 0x18b00121 },
+    { 0x1300, 0x0000, 0x0000, 0x18b10121 },
+    { 0x1300, 0x0000, 0x0000, 0x18b40121 },
+    { 0x1300, 0x0000, 0x0000, 0x18bd0121 },
+    { 0x1300, 0x0000, 0x0000, 0x18be0121 },
+    { 0x1300, 0x0000, 0x0000, 0x18c00121 },
+    { 0x1300, 0x0000, 0x0000, 0x18ca0121 },
+    { 0x1300, 0x0000, 0x0000, 0x18cd0121 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0x09bc0111 },
+    { 0x1200, 0x0000, 0x0000, 0x09bd0111 },
+    { 0x1200, 0x0000, 0x0000, 0xfb400141 },
+    { 0x1200, 0x0000, 0x0000, 0xfb400141 },
+    { 0x1200, 0x0000, 0x0000, 0xfb400141 },
+    { 0x1200, 0x0000, 0x0000, 0xfb400141 },
+    { 0x1200, 0x0000, 0x0000, 0xfb400141 },
+    { 0x1200, 0x0000, 0x0000, 0xfb400141 },
+    { 0x1200, 0x0000, 0x0000, 0xfb400141 },
+    { 0x1200, 0x0000, 0x0000, 0xfb400141 },
+    { 0x1200, 0x0000, 0x0000, 0xfb400141 },
+    { 0x1200, 0x0000, 0x0000, 0xfb400141 },
+    { 0x1200, 0x0000, 0x0000, 0xfb400141 },
+    { 0x1200, 0x0000, 0x0000, 0xfb400141 },
+    { 0x1200, 0x0000, 0x0000, 0xfb400141 },
+    { 0x1200, 0x0000, 0x0000, 0xfb400141 },
+    { 0x1300, 0x0000, 0x0000, 0x19510121 },
+    { 0x1300, 0x0000, 0x0000, 0x19670121 },
+    { 0x1300, 0x0000, 0x0000, 0x195f0121 },
+    { 0x1300, 0x0000, 0x0000, 0x195a0121 },
+    { 0x1300, 0x0000, 0x0000, 0x196f0111 },
+    { 0x1300, 0x0000, 0x0000, 0x196f0121 },
+    { 0x1300, 0x0000, 0x0000, 0x196c0111 },
+    { 0x1300, 0x0000, 0x0000, 0x196b0121 },
+    { 0x1300, 0x0000, 0x0000, 0x197e0121 },
+    { 0x1300, 0x0000, 0x0000, 0x196a0121 },
+    { 0x1300, 0x0000, 0x0000, 0x197d0121 },
+    { 0x1300, 0x0000, 0x0000, 0x197e0121 },
+    { 0x1300, 0x0000, 0x0000, 0x197b0111 },
+    { 0x1300, 0x0000, 0x0000, 0x195d0111 },
+    { 0x1300, 0x0000, 0x0000, 0x19700121 },
+    { 0x1300, 0x0000, 0x0000, 0x19720121 },
+    { 0x1300, 0x0000, 0x0000, 0x19790111 },
+    { 0x1300, 0x0000, 0x0000, 0x197a0111 },
+    { 0x1300, 0x0000, 0x0000, 0x19770111 },
+    { 0x1300, 0x0000, 0x0000, 0x197d0131 },
+    { 0x1300, 0x0000, 0x0000, 0x19520121 },
+    { 0x1300, 0x0000, 0x0000, 0x19570121 },
+    { 0x1300, 0x0000, 0x0000, 0x195b0121 },
+    { 0x1300, 0x0000, 0x0000, 0x195e0121 },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    /* block 50 */
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x1200, 0x0000, 0x0000, 0x027a0131 },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0x18310131 },
+    { 0x1200, 0x0000, 0x0000, 0x18330131 },
+    { 0x1200, 0x0000, 0x0000, 0x18340131 },
+    { 0x1200, 0x0000, 0x0000, 0x18360131 },
+    { 0x1200, 0x0000, 0x0000, 0x18370131 },
+    { 0x1200, 0x0000, 0x0000, 0x18380131 },
+    { 0x1200, 0x0000, 0x0000, 0x183a0131 },
+    { 0x1200, 0x0000, 0x0000, 0x183c0131 },
+    { 0x1200, 0x0000, 0x0000, 0x183d0131 },
+    { 0x1200, 0x0000, 0x0000, 0x183f0131 },
+    { 0x1200, 0x0000, 0x0000, 0x18400131 },
+    { 0x1200, 0x0000, 0x0000, 0x18410131 },
+    { 0x1200, 0x0000, 0x0000, 0x18420131 },
+    { 0x1200, 0x0000, 0x0000, 0x18430131 },
+    { 0x1200, 0x0000, 0x0000, 0x18310131 },
+    { 0x1200, 0x0000, 0x0000, 0x18330131 },
+    { 0x1200, 0x0000, 0x0000, 0x18340131 },
+    { 0x1200, 0x0000, 0x0000, 0x18360131 },
+    { 0x1200, 0x0000, 0x0000, 0x18370131 },
+    { 0x1200, 0x0000, 0x0000, 0x18380131 },
+    { 0x1200, 0x0000, 0x0000, 0x183a0131 },
+    { 0x1200, 0x0000, 0x0000, 0x183c0131 },
+    { 0x1200, 0x0000, 0x0000, 0x183d0131 },
+    { 0x1200, 0x0000, 0x0000, 0x183f0131 },
+    { 0x1200, 0x0000, 0x0000, 0x18400131 },
+    { 0x1200, 0x0000, 0x0000, 0x18410131 },
+    { 0x1200, 0x0000, 0x0000, 0x18420131 },
+    { 0x1200, 0x0000, 0x0000, 0x18430131 },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0x09be0111 },
+    { 0x1200, 0x0000, 0x0000, 0xfb400131 },
+    { 0x1200, 0x0000, 0x0000, 0xfb400131 },
+    { 0x1200, 0x0000, 0x0000, 0xfb400131 },
+    { 0x1200, 0x0000, 0x0000, 0xfb400131 },
+    { 0x1200, 0x0000, 0x0000, 0xfb400131 },
+    { 0x1200, 0x0000, 0x0000, 0xfb400131 },
+    { 0x1200, 0x0000, 0x0000, 0xfb400131 },
+    { 0x1200, 0x0000, 0x0000, 0xfb400131 },
+    { 0x1200, 0x0000, 0x0000, 0xfb400131 },
+    { 0x1200, 0x0000, 0x0000, 0xfb400131 },
+    { 0x1200, 0x0000, 0x0000, 0xfb400131 },
+    { 0x1200, 0x0000, 0x0000, 0xfb400131 },
+    { 0x1200, 0x0000, 0x0000, 0xfb400131 },
+    { 0x1200, 0x0000, 0x0000, 0xfb400131 },
+    { 0x1200, 0x0000, 0x0000, 0xfb410131 },
+    { 0x1200, 0x0000, 0x0000, 0xfb400131 },
+    { 0x1200, 0x0000, 0x0000, 0xfb400131 },
+    { 0x1200, 0x0000, 0x0000, 0xfb400131 },
+    { 0x1200, 0x0000, 0x0000, 0xfb400131 },
+    { 0x1200, 0x0000, 0x0000, 0xfb400131 },
+    { 0x1200, 0x0000, 0x0000, 0xfb400131 },
+    { 0x1200, 0x0000, 0x0000, 0xfb400131 },
+    { 0x1200, 0x0000, 0x0000, 0xfb410131 },
+    { 0x1200, 0x0000, 0x0000, 0xfb400131 },
+    { 0x1200, 0x0000, 0x0000, 0xfb400131 },
+    { 0x1200, 0x0000, 0x0000, 0xfb400131 },
+    { 0x1200, 0x0000, 0x0000, 0xfb400131 },
+    { 0x1200, 0x0000, 0x0000, 0xfb400131 },
+    { 0x1200, 0x0000, 0x0000, 0xfb410131 },
+    { 0x1200, 0x0000, 0x0000, 0xfb400131 },
+    { 0x1200, 0x0000, 0x0000, 0xfb400131 },
+    { 0x1200, 0x0000, 0x0000, 0xfb400131 },
+    { 0x1200, 0x0000, 0x0000, 0xfb410131 },
+    { 0x1200, 0x0000, 0x0000, 0xfb400131 },
+    { 0x1200, 0x0000, 0x0000, 0xfb400131 },
+    { 0x1200, 0x0000, 0x0000, 0xfb400131 },
+    { 0x1200, 0x0000, 0x0000, 0xfb400131 },
+    { 0x1200, 0x0000, 0x0000, 0xfb400131 },
+    { 0x1200, 0x0000, 0x0000, 0xfb400131 },
+    { 0x1200, 0x0000, 0x0000, 0xfb400131 },
+    { 0x1200, 0x0000, 0x0000, 0xfb400131 },
+    { 0x1200, 0x0000, 0x0000, 0xfb400131 },
+    { 0x1200, 0x0000, 0x0000, 0xfb400131 },
+    { 0x1200, 0x0000, 0x0000, 0xfb400131 },
+    { 0x1200, 0x0000, 0x0000, 0xfb400131 },
+    { 0x1200, 0x0000, 0x0000, 0xfb400131 },
+    { 0x1200, 0x0000, 0x0000, 0xfb410131 },
+    { 0x1200, 0x0000, 0x0000, 0xfb400131 },
+    { 0x1200, 0x0000, 0x0000, 0xfb400131 },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0x0a0c0131 },
+    { 0x1200, 0x0000, 0x0000, 0x0a0d0131 },
+    { 0x1200, 0x0000, 0x0000, 0x0a0e0131 },
+    { 0x1200, 0x0000, 0x0000, 0x0a0f0131 },
+    { 0x1200, 0x0000, 0x0000, 0x0a100131 },
+    { 0x1200, 0x0000, 0x0000, 0x0a110131 },
+    { 0x1200, 0x0000, 0x0000, 0x0a120131 },
+    { 0x1200, 0x0000, 0x0000, 0x0a130131 },
+    { 0x1200, 0x0000, 0x0000, 0x0a140131 },
+    { 0x1200, 0x0000, 0x0000, 0x0a0c0131 },
+    { 0x1200, 0x0000, 0x0000, 0x0a0c0131 },
+    { 0x1200, 0x0000, 0x0000, 0x0a0c0131 },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0x19210171 },
+    { 0x1200, 0x0000, 0x0000, 0x19220171 },
+    { 0x1200, 0x0000, 0x0000, 0x19230171 },
+    { 0x1200, 0x0000, 0x0000, 0x19240171 },
+    { 0x1200, 0x0000, 0x0000, 0x19250171 },
+    { 0x1200, 0x0000, 0x0000, 0x19260151 },
+    { 0x1200, 0x0000, 0x0000, 0x19270141 },
+    { 0x1200, 0x0000, 0x0000, 0x19280141 },
+    { 0x1200, 0x0000, 0x0000, 0x19290151 },
+    { 0x1200, 0x0000, 0x0000, 0x192a0141 },
+    { 0x1200, 0x0000, 0x0000, 0x192b0141 },
+    { 0x1200, 0x0000, 0x0000, 0x192c0151 },
+    { 0x1200, 0x0000, 0x0000, 0x192d0141 },
+    { 0x1200, 0x0000, 0x0000, 0x192e0141 },
+    { 0x1200, 0x0000, 0x0000, 0x192f0141 },
+    { 0x1200, 0x0000, 0x0000, 0x19300141 },
+    { 0x1200, 0x0000, 0x0000, 0x19310141 },
+    { 0x1200, 0x0000, 0x0000, 0x19320171 },
+    { 0x1200, 0x0000, 0x0000, 0x19330141 },
+    { 0x1200, 0x0000, 0x0000, 0x19340141 },
+    { 0x1200, 0x0000, 0x0000, 0x19350141 },
+    { 0x1200, 0x0000, 0x0000, 0x19360141 },
+    { 0x1200, 0x0000, 0x0000, 0x19370141 },
+    { 0x1200, 0x0000, 0x0000, 0x19380141 },
+    { 0x1200, 0x0000, 0x0000, 0x19390141 },
+    { 0x1200, 0x0000, 0x0000, 0x193a0141 },
+    { 0x1200, 0x0000, 0x0000, 0x193b0141 },
+    { 0x1200, 0x0000, 0x0000, 0x193c0141 },
+    { 0x1200, 0x0000, 0x0000, 0x193d0141 },
+    { 0x1200, 0x0000, 0x0000, 0x193e0141 },
+    { 0x1200, 0x0000, 0x0000, 0x193f0141 },
+    { 0x1200, 0x0000, 0x0000, 0x19400141 },
+    { 0x1200, 0x0000, 0x0000, 0x19410141 },
+    { 0x1200, 0x0000, 0x0000, 0x19420141 },
+    { 0x1200, 0x0000, 0x0000, 0x19430141 },
+    { 0x1200, 0x0000, 0x0000, 0x19440171 },
+    { 0x1200, 0x0000, 0x0000, 0x19450171 },
+    { 0x1200, 0x0000, 0x0000, 0x19460171 },
+    { 0x1200, 0x0000, 0x0000, 0x19470141 },
+    { 0x1200, 0x0000, 0x0000, 0x19480141 },
+    { 0x1200, 0x0000, 0x0000, 0x19490141 },
+    { 0x1200, 0x0000, 0x0000, 0x194a0141 },
+    { 0x1200, 0x0000, 0x0000, 0x194b0141 },
+    { 0x1200, 0x0000, 0x0000, 0x194c0161 },
+    { 0x1200, 0x0000, 0x0000, 0x194d0131 },
+    { 0x1200, 0x0000, 0x0000, 0x194e0131 },
+    { 0x1200, 0x0000, 0x0000, 0x194f0141 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    /* block 51 */
+    { 0x1200, 0x0000, 0x0000, 0x19210181 },
+    { 0x1200, 0x0000, 0x0000, 0x19210181 },
+    { 0x1200, 0x0000, 0x0000, 0x19210181 },
+    { 0x1200, 0x0000, 0x0000, 0x19210181 },
+    { 0x1200, 0x0000, 0x0000, 0x19220181 },
+    { 0x1200, 0x0000, 0x0000, 0x19220181 },
+    { 0x1200, 0x0000, 0x0000, 0x19230181 },
+    { 0x1200, 0x0000, 0x0000, 0x19240181 },
+    { 0x1200, 0x0000, 0x0000, 0x19240181 },
+    { 0x1200, 0x0000, 0x0000, 0x19250181 },
+    { 0x1200, 0x0000, 0x0000, 0x19250181 },
+    { 0x1200, 0x0000, 0x0000, 0x19260161 },
+    { 0x1200, 0x0000, 0x0000, 0x19260161 },
+    { 0x1200, 0x0000, 0x0000, 0x19260161 },
+    { 0x1200, 0x0000, 0x0000, 0x19260161 },
+    { 0x1200, 0x0000, 0x0000, 0x19260161 },
+    { 0x1200, 0x0000, 0x0000, 0x19270151 },
+    { 0x1200, 0x0000, 0x0000, 0x19270151 },
+    { 0x1200, 0x0000, 0x0000, 0x19270151 },
+    { 0x1200, 0x0000, 0x0000, 0x19270151 },
+    { 0x1200, 0x0000, 0x0000, 0x19270151 },
+    { 0x1200, 0x0000, 0x0000, 0x19270151 },
+    { 0x1200, 0x0000, 0x0000, 0x19270151 },
+    { 0x1200, 0x0000, 0x0000, 0x19270151 },
+    { 0x1200, 0x0000, 0x0000, 0x19280151 },
+    { 0x1200, 0x0000, 0x0000, 0x19280151 },
+    { 0x1200, 0x0000, 0x0000, 0x19280151 },
+    { 0x1200, 0x0000, 0x0000, 0x19280151 },
+    { 0x1200, 0x0000, 0x0000, 0x19290161 },
+    { 0x1200, 0x0000, 0x0000, 0x192a0151 },
+    { 0x1200, 0x0000, 0x0000, 0x192a0151 },
+    { 0x1200, 0x0000, 0x0000, 0x192b0151 },
+    { 0x1200, 0x0000, 0x0000, 0x192b0151 },
+    { 0x1200, 0x0000, 0x0000, 0x192c0161 },
+    { 0x1200, 0x0000, 0x0000, 0x192e0151 },
+    { 0x1200, 0x0000, 0x0000, 0x192e0151 },
+    { 0x1200, 0x0000, 0x0000, 0x19300151 },
+    { 0x1200, 0x0000, 0x0000, 0x19330151 },
+    { 0x1200, 0x0000, 0x0000, 0x19340151 },
+    { 0x1200, 0x0000, 0x0000, 0x19340151 },
+    { 0x1200, 0x0000, 0x0000, 0x19350151 },
+    { 0x1200, 0x0000, 0x0000, 0x19390151 },
+    { 0x1200, 0x0000, 0x0000, 0x193a0151 },
+    { 0x1200, 0x0000, 0x0000, 0x193a0151 },
+    { 0x1200, 0x0000, 0x0000, 0x193a0151 },
+    { 0x1200, 0x0000, 0x0000, 0x193a0151 },
+    { 0x1200, 0x0000, 0x0000, 0x193b0151 },
+    { 0x1200, 0x0000, 0x0000, 0x193b0151 },
+    { 0x1200, 0x0000, 0x0000, 0x193b0151 },
+    { 0x1200, 0x0000, 0x0000, 0x193b0151 },
+    { 0x1200, 0x0000, 0x0000, 0x193c0151 },
+    { 0x1200, 0x0000, 0x0000, 0x193c0151 },
+    { 0x1200, 0x0000, 0x0000, 0x193c0151 },
+    { 0x1200, 0x0000, 0x0000, 0x193c0151 },
+    { 0x1200, 0x0000, 0x0000, 0x193d0151 },
+    { 0x1200, 0x0000, 0x0000, 0x193d0151 },
+    { 0x1200, 0x0000, 0x0000, 0x193d0151 },
+    { 0x1200, 0x0000, 0x0000, 0x193d0151 },
+    { 0x1200, 0x0000, 0x0000, 0x193d0151 },
+    { 0x1200, 0x0000, 0x0000, 0x193d0151 },
+    { 0x1200, 0x0000, 0x0000, 0x193d0151 },
+    { 0x1200, 0x0000, 0x0000, 0x193e0151 },
+    { 0x1200, 0x0000, 0x0000, 0x193e0151 },
+    { 0x1200, 0x0000, 0x0000, 0x193e0151 },
+    { 0x1200, 0x0000, 0x0000, 0x193e0151 },
+    { 0x1200, 0x0000, 0x0000, 0x193e0151 },
+    { 0x1200, 0x0000, 0x0000, 0x193e0151 },
+    { 0x1200, 0x0000, 0x0000, 0x193f0151 },
+    { 0x1200, 0x0000, 0x0000, 0x193f0151 },
+    { 0x1200, 0x0000, 0x0000, 0x193f0151 },
+    { 0x1200, 0x0000, 0x0000, 0x193f0151 },
+    { 0x1200, 0x0000, 0x0000, 0x193f0151 },
+    { 0x1200, 0x0000, 0x0000, 0x19400151 },
+    { 0x1200, 0x0000, 0x0000, 0x19400151 },
+    { 0x1200, 0x0000, 0x0000, 0x19400151 },
+    { 0x1200, 0x0000, 0x0000, 0x19420151 },
+    { 0x1200, 0x0000, 0x0000, 0x19420151 },
+    { 0x1200, 0x0000, 0x0000, 0x19420151 },
+    { 0x1200, 0x0000, 0x0000, 0x19440181 },
+    { 0x1200, 0x0000, 0x0000, 0x19440181 },
+    { 0x1200, 0x0000, 0x0000, 0x19450181 },
+    { 0x1200, 0x0000, 0x0000, 0x19480151 },
+    { 0x1200, 0x0000, 0x0000, 0x19480151 },
+    { 0x1200, 0x0000, 0x0000, 0x19490151 },
+    { 0x1200, 0x0000, 0x0000, 0x19490151 },
+    { 0x1200, 0x0000, 0x0000, 0x194a0151 },
+    { 0x1200, 0x0000, 0x0000, 0x194a0151 },
+    { 0x1200, 0x0000, 0x0000, 0x194c0171 },
+    { 0x1200, 0x0000, 0x0000, 0x0a0b0131 },
+    { 0x1200, 0x0000, 0x0000, 0x0a0c0131 },
+    { 0x1200, 0x0000, 0x0000, 0x0a0d0131 },
+    { 0x1200, 0x0000, 0x0000, 0x0a0e0131 },
+    { 0x1200, 0x0000, 0x0000, 0x0a0f0131 },
+    { 0x1200, 0x0000, 0x0000, 0x0a100131 },
+    { 0x1200, 0x0000, 0x0000, 0x0a110131 },
+    { 0x1200, 0x0000, 0x0000, 0x0a120131 },
+    { 0x1200, 0x0000, 0x0000, 0x0a130131 },
+    { 0x1200, 0x0000, 0x0000, 0x0a140131 },
+    { 0x1200, 0x0000, 0x0000, 0x0a0c0131 },
+    { 0x1200, 0x0000, 0x0000, 0x0a0c0131 },
+    { 0x1200, 0x0000, 0x0000, 0x0a0c0131 },
+    { 0x1200, 0x0000, 0x0000, 0x0a0c0131 },
+    { 0x1200, 0x0000, 0x0000, 0x0a0c0131 },
+    { 0x1200, 0x0000, 0x0000, 0x0a0c0131 },
+    { 0x1200, 0x0000, 0x0000, 0x0a0c0131 },
+    { 0x1200, 0x0000, 0x0000, 0x0a0c0131 },
+    { 0x1200, 0x0000, 0x0000, 0x0a0c0131 },
+    { 0x1200, 0x0000, 0x0000, 0x0a0c0131 },
+    { 0x1200, 0x0000, 0x0000, 0x0a0d0131 },
+    { 0x1200, 0x0000, 0x0000, 0x0a0d0131 },
+    { 0x1200, 0x0000, 0x0000, 0x0a0d0131 },
+    { 0x1200, 0x0000, 0x0000, 0x0a0d0131 },
+    { 0x1200, 0x0000, 0x0000, 0x0a0d0131 },
+    { 0x1200, 0x0000, 0x0000, 0x0ab901a1 },
+    { 0x1200, 0x0000, 0x0000, 0x0a490191 },
+    { 0x1200, 0x0000, 0x0000, 0x0a1501a1 },
+    { 0x1200, 0x0000, 0x0000, 0x0a290181 },
+    { 0x1200, 0x0000, 0x0000, 0x0b4b01b1 },
+    { 0x1200, 0x0000, 0x0000, 0x0b670181 },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xfb400151 },
+    { 0x1200, 0x0000, 0x0000, 0xfb400151 },
+    { 0x1200, 0x0000, 0x0000, 0xfb400151 },
+    { 0x1200, 0x0000, 0x0000, 0xfb400151 },
+    { 0x1200, 0x0000, 0x0000, 0xfb400151 },
+    { 0x1200, 0x0000, 0x0000, 0x0b670181 },
+    { 0x1200, 0x0000, 0x0000, 0x0b3301b1 },
+    { 0x1200, 0x0000, 0x0000, 0x0c9f0141 },
+    { 0x1200, 0x0000, 0x0000, 0x0b2b01a1 },
+    { 0x1200, 0x0000, 0x0000, 0x0af70171 },
+    { 0x1200, 0x0000, 0x0000, 0x0af70181 },
+    { 0x1200, 0x0000, 0x0000, 0x0b2b01b1 },
+    { 0x1200, 0x0000, 0x0000, 0x0a990181 },
+    { 0x1200, 0x0000, 0x0000, 0x0a3d01a1 },
+    { 0x1200, 0x0000, 0x0000, 0x0af70171 },
+    { 0x1200, 0x0000, 0x0000, 0x0b670181 },
+    { 0x1200, 0x0000, 0x0000, 0x0b3301b1 },
+    { 0x1200, 0x0000, 0x0000, 0x0c9f0141 },
+    { 0x1200, 0x0000, 0x0000, 0x0c9f0141 },
+    { 0x1200, 0x0000, 0x0000, 0x0b2b01a1 },
+    { 0x1200, 0x0000, 0x0000, 0x0af70171 },
+    { 0x1200, 0x0000, 0x0000, 0x0ab901b1 },
+    { 0x1200, 0x0000, 0x0000, 0x0af70171 },
+    { 0x1200, 0x0000, 0x0000, 0x0b2b01b1 },
+    { 0x1200, 0x0000, 0x0000, 0x0a990181 },
+    { 0x1200, 0x0000, 0x0000, 0x0bbf01a1 },
+    { 0x1200, 0x0000, 0x0000, 0x0c9f0141 },
+    { 0x1200, 0x0000, 0x0000, 0x0b2b01a1 },
+    { 0x1200, 0x0000, 0x0000, 0x0a490191 },
+    { 0x1200, 0x0000, 0x0000, 0x0af70171 },
+    { 0x1200, 0x0000, 0x0000, 0x0a910191 },
+    { 0x1200, 0x0000, 0x0000, 0x0b3301b1 },
+    { 0x1200, 0x0000, 0x0000, 0x0c9f0141 },
+    { 0x1200, 0x0000, 0x0000, 0x0b2b01a1 },
+    { 0x1200, 0x0000, 0x0000, 0x0a3d01a1 },
+    { 0x1200, 0x0000, 0x0000, 0x0af70171 },
+    { 0x1200, 0x0000, 0x0000, 0x0b2b01a1 },
+    { 0x1200, 0x0000, 0x0000, 0x0a3d01a1 },
+    { 0x1200, 0x0000, 0x0000, 0x0b2b01a1 },
+    { 0x1200, 0x0000, 0x0000, 0x0af70171 },
+    { 0x1200, 0x0000, 0x0000, 0x0b2b01a1 },
+    { 0x1200, 0x0000, 0x0000, 0x0a3d01a1 },
+    { 0x1200, 0x0000, 0x0000, 0x0b2b01a1 },
+    { 0x1200, 0x0000, 0x0000, 0x0af70171 },
+    { 0x1200, 0x0000, 0x0000, 0x0b2b01a1 },
+    { 0x1200, 0x0000, 0x0000, 0x0b2b01a1 },
+    { 0x1200, 0x0000, 0x0000, 0x0b670191 },
+    { 0x1200, 0x0000, 0x0000, 0x0af70171 },
+    { 0x1200, 0x0000, 0x0000, 0x0b2b01b1 },
+    { 0x1200, 0x0000, 0x0000, 0x0a990181 },
+    { 0x1200, 0x0000, 0x0000, 0x0b7f01a1 },
+    { 0x1200, 0x0000, 0x0000, 0x0b7f01a1 },
+    { 0x1200, 0x0000, 0x0000, 0x0b7f01a1 },
+    { 0x1200, 0x0000, 0x0000, 0x0b670181 },
+    { 0x1200, 0x0000, 0x0000, 0x0b3301b1 },
+    { 0x1200, 0x0000, 0x0000, 0x0c9f0141 },
+    { 0x1200, 0x0000, 0x0000, 0x0b2b01a1 },
+    { 0x1200, 0x0000, 0x0000, 0x0b670181 },
+    { 0x1200, 0x0000, 0x0000, 0x0b3301b1 },
+    { 0x1200, 0x0000, 0x0000, 0x0c9f0141 },
+    { 0x1200, 0x0000, 0x0000, 0x0b2b01a1 },
+    { 0x1200, 0x0000, 0x0000, 0x0af70171 },
+    { 0x1200, 0x0000, 0x0000, 0x0b2b01b1 },
+    { 0x1200, 0x0000, 0x0000, 0x0b670181 },
+    { 0x1200, 0x0000, 0x0000, 0x0b3301b1 },
+    { 0x1200, 0x0000, 0x0000, 0x0c9f0141 },
+    { 0x1200, 0x0000, 0x0000, 0x0b2b01a1 },
+    { 0x1200, 0x0000, 0x0000, 0x0af70171 },
+    { 0x1200, 0x0000, 0x0000, 0x0b2b01b1 },
+    { 0x1200, 0x0000, 0x0000, 0x0af70171 },
+    { 0x1200, 0x0000, 0x0000, 0x0b2b01b1 },
+    { 0x1200, 0x0000, 0x0000, 0x0a150191 },
+    { 0x1200, 0x0000, 0x0000, 0x0a290191 },
+    { 0x1200, 0x0000, 0x0000, 0x0a3d01a1 },
+    { 0x1200, 0x0000, 0x0000, 0x0a3d01a1 },
+    { 0x1200, 0x0000, 0x0000, 0x0a3d01b1 },
+    { 0x1200, 0x0000, 0x0000, 0x0a3d01b1 },
+    { 0x1200, 0x0000, 0x0000, 0x0a490191 },
+    { 0x1200, 0x0000, 0x0000, 0x0a990181 },
+    { 0x1200, 0x0000, 0x0000, 0x0ab901a1 },
+    { 0x1200, 0x0000, 0x0000, 0x0ab901b1 },
+    { 0x1200, 0x0000, 0x0000, 0x0ad301b1 },
+    { 0x1200, 0x0000, 0x0000, 0x0af70181 },
+    { 0x1200, 0x0000, 0x0000, 0x0af70181 },
+    { 0x1200, 0x0000, 0x0000, 0x0af70171 },
+    { 0x1200, 0x0000, 0x0000, 0x0b0301c1 },
+    { 0x1200, 0x0000, 0x0000, 0x0b0301c1 },
+    { 0x1200, 0x0000, 0x0000, 0x0b0301c1 },
+    { 0x1200, 0x0000, 0x0000, 0x0b0301c1 },
+    { 0x1200, 0x0000, 0x0000, 0x0b2b01a1 },
+    { 0x1200, 0x0000, 0x0000, 0x0b2b01a1 },
+    { 0x1200, 0x0000, 0x0000, 0x0b2b01a1 },
+    { 0x1200, 0x0000, 0x0000, 0x0b670191 },
+    { 0x1200, 0x0000, 0x0000, 0x0b670181 },
+    { 0x1200, 0x0000, 0x0000, 0x0b670191 },
+    { 0x1200, 0x0000, 0x0000, 0x0b670191 },
+    { 0x1200, 0x0000, 0x0000, 0x0ba70191 },
+    { 0x1200, 0x0000, 0x0000, 0x0ba701a1 },
+    { 0x1200, 0x0000, 0x0000, 0x0bfb0181 },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0x0a0c0131 },
+    { 0x1200, 0x0000, 0x0000, 0x0a0d0131 },
+    { 0x1200, 0x0000, 0x0000, 0x0a0e0131 },
+    { 0x1200, 0x0000, 0x0000, 0x0a0f0131 },
+    { 0x1200, 0x0000, 0x0000, 0x0a100131 },
+    { 0x1200, 0x0000, 0x0000, 0x0a110131 },
+    { 0x1200, 0x0000, 0x0000, 0x0a120131 },
+    { 0x1200, 0x0000, 0x0000, 0x0a130131 },
+    { 0x1200, 0x0000, 0x0000, 0x0a140131 },
+    { 0x1200, 0x0000, 0x0000, 0x0a0c0131 },
+    { 0x1200, 0x0000, 0x0000, 0x0a0c0131 },
+    { 0x1200, 0x0000, 0x0000, 0x0a0c0131 },
+    { 0x1200, 0x0000, 0x0000, 0x0a0c0131 },
+    { 0x1200, 0x0000, 0x0000, 0x0a0c0131 },
+    { 0x1200, 0x0000, 0x0000, 0x0a0c0131 },
+    { 0x1200, 0x0000, 0x0000, 0x0a0c0131 },
+    { 0x1200, 0x0000, 0x0000, 0x0a0c0131 },
+    { 0x1200, 0x0000, 0x0000, 0x0a0c0131 },
+    { 0x1200, 0x0000, 0x0000, 0x0a0c0131 },
+    { 0x1200, 0x0000, 0x0000, 0x0a0d0131 },
+    { 0x1200, 0x0000, 0x0000, 0x0a0d0131 },
+    { 0x1200, 0x0000, 0x0000, 0x0a0d0131 },
+    { 0x1200, 0x0000, 0x0000, 0x0a0d0131 },
+    { 0x1200, 0x0000, 0x0000, 0x0a0d0131 },
+    { 0x1200, 0x0000, 0x0000, 0x0a0d0131 },
+    { 0x1200, 0x0000, 0x0000, 0x0a0d0131 },
+    { 0x1200, 0x0000, 0x0000, 0x0a0d0131 },
+    { 0x1200, 0x0000, 0x0000, 0x0a0d0131 },
+    { 0x1200, 0x0000, 0x0000, 0x0a0d0131 },
+    { 0x1200, 0x0000, 0x0000, 0x0a0e0131 },
+    { 0x1200, 0x0000, 0x0000, 0x0a0e0131 },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    /* block 52 */
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    /* block 53 */
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    /* block 54 */
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    /* block 55 */
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    /* block 56 */
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    /* block 57 */
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb300, 0x0000, 0x0000, 0xffffffff },
+    { 0xb300, 0x0000, 0x0000, 0xffffffff },
+    { 0xb300, 0x0000, 0x0000, 0xffffffff },
+    { 0xb300, 0x0000, 0x0000, 0xffffffff },
+    { 0xb300, 0x0000, 0x0000, 0xffffffff },
+    { 0xb300, 0x0000, 0x0000, 0xffffffff },
+    { 0xb300, 0x0000, 0x0000, 0xffffffff },
+    { 0xb300, 0x0000, 0x0000, 0xffffffff },
+    { 0xb300, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x75fc, 0x0000, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0xb300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x5ad8, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x5abc, 0x0000, 0xffffffff },
+    { 0x1301, 0x5ab1, 0x0000, 0xffffffff },
+    { 0x1301, 0x5ab5, 0x0000, 0xffffffff },
+    { 0x1301, 0x5abf, 0x0000, 0xffffffff },
+    { 0x1301, 0x5abc, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1301, 0x5aee, 0x0000, 0xffffffff },
+    { 0x1301, 0x5ad6, 0x0000, 0xffffffff },
+    { 0x1301, 0x5aeb, 0x0000, 0xffffffff },
+    { 0x1301, 0x03a0, 0x0000, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x1301, 0x0001, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xffff, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    /* block 58 */
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x5200, 0x0000, 0x0000, 0xffffffff },
+    { 0x5200, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    /* block 59 */
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    /* block 60 */
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    /* block 61 */
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0xfc60, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x6830, 0xffffffff },
+    { 0x1302, 0x0000, 0x6830, 0xffffffff },
+    { 0x1302, 0x0000, 0x6830, 0xffffffff },
+    { 0x1302, 0x0000, 0x6830, 0xffffffff },
+    { 0x1302, 0x0000, 0x6830, 0xffffffff },
+    { 0x1302, 0x0000, 0x6830, 0xffffffff },
+    { 0x1302, 0x0000, 0x6830, 0xffffffff },
+    { 0x1302, 0x0000, 0x6830, 0xffffffff },
+    { 0x1302, 0x0000, 0x6830, 0xffffffff },
+    { 0x1302, 0x0000, 0x6830, 0xffffffff },
+    { 0x1302, 0x0000, 0x6830, 0xffffffff },
+    { 0x1302, 0x0000, 0x6830, 0xffffffff },
+    { 0x1302, 0x0000, 0x6830, 0xffffffff },
+    { 0x1302, 0x0000, 0x6830, 0xffffffff },
+    { 0x1302, 0x0000, 0x6830, 0xffffffff },
+    { 0x1302, 0x0000, 0x6830, 0xffffffff },
+    { 0x1302, 0x0000, 0x6830, 0xffffffff },
+    { 0x1302, 0x0000, 0x6830, 0xffffffff },
+    { 0x1302, 0x0000, 0x6830, 0xffffffff },
+    { 0x1302, 0x0000, 0x6830, 0xffffffff },
+    { 0x1302, 0x0000, 0x6830, 0xffffffff },
+    { 0x1302, 0x0000, 0x6830, 0xffffffff },
+    { 0x1302, 0x0000, 0x6830, 0xffffffff },
+    { 0x1302, 0x0000, 0x6830, 0xffffffff },
+    { 0x1302, 0x0000, 0x6830, 0xffffffff },
+    { 0x1302, 0x0000, 0x6830, 0xffffffff },
+    { 0x1302, 0x0000, 0x6830, 0xffffffff },
+    { 0x1302, 0x0000, 0x6830, 0xffffffff },
+    { 0x1302, 0x0000, 0x6830, 0xffffffff },
+    { 0x1302, 0x0000, 0x6830, 0xffffffff },
+    { 0x1302, 0x0000, 0x6830, 0xffffffff },
+    { 0x1302, 0x0000, 0x6830, 0xffffffff },
+    { 0x1302, 0x0000, 0x6830, 0xffffffff },
+    { 0x1302, 0x0000, 0x6830, 0xffffffff },
+    { 0x1302, 0x0000, 0x6830, 0xffffffff },
+    { 0x1302, 0x0000, 0x6830, 0xffffffff },
+    { 0x1302, 0x0000, 0x6830, 0xffffffff },
+    { 0x1302, 0x0000, 0x6830, 0xffffffff },
+    { 0x1302, 0x0000, 0x6830, 0xffffffff },
+    { 0x1302, 0x0000, 0x6830, 0xffffffff },
+    { 0x1302, 0x0000, 0x6830, 0xffffffff },
+    { 0x1302, 0x0000, 0x6830, 0xffffffff },
+    { 0x1302, 0x0000, 0x6830, 0xffffffff },
+    { 0x1302, 0x0000, 0x6830, 0xffffffff },
+    { 0x1302, 0x0000, 0x6830, 0xffffffff },
+    { 0x1302, 0x0000, 0x6830, 0xffffffff },
+    { 0x1302, 0x0000, 0x6830, 0xffffffff },
+    { 0x1302, 0x0000, 0x6830, 0xffffffff },
+    { 0x1302, 0x0000, 0x6830, 0xffffffff },
+    { 0x1302, 0x0000, 0x6830, 0xffffffff },
+    { 0x1302, 0x0000, 0x6830, 0xffffffff },
+    { 0x1302, 0x0000, 0x6830, 0xffffffff },
+    { 0x1302, 0x0000, 0x6830, 0xffffffff },
+    { 0x1302, 0x0000, 0x6830, 0xffffffff },
+    { 0x1302, 0x0000, 0x6830, 0xffffffff },
+    { 0x1302, 0x0000, 0x6830, 0xffffffff },
+    { 0x1302, 0x0000, 0x6830, 0xffffffff },
+    { 0x1302, 0x0000, 0x6830, 0xffffffff },
+    { 0x1302, 0x0000, 0x6830, 0xffffffff },
+    { 0x1302, 0x0000, 0x6830, 0xffffffff },
+    { 0x1302, 0x0000, 0x6830, 0xffffffff },
+    { 0x1302, 0x0000, 0x6830, 0xffffffff },
+    { 0x1302, 0x0000, 0x6830, 0xffffffff },
+    { 0x1302, 0x0000, 0x6830, 0xffffffff },
+    { 0x1302, 0x0000, 0x6830, 0xffffffff },
+    { 0x1302, 0x0000, 0x6830, 0xffffffff },
+    { 0x1302, 0x0000, 0x6830, 0xffffffff },
+    { 0x1302, 0x0000, 0x6830, 0xffffffff },
+    { 0x1302, 0x0000, 0x6830, 0xffffffff },
+    { 0x1302, 0x0000, 0x6830, 0xffffffff },
+    { 0x1302, 0x0000, 0x6830, 0xffffffff },
+    { 0x1302, 0x0000, 0x6830, 0xffffffff },
+    { 0x1302, 0x0000, 0x6830, 0xffffffff },
+    { 0x1302, 0x0000, 0x6830, 0xffffffff },
+    { 0x1302, 0x0000, 0x6830, 0xffffffff },
+    { 0x1302, 0x0000, 0x6830, 0xffffffff },
+    { 0x1302, 0x0000, 0x6830, 0xffffffff },
+    { 0x1302, 0x0000, 0x6830, 0xffffffff },
+    { 0x1302, 0x0000, 0x6830, 0xffffffff },
+    { 0x1302, 0x0000, 0x6830, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1210, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x1204, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    /* block 62 */
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    /* block 63 */
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    { 0x1200, 0x0000, 0x0000, 0xffffffff },
+    /* block 64 */
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    /* block 65 */
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb400111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xfb410111 },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    /* block 66 */
+    { 0x1302, 0x0000, 0x0000, 0x0a910131 },
+    { 0x1302, 0x0000, 0x0000, 0x0a910131 },
+    { 0x1302, 0x0000, 0x0000, 0x0a910131 },
+    { 0x1302, 0x0000, 0x0000, 0x0a910131 },
+    { 0x1302, 0x0000, 0x0000, 0x0a910131 },
+    { 0x1302, 0x0000, 0x0000, 0x0ba70131 },
+    { 0x1302, 0x0000, 0x0000, 0x0ba70131 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1302, 0x0000, 0x0000, 0x0ea30121 },
+    { 0x1302, 0x0000, 0x0000, 0x0ea30121 },
+    { 0x1302, 0x0000, 0x0000, 0x0ea30121 },
+    { 0x1302, 0x0000, 0x0000, 0x0ead0121 },
+    { 0x1302, 0x0000, 0x0000, 0x0ea30121 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0x0ec00111 },
+    { 0xd200, 0x0000, 0x0000, 0x00006711 },
+    { 0x2300, 0x0000, 0x0000, 0x0ec00121 },
+    { 0x2300, 0x0000, 0x0000, 0x0ec60121 },
+    { 0x2300, 0x0000, 0x0000, 0x0eb70131 },
+    { 0x2300, 0x0000, 0x0000, 0x0eba0131 },
+    { 0x2300, 0x0000, 0x0000, 0x0ebb0121 },
+    { 0x2300, 0x0000, 0x0000, 0x0ec10121 },
+    { 0x2300, 0x0000, 0x0000, 0x0ec20121 },
+    { 0x2300, 0x0000, 0x0000, 0x0ec30121 },
+    { 0x2300, 0x0000, 0x0000, 0x0eca0121 },
+    { 0x2300, 0x0000, 0x0000, 0x0ecc0121 },
+    { 0x4200, 0x0000, 0x0000, 0x039f0131 },
+    { 0x2300, 0x0000, 0x0000, 0x0ecb0111 },
+    { 0x2300, 0x0000, 0x0000, 0x0ecb0111 },
+    { 0x2300, 0x0000, 0x0000, 0x0ecb0111 },
+    { 0x2300, 0x0000, 0x0000, 0x0ecb0111 },
+    { 0x2300, 0x0000, 0x0000, 0x0eb70111 },
+    { 0x2300, 0x0000, 0x0000, 0x0eb70111 },
+    { 0x2300, 0x0000, 0x0000, 0x0eb70111 },
+    { 0x2300, 0x0000, 0x0000, 0x0eb80111 },
+    { 0x2300, 0x0000, 0x0000, 0x0eb90111 },
+    { 0x2300, 0x0000, 0x0000, 0x0eba0111 },
+    { 0x2300, 0x0000, 0x0000, 0x0ebb0111 },
+    { 0x2300, 0x0000, 0x0000, 0x0ebc0111 },
+    { 0x2300, 0x0000, 0x0000, 0x0ebd0111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0x0ebf0111 },
+    { 0x2300, 0x0000, 0x0000, 0x0ec00111 },
+    { 0x2300, 0x0000, 0x0000, 0x0ec10131 },
+    { 0x2300, 0x0000, 0x0000, 0x0ec10111 },
+    { 0x2300, 0x0000, 0x0000, 0x0ec20111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0x0ec30111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0x0ec40111 },
+    { 0x2300, 0x0000, 0x0000, 0x0ec50111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0x0ec70121 },
+    { 0x2300, 0x0000, 0x0000, 0x0ec70111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x2300, 0x0000, 0x0000, 0x0ec80111 },
+    { 0x2300, 0x0000, 0x0000, 0x0ec90111 },
+    { 0x2300, 0x0000, 0x0000, 0x0eca0111 },
+    { 0x2300, 0x0000, 0x0000, 0x0ecb0111 },
+    { 0x2300, 0x0000, 0x0000, 0x0ecc0111 },
+    { 0x2300, 0x0000, 0x0000, 0x0ebc0111 },
+    { 0x2300, 0x0000, 0x0000, 0x0eb80111 },
+    { 0x2300, 0x0000, 0x0000, 0x0ec10111 },
+    { 0x2300, 0x0000, 0x0000, 0x0ec70111 },
+    { 0x2300, 0x0000, 0x0000, 0x0eb70121 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed10131 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed10121 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed80151 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed80141 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed80121 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed80131 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed90151 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed90141 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed90121 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed90131 },
+    { 0xc300, 0x0000, 0x0000, 0x0eda0151 },
+    { 0xc300, 0x0000, 0x0000, 0x0eda0141 },
+    { 0xc300, 0x0000, 0x0000, 0x0eda0121 },
+    { 0xc300, 0x0000, 0x0000, 0x0eda0131 },
+    { 0xc300, 0x0000, 0x0000, 0x0edf0151 },
+    { 0xc300, 0x0000, 0x0000, 0x0edf0141 },
+    { 0xc300, 0x0000, 0x0000, 0x0edf0121 },
+    { 0xc300, 0x0000, 0x0000, 0x0edf0131 },
+    { 0xc300, 0x0000, 0x0000, 0x0ee20151 },
+    { 0xc300, 0x0000, 0x0000, 0x0ee20141 },
+    { 0xc300, 0x0000, 0x0000, 0x0ee20121 },
+    { 0xc300, 0x0000, 0x0000, 0x0ee20131 },
+    { 0xc300, 0x0000, 0x0000, 0x0ede0151 },
+    { 0xc300, 0x0000, 0x0000, 0x0ede0141 },
+    { 0xc300, 0x0000, 0x0000, 0x0ede0121 },
+    { 0xc300, 0x0000, 0x0000, 0x0ede0131 },
+    { 0xc300, 0x0000, 0x0000, 0x0f1a0151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f1a0141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f1a0121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f1a0131 },
+    { 0xc300, 0x0000, 0x0000, 0x0f1c0151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f1c0141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f1c0121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f1c0131 },
+    { 0xc300, 0x0000, 0x0000, 0x0ee50151 },
+    { 0xc300, 0x0000, 0x0000, 0x0ee50141 },
+    { 0xc300, 0x0000, 0x0000, 0x0ee50121 },
+    { 0xc300, 0x0000, 0x0000, 0x0ee50131 },
+    { 0xc300, 0x0000, 0x0000, 0x0ee40151 },
+    { 0xc300, 0x0000, 0x0000, 0x0ee40141 },
+    { 0xc300, 0x0000, 0x0000, 0x0ee40121 },
+    { 0xc300, 0x0000, 0x0000, 0x0ee40131 },
+    { 0xc300, 0x0000, 0x0000, 0x0ee60151 },
+    { 0xc300, 0x0000, 0x0000, 0x0ee60141 },
+    { 0xc300, 0x0000, 0x0000, 0x0ee60121 },
+    { 0xc300, 0x0000, 0x0000, 0x0ee60131 },
+    { 0xc300, 0x0000, 0x0000, 0x0ee80151 },
+    { 0xc300, 0x0000, 0x0000, 0x0ee80141 },
+    { 0xc300, 0x0000, 0x0000, 0x0ee80121 },
+    { 0xc300, 0x0000, 0x0000, 0x0ee80131 },
+    { 0xc300, 0x0000, 0x0000, 0x0ef50131 },
+    { 0xc300, 0x0000, 0x0000, 0x0ef50121 },
+    { 0xc300, 0x0000, 0x0000, 0x0ef40131 },
+    { 0xc300, 0x0000, 0x0000, 0x0ef40121 },
+    { 0xc300, 0x0000, 0x0000, 0x0ef60131 },
+    { 0xc300, 0x0000, 0x0000, 0x0ef60121 },
+    { 0xc300, 0x0000, 0x0000, 0x0ef00131 },
+    { 0xc300, 0x0000, 0x0000, 0x0ef00121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f020131 },
+    { 0xc300, 0x0000, 0x0000, 0x0f020121 },
+    { 0xc300, 0x0000, 0x0000, 0x0efb0131 },
+    { 0xc300, 0x0000, 0x0000, 0x0efb0121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f210151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f210141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f210121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f210131 },
+    { 0xc300, 0x0000, 0x0000, 0x0f270151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f270141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f270121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f270131 },
+    { 0xc300, 0x0000, 0x0000, 0x0f2b0151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f2b0141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f2b0121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f2b0131 },
+    { 0xc300, 0x0000, 0x0000, 0x0f290151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f290141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f290121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f290131 },
+    { 0xc300, 0x0000, 0x0000, 0x0f340131 },
+    { 0xc300, 0x0000, 0x0000, 0x0f340121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f350151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f350141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f350121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f350131 },
+    { 0xc300, 0x0000, 0x0000, 0x0f3d0131 },
+    { 0xc300, 0x0000, 0x0000, 0x0f3d0121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f3b0151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f3b0141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f3b0121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f3b0131 },
+    { 0xc300, 0x0000, 0x0000, 0x0f3a0151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f3a0141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f3a0121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f3a0131 },
+    { 0xc300, 0x0000, 0x0000, 0x0f4f0131 },
+    { 0xc300, 0x0000, 0x0000, 0x0f4f0121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f4f0131 },
+    { 0xc300, 0x0000, 0x0000, 0x0f4f0121 },
+    { 0xc200, 0x0000, 0x0000, 0xffffffff },
+    { 0xc200, 0x0000, 0x0000, 0xffffffff },
+    { 0xc200, 0x0000, 0x0000, 0xffffffff },
+    { 0xc200, 0x0000, 0x0000, 0xffffffff },
+    { 0xc200, 0x0000, 0x0000, 0xffffffff },
+    { 0xc200, 0x0000, 0x0000, 0xffffffff },
+    { 0xc200, 0x0000, 0x0000, 0xffffffff },
+    { 0xc200, 0x0000, 0x0000, 0xffffffff },
+    { 0xc200, 0x0000, 0x0000, 0xffffffff },
+    { 0xc200, 0x0000, 0x0000, 0xffffffff },
+    { 0xc200, 0x0000, 0x0000, 0xffffffff },
+    { 0xc200, 0x0000, 0x0000, 0xffffffff },
+    { 0xc200, 0x0000, 0x0000, 0xffffffff },
+    { 0xc200, 0x0000, 0x0000, 0xffffffff },
+    { 0xc200, 0x0000, 0x0000, 0xffffffff },
+    { 0xc200, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0x0f250151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f250141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f250121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f250131 },
+    { 0xc300, 0x0000, 0x0000, 0x0f420141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f420131 },
+    { 0xc300, 0x0000, 0x0000, 0x0f410131 },
+    { 0xc300, 0x0000, 0x0000, 0x0f410121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f430131 },
+    { 0xc300, 0x0000, 0x0000, 0x0f430121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f420141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f460131 },
+    { 0xc300, 0x0000, 0x0000, 0x0f460121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f400131 },
+    { 0xc300, 0x0000, 0x0000, 0x0f400121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f440131 },
+    { 0xc300, 0x0000, 0x0000, 0x0f440121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f4d0151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f4d0141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f4d0121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f4d0131 },
+    { 0xc300, 0x0000, 0x0000, 0x0f480121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f480131 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed50151 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed50141 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed50151 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed50141 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed50151 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed50141 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed50151 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed50141 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed50151 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed50141 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed50151 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed50141 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed50151 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed50141 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed50121 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed50151 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed50141 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed50121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f4a0151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f4a0141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f4a0121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f4a0131 },
+    /* block 67 */
+    { 0xc300, 0x0000, 0x0000, 0x0ed50151 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed50151 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed50151 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed50151 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed50151 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed70151 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed70151 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed70151 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed70151 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed70151 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed70151 },
+    { 0xc300, 0x0000, 0x0000, 0x0edc0151 },
+    { 0xc300, 0x0000, 0x0000, 0x0edc0151 },
+    { 0xc300, 0x0000, 0x0000, 0x0edc0151 },
+    { 0xc300, 0x0000, 0x0000, 0x0edc0151 },
+    { 0xc300, 0x0000, 0x0000, 0x0edc0151 },
+    { 0xc300, 0x0000, 0x0000, 0x0edc0151 },
+    { 0xc300, 0x0000, 0x0000, 0x0edd0151 },
+    { 0xc300, 0x0000, 0x0000, 0x0edd0151 },
+    { 0xc300, 0x0000, 0x0000, 0x0edd0151 },
+    { 0xc300, 0x0000, 0x0000, 0x0edd0151 },
+    { 0xc300, 0x0000, 0x0000, 0x0ee30151 },
+    { 0xc300, 0x0000, 0x0000, 0x0ee30151 },
+    { 0xc300, 0x0000, 0x0000, 0x0ee90151 },
+    { 0xc300, 0x0000, 0x0000, 0x0ee90151 },
+    { 0xc300, 0x0000, 0x0000, 0x0eea0151 },
+    { 0xc300, 0x0000, 0x0000, 0x0eea0151 },
+    { 0xc300, 0x0000, 0x0000, 0x0eea0151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f040151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f040151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f040151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f040151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f0a0151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f0a0151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f0b0151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f0b0151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f0b0151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f0b0151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f0f0151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f0f0151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f100151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f120151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f120151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f130151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f130151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f160151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f160151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f160151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f160151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f160151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f160151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f1d0151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f1d0151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f1d0151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f1d0151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f200151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f200151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f200151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f200151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f200151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f200151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f200151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f200151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f2d0151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f2d0151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f2d0151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f2d0151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f2d0151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f2d0151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f320161 },
+    { 0xc300, 0x0000, 0x0000, 0x0f320161 },
+    { 0xc300, 0x0000, 0x0000, 0x0f320161 },
+    { 0xc300, 0x0000, 0x0000, 0x0f320161 },
+    { 0xc300, 0x0000, 0x0000, 0x0f320161 },
+    { 0xc300, 0x0000, 0x0000, 0x0f320161 },
+    { 0xc300, 0x0000, 0x0000, 0x0f330151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f330151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f330151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f330151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f330151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f330151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f390151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f390151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f390151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f390151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f490161 },
+    { 0xc300, 0x0000, 0x0000, 0x0f490161 },
+    { 0xc300, 0x0000, 0x0000, 0x0f490161 },
+    { 0xc300, 0x0000, 0x0000, 0x0f490161 },
+    { 0xc300, 0x0000, 0x0000, 0x0f490161 },
+    { 0xc300, 0x0000, 0x0000, 0x0f490161 },
+    { 0xc300, 0x0000, 0x0000, 0x0eef0131 },
+    { 0xc300, 0x0000, 0x0000, 0x0ef90131 },
+    { 0xc300, 0x0000, 0x0000, 0x0f480151 },
+    { 0xc300, 0x0000, 0x0000, 0x00006e31 },
+    { 0xc300, 0x0000, 0x0000, 0x00006e31 },
+    { 0xc300, 0x0000, 0x0000, 0x00006e31 },
+    { 0xc300, 0x0000, 0x0000, 0x00006e31 },
+    { 0xc300, 0x0000, 0x0000, 0x00006e31 },
+    { 0xc300, 0x0000, 0x0000, 0x00006e31 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed50141 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed50141 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed50141 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed50141 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed50141 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed50141 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed70141 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed70141 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed70141 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed70141 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed70141 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed70141 },
+    { 0xc300, 0x0000, 0x0000, 0x0edc0141 },
+    { 0xc300, 0x0000, 0x0000, 0x0edc0141 },
+    { 0xc300, 0x0000, 0x0000, 0x0edc0141 },
+    { 0xc300, 0x0000, 0x0000, 0x0edc0141 },
+    { 0xc300, 0x0000, 0x0000, 0x0edc0141 },
+    { 0xc300, 0x0000, 0x0000, 0x0edc0141 },
+    { 0xc300, 0x0000, 0x0000, 0x0edd0141 },
+    { 0xc300, 0x0000, 0x0000, 0x0edd0141 },
+    { 0xc300, 0x0000, 0x0000, 0x0edd0141 },
+    { 0xc300, 0x0000, 0x0000, 0x0edd0141 },
+    { 0xc300, 0x0000, 0x0000, 0x0edd0141 },
+    { 0xc300, 0x0000, 0x0000, 0x0edd0141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f160141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f160141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f1d0141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f1d0141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f200141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f200141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f200141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f200141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f200141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f2d0141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f2d0141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f2d0141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f320151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f320151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f330141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f330141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f330141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f330141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f330141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f330141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f480141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f490151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f490151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f490151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f490151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f490151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f490151 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed50121 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed50121 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed50121 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed50121 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed50121 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed70121 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed70121 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed70121 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed70121 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed70121 },
+    { 0xc300, 0x0000, 0x0000, 0x0edc0121 },
+    { 0xc300, 0x0000, 0x0000, 0x0edc0121 },
+    { 0xc300, 0x0000, 0x0000, 0x0edc0121 },
+    { 0xc300, 0x0000, 0x0000, 0x0edc0121 },
+    { 0xc300, 0x0000, 0x0000, 0x0edc0121 },
+    { 0xc300, 0x0000, 0x0000, 0x0edd0121 },
+    { 0xc300, 0x0000, 0x0000, 0x0ee30121 },
+    { 0xc300, 0x0000, 0x0000, 0x0ee30121 },
+    { 0xc300, 0x0000, 0x0000, 0x0ee90121 },
+    { 0xc300, 0x0000, 0x0000, 0x0ee90121 },
+    { 0xc300, 0x0000, 0x0000, 0x0eea0121 },
+    { 0xc300, 0x0000, 0x0000, 0x0eea0121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f040121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f040121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f040121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f040121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f0a0121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f0a0121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f0a0121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f0b0121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f0b0121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f0b0121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f0b0121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f0f0121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f100121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f120121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f120121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f130121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f130121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f160121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f160121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f160121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f160121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f1d0121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f1d0121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f200121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f200121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f200121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f200121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f200121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f2d0121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f2d0121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f2d0121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f2d0121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f2d0121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f320131 },
+    { 0xc300, 0x0000, 0x0000, 0x0f320131 },
+    { 0xc300, 0x0000, 0x0000, 0x0f320131 },
+    { 0xc300, 0x0000, 0x0000, 0x0f320131 },
+    { 0xc300, 0x0000, 0x0000, 0x0f330121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f330121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f330121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f330121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f330121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f390121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f390121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f390121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f490131 },
+    { 0xc300, 0x0000, 0x0000, 0x0f490131 },
+    { 0xc300, 0x0000, 0x0000, 0x0f490131 },
+    { 0xc300, 0x0000, 0x0000, 0x0f490131 },
+    { 0xc300, 0x0000, 0x0000, 0x0f490131 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed50131 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed50131 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed70131 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed70131 },
+    { 0xc300, 0x0000, 0x0000, 0x0edc0131 },
+    { 0xc300, 0x0000, 0x0000, 0x0edc0131 },
+    { 0xc300, 0x0000, 0x0000, 0x0edd0131 },
+    { 0xc300, 0x0000, 0x0000, 0x0edd0131 },
+    { 0xc300, 0x0000, 0x0000, 0x0f040131 },
+    { 0xc300, 0x0000, 0x0000, 0x0f040131 },
+    { 0xc300, 0x0000, 0x0000, 0x0f050131 },
+    { 0xc300, 0x0000, 0x0000, 0x0f050131 },
+    { 0xc300, 0x0000, 0x0000, 0x0f200131 },
+    { 0xc300, 0x0000, 0x0000, 0x0f200131 },
+    { 0xc300, 0x0000, 0x0000, 0x0f2d0131 },
+    { 0xc300, 0x0000, 0x0000, 0x0f330131 },
+    { 0xc300, 0x0000, 0x0000, 0x0f330131 },
+    { 0xc300, 0x0000, 0x0000, 0x0f490141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f490141 },
+    { 0xc300, 0x0000, 0x0000, 0x00006e21 },
+    { 0xc300, 0x0000, 0x0000, 0x00006e21 },
+    { 0xc300, 0x0000, 0x0000, 0x00006e21 },
+    { 0xc300, 0x0000, 0x0000, 0x0f0f0151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f0f0151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f120151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f120151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f130151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f130151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f040151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f040151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f050151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f050151 },
+    { 0xc300, 0x0000, 0x0000, 0x0ee90151 },
+    /* block 68 */
+    { 0xc300, 0x0000, 0x0000, 0x0ee90151 },
+    { 0xc300, 0x0000, 0x0000, 0x0ee30151 },
+    { 0xc300, 0x0000, 0x0000, 0x0ee30151 },
+    { 0xc300, 0x0000, 0x0000, 0x0eea0151 },
+    { 0xc300, 0x0000, 0x0000, 0x0eea0151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f0a0151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f0a0151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f0b0151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f0b0151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f050151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f050151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f050151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f050151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f050151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f040151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f0a0151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f0b0151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f0f0141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f0f0141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f120141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f120141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f130141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f130141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f040141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f040141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f050141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f050141 },
+    { 0xc300, 0x0000, 0x0000, 0x0ee90141 },
+    { 0xc300, 0x0000, 0x0000, 0x0ee90141 },
+    { 0xc300, 0x0000, 0x0000, 0x0ee30141 },
+    { 0xc300, 0x0000, 0x0000, 0x0ee30141 },
+    { 0xc300, 0x0000, 0x0000, 0x0eea0141 },
+    { 0xc300, 0x0000, 0x0000, 0x0eea0141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f0a0141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f0a0141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f0b0141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f0b0141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f050141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f050141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f050141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f050141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f050141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f040141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f0a0141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f0b0141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f050121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f050121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f050121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f050121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f040121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f050121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f0f0121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f040131 },
+    { 0xc300, 0x0000, 0x0000, 0x0f040131 },
+    { 0xc300, 0x0000, 0x0000, 0x0f040131 },
+    { 0xc300, 0x0000, 0x0000, 0x0f050131 },
+    { 0xc300, 0x0000, 0x0000, 0x0f050131 },
+    { 0xc300, 0x0000, 0x0000, 0x0f050131 },
+    { 0xc300, 0x0000, 0x0000, 0x0f0f0131 },
+    { 0xc300, 0x0000, 0x0000, 0x0f100131 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed60131 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed60141 },
+    { 0xb210, 0x0000, 0x0000, 0x029a0111 },
+    { 0xb210, 0x0000, 0x0000, 0x029b0111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0x0edc0121 },
+    { 0xc300, 0x0000, 0x0000, 0x0edc0141 },
+    { 0xc300, 0x0000, 0x0000, 0x0edc0121 },
+    { 0xc300, 0x0000, 0x0000, 0x0edc0121 },
+    { 0xc300, 0x0000, 0x0000, 0x0edc0121 },
+    { 0xc300, 0x0000, 0x0000, 0x0edc0121 },
+    { 0xc300, 0x0000, 0x0000, 0x0edc0121 },
+    { 0xc300, 0x0000, 0x0000, 0x0edc0121 },
+    { 0xc300, 0x0000, 0x0000, 0x0ee30141 },
+    { 0xc300, 0x0000, 0x0000, 0x0ee30121 },
+    { 0xc300, 0x0000, 0x0000, 0x0ee90141 },
+    { 0xc300, 0x0000, 0x0000, 0x0ee90141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f040121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f040121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f040141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f040141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f040121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f040121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f040141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f040121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f0a0141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f0a0121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f0a0141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f050141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f050121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f050141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f050141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f050121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f050141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f050121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f0b0141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f0b0141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f0b0121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f0f0141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f0f0121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f0f0121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f0f0141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f120141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f120141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f120121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f120141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f130141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f130141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f130141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f160141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f160121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f1d0141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f1d0141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f2d0141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f2d0141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f2d0141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f2d0121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f2d0141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f2d0141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f2d0121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f2d0141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f2d0121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f320131 },
+    { 0xc300, 0x0000, 0x0000, 0x0f320131 },
+    { 0xc300, 0x0000, 0x0000, 0x0f320151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f320131 },
+    { 0xc300, 0x0000, 0x0000, 0x0f320131 },
+    { 0xc300, 0x0000, 0x0000, 0x0f320131 },
+    { 0xc300, 0x0000, 0x0000, 0x0f320131 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0x0f320131 },
+    { 0xc300, 0x0000, 0x0000, 0x0f390121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f390121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f330121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f330141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f330141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f330121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f330141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f330141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f330141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f490151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f490131 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed70141 },
+    { 0xc300, 0x0000, 0x0000, 0x0edc0141 },
+    { 0xc300, 0x0000, 0x0000, 0x0edc0141 },
+    { 0xc300, 0x0000, 0x0000, 0x0edc0141 },
+    { 0xc300, 0x0000, 0x0000, 0x0edc0141 },
+    { 0xc300, 0x0000, 0x0000, 0x0edc0141 },
+    { 0xc300, 0x0000, 0x0000, 0x0edc0141 },
+    { 0xc300, 0x0000, 0x0000, 0x0ee30141 },
+    { 0xc300, 0x0000, 0x0000, 0x0ee30141 },
+    { 0xc300, 0x0000, 0x0000, 0x0ee30141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f040141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f0a0141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f050141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f0b0141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f2d0141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f2d0141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f490151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f490151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f490151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f320151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f1d0141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f330141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f1d0121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f2d0121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f120141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f200141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f330121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f320151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f2d0121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f200141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f2d0141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f330141 },
+    { 0xc300, 0x0000, 0x0000, 0x0ee30141 },
+    { 0xc300, 0x0000, 0x0000, 0x0ee90141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f320151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f160141 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed70141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f200121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f120121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f0a0121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f040141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f330141 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0x0f0a0151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f1d0151 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed60141 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed60141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f320161 },
+    { 0xc300, 0x0000, 0x0000, 0x0f0a0151 },
+    { 0xc300, 0x0000, 0x0000, 0x0ef90131 },
+    { 0xc300, 0x0000, 0x0000, 0x0f120151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f3e0141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f0a0151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f0a0151 },
+    { 0xc300, 0x0000, 0x0000, 0x0ee30151 },
+    { 0xc200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    /* block 69 */
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0x00005011 },
+    { 0xd200, 0x0000, 0x0000, 0x00005111 },
+    { 0xd200, 0x0000, 0x0000, 0x00005211 },
+    { 0xd200, 0x0000, 0x0000, 0x00005311 },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xd200, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0x02550151 },
+    { 0xb210, 0x0000, 0x0000, 0x02280131 },
+    { 0xb210, 0x0000, 0x0000, 0x02270121 },
+    { 0xb210, 0x0000, 0x0000, 0x021b0141 },
+    { 0xb210, 0x0000, 0x0000, 0x021b0141 },
+    { 0xb210, 0x0000, 0x0000, 0x027a0171 },
+    { 0xb210, 0x0000, 0x0000, 0x027b0161 },
+    { 0xb210, 0x0000, 0x0000, 0x027e0141 },
+    { 0xb210, 0x0000, 0x0000, 0x027f0141 },
+    { 0xb210, 0x0000, 0x0000, 0x02920131 },
+    { 0xb210, 0x0000, 0x0000, 0x02930131 },
+    { 0xb210, 0x0000, 0x0000, 0x02900121 },
+    { 0xb210, 0x0000, 0x0000, 0x02910121 },
+    { 0xb210, 0x0000, 0x0000, 0x028a0121 },
+    { 0xb210, 0x0000, 0x0000, 0x028b0121 },
+    { 0xb210, 0x0000, 0x0000, 0x02880121 },
+    { 0xb210, 0x0000, 0x0000, 0x02890121 },
+    { 0xb210, 0x0000, 0x0000, 0x028c0131 },
+    { 0xb210, 0x0000, 0x0000, 0x028d0131 },
+    { 0xb210, 0x0000, 0x0000, 0x028e0121 },
+    { 0xb210, 0x0000, 0x0000, 0x028f0121 },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0x02110121 },
+    { 0xb210, 0x0000, 0x0000, 0x02110121 },
+    { 0xb210, 0x0000, 0x0000, 0x02110121 },
+    { 0xb210, 0x0000, 0x0000, 0x02110121 },
+    { 0xb210, 0x0000, 0x0000, 0x021b0131 },
+    { 0xb210, 0x0000, 0x0000, 0x021b0131 },
+    { 0xb210, 0x0000, 0x0000, 0x021b0131 },
+    { 0x7210, 0x0000, 0x0000, 0x022d0131 },
+    { 0xb210, 0x0000, 0x0000, 0x02340121 },
+    { 0x7210, 0x0000, 0x0000, 0x02550141 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0x02350131 },
+    { 0x7210, 0x0000, 0x0000, 0x02370131 },
+    { 0xb210, 0x0000, 0x0000, 0x024e0141 },
+    { 0xb210, 0x0000, 0x0000, 0x024b0141 },
+    { 0xb210, 0x0000, 0x0000, 0x02280121 },
+    { 0xb210, 0x0000, 0x0000, 0x027a0141 },
+    { 0xb210, 0x0000, 0x0000, 0x027b0131 },
+    { 0xb210, 0x0000, 0x0000, 0x027e0131 },
+    { 0xb210, 0x0000, 0x0000, 0x027f0131 },
+    { 0xb210, 0x0000, 0x0000, 0x02920121 },
+    { 0xb210, 0x0000, 0x0000, 0x02930121 },
+    { 0x5210, 0x0000, 0x0000, 0x02a90131 },
+    { 0xb210, 0x0000, 0x0000, 0x02a70131 },
+    { 0xb210, 0x0000, 0x0000, 0x02a20131 },
+    { 0x4200, 0x0000, 0x0000, 0x039f0141 },
+    { 0x4210, 0x0000, 0x0000, 0x02210131 },
+    { 0xb200, 0x0000, 0x0000, 0x03a30131 },
+    { 0xb200, 0x0000, 0x0000, 0x03a50131 },
+    { 0xb200, 0x0000, 0x0000, 0x03a40131 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0x02a60131 },
+    { 0x5200, 0x0000, 0x0000, 0x09e00131 },
+    { 0x5210, 0x0000, 0x0000, 0x02aa0131 },
+    { 0xb210, 0x0000, 0x0000, 0x02a10131 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0x00006831 },
+    { 0xc300, 0x0000, 0x0000, 0x00006821 },
+    { 0xc300, 0x0000, 0x0000, 0x00006921 },
+    { 0xc300, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0x00006a21 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0xc300, 0x0000, 0x0000, 0x00006b31 },
+    { 0xc300, 0x0000, 0x0000, 0x00006b21 },
+    { 0xc300, 0x0000, 0x0000, 0x00006c31 },
+    { 0xc300, 0x0000, 0x0000, 0x00006c21 },
+    { 0xc300, 0x0000, 0x0000, 0x00006d31 },
+    { 0xc300, 0x0000, 0x0000, 0x00006d21 },
+    { 0xc300, 0x0000, 0x0000, 0x00006e31 },
+    { 0xc300, 0x0000, 0x0000, 0x00006e21 },
+    { 0xc300, 0x0000, 0x0000, 0x00006f31 },
+    { 0xc300, 0x0000, 0x0000, 0x00006f21 },
+    { 0xc300, 0x0000, 0x0000, 0x0ecd0131 },
+    { 0xc300, 0x0000, 0x0000, 0x0ece0131 },
+    { 0xc300, 0x0000, 0x0000, 0x0ece0121 },
+    { 0xc300, 0x0000, 0x0000, 0x0ecf0131 },
+    { 0xc300, 0x0000, 0x0000, 0x0ecf0121 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed20131 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed20121 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed30131 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed30121 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed50151 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed50141 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed50121 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed50131 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed60141 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed60131 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed70151 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed70141 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed70121 },
+    { 0xc300, 0x0000, 0x0000, 0x0ed70131 },
+    { 0xc300, 0x0000, 0x0000, 0x0edb0131 },
+    { 0xc300, 0x0000, 0x0000, 0x0edb0121 },
+    { 0xc300, 0x0000, 0x0000, 0x0edc0151 },
+    { 0xc300, 0x0000, 0x0000, 0x0edc0141 },
+    { 0xc300, 0x0000, 0x0000, 0x0edc0121 },
+    { 0xc300, 0x0000, 0x0000, 0x0edc0131 },
+    { 0xc300, 0x0000, 0x0000, 0x0edd0151 },
+    { 0xc300, 0x0000, 0x0000, 0x0edd0141 },
+    { 0xc300, 0x0000, 0x0000, 0x0edd0121 },
+    { 0xc300, 0x0000, 0x0000, 0x0edd0131 },
+    { 0xc300, 0x0000, 0x0000, 0x0ee30151 },
+    { 0xc300, 0x0000, 0x0000, 0x0ee30141 },
+    { 0xc300, 0x0000, 0x0000, 0x0ee30121 },
+    { 0xc300, 0x0000, 0x0000, 0x0ee30131 },
+    { 0xc300, 0x0000, 0x0000, 0x0ee90151 },
+    { 0xc300, 0x0000, 0x0000, 0x0ee90141 },
+    { 0xc300, 0x0000, 0x0000, 0x0ee90121 },
+    { 0xc300, 0x0000, 0x0000, 0x0ee90131 },
+    { 0xc300, 0x0000, 0x0000, 0x0eea0151 },
+    { 0xc300, 0x0000, 0x0000, 0x0eea0141 },
+    { 0xc300, 0x0000, 0x0000, 0x0eea0121 },
+    { 0xc300, 0x0000, 0x0000, 0x0eea0131 },
+    { 0xc300, 0x0000, 0x0000, 0x0eee0131 },
+    { 0xc300, 0x0000, 0x0000, 0x0eee0121 },
+    { 0xc300, 0x0000, 0x0000, 0x0eef0131 },
+    { 0xc300, 0x0000, 0x0000, 0x0eef0121 },
+    { 0xc300, 0x0000, 0x0000, 0x0ef90131 },
+    { 0xc300, 0x0000, 0x0000, 0x0ef90121 },
+    { 0xc300, 0x0000, 0x0000, 0x0efa0131 },
+    { 0xc300, 0x0000, 0x0000, 0x0efa0121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f040151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f040141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f040121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f040131 },
+    { 0xc300, 0x0000, 0x0000, 0x0f050151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f050141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f050121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f050131 },
+    { 0xc300, 0x0000, 0x0000, 0x0f0a0151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f0a0141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f0a0121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f0a0131 },
+    { 0xc300, 0x0000, 0x0000, 0x0f0b0151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f0b0141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f0b0121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f0b0131 },
+    { 0xc300, 0x0000, 0x0000, 0x0f0f0151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f0f0141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f0f0121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f0f0131 },
+    { 0xc300, 0x0000, 0x0000, 0x0f100151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f100141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f100121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f100131 },
+    { 0xc300, 0x0000, 0x0000, 0x0f120151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f120141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f120121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f120131 },
+    { 0xc300, 0x0000, 0x0000, 0x0f130151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f130141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f130121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f130131 },
+    { 0xc300, 0x0000, 0x0000, 0x0f160151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f160141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f160121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f160131 },
+    { 0xc300, 0x0000, 0x0000, 0x0f1d0151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f1d0141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f1d0121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f1d0131 },
+    { 0xc300, 0x0000, 0x0000, 0x0f200151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f200141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f200121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f200131 },
+    { 0xc300, 0x0000, 0x0000, 0x0f2d0151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f2d0141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f2d0121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f2d0131 },
+    { 0xc300, 0x0000, 0x0000, 0x0f320161 },
+    { 0xc300, 0x0000, 0x0000, 0x0f320151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f320131 },
+    { 0xc300, 0x0000, 0x0000, 0x0f320141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f330151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f330141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f330121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f330131 },
+    { 0xc300, 0x0000, 0x0000, 0x0f390151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f390141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f390121 },
+    { 0xc300, 0x0000, 0x0000, 0x0f390131 },
+    { 0xc300, 0x0000, 0x0000, 0x0f3e0141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f3e0131 },
+    { 0xc300, 0x0000, 0x0000, 0x0f480151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f480141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f490161 },
+    { 0xc300, 0x0000, 0x0000, 0x0f490151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f490131 },
+    { 0xc300, 0x0000, 0x0000, 0x0f490141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f2d0151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f2d0141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f2d0151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f2d0141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f2d0151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f2d0141 },
+    { 0xc300, 0x0000, 0x0000, 0x0f2d0151 },
+    { 0xc300, 0x0000, 0x0000, 0x0f2d0141 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0xe260, 0x0000, 0x0000, 0x00000000 },
+    /* block 70 */
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0x024b0121 },
+    { 0xb210, 0x0000, 0x0000, 0x02700121 },
+    { 0x5210, 0x0000, 0x0000, 0x02a90121 },
+    { 0x5200, 0x0000, 0x0000, 0x09e00121 },
+    { 0x5210, 0x0000, 0x0000, 0x02aa0121 },
+    { 0xb210, 0x0000, 0x0000, 0x02a70121 },
+    { 0xb210, 0x0000, 0x0000, 0x02690121 },
+    { 0xb210, 0x0000, 0x0000, 0x027a0121 },
+    { 0xb210, 0x0000, 0x0000, 0x027b0121 },
+    { 0xb210, 0x0000, 0x0000, 0x02a20121 },
+    { 0x4200, 0x0000, 0x0000, 0x039f0121 },
+    { 0x7210, 0x0000, 0x0000, 0x022d0121 },
+    { 0x4210, 0x0000, 0x0000, 0x02210121 },
+    { 0x7210, 0x0000, 0x0000, 0x02550121 },
+    { 0x7210, 0x0000, 0x0000, 0x02a40121 },
+    { 0x3284, 0x0000, 0x0000, 0x0a0b0121 },
+    { 0x3284, 0x0000, 0x0000, 0x0a0c0121 },
+    { 0x3284, 0x0000, 0x0000, 0x0a0d0121 },
+    { 0x3284, 0x0000, 0x0000, 0x0a0e0121 },
+    { 0x3284, 0x0000, 0x0000, 0x0a0f0121 },
+    { 0x3284, 0x0000, 0x0000, 0x0a100121 },
+    { 0x3284, 0x0000, 0x0000, 0x0a110121 },
+    { 0x3284, 0x0000, 0x0000, 0x0a120121 },
+    { 0x3284, 0x0000, 0x0000, 0x0a130121 },
+    { 0x3284, 0x0000, 0x0000, 0x0a140121 },
+    { 0x7210, 0x0000, 0x0000, 0x02370121 },
+    { 0xb210, 0x0000, 0x0000, 0x02350121 },
+    { 0xb200, 0x0000, 0x0000, 0x03a30121 },
+    { 0xb200, 0x0000, 0x0000, 0x03a40121 },
+    { 0xb200, 0x0000, 0x0000, 0x03a50121 },
+    { 0xb210, 0x0000, 0x0000, 0x024e0121 },
+    { 0xb210, 0x0000, 0x0000, 0x02a10121 },
+    { 0x1381, 0x0020, 0x0000, 0x0a150161 },
+    { 0x1381, 0x0020, 0x0000, 0x0a290151 },
+    { 0x1381, 0x0020, 0x0000, 0x0a3d0161 },
+    { 0x1381, 0x0020, 0x0000, 0x0a490161 },
+    { 0x1381, 0x0020, 0x0000, 0x0a650161 },
+    { 0x1381, 0x0020, 0x0000, 0x0a910161 },
+    { 0x1301, 0x0020, 0x0000, 0x0a990161 },
+    { 0x1301, 0x0020, 0x0000, 0x0ab90161 },
+    { 0x1301, 0x0020, 0x0000, 0x0ad30171 },
+    { 0x1301, 0x0020, 0x0000, 0x0ae70151 },
+    { 0x1301, 0x0020, 0x0000, 0x0af70151 },
+    { 0x1301, 0x0020, 0x0000, 0x0b030171 },
+    { 0x1301, 0x0020, 0x0000, 0x0b2b0161 },
+    { 0x1301, 0x0020, 0x0000, 0x0b330161 },
+    { 0x1301, 0x0020, 0x0000, 0x0b4b0171 },
+    { 0x1301, 0x0020, 0x0000, 0x0b670151 },
+    { 0x1301, 0x0020, 0x0000, 0x0b730151 },
+    { 0x1301, 0x0020, 0x0000, 0x0b7f0151 },
+    { 0x1301, 0x0020, 0x0000, 0x0ba70161 },
+    { 0x1301, 0x0020, 0x0000, 0x0bbf0161 },
+    { 0x1301, 0x0020, 0x0000, 0x0bd70151 },
+    { 0x1301, 0x0020, 0x0000, 0x0bef0161 },
+    { 0x1301, 0x0020, 0x0000, 0x0bfb0151 },
+    { 0x1301, 0x0020, 0x0000, 0x0c030161 },
+    { 0x1301, 0x0020, 0x0000, 0x0c070151 },
+    { 0x1301, 0x0020, 0x0000, 0x0c130151 },
+    { 0xb210, 0x0000, 0x0000, 0x027c0121 },
+    { 0xb210, 0x0000, 0x0000, 0x02a60121 },
+    { 0xb210, 0x0000, 0x0000, 0x027d0121 },
+    { 0xb200, 0x0000, 0x0000, 0x020f0121 },
+    { 0xb210, 0x0000, 0x0000, 0x021b0121 },
+    { 0xb200, 0x0000, 0x0000, 0x020c0121 },
+    { 0x1382, 0x0000, 0xffe0, 0x0a150121 },
+    { 0x1382, 0x0000, 0xffe0, 0x0a290121 },
+    { 0x1382, 0x0000, 0xffe0, 0x0a3d0121 },
+    { 0x1382, 0x0000, 0xffe0, 0x0a490121 },
+    { 0x1382, 0x0000, 0xffe0, 0x0a650121 },
+    { 0x1382, 0x0000, 0xffe0, 0x0a910121 },
+    { 0x1302, 0x0000, 0xffe0, 0x0a990121 },
+    { 0x1302, 0x0000, 0xffe0, 0x0ab90121 },
+    { 0x1302, 0x0000, 0xffe0, 0x0ad30121 },
+    { 0x1302, 0x0000, 0xffe0, 0x0ae70121 },
+    { 0x1302, 0x0000, 0xffe0, 0x0af70121 },
+    { 0x1302, 0x0000, 0xffe0, 0x0b030121 },
+    { 0x1302, 0x0000, 0xffe0, 0x0b2b0121 },
+    { 0x1302, 0x0000, 0xffe0, 0x0b330121 },
+    { 0x1302, 0x0000, 0xffe0, 0x0b4b0121 },
+    { 0x1302, 0x0000, 0xffe0, 0x0b670121 },
+    { 0x1302, 0x0000, 0xffe0, 0x0b730121 },
+    { 0x1302, 0x0000, 0xffe0, 0x0b7f0121 },
+    { 0x1302, 0x0000, 0xffe0, 0x0ba70121 },
+    { 0x1302, 0x0000, 0xffe0, 0x0bbf0121 },
+    { 0x1302, 0x0000, 0xffe0, 0x0bd70121 },
+    { 0x1302, 0x0000, 0xffe0, 0x0bef0121 },
+    { 0x1302, 0x0000, 0xffe0, 0x0bfb0121 },
+    { 0x1302, 0x0000, 0xffe0, 0x0c030121 },
+    { 0x1302, 0x0000, 0xffe0, 0x0c070121 },
+    { 0x1302, 0x0000, 0xffe0, 0x0c130121 },
+    { 0xb210, 0x0000, 0x0000, 0x027e0121 },
+    { 0xb200, 0x0000, 0x0000, 0x03a70121 },
+    { 0xb210, 0x0000, 0x0000, 0x027f0121 },
+    { 0xb200, 0x0000, 0x0000, 0x03aa0121 },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0xffffffff },
+    { 0xb210, 0x0000, 0x0000, 0x025e0121 },
+    { 0xb210, 0x0000, 0x0000, 0x028c0121 },
+    { 0xb210, 0x0000, 0x0000, 0x028d0121 },
+    { 0xb210, 0x0000, 0x0000, 0x02340131 },
+    { 0xb210, 0x0000, 0x0000, 0x022c0121 },
+    { 0x1300, 0x0000, 0x0000, 0x194f0131 },
+    { 0x1300, 0x0000, 0x0000, 0x19210141 },
+    { 0x1300, 0x0000, 0x0000, 0x19220141 },
+    { 0x1300, 0x0000, 0x0000, 0x19230141 },
+    { 0x1300, 0x0000, 0x0000, 0x19240141 },
+    { 0x1300, 0x0000, 0x0000, 0x19250141 },
+    { 0x1300, 0x0000, 0x0000, 0x19440141 },
+    { 0x1300, 0x0000, 0x0000, 0x19450141 },
+    { 0x1300, 0x0000, 0x0000, 0x19460141 },
+    { 0x1300, 0x0000, 0x0000, 0x19320141 },
+    { 0x1300, 0x0000, 0x0000, 0x09dc0121 },
+    { 0x1300, 0x0000, 0x0000, 0x19210161 },
+    { 0x1300, 0x0000, 0x0000, 0x19220161 },
+    { 0x1300, 0x0000, 0x0000, 0x19230161 },
+    { 0x1300, 0x0000, 0x0000, 0x19240161 },
+    { 0x1300, 0x0000, 0x0000, 0x19250161 },
+    { 0x1300, 0x0000, 0x0000, 0x19260141 },
+    { 0x1300, 0x0000, 0x0000, 0x19270131 },
+    { 0x1300, 0x0000, 0x0000, 0x19280131 },
+    { 0x1300, 0x0000, 0x0000, 0x19290141 },
+    { 0x1300, 0x0000, 0x0000, 0x192a0131 },
+    { 0x1300, 0x0000, 0x0000, 0x192b0131 },
+    { 0x1300, 0x0000, 0x0000, 0x192c0141 },
+    { 0x1300, 0x0000, 0x0000, 0x192d0131 },
+    { 0x1300, 0x0000, 0x0000, 0x192e0131 },
+    { 0x1300, 0x0000, 0x0000, 0x192f0131 },
+    { 0x1300, 0x0000, 0x0000, 0x19300131 },
+    { 0x1300, 0x0000, 0x0000, 0x19310131 },
+    { 0x1300, 0x0000, 0x0000, 0x19320161 },
+    { 0x1300, 0x0000, 0x0000, 0x19330131 },
+    { 0x1300, 0x0000, 0x0000, 0x19340131 },
+    { 0x1300, 0x0000, 0x0000, 0x19350131 },
+    { 0x1300, 0x0000, 0x0000, 0x19360131 },
+    { 0x1300, 0x0000, 0x0000, 0x19370131 },
+    { 0x1300, 0x0000, 0x0000, 0x19380131 },
+    { 0x1300, 0x0000, 0x0000, 0x19390131 },
+    { 0x1300, 0x0000, 0x0000, 0x193a0131 },
+    { 0x1300, 0x0000, 0x0000, 0x193b0131 },
+    { 0x1300, 0x0000, 0x0000, 0x193c0131 },
+    { 0x1300, 0x0000, 0x0000, 0x193d0131 },
+    { 0x1300, 0x0000, 0x0000, 0x193e0131 },
+    { 0x1300, 0x0000, 0x0000, 0x193f0131 },
+    { 0x1300, 0x0000, 0x0000, 0x19400131 },
+    { 0x1300, 0x0000, 0x0000, 0x19410131 },
+    { 0x1300, 0x0000, 0x0000, 0x19420131 },
+    { 0x1300, 0x0000, 0x0000, 0x19430131 },
+    { 0x1300, 0x0000, 0x0000, 0x19440161 },
+    { 0x1300, 0x0000, 0x0000, 0x19450161 },
+    { 0x1300, 0x0000, 0x0000, 0x19460161 },
+    { 0x1300, 0x0000, 0x0000, 0x19470131 },
+    { 0x1300, 0x0000, 0x0000, 0x19480131 },
+    { 0x1300, 0x0000, 0x0000, 0x19490131 },
+    { 0x1300, 0x0000, 0x0000, 0x194a0131 },
+    { 0x1300, 0x0000, 0x0000, 0x194b0131 },
+    { 0x1300, 0x0000, 0x0000, 0x194c0151 },
+    { 0x1300, 0x0000, 0x0000, 0x19500131 },
+    { 0x1300, 0x0000, 0x0000, 0x0000e221 },
+    { 0x1300, 0x0000, 0x0000, 0x0000e321 },
+    { 0x1300, 0x0000, 0x0000, 0x188c0131 },
+    { 0x1300, 0x0000, 0x0000, 0x18310141 },
+    { 0x1300, 0x0000, 0x0000, 0x18320131 },
+    { 0x1300, 0x0000, 0x0000, 0x18d10131 },
+    { 0x1300, 0x0000, 0x0000, 0x18330141 },
+    { 0x1300, 0x0000, 0x0000, 0x18d30131 },
+    { 0x1300, 0x0000, 0x0000, 0x18d40131 },
+    { 0x1300, 0x0000, 0x0000, 0x18340141 },
+    { 0x1300, 0x0000, 0x0000, 0x18350131 },
+    { 0x1300, 0x0000, 0x0000, 0x18360141 },
+    { 0x1300, 0x0000, 0x0000, 0x18d70131 },
+    { 0x1300, 0x0000, 0x0000, 0x18d80131 },
+    { 0x1300, 0x0000, 0x0000, 0x18d90131 },
+    { 0x1300, 0x0000, 0x0000, 0x18da0131 },
+    { 0x1300, 0x0000, 0x0000, 0x18db0131 },
+    { 0x1300, 0x0000, 0x0000, 0x18dc0131 },
+    { 0x1300, 0x0000, 0x0000, 0x184b0131 },
+    { 0x1300, 0x0000, 0x0000, 0x18370141 },
+    { 0x1300, 0x0000, 0x0000, 0x18380141 },
+    { 0x1300, 0x0000, 0x0000, 0x18390131 },
+    { 0x1300, 0x0000, 0x0000, 0x18520131 },
+    { 0x1300, 0x0000, 0x0000, 0x183a0141 },
+    { 0x1300, 0x0000, 0x0000, 0x183b0131 },
+    { 0x1300, 0x0000, 0x0000, 0x183c0141 },
+    { 0x1300, 0x0000, 0x0000, 0x183d0141 },
+    { 0x1300, 0x0000, 0x0000, 0x183e0131 },
+    { 0x1300, 0x0000, 0x0000, 0x183f0141 },
+    { 0x1300, 0x0000, 0x0000, 0x18400141 },
+    { 0x1300, 0x0000, 0x0000, 0x18410141 },
+    { 0x1300, 0x0000, 0x0000, 0x18420141 },
+    { 0x1300, 0x0000, 0x0000, 0x18430141 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x188d0131 },
+    { 0x1300, 0x0000, 0x0000, 0x188e0131 },
+    { 0x1300, 0x0000, 0x0000, 0x188f0131 },
+    { 0x1300, 0x0000, 0x0000, 0x18900131 },
+    { 0x1300, 0x0000, 0x0000, 0x18910131 },
+    { 0x1300, 0x0000, 0x0000, 0x18920131 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x18930131 },
+    { 0x1300, 0x0000, 0x0000, 0x18940131 },
+    { 0x1300, 0x0000, 0x0000, 0x18950131 },
+    { 0x1300, 0x0000, 0x0000, 0x18960131 },
+    { 0x1300, 0x0000, 0x0000, 0x18970131 },
+    { 0x1300, 0x0000, 0x0000, 0x18980131 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x18990131 },
+    { 0x1300, 0x0000, 0x0000, 0x189a0131 },
+    { 0x1300, 0x0000, 0x0000, 0x189b0131 },
+    { 0x1300, 0x0000, 0x0000, 0x189c0131 },
+    { 0x1300, 0x0000, 0x0000, 0x189d0131 },
+    { 0x1300, 0x0000, 0x0000, 0x189e0131 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x1300, 0x0000, 0x0000, 0x189f0131 },
+    { 0x1300, 0x0000, 0x0000, 0x18a00131 },
+    { 0x1300, 0x0000, 0x0000, 0x18a10131 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x5200, 0x0000, 0x0000, 0x09df0121 },
+    { 0x5200, 0x0000, 0x0000, 0x09e10121 },
+    { 0xb200, 0x0000, 0x0000, 0x03a60121 },
+    { 0xb200, 0x0000, 0x0000, 0x02100121 },
+    { 0xb200, 0x0000, 0x0000, 0x03a80121 },
+    { 0x5200, 0x0000, 0x0000, 0x09e20121 },
+    { 0x5200, 0x0000, 0x0000, 0x09ef0121 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0xb200, 0x0000, 0x0000, 0x05300121 },
+    { 0xb200, 0x0000, 0x0000, 0x03320121 },
+    { 0xb200, 0x0000, 0x0000, 0x03340121 },
+    { 0xb200, 0x0000, 0x0000, 0x03330121 },
+    { 0xb200, 0x0000, 0x0000, 0x03350121 },
+    { 0xb200, 0x0000, 0x0000, 0x05c40121 },
+    { 0xb200, 0x0000, 0x0000, 0x05ef0121 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0xb220, 0x0000, 0x0000, 0x00000000 },
+    { 0xb220, 0x0000, 0x0000, 0x00000000 },
+    { 0xb220, 0x0000, 0x0000, 0x00000000 },
+    { 0xb200, 0x0000, 0x0000, 0x09bf0111 },
+    { 0xb200, 0x0000, 0x0000, 0x09c00111 },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+    { 0x0000, 0x0000, 0x0000, 0xffffffff },
+};
+
+/* digit and compatibility folding offsets */
+const unsigned char DECLSPEC_HIDDEN wine_char_fold_index[256] =
+{
+    0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x03,
+    0x01, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a,
+    0x0b, 0x01, 0x01, 0x0c, 0x01, 0x01, 0x01, 0x0d,
+    0x0e, 0x0f, 0x10, 0x11, 0x12, 0x01, 0x01, 0x01,
+    0x13, 0x01, 0x01, 0x01, 0x14, 0x01, 0x01, 0x15,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x16, 0x01,
+    0x17, 0x18, 0x19, 0x1a, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x1b, 0x1c, 0x01, 0x01, 0x01, 0x1d, 0x1e,
+};
+
+const WCHAR DECLSPEC_HIDDEN wine_char_fold_table[7936][2] =
+{
+    /* block 0 */
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0xff80, 0x0000 }, { 0xff80, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0xff78, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    /* block 1 */
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    /* block 2 */
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0xf9d0, 0x0000 }, { 0xf9d0, 0x0000 }, { 0xf9d0, 0x0000 }, { 0xf9d0, 0x0000 },
+    { 0xf9d0, 0x0000 }, { 0xf9d0, 0x0000 }, { 0xf9d0, 0x0000 }, { 0xf9d0, 0x0000 },
+    { 0xf9d0, 0x0000 }, { 0xf9d0, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0xf940, 0x0000 }, { 0xf940, 0x0000 }, { 0xf940, 0x0000 }, { 0xf940, 0x0000 },
+    { 0xf940, 0x0000 }, { 0xf940, 0x0000 }, { 0xf940, 0x0000 }, { 0xf940, 0x0000 },
+    { 0xf940, 0x0000 }, { 0xf940, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    /* block 3 */
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0xf870, 0x0000 }, { 0xf870, 0x0000 }, { 0xf870, 0x0000 }, { 0xf870, 0x0000 },
+    { 0xf870, 0x0000 }, { 0xf870, 0x0000 }, { 0xf870, 0x0000 }, { 0xf870, 0x0000 },
+    { 0xf870, 0x0000 }, { 0xf870, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    /* block 4 */
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0xf6ca, 0x0000 }, { 0xf6ca, 0x0000 },
+    { 0xf6ca, 0x0000 }, { 0xf6ca, 0x0000 }, { 0xf6ca, 0x0000 }, { 0xf6ca, 0x0000 },
+    { 0xf6ca, 0x0000 }, { 0xf6ca, 0x0000 }, { 0xf6ca, 0x0000 }, { 0xf6ca, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0xf64a, 0x0000 }, { 0xf64a, 0x0000 },
+    { 0xf64a, 0x0000 }, { 0xf64a, 0x0000 }, { 0xf64a, 0x0000 }, { 0xf64a, 0x0000 },
+    { 0xf64a, 0x0000 }, { 0xf64a, 0x0000 }, { 0xf64a, 0x0000 }, { 0xf64a, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    /* block 5 */
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0xf5ca, 0x0000 }, { 0xf5ca, 0x0000 },
+    { 0xf5ca, 0x0000 }, { 0xf5ca, 0x0000 }, { 0xf5ca, 0x0000 }, { 0xf5ca, 0x0000 },
+    { 0xf5ca, 0x0000 }, { 0xf5ca, 0x0000 }, { 0xf5ca, 0x0000 }, { 0xf5ca, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0xf54a, 0x0000 }, { 0xf54a, 0x0000 },
+    { 0xf54a, 0x0000 }, { 0xf54a, 0x0000 }, { 0xf54a, 0x0000 }, { 0xf54a, 0x0000 },
+    { 0xf54a, 0x0000 }, { 0xf54a, 0x0000 }, { 0xf54a, 0x0000 }, { 0xf54a, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    /* block 6 */
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0xf4ca, 0x0000 }, { 0xf4ca, 0x0000 },
+    { 0xf4ca, 0x0000 }, { 0xf4ca, 0x0000 }, { 0xf4ca, 0x0000 }, { 0xf4ca, 0x0000 },
+    { 0xf4ca, 0x0000 }, { 0xf4ca, 0x0000 }, { 0xf4ca, 0x0000 }, { 0xf4ca, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0xf44a, 0x0000 }, { 0xf44a, 0x0000 },
+    { 0xf44a, 0x0000 }, { 0xf44a, 0x0000 }, { 0xf44a, 0x0000 }, { 0xf44a, 0x0000 },
+    { 0xf44a, 0x0000 }, { 0xf44a, 0x0000 }, { 0xf44a, 0x0000 }, { 0xf44a, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    /* block 7 */
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0xf3ca, 0x0000 }, { 0xf3ca, 0x0000 },
+    { 0xf3ca, 0x0000 }, { 0xf3ca, 0x0000 }, { 0xf3ca, 0x0000 }, { 0xf3ca, 0x0000 },
+    { 0xf3ca, 0x0000 }, { 0xf3ca, 0x0000 }, { 0xf3ca, 0x0000 }, { 0xf3ca, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0xf34a, 0x0000 }, { 0xf34a, 0x0000 },
+    { 0xf34a, 0x0000 }, { 0xf34a, 0x0000 }, { 0xf34a, 0x0000 }, { 0xf34a, 0x0000 },
+    { 0xf34a, 0x0000 }, { 0xf34a, 0x0000 }, { 0xf34a, 0x0000 }, { 0xf34a, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    /* block 8 */
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0xf2ca, 0x0000 }, { 0xf2ca, 0x0000 },
+    { 0xf2ca, 0x0000 }, { 0xf2ca, 0x0000 }, { 0xf2ca, 0x0000 }, { 0xf2ca, 0x0000 },
+    { 0xf2ca, 0x0000 }, { 0xf2ca, 0x0000 }, { 0xf2ca, 0x0000 }, { 0xf2ca, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0xf24a, 0x0000 }, { 0xf24a, 0x0000 },
+    { 0xf24a, 0x0000 }, { 0xf24a, 0x0000 }, { 0xf24a, 0x0000 }, { 0xf24a, 0x0000 },
+    { 0xf24a, 0x0000 }, { 0xf24a, 0x0000 }, { 0xf24a, 0x0000 }, { 0xf24a, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    /* block 9 */
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0xf1e0, 0x0000 }, { 0xf1e0, 0x0000 }, { 0xf1e0, 0x0000 }, { 0xf1e0, 0x0000 },
+    { 0xf1e0, 0x0000 }, { 0xf1e0, 0x0000 }, { 0xf1e0, 0x0000 }, { 0xf1e0, 0x0000 },
+    { 0xf1e0, 0x0000 }, { 0xf1e0, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0xf160, 0x0000 }, { 0xf160, 0x0000 }, { 0xf160, 0x0000 }, { 0xf160, 0x0000 },
+    { 0xf160, 0x0000 }, { 0xf160, 0x0000 }, { 0xf160, 0x0000 }, { 0xf160, 0x0000 },
+    { 0xf160, 0x0000 }, { 0xf160, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    /* block 10 */
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0xf110, 0x0000 }, { 0xf110, 0x0000 }, { 0xf110, 0x0000 }, { 0xf110, 0x0000 },
+    { 0xf110, 0x0000 }, { 0xf110, 0x0000 }, { 0xf110, 0x0000 }, { 0xf110, 0x0000 },
+    { 0xf110, 0x0000 }, { 0xf110, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    /* block 11 */
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0xeff0, 0x0000 }, { 0xeff0, 0x0000 }, { 0xeff0, 0x0000 }, { 0xeff0, 0x0000 },
+    { 0xeff0, 0x0000 }, { 0xeff0, 0x0000 }, { 0xeff0, 0x0000 }, { 0xeff0, 0x0000 },
+    { 0xeff0, 0x0000 }, { 0xeff0, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0xefa0, 0x0000 }, { 0xefa0, 0x0000 }, { 0xefa0, 0x0000 }, { 0xefa0, 0x0000 },
+    { 0xefa0, 0x0000 }, { 0xefa0, 0x0000 }, { 0xefa0, 0x0000 }, { 0xefa0, 0x0000 },
+    { 0xefa0, 0x0000 }, { 0xefa0, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    /* block 12 */
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0xecc8, 0x0000 }, { 0xecc8, 0x0000 }, { 0xecc8, 0x0000 },
+    { 0xecc8, 0x0000 }, { 0xecc8, 0x0000 }, { 0xecc8, 0x0000 }, { 0xecc8, 0x0000 },
+    { 0xecc8, 0x0000 }, { 0xecc8, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    /* block 13 */
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0xe850, 0x0000 }, { 0xe850, 0x0000 }, { 0xe850, 0x0000 }, { 0xe850, 0x0000 },
+    { 0xe850, 0x0000 }, { 0xe850, 0x0000 }, { 0xe850, 0x0000 }, { 0xe850, 0x0000 },
+    { 0xe850, 0x0000 }, { 0xe850, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    /* block 14 */
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0xe820, 0x0000 }, { 0xe820, 0x0000 }, { 0xe820, 0x0000 }, { 0xe820, 0x0000 },
+    { 0xe820, 0x0000 }, { 0xe820, 0x0000 }, { 0xe820, 0x0000 }, { 0xe820, 0x0000 },
+    { 0xe820, 0x0000 }, { 0xe820, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    /* block 15 */
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0xe6ea, 0x0000 }, { 0xe6ea, 0x0000 },
+    { 0xe6ea, 0x0000 }, { 0xe6ea, 0x0000 }, { 0xe6ea, 0x0000 }, { 0xe6ea, 0x0000 },
+    { 0xe6ea, 0x0000 }, { 0xe6ea, 0x0000 }, { 0xe6ea, 0x0000 }, { 0xe6ea, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0xe660, 0x0000 }, { 0xe660, 0x0000 }, { 0xe660, 0x0000 }, { 0xe660, 0x0000 },
+    { 0xe660, 0x0000 }, { 0xe660, 0x0000 }, { 0xe660, 0x0000 }, { 0xe660, 0x0000 },
+    { 0xe660, 0x0000 }, { 0xe660, 0x0000 }, { 0xe657, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    /* block 16 */
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0xe5b0, 0x0000 }, { 0xe5b0, 0x0000 }, { 0xe5b0, 0x0000 }, { 0xe5b0, 0x0000 },
+    { 0xe5b0, 0x0000 }, { 0xe5b0, 0x0000 }, { 0xe5b0, 0x0000 }, { 0xe5b0, 0x0000 },
+    { 0xe5b0, 0x0000 }, { 0xe5b0, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0xe5a0, 0x0000 }, { 0xe5a0, 0x0000 }, { 0xe5a0, 0x0000 }, { 0xe5a0, 0x0000 },
+    { 0xe5a0, 0x0000 }, { 0xe5a0, 0x0000 }, { 0xe5a0, 0x0000 }, { 0xe5a0, 0x0000 },
+    { 0xe5a0, 0x0000 }, { 0xe5a0, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    /* block 17 */
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0xe4e0, 0x0000 }, { 0xe4e0, 0x0000 }, { 0xe4e0, 0x0000 }, { 0xe4e0, 0x0000 },
+    { 0xe4e0, 0x0000 }, { 0xe4e0, 0x0000 }, { 0xe4e0, 0x0000 }, { 0xe4e0, 0x0000 },
+    { 0xe4e0, 0x0000 }, { 0xe4e0, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0xe480, 0x0000 }, { 0xe480, 0x0000 }, { 0xe480, 0x0000 }, { 0xe480, 0x0000 },
+    { 0xe480, 0x0000 }, { 0xe480, 0x0000 }, { 0xe480, 0x0000 }, { 0xe480, 0x0000 },
+    { 0xe480, 0x0000 }, { 0xe480, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    /* block 18 */
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0xe3f0, 0x0000 }, { 0xe3f0, 0x0000 }, { 0xe3f0, 0x0000 }, { 0xe3f0, 0x0000 },
+    { 0xe3f0, 0x0000 }, { 0xe3f0, 0x0000 }, { 0xe3f0, 0x0000 }, { 0xe3f0, 0x0000 },
+    { 0xe3f0, 0x0000 }, { 0xe3f0, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0xe3e0, 0x0000 }, { 0xe3e0, 0x0000 }, { 0xe3e0, 0x0000 }, { 0xe3e0, 0x0000 },
+    { 0xe3e0, 0x0000 }, { 0xe3e0, 0x0000 }, { 0xe3e0, 0x0000 }, { 0xe3e0, 0x0000 },
+    { 0xe3e0, 0x0000 }, { 0xe3e0, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    /* block 19 */
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0xdfc0, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0xdfc0, 0x0000 }, { 0xdfc0, 0x0000 }, { 0xdfc0, 0x0000 }, { 0xdfc0, 0x0000 },
+    { 0xdfc0, 0x0000 }, { 0xdfc0, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0xdfb0, 0x0000 }, { 0xdfb0, 0x0000 }, { 0xdfb0, 0x0000 }, { 0xdfb0, 0x0000 },
+    { 0xdfb0, 0x0000 }, { 0xdfb0, 0x0000 }, { 0xdfb0, 0x0000 }, { 0xdfb0, 0x0000 },
+    { 0xdfb0, 0x0000 }, { 0xdfb0, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    /* block 20 */
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0xdbd1, 0x0000 }, { 0xdbd1, 0x0000 }, { 0xdbd1, 0x0000 }, { 0xdbd1, 0x0000 },
+    { 0xdbd1, 0x0000 }, { 0xdbd1, 0x0000 }, { 0xdbd1, 0x0000 }, { 0xdbd1, 0x0000 },
+    { 0xdbd1, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0xdbbd, 0x0000 }, { 0xdbbd, 0x0000 }, { 0xdbbd, 0x0000 }, { 0xdbbd, 0x0000 },
+    { 0xdbbd, 0x0000 }, { 0xdbbd, 0x0000 }, { 0xdbbd, 0x0000 }, { 0xdbbd, 0x0000 },
+    { 0xdbbd, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0xdba9, 0x0000 }, { 0xdba9, 0x0000 }, { 0xdba9, 0x0000 }, { 0xdba9, 0x0000 },
+    { 0xdba9, 0x0000 }, { 0xdba9, 0x0000 }, { 0xdba9, 0x0000 }, { 0xdba9, 0x0000 },
+    { 0xdba9, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0xdb46, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0xdb3c, 0x0000 }, { 0xdb3c, 0x0000 }, { 0xdb3c, 0x0000 },
+    { 0xdb3c, 0x0000 }, { 0xdb3c, 0x0000 }, { 0xdb3c, 0x0000 }, { 0xdb3c, 0x0000 },
+    { 0xdb3c, 0x0000 }, { 0xdb3c, 0x0000 }, { 0x0000, 0x0000 }, { 0xdb31, 0x0000 },
+    /* block 21 */
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0xd8bb, 0x0000 }, { 0xd8bb, 0x0000 },
+    { 0xd8bb, 0x0000 }, { 0xd8bb, 0x0000 }, { 0xd8bb, 0x0000 }, { 0xd8bb, 0x0000 },
+    { 0xd8bb, 0x0000 }, { 0xd8bb, 0x0000 }, { 0xd8bb, 0x0000 }, { 0x0000, 0x0000 },
+    { 0xd8b1, 0x0000 }, { 0xd8b1, 0x0000 }, { 0xd8b1, 0x0000 }, { 0xd8b1, 0x0000 },
+    { 0xd8b1, 0x0000 }, { 0xd8b1, 0x0000 }, { 0xd8b1, 0x0000 }, { 0xd8b1, 0x0000 },
+    { 0xd8b1, 0x0000 }, { 0x0000, 0x0000 }, { 0xd8a7, 0x0000 }, { 0xd8a7, 0x0000 },
+    { 0xd8a7, 0x0000 }, { 0xd8a7, 0x0000 }, { 0xd8a7, 0x0000 }, { 0xd8a7, 0x0000 },
+    { 0xd8a7, 0x0000 }, { 0xd8a7, 0x0000 }, { 0xd8a7, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    /* block 22 */
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x5a10, 0x0000 }, { 0x5a10, 0x0000 }, { 0x5a10, 0x0000 }, { 0x5a10, 0x0000 },
+    { 0x5a10, 0x0000 }, { 0x5a10, 0x0000 }, { 0x5a10, 0x0000 }, { 0x5a10, 0x0000 },
+    { 0x5a10, 0x0000 }, { 0x5a10, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    /* block 23 */
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x5760, 0x0000 }, { 0x5760, 0x0000 }, { 0x5760, 0x0000 }, { 0x5760, 0x0000 },
+    { 0x5760, 0x0000 }, { 0x5760, 0x0000 }, { 0x5760, 0x0000 }, { 0x5760, 0x0000 },
+    { 0x5760, 0x0000 }, { 0x5760, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    /* block 24 */
+    { 0x5730, 0x0000 }, { 0x5730, 0x0000 }, { 0x5730, 0x0000 }, { 0x5730, 0x0000 },
+    { 0x5730, 0x0000 }, { 0x5730, 0x0000 }, { 0x5730, 0x0000 }, { 0x5730, 0x0000 },
+    { 0x5730, 0x0000 }, { 0x5730, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x5660, 0x0000 }, { 0x5660, 0x0000 }, { 0x5660, 0x0000 }, { 0x5660, 0x0000 },
+    { 0x5660, 0x0000 }, { 0x5660, 0x0000 }, { 0x5660, 0x0000 }, { 0x5660, 0x0000 },
+    { 0x5660, 0x0000 }, { 0x5660, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x5640, 0x0000 }, { 0x5640, 0x0000 }, { 0x5640, 0x0000 }, { 0x5640, 0x0000 },
+    { 0x5640, 0x0000 }, { 0x5640, 0x0000 }, { 0x5640, 0x0000 }, { 0x5640, 0x0000 },
+    { 0x5640, 0x0000 }, { 0x5640, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    /* block 25 */
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x55e0, 0x0000 }, { 0x55e0, 0x0000 }, { 0x55e0, 0x0000 }, { 0x55e0, 0x0000 },
+    { 0x55e0, 0x0000 }, { 0x55e0, 0x0000 }, { 0x55e0, 0x0000 }, { 0x55e0, 0x0000 },
+    { 0x55e0, 0x0000 }, { 0x55e0, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    /* block 26 */
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x5440, 0x0000 }, { 0x5440, 0x0000 }, { 0x5440, 0x0000 }, { 0x5440, 0x0000 },
+    { 0x5440, 0x0000 }, { 0x5440, 0x0000 }, { 0x5440, 0x0000 }, { 0x5440, 0x0000 },
+    { 0x5440, 0x0000 }, { 0x5440, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    /* block 27 */
+    { 0x0000, 0x9348 }, { 0x0000, 0x6df3 }, { 0x0000, 0x95c8 }, { 0x0000, 0x93c5 },
+    { 0x0000, 0x75cd }, { 0x0000, 0x552d }, { 0x0000, 0x5adf }, { 0x0000, 0xa695 },
+    { 0x0000, 0xa694 }, { 0x0000, 0x6048 }, { 0x0000, 0x98c7 }, { 0x0000, 0x5c7c },
+    { 0x0000, 0x603c }, { 0x0000, 0x68e9 }, { 0x0000, 0x7d5b }, { 0x0000, 0x8676 },
+    { 0x0000, 0x8d2f }, { 0x0000, 0x8ea9 }, { 0x0000, 0x8fe6 }, { 0x0000, 0x977c },
+    { 0x0000, 0x70ee }, { 0x0000, 0x7406 }, { 0x0000, 0x77c3 }, { 0x0000, 0x7ac7 },
+    { 0x0000, 0x8b25 }, { 0x0000, 0x9851 }, { 0x0000, 0xa0d7 }, { 0x0000, 0x5567 },
+    { 0x0000, 0x5a59 }, { 0x0000, 0x71e7 }, { 0x0000, 0x78fd }, { 0x0000, 0x8d0e },
+    { 0x0000, 0xa4fe }, { 0x0000, 0x642f }, { 0x0000, 0x76c9 }, { 0x0000, 0x8caa },
+    { 0x0000, 0x9040 }, { 0x0000, 0x69a4 }, { 0x0000, 0x88b2 }, { 0x0000, 0x8ef8 },
+    { 0x0000, 0x65a2 }, { 0x0000, 0x6dee }, { 0x0000, 0x7440 }, { 0x0000, 0x79d1 },
+    { 0x0000, 0x97a2 }, { 0x0000, 0x5659 }, { 0x0000, 0x5889 }, { 0x0000, 0x59af },
+    { 0x0000, 0x6b94 }, { 0x0000, 0x71a2 }, { 0x0000, 0x78de }, { 0x0000, 0x7db4 },
+    { 0x0000, 0x86cd }, { 0x0000, 0x8cd1 }, { 0x0000, 0x8d26 }, { 0x0000, 0x94b8 },
+    { 0x0000, 0x9dfa }, { 0x0000, 0xa236 }, { 0x0000, 0xa4c0 }, { 0x0000, 0x7f51 },
+    { 0x0000, 0x8043 }, { 0x0000, 0x8463 }, { 0x0000, 0x8a8b }, { 0x0000, 0x99c5 },
+    { 0x0000, 0xa53f }, { 0x0000, 0x9195 }, { 0x0000, 0x5f9d }, { 0x0000, 0x65c1 },
+    { 0x0000, 0x831c }, { 0x0000, 0x8739 }, { 0x0000, 0x791c }, { 0x0000, 0x7f83 },
+    { 0x0000, 0x937a }, { 0x0000, 0x9dae }, { 0x0000, 0x5f8e }, { 0x0000, 0x6317 },
+    { 0x0000, 0x70c7 }, { 0x0000, 0x748d }, { 0x0000, 0x75c1 }, { 0x0000, 0x83e0 },
+    { 0x0000, 0x84e7 }, { 0x0000, 0x9cfa }, { 0x0000, 0x5980 }, { 0x0000, 0x8738 },
+    { 0x0000, 0x5888 }, { 0x0000, 0x5877 }, { 0x0000, 0x80c6 }, { 0x0000, 0x8467 },
+    { 0x0000, 0x8a99 }, { 0x0000, 0x9d1c }, { 0x0000, 0x9226 }, { 0x0000, 0x6974 },
+    { 0x0000, 0x70a6 }, { 0x0000, 0x91a1 }, { 0x0000, 0x54db }, { 0x0000, 0x6288 },
+    { 0x0000, 0x66b2 }, { 0x0000, 0x7a26 }, { 0x0000, 0x7c0e }, { 0x0000, 0x59b4 },
+    { 0x0000, 0x7f97 }, { 0x0000, 0x565a }, { 0x0000, 0x6643 }, { 0x0000, 0x54a6 },
+    { 0x0000, 0x7364 }, { 0x0000, 0x6c0f }, { 0x0000, 0x83b8 }, { 0x0000, 0x5a58 },
+    { 0x0000, 0x5ef2 }, { 0x0000, 0x7d94 }, { 0x0000, 0x8adb }, { 0x0000, 0x913b },
+    { 0x0000, 0x724a }, { 0x0000, 0x963f }, { 0x0000, 0x7316 }, { 0x0000, 0x698b },
+    { 0x0000, 0x8971 }, { 0x0000, 0x6a2b }, { 0x0000, 0x7bef }, { 0x0000, 0x5537 },
+    { 0x0000, 0x57f1 }, { 0x0000, 0x5850 }, { 0x0000, 0x6f07 }, { 0x0000, 0x836c },
+    { 0x0000, 0x88f3 }, { 0x0000, 0x9155 }, { 0x0000, 0x9851 }, { 0x0000, 0x5976 },
+    { 0x0000, 0x5ac2 }, { 0x0000, 0x5ff2 }, { 0x0000, 0x656a }, { 0x0000, 0x6c42 },
+    { 0x0000, 0x767a }, { 0x0000, 0x7fa5 }, { 0x0000, 0x9c27 }, { 0x0000, 0xa0e3 },
+    { 0x0000, 0xa50f }, { 0x0000, 0xa545 }, { 0x0000, 0x5911 }, { 0x0000, 0x6d3b },
+    { 0x0000, 0x71eb }, { 0x0000, 0x95d5 }, { 0x0000, 0x64e6 }, { 0x0000, 0x6801 },
+    { 0x0000, 0x6870 }, { 0x0000, 0x6b09 }, { 0x0000, 0x7591 }, { 0x0000, 0x77b6 },
+    { 0x0000, 0x7af5 }, { 0x0000, 0x8035 }, { 0x0000, 0x845e }, { 0x0000, 0x86d8 },
+    { 0x0000, 0x958e }, { 0x0000, 0x8b55 }, { 0x0000, 0x9689 }, { 0x0000, 0x99af },
+    { 0x0000, 0x587b }, { 0x0000, 0x5906 }, { 0x0000, 0x5b1f }, { 0x0000, 0x7729 },
+    { 0x0000, 0x8f22 }, { 0x0000, 0x9109 }, { 0x0000, 0x6527 }, { 0x0000, 0x6652 },
+    { 0x0000, 0x69d7 }, { 0x0000, 0x7209 }, { 0x0000, 0x8298 }, { 0x0000, 0x79ce },
+    { 0x0000, 0x553c }, { 0x0000, 0x5d50 }, { 0x0000, 0x623d }, { 0x0000, 0x640f },
+    { 0x0000, 0x6670 }, { 0x0000, 0x7a05 }, { 0x0000, 0x7abb }, { 0x0000, 0x85eb },
+    { 0x0000, 0x8696 }, { 0x0000, 0x9883 }, { 0x0000, 0x9d44 }, { 0x0000, 0x9d95 },
+    { 0x0000, 0x9e64 }, { 0x0000, 0x55d6 }, { 0x0000, 0x7ff8 }, { 0x0000, 0x97fd },
+    { 0x0000, 0x9d00 }, { 0x0000, 0x6728 }, { 0x0000, 0x54cc }, { 0x0000, 0x571f },
+    { 0x0000, 0x6232 }, { 0x0000, 0x6282 }, { 0x0000, 0x6bdb }, { 0x0000, 0x7043 },
+    { 0x0000, 0x780e }, { 0x0000, 0x7c81 }, { 0x0000, 0x8b3a }, { 0x0000, 0x96b9 },
+    { 0x0000, 0xa5c9 }, { 0x0000, 0x6cc3 }, { 0x0000, 0x9c68 }, { 0x0000, 0x58c2 },
+    { 0x0000, 0x6db3 }, { 0x0000, 0x6e2a }, { 0x0000, 0x7377 }, { 0x0000, 0x74d1 },
+    { 0x0000, 0x7a3d }, { 0x0000, 0x7b8c }, { 0x0000, 0x7e9d }, { 0x0000, 0x8341 },
+    { 0x0000, 0x9e8e }, { 0x0000, 0x579c }, { 0x0000, 0x685c }, { 0x0000, 0x9ca5 },
+    { 0x0000, 0x5657 }, { 0x0000, 0x6344 }, { 0x0000, 0x7414 }, { 0x0000, 0x9553 },
+    { 0x0000, 0x65b3 }, { 0x0000, 0x676b }, { 0x0000, 0x6e3d }, { 0x0000, 0x79ac },
+    { 0x0000, 0x9caa }, { 0x0000, 0x584c }, { 0x0000, 0x5a31 }, { 0x0000, 0x6286 },
+    { 0x0000, 0x6c33 }, { 0x0000, 0x6d6d }, { 0x0000, 0x6ec6 }, { 0x0000, 0x7302 },
+    { 0x0000, 0x7a22 }, { 0x0000, 0x7bfd }, { 0x0000, 0x8593 }, { 0x0000, 0x8ee8 },
+    { 0x0000, 0x8ef9 }, { 0x0000, 0x97e3 }, { 0x0000, 0x9cf8 }, { 0x0000, 0x5954 },
+    { 0x0000, 0x74ce }, { 0x0000, 0x5a30 }, { 0x0000, 0x77e2 }, { 0x0000, 0x7aa9 },
+    { 0x0000, 0x8c0a }, { 0x0000, 0x9cb2 }, { 0x0000, 0xa265 }, { 0x0000, 0xa4ac },
+    { 0x0000, 0x6da3 }, { 0x0000, 0x73d6 }, { 0x0000, 0x87f2 }, { 0x0000, 0x80d4 },
+    { 0x0000, 0x8128 }, { 0x0000, 0x8299 }, { 0x0000, 0x78c6 }, { 0x0000, 0x769e },
+    { 0x0000, 0x915c }, { 0x0000, 0x54c3 }, { 0x0000, 0x8938 }, { 0x0000, 0x583b },
+    /* block 28 */
+    { 0x0000, 0x5807 }, { 0x0000, 0x64a5 }, { 0x0000, 0x68d1 }, { 0x0000, 0x82d3 },
+    { 0x0000, 0x6181 }, { 0x0000, 0x7319 }, { 0x0000, 0x6cae }, { 0x0000, 0x9534 },
+    { 0x0000, 0x8e44 }, { 0x0000, 0x9c44 }, { 0x0000, 0x8f81 }, { 0x0000, 0x64c8 },
+    { 0x0000, 0x5734 }, { 0x0000, 0x5bb3 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x5e4a }, { 0x0000, 0x0000 }, { 0x0000, 0x6c62 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x57c9 }, { 0x0000, 0x7914 }, { 0x0000, 0x7cb3 },
+    { 0x0000, 0x7f24 }, { 0x0000, 0x7f45 }, { 0x0000, 0x7f4b }, { 0x0000, 0x7f74 },
+    { 0x0000, 0x9d3a }, { 0x0000, 0x82a1 }, { 0x0000, 0x859f }, { 0x0000, 0x0000 },
+    { 0x0000, 0x8bf2 }, { 0x0000, 0x0000 }, { 0x0000, 0x90d6 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x9613 }, { 0x0000, 0x96d7 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x9ec5 }, { 0x0000, 0x9ed1 },
+    { 0x0000, 0x9efc }, { 0x0000, 0xa387 }, { 0x0000, 0x96b0 }, { 0x0000, 0x9c88 },
+    { 0x0000, 0x557e }, { 0x0000, 0x56b6 }, { 0x0000, 0x571b }, { 0x0000, 0x5896 },
+    { 0x0000, 0x58b0 }, { 0x0000, 0x591c }, { 0x0000, 0x5b67 }, { 0x0000, 0x5bcf },
+    { 0x0000, 0x5c30 }, { 0x0000, 0x5e07 }, { 0x0000, 0x5e6e }, { 0x0000, 0x6229 },
+    { 0x0000, 0x6232 }, { 0x0000, 0x6657 }, { 0x0000, 0x672a }, { 0x0000, 0x674f },
+    { 0x0000, 0x67b2 }, { 0x0000, 0x6b0e }, { 0x0000, 0x6ba0 }, { 0x0000, 0x6c4e },
+    { 0x0000, 0x6e41 }, { 0x0000, 0x7332 }, { 0x0000, 0x73d4 }, { 0x0000, 0x74db },
+    { 0x0000, 0x7726 }, { 0x0000, 0x77e2 }, { 0x0000, 0x79d8 }, { 0x0000, 0x7e46 },
+    { 0x0000, 0x7ef2 }, { 0x0000, 0x7efc }, { 0x0000, 0x7efa }, { 0x0000, 0x7f01 },
+    { 0x0000, 0x7f06 }, { 0x0000, 0x7f0c }, { 0x0000, 0x7f3b }, { 0x0000, 0x7f3b },
+    { 0x0000, 0x7fec }, { 0x0000, 0x802c }, { 0x0000, 0x816a }, { 0x0000, 0x839d },
+    { 0x0000, 0x83b1 }, { 0x0000, 0x83e8 }, { 0x0000, 0x8518 }, { 0x0000, 0x85aa },
+    { 0x0000, 0x8791 }, { 0x0000, 0x881c }, { 0x0000, 0x881b }, { 0x0000, 0x89f8 },
+    { 0x0000, 0x8eb0 }, { 0x0000, 0x8f35 }, { 0x0000, 0x909f }, { 0x0000, 0x90d6 },
+    { 0x0000, 0x926f }, { 0x0000, 0x92a3 }, { 0x0000, 0x9550 }, { 0x0000, 0x95d1 },
+    { 0x0000, 0x9c7b }, { 0x0000, 0x9d96 }, { 0x0000, 0x9dd1 }, { 0x0000, 0x660a },
+    { 0x0000, 0x4882 }, { 0x0000, 0x87ab }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x53b6 }, { 0x0000, 0x5744 }, { 0x0000, 0x56f6 }, { 0x0000, 0x550d },
+    { 0x0000, 0x56d1 }, { 0x0000, 0x570b }, { 0x0000, 0x5851 }, { 0x0000, 0x5883 },
+    { 0x0000, 0x5b25 }, { 0x0000, 0x5adc }, { 0x0000, 0x5b1f }, { 0x0000, 0x5b67 },
+    { 0x0000, 0x5dde }, { 0x0000, 0x5e36 }, { 0x0000, 0x5ec6 }, { 0x0000, 0x5ed5 },
+    { 0x0000, 0x5fe2 }, { 0x0000, 0x60a7 }, { 0x0000, 0x6450 }, { 0x0000, 0x6456 },
+    { 0x0000, 0x64e5 }, { 0x0000, 0x6528 }, { 0x0000, 0x6652 }, { 0x0000, 0x66c7 },
+    { 0x0000, 0x6680 }, { 0x0000, 0x6705 }, { 0x0000, 0x66d6 }, { 0x0000, 0x6767 },
+    { 0x0000, 0x67a8 }, { 0x0000, 0x6937 }, { 0x0000, 0x698e }, { 0x0000, 0x69c3 },
+    { 0x0000, 0x6ac6 }, { 0x0000, 0x6be3 }, { 0x0000, 0x6c85 }, { 0x0000, 0x6c88 },
+    { 0x0000, 0x6cc2 }, { 0x0000, 0x70e4 }, { 0x0000, 0x7124 }, { 0x0000, 0x72aa },
+    { 0x0000, 0x7443 }, { 0x0000, 0x7432 }, { 0x0000, 0x7488 }, { 0x0000, 0x7583 },
+    { 0x0000, 0x76d2 }, { 0x0000, 0x7d0a }, { 0x0000, 0x7797 }, { 0x0000, 0x7810 },
+    { 0x0000, 0x788a }, { 0x0000, 0x79d0 }, { 0x0000, 0x7a64 }, { 0x0000, 0x7a98 },
+    { 0x0000, 0x7b79 }, { 0x0000, 0x7b7a }, { 0x0000, 0x7c24 }, { 0x0000, 0x7c34 },
+    { 0x0000, 0x7c4c }, { 0x0000, 0x7ca1 }, { 0x0000, 0x7c96 }, { 0x0000, 0x7e21 },
+    { 0x0000, 0x8005 }, { 0x0000, 0x8113 }, { 0x0000, 0x81cd }, { 0x0000, 0x82ac },
+    { 0x0000, 0x8344 }, { 0x0000, 0x848d }, { 0x0000, 0x8553 }, { 0x0000, 0x889f },
+    { 0x0000, 0x893b }, { 0x0000, 0x8cc4 }, { 0x0000, 0x8e8b }, { 0x0000, 0x8ecf },
+    { 0x0000, 0x8ede }, { 0x0000, 0x9006 }, { 0x0000, 0x903e }, { 0x0000, 0x9010 },
+    { 0x0000, 0x9045 }, { 0x0000, 0x9041 }, { 0x0000, 0x902f }, { 0x0000, 0x907a },
+    { 0x0000, 0x90ca }, { 0x0000, 0x9247 }, { 0x0000, 0x9476 }, { 0x0000, 0x95af },
+    { 0x0000, 0x96d5 }, { 0x0000, 0x97b1 }, { 0x0000, 0x9bb6 }, { 0x0000, 0x9c1c },
+    { 0x0000, 0x9c8e }, { 0x0000, 0x9d12 }, { 0x0000, 0x9d35 }, { 0x0000, 0x9d40 },
+    { 0x0000, 0x9d6f }, { 0x0000, 0xa045 }, { 0x0000, 0xa4ce }, { 0x0000, 0x2d7b },
+    { 0x0000, 0x2d74 }, { 0x0000, 0x3904 }, { 0x0000, 0x40cb }, { 0x0000, 0x4545 },
+    { 0x0000, 0x4565 }, { 0x0000, 0x5774 }, { 0x0000, 0x61fa }, { 0x0000, 0x83fc },
+    { 0x0000, 0xa46b }, { 0x0000, 0xa4b5 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    /* block 29 */
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x21f5 }, { 0x0000, 0x21e3 }, { 0x0000, 0x21e1 }, { 0x0000, 0x022c },
+    { 0x0000, 0x022b }, { 0x0000, 0x01f3 }, { 0x0000, 0x01f3 }, { 0x0000, 0x0244 },
+    { 0x0000, 0x0245 }, { 0x0000, 0x31db }, { 0x0000, 0x31db }, { 0x0000, 0x31d5 },
+    { 0x0000, 0x31d5 }, { 0x0000, 0x31cd }, { 0x0000, 0x31cd }, { 0x0000, 0x31c9 },
+    { 0x0000, 0x31c9 }, { 0x0000, 0x31cb }, { 0x0000, 0x31cb }, { 0x0000, 0x31cb },
+    { 0x0000, 0x31cb }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0214 },
+    { 0x0000, 0x0215 }, { 0x0000, 0x21f5 }, { 0x0000, 0x21f4 }, { 0x0000, 0x21f3 },
+    { 0x0000, 0x21f2 }, { 0x0000, 0x0212 }, { 0x0000, 0x0211 }, { 0x0000, 0x0210 },
+    { 0x0000, 0x01dc }, { 0x0000, 0x31b0 }, { 0x0000, 0x01dc }, { 0x0000, 0x0000 },
+    { 0x0000, 0x01e7 }, { 0x0000, 0x01e5 }, { 0x0000, 0x01e9 }, { 0x0000, 0x01ca },
+    { 0x0000, 0x21bc }, { 0x0000, 0x01cf }, { 0x0000, 0x01cf }, { 0x0000, 0x0220 },
+    { 0x0000, 0x0221 }, { 0x0000, 0x31b7 }, { 0x0000, 0x31b7 }, { 0x0000, 0x01c4 },
+    { 0x0000, 0x01c6 }, { 0x0000, 0x01c9 }, { 0x0000, 0x01c9 }, { 0x0000, 0x01ca },
+    { 0x0000, 0x01d8 }, { 0x0000, 0x01d9 }, { 0x0000, 0x01d7 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x01f4 }, { 0x0000, 0x01bb }, { 0x0000, 0x01bb }, { 0x0000, 0x01d5 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x07a1 }, { 0x0000, 0x07a1 }, { 0x0000, 0x07a0 }, { 0x0000, 0x07a0 },
+    { 0x0000, 0x079f }, { 0x0000, 0x079f }, { 0x0000, 0x079e }, { 0x0000, 0x079e },
+    { 0x0000, 0x079d }, { 0x0000, 0x079d }, { 0x0000, 0x079c }, { 0x0000, 0x079b },
+    { 0x0000, 0x079a }, { 0x0000, 0x079a }, { 0x0000, 0x0799 }, { 0x0000, 0x0799 },
+    { 0x0000, 0x0798 }, { 0x0000, 0x0797 }, { 0x0000, 0x0796 }, { 0x0000, 0x0796 },
+    { 0x0000, 0x0795 }, { 0x0000, 0x0795 }, { 0x0000, 0x0794 }, { 0x0000, 0x0793 },
+    { 0x0000, 0x0792 }, { 0x0000, 0x0792 }, { 0x0000, 0x0791 }, { 0x0000, 0x0790 },
+    { 0x0000, 0x078f }, { 0x0000, 0x078f }, { 0x0000, 0x078e }, { 0x0000, 0x078d },
+    { 0x0000, 0x078c }, { 0x0000, 0x078c }, { 0x0000, 0x078b }, { 0x0000, 0x078a },
+    { 0x0000, 0x0789 }, { 0x0000, 0x0789 }, { 0x0000, 0x0788 }, { 0x0000, 0x0787 },
+    { 0x0000, 0x0786 }, { 0x0000, 0x0786 }, { 0x0000, 0x0785 }, { 0x0000, 0x0785 },
+    { 0x0000, 0x0784 }, { 0x0000, 0x0784 }, { 0x0000, 0x0783 }, { 0x0000, 0x0783 },
+    { 0x0000, 0x0782 }, { 0x0000, 0x0782 }, { 0x0000, 0x0781 }, { 0x0000, 0x0780 },
+    { 0x0000, 0x077f }, { 0x0000, 0x077f }, { 0x0000, 0x077e }, { 0x0000, 0x077d },
+    { 0x0000, 0x077c }, { 0x0000, 0x077c }, { 0x0000, 0x077b }, { 0x0000, 0x077a },
+    { 0x0000, 0x0779 }, { 0x0000, 0x0779 }, { 0x0000, 0x0778 }, { 0x0000, 0x0777 },
+    { 0x0000, 0x0776 }, { 0x0000, 0x0776 }, { 0x0000, 0x0775 }, { 0x0000, 0x0774 },
+    { 0x0000, 0x0773 }, { 0x0000, 0x0773 }, { 0x0000, 0x0772 }, { 0x0000, 0x0771 },
+    { 0x0000, 0x0770 }, { 0x0000, 0x0770 }, { 0x0000, 0x076f }, { 0x0000, 0x076e },
+    { 0x0000, 0x076d }, { 0x0000, 0x076d }, { 0x0000, 0x076c }, { 0x0000, 0x076b },
+    { 0x0000, 0x076a }, { 0x0000, 0x0770 }, { 0x0000, 0x076f }, { 0x0000, 0x076e },
+    { 0x0000, 0x076d }, { 0x0000, 0x076d }, { 0x0000, 0x076c }, { 0x0000, 0x076b },
+    { 0x0000, 0x076a }, { 0x0000, 0x076a }, { 0x0000, 0x0769 }, { 0x0000, 0x0768 },
+    { 0x0000, 0x0767 }, { 0x0000, 0x0767 }, { 0x0000, 0x0766 }, { 0x0000, 0x0765 },
+    { 0x0000, 0x0764 }, { 0x0000, 0x0764 }, { 0x0000, 0x0763 }, { 0x0000, 0x0762 },
+    { 0x0000, 0x0761 }, { 0x0000, 0x0761 }, { 0x0000, 0x0760 }, { 0x0000, 0x075f },
+    { 0x0000, 0x075e }, { 0x0000, 0x075e }, { 0x0000, 0x075d }, { 0x0000, 0x075c },
+    { 0x0000, 0x075b }, { 0x0000, 0x075b }, { 0x0000, 0x075a }, { 0x0000, 0x075a },
+    { 0x0000, 0x0759 }, { 0x0000, 0x0759 }, { 0x0000, 0x0758 }, { 0x0000, 0x0757 },
+    { 0x0000, 0x0756 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    /* block 30 */
+    { 0x0000, 0x0000 }, { 0x0000, 0x0120 }, { 0x0000, 0x0120 }, { 0x0000, 0x0120 },
+    { 0x0000, 0x0120 }, { 0x0000, 0x0120 }, { 0x0000, 0x0120 }, { 0x0000, 0x0120 },
+    { 0x0000, 0x0120 }, { 0x0000, 0x0120 }, { 0x0000, 0x0120 }, { 0x0000, 0x0120 },
+    { 0x0000, 0x0120 }, { 0x0000, 0x0120 }, { 0x0000, 0x0120 }, { 0x0000, 0x0120 },
+    { 0x0120, 0x0120 }, { 0x0120, 0x0120 }, { 0x0120, 0x0120 }, { 0x0120, 0x0120 },
+    { 0x0120, 0x0120 }, { 0x0120, 0x0120 }, { 0x0120, 0x0120 }, { 0x0120, 0x0120 },
+    { 0x0120, 0x0120 }, { 0x0120, 0x0120 }, { 0x0000, 0x0120 }, { 0x0000, 0x0120 },
+    { 0x0000, 0x0120 }, { 0x0000, 0x0120 }, { 0x0000, 0x0120 }, { 0x0000, 0x0120 },
+    { 0x0000, 0x0120 }, { 0x0000, 0x0120 }, { 0x0000, 0x0120 }, { 0x0000, 0x0120 },
+    { 0x0000, 0x0120 }, { 0x0000, 0x0120 }, { 0x0000, 0x0120 }, { 0x0000, 0x0120 },
+    { 0x0000, 0x0120 }, { 0x0000, 0x0120 }, { 0x0000, 0x0120 }, { 0x0000, 0x0120 },
+    { 0x0000, 0x0120 }, { 0x0000, 0x0120 }, { 0x0000, 0x0120 }, { 0x0000, 0x0120 },
+    { 0x0000, 0x0120 }, { 0x0000, 0x0120 }, { 0x0000, 0x0120 }, { 0x0000, 0x0120 },
+    { 0x0000, 0x0120 }, { 0x0000, 0x0120 }, { 0x0000, 0x0120 }, { 0x0000, 0x0120 },
+    { 0x0000, 0x0120 }, { 0x0000, 0x0120 }, { 0x0000, 0x0120 }, { 0x0000, 0x0120 },
+    { 0x0000, 0x0120 }, { 0x0000, 0x0120 }, { 0x0000, 0x0120 }, { 0x0000, 0x0120 },
+    { 0x0000, 0x0120 }, { 0x0000, 0x0120 }, { 0x0000, 0x0120 }, { 0x0000, 0x0120 },
+    { 0x0000, 0x0120 }, { 0x0000, 0x0120 }, { 0x0000, 0x0120 }, { 0x0000, 0x0120 },
+    { 0x0000, 0x0120 }, { 0x0000, 0x0120 }, { 0x0000, 0x0120 }, { 0x0000, 0x0120 },
+    { 0x0000, 0x0120 }, { 0x0000, 0x0120 }, { 0x0000, 0x0120 }, { 0x0000, 0x0120 },
+    { 0x0000, 0x0120 }, { 0x0000, 0x0120 }, { 0x0000, 0x0120 }, { 0x0000, 0x0120 },
+    { 0x0000, 0x0120 }, { 0x0000, 0x0120 }, { 0x0000, 0x0120 }, { 0x0000, 0x0120 },
+    { 0x0000, 0x0120 }, { 0x0000, 0x0120 }, { 0x0000, 0x0120 }, { 0x0000, 0x0120 },
+    { 0x0000, 0x0120 }, { 0x0000, 0x0120 }, { 0x0000, 0x0120 }, { 0x0000, 0x2a26 },
+    { 0x0000, 0x2a26 }, { 0x0000, 0x30a1 }, { 0x0000, 0x30aa }, { 0x0000, 0x30aa },
+    { 0x0000, 0x309d }, { 0x0000, 0x3196 }, { 0x0000, 0x318c }, { 0x0000, 0x313a },
+    { 0x0000, 0x313b }, { 0x0000, 0x313c }, { 0x0000, 0x313d }, { 0x0000, 0x313e },
+    { 0x0000, 0x3177 }, { 0x0000, 0x3178 }, { 0x0000, 0x3179 }, { 0x0000, 0x3154 },
+    { 0x0000, 0x318c }, { 0x0000, 0x3131 }, { 0x0000, 0x3132 }, { 0x0000, 0x3133 },
+    { 0x0000, 0x3134 }, { 0x0000, 0x3135 }, { 0x0000, 0x3135 }, { 0x0000, 0x3136 },
+    { 0x0000, 0x3137 }, { 0x0000, 0x3138 }, { 0x0000, 0x3139 }, { 0x0000, 0x313a },
+    { 0x0000, 0x313b }, { 0x0000, 0x313c }, { 0x0000, 0x313d }, { 0x0000, 0x313e },
+    { 0x0000, 0x313f }, { 0x0000, 0x3140 }, { 0x0000, 0x3142 }, { 0x0000, 0x3143 },
+    { 0x0000, 0x3144 }, { 0x0000, 0x3145 }, { 0x0000, 0x3145 }, { 0x0000, 0x3145 },
+    { 0x0000, 0x3145 }, { 0x0000, 0x3145 }, { 0x0000, 0x3145 }, { 0x0000, 0x3147 },
+    { 0x0000, 0x3149 }, { 0x0000, 0x314b }, { 0x0000, 0x314d }, { 0x0000, 0x314f },
+    { 0x0000, 0x314f }, { 0x0000, 0x314f }, { 0x0000, 0x314f }, { 0x0000, 0x314f },
+    { 0x0000, 0x3150 }, { 0x0000, 0x3151 }, { 0x0000, 0x3152 }, { 0x0000, 0x3152 },
+    { 0x0000, 0x3152 }, { 0x0000, 0x3152 }, { 0x0000, 0x3152 }, { 0x0000, 0x3152 },
+    { 0x0000, 0x3153 }, { 0x0000, 0x3156 }, { 0x0000, 0x30fb }, { 0x0000, 0x30fb },
+    { 0x0000, 0x31c4 }, { 0x0000, 0x3190 }, { 0x0000, 0x3190 }, { 0x0000, 0x3190 },
+    { 0x0000, 0x3190 }, { 0x0000, 0x3190 }, { 0x0000, 0x3190 }, { 0x0000, 0x3190 },
+    { 0x0000, 0x3190 }, { 0x0000, 0x3190 }, { 0x0000, 0x3190 }, { 0x0000, 0x3190 },
+    { 0x0000, 0x3190 }, { 0x0000, 0x3190 }, { 0x0000, 0x3190 }, { 0x0000, 0x3190 },
+    { 0x0000, 0x3190 }, { 0x0000, 0x3190 }, { 0x0000, 0x3190 }, { 0x0000, 0x3190 },
+    { 0x0000, 0x3190 }, { 0x0000, 0x3190 }, { 0x0000, 0x3190 }, { 0x0000, 0x3190 },
+    { 0x0000, 0x3190 }, { 0x0000, 0x3190 }, { 0x0000, 0x3190 }, { 0x0000, 0x3190 },
+    { 0x0000, 0x3190 }, { 0x0000, 0x3190 }, { 0x0000, 0x3190 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x318d }, { 0x0000, 0x318d },
+    { 0x0000, 0x318d }, { 0x0000, 0x318d }, { 0x0000, 0x318d }, { 0x0000, 0x318d },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x318b }, { 0x0000, 0x318b },
+    { 0x0000, 0x318b }, { 0x0000, 0x318b }, { 0x0000, 0x318b }, { 0x0000, 0x318b },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x3189 }, { 0x0000, 0x3189 },
+    { 0x0000, 0x3189 }, { 0x0000, 0x3189 }, { 0x0000, 0x3189 }, { 0x0000, 0x3189 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x3187 }, { 0x0000, 0x3187 },
+    { 0x0000, 0x3187 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x00c2 }, { 0x0000, 0x00c2 }, { 0x0000, 0x00ca }, { 0x0000, 0x00cc },
+    { 0x0000, 0x00c2 }, { 0x0000, 0x00c0 }, { 0x0000, 0x20c3 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x251a }, { 0x0000, 0x21a7 }, { 0x0000, 0x21a7 }, { 0x0000, 0x21a7 },
+    { 0x0000, 0x21a7 }, { 0x0000, 0x25b3 }, { 0x0000, 0x25dd }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+    { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 }, { 0x0000, 0x0000 },
+};
@@ -0,0 +1,74 @@
+/*
+ * Code page tables file format
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301, USA
+ */
+
+#ifndef __WINE_CPBLOB_H
+#define __WINE_CPBLOB_H
+
+#include "wine/unicode.h"
+
+/* With OTOWI_NLS_BLOB, the code page tables aren't built into the library
+ * but written by make_cpblob into a single file, which is mapped on first
+ * use. The file is a header, the sorted table entries, and the arrays they
+ * point to as offsets from the start of the file.
+ */
+
+#define CPBLOB_MAGIC    0x534c4e4f  /* "ONLS" */
+#define CPBLOB_VERSION  1
+#define CPBLOB_ALIGN    16
+
+struct cpblob_header
+{
+    unsigned int magic;
+    unsigned int version;
+    unsigned int count;     /* number of code pages */
+    unsigned int size;      /* size of the whole file */
+};
+
+struct cpblob_entry
+{
+    unsigned int   codepage;
+    unsigned int   char_size;
+    unsigned short def_char;
+    unsigned short def_unicode_char;
+    unsigned int   name;         /* offset of the name string */
+    unsigned int   cp2uni;
+    unsigned int   cp2uni_ext;   /* cp2uni_glyphs or cp2uni_leadbytes */
+    unsigned int   uni2cp_low;
+    unsigned int   uni2cp_high;
+    unsigned char  lead_bytes[12];
+};
+
+/* size of the Unicode -> code page low table, from the offsets in the high one */
+static inline unsigned int cpblob_uni2cp_low_count( const unsigned short *uni2cp_high )
+{
+    unsigned int i, max = 0;
+
+    for (i = 0; i < 256; i++) if (uni2cp_high[i] > max) max = uni2cp_high[i];
+    return max + 256;
+}
+
+/* size of the double-byte code page -> Unicode table, from the lead byte offsets */
+static inline unsigned int cpblob_dbcs_cp2uni_count( const unsigned char *cp2uni_leadbytes )
+{
+    unsigned int i, max = 0;
+
+    for (i = 0; i < 256; i++) if (cp2uni_leadbytes[i] > max) max = cp2uni_leadbytes[i];
+    return (max + 1) * 256;
+}
+
+#endif  /* __WINE_CPBLOB_H */
@@ -18,9 +18,37 @@
  * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301, USA
  */
 
+#include "config.h"
+
 #include <stdlib.h>
+#include <pthread.h>
+#ifdef OTOWI_NLS_BLOB
+# include <stdio.h>
+# include <string.h>
+# include <fcntl.h>
+# include <sys/stat.h>
+# ifdef HAVE_SYS_MMAN_H
+#  include <sys/mman.h>
+# endif
+# ifdef HAVE_UNISTD_H
+#  include <unistd.h>
+# endif
+#endif
 
 #include "wine/unicode.h"
+#include "cpblob.h"
+
+/* open addressing hash of the code page numbers, holding indices into cptables plus one */
+#define CPTABLE_HASH_BITS  8
+#define CPTABLE_HASH_SIZE  (1 << CPTABLE_HASH_BITS)
+
+static unsigned char cptable_hash[CPTABLE_HASH_SIZE];
+static pthread_once_t cptables_once = PTHREAD_ONCE_INIT;
+
+/* last table found by each thread, most callers stick to one code page */
+static __thread const union cptable *last_cptable __attribute__((tls_model("initial-exec")));
+
+#ifndef OTOWI_NLS_BLOB
 
 /* Everything below this line is generated automatically by make_unicode */
 /* ### cpmap begin ### */
@@ -177,27 +205,183 @@ static const union cptable * const cptables[72] =
 
 #define NB_CODEPAGES  (sizeof(cptables)/sizeof(cptables[0]))
 
+#else  /* OTOWI_NLS_BLOB */
+
+#ifndef OTOWI_NLS_PATH
+#define OTOWI_NLS_PATH "otowi.nls"
+#endif
+
+static const union cptable **cptables;
+static unsigned int nb_codepages;
+
+#define NB_CODEPAGES  nb_codepages
+
+/* check that an array of the tables file lies within it */
+static int check_range( unsigned int size, unsigned int offset, unsigned int len )
+{
+    return offset <= size && len <= size - offset && !(offset & 1);
+}
+
+/* build the tables from the file mapping, return 0 if it is corrupt */
+static int init_cptables( const unsigned char *base, unsigned int size )
+{
+    const struct cpblob_header *header = (const struct cpblob_header *)base;
+    const struct cpblob_entry *entry = (const struct cpblob_entry *)(header + 1);
+    union cptable *tables;
+    unsigned int i;
+
+    if (size < sizeof(*header) || header->magic != CPBLOB_MAGIC ||
+        header->version != CPBLOB_VERSION || header->size != size) return 0;
+    if (header->count > (size - sizeof(*header)) / sizeof(*entry)) return 0;
+    if (header->count > CPTABLE_HASH_SIZE / 2) return 0;
+
+    if (!(tables = calloc( header->count, sizeof(*tables) ))) return 0;
+    if (!(cptables = malloc( header->count * sizeof(*cptables) )))
+    {
+        free( tables );
+        return 0;
+    }
+
+    for (i = 0; i < header->count; i++, entry++)
+    {
+        union cptable *table = &tables[i];
+
+        if (entry->name >= size || !memchr( base + entry->name, 0, size - entry->name )) goto failed;
+        if (i && entry->codepage <= entry[-1].codepage) goto failed;  /* must stay sorted */
+        if (!check_range( size, entry->uni2cp_high, 256 * sizeof(unsigned short) )) goto failed;
+
+        table->info.codepage         = entry->codepage;
+        table->info.char_size        = entry->char_size;
+        table->info.def_char         = entry->def_char;
+        table->info.def_unicode_char = entry->def_unicode_char;
+        table->info.name             = (const char *)base + entry->name;
+
+        if (entry->char_size == 1)
+        {
+            struct sbcs_table *sbcs = &table->sbcs;
 
-static int cmp_codepage( const void *codepage, const void *entry )
+            sbcs->uni2cp_high = (const unsigned short *)(base + entry->uni2cp_high);
+            if (!check_range( size, entry->cp2uni, 256 * sizeof(WCHAR) ) ||
+                !check_range( size, entry->cp2uni_ext, 256 * sizeof(WCHAR) ) ||
+                entry->uni2cp_low > size ||
+                cpblob_uni2cp_low_count( sbcs->uni2cp_high ) > size - entry->uni2cp_low)
+                goto failed;
+            sbcs->cp2uni        = (const WCHAR *)(base + entry->cp2uni);
+            sbcs->cp2uni_glyphs = (const WCHAR *)(base + entry->cp2uni_ext);
+            sbcs->uni2cp_low    = base + entry->uni2cp_low;
+        }
+        else if (entry->char_size == 2)
+        {
+            struct dbcs_table *dbcs = &table->dbcs;
+
+            dbcs->uni2cp_high = (const unsigned short *)(base + entry->uni2cp_high);
+            if (!check_range( size, entry->cp2uni_ext, 256 )) goto failed;
+            dbcs->cp2uni_leadbytes = base + entry->cp2uni_ext;
+            if (!check_range( size, entry->cp2uni,
+                              cpblob_dbcs_cp2uni_count( dbcs->cp2uni_leadbytes ) * sizeof(WCHAR) ) ||
+                !check_range( size, entry->uni2cp_low,
+                              cpblob_uni2cp_low_count( dbcs->uni2cp_high ) * sizeof(unsigned short) ))
+                goto failed;
+            dbcs->cp2uni     = (const WCHAR *)(base + entry->cp2uni);
+            dbcs->uni2cp_low = (const unsigned short *)(base + entry->uni2cp_low);
+            memcpy( dbcs->lead_bytes, entry->lead_bytes, sizeof(dbcs->lead_bytes) );
+        }
+        else goto failed;
+
+        cptables[i] = table;
+    }
+    nb_codepages = header->count;
+    return 1;
+
+failed:
+    free( cptables );
+    free( tables );
+    cptables = NULL;
+    return 0;
+}
+
+/* map the tables file, shared with every other process using it */
+static int map_cptables(void)
 {
-    return *(const unsigned int *)codepage - (*(const union cptable *const *)entry)->info.codepage;
+    const char *path = getenv( "OTOWI_NLS" );
+    struct stat st;
+    void *base;
+    int fd;
+
+    if (!path || !*path) path = OTOWI_NLS_PATH;
+    if ((fd = open( path, O_RDONLY )) == -1)
+    {
+        fprintf( stderr, "otowi: cannot open code page tables %s\n", path );
+        return 0;
+    }
+    if (fstat( fd, &st ) == -1 || st.st_size < sizeof(struct cpblob_header) || st.st_size > 0x7fffffff ||
+        (base = mmap( NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0 )) == MAP_FAILED)
+    {
+        fprintf( stderr, "otowi: cannot map code page tables %s\n", path );
+        close( fd );
+        return 0;
+    }
+    close( fd );
+    if (!init_cptables( base, st.st_size ))
+    {
+        fprintf( stderr, "otowi: invalid code page tables %s\n", path );
+        munmap( base, st.st_size );
+        return 0;
+    }
+    return 1;
+}
+
+#endif  /* OTOWI_NLS_BLOB */
+
+
+static inline unsigned int hash_codepage( unsigned int codepage )
+{
+    return (codepage * 0x9e3779b1) >> (32 - CPTABLE_HASH_BITS);
+}
+
+static void init_cptables_once(void)
+{
+    unsigned int i, pos;
+
+#ifdef OTOWI_NLS_BLOB
+    if (!map_cptables()) return;
+#endif
+    for (i = 0; i < NB_CODEPAGES; i++)
+    {
+        pos = hash_codepage( cptables[i]->info.codepage );
+        while (cptable_hash[pos]) pos = (pos + 1) % CPTABLE_HASH_SIZE;
+        cptable_hash[pos] = i + 1;
+    }
+}
+
+static inline int load_cptables(void)
+{
+    pthread_once( &cptables_once, init_cptables_once );
+    return NB_CODEPAGES != 0;
 }
 
 
 /* get the table of a given code page */
 const union cptable *wine_cp_get_table( unsigned int codepage )
 {
-    const union cptable **res;
+    const union cptable *table = last_cptable;
+    unsigned int pos;
+
+    if (table && table->info.codepage == codepage) return table;
+    if (!load_cptables()) return NULL;
 
-    if (!(res = bsearch( &codepage, cptables, NB_CODEPAGES,
-                         sizeof(cptables[0]), cmp_codepage ))) return NULL;
-    return *res;
+    for (pos = hash_codepage( codepage ); cptable_hash[pos]; pos = (pos + 1) % CPTABLE_HASH_SIZE)
+    {
+        table = cptables[cptable_hash[pos] - 1];
+        if (table->info.codepage == codepage) return last_cptable = table;
+    }
+    return NULL;
 }
 
 
 /* enum valid codepages */
 const union cptable *wine_cp_enum_table( unsigned int index )
 {
-    if (index >= NB_CODEPAGES) return NULL;
+    if (!load_cptables() || index >= NB_CODEPAGES) return NULL;
     return cptables[index];
 }
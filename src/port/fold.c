@@ -20,16 +20,17 @@
 
 #include "wine/unicode.h"
 
+extern const unsigned char wine_char_fold_index[] DECLSPEC_HIDDEN;
+extern const WCHAR wine_char_fold_table[][2] DECLSPEC_HIDDEN;
+
 static inline WCHAR to_unicode_digit( WCHAR ch )
 {
-    extern const WCHAR wine_digitmap[] DECLSPEC_HIDDEN;
-    return ch + wine_digitmap[wine_digitmap[ch >> 8] + (ch & 0xff)];
+    return ch + wine_char_fold_table[(wine_char_fold_index[ch >> 8] << 8) + (ch & 0xff)][0];
 }
 
 static inline WCHAR to_unicode_native( WCHAR ch )
 {
-    extern const WCHAR wine_compatmap[] DECLSPEC_HIDDEN;
-    return ch + wine_compatmap[wine_compatmap[ch >> 8] + (ch & 0xff)];
+    return ch + wine_char_fold_table[(wine_char_fold_index[ch >> 8] << 8) + (ch & 0xff)][1];
 }
 
 static const WCHAR wine_ligatures[] =
@@ -22,6 +22,8 @@
 
 #include "wine/unicode.h"
 
+#include "simd.h"
+
 extern unsigned int wine_decompose( WCHAR ch, WCHAR *dst, unsigned int dstlen ) DECLSPEC_HIDDEN;
 
 /* check the code whether it is in Unicode Private Use Area (PUA). */
@@ -31,6 +33,262 @@ static inline int is_private_use_area_char(WCHAR code)
     return (code >= 0xe000 && code <= 0xf8ff);
 }
 
+/* Vector kernels for single-byte code pages
+ *
+ * A vector can't index a 256-entry table, but most code pages map whole
+ * blocks of 16 bytes to consecutive chars: ASCII, the Cyrillic letters of
+ * 1251 and 866, the Latin-1 half of 1252... In such a block the char is the
+ * byte plus a delta that only depends on the block, which a 16-entry
+ * shuffle on the high nibble finds. Vectors touching any other block are
+ * left to the scalar code.
+ */
+
+/* below this, looking up the block masks costs more than it saves */
+#define SBCS_VECTOR_MIN 64
+
+struct sbcs_blocks
+{
+    unsigned char linear[16];    /* 0xff if the block maps to consecutive chars */
+    unsigned char valid[16];     /* 0xff if the block has no invalid char */
+    unsigned char delta_lo[16];  /* char minus byte for linear blocks, low byte */
+    unsigned char delta_hi[16];  /* char minus byte for linear blocks, high byte */
+    int           ascii;         /* ASCII maps to itself */
+    int           any;           /* there is at least one linear block */
+};
+
+struct sbcs_funcs
+{
+    /* convert the leading vectors of src that are in linear blocks, return their size */
+    unsigned int (*mbstowcs)( const struct sbcs_blocks *blocks, const unsigned char *src,
+                              unsigned int srclen, WCHAR *dst );
+    /* return the size of the leading vectors of src that are in valid blocks */
+    unsigned int (*check)( const struct sbcs_blocks *blocks, const unsigned char *src,
+                           unsigned int srclen );
+};
+
+static inline int is_invalid_char_sbcs( const WCHAR *cp2uni, WCHAR def_unicode_char,
+                                        unsigned char def_char, unsigned char ch )
+{
+    return (cp2uni[ch] == def_unicode_char && ch != def_char) || is_private_use_area_char(cp2uni[ch]);
+}
+
+static void fill_sbcs_blocks( const struct sbcs_table *table, const WCHAR *cp2uni,
+                              struct sbcs_blocks *blocks )
+{
+    const WCHAR def_unicode_char = table->info.def_unicode_char;
+    const unsigned char def_char = table->uni2cp_low[table->uni2cp_high[def_unicode_char >> 8]
+                                                     + (def_unicode_char & 0xff)];
+    unsigned int i, j;
+
+    blocks->any = 0;
+    for (i = 0; i < 16; i++)
+    {
+        const WCHAR *block = cp2uni + i * 16;
+        WCHAR delta = block[0] - i * 16;
+
+        for (j = 1; j < 16; j++) if (block[j] != block[0] + j) break;
+        blocks->linear[i] = (j == 16) ? 0xff : 0;
+        blocks->delta_lo[i] = delta & 0xff;
+        blocks->delta_hi[i] = delta >> 8;
+        blocks->any |= blocks->linear[i];
+
+        for (j = 0; j < 16; j++)
+            if (is_invalid_char_sbcs( cp2uni, def_unicode_char, def_char, i * 16 + j )) break;
+        blocks->valid[i] = (j == 16) ? 0xff : 0;
+    }
+    for (i = 0; i < 8; i++) if (!blocks->linear[i] || blocks->delta_lo[i] || blocks->delta_hi[i]) break;
+    blocks->ascii = (i == 8);
+}
+
+/* the blocks of cp2uni, then those of cp2uni_glyphs */
+static void init_sbcs_blocks( const void *table, void *data )
+{
+    const struct sbcs_table *sbcs = table;
+    struct sbcs_blocks *blocks = data;
+
+    fill_sbcs_blocks( sbcs, sbcs->cp2uni, &blocks[0] );
+    fill_sbcs_blocks( sbcs, sbcs->cp2uni_glyphs, &blocks[1] );
+}
+
+/* get the blocks of the table for the given flags, NULL if out of memory */
+static const struct sbcs_blocks *get_sbcs_blocks( const struct sbcs_table *table, int flags )
+{
+    static struct simd_cache_entry *cache[SIMD_CACHE_SIZE];
+    const struct sbcs_blocks *blocks = simd_get_table_data( cache, table, 2 * sizeof(*blocks),
+                                                            init_sbcs_blocks );
+
+    if (!blocks) return NULL;
+    return (flags & MB_USEGLYPHCHARS) ? &blocks[1] : &blocks[0];
+}
+
+static const struct sbcs_funcs sbcs_funcs_scalar = { NULL, NULL };
+
+#ifdef SIMD_USE_X86
+
+static unsigned int __attribute__((target("ssse3"))) mbstowcs_sbcs_ssse3( const struct sbcs_blocks *blocks,
+                                                                          const unsigned char *src,
+                                                                          unsigned int srclen, WCHAR *dst )
+{
+    const __m128i linear = _mm_loadu_si128( (const __m128i *)blocks->linear );
+    const __m128i delta_lo = _mm_loadu_si128( (const __m128i *)blocks->delta_lo );
+    const __m128i delta_hi = _mm_loadu_si128( (const __m128i *)blocks->delta_hi );
+    const __m128i zero = _mm_setzero_si128();
+    unsigned int pos;
+
+    for (pos = 0; pos + 16 <= srclen; pos += 16)
+    {
+        __m128i v = _mm_loadu_si128( (const __m128i *)(src + pos) );
+        __m128i block, lo, hi;
+
+        if (blocks->ascii && !_mm_movemask_epi8( v ))
+        {
+            _mm_storeu_si128( (__m128i *)(dst + pos), _mm_unpacklo_epi8( v, zero ));
+            _mm_storeu_si128( (__m128i *)(dst + pos + 8), _mm_unpackhi_epi8( v, zero ));
+            continue;
+        }
+        block = _mm_and_si128( _mm_srli_epi16( v, 4 ), _mm_set1_epi8( 0x0f ));
+        if (_mm_movemask_epi8( _mm_shuffle_epi8( linear, block )) != 0xffff) break;
+        lo = _mm_shuffle_epi8( delta_lo, block );
+        hi = _mm_shuffle_epi8( delta_hi, block );
+        _mm_storeu_si128( (__m128i *)(dst + pos),
+                          _mm_add_epi16( _mm_unpacklo_epi8( v, zero ), _mm_unpacklo_epi8( lo, hi )));
+        _mm_storeu_si128( (__m128i *)(dst + pos + 8),
+                          _mm_add_epi16( _mm_unpackhi_epi8( v, zero ), _mm_unpackhi_epi8( lo, hi )));
+    }
+    return pos;
+}
+
+static unsigned int __attribute__((target("ssse3"))) check_sbcs_ssse3( const struct sbcs_blocks *blocks,
+                                                                       const unsigned char *src,
+                                                                       unsigned int srclen )
+{
+    const __m128i valid = _mm_loadu_si128( (const __m128i *)blocks->valid );
+    unsigned int pos;
+
+    for (pos = 0; pos + 16 <= srclen; pos += 16)
+    {
+        __m128i v = _mm_loadu_si128( (const __m128i *)(src + pos) );
+        __m128i block = _mm_and_si128( _mm_srli_epi16( v, 4 ), _mm_set1_epi8( 0x0f ));
+
+        if (_mm_movemask_epi8( _mm_shuffle_epi8( valid, block )) != 0xffff) break;
+    }
+    return pos;
+}
+
+static unsigned int __attribute__((target("avx2"))) mbstowcs_sbcs_avx2( const struct sbcs_blocks *blocks,
+                                                                        const unsigned char *src,
+                                                                        unsigned int srclen, WCHAR *dst )
+{
+    const __m256i linear = _mm256_broadcastsi128_si256( _mm_loadu_si128( (const __m128i *)blocks->linear ));
+    const __m256i delta_lo = _mm256_broadcastsi128_si256( _mm_loadu_si128( (const __m128i *)blocks->delta_lo ));
+    const __m256i delta_hi = _mm256_broadcastsi128_si256( _mm_loadu_si128( (const __m128i *)blocks->delta_hi ));
+    const __m256i zero = _mm256_setzero_si256();
+    unsigned int pos;
+
+    for (pos = 0; pos + 32 <= srclen; pos += 32)
+    {
+        __m256i v = _mm256_loadu_si256( (const __m256i *)(src + pos) );
+        __m256i block, lo, hi, res_lo, res_hi;
+
+        if (blocks->ascii && !_mm256_movemask_epi8( v ))
+        {
+            _mm256_storeu_si256( (__m256i *)(dst + pos), _mm256_cvtepu8_epi16( _mm256_castsi256_si128( v )));
+            _mm256_storeu_si256( (__m256i *)(dst + pos + 16), _mm256_cvtepu8_epi16( _mm256_extracti128_si256( v, 1 )));
+            continue;
+        }
+        block = _mm256_and_si256( _mm256_srli_epi16( v, 4 ), _mm256_set1_epi8( 0x0f ));
+        if (_mm256_movemask_epi8( _mm256_shuffle_epi8( linear, block )) != -1) break;
+        lo = _mm256_shuffle_epi8( delta_lo, block );
+        hi = _mm256_shuffle_epi8( delta_hi, block );
+        /* unpacking works within 128-bit lanes, put the quarters back in order */
+        res_lo = _mm256_add_epi16( _mm256_unpacklo_epi8( v, zero ), _mm256_unpacklo_epi8( lo, hi ));
+        res_hi = _mm256_add_epi16( _mm256_unpackhi_epi8( v, zero ), _mm256_unpackhi_epi8( lo, hi ));
+        _mm256_storeu_si256( (__m256i *)(dst + pos), _mm256_permute2x128_si256( res_lo, res_hi, 0x20 ));
+        _mm256_storeu_si256( (__m256i *)(dst + pos + 16), _mm256_permute2x128_si256( res_lo, res_hi, 0x31 ));
+    }
+    return pos;
+}
+
+static unsigned int __attribute__((target("avx2"))) check_sbcs_avx2( const struct sbcs_blocks *blocks,
+                                                                     const unsigned char *src,
+                                                                     unsigned int srclen )
+{
+    const __m256i valid = _mm256_broadcastsi128_si256( _mm_loadu_si128( (const __m128i *)blocks->valid ));
+    unsigned int pos;
+
+    for (pos = 0; pos + 32 <= srclen; pos += 32)
+    {
+        __m256i v = _mm256_loadu_si256( (const __m256i *)(src + pos) );
+        __m256i block = _mm256_and_si256( _mm256_srli_epi16( v, 4 ), _mm256_set1_epi8( 0x0f ));
+
+        if (_mm256_movemask_epi8( _mm256_shuffle_epi8( valid, block )) != -1) break;
+    }
+    return pos;
+}
+
+static const struct sbcs_funcs sbcs_funcs_ssse3 = { mbstowcs_sbcs_ssse3, check_sbcs_ssse3 };
+static const struct sbcs_funcs sbcs_funcs_avx2 = { mbstowcs_sbcs_avx2, check_sbcs_avx2 };
+
+#endif  /* SIMD_USE_X86 */
+
+#ifdef SIMD_USE_NEON
+
+static unsigned int mbstowcs_sbcs_neon( const struct sbcs_blocks *blocks, const unsigned char *src,
+                                        unsigned int srclen, WCHAR *dst )
+{
+    const uint8x16_t linear = vld1q_u8( blocks->linear );
+    const uint8x16_t delta_lo = vld1q_u8( blocks->delta_lo );
+    const uint8x16_t delta_hi = vld1q_u8( blocks->delta_hi );
+    unsigned int pos;
+
+    for (pos = 0; pos + 16 <= srclen; pos += 16)
+    {
+        uint8x16_t v = vld1q_u8( src + pos );
+        uint8x16_t block, lo, hi;
+
+        if (blocks->ascii && vmaxvq_u8( v ) < 0x80)
+        {
+            vst1q_u16( dst + pos, vmovl_u8( vget_low_u8( v )));
+            vst1q_u16( dst + pos + 8, vmovl_high_u8( v ));
+            continue;
+        }
+        block = vshrq_n_u8( v, 4 );
+        if (vminvq_u8( vqtbl1q_u8( linear, block )) != 0xff) break;
+        lo = vqtbl1q_u8( delta_lo, block );
+        hi = vqtbl1q_u8( delta_hi, block );
+        vst1q_u16( dst + pos, vaddq_u16( vmovl_u8( vget_low_u8( v )),
+                                         vreinterpretq_u16_u8( vzip1q_u8( lo, hi ))));
+        vst1q_u16( dst + pos + 8, vaddq_u16( vmovl_high_u8( v ),
+                                             vreinterpretq_u16_u8( vzip2q_u8( lo, hi ))));
+    }
+    return pos;
+}
+
+static unsigned int check_sbcs_neon( const struct sbcs_blocks *blocks, const unsigned char *src,
+                                     unsigned int srclen )
+{
+    const uint8x16_t valid = vld1q_u8( blocks->valid );
+    unsigned int pos;
+
+    for (pos = 0; pos + 16 <= srclen; pos += 16)
+        if (vminvq_u8( vqtbl1q_u8( valid, vshrq_n_u8( vld1q_u8( src + pos ), 4 ))) != 0xff) break;
+    return pos;
+}
+
+static const struct sbcs_funcs sbcs_funcs_neon = { mbstowcs_sbcs_neon, check_sbcs_neon };
+
+#endif  /* SIMD_USE_NEON */
+
+/* pick the kernels for the cpu we are running on */
+static const struct sbcs_funcs *get_sbcs_funcs(void)
+{
+    static const void * const sets[SIMD_LEVELS] = SIMD_FUNCS( &sbcs_funcs_scalar, NULL, &sbcs_funcs_ssse3,
+                                                              &sbcs_funcs_avx2, &sbcs_funcs_neon );
+    static const void *funcs;
+
+    return simd_get_funcs( &funcs, sets );
+}
+
 /* check src string for invalid chars; return non-zero if invalid char found */
 static inline int check_invalid_chars_sbcs( const struct sbcs_table *table, int flags,
                                             const unsigned char *src, unsigned int srclen )
@@ -39,10 +297,32 @@ static inline int check_invalid_chars_sbcs( const struct sbcs_table *table, int
     const WCHAR def_unicode_char = table->info.def_unicode_char;
     const unsigned char def_char = table->uni2cp_low[table->uni2cp_high[def_unicode_char >> 8]
                                                      + (def_unicode_char & 0xff)];
+    const struct sbcs_funcs *funcs = get_sbcs_funcs();
+    const struct sbcs_blocks *blocks;
+    unsigned int i;
+
+    if (srclen >= SBCS_VECTOR_MIN && funcs->check && (blocks = get_sbcs_blocks( table, flags )))
+    {
+        unsigned int done, run = 16;
+
+        for (;;)
+        {
+            done = funcs->check( blocks, src, srclen );
+            src += done;
+            srclen -= done;
+            /* check the chars from blocks that have invalid ones */
+            run = done ? 16 : run * 2;
+            if (run > 256 || srclen < run) break;  /* give up when vectors keep failing */
+            for (i = 0; i < run; i++)
+                if (is_invalid_char_sbcs( cp2uni, def_unicode_char, def_char, src[i] )) return srclen - i;
+            src += run;
+            srclen -= run;
+        }
+    }
+
     while (srclen)
     {
-        if ((cp2uni[*src] == def_unicode_char && *src != def_char) ||
-            is_private_use_area_char(cp2uni[*src])) break;
+        if (is_invalid_char_sbcs( cp2uni, def_unicode_char, def_char, *src )) break;
         src++;
         srclen--;
     }
@@ -56,6 +336,8 @@ static inline int mbstowcs_sbcs( const struct sbcs_table *table, int flags,
                                  WCHAR *dst, unsigned int dstlen )
 {
     const WCHAR * const cp2uni = (flags & MB_USEGLYPHCHARS) ? table->cp2uni_glyphs : table->cp2uni;
+    const struct sbcs_funcs *funcs = get_sbcs_funcs();
+    const struct sbcs_blocks *blocks;
     int ret = srclen;
 
     if (dstlen < srclen)
@@ -65,6 +347,26 @@ static inline int mbstowcs_sbcs( const struct sbcs_table *table, int flags,
         ret = -1;
     }
 
+    if (srclen >= SBCS_VECTOR_MIN && funcs->mbstowcs && (blocks = get_sbcs_blocks( table, flags )))
+    {
+        unsigned int done, i, run = 16;
+
+        while (blocks->any)
+        {
+            done = funcs->mbstowcs( blocks, src, srclen, dst );
+            src += done;
+            dst += done;
+            srclen -= done;
+            /* convert the chars from other blocks */
+            run = done ? 16 : run * 2;
+            if (run > 256 || srclen < run) break;  /* give up when vectors keep failing */
+            for (i = 0; i < run; i++) dst[i] = cp2uni[src[i]];
+            src += run;
+            dst += run;
+            srclen -= run;
+        }
+    }
+
     for (;;)
     {
         switch(srclen)
@@ -140,6 +442,13 @@ static inline int get_length_dbcs( const struct dbcs_table *table,
     return len;
 }
 
+/* check whether a byte that isn't a lead byte is an invalid char */
+static inline int is_invalid_char_dbcs( const WCHAR *cp2uni, WCHAR def_unicode_char,
+                                        unsigned short def_char, unsigned char ch )
+{
+    return (cp2uni[ch] == def_unicode_char && ch != def_char) || is_private_use_area_char(cp2uni[ch]);
+}
+
 /* check src string for invalid chars; return non-zero if invalid char found */
 static inline int check_invalid_chars_dbcs( const struct dbcs_table *table,
                                             const unsigned char *src, unsigned int srclen )
@@ -160,8 +469,7 @@ static inline int check_invalid_chars_dbcs( const struct dbcs_table *table,
             src++;
             srclen--;
         }
-        else if ((cp2uni[*src] == def_unicode_char && *src != def_char) ||
-                 is_private_use_area_char(cp2uni[*src])) break;
+        else if (is_invalid_char_dbcs( cp2uni, def_unicode_char, def_char, *src )) break;
         src++;
         srclen--;
     }
@@ -196,6 +504,190 @@ static inline int mbstowcs_dbcs( const struct dbcs_table *table,
 }
 
 
+/* Vector kernels for double-byte code pages
+ *
+ * The lead bytes of the double-byte code pages are all above 0x7f, so from
+ * a char boundary a run of ASCII bytes is a run of single-byte chars, which
+ * vectors widen (or count) when ASCII maps to itself. The rest goes through
+ * a scalar loop. MB_ERR_INVALID_CHARS must leave dst alone when there is an
+ * invalid char, so the check is done while counting the chars, using a
+ * 256-bit bitmap of the invalid single bytes, and the conversion follows.
+ */
+
+/* below this, looking up the bitmap costs more than it saves */
+#define DBCS_VECTOR_MIN 64
+
+struct dbcs_map
+{
+    unsigned int invalid[8];  /* single bytes that are invalid chars, if checking */
+    int          ascii;       /* ASCII runs can be left to the vectors */
+};
+
+static void fill_dbcs_map( const struct dbcs_table *table, int check, struct dbcs_map *map )
+{
+    const WCHAR * const cp2uni = table->cp2uni;
+    const WCHAR def_unicode_char = table->info.def_unicode_char;
+    const unsigned short def_char = table->uni2cp_low[table->uni2cp_high[def_unicode_char >> 8]
+                                                      + (def_unicode_char & 0xff)];
+    unsigned int i;
+
+    memset( map->invalid, 0, sizeof(map->invalid) );
+    map->ascii = 1;
+    for (i = 0; i < 256; i++)
+    {
+        if (table->cp2uni_leadbytes[i])
+        {
+            if (i < 0x80) map->ascii = 0;
+        }
+        else if (check && is_invalid_char_dbcs( cp2uni, def_unicode_char, def_char, i ))
+            map->invalid[i / 32] |= 1u << (i % 32);
+    }
+    if (map->invalid[0] | map->invalid[1] | map->invalid[2] | map->invalid[3]) map->ascii = 0;
+    for (i = 0; i < 0x80 && map->ascii; i++) if (cp2uni[i] != i) map->ascii = 0;
+}
+
+/* the map without checking, then the one with checking */
+static void init_dbcs_maps( const void *table, void *data )
+{
+    struct dbcs_map *maps = data;
+
+    fill_dbcs_map( table, 0, &maps[0] );
+    fill_dbcs_map( table, 1, &maps[1] );
+}
+
+/* get the map of the table, NULL if out of memory */
+static const struct dbcs_map *get_dbcs_map( const struct dbcs_table *table, int check )
+{
+    static struct simd_cache_entry *cache[SIMD_CACHE_SIZE];
+    const struct dbcs_map *maps = simd_get_table_data( cache, table, 2 * sizeof(*maps), init_dbcs_maps );
+
+    if (!maps) return NULL;
+    return &maps[check ? 1 : 0];
+}
+
+/* mbstowcs for double-byte code page, leaving ASCII runs to the vectors */
+/* all lengths are in characters, not bytes */
+static int mbstowcs_dbcs_vector( const struct dbcs_table *table, const unsigned char *src,
+                                 unsigned int srclen, WCHAR *dst, unsigned int dstlen )
+{
+    const WCHAR * const cp2uni = table->cp2uni;
+    const unsigned char * const cp2uni_lb = table->cp2uni_leadbytes;
+    const struct ascii_funcs *funcs = get_ascii_funcs();
+    const struct dbcs_map *map = get_dbcs_map( table, 0 );
+    const unsigned char * const end = src + srclen;
+    const unsigned char *retry;
+    WCHAR * const start = dst, * const dst_end = dst + dstlen;
+    unsigned int done;
+
+    if (!map) return mbstowcs_dbcs( table, src, srclen, dst, dstlen );
+    retry = (map->ascii && funcs->mbstowcs) ? src : end;
+
+    while (src < end)
+    {
+        unsigned char ch = *src, off = cp2uni_lb[ch];
+
+        if (dst == dst_end) return -1;  /* overflow */
+        if (!off)
+        {
+            if (ch < 0x80 && src >= retry && end - src >= 16 && !((src[1] | src[2] | src[3]) & 0x80))
+            {
+                /* leave the ASCII run to the vectors, and the rest of a vector they stopped at to us */
+                done = funcs->mbstowcs( src, min( end - src, dst_end - dst ), dst );
+                src += done;
+                dst += done;
+                retry = src + 16;
+                continue;
+            }
+            *dst++ = cp2uni[ch];
+            src++;
+        }
+        else if (src + 1 < end && src[1])
+        {
+            *dst++ = cp2uni[(off << 8) + src[1]];
+            src += 2;
+        }
+        else *dst++ = cp2uni[*src++];  /* partial char, or a null trail byte */
+    }
+    return dst - start;
+}
+
+/* query necessary dst length for src string, checking for invalid chars in the same pass if requested */
+static FORCEINLINE int get_length_dbcs_fused( const struct dbcs_table *table, int check,
+                                               const unsigned char *src, unsigned int srclen )
+{
+    const WCHAR * const cp2uni = table->cp2uni;
+    const unsigned char * const cp2uni_lb = table->cp2uni_leadbytes;
+    const WCHAR def_unicode_char = table->info.def_unicode_char;
+    const unsigned short def_char = table->uni2cp_low[table->uni2cp_high[def_unicode_char >> 8]
+                                                      + (def_unicode_char & 0xff)];
+    const struct ascii_funcs *funcs = get_ascii_funcs();
+    const struct dbcs_map *map = get_dbcs_map( table, check );
+    const unsigned char * const end = src + srclen;
+    const unsigned char *retry;
+    unsigned int done;
+    int len = 0;
+
+    if (!map)
+    {
+        if (check && check_invalid_chars_dbcs( table, src, srclen )) return -2;
+        return get_length_dbcs( table, src, srclen );
+    }
+    retry = (map->ascii && funcs->mbstowcs) ? src : end;
+
+    while (src < end)
+    {
+        unsigned char ch = *src, off = cp2uni_lb[ch];
+
+        if (!off)
+        {
+            if (ch < 0x80 && src >= retry && end - src >= 16 && !((src[1] | src[2] | src[3]) & 0x80))
+            {
+                done = funcs->mbstowcs( src, end - src, NULL );
+                src += done;
+                len += done;
+                retry = src + 16;
+                continue;
+            }
+            if (map->invalid[ch / 32] & (1u << (ch % 32))) return -2;
+            src++;
+            len++;
+        }
+        else if (src + 1 < end && src[1])
+        {
+            if (check && cp2uni[(off << 8) + src[1]] == def_unicode_char &&
+                ((ch << 8) | src[1]) != def_char) return -2;
+            src += 2;
+            len++;
+        }
+        else
+        {
+            if (check && (src + 1 == end || (cp2uni[off << 8] == def_unicode_char &&
+                                             (ch << 8) != def_char))) return -2;
+            src++;
+            len++;
+        }
+    }
+    return len;
+}
+
+/* the fused loop is inlined for both cases, so that it doesn't test the flag on every char */
+static int mbstowcs_dbcs_check( const struct dbcs_table *table, const unsigned char *src,
+                                unsigned int srclen, WCHAR *dst, unsigned int dstlen )
+{
+    int ret = get_length_dbcs_fused( table, 1, src, srclen );
+
+    if (ret < 0 || !dstlen) return ret;
+    return mbstowcs_dbcs_vector( table, src, srclen, dst, dstlen );
+}
+
+static int mbstowcs_dbcs_nocheck( const struct dbcs_table *table, const unsigned char *src,
+                                  unsigned int srclen, WCHAR *dst, unsigned int dstlen )
+{
+    if (!dstlen) return get_length_dbcs_fused( table, 0, src, srclen );
+    return mbstowcs_dbcs_vector( table, src, srclen, dst, dstlen );
+}
+
+
 /* mbstowcs for double-byte code page with character decomposition */
 static int mbstowcs_dbcs_decompose( const struct dbcs_table *table,
                                     const unsigned char *src, unsigned int srclen,
@@ -265,6 +757,12 @@ int wine_cp_mbstowcs( const union cptable *table, int flags,
     }
     else /* mbcs */
     {
+        if (srclen >= DBCS_VECTOR_MIN && !(flags & MB_COMPOSITE))
+        {
+            if (flags & MB_ERR_INVALID_CHARS)
+                return mbstowcs_dbcs_check( &table->dbcs, src, srclen, dst, dstlen );
+            return mbstowcs_dbcs_nocheck( &table->dbcs, src, srclen, dst, dstlen );
+        }
         if (flags & MB_ERR_INVALID_CHARS)
         {
             if (check_invalid_chars_dbcs( &table->dbcs, src, srclen )) return -2;
@@ -0,0 +1,287 @@
+/*
+ * Vector kernel dispatch for the string and code page routines
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301, USA
+ */
+
+#ifndef __WINE_SIMD_H
+#define __WINE_SIMD_H
+
+#include <stdlib.h>
+
+#include "wine/unicode.h"
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+# include <immintrin.h>
+# define SIMD_USE_X86
+#elif defined(__GNUC__) && defined(__aarch64__)
+# include <arm_neon.h>
+# define SIMD_USE_NEON
+#endif
+
+/* A family of kernels comes as one struct of function pointers per
+ * instruction set, the one for SIMD_SCALAR having NULL pointers. The
+ * structs are listed with SIMD_FUNCS, which drops the ones of the other
+ * architectures, and simd_get_funcs() picks the best one the cpu supports.
+ */
+
+enum simd_level
+{
+    SIMD_SCALAR,
+    SIMD_SSE2,
+    SIMD_SSSE3,
+    SIMD_AVX2,
+    SIMD_NEON,
+    SIMD_LEVELS
+};
+
+#if defined(SIMD_USE_X86)
+# define SIMD_FUNCS(scalar,sse2,ssse3,avx2,neon) { scalar, sse2, ssse3, avx2, NULL }
+#elif defined(SIMD_USE_NEON)
+# define SIMD_FUNCS(scalar,sse2,ssse3,avx2,neon) { scalar, NULL, NULL, NULL, neon }
+#else
+# define SIMD_FUNCS(scalar,sse2,ssse3,avx2,neon) { scalar, NULL, NULL, NULL, NULL }
+#endif
+
+static inline enum simd_level simd_get_level(void)
+{
+#ifdef SIMD_USE_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports( "avx2" )) return SIMD_AVX2;
+    if (__builtin_cpu_supports( "ssse3" )) return SIMD_SSSE3;
+    if (__builtin_cpu_supports( "sse2" )) return SIMD_SSE2;
+#elif defined(SIMD_USE_NEON)
+    return SIMD_NEON;  /* always there on aarch64 */
+#endif
+    return SIMD_SCALAR;
+}
+
+/* return the best of the kernel sets for the cpu we are running on, cached in *funcs */
+static inline const void *simd_get_funcs( const void **funcs, const void * const sets[SIMD_LEVELS] )
+{
+    const void *ret = *funcs;
+    int level;
+
+    if (ret) return ret;
+    for (level = simd_get_level(); !sets[level]; level--) ;
+    return *funcs = sets[level];
+}
+
+
+/* Data the kernels derive from a code page table, looked up by the table
+ * pointer. It is computed on first use, and since the tables live as long
+ * as the process the entries are never freed.
+ */
+
+#define SIMD_CACHE_BITS 8  /* room for every table of the code pages */
+#define SIMD_CACHE_SIZE (1 << SIMD_CACHE_BITS)
+
+struct simd_cache_entry
+{
+    const void *table;
+    /* followed by the data */
+};
+
+/* return the data of table in cache, calling init to compute it; NULL if out of memory */
+static inline const void *simd_get_table_data( struct simd_cache_entry **cache, const void *table, size_t size,
+                                               void (*init)( const void *table, void *data ) )
+{
+    struct simd_cache_entry *entry, *new_entry = NULL;
+    unsigned int i, pos = ((unsigned int)((unsigned long)table >> 4) * 0x9e3779b1) >> (32 - SIMD_CACHE_BITS);
+
+    for (i = 0; i < SIMD_CACHE_SIZE; i++, pos = (pos + 1) % SIMD_CACHE_SIZE)
+    {
+        if (!(entry = __atomic_load_n( &cache[pos], __ATOMIC_ACQUIRE )))
+        {
+            if (!new_entry)
+            {
+                if (!(new_entry = malloc( sizeof(*new_entry) + size ))) return NULL;
+                new_entry->table = table;
+                init( table, new_entry + 1 );
+            }
+            /* another thread may have taken the slot meanwhile, for this table or another one */
+            if (!(entry = __sync_val_compare_and_swap( &cache[pos], NULL, new_entry ))) return new_entry + 1;
+        }
+        if (entry->table == table)
+        {
+            free( new_entry );
+            return entry + 1;
+        }
+    }
+    free( new_entry );
+    return NULL;
+}
+
+
+/* Kernels for runs of 7-bit ASCII, shared by the code page and UTF-8
+ * conversions. They stop at the first char that isn't ASCII.
+ */
+
+struct ascii_funcs
+{
+    /* widen the leading ASCII chars of src to dst (if not NULL), return their count */
+    unsigned int (*mbstowcs)( const unsigned char *src, unsigned int srclen, WCHAR *dst );
+    /* narrow the leading ASCII chars of src to dst (if not NULL), return their count */
+    unsigned int (*wcstombs)( const WCHAR *src, unsigned int srclen, char *dst );
+};
+
+/* finish a vector with a char that isn't ASCII by converting its leading ASCII chars */
+static inline unsigned int ascii_mbstowcs_prefix( const unsigned char *src, unsigned int len, WCHAR *dst )
+{
+    unsigned int i;
+
+    for (i = 0; i < len && src[i] < 0x80; i++) if (dst) dst[i] = src[i];
+    return i;
+}
+
+static inline unsigned int ascii_wcstombs_prefix( const WCHAR *src, unsigned int len, char *dst )
+{
+    unsigned int i;
+
+    for (i = 0; i < len && src[i] < 0x80; i++) if (dst) dst[i] = src[i];
+    return i;
+}
+
+#ifdef SIMD_USE_X86
+
+static inline unsigned int __attribute__((target("sse2"))) ascii_mbstowcs_sse2( const unsigned char *src,
+                                                                                unsigned int srclen, WCHAR *dst )
+{
+    const __m128i zero = _mm_setzero_si128();
+    unsigned int pos;
+
+    for (pos = 0; pos + 16 <= srclen; pos += 16)
+    {
+        __m128i v = _mm_loadu_si128( (const __m128i *)(src + pos) );
+
+        if (_mm_movemask_epi8( v )) return pos + ascii_mbstowcs_prefix( src + pos, 16, dst ? dst + pos : NULL );
+        if (!dst) continue;
+        _mm_storeu_si128( (__m128i *)(dst + pos), _mm_unpacklo_epi8( v, zero ));
+        _mm_storeu_si128( (__m128i *)(dst + pos + 8), _mm_unpackhi_epi8( v, zero ));
+    }
+    return pos;
+}
+
+static inline unsigned int __attribute__((target("sse2"))) ascii_wcstombs_sse2( const WCHAR *src,
+                                                                                unsigned int srclen, char *dst )
+{
+    const __m128i high = _mm_set1_epi16( (short)0xff80 );
+    const __m128i zero = _mm_setzero_si128();
+    unsigned int pos;
+
+    for (pos = 0; pos + 16 <= srclen; pos += 16)
+    {
+        __m128i lo = _mm_loadu_si128( (const __m128i *)(src + pos) );
+        __m128i hi = _mm_loadu_si128( (const __m128i *)(src + pos + 8) );
+
+        if (_mm_movemask_epi8( _mm_cmpeq_epi16( _mm_and_si128( _mm_or_si128( lo, hi ), high ), zero )) != 0xffff)
+            return pos + ascii_wcstombs_prefix( src + pos, 16, dst ? dst + pos : NULL );
+        if (dst) _mm_storeu_si128( (__m128i *)(dst + pos), _mm_packus_epi16( lo, hi ));
+    }
+    return pos;
+}
+
+static inline unsigned int __attribute__((target("avx2"))) ascii_mbstowcs_avx2( const unsigned char *src,
+                                                                                unsigned int srclen, WCHAR *dst )
+{
+    unsigned int pos;
+
+    for (pos = 0; pos + 32 <= srclen; pos += 32)
+    {
+        __m256i v = _mm256_loadu_si256( (const __m256i *)(src + pos) );
+
+        if (_mm256_movemask_epi8( v )) return pos + ascii_mbstowcs_prefix( src + pos, 32, dst ? dst + pos : NULL );
+        if (!dst) continue;
+        _mm256_storeu_si256( (__m256i *)(dst + pos), _mm256_cvtepu8_epi16( _mm256_castsi256_si128( v )));
+        _mm256_storeu_si256( (__m256i *)(dst + pos + 16), _mm256_cvtepu8_epi16( _mm256_extracti128_si256( v, 1 )));
+    }
+    return pos + ascii_mbstowcs_sse2( src + pos, srclen - pos, dst ? dst + pos : NULL );
+}
+
+static inline unsigned int __attribute__((target("avx2"))) ascii_wcstombs_avx2( const WCHAR *src,
+                                                                                unsigned int srclen, char *dst )
+{
+    const __m256i high = _mm256_set1_epi16( (short)0xff80 );
+    unsigned int pos;
+
+    for (pos = 0; pos + 32 <= srclen; pos += 32)
+    {
+        __m256i lo = _mm256_loadu_si256( (const __m256i *)(src + pos) );
+        __m256i hi = _mm256_loadu_si256( (const __m256i *)(src + pos + 16) );
+
+        if (!_mm256_testz_si256( _mm256_or_si256( lo, hi ), high ))
+            return pos + ascii_wcstombs_prefix( src + pos, 32, dst ? dst + pos : NULL );
+        /* packing works within 128-bit lanes, put the quarters back in order */
+        if (dst) _mm256_storeu_si256( (__m256i *)(dst + pos),
+                                      _mm256_permute4x64_epi64( _mm256_packus_epi16( lo, hi ), 0xd8 ));
+    }
+    return pos + ascii_wcstombs_sse2( src + pos, srclen - pos, dst ? dst + pos : NULL );
+}
+
+#endif  /* SIMD_USE_X86 */
+
+#ifdef SIMD_USE_NEON
+
+static inline unsigned int ascii_mbstowcs_neon( const unsigned char *src, unsigned int srclen, WCHAR *dst )
+{
+    unsigned int pos;
+
+    for (pos = 0; pos + 16 <= srclen; pos += 16)
+    {
+        uint8x16_t v = vld1q_u8( src + pos );
+
+        if (vmaxvq_u8( v ) >= 0x80) return pos + ascii_mbstowcs_prefix( src + pos, 16, dst ? dst + pos : NULL );
+        if (!dst) continue;
+        vst1q_u16( dst + pos, vmovl_u8( vget_low_u8( v )));
+        vst1q_u16( dst + pos + 8, vmovl_u8( vget_high_u8( v )));
+    }
+    return pos;
+}
+
+static inline unsigned int ascii_wcstombs_neon( const WCHAR *src, unsigned int srclen, char *dst )
+{
+    unsigned int pos;
+
+    for (pos = 0; pos + 16 <= srclen; pos += 16)
+    {
+        uint16x8_t lo = vld1q_u16( src + pos );
+        uint16x8_t hi = vld1q_u16( src + pos + 8 );
+
+        if (vmaxvq_u16( vorrq_u16( lo, hi )) >= 0x80)
+            return pos + ascii_wcstombs_prefix( src + pos, 16, dst ? dst + pos : NULL );
+        if (dst) vst1q_u8( (unsigned char *)dst + pos, vcombine_u8( vmovn_u16( lo ), vmovn_u16( hi )));
+    }
+    return pos;
+}
+
+#endif  /* SIMD_USE_NEON */
+
+static inline const struct ascii_funcs *get_ascii_funcs(void)
+{
+    static const struct ascii_funcs ascii_funcs_scalar = { NULL, NULL };
+#ifdef SIMD_USE_X86
+    static const struct ascii_funcs ascii_funcs_sse2 = { ascii_mbstowcs_sse2, ascii_wcstombs_sse2 };
+    static const struct ascii_funcs ascii_funcs_avx2 = { ascii_mbstowcs_avx2, ascii_wcstombs_avx2 };
+#elif defined(SIMD_USE_NEON)
+    static const struct ascii_funcs ascii_funcs_neon = { ascii_mbstowcs_neon, ascii_wcstombs_neon };
+#endif
+    static const void * const sets[SIMD_LEVELS] = SIMD_FUNCS( &ascii_funcs_scalar, &ascii_funcs_sse2, NULL,
+                                                              &ascii_funcs_avx2, &ascii_funcs_neon );
+    static const void *funcs;
+
+    return simd_get_funcs( &funcs, sets );
+}
+
+#endif  /* __WINE_SIMD_H */
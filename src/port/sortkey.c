@@ -17,10 +17,14 @@
  * License along with this library; if not, write to the Free Software
  * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301, USA
  */
+#include <stdlib.h>
+#include <string.h>
+
 #include "wine/unicode.h"
 
+#include "simd.h"
+
 extern unsigned int wine_decompose( WCHAR ch, WCHAR *dst, unsigned int dstlen );
-extern const unsigned int collation_table[];
 
 /*
  * flags - normalization NORM_* flags
@@ -56,7 +60,7 @@ int wine_get_sortkey(int flags, const WCHAR *src, int srclen, char *dst, int dst
 
                 if (flags & NORM_IGNORECASE) wch = tolowerW(wch);
 
-                ce = collation_table[collation_table[wch >> 8] + (wch & 0xff)];
+                ce = get_char_infoW(wch)->collation;
                 if (ce != (unsigned int)-1)
                 {
                     if (ce >> 16) key_len[0] += 2;
@@ -113,7 +117,7 @@ int wine_get_sortkey(int flags, const WCHAR *src, int srclen, char *dst, int dst
 
                 if (flags & NORM_IGNORECASE) wch = tolowerW(wch);
 
-                ce = collation_table[collation_table[wch >> 8] + (wch & 0xff)];
+                ce = get_char_infoW(wch)->collation;
                 if (ce != (unsigned int)-1)
                 {
                     WCHAR key;
@@ -153,6 +157,123 @@ int wine_get_sortkey(int flags, const WCHAR *src, int srclen, char *dst, int dst
     return key_ptr[3] - dst;
 }
 
+/*
+ * Generate the sort keys of count strings one after the other into dst.
+ * lens may be NULL, or hold -1 for null-terminated strings. Key i is stored
+ * null-terminated at dst + offsets[i], offsets[count] is the total size,
+ * and keys can be ordered by comparing their bytes (see wine_sort_sortkeys).
+ *
+ * Returns the total size, 0 on overflow. With dstlen 0 only the size is computed.
+ */
+int wine_get_sortkeys(int flags, const WCHAR * const *strs, const int *lens, unsigned int count,
+                      char *dst, int dstlen, unsigned int *offsets)
+{
+    unsigned int i;
+    int len, srclen, pos = 0;
+
+    for (i = 0; i < count; i++)
+    {
+        srclen = (lens && lens[i] >= 0) ? lens[i] : strlenW(strs[i]);
+        if (!dstlen)
+            len = wine_get_sortkey(flags, strs[i], srclen, NULL, 0);
+        else if (pos >= dstlen || !(len = wine_get_sortkey(flags, strs[i], srclen, dst + pos, dstlen - pos)))
+            return 0; /* overflow */
+        else
+            len++; /* keep the terminating null */
+        if (offsets) offsets[i] = pos;
+        pos += len;
+    }
+    if (offsets) offsets[count] = pos;
+    return pos;
+}
+
+/* buckets smaller than this are insertion sorted */
+#define RADIX_SORT_MIN 32
+
+/* compare two keys from the given byte on, the shorter one goes first when one is a prefix */
+static inline int compare_keys(const unsigned char *keys, const unsigned int *offsets,
+                               unsigned int a, unsigned int b, unsigned int depth)
+{
+    unsigned int len_a = offsets[a + 1] - offsets[a] - 1 - depth;
+    unsigned int len_b = offsets[b + 1] - offsets[b] - 1 - depth;
+    int ret = memcmp(keys + offsets[a] + depth, keys + offsets[b] + depth, min(len_a, len_b));
+
+    if (ret) return ret;
+    return (len_a > len_b) - (len_a < len_b);
+}
+
+/* sort order[0..count-1], whose keys are known to be equal up to depth */
+static void radix_sort_keys(const unsigned char *keys, const unsigned int *offsets,
+                            unsigned int *order, unsigned int *tmp, unsigned int count,
+                            unsigned int depth)
+{
+    unsigned int bucket_start[258], i, j, len, largest;
+
+    for (;;)
+    {
+        if (count < RADIX_SORT_MIN)
+        {
+            for (i = 1; i < count; i++)
+            {
+                unsigned int idx = order[i];
+                for (j = i; j && compare_keys(keys, offsets, order[j - 1], idx, depth) > 0; j--)
+                    order[j] = order[j - 1];
+                order[j] = idx;
+            }
+            return;
+        }
+
+        /* bucket 0 holds the keys that end here, bucket b + 1 the ones with byte b */
+        memset(bucket_start, 0, sizeof(bucket_start));
+        for (i = 0; i < count; i++)
+        {
+            len = offsets[order[i] + 1] - offsets[order[i]] - 1;
+            bucket_start[depth < len ? keys[offsets[order[i]] + depth] + 2 : 1]++;
+        }
+        for (i = 1; i < 258; i++) bucket_start[i] += bucket_start[i - 1];
+        for (i = 0; i < count; i++)
+        {
+            len = offsets[order[i] + 1] - offsets[order[i]] - 1;
+            tmp[bucket_start[depth < len ? keys[offsets[order[i]] + depth] + 1 : 0]++] = order[i];
+        }
+        memcpy(order, tmp, count * sizeof(*order));
+
+        /* bucket_start[b] now holds the end of bucket b; recurse into all buckets
+         * but the largest one, which is handled by the loop to bound the stack depth */
+        largest = 1;
+        for (i = 2; i < 257; i++)
+            if (bucket_start[i] - bucket_start[i - 1] > bucket_start[largest] - bucket_start[largest - 1])
+                largest = i;
+        for (i = 1; i < 257; i++)
+        {
+            if (i == largest || bucket_start[i] - bucket_start[i - 1] < 2) continue;
+            radix_sort_keys(keys, offsets, order + bucket_start[i - 1], tmp,
+                            bucket_start[i] - bucket_start[i - 1], depth + 1);
+        }
+        order += bucket_start[largest - 1];
+        count = bucket_start[largest] - bucket_start[largest - 1];
+        depth++;
+    }
+}
+
+/*
+ * Sort keys generated by wine_get_sortkeys: order receives the key indices in
+ * ascending order, keys that compare equal keep their original order.
+ *
+ * Returns 0 if out of memory.
+ */
+int wine_sort_sortkeys(const char *keys, const unsigned int *offsets, unsigned int count,
+                       unsigned int *order)
+{
+    unsigned int i, *tmp;
+
+    if (!(tmp = malloc(count * sizeof(*tmp) + 1))) return 0;
+    for (i = 0; i < count; i++) order[i] = i;
+    radix_sort_keys((const unsigned char *)keys, offsets, order, tmp, count, 0);
+    free(tmp);
+    return 1;
+}
+
 static inline int compare_unicode_weights(int flags, const WCHAR *str1, int len1,
                                           const WCHAR *str2, int len2)
 {
@@ -206,8 +327,8 @@ static inline int compare_unicode_weights(int flags, const WCHAR *str1, int len1
             }
         }
 
-        ce1 = collation_table[collation_table[*str1 >> 8] + (*str1 & 0xff)];
-        ce2 = collation_table[collation_table[*str2 >> 8] + (*str2 & 0xff)];
+        ce1 = get_char_infoW(*str1)->collation;
+        ce2 = get_char_infoW(*str2)->collation;
 
         if (ce1 != (unsigned int)-1 && ce2 != (unsigned int)-1)
             ret = (ce1 >> 16) - (ce2 >> 16);
@@ -265,8 +386,8 @@ static inline int compare_diacritic_weights(int flags, const WCHAR *str1, int le
             if (skip) continue;
         }
 
-        ce1 = collation_table[collation_table[*str1 >> 8] + (*str1 & 0xff)];
-        ce2 = collation_table[collation_table[*str2 >> 8] + (*str2 & 0xff)];
+        ce1 = get_char_infoW(*str1)->collation;
+        ce2 = get_char_infoW(*str2)->collation;
 
         if (ce1 != (unsigned int)-1 && ce2 != (unsigned int)-1)
             ret = ((ce1 >> 8) & 0xff) - ((ce2 >> 8) & 0xff);
@@ -324,8 +445,8 @@ static inline int compare_case_weights(int flags, const WCHAR *str1, int len1,
             if (skip) continue;
         }
 
-        ce1 = collation_table[collation_table[*str1 >> 8] + (*str1 & 0xff)];
-        ce2 = collation_table[collation_table[*str2 >> 8] + (*str2 & 0xff)];
+        ce1 = get_char_infoW(*str1)->collation;
+        ce2 = get_char_infoW(*str2)->collation;
 
         if (ce1 != (unsigned int)-1 && ce2 != (unsigned int)-1)
             ret = ((ce1 >> 4) & 0x0f) - ((ce2 >> 4) & 0x0f);
@@ -352,11 +473,186 @@ static inline int compare_case_weights(int flags, const WCHAR *str1, int len1,
     return len1 - len2;
 }
 
+/* identical runs are skipped with vector compares once this many chars are left */
+#define COMPARE_VECTOR_MIN 16
+
+struct compare_funcs
+{
+    /* length of the common prefix, checked in whole blocks only */
+    unsigned int (*common_prefix)( const WCHAR *str1, const WCHAR *str2, unsigned int len );
+};
+
+static const struct compare_funcs compare_funcs_scalar = { NULL };
+
+#ifdef SIMD_USE_X86
+
+static unsigned int __attribute__((target("sse2"))) common_prefix_sse2( const WCHAR *str1, const WCHAR *str2,
+                                                                        unsigned int len )
+{
+    unsigned int pos, mask;
+
+    for (pos = 0; pos + 8 <= len; pos += 8)
+    {
+        mask = _mm_movemask_epi8( _mm_cmpeq_epi16( _mm_loadu_si128( (const __m128i *)(str1 + pos) ),
+                                                   _mm_loadu_si128( (const __m128i *)(str2 + pos) )));
+        if (mask != 0xffff) return pos + __builtin_ctz( ~mask ) / 2;
+    }
+    return pos;
+}
+
+static unsigned int __attribute__((target("avx2"))) common_prefix_avx2( const WCHAR *str1, const WCHAR *str2,
+                                                                        unsigned int len )
+{
+    unsigned int pos, mask;
+
+    for (pos = 0; pos + 16 <= len; pos += 16)
+    {
+        mask = _mm256_movemask_epi8( _mm256_cmpeq_epi16( _mm256_loadu_si256( (const __m256i *)(str1 + pos) ),
+                                                         _mm256_loadu_si256( (const __m256i *)(str2 + pos) )));
+        if (mask != 0xffffffff) return pos + __builtin_ctz( ~mask ) / 2;
+    }
+    return pos;
+}
+
+static const struct compare_funcs compare_funcs_sse2 = { common_prefix_sse2 };
+static const struct compare_funcs compare_funcs_avx2 = { common_prefix_avx2 };
+
+#endif  /* SIMD_USE_X86 */
+
+#ifdef SIMD_USE_NEON
+
+static unsigned int common_prefix_neon( const WCHAR *str1, const WCHAR *str2, unsigned int len )
+{
+    unsigned int pos;
+
+    for (pos = 0; pos + 8 <= len; pos += 8)
+    {
+        if (vminvq_u16( vceqq_u16( vld1q_u16( str1 + pos ), vld1q_u16( str2 + pos )))) continue;
+        while (str1[pos] == str2[pos]) pos++;
+        break;
+    }
+    return pos;
+}
+
+static const struct compare_funcs compare_funcs_neon = { common_prefix_neon };
+
+#endif  /* SIMD_USE_NEON */
+
+/* pick the kernels for the cpu we are running on */
+static const struct compare_funcs *get_compare_funcs(void)
+{
+    static const void * const sets[SIMD_LEVELS] = SIMD_FUNCS( &compare_funcs_scalar, &compare_funcs_sse2, NULL,
+                                                              &compare_funcs_avx2, &compare_funcs_neon );
+    static const void *funcs;
+
+    return simd_get_funcs( &funcs, sets );
+}
+
+static inline int is_hyphen_or_apostrophe( WCHAR ch )
+{
+    return ch == '-' || ch == '\'';
+}
+
+/* compare the unicode, diacritic and case weights in a single pass, returning at the
+ * first unicode weight difference. Equal chars have equal weights at every level, so
+ * identical runs are skipped without looking at the table.
+ * Returns 0 if the unicode weights need a different alignment than the other levels
+ * (a hyphen or apostrophe on one side only), the separate passes handle that case.
+ */
+static int compare_weights_fused(int flags, const WCHAR *str1, int len1,
+                                 const WCHAR *str2, int len2, int *result)
+{
+    const struct wine_char_info * const latin1 = get_char_infoW(0);
+    const struct compare_funcs *funcs = get_compare_funcs();
+    int diacritic = 0, case_diff = 0, ret;
+    unsigned int ce1, ce2, len;
+    WCHAR ch1, ch2;
+
+    while (len1 > 0 && len2 > 0)
+    {
+        ch1 = *str1;
+        ch2 = *str2;
+        if (ch1 == ch2)
+        {
+            len = min( len1, len2 );
+            if (len >= COMPARE_VECTOR_MIN && funcs->common_prefix)
+                len = funcs->common_prefix( str1, str2, len );
+            else
+                len = 1;
+            str1 += len;
+            str2 += len;
+            len1 -= len;
+            len2 -= len;
+            continue;
+        }
+
+        if (flags & NORM_IGNORESYMBOLS)
+        {
+            int skip = 0;
+            if (get_char_typeW(ch1) & (C1_PUNCT | C1_SPACE))
+            {
+                str1++;
+                len1--;
+                skip = 1;
+            }
+            if (get_char_typeW(ch2) & (C1_PUNCT | C1_SPACE))
+            {
+                str2++;
+                len2--;
+                skip = 1;
+            }
+            if (skip) continue;
+        }
+
+        if (!(flags & SORT_STRINGSORT) &&
+            is_hyphen_or_apostrophe( ch1 ) != is_hyphen_or_apostrophe( ch2 )) return 0;
+
+        ce1 = ch1 < 0x100 ? latin1[ch1].collation : get_char_infoW(ch1)->collation;
+        ce2 = ch2 < 0x100 ? latin1[ch2].collation : get_char_infoW(ch2)->collation;
+
+        if (ce1 == (unsigned int)-1 || ce2 == (unsigned int)-1)
+        {
+            *result = ch1 - ch2;
+            return 1;
+        }
+        if ((ret = (ce1 >> 16) - (ce2 >> 16)))
+        {
+            *result = ret;
+            return 1;
+        }
+        if (!diacritic) diacritic = ((ce1 >> 8) & 0xff) - ((ce2 >> 8) & 0xff);
+        if (!case_diff) case_diff = ((ce1 >> 4) & 0x0f) - ((ce2 >> 4) & 0x0f);
+
+        str1++;
+        str2++;
+        len1--;
+        len2--;
+    }
+    while (len1 && !*str1)
+    {
+        str1++;
+        len1--;
+    }
+    while (len2 && !*str2)
+    {
+        str2++;
+        len2--;
+    }
+
+    ret = len1 - len2;
+    if (!ret && !(flags & NORM_IGNORENONSPACE)) ret = diacritic;
+    if (!ret && !(flags & NORM_IGNORECASE)) ret = case_diff;
+    *result = ret;
+    return 1;
+}
+
 int wine_compare_string(int flags, const WCHAR *str1, int len1,
                         const WCHAR *str2, int len2)
 {
     int ret;
 
+    if (compare_weights_fused(flags, str1, len1, str2, len2, &ret)) return ret;
+
     ret = compare_unicode_weights(flags, str1, len1, str2, len2);
     if (!ret)
     {
@@ -26,11 +26,232 @@
 #define WINE_UNICODE_INLINE  /* nothing */
 #include "wine/unicode.h"
 
+#include "simd.h"
+
+/* vector kernels are only used past the first few chars, and with at least a block left */
+#define ICMP_SCALAR_MAX 8
+#define ICMP_VECTOR_MIN 8
+
+/* null-terminated strings are only read in vector blocks that don't cross a page */
+#define ICMP_PAGE_MASK 4095
+
+struct string_funcs
+{
+    /* number of leading chars that are ASCII and equal ignoring case, checked in whole
+     * blocks only; icmp_ascii_str also stops at the terminator of str1 */
+    unsigned int (*icmp_ascii)( const WCHAR *str1, const WCHAR *str2, unsigned int len );
+    unsigned int (*icmp_ascii_str)( const WCHAR *str1, const WCHAR *str2, unsigned int len );
+};
+
+static const struct string_funcs string_funcs_scalar = { NULL, NULL };
+
+static inline int crosses_page( const WCHAR *str, unsigned int size )
+{
+    return ((unsigned long)str & ICMP_PAGE_MASK) > ICMP_PAGE_MASK + 1 - size;
+}
+
+#ifdef SIMD_USE_X86
+
+/* mask of the lanes that are ASCII in both strings and equal ignoring case */
+static FORCEINLINE __m128i __attribute__((target("sse2"))) icmp_lanes_sse2( __m128i v1, __m128i v2, int check_null )
+{
+    const __m128i before_a = _mm_set1_epi16( 'A' - 1 ), after_z = _mm_set1_epi16( 'Z' + 1 );
+    const __m128i case_bit = _mm_set1_epi16( 0x20 ), non_ascii = _mm_set1_epi16( (short)0xff80 );
+    const __m128i zero = _mm_setzero_si128();
+    __m128i lower1 = _mm_or_si128( v1, _mm_and_si128( case_bit, _mm_and_si128( _mm_cmpgt_epi16( v1, before_a ),
+                                                                               _mm_cmpgt_epi16( after_z, v1 ))));
+    __m128i lower2 = _mm_or_si128( v2, _mm_and_si128( case_bit, _mm_and_si128( _mm_cmpgt_epi16( v2, before_a ),
+                                                                               _mm_cmpgt_epi16( after_z, v2 ))));
+    __m128i ok = _mm_and_si128( _mm_cmpeq_epi16( lower1, lower2 ),
+                                _mm_cmpeq_epi16( _mm_and_si128( _mm_or_si128( v1, v2 ), non_ascii ), zero ));
+
+    if (check_null) ok = _mm_andnot_si128( _mm_cmpeq_epi16( v1, zero ), ok );
+    return ok;
+}
+
+static FORCEINLINE unsigned int __attribute__((target("sse2"))) icmp_ascii_sse2_impl( const WCHAR *str1, const WCHAR *str2,
+                                                                                      unsigned int len, int check_null )
+{
+    unsigned int pos, mask;
+
+    for (pos = 0; pos + 8 <= len; pos += 8)
+    {
+        if (check_null && (crosses_page( str1 + pos, 16 ) || crosses_page( str2 + pos, 16 ))) break;
+        mask = _mm_movemask_epi8( icmp_lanes_sse2( _mm_loadu_si128( (const __m128i *)(str1 + pos) ),
+                                                   _mm_loadu_si128( (const __m128i *)(str2 + pos) ), check_null ));
+        if (mask != 0xffff) return pos + __builtin_ctz( ~mask ) / 2;
+    }
+    return pos;
+}
+
+static unsigned int __attribute__((target("sse2"))) icmp_ascii_sse2( const WCHAR *str1, const WCHAR *str2,
+                                                                     unsigned int len )
+{
+    return icmp_ascii_sse2_impl( str1, str2, len, 0 );
+}
+
+static unsigned int __attribute__((target("sse2"))) icmp_ascii_str_sse2( const WCHAR *str1, const WCHAR *str2,
+                                                                         unsigned int len )
+{
+    return icmp_ascii_sse2_impl( str1, str2, len, 1 );
+}
+
+static FORCEINLINE __m256i __attribute__((target("avx2"))) icmp_lanes_avx2( __m256i v1, __m256i v2, int check_null )
+{
+    const __m256i before_a = _mm256_set1_epi16( 'A' - 1 ), after_z = _mm256_set1_epi16( 'Z' + 1 );
+    const __m256i case_bit = _mm256_set1_epi16( 0x20 ), non_ascii = _mm256_set1_epi16( (short)0xff80 );
+    const __m256i zero = _mm256_setzero_si256();
+    __m256i lower1 = _mm256_or_si256( v1, _mm256_and_si256( case_bit, _mm256_and_si256( _mm256_cmpgt_epi16( v1, before_a ),
+                                                                                        _mm256_cmpgt_epi16( after_z, v1 ))));
+    __m256i lower2 = _mm256_or_si256( v2, _mm256_and_si256( case_bit, _mm256_and_si256( _mm256_cmpgt_epi16( v2, before_a ),
+                                                                                        _mm256_cmpgt_epi16( after_z, v2 ))));
+    __m256i ok = _mm256_and_si256( _mm256_cmpeq_epi16( lower1, lower2 ),
+                                   _mm256_cmpeq_epi16( _mm256_and_si256( _mm256_or_si256( v1, v2 ), non_ascii ), zero ));
+
+    if (check_null) ok = _mm256_andnot_si256( _mm256_cmpeq_epi16( v1, zero ), ok );
+    return ok;
+}
+
+static FORCEINLINE unsigned int __attribute__((target("avx2"))) icmp_ascii_avx2_impl( const WCHAR *str1, const WCHAR *str2,
+                                                                                      unsigned int len, int check_null )
+{
+    unsigned int pos, mask;
+
+    for (pos = 0; pos + 16 <= len; pos += 16)
+    {
+        if (check_null && (crosses_page( str1 + pos, 32 ) || crosses_page( str2 + pos, 32 ))) break;
+        mask = _mm256_movemask_epi8( icmp_lanes_avx2( _mm256_loadu_si256( (const __m256i *)(str1 + pos) ),
+                                                      _mm256_loadu_si256( (const __m256i *)(str2 + pos) ), check_null ));
+        if (mask != 0xffffffff) return pos + __builtin_ctz( ~mask ) / 2;
+    }
+    /* finish with a half block */
+    if (pos + 8 <= len && !(check_null && (crosses_page( str1 + pos, 16 ) || crosses_page( str2 + pos, 16 ))))
+    {
+        mask = _mm256_movemask_epi8( icmp_lanes_avx2( _mm256_castsi128_si256( _mm_loadu_si128( (const __m128i *)(str1 + pos) )),
+                                                      _mm256_castsi128_si256( _mm_loadu_si128( (const __m128i *)(str2 + pos) )),
+                                                      check_null )) & 0xffff;
+        if (mask != 0xffff) return pos + __builtin_ctz( ~mask ) / 2;
+        pos += 8;
+    }
+    return pos;
+}
+
+static unsigned int __attribute__((target("avx2"))) icmp_ascii_avx2( const WCHAR *str1, const WCHAR *str2,
+                                                                     unsigned int len )
+{
+    return icmp_ascii_avx2_impl( str1, str2, len, 0 );
+}
+
+static unsigned int __attribute__((target("avx2"))) icmp_ascii_str_avx2( const WCHAR *str1, const WCHAR *str2,
+                                                                         unsigned int len )
+{
+    return icmp_ascii_avx2_impl( str1, str2, len, 1 );
+}
+
+static const struct string_funcs string_funcs_sse2 = { icmp_ascii_sse2, icmp_ascii_str_sse2 };
+static const struct string_funcs string_funcs_avx2 = { icmp_ascii_avx2, icmp_ascii_str_avx2 };
+
+#endif  /* SIMD_USE_X86 */
+
+#ifdef SIMD_USE_NEON
+
+static FORCEINLINE unsigned int icmp_ascii_neon_impl( const WCHAR *str1, const WCHAR *str2,
+                                                      unsigned int len, int check_null )
+{
+    const uint16x8_t first = vdupq_n_u16( 'A' ), range = vdupq_n_u16( 'Z' - 'A' ), case_bit = vdupq_n_u16( 0x20 );
+    const uint16x8_t last_ascii = vdupq_n_u16( 0x7f );
+    unsigned long long mask;
+    unsigned int pos;
+
+    for (pos = 0; pos + 8 <= len; pos += 8)
+    {
+        uint16x8_t v1, v2, lower1, lower2, ok;
+
+        if (check_null && (crosses_page( str1 + pos, 16 ) || crosses_page( str2 + pos, 16 ))) break;
+        v1 = vld1q_u16( str1 + pos );
+        v2 = vld1q_u16( str2 + pos );
+        lower1 = vorrq_u16( v1, vandq_u16( case_bit, vcleq_u16( vsubq_u16( v1, first ), range )));
+        lower2 = vorrq_u16( v2, vandq_u16( case_bit, vcleq_u16( vsubq_u16( v2, first ), range )));
+        ok = vandq_u16( vceqq_u16( lower1, lower2 ), vcleq_u16( vorrq_u16( v1, v2 ), last_ascii ));
+        if (check_null) ok = vandq_u16( ok, vtstq_u16( v1, v1 ));
+        mask = vget_lane_u64( vreinterpret_u64_u8( vmovn_u16( ok )), 0 );
+        if (mask != ~0ull) return pos + __builtin_ctzll( ~mask ) / 8;
+    }
+    return pos;
+}
+
+static unsigned int icmp_ascii_neon( const WCHAR *str1, const WCHAR *str2, unsigned int len )
+{
+    return icmp_ascii_neon_impl( str1, str2, len, 0 );
+}
+
+static unsigned int icmp_ascii_str_neon( const WCHAR *str1, const WCHAR *str2, unsigned int len )
+{
+    return icmp_ascii_neon_impl( str1, str2, len, 1 );
+}
+
+static const struct string_funcs string_funcs_neon = { icmp_ascii_neon, icmp_ascii_str_neon };
+
+#endif  /* SIMD_USE_NEON */
+
+/* pick the kernels for the cpu we are running on */
+static const struct string_funcs *get_string_funcs(void)
+{
+    static const void * const sets[SIMD_LEVELS] = SIMD_FUNCS( &string_funcs_scalar, &string_funcs_sse2, NULL,
+                                                              &string_funcs_avx2, &string_funcs_neon );
+    static const void *funcs;
+
+    return simd_get_funcs( &funcs, sets );
+}
+
+static inline int is_ascii_equal_nocase( WCHAR ch1, WCHAR ch2 )
+{
+    if ((ch1 | ch2) >= 0x80) return 0;
+    if (ch1 >= 'A' && ch1 <= 'Z') ch1 += 'a' - 'A';
+    if (ch2 >= 'A' && ch2 <= 'Z') ch2 += 'a' - 'A';
+    return ch1 == ch2;
+}
+
+/* number of leading chars that are ASCII and equal ignoring case, with check_null also
+ * stopping at the terminator of str1; the other chars need the full case mapping */
+static FORCEINLINE unsigned int ascii_icmp_prefix( const WCHAR *str1, const WCHAR *str2,
+                                                   unsigned int len, int check_null )
+{
+    const struct string_funcs *funcs = get_string_funcs();
+    unsigned int pos = 0, skip;
+
+    while (pos < len && is_ascii_equal_nocase( str1[pos], str2[pos] ) && !(check_null && !str1[pos]))
+    {
+        /* short names are done before the vector setup would pay off */
+        if (pos >= ICMP_SCALAR_MAX && len - pos >= ICMP_VECTOR_MIN && funcs->icmp_ascii)
+        {
+            if (check_null) skip = funcs->icmp_ascii_str( str1 + pos, str2 + pos, len - pos );
+            else skip = funcs->icmp_ascii( str1 + pos, str2 + pos, len - pos );
+            pos += skip ? skip : 1;  /* the first char is already checked */
+        }
+        else pos++;
+    }
+    return pos;
+}
+
+/* exported for the ntdll string functions, which fold to uppercase instead */
+unsigned int wine_ascii_icmp_prefix( const WCHAR *str1, const WCHAR *str2, unsigned int len )
+{
+    return ascii_icmp_prefix( str1, str2, len, 0 );
+}
+
 int strcmpiW( const WCHAR *str1, const WCHAR *str2 )
 {
+    unsigned int skip;
+
     for (;;)
     {
-        int ret = tolowerW(*str1) - tolowerW(*str2);
+        int ret;
+
+        skip = ascii_icmp_prefix( str1, str2, ~0u, 1 );
+        str1 += skip;
+        str2 += skip;
+        ret = tolowerW(*str1) - tolowerW(*str2);
         if (ret || !*str1) return ret;
         str1++;
         str2++;
@@ -39,17 +260,39 @@ int strcmpiW( const WCHAR *str1, const WCHAR *str2 )
 
 int strncmpiW( const WCHAR *str1, const WCHAR *str2, int n )
 {
+    unsigned int skip;
     int ret = 0;
-    for ( ; n > 0; n--, str1++, str2++)
+
+    while (n > 0)
+    {
+        skip = ascii_icmp_prefix( str1, str2, n, 1 );
+        str1 += skip;
+        str2 += skip;
+        if (!(n -= skip)) break;
         if ((ret = tolowerW(*str1) - tolowerW(*str2)) || !*str1) break;
+        str1++;
+        str2++;
+        n--;
+    }
     return ret;
 }
 
 int memicmpW( const WCHAR *str1, const WCHAR *str2, int n )
 {
+    unsigned int skip;
     int ret = 0;
-    for ( ; n > 0; n--, str1++, str2++)
+
+    while (n > 0)
+    {
+        skip = ascii_icmp_prefix( str1, str2, n, 0 );
+        str1 += skip;
+        str2 += skip;
+        if (!(n -= skip)) break;
         if ((ret = tolowerW(*str1) - tolowerW(*str2))) break;
+        str1++;
+        str2++;
+        n--;
+    }
     return ret;
 }
 
@@ -22,6 +22,8 @@
 
 #include "wine/unicode.h"
 
+#include "simd.h"
+
 extern WCHAR wine_compose( const WCHAR *str ) DECLSPEC_HIDDEN;
 
 /* number of following bytes in sequence based on first byte value (for bytes above 0x7f) */
@@ -44,6 +46,235 @@ static const unsigned char utf8_mask[4] = { 0x7f, 0x1f, 0x0f, 0x07 };
 static const unsigned int utf8_minval[4] = { 0x0, 0x80, 0x800, 0x10000 };
 
 
+/* Vector kernels
+ *
+ * Runs of 7-bit ASCII are converted a vector at a time by the kernels of
+ * simd.h, and whole strings are validated to compute their length. The
+ * conversion functions below remain the reference: the kernels only take
+ * over the parts they are sure about and leave everything else to the
+ * scalar code.
+ */
+
+struct utf8_funcs
+{
+    /* return the number of WCHARs of a valid UTF-8 string, -1 if it isn't valid */
+    int (*mbs_length)( const char *src, int srclen );
+};
+
+static const struct utf8_funcs utf8_funcs_scalar = { NULL };
+
+#if defined(SIMD_USE_X86) || defined(SIMD_USE_NEON)
+
+/* error bits of the UTF-8 validation, looked up from the nibbles of each byte
+ * and the one before it (Keiser & Lemire, "Validating UTF-8 in less than one
+ * instruction per byte") */
+#define UTF8_TOO_SHORT       0x01  /* lead byte not followed by a continuation byte */
+#define UTF8_TOO_LONG        0x02  /* continuation byte following an ASCII char */
+#define UTF8_OVERLONG_3      0x04  /* 11100000 100_____ */
+#define UTF8_TOO_LARGE       0x08  /* above U+10FFFF */
+#define UTF8_SURROGATE       0x10  /* 11101101 101_____ */
+#define UTF8_OVERLONG_2      0x20  /* 1100000_ 10______ */
+#define UTF8_TOO_LARGE_1000  0x40  /* 11110101 1000____ and above */
+#define UTF8_OVERLONG_4      0x40  /* 11110000 1000____ */
+#define UTF8_TWO_CONTS       0x80  /* two continuation bytes, only valid after a 3 or 4 byte lead */
+#define UTF8_CARRY           (UTF8_TOO_SHORT | UTF8_TOO_LONG | UTF8_TWO_CONTS)
+
+/* indexed by the high nibble of the previous byte */
+static const unsigned char utf8_byte_1_high[16] =
+{
+    UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG,
+    UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG,
+    UTF8_TWO_CONTS, UTF8_TWO_CONTS, UTF8_TWO_CONTS, UTF8_TWO_CONTS,
+    UTF8_TOO_SHORT | UTF8_OVERLONG_2,
+    UTF8_TOO_SHORT,
+    UTF8_TOO_SHORT | UTF8_OVERLONG_3 | UTF8_SURROGATE,
+    UTF8_TOO_SHORT | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000 | UTF8_OVERLONG_4
+};
+
+/* indexed by the low nibble of the previous byte */
+static const unsigned char utf8_byte_1_low[16] =
+{
+    UTF8_CARRY | UTF8_OVERLONG_3 | UTF8_OVERLONG_2 | UTF8_OVERLONG_4,
+    UTF8_CARRY | UTF8_OVERLONG_2,
+    UTF8_CARRY,
+    UTF8_CARRY,
+    UTF8_CARRY | UTF8_TOO_LARGE,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000 | UTF8_SURROGATE,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000
+};
+
+/* indexed by the high nibble of the current byte */
+static const unsigned char utf8_byte_2_high[16] =
+{
+    UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT,
+    UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT,
+    UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_OVERLONG_3 | UTF8_TOO_LARGE_1000 | UTF8_OVERLONG_4,
+    UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_OVERLONG_3 | UTF8_TOO_LARGE,
+    UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_SURROGATE | UTF8_TOO_LARGE,
+    UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_SURROGATE | UTF8_TOO_LARGE,
+    UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT
+};
+
+/* a block ending with one of these is waiting for continuation bytes from the next one */
+static const unsigned char utf8_incomplete_max[32] =
+{
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xdf, 0xbf
+};
+
+#endif  /* SIMD_USE_X86 || SIMD_USE_NEON */
+
+#ifdef SIMD_USE_X86
+
+static inline __m256i __attribute__((target("avx2"))) avx2_lookup( __m256i table, __m256i nibbles )
+{
+    return _mm256_shuffle_epi8( table, _mm256_and_si256( nibbles, _mm256_set1_epi8( 0x0f )));
+}
+
+static int __attribute__((target("avx2"))) mbs_length_avx2( const char *src, int srclen )
+{
+    const __m256i byte_1_high = _mm256_broadcastsi128_si256( _mm_loadu_si128( (const __m128i *)utf8_byte_1_high ));
+    const __m256i byte_1_low = _mm256_broadcastsi128_si256( _mm_loadu_si128( (const __m128i *)utf8_byte_1_low ));
+    const __m256i byte_2_high = _mm256_broadcastsi128_si256( _mm_loadu_si128( (const __m128i *)utf8_byte_2_high ));
+    const __m256i incomplete_max = _mm256_loadu_si256( (const __m256i *)utf8_incomplete_max );
+    __m256i input, prev_input = _mm256_setzero_si256(), prev_incomplete = _mm256_setzero_si256();
+    __m256i error = _mm256_setzero_si256();
+    char tail[32];
+    int pos, count = 0;
+
+    for (pos = 0; pos < srclen; pos += 32)
+    {
+        if (srclen - pos >= 32) input = _mm256_loadu_si256( (const __m256i *)(src + pos) );
+        else
+        {
+            /* pad with ASCII, which also flags a sequence cut short by the end of the string */
+            memset( tail, 0, sizeof(tail) );
+            memcpy( tail, src + pos, srclen - pos );
+            input = _mm256_loadu_si256( (const __m256i *)tail );
+            count -= 32 - (srclen - pos);
+        }
+
+        if (!_mm256_movemask_epi8( input ))
+        {
+            error = _mm256_or_si256( error, prev_incomplete );
+            count += 32;
+        }
+        else
+        {
+            __m256i prev = _mm256_permute2x128_si256( prev_input, input, 0x21 );
+            __m256i prev1 = _mm256_alignr_epi8( input, prev, 15 );
+            __m256i prev2 = _mm256_alignr_epi8( input, prev, 14 );
+            __m256i prev3 = _mm256_alignr_epi8( input, prev, 13 );
+            __m256i special = _mm256_and_si256(
+                _mm256_and_si256( avx2_lookup( byte_1_high, _mm256_srli_epi16( prev1, 4 )),
+                                  avx2_lookup( byte_1_low, prev1 )),
+                avx2_lookup( byte_2_high, _mm256_srli_epi16( input, 4 )));
+            /* the third and fourth bytes of a sequence are the valid pairs of continuation bytes */
+            __m256i must23 = _mm256_or_si256( _mm256_subs_epu8( prev2, _mm256_set1_epi8( 0xe0 - 0x80 )),
+                                              _mm256_subs_epu8( prev3, _mm256_set1_epi8( (char)(0xf0 - 0x80) )));
+
+            must23 = _mm256_and_si256( must23, _mm256_set1_epi8( (char)0x80 ));
+            error = _mm256_or_si256( error, _mm256_xor_si256( must23, special ));
+            prev_incomplete = _mm256_subs_epu8( input, incomplete_max );
+
+            /* each char starts with a non-continuation byte, 4-byte ones need a surrogate pair */
+            count += 32 - __builtin_popcount( _mm256_movemask_epi8(
+                         _mm256_cmpgt_epi8( _mm256_set1_epi8( (char)0xc0 ), input )));
+            count += __builtin_popcount( _mm256_movemask_epi8( _mm256_and_si256( input,
+                         _mm256_cmpgt_epi8( input, _mm256_set1_epi8( (char)0xef )))));
+        }
+        prev_input = input;
+    }
+    error = _mm256_or_si256( error, prev_incomplete );
+    return _mm256_testz_si256( error, error ) ? count : -1;
+}
+
+static const struct utf8_funcs utf8_funcs_avx2 = { mbs_length_avx2 };
+
+#endif  /* SIMD_USE_X86 */
+
+#ifdef SIMD_USE_NEON
+
+static int mbs_length_neon( const char *src, int srclen )
+{
+    const uint8x16_t byte_1_high = vld1q_u8( utf8_byte_1_high );
+    const uint8x16_t byte_1_low = vld1q_u8( utf8_byte_1_low );
+    const uint8x16_t byte_2_high = vld1q_u8( utf8_byte_2_high );
+    const uint8x16_t incomplete_max = vld1q_u8( utf8_incomplete_max + 16 );
+    const uint8x16_t nibble = vdupq_n_u8( 0x0f );
+    uint8x16_t input, prev_input = vdupq_n_u8( 0 ), prev_incomplete = vdupq_n_u8( 0 );
+    uint8x16_t error = vdupq_n_u8( 0 );
+    unsigned char tail[16];
+    int pos, count = 0;
+
+    for (pos = 0; pos < srclen; pos += 16)
+    {
+        if (srclen - pos >= 16) input = vld1q_u8( (const unsigned char *)src + pos );
+        else
+        {
+            /* pad with ASCII, which also flags a sequence cut short by the end of the string */
+            memset( tail, 0, sizeof(tail) );
+            memcpy( tail, src + pos, srclen - pos );
+            input = vld1q_u8( tail );
+            count -= 16 - (srclen - pos);
+        }
+
+        if (vmaxvq_u8( input ) < 0x80)
+        {
+            error = vorrq_u8( error, prev_incomplete );
+            count += 16;
+        }
+        else
+        {
+            uint8x16_t prev1 = vextq_u8( prev_input, input, 15 );
+            uint8x16_t prev2 = vextq_u8( prev_input, input, 14 );
+            uint8x16_t prev3 = vextq_u8( prev_input, input, 13 );
+            uint8x16_t special = vandq_u8( vandq_u8( vqtbl1q_u8( byte_1_high, vshrq_n_u8( prev1, 4 )),
+                                                     vqtbl1q_u8( byte_1_low, vandq_u8( prev1, nibble ))),
+                                           vqtbl1q_u8( byte_2_high, vshrq_n_u8( input, 4 )));
+            /* the third and fourth bytes of a sequence are the valid pairs of continuation bytes */
+            uint8x16_t must23 = vorrq_u8( vqsubq_u8( prev2, vdupq_n_u8( 0xe0 - 0x80 )),
+                                          vqsubq_u8( prev3, vdupq_n_u8( 0xf0 - 0x80 )));
+
+            must23 = vandq_u8( must23, vdupq_n_u8( 0x80 ));
+            error = vorrq_u8( error, veorq_u8( must23, special ));
+            prev_incomplete = vqsubq_u8( input, incomplete_max );
+
+            /* each char starts with a non-continuation byte, 4-byte ones need a surrogate pair */
+            count += 16 - vaddvq_u8( vshrq_n_u8( vceqq_u8( vandq_u8( input, vdupq_n_u8( 0xc0 )),
+                                                           vdupq_n_u8( 0x80 )), 7 ));
+            count += vaddvq_u8( vshrq_n_u8( vcgeq_u8( input, vdupq_n_u8( 0xf0 )), 7 ));
+        }
+        prev_input = input;
+    }
+    error = vorrq_u8( error, prev_incomplete );
+    return vmaxvq_u8( error ) ? -1 : count;
+}
+
+static const struct utf8_funcs utf8_funcs_neon = { mbs_length_neon };
+
+#endif  /* SIMD_USE_NEON */
+
+/* pick the kernels for the cpu we are running on */
+static const struct utf8_funcs *get_utf8_funcs(void)
+{
+    static const void * const sets[SIMD_LEVELS] = SIMD_FUNCS( &utf8_funcs_scalar, NULL, NULL,
+                                                              &utf8_funcs_avx2, &utf8_funcs_neon );
+    static const void *funcs;
+
+    return simd_get_funcs( &funcs, sets );
+}
+
+
 /* get the next char value taking surrogates into account */
 static inline unsigned int get_surrogate_value( const WCHAR *src, unsigned int srclen )
 {
@@ -61,14 +292,18 @@ static inline unsigned int get_surrogate_value( const WCHAR *src, unsigned int s
 /* query necessary dst length for src string */
 static inline int get_length_wcs_utf8( int flags, const WCHAR *src, unsigned int srclen )
 {
-    int len;
+    const struct ascii_funcs *ascii = get_ascii_funcs();
+    int len, run;
     unsigned int val;
 
     for (len = 0; srclen; srclen--, src++)
     {
         if (*src < 0x80)  /* 0x00-0x7f: 1 byte */
         {
-            len++;
+            run = ascii->wcstombs ? ascii->wcstombs( src + 1, srclen - 1, NULL ) : 0;
+            len += run + 1;
+            src += run;
+            srclen -= run;
             continue;
         }
         if (*src < 0x800)  /* 0x80-0x7ff: 2 bytes */
@@ -97,7 +332,8 @@ static inline int get_length_wcs_utf8( int flags, const WCHAR *src, unsigned int
 /* return -1 on dst buffer overflow, -2 on invalid input char */
 int wine_utf8_wcstombs( int flags, const WCHAR *src, int srclen, char *dst, int dstlen )
 {
-    int len;
+    const struct ascii_funcs *ascii = get_ascii_funcs();
+    int len, run;
 
     if (!dstlen) return get_length_wcs_utf8( flags, src, srclen );
 
@@ -110,6 +346,11 @@ int wine_utf8_wcstombs( int flags, const WCHAR *src, int srclen, char *dst, int
         {
             if (!len--) return -1;  /* overflow */
             *dst++ = ch;
+            run = ascii->wcstombs ? ascii->wcstombs( src + 1, min( srclen - 1, len ), dst ) : 0;
+            dst += run;
+            len -= run;
+            src += run;
+            srclen -= run;
             continue;
         }
 
@@ -276,16 +517,24 @@ static int utf8_mbstowcs_compose( int flags, const char *src, int srclen, WCHAR
 /* query necessary dst length for src string */
 static inline int get_length_mbs_utf8( int flags, const char *src, int srclen )
 {
-    int ret = 0;
+    const struct utf8_funcs *funcs = get_utf8_funcs();
+    const struct ascii_funcs *ascii = get_ascii_funcs();
+    int ret = 0, run;
     unsigned int res;
     const char *srcend = src + srclen;
 
+    /* valid strings are counted by the vector code, the others need the details */
+    if (funcs->mbs_length && (ret = funcs->mbs_length( src, srclen )) >= 0) return ret;
+
+    ret = 0;
     while (src < srcend)
     {
         unsigned char ch = *src++;
         if (ch < 0x80)  /* special fast case for 7-bit ASCII */
         {
-            ret++;
+            run = ascii->mbstowcs ? ascii->mbstowcs( (const unsigned char *)src, srcend - src, NULL ) : 0;
+            ret += run + 1;
+            src += run;
             continue;
         }
         if ((res = decode_utf8_char( ch, &src, srcend )) <= 0x10ffff)
@@ -303,20 +552,26 @@ static inline int get_length_mbs_utf8( int flags, const char *src, int srclen )
 /* return -1 on dst buffer overflow, -2 on invalid input char */
 int wine_utf8_mbstowcs( int flags, const char *src, int srclen, WCHAR *dst, int dstlen )
 {
+    const struct ascii_funcs *ascii;
     unsigned int res;
     const char *srcend = src + srclen;
     WCHAR *dstend = dst + dstlen;
+    int run;
 
     if (flags & MB_COMPOSITE) return utf8_mbstowcs_compose( flags, src, srclen, dst, dstlen );
 
     if (!dstlen) return get_length_mbs_utf8( flags, src, srclen );
 
+    ascii = get_ascii_funcs();
     while ((dst < dstend) && (src < srcend))
     {
         unsigned char ch = *src++;
         if (ch < 0x80)  /* special fast case for 7-bit ASCII */
         {
             *dst++ = ch;
+            run = ascii->mbstowcs ? ascii->mbstowcs( (const unsigned char *)src, min( srcend - src, dstend - dst ), dst ) : 0;
+            src += run;
+            dst += run;
             continue;
         }
         if ((res = decode_utf8_char( ch, &src, srcend )) <= 0xffff)
@@ -22,6 +22,8 @@
 
 #include "wine/unicode.h"
 
+#include "simd.h"
+
 extern WCHAR wine_compose( const WCHAR *str ) DECLSPEC_HIDDEN;
 
 /****************************************************************/
@@ -88,6 +90,296 @@ static int get_length_sbcs( const struct sbcs_table *table, int flags,
     return ret;
 }
 
+/* Vector kernels for single-byte code pages
+ *
+ * The Unicode -> code page map is two-level, which vectors can't follow.
+ * But most code pages map whole ranges of chars to consecutive bytes:
+ * ASCII, the Cyrillic letters of 1251 and 866, the Latin-1 half of 1252...
+ * In such a range the byte is the char plus a delta, so a vector of chars
+ * that all fall in a few of these ranges converts with range compares.
+ * Vectors with other chars are left to the scalar code.
+ */
+
+/* below this, looking up the ranges costs more than it saves */
+#define SBCS_VECTOR_MIN 64
+#define SBCS_MAX_RANGES 3
+
+struct sbcs_ranges
+{
+    unsigned int count;
+    int          ascii;                   /* ASCII maps to itself */
+    WCHAR        first[SBCS_MAX_RANGES];  /* first char of the range */
+    WCHAR        last[SBCS_MAX_RANGES];   /* size of the range minus one */
+    WCHAR        delta[SBCS_MAX_RANGES];  /* byte minus char */
+};
+
+struct sbcs_funcs
+{
+    /* convert the leading vectors of src that are in the ranges, return their size */
+    unsigned int (*wcstombs)( const struct sbcs_ranges *ranges, const WCHAR *src,
+                              unsigned int srclen, char *dst );
+};
+
+/* find the blocks of 16 bytes that the table maps both ways to consecutive chars,
+ * and keep the largest ranges they form */
+static void init_sbcs_ranges( const void *ptr, void *data )
+{
+    const struct sbcs_table *table = ptr;
+    struct sbcs_ranges *ranges = data;
+    const unsigned char  * const uni2cp_low = table->uni2cp_low;
+    const unsigned short * const uni2cp_high = table->uni2cp_high;
+    WCHAR first[16], last[16], delta[16];
+    unsigned int i, j, count = 0;
+
+    for (i = 0; i < 16; i++)
+    {
+        const WCHAR *block = table->cp2uni + i * 16;
+
+        for (j = 0; j < 16; j++)
+        {
+            WCHAR wch = block[0] + j;
+            if (block[j] != wch || uni2cp_low[uni2cp_high[wch >> 8] + (wch & 0xff)] != i * 16 + j) break;
+        }
+        if (j < 16) continue;
+        if (count && last[count - 1] + 1 == block[0] && delta[count - 1] == (WCHAR)(i * 16 - block[0]))
+        {
+            last[count - 1] += 16;
+            continue;
+        }
+        first[count] = block[0];
+        last[count] = block[0] + 15;
+        delta[count] = i * 16 - block[0];
+        count++;
+    }
+
+    ranges->ascii = (count && !first[0] && last[0] >= 0x7f);
+    for (ranges->count = 0; ranges->count < SBCS_MAX_RANGES && count; ranges->count++)
+    {
+        unsigned int best = 0;
+
+        for (i = 1; i < count; i++) if (last[i] - first[i] > last[best] - first[best]) best = i;
+        ranges->first[ranges->count] = first[best];
+        ranges->last[ranges->count] = last[best] - first[best];
+        ranges->delta[ranges->count] = delta[best];
+        count--;
+        first[best] = first[count];
+        last[best] = last[count];
+        delta[best] = delta[count];
+    }
+}
+
+/* get the ranges of the table, NULL if out of memory */
+static const struct sbcs_ranges *get_sbcs_ranges( const struct sbcs_table *table )
+{
+    static struct simd_cache_entry *cache[SIMD_CACHE_SIZE];
+
+    return simd_get_table_data( cache, table, sizeof(struct sbcs_ranges), init_sbcs_ranges );
+}
+
+static const struct sbcs_funcs sbcs_funcs_scalar = { NULL };
+
+#ifdef SIMD_USE_X86
+
+/* the ranges as vectors */
+struct sse2_ranges
+{
+    unsigned int count;
+    __m128i      first[SBCS_MAX_RANGES];
+    __m128i      last[SBCS_MAX_RANGES];
+    __m128i      delta[SBCS_MAX_RANGES];
+};
+
+static inline void __attribute__((target("sse2"))) sse2_get_ranges( const struct sbcs_ranges *ranges,
+                                                                    struct sse2_ranges *vec )
+{
+    unsigned int i;
+
+    vec->count = ranges->count;
+    for (i = 0; i < ranges->count; i++)
+    {
+        vec->first[i] = _mm_set1_epi16( ranges->first[i] );
+        vec->last[i] = _mm_set1_epi16( ranges->last[i] );
+        vec->delta[i] = _mm_set1_epi16( ranges->delta[i] );
+    }
+}
+
+/* map 8 chars through the ranges, set *miss if some are outside of them */
+static inline __m128i __attribute__((target("sse2"))) sse2_map_ranges( const struct sse2_ranges *ranges,
+                                                                       __m128i v, __m128i *miss )
+{
+    __m128i zero = _mm_setzero_si128(), found = zero, delta = zero;
+    unsigned int i;
+
+    for (i = 0; i < ranges->count; i++)
+    {
+        __m128i offset = _mm_sub_epi16( v, ranges->first[i] );
+        __m128i in = _mm_cmpeq_epi16( _mm_subs_epu16( offset, ranges->last[i] ), zero );
+
+        found = _mm_or_si128( found, in );
+        delta = _mm_or_si128( delta, _mm_and_si128( in, ranges->delta[i] ));
+    }
+    *miss = _mm_or_si128( *miss, _mm_cmpeq_epi16( found, zero ));
+    return _mm_add_epi16( v, delta );
+}
+
+static unsigned int __attribute__((target("sse2"))) wcstombs_sbcs_sse2( const struct sbcs_ranges *ranges,
+                                                                        const WCHAR *src,
+                                                                        unsigned int srclen, char *dst )
+{
+    const __m128i high = _mm_set1_epi16( (short)0xff80 );
+    struct sse2_ranges vec;
+    unsigned int pos;
+
+    sse2_get_ranges( ranges, &vec );
+    for (pos = 0; pos + 16 <= srclen; pos += 16)
+    {
+        __m128i lo = _mm_loadu_si128( (const __m128i *)(src + pos) );
+        __m128i hi = _mm_loadu_si128( (const __m128i *)(src + pos + 8) );
+        __m128i miss = _mm_setzero_si128();
+
+        if (!ranges->ascii || _mm_movemask_epi8( _mm_cmpeq_epi16( _mm_and_si128( _mm_or_si128( lo, hi ), high ),
+                                                                  _mm_setzero_si128() )) != 0xffff)
+        {
+            lo = sse2_map_ranges( &vec, lo, &miss );
+            hi = sse2_map_ranges( &vec, hi, &miss );
+            if (_mm_movemask_epi8( miss )) break;
+        }
+        _mm_storeu_si128( (__m128i *)(dst + pos), _mm_packus_epi16( lo, hi ));
+    }
+    return pos;
+}
+
+/* the ranges as vectors */
+struct avx2_ranges
+{
+    unsigned int count;
+    __m256i      first[SBCS_MAX_RANGES];
+    __m256i      last[SBCS_MAX_RANGES];
+    __m256i      delta[SBCS_MAX_RANGES];
+};
+
+static inline void __attribute__((target("avx2"))) avx2_get_ranges( const struct sbcs_ranges *ranges,
+                                                                    struct avx2_ranges *vec )
+{
+    unsigned int i;
+
+    vec->count = ranges->count;
+    for (i = 0; i < ranges->count; i++)
+    {
+        vec->first[i] = _mm256_set1_epi16( ranges->first[i] );
+        vec->last[i] = _mm256_set1_epi16( ranges->last[i] );
+        vec->delta[i] = _mm256_set1_epi16( ranges->delta[i] );
+    }
+}
+
+/* map 16 chars through the ranges, set *miss if some are outside of them */
+static inline __m256i __attribute__((target("avx2"))) avx2_map_ranges( const struct avx2_ranges *ranges,
+                                                                       __m256i v, __m256i *miss )
+{
+    __m256i zero = _mm256_setzero_si256(), found = zero, delta = zero;
+    unsigned int i;
+
+    for (i = 0; i < ranges->count; i++)
+    {
+        __m256i offset = _mm256_sub_epi16( v, ranges->first[i] );
+        __m256i in = _mm256_cmpeq_epi16( _mm256_subs_epu16( offset, ranges->last[i] ), zero );
+
+        found = _mm256_or_si256( found, in );
+        delta = _mm256_or_si256( delta, _mm256_and_si256( in, ranges->delta[i] ));
+    }
+    *miss = _mm256_or_si256( *miss, _mm256_cmpeq_epi16( found, zero ));
+    return _mm256_add_epi16( v, delta );
+}
+
+static unsigned int __attribute__((target("avx2"))) wcstombs_sbcs_avx2( const struct sbcs_ranges *ranges,
+                                                                        const WCHAR *src,
+                                                                        unsigned int srclen, char *dst )
+{
+    const __m256i high = _mm256_set1_epi16( (short)0xff80 );
+    struct avx2_ranges vec;
+    unsigned int pos;
+
+    avx2_get_ranges( ranges, &vec );
+    for (pos = 0; pos + 32 <= srclen; pos += 32)
+    {
+        __m256i lo = _mm256_loadu_si256( (const __m256i *)(src + pos) );
+        __m256i hi = _mm256_loadu_si256( (const __m256i *)(src + pos + 16) );
+        __m256i miss = _mm256_setzero_si256();
+
+        if (!ranges->ascii || !_mm256_testz_si256( _mm256_or_si256( lo, hi ), high ))
+        {
+            lo = avx2_map_ranges( &vec, lo, &miss );
+            hi = avx2_map_ranges( &vec, hi, &miss );
+            if (!_mm256_testz_si256( miss, miss )) break;
+        }
+        /* packing works within 128-bit lanes, put the quarters back in order */
+        _mm256_storeu_si256( (__m256i *)(dst + pos),
+                             _mm256_permute4x64_epi64( _mm256_packus_epi16( lo, hi ), 0xd8 ));
+    }
+    return pos;
+}
+
+static const struct sbcs_funcs sbcs_funcs_sse2 = { wcstombs_sbcs_sse2 };
+static const struct sbcs_funcs sbcs_funcs_avx2 = { wcstombs_sbcs_avx2 };
+
+#endif  /* SIMD_USE_X86 */
+
+#ifdef SIMD_USE_NEON
+
+/* map 8 chars through the ranges, set *miss if some are outside of them */
+static inline uint16x8_t neon_map_ranges( const struct sbcs_ranges *ranges, uint16x8_t v, uint16x8_t *miss )
+{
+    uint16x8_t found = vdupq_n_u16( 0 ), delta = vdupq_n_u16( 0 );
+    unsigned int i;
+
+    for (i = 0; i < ranges->count; i++)
+    {
+        uint16x8_t in = vcleq_u16( vsubq_u16( v, vdupq_n_u16( ranges->first[i] )),
+                                   vdupq_n_u16( ranges->last[i] ));
+
+        found = vorrq_u16( found, in );
+        delta = vorrq_u16( delta, vandq_u16( in, vdupq_n_u16( ranges->delta[i] )));
+    }
+    *miss = vorrq_u16( *miss, vmvnq_u16( found ));
+    return vaddq_u16( v, delta );
+}
+
+static unsigned int wcstombs_sbcs_neon( const struct sbcs_ranges *ranges, const WCHAR *src,
+                                        unsigned int srclen, char *dst )
+{
+    unsigned int pos;
+
+    for (pos = 0; pos + 16 <= srclen; pos += 16)
+    {
+        uint16x8_t lo = vld1q_u16( src + pos );
+        uint16x8_t hi = vld1q_u16( src + pos + 8 );
+        uint16x8_t miss = vdupq_n_u16( 0 );
+
+        if (!ranges->ascii || vmaxvq_u16( vorrq_u16( lo, hi )) >= 0x80)
+        {
+            lo = neon_map_ranges( ranges, lo, &miss );
+            hi = neon_map_ranges( ranges, hi, &miss );
+            if (vmaxvq_u16( miss )) break;
+        }
+        vst1q_u8( (unsigned char *)dst + pos, vcombine_u8( vmovn_u16( lo ), vmovn_u16( hi )));
+    }
+    return pos;
+}
+
+static const struct sbcs_funcs sbcs_funcs_neon = { wcstombs_sbcs_neon };
+
+#endif  /* SIMD_USE_NEON */
+
+/* pick the kernels for the cpu we are running on */
+static const struct sbcs_funcs *get_sbcs_funcs(void)
+{
+    static const void * const sets[SIMD_LEVELS] = SIMD_FUNCS( &sbcs_funcs_scalar, &sbcs_funcs_sse2, NULL,
+                                                              &sbcs_funcs_avx2, &sbcs_funcs_neon );
+    static const void *funcs;
+
+    return simd_get_funcs( &funcs, sets );
+}
+
 /* wcstombs for single-byte code page */
 static inline int wcstombs_sbcs( const struct sbcs_table *table,
                                  const WCHAR *src, unsigned int srclen,
@@ -95,6 +387,8 @@ static inline int wcstombs_sbcs( const struct sbcs_table *table,
 {
     const unsigned char  * const uni2cp_low = table->uni2cp_low;
     const unsigned short * const uni2cp_high = table->uni2cp_high;
+    const struct sbcs_funcs *funcs = get_sbcs_funcs();
+    const struct sbcs_ranges *ranges;
     int ret = srclen;
 
     if (dstlen < srclen)
@@ -104,6 +398,26 @@ static inline int wcstombs_sbcs( const struct sbcs_table *table,
         ret = -1;
     }
 
+    if (srclen >= SBCS_VECTOR_MIN && funcs->wcstombs && (ranges = get_sbcs_ranges( table )))
+    {
+        unsigned int done, i, run = 16;
+
+        while (ranges->count)
+        {
+            done = funcs->wcstombs( ranges, src, srclen, dst );
+            src += done;
+            dst += done;
+            srclen -= done;
+            /* convert the chars outside of the ranges */
+            run = done ? 16 : run * 2;
+            if (run > 256 || srclen < run) break;  /* give up when vectors keep failing */
+            for (i = 0; i < run; i++) dst[i] = uni2cp_low[uni2cp_high[src[i] >> 8] + (src[i] & 0xff)];
+            src += run;
+            dst += run;
+            srclen -= run;
+        }
+    }
+
     while (srclen >= 16)
     {
         dst[0]  = uni2cp_low[uni2cp_high[src[0]  >> 8] + (src[0]  & 0xff)];
@@ -245,6 +559,36 @@ static inline WCHAR get_defchar_dbcs( const struct dbcs_table *table, const char
     return ((unsigned char)defchar[0] << 8) | (unsigned char)defchar[1];
 }
 
+/* Vector kernels for double-byte code pages
+ *
+ * ASCII maps to single bytes in the double-byte code pages as well, so runs
+ * of ASCII chars are narrowed (or counted) with vectors, and the scalar loop
+ * only sees the rest. This is left out of the slow loops that handle flags.
+ */
+
+/* below this, checking the ASCII mapping costs more than it saves */
+#define DBCS_VECTOR_MIN 64
+
+/* return where the scalar loops can start handing ASCII runs to the vectors,
+ * or the end of src if they can't */
+static const WCHAR *get_ascii_runs_start( const struct dbcs_table *table, const WCHAR *src,
+                                          unsigned int srclen )
+{
+    const unsigned short * const uni2cp_low = table->uni2cp_low;
+    const unsigned short * const uni2cp_high = table->uni2cp_high;
+    WCHAR wch;
+
+    if (srclen < DBCS_VECTOR_MIN || !get_ascii_funcs()->wcstombs) return src + srclen;
+    for (wch = 0; wch < 0x80; wch++) if (uni2cp_low[uni2cp_high[0] + wch] != wch) return src + srclen;
+    return src;
+}
+
+/* check whether an ASCII char starts a run that is worth trying the vectors on */
+static inline int is_ascii_run( const WCHAR *src, unsigned int srclen, const WCHAR *retry )
+{
+    return src >= retry && srclen >= 16 && (src[1] | src[2] | src[3]) < 0x80;
+}
+
 /* query necessary dst length for src string */
 static int get_length_dbcs( const struct dbcs_table *table, int flags,
                             const WCHAR *src, unsigned int srclen,
@@ -257,9 +601,23 @@ static int get_length_dbcs( const struct dbcs_table *table, int flags,
 
     if (!defchar && !used && !(flags & WC_COMPOSITECHECK))
     {
+        const struct ascii_funcs *funcs = get_ascii_funcs();
+        const WCHAR *retry = get_ascii_runs_start( table, src, srclen );
+        unsigned int done;
+
         for (len = 0; srclen; srclen--, src++, len++)
         {
-            if (uni2cp_low[uni2cp_high[*src >> 8] + (*src & 0xff)] & 0xff00) len++;
+            if (*src < 0x80 && is_ascii_run( src, srclen, retry ))
+            {
+                /* leave the ASCII run to the vectors, and the rest of a vector they stopped at to us */
+                done = funcs->wcstombs( src, srclen, NULL );
+                retry = src + done + 16;
+                if (!done) continue;
+                src += done - 1;
+                srclen -= done - 1;
+                len += done - 1;
+            }
+            else if (uni2cp_low[uni2cp_high[*src >> 8] + (*src & 0xff)] & 0xff00) len++;
         }
         return len;
     }
@@ -320,6 +678,9 @@ static inline int wcstombs_dbcs( const struct dbcs_table *table,
 {
     const unsigned short * const uni2cp_low = table->uni2cp_low;
     const unsigned short * const uni2cp_high = table->uni2cp_high;
+    const struct ascii_funcs *funcs = get_ascii_funcs();
+    const WCHAR *retry = get_ascii_runs_start( table, src, srclen );
+    unsigned int done;
     int len;
 
     for (len = dstlen; srclen && len; len--, srclen--, src++)
@@ -331,6 +692,20 @@ static inline int wcstombs_dbcs( const struct dbcs_table *table,
             len--;
             *dst++ = res >> 8;
         }
+        else if (*src < 0x80 && is_ascii_run( src, srclen, retry ))
+        {
+            /* leave the ASCII run to the vectors, and the rest of a vector they stopped at to us */
+            done = funcs->wcstombs( src, min( srclen, len ), dst );
+            retry = src + done + 16;
+            if (done)
+            {
+                src += done - 1;
+                dst += done;
+                srclen -= done - 1;
+                len -= done - 1;
+                continue;
+            }
+        }
         *dst++ = (char)res;
     }
     if (srclen) return -1;  /* overflow */
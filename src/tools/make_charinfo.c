@@ -0,0 +1,130 @@
+/*
+ * Generate the interleaved Unicode character properties table
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301, USA
+ */
+
+/*
+ * The separate two-level tables of wctype.c, casemap.c, digitmap.c and
+ * collation.c stay the source of truth, this merges them into one record
+ * per character and writes port/charinfo.c:
+ *
+ *   make_charinfo > port/charinfo.c
+ *
+ * The digit and compatibility folding offsets are only used by
+ * FoldString, so they go to a table of their own to keep the records
+ * small.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "wine/unicode.h"
+
+extern const unsigned short wine_wctype_table[];
+extern const WCHAR wine_casemap_lower[];
+extern const WCHAR wine_casemap_upper[];
+extern const WCHAR wine_digitmap[];
+extern const WCHAR wine_compatmap[];
+extern const unsigned int collation_table[];
+
+#define LOOKUP(table,ch) ((table)[(table)[(ch) >> 8] + ((ch) & 0xff)])
+
+static struct wine_char_info info_blocks[256][256];
+static unsigned char info_index[256];
+static unsigned int info_count;
+
+static WCHAR fold_blocks[256][256][2];
+static unsigned char fold_index[256];
+static unsigned int fold_count;
+
+/* add a block unless there is the same one already, return its index */
+static unsigned int add_block( void *blocks, unsigned int *count, const void *block, size_t size )
+{
+    unsigned int i;
+
+    /* the first block is always block 0, so that Latin-1 can be indexed directly */
+    for (i = 0; i < *count; i++) if (!memcmp( (char *)blocks + i * size, block, size )) return i;
+    memcpy( (char *)blocks + i * size, block, size );
+    return (*count)++;
+}
+
+static void dump_index( const char *attr, const char *name, const unsigned char *index )
+{
+    unsigned int i;
+
+    printf( "const unsigned char %s%s[256] =\n{\n", attr, name );
+    for (i = 0; i < 256; i++)
+        printf( "%s0x%02x,%s", i % 8 ? " " : "    ", index[i], i % 8 == 7 ? "\n" : "" );
+    printf( "};\n\n" );
+}
+
+int main(void)
+{
+    struct wine_char_info info[256];
+    WCHAR fold[256][2];
+    unsigned int i, j, ch;
+
+    for (i = 0; i < 256; i++)
+    {
+        memset( info, 0, sizeof(info) );
+        for (j = 0; j < 256; j++)
+        {
+            ch = (i << 8) | j;
+            info[j].type      = LOOKUP( wine_wctype_table, ch );
+            info[j].lower     = LOOKUP( wine_casemap_lower, ch );
+            info[j].upper     = LOOKUP( wine_casemap_upper, ch );
+            info[j].collation = LOOKUP( collation_table, ch );
+            fold[j][0] = LOOKUP( wine_digitmap, ch );
+            fold[j][1] = LOOKUP( wine_compatmap, ch );
+        }
+        info_index[i] = add_block( info_blocks, &info_count, info, sizeof(info) );
+        fold_index[i] = add_block( fold_blocks, &fold_count, fold, sizeof(fold) );
+    }
+
+    printf( "/* Unicode character properties, one record per character */\n" );
+    printf( "/* generated by make_charinfo from wctype.c, casemap.c, digitmap.c and collation.c */\n" );
+    printf( "/* DO NOT EDIT!! */\n\n" );
+    printf( "#include \"wine/unicode.h\"\n\n" );
+
+    dump_index( "", "wine_char_info_index", info_index );
+    printf( "const struct wine_char_info wine_char_info_table[%u] =\n{\n", info_count * 256 );
+    for (i = 0; i < info_count; i++)
+    {
+        printf( "    /* block %u */\n", i );
+        for (j = 0; j < 256; j++)
+        {
+            const struct wine_char_info *rec = &info_blocks[i][j];
+            printf( "    { 0x%04x, 0x%04x, 0x%04x, 0x%08x },\n",
+                    rec->type, rec->lower, rec->upper, rec->collation );
+        }
+    }
+    printf( "};\n\n" );
+
+    printf( "/* digit and compatibility folding offsets */\n" );
+    dump_index( "DECLSPEC_HIDDEN ", "wine_char_fold_index", fold_index );
+    printf( "const WCHAR DECLSPEC_HIDDEN wine_char_fold_table[%u][2] =\n{\n", fold_count * 256 );
+    for (i = 0; i < fold_count; i++)
+    {
+        printf( "    /* block %u */\n", i );
+        for (j = 0; j < 256; j += 4)
+            printf( "    { 0x%04x, 0x%04x }, { 0x%04x, 0x%04x }, { 0x%04x, 0x%04x }, { 0x%04x, 0x%04x },\n",
+                    fold_blocks[i][j][0], fold_blocks[i][j][1], fold_blocks[i][j + 1][0], fold_blocks[i][j + 1][1],
+                    fold_blocks[i][j + 2][0], fold_blocks[i][j + 2][1], fold_blocks[i][j + 3][0],
+                    fold_blocks[i][j + 3][1] );
+    }
+    printf( "};\n" );
+    return 0;
+}
@@ -0,0 +1,117 @@
+/*
+ * Write the code page tables into a single file
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301, USA
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "wine/unicode.h"
+#include "../port/cpblob.h"
+
+static unsigned char *blob;
+static unsigned int blob_size, blob_alloc;
+
+/* append data to the blob, return its offset */
+static unsigned int add_data( const void *data, unsigned int size )
+{
+    unsigned int pos = (blob_size + CPBLOB_ALIGN - 1) & ~(CPBLOB_ALIGN - 1);
+
+    if (pos + size > blob_alloc)
+    {
+        while (pos + size > blob_alloc) blob_alloc = blob_alloc ? blob_alloc * 2 : 65536;
+        if (!(blob = realloc( blob, blob_alloc )))
+        {
+            fprintf( stderr, "make_cpblob: out of memory\n" );
+            exit( 1 );
+        }
+    }
+    memset( blob + blob_size, 0, pos - blob_size );
+    memcpy( blob + pos, data, size );
+    blob_size = pos + size;
+    return pos;
+}
+
+int main( int argc, char *argv[] )
+{
+    struct cpblob_header header;
+    struct cpblob_entry *entries;
+    const union cptable *table;
+    unsigned int i, count;
+    FILE *f;
+
+    if (argc != 2)
+    {
+        fprintf( stderr, "usage: make_cpblob <output file>\n" );
+        return 1;
+    }
+
+    for (count = 0; wine_cp_enum_table( count ); count++) ;
+    entries = calloc( count, sizeof(*entries) );
+
+    /* the header and the entries come first, they are filled in at the end */
+    memset( &header, 0, sizeof(header) );
+    add_data( &header, sizeof(header) );
+    add_data( entries, count * sizeof(*entries) );
+
+    for (i = 0; i < count; i++)
+    {
+        struct cpblob_entry *entry = &entries[i];
+
+        table = wine_cp_enum_table( i );
+        entry->codepage         = table->info.codepage;
+        entry->char_size        = table->info.char_size;
+        entry->def_char         = table->info.def_char;
+        entry->def_unicode_char = table->info.def_unicode_char;
+        entry->name = add_data( table->info.name, strlen( table->info.name ) + 1 );
+        if (table->info.char_size == 1)
+        {
+            const struct sbcs_table *sbcs = &table->sbcs;
+
+            entry->cp2uni      = add_data( sbcs->cp2uni, 256 * sizeof(WCHAR) );
+            entry->cp2uni_ext  = add_data( sbcs->cp2uni_glyphs, 256 * sizeof(WCHAR) );
+            entry->uni2cp_low  = add_data( sbcs->uni2cp_low, cpblob_uni2cp_low_count( sbcs->uni2cp_high ));
+            entry->uni2cp_high = add_data( sbcs->uni2cp_high, 256 * sizeof(unsigned short) );
+        }
+        else
+        {
+            const struct dbcs_table *dbcs = &table->dbcs;
+
+            entry->cp2uni      = add_data( dbcs->cp2uni, cpblob_dbcs_cp2uni_count( dbcs->cp2uni_leadbytes )
+                                           * sizeof(WCHAR) );
+            entry->cp2uni_ext  = add_data( dbcs->cp2uni_leadbytes, 256 );
+            entry->uni2cp_low  = add_data( dbcs->uni2cp_low, cpblob_uni2cp_low_count( dbcs->uni2cp_high )
+                                           * sizeof(unsigned short) );
+            entry->uni2cp_high = add_data( dbcs->uni2cp_high, 256 * sizeof(unsigned short) );
+            memcpy( entry->lead_bytes, dbcs->lead_bytes, sizeof(entry->lead_bytes) );
+        }
+    }
+
+    header.magic   = CPBLOB_MAGIC;
+    header.version = CPBLOB_VERSION;
+    header.count   = count;
+    header.size    = blob_size;
+    memcpy( blob, &header, sizeof(header) );
+    memcpy( blob + sizeof(header), entries, count * sizeof(*entries) );
+
+    if (!(f = fopen( argv[1], "wb" )) || fwrite( blob, 1, blob_size, f ) != blob_size || fclose( f ))
+    {
+        fprintf( stderr, "make_cpblob: cannot write %s\n", argv[1] );
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,230 @@
+/*
+ * Unit test suite for directory change notification
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301, USA
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+
+#include "ntdll_test.h"
+
+#ifndef GetCurrentThread
+#define GetCurrentThread() ((HANDLE)~(ULONG_PTR)1)
+#endif
+
+static char test_dir[] = "/tmp/changeXXXXXX";
+
+/* directory handles are unix fds */
+static HANDLE open_test_dir(void)
+{
+    return ULongToHandle( open( test_dir, O_RDONLY | O_DIRECTORY ));
+}
+
+static void create_test_file( const char *name )
+{
+    char path[64];
+
+    sprintf( path, "%s/%s", test_dir, name );
+    close( open( path, O_WRONLY | O_CREAT, 0600 ));
+}
+
+/* size of a single record for a one character name */
+#define RECORD_SIZE (FIELD_OFFSET( FILE_NOTIFY_INFORMATION, FileName ) + sizeof(WCHAR))
+
+static void check_added( const void *buffer, const char *name )
+{
+    const FILE_NOTIFY_INFORMATION *info = buffer;
+    WCHAR nameW[16];
+    int i;
+
+    for (i = 0; name[i]; i++) nameW[i] = name[i];
+    ok( info->Action == FILE_ACTION_ADDED, "got action %u\n", info->Action );
+    ok( info->FileNameLength == i * sizeof(WCHAR), "got length %u\n", info->FileNameLength );
+    ok( !memcmp( info->FileName, nameW, i * sizeof(WCHAR) ), "wrong name\n" );
+}
+
+static void test_event(void)
+{
+    DWORD buffer[64];
+    IO_STATUS_BLOCK iosb;
+    LARGE_INTEGER timeout;
+    NTSTATUS status;
+    HANDLE dir, event;
+
+    dir = open_test_dir();
+    status = NtCreateEvent( &event, EVENT_ALL_ACCESS, NULL, NotificationEvent, FALSE );
+    ok( status == STATUS_SUCCESS, "NtCreateEvent failed %#x\n", status );
+
+    status = NtNotifyChangeDirectoryFile( dir, event, NULL, NULL, &iosb, buffer, sizeof(buffer),
+                                          FILE_NOTIFY_CHANGE_FILE_NAME, FALSE );
+    ok( status == STATUS_PENDING, "got %#x\n", status );
+
+    timeout.QuadPart = -100 * 10000;
+    status = NtWaitForSingleObject( event, FALSE, &timeout );
+    ok( status == STATUS_TIMEOUT, "got %#x\n", status );
+
+    create_test_file( "a" );
+    timeout.QuadPart = -2000 * 10000;
+    status = NtWaitForSingleObject( event, FALSE, &timeout );
+    ok( status == STATUS_SUCCESS, "got %#x\n", status );
+    ok( iosb.Status == STATUS_SUCCESS, "got %#x\n", iosb.Status );
+    ok( iosb.Information == RECORD_SIZE, "got %lu\n", iosb.Information );
+    check_added( buffer, "a" );
+
+    /* a pending request is completed when the handle is closed */
+    status = NtNotifyChangeDirectoryFile( dir, event, NULL, NULL, &iosb, buffer, sizeof(buffer),
+                                          FILE_NOTIFY_CHANGE_FILE_NAME, FALSE );
+    ok( status == STATUS_PENDING, "got %#x\n", status );
+    NtClose( dir );
+    status = NtWaitForSingleObject( event, FALSE, &timeout );
+    ok( status == STATUS_SUCCESS, "got %#x\n", status );
+    ok( iosb.Status == STATUS_NOTIFY_CLEANUP, "got %#x\n", iosb.Status );
+
+    NtClose( event );
+}
+
+static int apc_count;
+static IO_STATUS_BLOCK *apc_iosb;
+
+static void WINAPI change_apc( void *arg, IO_STATUS_BLOCK *iosb, ULONG reserved )
+{
+    apc_count++;
+    apc_iosb = iosb;
+    ok( arg == (void *)0xdeadbeef, "got arg %p\n", arg );
+}
+
+static void test_apc(void)
+{
+    DWORD buffer[64];
+    IO_STATUS_BLOCK iosb;
+    LARGE_INTEGER timeout;
+    NTSTATUS status;
+    HANDLE dir;
+
+    dir = open_test_dir();
+    status = NtNotifyChangeDirectoryFile( dir, NULL, change_apc, (void *)0xdeadbeef, &iosb, buffer,
+                                          sizeof(buffer), FILE_NOTIFY_CHANGE_FILE_NAME, FALSE );
+    ok( status == STATUS_PENDING, "got %#x\n", status );
+
+    create_test_file( "b" );
+    /* the APC is queued to this thread, not called on the notification thread */
+    timeout.QuadPart = -300 * 10000;
+    NtDelayExecution( FALSE, &timeout );
+    ok( apc_count == 0, "APC called %d times\n", apc_count );
+
+    status = NtDelayExecution( TRUE, &timeout );
+    ok( status == STATUS_USER_APC, "got %#x\n", status );
+    ok( apc_count == 1, "APC called %d times\n", apc_count );
+    ok( apc_iosb == &iosb, "got iosb %p\n", apc_iosb );
+    ok( iosb.Status == STATUS_SUCCESS, "got %#x\n", iosb.Status );
+    check_added( buffer, "b" );
+
+    NtClose( dir );
+}
+
+static int user_apc_count;
+
+static void CALLBACK user_apc( ULONG_PTR arg )
+{
+    user_apc_count++;
+}
+
+static void *create_file_thread( void *arg )
+{
+    usleep( 200000 );
+    create_test_file( arg );
+    return NULL;
+}
+
+static void test_ReadDirectoryChangesW(void)
+{
+    pthread_t thread;
+    DWORD buffer[64], count;
+    OVERLAPPED ov;
+    HANDLE dir;
+    BOOL ret;
+
+    dir = open_test_dir();
+    SetLastError( 0xdeadbeef );
+    ret = ReadDirectoryChangesW( dir, buffer, sizeof(buffer), FALSE, 0, &count, NULL, NULL );
+    ok( !ret && GetLastError() == ERROR_INVALID_PARAMETER, "got %d, error %u\n", ret, GetLastError() );
+
+    memset( &ov, 0, sizeof(ov) );
+    NtCreateEvent( &ov.hEvent, EVENT_ALL_ACCESS, NULL, NotificationEvent, FALSE );
+    ret = ReadDirectoryChangesW( dir, buffer, sizeof(buffer), FALSE, FILE_NOTIFY_CHANGE_FILE_NAME,
+                                 NULL, &ov, NULL );
+    ok( ret, "ReadDirectoryChangesW failed %u\n", GetLastError() );
+    create_test_file( "c" );
+    ok( WaitForSingleObject( ov.hEvent, 2000 ) == WAIT_OBJECT_0, "event not signaled\n" );
+    ok( ov.Internal == STATUS_SUCCESS, "got %#lx\n", ov.Internal );
+    check_added( buffer, "c" );
+    NtClose( ov.hEvent );
+
+    /* changes are queued between the calls, so this one doesn't block */
+    create_test_file( "d" );
+    count = 0;
+    ret = ReadDirectoryChangesW( dir, buffer, sizeof(buffer), FALSE, FILE_NOTIFY_CHANGE_FILE_NAME,
+                                 &count, NULL, NULL );
+    ok( ret, "ReadDirectoryChangesW failed %u\n", GetLastError() );
+    ok( count == RECORD_SIZE, "got %u\n", count );
+    check_added( buffer, "d" );
+
+    /* a pending APC doesn't interrupt the synchronous wait */
+    ok( QueueUserAPC( user_apc, GetCurrentThread(), 0 ), "QueueUserAPC failed %u\n", GetLastError() );
+    pthread_create( &thread, NULL, create_file_thread, (void *)"e" );
+    count = 0;
+    ret = ReadDirectoryChangesW( dir, buffer, sizeof(buffer), FALSE, FILE_NOTIFY_CHANGE_FILE_NAME,
+                                 &count, NULL, NULL );
+    ok( ret, "ReadDirectoryChangesW failed %u\n", GetLastError() );
+    ok( count == RECORD_SIZE, "got %u\n", count );
+    check_added( buffer, "e" );
+    ok( user_apc_count == 0, "APC called %d times\n", user_apc_count );
+    pthread_join( thread, NULL );
+    ok( SleepEx( 0, TRUE ) == WAIT_IO_COMPLETION, "APC not delivered\n" );
+    ok( user_apc_count == 1, "APC called %d times\n", user_apc_count );
+
+    NtClose( dir );
+}
+
+static void remove_test_dir(void)
+{
+    static const char *names[] = { "a", "b", "c", "d", "e" };
+    char path[64];
+    int i;
+
+    for (i = 0; i < sizeof(names) / sizeof(names[0]); i++)
+    {
+        sprintf( path, "%s/%s", test_dir, names[i] );
+        unlink( path );
+    }
+    rmdir( test_dir );
+}
+
+START_TEST(change)
+{
+    if (!mkdtemp( test_dir ))
+    {
+        skip( "can't create %s\n", test_dir );
+        return;
+    }
+    test_event();
+    test_apc();
+    test_ReadDirectoryChangesW();
+    remove_test_dir();
+}
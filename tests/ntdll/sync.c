@@ -0,0 +1,315 @@
+/*
+ * Unit test suite for ntdll synchronization functions
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301, USA
+ */
+
+#include <time.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+
+#include "ntdll_test.h"
+
+#ifndef GetCurrentThread
+#define GetCurrentThread() ((HANDLE)~(ULONG_PTR)1)
+#endif
+#define ARRAY_SIZE(x) (sizeof(x) / sizeof((x)[0]))
+
+static void test_condition_variable_timeout(void)
+{
+    RTL_CONDITION_VARIABLE variable;
+    RTL_CRITICAL_SECTION cs;
+    RTL_SRWLOCK lock;
+    LARGE_INTEGER timeout;
+    NTSTATUS status;
+    DWORD start, elapsed;
+
+    RtlInitializeConditionVariable( &variable );
+    RtlInitializeSRWLock( &lock );
+    RtlInitializeCriticalSection( &cs );
+
+    timeout.QuadPart = -300 * 10000;
+    RtlAcquireSRWLockExclusive( &lock );
+    start = GetTickCount();
+    status = RtlSleepConditionVariableSRW( &variable, &lock, &timeout, 0 );
+    elapsed = GetTickCount() - start;
+    RtlReleaseSRWLockExclusive( &lock );
+    ok( status == STATUS_TIMEOUT, "got %#x\n", status );
+    ok( elapsed >= 250 && elapsed < 2000, "SRW wait took %u ms\n", elapsed );
+
+    RtlEnterCriticalSection( &cs );
+    start = GetTickCount();
+    status = RtlSleepConditionVariableCS( &variable, &cs, &timeout );
+    elapsed = GetTickCount() - start;
+    RtlLeaveCriticalSection( &cs );
+    ok( status == STATUS_TIMEOUT, "got %#x\n", status );
+    ok( elapsed >= 250 && elapsed < 2000, "CS wait took %u ms\n", elapsed );
+
+    /* absolute timeouts are in system time */
+    NtQuerySystemTime( &timeout );
+    timeout.QuadPart += 300 * 10000;
+    RtlAcquireSRWLockShared( &lock );
+    start = GetTickCount();
+    status = RtlSleepConditionVariableSRW( &variable, &lock, &timeout, CONDITION_VARIABLE_LOCKMODE_SHARED );
+    elapsed = GetTickCount() - start;
+    RtlReleaseSRWLockShared( &lock );
+    ok( status == STATUS_TIMEOUT, "got %#x\n", status );
+    ok( elapsed >= 250 && elapsed < 2000, "absolute SRW wait took %u ms\n", elapsed );
+
+    RtlDeleteCriticalSection( &cs );
+}
+
+static void test_wait_on_address_timeout(void)
+{
+    LONG address = 0, compare = 0;
+    LARGE_INTEGER timeout;
+    NTSTATUS status;
+    DWORD start, elapsed;
+    BOOL ret;
+
+    timeout.QuadPart = -300 * 10000;
+    start = GetTickCount();
+    status = RtlWaitOnAddress( &address, &compare, sizeof(address), &timeout );
+    elapsed = GetTickCount() - start;
+    ok( status == STATUS_TIMEOUT, "got %#x\n", status );
+    ok( elapsed >= 250 && elapsed < 2000, "wait took %u ms\n", elapsed );
+
+    SetLastError( 0xdeadbeef );
+    start = GetTickCount();
+    ret = WaitOnAddress( &address, &compare, sizeof(address), 300 );
+    elapsed = GetTickCount() - start;
+    ok( !ret && GetLastError() == ERROR_TIMEOUT, "got %d, error %u\n", ret, GetLastError() );
+    ok( elapsed >= 250 && elapsed < 2000, "WaitOnAddress took %u ms\n", elapsed );
+
+    /* no wait at all when the value already differs */
+    compare = 1;
+    start = GetTickCount();
+    status = RtlWaitOnAddress( &address, &compare, sizeof(address), &timeout );
+    elapsed = GetTickCount() - start;
+    ok( status == STATUS_SUCCESS, "got %#x\n", status );
+    ok( elapsed < 250, "wait took %u ms\n", elapsed );
+}
+
+static int timer_apc_count;
+static void *timer_apc_arg;
+
+static void CALLBACK timer_apc( void *arg, ULONG low, LONG high )
+{
+    timer_apc_count++;
+    timer_apc_arg = arg;
+}
+
+static void test_timer_apc(void)
+{
+    LARGE_INTEGER when, timeout;
+    NTSTATUS status;
+    HANDLE timer;
+    DWORD start, elapsed;
+
+    status = NtCreateTimer( &timer, TIMER_ALL_ACCESS, NULL, NotificationTimer );
+    ok( status == STATUS_SUCCESS, "NtCreateTimer failed %#x\n", status );
+
+    when.QuadPart = -100 * 10000;
+    status = NtSetTimer( timer, &when, timer_apc, (void *)0xdeadbeef, FALSE, 0, NULL );
+    ok( status == STATUS_SUCCESS, "NtSetTimer failed %#x\n", status );
+    timeout.QuadPart = -2000 * 10000;
+    start = GetTickCount();
+    status = NtDelayExecution( TRUE, &timeout );
+    elapsed = GetTickCount() - start;
+    ok( status == STATUS_USER_APC, "got %#x\n", status );
+    ok( elapsed >= 50 && elapsed < 1000, "wait took %u ms\n", elapsed );
+    ok( timer_apc_count == 1, "APC called %d times\n", timer_apc_count );
+    ok( timer_apc_arg == (void *)0xdeadbeef, "got arg %p\n", timer_apc_arg );
+
+    /* the APC is queued when the timer fires, not when the thread gets alertable */
+    status = NtSetTimer( timer, &when, timer_apc, NULL, FALSE, 0, NULL );
+    ok( status == STATUS_SUCCESS, "NtSetTimer failed %#x\n", status );
+    timeout.QuadPart = -300 * 10000;
+    NtDelayExecution( FALSE, &timeout );
+    ok( timer_apc_count == 1, "APC called %d times\n", timer_apc_count );
+    NtTestAlert();
+    ok( timer_apc_count == 2, "APC called %d times\n", timer_apc_count );
+
+    /* a cancelled timer doesn't queue it */
+    status = NtSetTimer( timer, &when, timer_apc, NULL, FALSE, 0, NULL );
+    ok( status == STATUS_SUCCESS, "NtSetTimer failed %#x\n", status );
+    NtCancelTimer( timer, NULL );
+    status = NtDelayExecution( TRUE, &timeout );
+    ok( status == STATUS_SUCCESS, "got %#x\n", status );
+    ok( timer_apc_count == 2, "APC called %d times\n", timer_apc_count );
+
+    /* neither does a closed one, while another timer still works */
+    status = NtSetTimer( timer, &when, timer_apc, (void *)1, FALSE, 0, NULL );
+    ok( status == STATUS_SUCCESS, "NtSetTimer failed %#x\n", status );
+    NtClose( timer );
+    status = NtCreateTimer( &timer, TIMER_ALL_ACCESS, NULL, NotificationTimer );
+    ok( status == STATUS_SUCCESS, "NtCreateTimer failed %#x\n", status );
+    when.QuadPart = -200 * 10000;
+    status = NtSetTimer( timer, &when, timer_apc, (void *)2, FALSE, 0, NULL );
+    ok( status == STATUS_SUCCESS, "NtSetTimer failed %#x\n", status );
+    timeout.QuadPart = -500 * 10000;
+    status = NtDelayExecution( TRUE, &timeout );
+    ok( status == STATUS_USER_APC, "got %#x\n", status );
+    ok( timer_apc_count == 3, "APC called %d times\n", timer_apc_count );
+    ok( timer_apc_arg == (void *)2, "got arg %p\n", timer_apc_arg );
+
+    NtClose( timer );
+}
+
+static int user_apc_calls[4], user_apc_count;
+
+static void CALLBACK user_apc( ULONG_PTR arg )
+{
+    if (user_apc_count < ARRAY_SIZE(user_apc_calls)) user_apc_calls[user_apc_count] = arg;
+    user_apc_count++;
+}
+
+/* there are no thread handles, APCs can only be queued to the current thread */
+static void test_user_apc(void)
+{
+    DWORD ret;
+
+    ok( QueueUserAPC( user_apc, GetCurrentThread(), 1 ), "QueueUserAPC failed %u\n", GetLastError() );
+    ok( QueueUserAPC( user_apc, GetCurrentThread(), 2 ), "QueueUserAPC failed %u\n", GetLastError() );
+    SetLastError( 0xdeadbeef );
+    ok( !QueueUserAPC( user_apc, ULongToHandle( 0x1234 ), 3 ), "QueueUserAPC succeeded\n" );
+    ok( GetLastError() == ERROR_INVALID_HANDLE, "got error %u\n", GetLastError() );
+
+    ret = SleepEx( 0, FALSE );
+    ok( !ret && !user_apc_count, "got %u, APC called %d times\n", ret, user_apc_count );
+    ret = SleepEx( 1000, TRUE );
+    ok( ret == WAIT_IO_COMPLETION, "got %u\n", ret );
+    ok( user_apc_count == 2, "APC called %d times\n", user_apc_count );
+    ok( user_apc_calls[0] == 1 && user_apc_calls[1] == 2, "APCs called in order %d %d\n",
+        user_apc_calls[0], user_apc_calls[1] );
+    ok( !SleepEx( 0, TRUE ), "APC called again\n" );
+}
+
+/* the name of an object stays as long as any process has a handle to it */
+static void test_named_object_fork(void)
+{
+    static const char name[] = "otowi_test_fork_event";
+    int pipe_fds[2], status;
+    HANDLE event, event2;
+    pid_t pid;
+    char ch;
+
+    event = CreateEventA( NULL, TRUE, FALSE, name );
+    ok( event != NULL, "CreateEvent failed %u\n", GetLastError() );
+    event2 = OpenEventA( EVENT_ALL_ACCESS, FALSE, name );
+    ok( event2 != NULL, "OpenEvent failed %u\n", GetLastError() );
+    pipe( pipe_fds );
+
+    if (!(pid = fork()))
+    {
+        /* the inherited handles keep the name after the parent closed its own */
+        HANDLE event3;
+
+        read( pipe_fds[0], &ch, 1 );
+        if (!(event3 = OpenEventA( EVENT_ALL_ACCESS, FALSE, name ))) _exit( 1 );
+        NtClose( event3 );
+        NtClose( event );
+        NtClose( event2 );
+        _exit( 0 );
+    }
+    ok( pid > 0, "fork failed\n" );
+    NtClose( event );
+    NtClose( event2 );
+    write( pipe_fds[1], "x", 1 );
+    waitpid( pid, &status, 0 );
+    ok( WIFEXITED( status ) && !WEXITSTATUS( status ), "name removed while the child had handles\n" );
+    close( pipe_fds[0] );
+    close( pipe_fds[1] );
+
+    /* and goes away with the last one, here in the child */
+    ok( !OpenEventA( EVENT_ALL_ACCESS, FALSE, name ), "name still exists\n" );
+}
+
+static ULONGLONG monotonic_us(void)
+{
+    struct timespec ts;
+
+    clock_gettime( CLOCK_MONOTONIC, &ts );
+    return ts.tv_sec * (ULONGLONG)1000000 + ts.tv_nsec / 1000;
+}
+
+/* a wait mixed with other handles wakes up when another process signals an object */
+static void test_mixed_wait_fork(void)
+{
+    static const char name[] = "otowi_test_mixed_event";
+    volatile ULONGLONG *set_time;
+    int ctl_fds[2], pipe_fds[2], i, slow = 0, status;
+    ULONGLONG latency, max_latency = 0;
+    HANDLE event, handles[2];
+    DWORD ret;
+    pid_t pid;
+    char ch;
+
+    set_time = mmap( NULL, sizeof(*set_time), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0 );
+    ok( set_time != MAP_FAILED, "mmap failed\n" );
+    if (set_time == MAP_FAILED) return;
+    event = CreateEventA( NULL, FALSE, FALSE, name );
+    ok( event != NULL, "CreateEvent failed %u\n", GetLastError() );
+    pipe( ctl_fds );
+    pipe( pipe_fds );
+
+    if (!(pid = fork()))
+    {
+        close( ctl_fds[1] );
+        while (read( ctl_fds[0], &ch, 1 ) == 1)
+        {
+            usleep( 2000 );
+            *set_time = monotonic_us();
+            SetEvent( event );
+        }
+        _exit( 0 );
+    }
+    ok( pid > 0, "fork failed\n" );
+    if (pid <= 0) return;
+
+    handles[0] = ULongToHandle( pipe_fds[0] );
+    handles[1] = event;
+    for (i = 0; i < 20; i++)
+    {
+        write( ctl_fds[1], "x", 1 );
+        ret = WaitForMultipleObjects( 2, handles, FALSE, 1000 );
+        latency = monotonic_us() - *set_time;
+        if (ret != WAIT_OBJECT_0 + 1) break;
+        if (latency > 4000) slow++;
+        max_latency = max( max_latency, latency );
+    }
+    ok( ret == WAIT_OBJECT_0 + 1, "got %u\n", ret );
+    /* without a wake-up from the other process, the wait only notices the event when it checks again */
+    ok( slow < 5, "%d slow wake-ups, up to %u us\n", slow, (unsigned int)max_latency );
+
+    close( ctl_fds[1] );
+    waitpid( pid, &status, 0 );
+    close( ctl_fds[0] );
+    close( pipe_fds[0] );
+    close( pipe_fds[1] );
+    NtClose( event );
+    munmap( (void *)set_time, sizeof(*set_time) );
+}
+
+START_TEST(sync)
+{
+    test_condition_variable_timeout();
+    test_wait_on_address_timeout();
+    test_timer_apc();
+    test_user_apc();
+    test_named_object_fork();
+    test_mixed_wait_fork();
+}
@@ -0,0 +1,189 @@
+/*
+ * Unit test suite for the time functions
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301, USA
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+
+#include "ntdll_test.h"
+#include "ddk/wdm.h"
+
+#define SHARED_DATA_ADDR ((void *)0x7ffe0000)
+#define SHARED_DATA_TICK 16  /* ms between shared data updates, rounded up */
+
+/* set in the child process that runs with the shared data address taken */
+static const char reserve_var[] = "TIME_TEST_RESERVE_SHARED_DATA";
+static void *reserved;
+
+/* runs before main() initializes the library, so that the library can't get the address */
+static void __attribute__((constructor)) reserve_shared_data(void)
+{
+    if (!getenv( reserve_var )) return;
+    reserved = mmap( SHARED_DATA_ADDR, 0x10000, PROT_READ, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0 );
+    if (reserved != SHARED_DATA_ADDR) reserved = NULL;
+}
+
+static ULONGLONG monotonic_ms( clockid_t clock )
+{
+    struct timespec ts;
+
+    clock_gettime( clock, &ts );
+    return ts.tv_sec * (ULONGLONG)1000 + ts.tv_nsec / 1000000;
+}
+
+static void test_monotonic(void)
+{
+    LARGE_INTEGER counter, prev_counter;
+    ULONGLONG tick, prev_tick;
+    int i;
+
+    QueryPerformanceCounter( &prev_counter );
+    prev_tick = GetTickCount64();
+    for (i = 0; i < 1000000; i++)
+    {
+        /* give the scheduler a chance to move us to another CPU */
+        if (!(i % 1000)) sched_yield();
+        QueryPerformanceCounter( &counter );
+        tick = GetTickCount64();
+        if (counter.QuadPart < prev_counter.QuadPart || tick < prev_tick) break;
+        prev_counter = counter;
+        prev_tick = tick;
+    }
+    ok( counter.QuadPart >= prev_counter.QuadPart, "counter went back from %s to %s\n",
+        wine_dbgstr_longlong( prev_counter.QuadPart ), wine_dbgstr_longlong( counter.QuadPart ));
+    ok( tick >= prev_tick, "tick count went back from %s to %s\n",
+        wine_dbgstr_longlong( prev_tick ), wine_dbgstr_longlong( tick ));
+}
+
+static void test_performance_counter(void)
+{
+    LARGE_INTEGER frequency, start, end;
+    ULONGLONG start_ns, end_ns, elapsed_ns, counted_ns;
+    struct timespec ts;
+
+    ok( QueryPerformanceFrequency( &frequency ), "QueryPerformanceFrequency failed\n" );
+    ok( frequency.QuadPart > 0, "got frequency %s\n", wine_dbgstr_longlong( frequency.QuadPart ));
+
+    clock_gettime( CLOCK_MONOTONIC, &ts );
+    QueryPerformanceCounter( &start );
+    start_ns = ts.tv_sec * (ULONGLONG)1000000000 + ts.tv_nsec;
+    usleep( 100000 );
+    clock_gettime( CLOCK_MONOTONIC, &ts );
+    QueryPerformanceCounter( &end );
+    end_ns = ts.tv_sec * (ULONGLONG)1000000000 + ts.tv_nsec;
+
+    elapsed_ns = end_ns - start_ns;
+    counted_ns = (end.QuadPart - start.QuadPart) * 1000000000.0 / frequency.QuadPart;
+    ok( counted_ns > elapsed_ns - elapsed_ns / 100 && counted_ns < elapsed_ns + elapsed_ns / 100,
+        "counter measured %s ns, CLOCK_MONOTONIC %s ns\n",
+        wine_dbgstr_longlong( counted_ns ), wine_dbgstr_longlong( elapsed_ns ));
+}
+
+static void test_user_shared_data(void)
+{
+    KSHARED_USER_DATA *user_shared_data = SHARED_DATA_ADDR;
+    ULONGLONG tick, shared_tick, interrupt_time, now, prev;
+    ULONG high;
+    int i;
+
+    for (i = 0; i < 5; i++)
+    {
+        prev = GetTickCount64();
+        do
+        {
+            high = user_shared_data->TickCount.High1Time;
+            shared_tick = (ULONGLONG)high << 32 | user_shared_data->TickCount.LowPart;
+        }
+        while (high != user_shared_data->TickCount.High2Time);
+        tick = GetTickCount64();
+        ok( prev <= shared_tick && shared_tick <= tick, "shared tick count %s, GetTickCount64 %s-%s\n",
+            wine_dbgstr_longlong( shared_tick ), wine_dbgstr_longlong( prev ), wine_dbgstr_longlong( tick ));
+
+        /* the shared data lags behind by up to one update interval */
+        now = monotonic_ms( CLOCK_MONOTONIC );
+        ok( shared_tick <= now && now - shared_tick <= 2 * SHARED_DATA_TICK,
+            "shared tick count %s, CLOCK_MONOTONIC %s\n",
+            wine_dbgstr_longlong( shared_tick ), wine_dbgstr_longlong( now ));
+        do
+        {
+            high = user_shared_data->InterruptTime.High1Time;
+            interrupt_time = (ULONGLONG)high << 32 | user_shared_data->InterruptTime.LowPart;
+        }
+        while (high != user_shared_data->InterruptTime.High2Time);
+        ok( interrupt_time / 10000 <= now && now - interrupt_time / 10000 <= 2 * SHARED_DATA_TICK,
+            "interrupt time %s, CLOCK_MONOTONIC %s\n",
+            wine_dbgstr_longlong( interrupt_time ), wine_dbgstr_longlong( now ));
+        ok( user_shared_data->TickCountLowDeprecated - (ULONG)shared_tick <= SHARED_DATA_TICK,
+            "got deprecated tick count %u, expected %u\n", user_shared_data->TickCountLowDeprecated,
+            (ULONG)shared_tick );
+        usleep( 30000 );
+    }
+}
+
+/* the time functions read the clock when the shared data can't be mapped at its address */
+static void test_shared_data_fallback(void)
+{
+    ULONGLONG tick, now;
+    char *argv[2];
+    int status;
+    pid_t pid;
+
+    if (reserved)
+    {
+        ok( !((KSHARED_USER_DATA *)SHARED_DATA_ADDR)->TickCountMultiplier, "shared data was mapped\n" );
+        test_monotonic();
+        test_performance_counter();
+        tick = GetTickCount64();
+        now = monotonic_ms( CLOCK_MONOTONIC );
+        ok( tick <= now && now - tick <= 2 * SHARED_DATA_TICK, "GetTickCount64 %s, CLOCK_MONOTONIC %s\n",
+            wine_dbgstr_longlong( tick ), wine_dbgstr_longlong( now ));
+        return;
+    }
+
+    /* run this test again in a process that has the address taken before the library initializes */
+    if (!(pid = fork()))
+    {
+        argv[0] = (char *)winetest_argv[0];
+        argv[1] = NULL;
+        setenv( reserve_var, "1", 1 );
+        execv( "/proc/self/exe", argv );
+        _exit( 127 );
+    }
+    ok( pid > 0, "fork failed\n" );
+    if (pid <= 0) return;
+    waitpid( pid, &status, 0 );
+    ok( WIFEXITED( status ) && !WEXITSTATUS( status ), "child failed with status %#x\n", status );
+}
+
+START_TEST(time)
+{
+    if (getenv( reserve_var ))
+    {
+        ok( reserved != NULL, "failed to reserve %p\n", SHARED_DATA_ADDR );
+        if (reserved) test_shared_data_fallback();
+        return;
+    }
+    test_monotonic();
+    test_performance_counter();
+    test_user_shared_data();
+    test_shared_data_fallback();
+}
@@ -0,0 +1,469 @@
+/*
+ * Unit test suite for the vector string and code page routines
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301, USA
+ */
+
+/*
+ * The vector kernels only run on long strings. Each test converts or
+ * compares random strings in one call and checks the result against
+ * short calls, which stay on the scalar code, or against a plain
+ * reference implementation.
+ */
+
+#include <stdarg.h>
+
+#include "ntstatus.h"
+#define WIN32_NO_STATUS
+#include "windef.h"
+#include "winbase.h"
+#include "winnls.h"
+#include "winternl.h"
+/* wine/test.h refuses wine/unicode.h, but this tests the library behind it */
+#include "wine/unicode.h"
+#undef __WINE_WINE_UNICODE_H
+#include "wine/test.h"
+
+#define ARRAY_SIZE(x) (sizeof(x) / sizeof((x)[0]))
+
+#define MAX_LEN 300
+#define ITERATIONS 2000
+
+static unsigned int seed = 12345;
+
+/* deterministic, so that failures can be reproduced */
+static unsigned int rand_int( unsigned int max )
+{
+    seed = seed * 1103515245 + 12345;
+    return (seed >> 16) % max;
+}
+
+/* chars with and without case mappings and collation weights */
+static WCHAR rand_char(void)
+{
+    static const WCHAR punct[] = { ' ', '-', '\'', '.', ',', '!' };
+
+    switch (rand_int( 8 ))
+    {
+    case 0: return 0x80 + rand_int( 0x80 );   /* Latin-1 */
+    case 1: return 0x391 + rand_int( 0x39 );  /* Greek */
+    case 2: return 0x410 + rand_int( 0x50 );  /* Cyrillic */
+    case 3: return punct[rand_int( ARRAY_SIZE(punct) )];
+    case 4: return '0' + rand_int( 10 );
+    default: return (rand_int( 2 ) ? 'a' : 'A') + rand_int( 26 );
+    }
+}
+
+/* a string of random length made of ASCII runs of up to run_max chars and other chars */
+static int rand_string( WCHAR *str, int run_max, WCHAR (*get_other)(void) )
+{
+    int i, run, len = rand_int( MAX_LEN );
+
+    for (i = 0; i < len; )
+    {
+        for (run = rand_int( run_max + 1 ); run && i < len; run--) str[i++] = 0x20 + rand_int( 0x5f );
+        if (i < len) str[i++] = get_other();
+    }
+    str[len] = 0;
+    return len;
+}
+
+static int sign( int val )
+{
+    return val < 0 ? -1 : val > 0;
+}
+
+static WCHAR rand_utf16(void)
+{
+    switch (rand_int( 5 ))
+    {
+    case 0: return 0x80 + rand_int( 0x780 );       /* 2 bytes */
+    case 1: return 0x800 + rand_int( 0xd000 );     /* 3 bytes */
+    case 2: return 0xd800 + rand_int( 0x800 );     /* surrogate, paired or not */
+    case 3: return 0xe000 + rand_int( 0x2000 );
+    default: return rand_int( 0x80 );
+    }
+}
+
+/* convert a string in pieces that start at an ASCII char, so that no ASCII run is long enough for a kernel */
+static int utf8_wcstombs_pieces( int flags, const WCHAR *src, int srclen, char *dst )
+{
+    int i, start, ret, total = 0;
+
+    for (start = 0; start < srclen; start = i)
+    {
+        for (i = start + 1; i < srclen && src[i] >= 0x80; i++) ;
+        if ((ret = wine_utf8_wcstombs( flags, src + start, i - start, dst ? dst + total : NULL,
+                                       dst ? 4 * MAX_LEN - total : 0 )) < 0) return ret;
+        total += ret;
+    }
+    return total;
+}
+
+static int utf8_mbstowcs_pieces( int flags, const char *src, int srclen, WCHAR *dst )
+{
+    int i, start, ret, total = 0;
+
+    for (start = 0; start < srclen; start = i)
+    {
+        for (i = start + 1; i < srclen && (unsigned char)src[i] >= 0x80; i++) ;
+        if ((ret = wine_utf8_mbstowcs( flags, src + start, i - start, dst ? dst + total : NULL,
+                                       dst ? MAX_LEN - total : 0 )) < 0) return ret;
+        total += ret;
+    }
+    return total;
+}
+
+static void test_utf8(void)
+{
+    static const int flags[] = { 0, MB_ERR_INVALID_CHARS };
+    WCHAR wstr[MAX_LEN + 1], wbuf[MAX_LEN], wref[MAX_LEN];
+    char str[4 * MAX_LEN], buf[4 * MAX_LEN], ref[4 * MAX_LEN];
+    int i, j, len, srclen, ret, expect;
+
+    for (i = 0; i < ITERATIONS; i++)
+    {
+        srclen = rand_string( wstr, 80, rand_utf16 );
+        for (j = 0; j < ARRAY_SIZE(flags); j++)
+        {
+            expect = utf8_wcstombs_pieces( flags[j], wstr, srclen, ref );
+            ret = wine_utf8_wcstombs( flags[j], wstr, srclen, NULL, 0 );
+            ok( ret == expect, "%d: length %d, expected %d\n", i, ret, expect );
+            ret = wine_utf8_wcstombs( flags[j], wstr, srclen, buf, sizeof(buf) );
+            ok( ret == expect, "%d: got %d, expected %d\n", i, ret, expect );
+            if (ret > 0) ok( !memcmp( buf, ref, ret ), "%d: wrong conversion\n", i );
+        }
+
+        /* the UTF-8 of the string, with random bytes thrown in to make it invalid */
+        len = wine_utf8_wcstombs( 0, wstr, srclen, str, sizeof(str) );
+        for (j = rand_int( 3 ); j; j--) if (len) str[rand_int( len )] = 0x80 + rand_int( 0x80 );
+        len = min( len, MAX_LEN );
+        for (j = 0; j < ARRAY_SIZE(flags); j++)
+        {
+            expect = utf8_mbstowcs_pieces( flags[j], str, len, wref );
+            ret = wine_utf8_mbstowcs( flags[j], str, len, NULL, 0 );
+            ok( ret == expect, "%d: length %d, expected %d\n", i, ret, expect );
+            ret = wine_utf8_mbstowcs( flags[j], str, len, wbuf, ARRAY_SIZE(wbuf) );
+            ok( ret == expect, "%d: got %d, expected %d\n", i, ret, expect );
+            if (ret > 0) ok( !memcmp( wbuf, wref, ret * sizeof(WCHAR) ), "%d: wrong conversion\n", i );
+        }
+    }
+}
+
+static const union cptable *sbcs_table;
+
+/* mostly chars the code page has, some it doesn't */
+static WCHAR rand_sbcs_char(void)
+{
+    if (!rand_int( 8 )) return 0x4e00 + rand_int( 0x100 );
+    return sbcs_table->sbcs.cp2uni[0x80 + rand_int( 0x80 )];
+}
+
+static void test_sbcs(void)
+{
+    static const unsigned int codepages[] = { 437, 874, 1251, 1252 };
+    static const int flags[] = { 0, MB_ERR_INVALID_CHARS };
+    WCHAR wstr[MAX_LEN + 1], wbuf[MAX_LEN], wref[MAX_LEN];
+    char str[MAX_LEN], buf[MAX_LEN], ref[MAX_LEN];
+    int c, i, j, k, len, ret, expect, used, used_ref, used_char;
+
+    for (c = 0; c < ARRAY_SIZE(codepages); c++)
+    {
+        sbcs_table = wine_cp_get_table( codepages[c] );
+        ok( sbcs_table != NULL, "no table for code page %u\n", codepages[c] );
+        if (!sbcs_table) continue;
+
+        for (i = 0; i < ITERATIONS / 4; i++)
+        {
+            len = rand_string( wstr, 100, rand_sbcs_char );
+
+            /* one char at a time never reaches the kernels */
+            used_ref = 0;
+            for (k = 0; k < len; k++)
+            {
+                wine_cp_wcstombs( sbcs_table, 0, wstr + k, 1, ref + k, 1, NULL, &used_char );
+                used_ref |= used_char;
+            }
+            used = 0;
+            ret = wine_cp_wcstombs( sbcs_table, 0, wstr, len, buf, sizeof(buf), NULL, &used );
+            ok( ret == len, "cp %u: got %d, expected %d\n", codepages[c], ret, len );
+            ok( !memcmp( buf, ref, len ), "cp %u: wrong conversion\n", codepages[c] );
+            ok( used == used_ref, "cp %u: used %d, expected %d\n", codepages[c], used, used_ref );
+            ret = wine_cp_wcstombs( sbcs_table, 0, wstr, len, buf, sizeof(buf), NULL, NULL );
+            ok( !memcmp( buf, ref, len ), "cp %u: wrong conversion without used\n", codepages[c] );
+
+            for (k = 0; k < len; k++) str[k] = rand_int( 3 ) ? ref[k] : 0x80 + rand_int( 0x80 );
+            for (j = 0; j < ARRAY_SIZE(flags); j++)
+            {
+                expect = len;
+                for (k = 0; k < len; k++)
+                    if (wine_cp_mbstowcs( sbcs_table, flags[j], str + k, 1, wref + k, 1 ) < 0) expect = -2;
+                ret = wine_cp_mbstowcs( sbcs_table, flags[j], str, len, NULL, 0 );
+                ok( ret == expect, "cp %u: length %d, expected %d\n", codepages[c], ret, expect );
+                ret = wine_cp_mbstowcs( sbcs_table, flags[j], str, len, wbuf, ARRAY_SIZE(wbuf) );
+                ok( ret == expect, "cp %u: got %d, expected %d\n", codepages[c], ret, expect );
+                if (ret > 0)
+                    ok( !memcmp( wbuf, wref, len * sizeof(WCHAR) ), "cp %u: wrong conversion\n", codepages[c] );
+            }
+        }
+    }
+}
+
+/* convert a string in pieces of whole chars that are too short for the vector code */
+static int dbcs_mbstowcs_pieces( const union cptable *table, int flags, const char *src, int srclen, WCHAR *dst )
+{
+    int i, start, ret, total = 0;
+
+    for (start = 0; start < srclen; start = i)
+    {
+        for (i = start; i < srclen && i - start < 40; i++)
+            if (wine_is_dbcs_leadbyte( table, src[i] ) && i + 1 < srclen && src[i + 1]) i++;
+        if ((ret = wine_cp_mbstowcs( table, flags, src + start, i - start, dst ? dst + total : NULL,
+                                     dst ? MAX_LEN - total : 0 )) < 0) return ret;
+        total += ret;
+    }
+    return total;
+}
+
+static void test_dbcs(void)
+{
+    static const unsigned int codepages[] = { 932, 936, 949, 950 };
+    static const int flags[] = { 0, MB_ERR_INVALID_CHARS };
+    WCHAR wstr[MAX_LEN + 1], wbuf[MAX_LEN], wref[MAX_LEN];
+    char str[2 * MAX_LEN];
+    const union cptable *table;
+    int c, i, j, k, len, ret, expect;
+
+    for (c = 0; c < ARRAY_SIZE(codepages); c++)
+    {
+        table = wine_cp_get_table( codepages[c] );
+        ok( table != NULL, "no table for code page %u\n", codepages[c] );
+        if (!table) continue;
+
+        for (i = 0; i < ITERATIONS / 4; i++)
+        {
+            /* random bytes make invalid pairs, going through WCHARs makes them valid */
+            len = rand_int( MAX_LEN );
+            for (k = 0; k < len; k++) str[k] = rand_int( 4 ) ? 0x20 + rand_int( 0x5f ) : 0x80 + rand_int( 0x80 );
+            if (rand_int( 2 ))
+            {
+                len = wine_cp_mbstowcs( table, 0, str, len, wstr, MAX_LEN );
+                len = wine_cp_wcstombs( table, 0, wstr, len, str, MAX_LEN, NULL, NULL );
+                if (len < 0) len = MAX_LEN;
+            }
+
+            for (j = 0; j < ARRAY_SIZE(flags); j++)
+            {
+                expect = dbcs_mbstowcs_pieces( table, flags[j], str, len, wref );
+                ret = wine_cp_mbstowcs( table, flags[j], str, len, NULL, 0 );
+                ok( ret == expect, "cp %u: length %d, expected %d\n", codepages[c], ret, expect );
+                memset( wbuf, 0xcc, sizeof(wbuf) );
+                ret = wine_cp_mbstowcs( table, flags[j], str, len, wbuf, ARRAY_SIZE(wbuf) );
+                ok( ret == expect, "cp %u: got %d, expected %d\n", codepages[c], ret, expect );
+                if (ret > 0)
+                    ok( !memcmp( wbuf, wref, ret * sizeof(WCHAR) ), "cp %u: wrong conversion\n", codepages[c] );
+                /* nothing is written when there is an invalid char */
+                for (k = 0; ret == -2 && k < ARRAY_SIZE(wbuf); k++) if (wbuf[k] != 0xcccc) break;
+                ok( ret != -2 || k == ARRAY_SIZE(wbuf), "cp %u: buffer written at %d\n", codepages[c], k );
+            }
+        }
+    }
+}
+
+/* the separate unicode, diacritic and case passes the single pass compare replaces */
+static int compare_level( int flags, const WCHAR *str1, int len1, const WCHAR *str2, int len2, int level )
+{
+    static const unsigned int shift[] = { 16, 8, 4 }, mask[] = { 0xffff, 0xff, 0x0f };
+    unsigned int ce1, ce2;
+    int ret;
+
+    while (len1 > 0 && len2 > 0)
+    {
+        if (flags & NORM_IGNORESYMBOLS)
+        {
+            int skipped = 0;
+            if (get_char_typeW( *str1 ) & (C1_PUNCT | C1_SPACE)) { str1++; len1--; skipped = 1; }
+            if (get_char_typeW( *str2 ) & (C1_PUNCT | C1_SPACE)) { str2++; len2--; skipped = 1; }
+            if (skipped) continue;
+        }
+        if (!level && !(flags & SORT_STRINGSORT))
+        {
+            int hyphen1 = *str1 == '-' || *str1 == '\'', hyphen2 = *str2 == '-' || *str2 == '\'';
+
+            if (hyphen1 && !hyphen2) { str1++; len1--; continue; }
+            if (hyphen2 && !hyphen1) { str2++; len2--; continue; }
+        }
+        ce1 = get_char_infoW( *str1 )->collation;
+        ce2 = get_char_infoW( *str2 )->collation;
+        if (ce1 != ~0u && ce2 != ~0u)
+            ret = ((ce1 >> shift[level]) & mask[level]) - ((ce2 >> shift[level]) & mask[level]);
+        else
+            ret = *str1 - *str2;
+        if (ret) return ret;
+        str1++; str2++; len1--; len2--;
+    }
+    while (len1 && !*str1) { str1++; len1--; }
+    while (len2 && !*str2) { str2++; len2--; }
+    return len1 - len2;
+}
+
+static int compare_reference( int flags, const WCHAR *str1, int len1, const WCHAR *str2, int len2 )
+{
+    int ret = compare_level( flags, str1, len1, str2, len2, 0 );
+
+    if (!ret && !(flags & NORM_IGNORENONSPACE)) ret = compare_level( flags, str1, len1, str2, len2, 1 );
+    if (!ret && !(flags & NORM_IGNORECASE)) ret = compare_level( flags, str1, len1, str2, len2, 2 );
+    return ret;
+}
+
+/* a copy of str with a few chars changed, inserted or dropped */
+static int mutate_string( const WCHAR *str, int len, WCHAR *dst )
+{
+    int i, pos, count = len;
+
+    memcpy( dst, str, len * sizeof(WCHAR) );
+    for (i = rand_int( 4 ); i; i--)
+    {
+        pos = rand_int( count + 1 );
+        switch (rand_int( 4 ))
+        {
+        case 0:
+            if (pos < count) dst[pos] = islowerW( dst[pos] ) ? toupperW( dst[pos] ) : tolowerW( dst[pos] );
+            break;
+        case 1:
+            if (pos < count) dst[pos] = rand_char();
+            break;
+        case 2:
+            if (count == MAX_LEN) break;
+            memmove( dst + pos + 1, dst + pos, (count - pos) * sizeof(WCHAR) );
+            dst[pos] = rand_char();
+            count++;
+            break;
+        case 3:
+            if (pos == count) break;
+            memmove( dst + pos, dst + pos + 1, (count - pos - 1) * sizeof(WCHAR) );
+            count--;
+            break;
+        }
+    }
+    dst[count] = 0;
+    return count;
+}
+
+static void test_compare_string(void)
+{
+    static const int flags[] = { 0, NORM_IGNORECASE, NORM_IGNORENONSPACE, NORM_IGNORESYMBOLS, SORT_STRINGSORT,
+                                 NORM_IGNORECASE | NORM_IGNORESYMBOLS };
+    WCHAR str1[MAX_LEN + 1], str2[MAX_LEN + 1];
+    int i, j, len1, len2, ret, expect;
+
+    for (i = 0; i < ITERATIONS; i++)
+    {
+        len1 = rand_string( str1, 40, rand_char );
+        len2 = mutate_string( str1, len1, str2 );
+        for (j = 0; j < ARRAY_SIZE(flags); j++)
+        {
+            expect = sign( compare_reference( flags[j], str1, len1, str2, len2 ));
+            ret = sign( wine_compare_string( flags[j], str1, len1, str2, len2 ));
+            ok( ret == expect, "%d: flags %#x got %d, expected %d\n", i, flags[j], ret, expect );
+        }
+    }
+}
+
+static WCHAR *strstr_reference( const WCHAR *str, const WCHAR *sub )
+{
+    int i;
+
+    for (; *str; str++)
+    {
+        for (i = 0; sub[i] && str[i] == sub[i]; i++) ;
+        if (!sub[i]) return (WCHAR *)str;
+    }
+    return NULL;
+}
+
+static void test_case_insensitive(void)
+{
+    WCHAR str1[MAX_LEN + 1], str2[MAX_LEN + 1], *ptr;
+    int i, k, len1, len2, n, ret, expect;
+
+    for (i = 0; i < ITERATIONS; i++)
+    {
+        len1 = rand_string( str1, 60, rand_char );
+        len2 = mutate_string( str1, len1, str2 );
+
+        for (k = 0; str1[k] && tolowerW( str1[k] ) == tolowerW( str2[k] ); k++) ;
+        expect = sign( tolowerW( str1[k] ) - tolowerW( str2[k] ));
+        ret = sign( strcmpiW( str1, str2 ));
+        ok( ret == expect, "%d: strcmpiW got %d, expected %d\n", i, ret, expect );
+
+        n = min( len1, len2 );
+        for (k = 0; k < n && tolowerW( str1[k] ) == tolowerW( str2[k] ); k++) ;
+        expect = k < n ? sign( tolowerW( str1[k] ) - tolowerW( str2[k] )) : 0;
+        ret = sign( memicmpW( str1, str2, n ));
+        ok( ret == expect, "%d: memicmpW got %d, expected %d\n", i, ret, expect );
+
+        /* look for a piece of the mutated string in the original one */
+        k = rand_int( len2 + 1 );
+        str2[k + rand_int( len2 - k + 1 )] = 0;
+        ptr = strstr_reference( str1, str2 + k );
+        ok( strstrW( str1, str2 + k ) == ptr, "%d: strstrW got %p, expected %p\n", i,
+            strstrW( str1, str2 + k ), ptr );
+    }
+}
+
+static void test_ansi_string(void)
+{
+    static const char hello[] = "hello world";
+    static const WCHAR helloW[] = {'h','e','l','l','o',' ','w','o','r','l','d',0};
+    WCHAR buffer[32];
+    UNICODE_STRING uni;
+    STRING ansi;
+    NTSTATUS status;
+    int i, size;
+
+    RtlInitString( &ansi, hello );
+    for (size = 0; size <= sizeof(helloW) + 2; size++)
+    {
+        memset( buffer, 0xcc, sizeof(buffer) );
+        uni.Buffer = buffer;
+        uni.Length = 0;
+        uni.MaximumLength = size;
+        status = RtlAnsiStringToUnicodeString( &uni, &ansi, FALSE );
+        ok( uni.Length == sizeof(helloW) - sizeof(WCHAR), "%d: got length %u\n", size, uni.Length );
+        if (size < sizeof(helloW))
+        {
+            ok( status == STATUS_BUFFER_OVERFLOW, "%d: got %#x\n", size, status );
+            /* nothing is written to a buffer that is too small */
+            for (i = 0; i < ARRAY_SIZE(buffer); i++) if (buffer[i] != 0xcccc) break;
+            ok( i == ARRAY_SIZE(buffer), "%d: buffer written at %d\n", size, i );
+        }
+        else
+        {
+            ok( status == STATUS_SUCCESS, "%d: got %#x\n", size, status );
+            ok( !memcmp( buffer, helloW, sizeof(helloW) ), "%d: wrong conversion\n", size );
+        }
+    }
+}
+
+START_TEST(unicode)
+{
+    test_utf8();
+    test_sbcs();
+    test_dbcs();
+    test_compare_string();
+    test_case_insensitive();
+    test_ansi_string();
+}